@@ -44,6 +44,20 @@ NriStruct(VKExtensions) {
     uint32_t deviceExtensionNum;
 };
 
+// Categories of "enableNRIValidation" checks, which can be turned off to reduce CPU overhead (argument checks are always on)
+NriBits(ValidationBits, uint8_t,
+    NONE                            = 0,
+    LIFETIME                        = NriBit(0),    // command buffer recording state, submission of command buffers being recorded
+    BARRIERS                        = NriBit(1),    // "CmdBarrier" resources, layouts and access masks
+    DESCRIPTOR_BOUNDS               = NriBit(2),    // descriptor set indices and tracking of bound descriptor sets
+    RENDER_PASS                     = NriBit(3)     // "inside/outside of CmdBeginRendering" rules and tracking of attachments
+);
+
+NriStruct(ValidationLevel) {
+    Nri(ValidationBits) disabledCategories;     // all categories are validated by default
+    uint32_t commandBufferSampling;             // "N": categories are validated only for every Nth command buffer recording ("0" and "1" mean "all")
+};
+
 // A collection of queues of the same type
 NriStruct(QueueFamilyDesc) {
     NriOptional const float* queuePriorities;   // [-1; 1]: low < 0, normal = 0, high > 0 ("queueNum" entries expected)
@@ -70,12 +84,22 @@ NriStruct(DeviceCreationDesc) {
     Nri(VKBindingOffsets) vkBindingOffsets;
     NriOptional Nri(VKExtensions) vkExtensions; // to enable
 
+    // NONE specific
+    NriOptional uint64_t noneVideoMemoryBudget; // fake "DEVICE" budget reported by "QueryVideoMemoryInfo" (usage is always 0), useful for testing residency policies
+
+    // Validation (requires "enableNRIValidation")
+    NriOptional Nri(ValidationLevel) validationLevel;
+
+    // Capture (requires "NRI_ENABLE_CAPTURE_SUPPORT")
+    NriOptional const char* captureFileName;    // if set, "CoreInterface", mesh shader, ray tracing, swap chain and low latency calls are recorded into this file (see "NRI_Replay")
+
     // Switches (disabled by default)
     bool enableNRIValidation;                   // embedded validation layer, checks for NRI specifics
     bool enableGraphicsAPIValidation;           // GAPI-provided validation layer
     bool enableD3D11CommandBufferEmulation;     // enable? but why? (auto-enabled if deferred contexts are not supported)
     bool enableD3D12RayTracingValidation;       // slow but useful, can only be enabled if envvar "NV_ALLOW_RAYTRACING_VALIDATION" is set to "1"
     bool enableMemoryZeroInitialization;        // page-clears are fast, but memory is not cleared by default in VK
+    bool enableVKDescriptorBuffer;              // descriptor sets live in host-visible "descriptor buffers" ("VK_EXT_descriptor_buffer"), if supported. "CmdSetDescriptorPool" becomes mandatory (as in D3D12)
 
     // Switches (enabled by default)
     bool disableVKRayTracing;                   // to save CPU memory in some implementations
@@ -86,6 +110,10 @@ NriStruct(DeviceCreationDesc) {
 // else "adapterDescNum" must be set to number of elements in "adapterDescs"
 NRI_API Nri(Result) NRI_CALL nriEnumerateAdapters(NriPtr(AdapterDesc) adapterDescs, NonNriRef(uint32_t) adapterDescNum);
 
+// Adapters are enumerated once and cached process-wide (VK: along with the loader and the instance used for enumeration), device creation reuses the cache.
+// Invalidation releases the cache, the next enumeration starts from scratch (call it if adapters or drivers may have changed)
+NRI_API void NRI_CALL nriInvalidateAdapterCache();
+
 NRI_API Nri(Result) NRI_CALL nriCreateDevice(const NriRef(DeviceCreationDesc) deviceCreationDesc, NriOut NriRef(Device*) device);
 NRI_API void NRI_CALL nriDestroyDevice(NriPtr(Device) device);
 
@@ -8,29 +8,54 @@
 
 NriNamespaceBegin
 
+NriForwardStruct(BindlessAllocator);
+NriForwardStruct(Defragmenter);
+NriForwardStruct(PipelineCacheStore);
+NriForwardStruct(PipelineCompiler);
+NriForwardStruct(ResidencyManager);
+
 NriStruct(VideoMemoryInfo) {
     uint64_t budgetSize;    // the OS-provided video memory budget. If "usageSize" > "budgetSize", the application may incur stuttering or performance penalties
     uint64_t usageSize;     // specifies the application’s current video memory usage
 };
 
+// A file as the data source for "UploadData": data gets copied from the mapped file pages directly into the staging memory, no need to read the file into RAM first
+NriStruct(UploadFileDesc) {
+    NriOptional const void* mappedView;     // an already mapped view of the whole file, or...
+    uint64_t fileHandle;                    // ... a file descriptor (POSIX) or "HANDLE" (Windows) opened for reading, which gets mapped for the duration of "UploadData" (not closed)
+};
+
+// CPU mip generation in "UploadData" (formats with 8-bit UNORM/SRGB, 16-bit or 32-bit SFLOAT channels, sRGB formats are filtered in linear space)
+NriEnum(MipGeneration, uint8_t,
+    NONE,
+    BOX,                                    // 2x2 box filter
+    NORMAL_MAP                              // 2x2 box filter of renormalized XYZ vectors ("xyz * 0.5 + 0.5" for UNORM formats, "Z" is reconstructed for 2-channel formats)
+);
+
 NriStruct(TextureSubresourceUploadDesc) {
     const void* slices;
     uint32_t sliceNum;
     uint32_t rowPitch;
     uint32_t slicePitch;
+    NriOptional uint64_t fileOffset;        // used instead of "slices" if "TextureUploadDesc::file" is provided (DDS/KTX2-style layouts)
 };
 
 NriStruct(TextureUploadDesc) {
-    NriOptional const NriPtr(TextureSubresourceUploadDesc) subresources; // if provided, must include ALL subresources = layerNum * mipNum
+    NriOptional const NriPtr(TextureSubresourceUploadDesc) subresources; // if provided, must include ALL subresources = layerNum * mipNum (or only "layerNum" top mips if "mipGeneration" is used)
     NriPtr(Texture) texture;
     Nri(AccessLayoutStage) after;
     Nri(PlaneBits) planes;
+    NriOptional const NriPtr(UploadFileDesc) file;
+    NriOptional Nri(Format) dataFormat; // if differs from the texture format, subresources get converted while copying (plain formats with 8-bit UNORM/SRGB, 16-bit or 32-bit SFLOAT channels)
+    NriOptional Nri(MipGeneration) mipGeneration; // if not "NONE", lower mips are generated from the top mips on the CPU ("file" and 3D textures are not supported)
 };
 
 NriStruct(BufferUploadDesc) {
     NriOptional const void* data; // if provided, must be data for the whole buffer
     NriPtr(Buffer) buffer;
     Nri(AccessStage) after;
+    NriOptional const NriPtr(UploadFileDesc) file;  // if provided, the data for the whole buffer is taken from the file at "fileOffset" ("data" is ignored)
+    NriOptional uint64_t fileOffset;
 };
 
 NriStruct(ResourceGroupDesc) {
@@ -44,6 +69,160 @@ NriStruct(ResourceGroupDesc) {
     NriOptional bool vma;                     // memory allocation goes through "AMD Virtual Memory Allocator"
 };
 
+// Budget-driven residency: cold allocations get the lowest residency priority when usage approaches the budget, and their original priority back when they become hot again
+NriStruct(ResidencyManagerDesc) {
+    Nri(MemoryLocation) memoryLocation;     // budget to watch (usually "DEVICE")
+    NriOptional float demoteThreshold;      // (0; 1]: demote cold allocations if usage > budget * threshold (0.9 if 0)
+    NriOptional float promoteThreshold;     // (0; 1]: promote hot allocations if usage after promotion <= budget * threshold (0.8 if 0)
+    NriOptional uint32_t coldFrameNum;      // an allocation not used for this number of frames is cold (3 if 0)
+};
+
+NriStruct(ResidencyStats) {
+    uint64_t budgetSize;    // "VideoMemoryInfo::budgetSize"
+    uint64_t usageSize;     // max of "VideoMemoryInfo::usageSize" and the total size of tracked allocations
+    uint64_t trackedSize;   // total size of tracked allocations
+    uint64_t demotedSize;   // total size of demoted allocations (assumed to be evicted)
+    uint32_t demotedNum;    // allocations demoted during the last update
+    uint32_t promotedNum;   // allocations promoted during the last update
+};
+
+// Incremental defragmentation: resources are moved out of sparsely occupied memory objects into new compact ones, the copying is spread across "DefragmentStep" calls
+NriStruct(DefragmenterDesc) {
+    Nri(MemoryLocation) memoryLocation;         // location of the memory objects to defragment
+    NriOptional uint64_t preferredMemorySize;   // desired size of new memory objects (but can be greater if a resource doesn't fit), 256 Mb if 0
+    NriOptional uint64_t maxBytesPerStep;       // copy budget per "DefragmentStep" (but at least 1 resource is moved), 32 Mb if 0
+    NriOptional float occupancyThreshold;       // (0; 1]: memory objects occupied less than this are compacted (0.5 if 0)
+};
+
+NriStruct(DefragmentationMemoryDesc) {
+    NriPtr(Memory) memory;
+    uint64_t size;                              // as allocated
+};
+
+// All resources bound to a memory object must be listed, otherwise the memory object is not considered for compaction
+NriStruct(DefragmentationResourceDesc) {
+    NriOptional NriPtr(Buffer) buffer;          // a buffer or...
+    NriOptional NriPtr(Texture) texture;        // a texture (all subresources must be in the same state)
+    uint32_t memoryIndex;                       // in "DefragmentationDesc::memories"
+    Nri(AccessLayoutStage) state;               // current state, which the new resource inherits ("layout" is ignored for buffers)
+};
+
+NriStruct(DefragmentationDesc) {
+    const NriPtr(DefragmentationMemoryDesc) memories;
+    uint32_t memoryNum;
+    const NriPtr(DefragmentationResourceDesc) resources;
+    uint32_t resourceNum;
+};
+
+NriStruct(DefragmentationMove) {
+    uint32_t resourceIndex;                     // in "DefragmentationDesc::resources"
+    NriPtr(Buffer) buffer;                      // replacement for "buffer", if the resource is a buffer
+    NriPtr(Texture) texture;                    // replacement for "texture", if the resource is a texture
+};
+
+// Moves whose copies have completed on the GPU: the app must replace old resources with new ones (descriptors must be recreated). Pointers are valid until the next "DefragmentStep"
+NriStruct(DefragmentationResult) {
+    const NriPtr(DefragmentationMove) moves;
+    uint32_t moveNum;
+    NriPtr(Memory) const* memories;             // new memory objects (now owned by the app)
+    uint32_t memoryNum;
+    const uint32_t* emptiedMemoryIndices;       // in "DefragmentationDesc::memories", all resources have been moved out and can be destroyed, then the memory can be freed
+    uint32_t emptiedMemoryNum;
+    bool isFinished;                            // all planned moves have been handed out
+};
+
+// Persistent pipeline cache: a file with a header (device, driver and NRI versions, payload hash) protecting from stale, incompatible or corrupted data
+NriStruct(PipelineCacheStoreDesc) {
+    const char* fileName;                       // the file is loaded on creation (a missing or rejected file means an empty cache) and replaced atomically on save
+    NriOptional uint32_t workerCacheNum;        // number of per-thread caches merged into the main one on save (if merging is unsupported, all of them are the main cache)
+};
+
+NriStruct(PipelineCacheStoreStats) {
+    uint64_t loadedSize;                        // payload size loaded from the file, 0 if there was nothing to load
+    uint64_t savedSize;                         // payload size of the last successful save
+    uint32_t saveNum;                           // number of saves that actually wrote the file
+    uint32_t skippedSaveNum;                    // number of saves skipped because the content hasn't changed
+    bool isRejected;                            // the file has been found, but rejected (stale or corrupted)
+};
+
+// Pipeline libraries cached by the device for "GraphicsPipelineBits::USE_LIBRARIES" (libraries of a pipeline layout are released with the layout)
+NriStruct(PipelineLibraryStats) {
+    uint32_t libraryNum;                        // live libraries
+    uint32_t hitNum;                            // library lookups served from the cache
+    uint32_t missNum;                           // library lookups requiring a compilation
+};
+
+// Asynchronous pipeline compilation: pipelines are created on worker threads, all memory referenced by a pipeline desc must stay valid until the pipeline is complete
+NriStruct(PipelineCompilerDesc) {
+    NriOptional uint32_t threadNum;             // number of worker threads (half of the hardware threads if 0)
+    NriOptional uint32_t pipelineMaxNum;        // max number of not released pipelines (4096 if 0)
+    NriOptional uint32_t injectedLatency;       // debug: milliseconds added to every compilation to test scheduling (for example, on "GraphicsAPI::NONE", which compiles instantly)
+    NriOptional void (NRI_CALL *CompletionCallback)(uint32_t pipelineHandle, Nri(Result) result, NriPtr(Pipeline) pipeline, void* userArg); // called on a worker thread, once a pipeline is complete
+    NriOptional void* userArg;
+};
+
+// Pipeline creation feedback (VK: "VK_EXT_pipeline_creation_feedback", other APIs: "UNSUPPORTED"). Durations are in nanoseconds
+NriBits(PipelineFeedbackBits, uint8_t,
+    NONE                = 0,
+    VALID               = NriBit(0), // feedback is provided by the driver
+    CACHE_HIT           = NriBit(1)  // served from a "PipelineCache" without compilation
+);
+
+NriStruct(PipelineStageFeedback) {
+    Nri(StageBits) stage;
+    uint64_t duration;
+    Nri(PipelineFeedbackBits) flags;            // "CACHE_HIT" per stage is a hint, drivers may not report it
+};
+
+NriStruct(PipelineFeedback) {
+    Nri(PipelineStageFeedback) stages[8];       // in the order of shaders in the pipeline desc (only the first 8 stages are reported)
+    uint64_t duration;                          // the whole pipeline creation
+    uint32_t stageNum;
+    Nri(PipelineFeedbackBits) flags;
+};
+
+NriStruct(SlowPipeline) {
+    char debugName[64];                         // "SetDebugName" called after the creation is respected, empty if not named
+    uint64_t duration;
+    Nri(PipelineFeedbackBits) flags;
+};
+
+// Aggregated over all pipelines created by the device (cache hit rate = "cacheHitNum / pipelineNum")
+NriStruct(PipelineFeedbackStats) {
+    Nri(SlowPipeline) slowestPipelines[16];     // sorted by "duration", the slowest first
+    uint64_t totalDuration;
+    uint32_t pipelineNum;                       // pipelines with valid feedback
+    uint32_t cacheHitNum;
+    uint32_t slowestPipelineNum;
+};
+
+// Bindless descriptor allocation: each class owns one big descriptor set, indices are stable for the whole lifetime of a descriptor
+// The range must be "VARIABLE_SIZED_ARRAY | PARTIALLY_BOUND | ALLOW_UPDATE_AFTER_SET" (the set must have "DescriptorSetBits::ALLOW_UPDATE_AFTER_SET")
+NriStruct(BindlessClassDesc) {
+    Nri(DescriptorType) descriptorType;         // type of the range ("MUTABLE" requires "features.mutableDescriptorType")
+    uint32_t setIndex;                          // in "BindlessAllocatorDesc::pipelineLayout"
+    uint32_t rangeIndex;                        // in the set
+    uint32_t descriptorNum;                     // capacity, used as "variableDescriptorNum"
+};
+
+NriStruct(BindlessAllocatorDesc) {
+    const NriPtr(PipelineLayout) pipelineLayout;
+    const NriPtr(BindlessClassDesc) classes;    // i.e. resource classes (textures, buffers, samplers...)
+    uint32_t classNum;
+};
+
+// Redundant state filtering: "CmdXxx" calls dropped because the same state is already set (VK only, zeros otherwise)
+// Accumulated over all command buffers at "EndCommandBuffer"
+NriStruct(RedundantCommandStats) {
+    uint64_t pipelineNum;                       // "CmdSetPipeline" (depth bias provided at creation time is still set)
+    uint64_t pipelineLayoutNum;                 // "CmdSetPipelineLayout" (immutable samplers are not pushed again)
+    uint64_t descriptorSetNum;                  // "CmdSetDescriptorSet"
+    uint64_t vertexBufferNum;                   // "CmdSetVertexBuffers" (partially redundant calls bind only the changed slots)
+    uint64_t indexBufferNum;                    // "CmdSetIndexBuffer"
+    uint64_t viewportNum;                       // "CmdSetViewports"
+    uint64_t scissorNum;                        // "CmdSetScissors"
+};
+
 NriStruct(FormatProps) {
     const char* name;       // format name
     Nri(Format) format;     // self
@@ -78,6 +257,68 @@ NriStruct(HelperInterface) {
 
     // Information about video memory
     Nri(Result) (NRI_CALL *QueryVideoMemoryInfo)        (const NriRef(Device) device, Nri(MemoryLocation) memoryLocation, NriOut NriRef(VideoMemoryInfo) videoMemoryInfo);
+
+    // Residency priority of an existing allocation, [-1; 1] (see "AllocateMemoryDesc::priority")
+    Nri(Result) (NRI_CALL *SetMemoryPriority)           (NriRef(Memory) memory, float priority);
+
+    // Residency manager ("UpdateResidency" is expected to be called once per frame, memory handles are "0" if tracking fails)
+    Nri(Result) (NRI_CALL *CreateResidencyManager)      (NriRef(Device) device, const NriRef(ResidencyManagerDesc) residencyManagerDesc, NriOut NriRef(ResidencyManager*) residencyManager);
+    void        (NRI_CALL *DestroyResidencyManager)     (NriPtr(ResidencyManager) residencyManager);
+    uint32_t    (NRI_CALL *TrackMemory)                 (NriRef(ResidencyManager) residencyManager, NriRef(Memory) memory, uint64_t size, float priority);
+    void        (NRI_CALL *UntrackMemory)               (NriRef(ResidencyManager) residencyManager, uint32_t memoryHandle); // must be called before "FreeMemory"
+    void        (NRI_CALL *MarkMemoryUsed)              (NriRef(ResidencyManager) residencyManager, const uint32_t* memoryHandles, uint32_t memoryHandleNum);
+    Nri(Result) (NRI_CALL *UpdateResidency)             (NriRef(ResidencyManager) residencyManager, NriOptional NriPtr(ResidencyStats) residencyStats);
+
+    // Defragmentation ("PlanDefragmentation" returns the number of planned moves, a new plan can be made once the previous one is finished)
+    // "DefragmentStep" doesn't block: it hands out completed moves and submits copies for the next ones into "queue" (expected to be called once per frame)
+    Nri(Result) (NRI_CALL *CreateDefragmenter)          (NriRef(Queue) queue, const NriRef(DefragmenterDesc) defragmenterDesc, NriOut NriRef(Defragmenter*) defragmenter);
+    void        (NRI_CALL *DestroyDefragmenter)         (NriPtr(Defragmenter) defragmenter); // waits for in-flight copies, destroys resources and memory not handed out yet
+    uint32_t    (NRI_CALL *PlanDefragmentation)         (NriRef(Defragmenter) defragmenter, const NriRef(DefragmentationDesc) defragmentationDesc);
+    Nri(Result) (NRI_CALL *DefragmentStep)              (NriRef(Defragmenter) defragmenter, NriOut NriRef(DefragmentationResult) defragmentationResult);
+
+    // Pipeline caches ("UNSUPPORTED" if caches can't be merged, a cache can't be merged into itself)
+    Nri(Result) (NRI_CALL *MergePipelineCaches)         (NriRef(PipelineCache) dstPipelineCache, const NriPtr(PipelineCache) const* srcPipelineCaches, uint32_t srcPipelineCacheNum);
+
+    // Pipeline cache store ("SavePipelineCacheStore" writes the file only if the content has changed, "async = true" moves merging, serialization and writing to a background thread)
+    Nri(Result)             (NRI_CALL *CreatePipelineCacheStore)    (NriRef(Device) device, const NriRef(PipelineCacheStoreDesc) pipelineCacheStoreDesc, NriOut NriRef(PipelineCacheStore*) pipelineCacheStore);
+    void                    (NRI_CALL *DestroyPipelineCacheStore)   (NriPtr(PipelineCacheStore) pipelineCacheStore); // waits for a pending save, but doesn't save
+    NriPtr(PipelineCache)   (NRI_CALL *GetPipelineCacheStoreCache)  (const NriRef(PipelineCacheStore) pipelineCacheStore, uint32_t workerIndex); // "workerIndex" < "workerCacheNum" (any value if "workerCacheNum = 0")
+    Nri(Result)             (NRI_CALL *SavePipelineCacheStore)      (NriRef(PipelineCacheStore) pipelineCacheStore, bool async); // an async save waits for the previous one and returns the result of the previous one
+    void                    (NRI_CALL *GetPipelineCacheStoreStats)  (const NriRef(PipelineCacheStore) pipelineCacheStore, NriOut NriRef(PipelineCacheStoreStats) pipelineCacheStoreStats);
+
+    // Pipeline libraries (zeroed if "features.graphicsPipelineLibrary" is unsupported)
+    void                    (NRI_CALL *GetPipelineLibraryStats)     (const NriRef(Device) device, NriOut NriRef(PipelineLibraryStats) pipelineLibraryStats);
+
+    // Asynchronous pipeline compilation ("CompileXxxPipelineAsync" returns a handle immediately, "0" if the request can't be queued or "pipelineMaxNum" is reached)
+    // "AcquirePipeline" returns the pipeline if it's ready or "substitute" otherwise (NULL means "skip the draw"), pipelines are owned by the compiler
+    // "IsPipelineReady" and "AcquirePipeline" are lock-free. "ReleasePipeline" invalidates the handle and destroys the pipeline (or drops the request), the slot gets reused
+    Nri(Result)             (NRI_CALL *CreatePipelineCompiler)          (NriRef(Device) device, const NriRef(PipelineCompilerDesc) pipelineCompilerDesc, NriOut NriRef(PipelineCompiler*) pipelineCompiler);
+    void                    (NRI_CALL *DestroyPipelineCompiler)         (NriPtr(PipelineCompiler) pipelineCompiler); // drops queued requests, waits for running ones, destroys all pipelines
+    uint32_t                (NRI_CALL *CompileGraphicsPipelineAsync)    (NriRef(PipelineCompiler) pipelineCompiler, const NriRef(GraphicsPipelineDesc) graphicsPipelineDesc);
+    uint32_t                (NRI_CALL *CompileComputePipelineAsync)     (NriRef(PipelineCompiler) pipelineCompiler, const NriRef(ComputePipelineDesc) computePipelineDesc);
+    bool                    (NRI_CALL *IsPipelineReady)                 (const NriRef(PipelineCompiler) pipelineCompiler, uint32_t pipelineHandle); // "false" if pending or failed
+    NriPtr(Pipeline)        (NRI_CALL *AcquirePipeline)                 (const NriRef(PipelineCompiler) pipelineCompiler, uint32_t pipelineHandle, NriOptional NriPtr(Pipeline) substitute);
+    void                    (NRI_CALL *ReleasePipeline)                 (NriRef(PipelineCompiler) pipelineCompiler, uint32_t pipelineHandle); // the pipeline must not be in use by the GPU or acquired by another thread, no "CompletionCallback" for a dropped request
+
+    // Pipeline creation feedback ("UNSUPPORTED" if feedback is not available for the pipeline)
+    Nri(Result)             (NRI_CALL *GetPipelineFeedback)             (const NriRef(Pipeline) pipeline, NriOut NriRef(PipelineFeedback) pipelineFeedback);
+    void                    (NRI_CALL *GetPipelineFeedbackStats)        (const NriRef(Device) device, NriOut NriRef(PipelineFeedbackStats) pipelineFeedbackStats);
+
+    // Bindless allocator ("AllocateBindlessIndex" and "ReleaseBindlessIndex" are lock-free, can be called from any thread)
+    // "SetBindlessDescriptor" writes are batched and applied in one "UpdateDescriptorRanges" call by "UpdateBindlessAllocator", which is expected to be called once per frame before "QueueSubmit"
+    // "SetBindlessDescriptor" stores the pointer, i.e. the descriptor must stay alive at least until the next "UpdateBindlessAllocator" call (and while the GPU can access it)
+    // A released index is reused only after the GPU has completed the frame it was released in. Frames are counted by "UpdateBindlessAllocator" calls, starting from 0
+    Nri(Result)             (NRI_CALL *CreateBindlessAllocator)         (NriRef(Device) device, const NriRef(BindlessAllocatorDesc) bindlessAllocatorDesc, NriOut NriRef(BindlessAllocator*) bindlessAllocator);
+    void                    (NRI_CALL *DestroyBindlessAllocator)        (NriPtr(BindlessAllocator) bindlessAllocator); // pending writes are dropped, the GPU must be idle
+    NriPtr(DescriptorSet)   (NRI_CALL *GetBindlessDescriptorSet)        (const NriRef(BindlessAllocator) bindlessAllocator, uint32_t classIndex);
+    Nri(Result)             (NRI_CALL *AllocateBindlessIndex)           (NriRef(BindlessAllocator) bindlessAllocator, uint32_t classIndex, NriOut NonNriRef(uint32_t) index); // "OUT_OF_MEMORY" if the class is full
+    void                    (NRI_CALL *ReleaseBindlessIndex)            (NriRef(BindlessAllocator) bindlessAllocator, uint32_t classIndex, uint32_t index);
+    void                    (NRI_CALL *SetBindlessDescriptor)           (NriRef(BindlessAllocator) bindlessAllocator, uint32_t classIndex, uint32_t index, const NriRef(Descriptor) descriptor); // the last write wins
+    void                    (NRI_CALL *UpdateBindlessAllocator)         (NriRef(BindlessAllocator) bindlessAllocator, uint64_t completedFrameNum); // "completedFrameNum" = number of frames completed by the GPU
+
+    // Redundant state filtering ("GetCommandBufferNativeObject" forgets the bound state, but native commands recorded later via the same handle must be followed by "InvalidateCommandBufferState")
+    void                    (NRI_CALL *GetRedundantCommandStats)        (const NriRef(Device) device, NriOut NriRef(RedundantCommandStats) redundantCommandStats);
+    void                    (NRI_CALL *InvalidateCommandBufferState)    (NriRef(CommandBuffer) commandBuffer); // the next "CmdXxx" calls are not filtered (no-op if filtering is not supported)
 };
 
 // Format utilities
@@ -9,6 +9,7 @@
 NriNamespaceBegin
 
 NriForwardStruct(Streamer);
+NriForwardStruct(UploadFileDesc); // see "NRIHelper.h"
 
 NriStruct(DataSize) {
     const void* data;
@@ -28,6 +29,10 @@ NriStruct(StreamerDesc) {
     // Dynamically (re)allocated ring-buffer for copying and rendering
     Nri(MemoryLocation) dynamicBufferMemoryLocation;    // UPLOAD or DEVICE_UPLOAD
     Nri(BufferDesc) dynamicBufferDesc;                  // "size" is ignored
+
+    // Statically allocated "HOST_READBACK" ring-buffer for readbacks (optional)
+    NriOptional uint64_t readbackBufferSize;            // per frame, must be < 4 Gb ("queuedFrameNum + 1" frames are allocated)
+
     uint32_t queuedFrameNum;                            // number of frames "in-flight" (usually 1-3), adds 1 under the hood for the current "not-yet-committed" frame
 };
 
@@ -44,9 +49,12 @@ NriStruct(StreamBufferDataDesc) {
 
 NriStruct(StreamTextureDataDesc) {
     // Data to upload
-    const void* data;
+    const void* data;                                   // ignored if "file" is provided
+    NriOptional const NriPtr(UploadFileDesc) file;      // if provided, the data is taken from the file at "fileOffset" ("dataSlicePitch * depth" bytes), a "fileHandle" gets mapped for the duration of the call
+    NriOptional uint64_t fileOffset;
     uint32_t dataRowPitch;
     uint32_t dataSlicePitch;
+    NriOptional Nri(Format) dataFormat;                 // if differs from the texture format, "data" gets converted while copying (plain formats with 8-bit UNORM/SRGB, 16-bit or 32-bit SFLOAT channels)
 
     // Destination
     NriOptional NriPtr(Texture) dstTexture;
@@ -72,8 +80,18 @@ NriStruct(StreamerInterface) {
     // {
         // (DEVICE) Copy data to destinations (if any), which must be in "COPY_DESTINATION" state
         void            (NRI_CALL *CmdCopyStreamedData)         (NriRef(CommandBuffer) commandBuffer, NriRef(Streamer) streamer);
+
+        // (DEVICE) Copy data to the readback ring-buffer. Sources must be in "COPY_SOURCE" state. Return a "ticket" ("0" if out of memory)
+        // "dataLayout" describes the data returned by "TryGetReadbackData" ("offset" is always 0)
+        // D3D11: only one texture readback per frame is supported
+        uint64_t        (NRI_CALL *CmdReadbackBuffer)           (NriRef(CommandBuffer) commandBuffer, NriRef(Streamer) streamer, const NriRef(Buffer) srcBuffer, uint64_t srcOffset, uint64_t size);
+        uint64_t        (NRI_CALL *CmdReadbackTexture)          (NriRef(CommandBuffer) commandBuffer, NriRef(Streamer) streamer, const NriRef(Texture) srcTexture, const NriRef(TextureRegionDesc) srcRegion, NriOut NriRef(TextureDataLayoutDesc) dataLayout);
     // }
 
+    // (HOST) Never stalls. Return "NULL" if the data is not ready yet or already overwritten. Data becomes available "queuedFrameNum" frames later
+    // (the app must have waited for the "ticket" frame by then), stays valid until the next "EndStreamerFrame" and must be consumed (copied) in that frame
+    const void*         (NRI_CALL *TryGetReadbackData)          (NriRef(Streamer) streamer, uint64_t ticket);
+
     // (HOST) Must be called once at the very end of the frame
     void                (NRI_CALL *EndStreamerFrame)            (NriRef(Streamer) streamer);
 };
@@ -49,7 +49,8 @@ NriBits(SwapChainBits, uint8_t,
     VSYNC               = NriBit(0), // cap framerate to the monitor refresh rate
     WAITABLE            = NriBit(1), // unlock "WaitForPresent" reducing latency (requires "features.waitableSwapChain")
     ALLOW_TEARING       = NriBit(2), // allow screen tearing if possible
-    ALLOW_LOW_LATENCY   = NriBit(3)  // allow "NRILowLatency" functionality (requires "features.lowLatency")
+    ALLOW_LOW_LATENCY   = NriBit(3), // allow "NRILowLatency" functionality (requires "features.lowLatency")
+    VIRTUAL             = NriBit(4)  // headless: "window" is ignored, textures are ordinary textures, presentation is simulated (see "VirtualSwapChainDesc")
 );
 
 NriStruct(WindowsWindow) {  // Expects "WIN32" platform macro
@@ -78,6 +79,18 @@ NriStruct(Window) {
     Nri(MetalWindow) metal;
 };
 
+// Virtual swap chain (for frame pacing measurements on machines without a display):
+//  - "WAITABLE" and "ALLOW_LOW_LATENCY" are emulated on the host and don't require "features.waitableSwapChain" and "features.lowLatency"
+//  - "VSYNC" aligns displays to the "refreshPeriod" grid, otherwise a frame gets displayed "presentLatency" after "QueuePresent"
+//  - a displayed texture can be acquired again once the next frame gets displayed
+//  - "frameTime" enables a virtual clock (starts at 0), making all timestamps exact and reproducible: blocking calls advance it instead of sleeping
+NriStruct(VirtualSwapChainDesc) {
+    uint32_t refreshPeriod;                     // us, 0 - 16667 (60 Hz)
+    uint32_t presentLatency;                    // us, time between "QueuePresent" and the earliest display
+    uint32_t dropFrameInterval;                 // every N-th presentation gets dropped (never displayed), 0 - no drops
+    uint32_t frameTime;                         // us, virtual clock advance on each "QueuePresent" (i.e. simulated host frame time), 0 - the host clock is used
+};
+
 // SwapChain textures will be created as "color attachment" resources
 // queuedFrameNum = 0 - auto-selection between 1 (for waitable) or 2 (otherwise)
 // queuedFrameNum = 2 - recommended if the GPU frame time is less than the desired frame time, but the sum of 2 frames is greater
@@ -95,6 +108,9 @@ NriStruct(SwapChainDesc) {
     NriOptional Nri(Scaling) scaling;           // VK: if scaling is not supported, "OUT_OF_DATE" error is triggered on resizing
     NriOptional Nri(Gravity) gravityX;
     NriOptional Nri(Gravity) gravityY;
+
+    // Used only with "SwapChainBits::VIRTUAL"
+    NriOptional Nri(VirtualSwapChainDesc) virtualDesc;
 };
 
 NriStruct(ChromaticityCoords) {
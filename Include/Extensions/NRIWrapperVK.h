@@ -123,6 +123,9 @@ NriStruct(WrapperVKInterface) {
     Nri(Result) (NRI_CALL *CreateFenceVK)                   (NriRef(Device) device, const NriRef(FenceVKDesc) fenceVKDesc, NriOut NriRef(Fence*) fence);
     Nri(Result) (NRI_CALL *CreateAccelerationStructureVK)   (NriRef(Device) device, const NriRef(AccelerationStructureVKDesc) accelerationStructureVKDesc, NriOut NriRef(AccelerationStructure*) accelerationStructure);
 
+    // "vkCmdExecuteCommands" (secondary command buffers are recorded natively), the state set via NRI is undefined afterwards and must be set again (not filtered as redundant)
+    void        (NRI_CALL *CmdExecuteCommandsVK)            (NriRef(CommandBuffer) commandBuffer, const VKHandle* vkCommandBuffers, uint32_t vkCommandBufferNum);
+
     uint32_t    (NRI_CALL *GetQueueFamilyIndexVK)           (const NriRef(Queue) queue);
     VKHandle    (NRI_CALL *GetPhysicalDeviceVK)             (const NriRef(Device) device);
     VKHandle    (NRI_CALL *GetInstanceVK)                   (const NriRef(Device) device);
@@ -61,6 +61,28 @@ NRI_API void NRI_CALL nriEndAnnotation();                                   // e
 NRI_API void NRI_CALL nriAnnotation(const char* name, uint32_t bgra);       // emit a named simultaneous event
 NRI_API void NRI_CALL nriSetThreadName(const char* name);                   // assign a name to the current thread
 
+// CPU annotation timeline (requires "NRI_ENABLE_ANNOTATION_RECORDER", otherwise returns "UNSUPPORTED")
+// - host, command buffer and queue annotations are recorded with CPU timestamps into per-thread ring buffers
+// - saving drains the ring buffers into a Chrome trace (JSON), which can be opened in Perfetto or "chrome://tracing"
+// - unsaved records of finished threads are dropped on device destruction, save before destroying a device
+NRI_API Nri(Result) NRI_CALL nriSaveAnnotationTimeline(const char* path);
+
+// CPU allocation accounting (requires "NRI_ENABLE_ALLOCATION_ACCOUNTING", otherwise returns "UNSUPPORTED")
+// - covers allocations made via "AllocationCallbacks" by NRI objects, internal containers and scratch memory (process wide)
+// - each allocation is accounted twice: in its object type entry and in its call site entry
+// - "frameAllocationNum" counts allocations since the previous query, i.e. query once per frame
+NriStruct(AllocationStats) {
+    const char* name; // object type (i.e. "BufferVK", "Container", "Scratch") or call site (i.e. "PIPELINE", "COMMAND_BUFFER")
+    uint64_t liveBytes;
+    uint64_t peakBytes;
+    uint32_t liveAllocationNum;
+    uint32_t frameAllocationNum;
+    bool isCallSite;
+};
+
+NRI_API Nri(Result) NRI_CALL nriGetAllocationStats(NriPtr(AllocationStats) allocationStats, NonNriRef(uint32_t) allocationStatsNum); // "allocationStats = NULL" returns the number of entries
+NRI_API Nri(Result) NRI_CALL nriDumpAllocationStats(const NriRef(Device) device);                                                    // reports entries with live allocations as "Message::INFO"
+
 // Threadsafe: yes
 NriStruct(CoreInterface) {
     // Get
@@ -181,6 +203,14 @@ NriStruct(CoreInterface) {
         void                (NRI_CALL *CmdSetShadingRate)           (NriRef(CommandBuffer) commandBuffer, const NriRef(ShadingRateDesc) shadingRateDesc); // requires "tiers.shadingRate != 0"
         void                (NRI_CALL *CmdSetDepthBias)             (NriRef(CommandBuffer) commandBuffer, const NriRef(DepthBiasDesc) depthBiasDesc); // requires "features.dynamicDepthBias", actually it's an override
 
+        // Dynamic state (see "GraphicsPipelineDesc::dynamicStates")
+        void                (NRI_CALL *CmdSetTopology)              (NriRef(CommandBuffer) commandBuffer, Nri(Topology) topology, Nri(PrimitiveRestart) primitiveRestart);
+        void                (NRI_CALL *CmdSetCullMode)              (NriRef(CommandBuffer) commandBuffer, Nri(CullMode) cullMode);
+        void                (NRI_CALL *CmdSetFrontFace)             (NriRef(CommandBuffer) commandBuffer, bool frontCounterClockwise);
+        void                (NRI_CALL *CmdSetDepthState)            (NriRef(CommandBuffer) commandBuffer, const NriRef(DepthAttachmentDesc) depth);
+        void                (NRI_CALL *CmdSetStencilState)          (NriRef(CommandBuffer) commandBuffer, const NriRef(StencilAttachmentDesc) stencil);
+        void                (NRI_CALL *CmdSetColorState)            (NriRef(CommandBuffer) commandBuffer, uint32_t baseAttachment, const NriPtr(ColorAttachmentDesc) colors, uint32_t colorNum); // "format" is ignored
+
         // Graphics
         void                (NRI_CALL *CmdBeginRendering)           (NriRef(CommandBuffer) commandBuffer, const NriRef(RenderingDesc) renderingDesc);
         // {                {
@@ -191,6 +221,12 @@ NriStruct(CoreInterface) {
             void                (NRI_CALL *CmdDraw)                 (NriRef(CommandBuffer) commandBuffer, const NriRef(DrawDesc) drawDesc);
             void                (NRI_CALL *CmdDrawIndexed)          (NriRef(CommandBuffer) commandBuffer, const NriRef(DrawIndexedDesc) drawIndexedDesc);
 
+            // Draw multi: an array of direct draws ("stride" is the distance in bytes between descs, at least "sizeof(Draw(Indexed)Desc)")
+            // - VK: "VK_EXT_multi_draw" if supported, a loop of draws otherwise
+            // - the draw index seen by shaders is not guaranteed to match the position in the array
+            void                (NRI_CALL *CmdDrawMulti)            (NriRef(CommandBuffer) commandBuffer, const NriPtr(DrawDesc) drawDescs, uint32_t drawNum, uint32_t stride);
+            void                (NRI_CALL *CmdDrawIndexedMulti)     (NriRef(CommandBuffer) commandBuffer, const NriPtr(DrawIndexedDesc) drawIndexedDescs, uint32_t drawNum, uint32_t stride);
+
             // Draw indirect:
             // - drawNum = min(drawNum, countBuffer ? countBuffer[countBufferOffset] : INF)
             // - see "Modified draw command signatures"
@@ -275,6 +311,7 @@ NriStruct(CoreInterface) {
     // Debug name for any object declared as "NriForwardStruct" (skipped for buffers & textures in D3D if they are not bound to a memory)
     void                (NRI_CALL *SetDebugName)                    (NriPtr(Object) object, const char* name);
 
+    // VK: get the native command buffer right before recording native commands into it, since it resets filtering of redundant "CmdXxx" calls
     // Native objects                                                                                            ___D3D11 (latest interface)________|_D3D12 (latest interface)____|_VK_________________________________|_WGPU__________________________________
     void*               (NRI_CALL *GetDeviceNativeObject)           (const NriPtr(Device) device);               // ID3D11Device*                   | ID3D12Device*               | VkDevice                           | WGPUDevice
     void*               (NRI_CALL *GetQueueNativeObject)            (const NriPtr(Queue) queue);                 // -                               | ID3D12CommandQueue*         | VkQueue                            | WGPUQueue
@@ -1501,9 +1501,23 @@ NriEnum(Robustness, uint8_t,
     D3D12           // moderate overhead, D3D12-level robust access (requires "VK_EXT_robustness2", soft fallback to VK mode)
 );
 
+// States, which can be excluded from a pipeline and set by "CmdSetXxx" instead (see "DeviceDesc::other.dynamicStates"):
+// - undefined after "CmdSetPipeline", until set (the last set values persist across pipelines declaring the same dynamic states)
+// - the corresponding pipeline creation parameters are ignored (except "depthStencilFormat" and "format" of color attachments)
+NriBits(DynamicStateBits, uint8_t,
+    NONE                = 0,
+    TOPOLOGY            = NriBit(0), // "CmdSetTopology" (VK: topology class can't be changed without "dynamicPrimitiveTopologyUnrestricted")
+    CULL_MODE           = NriBit(1), // "CmdSetCullMode"
+    FRONT_FACE          = NriBit(2), // "CmdSetFrontFace"
+    DEPTH               = NriBit(3), // "CmdSetDepthState"
+    STENCIL             = NriBit(4), // "CmdSetStencilState"
+    COLOR               = NriBit(5)  // "CmdSetColorState" (blending and color write masks)
+);
+
 NriBits(GraphicsPipelineBits, uint8_t,
     NONE                = 0,
-    FAIL_ON_CACHE_MISS  = NriBit(0) // "CreateGraphicsPipeline" returns "FAILURE" if the pipeline is not found in the supplied cache (requires "features.pipelineCacheControl")
+    FAIL_ON_CACHE_MISS  = NriBit(0), // "CreateGraphicsPipeline" returns "FAILURE" if the pipeline is not found in the supplied cache (requires "features.pipelineCacheControl")
+    USE_LIBRARIES       = NriBit(1)  // the pipeline is fast-linked from cached pipeline libraries, an optimized pipeline gets linked in the background and swapped in when ready (the pipeline layout must outlive the pipeline, ignored if "features.graphicsPipelineLibrary" is unsupported)
 );
 
 NriBits(ComputePipelineBits, uint8_t,
@@ -1536,6 +1550,7 @@ NriStruct(GraphicsPipelineDesc) {
     Nri(GraphicsPipelineBits) flags;
     Nri(Robustness) robustness;
     NriOptional const NriPtr(PipelineCache) cache; // if non-NULL, pipeline creation can be served from a cached blob and the result will be added to the cache on a miss
+    NriOptional Nri(DynamicStateBits) dynamicStates; // must be a subset of "DeviceDesc::other.dynamicStates"
 };
 
 NriStruct(ComputePipelineDesc) {
@@ -2055,6 +2070,7 @@ NriStruct(DeviceDesc) {
         uint8_t combinedClipAndCullDistanceMaxNum;
         uint8_t viewMaxNum;                         // multiview is supported if > 1
         uint8_t shadingRateAttachmentTileSize;      // square size
+        Nri(DynamicStateBits) dynamicStates;        // states, which can be dynamic (WGPU and NONE: emulated with pipeline variants)
     } other;
 
     // Tiers (0 - unsupported)
@@ -2139,6 +2155,7 @@ NriStruct(DeviceDesc) {
         // Pipeline cache
         bool pipelineCache;                                       // "PipelineCache" support (NOP fallback if unsupported, except on error)
         bool pipelineCacheControl;                                // "FAIL_ON_CACHE_MISS" enforces "FAILURE", useful for platforms that prohibit runtime PSO compilation (e.g., Xbox GDK)
+        bool graphicsPipelineLibrary;                             // "USE_LIBRARIES" support: vertex input, pre-rasterization shaders, fragment shader and fragment output states are compiled and cached separately (VK: "VK_EXT_graphics_pipeline_library")
 
         // Other
         bool getMemoryDesc2;                                      // "GetXxxMemoryDesc2" support (VK: requires "maintenance4", D3D: supported)
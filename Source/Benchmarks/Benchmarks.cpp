@@ -0,0 +1,1310 @@
+// © 2026 NVIDIA Corporation
+
+// CPU microbenchmarks of hot NRI entry points:
+//   NRI_Benchmarks [--backend NONE|VALIDATION|VALIDATION_SAMPLED|VK|VK_VALIDATION|VK_DESCRIPTOR_BUFFER]... [--filter <substring>] [--min-time <ms>] [--json <output file>]
+// By default all backends are measured (NONE, VALIDATION on top of NONE, VK preferring a software adapter, i.e. lavapipe, VALIDATION on top of VK, VK with descriptor buffers), unavailable backends are skipped
+// Validation overhead (time and percentage over the backend underneath) is printed at the end
+// JSON output follows the layout used by Google Benchmark ("benchmarks" array with "name", "iterations", "real_time" and "time_unit") to be consumable by the same tools
+// Notes:
+// - only host time spent in the measured calls is reported, setup and GPU work happen with the timer paused
+// - "real_time" is per operation (a command, a descriptor, a submission...), see "ops" for the number of operations per iteration
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "NRI.h"
+
+#include "Extensions/NRIDeviceCreation.h"
+#include "Extensions/NRIHelper.h"
+#include "Extensions/NRIStreamer.h"
+
+#include "SharedExternal.h" // "CopyToUploadMemory"
+
+using namespace nri;
+
+enum class Backend : uint8_t {
+    NONE,
+    VALIDATION,         // on top of NONE, all categories
+    VALIDATION_SAMPLED, // on top of NONE, optional categories validated for every 16th command buffer recording
+    VK,
+    VK_VALIDATION,        // on top of VK
+    VK_DESCRIPTOR_BUFFER, // VK with "enableVKDescriptorBuffer", falls back to descriptor pools if "VK_EXT_descriptor_buffer" is not supported
+
+    MAX_NUM
+};
+
+static const char* g_backendNames[] = {
+    "NONE",
+    "VALIDATION",
+    "VALIDATION_SAMPLED",
+    "VK",
+    "VK_VALIDATION",
+    "VK_DESCRIPTOR_BUFFER",
+};
+
+static_assert(sizeof(g_backendNames) / sizeof(g_backendNames[0]) == (size_t)Backend::MAX_NUM, "Enum mismatch");
+
+// Validation overhead is reported relative to the backend underneath
+static const Backend g_baseBackends[] = {
+    Backend::MAX_NUM,
+    Backend::NONE,
+    Backend::NONE,
+    Backend::MAX_NUM,
+    Backend::VK,
+    Backend::MAX_NUM,
+};
+
+static_assert(sizeof(g_baseBackends) / sizeof(g_baseBackends[0]) == (size_t)Backend::MAX_NUM, "Enum mismatch");
+
+constexpr uint32_t VALIDATION_SAMPLING = 16;
+
+// Hand-assembled SPIR-V 1.0 of an empty compute shader ("main", local size 1x1x1), the same as in "Tests.h"
+constexpr uint32_t EMPTY_COMPUTE_SHADER_SPIRV[] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000005, 0x00000000, // header (bound = 5)
+    0x00020011, 0x00000001,                                     // OpCapability Shader
+    0x0003000E, 0x00000000, 0x00000001,                         // OpMemoryModel Logical GLSL450
+    0x0005000F, 0x00000005, 0x00000001, 0x6E69616D, 0x00000000, // OpEntryPoint GLCompute %1 "main"
+    0x00060010, 0x00000001, 0x00000011, 0x00000001, 0x00000001, 0x00000001, // OpExecutionMode %1 LocalSize 1 1 1
+    0x00020013, 0x00000002,                                     // %2 = OpTypeVoid
+    0x00030021, 0x00000003, 0x00000002,                         // %3 = OpTypeFunction %2
+    0x00050036, 0x00000002, 0x00000001, 0x00000000, 0x00000003, // %1 = OpFunction %2 None %3
+    0x000200F8, 0x00000004,                                     // %4 = OpLabel
+    0x000100FD,                                                 // OpReturn
+    0x00010038,                                                 // OpFunctionEnd
+};
+
+// Hand-assembled SPIR-V 1.0 of empty vertex and fragment shaders ("main"), the same as in "PipelineLibraryTests.cpp"
+constexpr uint32_t EMPTY_VERTEX_SHADER_SPIRV[] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000005, 0x00000000, // header (bound = 5)
+    0x00020011, 0x00000001,                                     // OpCapability Shader
+    0x0003000E, 0x00000000, 0x00000001,                         // OpMemoryModel Logical GLSL450
+    0x0005000F, 0x00000000, 0x00000001, 0x6E69616D, 0x00000000, // OpEntryPoint Vertex %1 "main"
+    0x00020013, 0x00000002,                                     // %2 = OpTypeVoid
+    0x00030021, 0x00000003, 0x00000002,                         // %3 = OpTypeFunction %2
+    0x00050036, 0x00000002, 0x00000001, 0x00000000, 0x00000003, // %1 = OpFunction %2 None %3
+    0x000200F8, 0x00000004,                                     // %4 = OpLabel
+    0x000100FD,                                                 // OpReturn
+    0x00010038,                                                 // OpFunctionEnd
+};
+
+constexpr uint32_t EMPTY_FRAGMENT_SHADER_SPIRV[] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000005, 0x00000000, // header (bound = 5)
+    0x00020011, 0x00000001,                                     // OpCapability Shader
+    0x0003000E, 0x00000000, 0x00000001,                         // OpMemoryModel Logical GLSL450
+    0x0005000F, 0x00000004, 0x00000001, 0x6E69616D, 0x00000000, // OpEntryPoint Fragment %1 "main"
+    0x00030010, 0x00000001, 0x00000007,                         // OpExecutionMode %1 OriginUpperLeft
+    0x00020013, 0x00000002,                                     // %2 = OpTypeVoid
+    0x00030021, 0x00000003, 0x00000002,                         // %3 = OpTypeFunction %2
+    0x00050036, 0x00000002, 0x00000001, 0x00000000, 0x00000003, // %1 = OpFunction %2 None %3
+    0x000200F8, 0x00000004,                                     // %4 = OpLabel
+    0x000100FD,                                                 // OpReturn
+    0x00010038,                                                 // OpFunctionEnd
+};
+
+struct BenchmarkResult {
+    std::string name;
+    Backend backend;
+    uint64_t iterations;
+    uint64_t ops;
+    double nsPerOp;
+};
+
+struct Benchmark {
+    Device* device = nullptr;
+    Queue* queue = nullptr;
+    CoreInterface core = {};
+    HelperInterface helper = {};
+    StreamerInterface streamer = {};
+    std::vector<BenchmarkResult> results;
+    const char* filter = nullptr;
+    Backend backend = Backend::NONE;
+    double minTimeNs = 200e6;
+    uint32_t errorNum = 0;
+
+    inline void PauseTiming() {
+        m_TotalNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - m_Begin).count();
+        m_PauseNum++;
+    }
+
+    inline void ResumeTiming() {
+        m_Begin = std::chrono::steady_clock::now();
+    }
+
+    inline bool IsEnabled(const char* name) const {
+        return !filter || strstr(name, filter);
+    }
+
+    // "body" is an iteration of "opsPerIteration" operations, it can pause timing for setup
+    template <typename F>
+    void Run(const char* name, uint64_t opsPerIteration, F&& body) {
+        if (!IsEnabled(name))
+            return;
+
+        // Warm up
+        ResumeTiming();
+        body();
+        PauseTiming();
+
+        m_TotalNs = 0.0;
+        m_PauseNum = 0;
+
+        uint64_t iterationNum = 0;
+        auto begin = std::chrono::steady_clock::now();
+        while (m_TotalNs < minTimeNs && std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count() < minTimeNs * 10.0) {
+            ResumeTiming();
+            body();
+            PauseTiming();
+
+            iterationNum++;
+        }
+
+        // The cost of reading the clock is excluded
+        double nsPerOp = std::max(m_TotalNs - m_TimerOverheadNs * double(m_PauseNum), 0.0) / double(iterationNum * opsPerIteration);
+        results.push_back({name, backend, iterationNum, opsPerIteration, nsPerOp});
+
+        printf("  %-48s %12" PRIu64 " %10.1f ns\n", name, iterationNum, nsPerOp);
+    }
+
+    void CalibrateTimer() {
+        constexpr uint32_t pairNum = 1000000;
+
+        m_TotalNs = 0.0;
+        for (uint32_t i = 0; i < pairNum; i++) {
+            ResumeTiming();
+            PauseTiming();
+        }
+
+        m_TimerOverheadNs = m_TotalNs / double(pairNum);
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_Begin;
+    double m_TotalNs = 0.0;
+    double m_TimerOverheadNs = 0.0;
+    uint64_t m_PauseNum = 0;
+};
+
+static void NRI_CALL MessageCallback(Message messageType, const char* file, uint32_t line, const char* message, void* userArg) {
+    if (messageType != Message::ERROR)
+        return;
+
+    Benchmark& benchmark = *(Benchmark*)userArg;
+    benchmark.errorNum++;
+
+    printf("ERROR: %s (%s:%u)\n", message, file, line);
+}
+
+//============================================================================================================================================================================================
+#pragma region[  Benchmarks  ]
+//============================================================================================================================================================================================
+
+static void CmdRecording(Benchmark& benchmark) {
+    constexpr uint32_t commandNum = 1024;
+
+    CommandAllocator* commandAllocator = nullptr;
+    CommandBuffer* commandBuffer = nullptr;
+    benchmark.core.CreateCommandAllocator(*benchmark.queue, commandAllocator);
+    benchmark.core.CreateCommandBuffer(*commandAllocator, commandBuffer);
+
+    BufferDesc bufferDesc = {};
+    bufferDesc.size = 64 * 1024;
+
+    Buffer* buffers[2] = {};
+    benchmark.core.CreateCommittedBuffer(*benchmark.device, MemoryLocation::DEVICE, 0.0f, bufferDesc, buffers[0]);
+    benchmark.core.CreateCommittedBuffer(*benchmark.device, MemoryLocation::DEVICE, 0.0f, bufferDesc, buffers[1]);
+
+    const Viewport viewport = {0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f, false};
+    const Rect scissor = {0, 0, 1920, 1080};
+    const Color32f blendConstants = {1.0f, 1.0f, 1.0f, 1.0f};
+
+    BufferBarrierDesc bufferBarrier = {};
+    bufferBarrier.buffer = buffers[0];
+    bufferBarrier.before = {AccessBits::COPY_DESTINATION, StageBits::COPY};
+    bufferBarrier.after = {AccessBits::COPY_DESTINATION, StageBits::COPY};
+
+    BarrierDesc barrierDesc = {};
+    barrierDesc.buffers = &bufferBarrier;
+    barrierDesc.bufferNum = 1;
+
+    auto record = [&](uint32_t variant) {
+        benchmark.PauseTiming();
+        benchmark.core.ResetCommandAllocator(*commandAllocator);
+        benchmark.ResumeTiming();
+
+        benchmark.core.BeginCommandBuffer(*commandBuffer, nullptr);
+
+        for (uint32_t i = 0; i < commandNum; i++) {
+            switch (variant) {
+                case 0:
+                    benchmark.core.CmdSetViewports(*commandBuffer, &viewport, 1);
+                    break;
+                case 1:
+                    benchmark.core.CmdSetScissors(*commandBuffer, &scissor, 1);
+                    break;
+                case 2:
+                    benchmark.core.CmdSetBlendConstants(*commandBuffer, blendConstants);
+                    break;
+                case 3:
+                    benchmark.core.CmdCopyBuffer(*commandBuffer, *buffers[0], (i % 16) * 256, *buffers[1], 0, 256);
+                    break;
+                default:
+                    benchmark.core.CmdBarrier(*commandBuffer, barrierDesc);
+                    break;
+            }
+        }
+
+        benchmark.core.EndCommandBuffer(*commandBuffer);
+    };
+
+    benchmark.Run("CmdRecording/CmdSetViewports/1024", commandNum, [&]() { record(0); });
+    benchmark.Run("CmdRecording/CmdSetScissors/1024", commandNum, [&]() { record(1); });
+    benchmark.Run("CmdRecording/CmdSetBlendConstants/1024", commandNum, [&]() { record(2); });
+    benchmark.Run("CmdRecording/CmdCopyBuffer/1024", commandNum, [&]() { record(3); });
+    benchmark.Run("CmdRecording/CmdBarrier/1024", commandNum, [&]() { record(4); });
+
+    benchmark.core.DestroyBuffer(buffers[0]);
+    benchmark.core.DestroyBuffer(buffers[1]);
+    benchmark.core.DestroyCommandBuffer(commandBuffer);
+    benchmark.core.DestroyCommandAllocator(commandAllocator);
+}
+
+static void DescriptorSets(Benchmark& benchmark) {
+    constexpr uint32_t rangeSize = 256;
+    constexpr uint32_t setNum = 64;
+
+    DescriptorRangeDesc descriptorRange = {};
+    descriptorRange.descriptorNum = rangeSize;
+    descriptorRange.descriptorType = DescriptorType::SAMPLER;
+    descriptorRange.shaderStages = StageBits::ALL;
+
+    DescriptorSetDesc descriptorSetDesc = {};
+    descriptorSetDesc.ranges = &descriptorRange;
+    descriptorSetDesc.rangeNum = 1;
+
+    PipelineLayoutDesc pipelineLayoutDesc = {};
+    pipelineLayoutDesc.descriptorSets = &descriptorSetDesc;
+    pipelineLayoutDesc.descriptorSetNum = 1;
+    pipelineLayoutDesc.shaderStages = StageBits::ALL;
+
+    PipelineLayout* pipelineLayout = nullptr;
+    benchmark.core.CreatePipelineLayout(*benchmark.device, pipelineLayoutDesc, pipelineLayout);
+
+    DescriptorPoolDesc descriptorPoolDesc = {};
+    descriptorPoolDesc.descriptorSetMaxNum = setNum;
+    descriptorPoolDesc.samplerMaxNum = setNum * rangeSize;
+
+    DescriptorPool* descriptorPool = nullptr;
+    benchmark.core.CreateDescriptorPool(*benchmark.device, descriptorPoolDesc, descriptorPool);
+
+    SamplerDesc samplerDesc = {};
+    samplerDesc.filters = {Filter::LINEAR, Filter::LINEAR, Filter::LINEAR};
+    samplerDesc.mipMax = 16.0f;
+
+    std::vector<Descriptor*> samplers(rangeSize);
+    for (Descriptor*& sampler : samplers)
+        benchmark.core.CreateSampler(*benchmark.device, samplerDesc, sampler);
+
+    // AllocateDescriptorSets
+    std::vector<DescriptorSet*> descriptorSets(setNum);
+    for (uint32_t instanceNum : {1u, 16u}) {
+        char name[64];
+        snprintf(name, sizeof(name), "AllocateDescriptorSets/%u", instanceNum);
+
+        benchmark.Run(name, setNum, [&]() {
+            for (uint32_t i = 0; i < setNum; i += instanceNum)
+                benchmark.core.AllocateDescriptorSets(*descriptorPool, *pipelineLayout, 0, descriptorSets.data() + i, instanceNum, 0);
+
+            benchmark.PauseTiming();
+            benchmark.core.ResetDescriptorPool(*descriptorPool);
+            benchmark.ResumeTiming();
+        });
+    }
+
+    // UpdateDescriptorRanges
+    benchmark.core.ResetDescriptorPool(*descriptorPool);
+    benchmark.core.AllocateDescriptorSets(*descriptorPool, *pipelineLayout, 0, descriptorSets.data(), setNum, 0);
+
+    for (uint32_t batchSize : {1u, 16u, 256u}) {
+        char name[64];
+        snprintf(name, sizeof(name), "UpdateDescriptorRanges/%u", batchSize);
+
+        benchmark.Run(name, setNum * batchSize, [&]() {
+            for (DescriptorSet* descriptorSet : descriptorSets) {
+                UpdateDescriptorRangeDesc updateDescriptorRangeDesc = {};
+                updateDescriptorRangeDesc.descriptorSet = descriptorSet;
+                updateDescriptorRangeDesc.descriptors = samplers.data();
+                updateDescriptorRangeDesc.descriptorNum = batchSize;
+
+                benchmark.core.UpdateDescriptorRanges(&updateDescriptorRangeDesc, 1);
+            }
+        });
+    }
+
+    // CmdSetDescriptorSet (different sets in a row, i.e. nothing is redundant)
+    constexpr uint32_t bindNum = 1024;
+
+    CommandAllocator* commandAllocator = nullptr;
+    CommandBuffer* commandBuffer = nullptr;
+    benchmark.core.CreateCommandAllocator(*benchmark.queue, commandAllocator);
+    benchmark.core.CreateCommandBuffer(*commandAllocator, commandBuffer);
+
+    benchmark.Run("CmdSetDescriptorSet/1024", bindNum, [&]() {
+        benchmark.PauseTiming();
+        benchmark.core.ResetCommandAllocator(*commandAllocator);
+        benchmark.core.BeginCommandBuffer(*commandBuffer, nullptr);
+        benchmark.core.CmdSetDescriptorPool(*commandBuffer, *descriptorPool);
+        benchmark.core.CmdSetPipelineLayout(*commandBuffer, BindPoint::GRAPHICS, *pipelineLayout);
+        benchmark.ResumeTiming();
+
+        for (uint32_t i = 0; i < bindNum; i++) {
+            SetDescriptorSetDesc setDescriptorSetDesc = {};
+            setDescriptorSetDesc.descriptorSet = descriptorSets[i % setNum];
+            setDescriptorSetDesc.bindPoint = BindPoint::GRAPHICS;
+
+            benchmark.core.CmdSetDescriptorSet(*commandBuffer, setDescriptorSetDesc);
+        }
+
+        benchmark.PauseTiming();
+        benchmark.core.EndCommandBuffer(*commandBuffer);
+        benchmark.ResumeTiming();
+    });
+
+    benchmark.core.DestroyCommandBuffer(commandBuffer);
+    benchmark.core.DestroyCommandAllocator(commandAllocator);
+
+    for (Descriptor* sampler : samplers)
+        benchmark.core.DestroyDescriptor(sampler);
+
+    benchmark.core.DestroyDescriptorPool(descriptorPool);
+    benchmark.core.DestroyPipelineLayout(pipelineLayout);
+}
+
+// Large descriptor updates in a single call, i.e. the layers underneath need big scratch arrays (per-thread arenas, not the allocator)
+static void DescriptorWrites(Benchmark& benchmark) {
+    constexpr uint32_t rangeSize = 1000;
+    constexpr uint32_t setNum = 100;
+
+    DescriptorRangeDesc descriptorRange = {};
+    descriptorRange.descriptorNum = rangeSize;
+    descriptorRange.descriptorType = DescriptorType::SAMPLER;
+    descriptorRange.shaderStages = StageBits::ALL;
+
+    DescriptorSetDesc descriptorSetDesc = {};
+    descriptorSetDesc.ranges = &descriptorRange;
+    descriptorSetDesc.rangeNum = 1;
+
+    PipelineLayoutDesc pipelineLayoutDesc = {};
+    pipelineLayoutDesc.descriptorSets = &descriptorSetDesc;
+    pipelineLayoutDesc.descriptorSetNum = 1;
+    pipelineLayoutDesc.shaderStages = StageBits::ALL;
+
+    PipelineLayout* pipelineLayout = nullptr;
+    if (benchmark.core.CreatePipelineLayout(*benchmark.device, pipelineLayoutDesc, pipelineLayout) != Result::SUCCESS)
+        return;
+
+    DescriptorPoolDesc descriptorPoolDesc = {};
+    descriptorPoolDesc.descriptorSetMaxNum = setNum;
+    descriptorPoolDesc.samplerMaxNum = setNum * rangeSize;
+
+    DescriptorPool* descriptorPool = nullptr;
+    benchmark.core.CreateDescriptorPool(*benchmark.device, descriptorPoolDesc, descriptorPool);
+
+    SamplerDesc samplerDesc = {};
+    samplerDesc.filters = {Filter::LINEAR, Filter::LINEAR, Filter::LINEAR};
+    samplerDesc.mipMax = 16.0f;
+
+    Descriptor* sampler = nullptr;
+    benchmark.core.CreateSampler(*benchmark.device, samplerDesc, sampler);
+
+    std::vector<DescriptorSet*> descriptorSets(setNum);
+    if (descriptorPool && sampler && benchmark.core.AllocateDescriptorSets(*descriptorPool, *pipelineLayout, 0, descriptorSets.data(), setNum, 0) == Result::SUCCESS) {
+        std::vector<Descriptor*> samplers(rangeSize, sampler);
+
+        std::vector<UpdateDescriptorRangeDesc> updateDescriptorRangeDescs(setNum);
+        for (uint32_t i = 0; i < setNum; i++) {
+            updateDescriptorRangeDescs[i] = {};
+            updateDescriptorRangeDescs[i].descriptorSet = descriptorSets[i];
+            updateDescriptorRangeDescs[i].descriptors = samplers.data();
+            updateDescriptorRangeDescs[i].descriptorNum = rangeSize;
+        }
+
+        for (uint32_t writeNum : {1000u, 10000u, 100000u}) {
+            char name[64];
+            snprintf(name, sizeof(name), "UpdateDescriptorRanges/Writes/%u", writeNum);
+
+            benchmark.Run(name, writeNum, [&]() {
+                benchmark.core.UpdateDescriptorRanges(updateDescriptorRangeDescs.data(), writeNum / rangeSize);
+            });
+        }
+    }
+
+    if (sampler)
+        benchmark.core.DestroyDescriptor(sampler);
+
+    if (descriptorPool)
+        benchmark.core.DestroyDescriptorPool(descriptorPool);
+
+    benchmark.core.DestroyPipelineLayout(pipelineLayout);
+}
+
+static void QueueSubmit(Benchmark& benchmark) {
+    constexpr uint32_t maxCommandBufferNum = 256;
+
+    CommandAllocator* commandAllocator = nullptr;
+    benchmark.core.CreateCommandAllocator(*benchmark.queue, commandAllocator);
+
+    std::vector<CommandBuffer*> commandBuffers(maxCommandBufferNum);
+    for (CommandBuffer*& commandBuffer : commandBuffers)
+        benchmark.core.CreateCommandBuffer(*commandAllocator, commandBuffer);
+
+    Fence* fence = nullptr;
+    benchmark.core.CreateFence(*benchmark.device, 0, fence);
+
+    uint64_t fenceValue = 0;
+    for (uint32_t commandBufferNum : {1u, 16u, 256u}) {
+        char name[64];
+        snprintf(name, sizeof(name), "QueueSubmit/%u", commandBufferNum);
+
+        benchmark.Run(name, 1, [&]() {
+            // Command buffers are "one time submit"
+            benchmark.PauseTiming();
+            {
+                benchmark.core.Wait(*fence, fenceValue);
+                benchmark.core.ResetCommandAllocator(*commandAllocator);
+
+                for (uint32_t i = 0; i < commandBufferNum; i++) {
+                    benchmark.core.BeginCommandBuffer(*commandBuffers[i], nullptr);
+                    benchmark.core.EndCommandBuffer(*commandBuffers[i]);
+                }
+            }
+            benchmark.ResumeTiming();
+
+            FenceSubmitDesc signalFence = {};
+            signalFence.fence = fence;
+            signalFence.value = ++fenceValue;
+
+            QueueSubmitDesc queueSubmitDesc = {};
+            queueSubmitDesc.commandBuffers = commandBuffers.data();
+            queueSubmitDesc.commandBufferNum = commandBufferNum;
+            queueSubmitDesc.signalFences = &signalFence;
+            queueSubmitDesc.signalFenceNum = 1;
+
+            benchmark.core.QueueSubmit(*benchmark.queue, queueSubmitDesc);
+        });
+    }
+
+    benchmark.core.Wait(*fence, fenceValue);
+
+    for (CommandBuffer* commandBuffer : commandBuffers)
+        benchmark.core.DestroyCommandBuffer(commandBuffer);
+
+    benchmark.core.DestroyCommandAllocator(commandAllocator);
+    benchmark.core.DestroyFence(fence);
+}
+
+static void StreamData(Benchmark& benchmark) {
+    if (!benchmark.streamer.CreateStreamer)
+        return;
+
+    StreamerDesc streamerDesc = {};
+    streamerDesc.constantBufferMemoryLocation = MemoryLocation::HOST_UPLOAD;
+    streamerDesc.dynamicBufferMemoryLocation = MemoryLocation::HOST_UPLOAD;
+    streamerDesc.dynamicBufferDesc.usage = BufferUsageBits::SHADER_RESOURCE;
+    streamerDesc.queuedFrameNum = 2;
+
+    Streamer* streamer = nullptr;
+    if (benchmark.streamer.CreateStreamer(*benchmark.device, streamerDesc, streamer) != Result::SUCCESS)
+        return;
+
+    CommandAllocator* commandAllocator = nullptr;
+    CommandBuffer* commandBuffer = nullptr;
+    benchmark.core.CreateCommandAllocator(*benchmark.queue, commandAllocator);
+    benchmark.core.CreateCommandBuffer(*commandAllocator, commandBuffer);
+
+    BufferDesc bufferDesc = {};
+    bufferDesc.size = 64 * 1024;
+    bufferDesc.usage = BufferUsageBits::SHADER_RESOURCE;
+
+    Buffer* buffer = nullptr;
+    benchmark.core.CreateCommittedBuffer(*benchmark.device, MemoryLocation::DEVICE, 0.0f, bufferDesc, buffer);
+
+    TextureDesc textureDesc = {};
+    textureDesc.type = TextureType::TEXTURE_2D;
+    textureDesc.usage = TextureUsageBits::SHADER_RESOURCE;
+    textureDesc.format = Format::RGBA8_UNORM;
+    textureDesc.width = 256;
+    textureDesc.height = 256;
+
+    Texture* texture = nullptr;
+    benchmark.core.CreateCommittedTexture(*benchmark.device, MemoryLocation::DEVICE, 0.0f, textureDesc, texture);
+
+    // Streamed data is copied into the destinations and the frame is ended every "streamsPerFrame" streams (timing is paused)
+    constexpr uint32_t streamsPerFrame = 64;
+
+    auto endFrame = [&]() {
+        benchmark.PauseTiming();
+        {
+            benchmark.core.ResetCommandAllocator(*commandAllocator);
+            benchmark.core.BeginCommandBuffer(*commandBuffer, nullptr);
+            benchmark.streamer.CmdCopyStreamedData(*commandBuffer, *streamer);
+            benchmark.core.EndCommandBuffer(*commandBuffer);
+
+            benchmark.streamer.EndStreamerFrame(*streamer);
+        }
+        benchmark.ResumeTiming();
+    };
+
+    std::vector<uint8_t> data(256 * 256 * 4, 0xAB);
+    for (uint32_t size : {256u, 64u * 1024u}) {
+        char name[64];
+        snprintf(name, sizeof(name), "StreamBufferData/%u", size);
+
+        benchmark.Run(name, streamsPerFrame, [&]() {
+            for (uint32_t i = 0; i < streamsPerFrame; i++) {
+                DataSize dataChunk = {data.data(), size};
+
+                StreamBufferDataDesc streamBufferDataDesc = {};
+                streamBufferDataDesc.dataChunks = &dataChunk;
+                streamBufferDataDesc.dataChunkNum = 1;
+                streamBufferDataDesc.placementAlignment = 256;
+                streamBufferDataDesc.dstBuffer = buffer;
+
+                benchmark.streamer.StreamBufferData(*streamer, streamBufferDataDesc);
+            }
+
+            endFrame();
+        });
+    }
+
+    for (Dim_t dim : {16, 256}) {
+        char name[64];
+        snprintf(name, sizeof(name), "StreamTextureData/%ux%u", dim, dim);
+
+        benchmark.Run(name, streamsPerFrame, [&]() {
+            for (uint32_t i = 0; i < streamsPerFrame; i++) {
+                StreamTextureDataDesc streamTextureDataDesc = {};
+                streamTextureDataDesc.data = data.data();
+                streamTextureDataDesc.dataRowPitch = dim * 4;
+                streamTextureDataDesc.dataSlicePitch = dim * dim * 4;
+                streamTextureDataDesc.dstTexture = texture;
+                streamTextureDataDesc.dstRegion.width = dim;
+                streamTextureDataDesc.dstRegion.height = dim;
+                streamTextureDataDesc.dstRegion.depth = 1;
+
+                benchmark.streamer.StreamTextureData(*streamer, streamTextureDataDesc);
+            }
+
+            endFrame();
+        });
+    }
+
+    benchmark.core.DestroyCommandBuffer(commandBuffer);
+    benchmark.core.DestroyCommandAllocator(commandAllocator);
+    benchmark.core.DestroyTexture(texture);
+    benchmark.core.DestroyBuffer(buffer);
+    benchmark.streamer.DestroyStreamer(streamer);
+}
+
+// "CopyToUploadMemory" kernel next to "memcpy" ("real_time" is per copy):
+// - plain: cached host memory (NONE)
+// - upload: a mapped "HOST_UPLOAD" buffer, i.e. write-combined memory (VK)
+static void UploadMemory(Benchmark& benchmark) {
+    bool isUpload = benchmark.backend == Backend::VK;
+    if (!isUpload && benchmark.backend != Backend::NONE)
+        return;
+
+    constexpr uint32_t maxSize = 4 * 1024 * 1024;
+
+    std::vector<uint8_t> src(maxSize + 16, 0xAB);
+    std::vector<uint8_t> plain;
+    Buffer* buffer = nullptr;
+    uint8_t* dst = nullptr;
+
+    if (isUpload) {
+        BufferDesc bufferDesc = {};
+        bufferDesc.size = maxSize + 16;
+
+        if (benchmark.core.CreateCommittedBuffer(*benchmark.device, MemoryLocation::HOST_UPLOAD, 0.0f, bufferDesc, buffer) != Result::SUCCESS)
+            return;
+
+        dst = (uint8_t*)benchmark.core.MapBuffer(*buffer, 0, WHOLE_SIZE);
+    } else {
+        plain.resize(maxSize + 16);
+        dst = plain.data();
+    }
+
+    // 4 MB exceeds most L2 caches, a misaligned destination exercises the alignment prologue
+    const char* memoryName = isUpload ? "Upload" : "Plain";
+    for (uint32_t size : {4u * 1024u, 64u * 1024u, maxSize}) {
+        for (uint32_t dstOffset : {0u, 5u}) {
+            char name[64];
+            snprintf(name, sizeof(name), "UploadMemory/%s/CopyToUploadMemory/%u+%u", memoryName, size, dstOffset);
+
+            benchmark.Run(name, 1, [&]() {
+                CopyToUploadMemory(dst + dstOffset, src.data(), size);
+                FlushUploadMemoryWrites();
+            });
+
+            snprintf(name, sizeof(name), "UploadMemory/%s/memcpy/%u+%u", memoryName, size, dstOffset);
+
+            benchmark.Run(name, 1, [&]() {
+                memcpy(dst + dstOffset, src.data(), size);
+            });
+        }
+    }
+
+    if (buffer) {
+        benchmark.core.UnmapBuffer(*buffer);
+        benchmark.core.DestroyBuffer(buffer);
+    }
+}
+
+// "UploadData" copies into write-combined staging memory: tightly packed sources take a single copy per subresource, padded rows are copied one by one
+// Plain NONE doesn't upload anything, validation on top of it runs the real uploader with host-backed staging buffers
+static void UploadData(Benchmark& benchmark) {
+    if (benchmark.backend == Backend::NONE)
+        return;
+
+    constexpr Dim_t dim = 256;
+    constexpr uint32_t texelSize = 4;
+
+    BufferDesc bufferDesc = {};
+    bufferDesc.size = 256 * 1024;
+    bufferDesc.usage = BufferUsageBits::SHADER_RESOURCE;
+
+    Buffer* buffer = nullptr;
+    benchmark.core.CreateCommittedBuffer(*benchmark.device, MemoryLocation::DEVICE, 0.0f, bufferDesc, buffer);
+
+    TextureDesc textureDesc = {};
+    textureDesc.type = TextureType::TEXTURE_2D;
+    textureDesc.usage = TextureUsageBits::SHADER_RESOURCE;
+    textureDesc.format = Format::RGBA8_UNORM;
+    textureDesc.width = dim;
+    textureDesc.height = dim;
+
+    Texture* texture = nullptr;
+    benchmark.core.CreateCommittedTexture(*benchmark.device, MemoryLocation::DEVICE, 0.0f, textureDesc, texture);
+
+    if (!buffer || !texture) {
+        benchmark.core.DestroyTexture(texture);
+        benchmark.core.DestroyBuffer(buffer);
+        return;
+    }
+
+    std::vector<uint8_t> data((size_t)bufferDesc.size, 0xAB);
+
+    BufferUploadDesc bufferUploadDesc = {};
+    bufferUploadDesc.data = data.data();
+    bufferUploadDesc.buffer = buffer;
+    bufferUploadDesc.after = {AccessBits::SHADER_RESOURCE};
+
+    benchmark.Run("UploadData/Buffer/256KB", 1, [&]() {
+        benchmark.helper.UploadData(*benchmark.queue, nullptr, 0, &bufferUploadDesc, 1);
+    });
+
+    for (uint32_t rowPadding : {0u, 64u}) {
+        uint32_t rowPitch = dim * texelSize + rowPadding;
+
+        TextureSubresourceUploadDesc subresource = {};
+        subresource.slices = data.data();
+        subresource.sliceNum = 1;
+        subresource.rowPitch = rowPitch;
+        subresource.slicePitch = rowPitch * dim;
+
+        TextureUploadDesc textureUploadDesc = {};
+        textureUploadDesc.subresources = &subresource;
+        textureUploadDesc.texture = texture;
+        textureUploadDesc.after = {AccessBits::SHADER_RESOURCE, Layout::SHADER_RESOURCE};
+
+        char name[64];
+        snprintf(name, sizeof(name), "UploadData/Texture/%ux%u/%s", dim, dim, rowPadding ? "PaddedRows" : "Packed");
+
+        benchmark.Run(name, 1, [&]() {
+            benchmark.helper.UploadData(*benchmark.queue, &textureUploadDesc, 1, nullptr, 0);
+        });
+    }
+
+    benchmark.core.DestroyTexture(texture);
+    benchmark.core.DestroyBuffer(buffer);
+}
+
+// A typical material-sorted stream: every draw sets the full state (as many engines do), only the material changes between batches
+// Dispatches stand in for draws, because no graphics shaders are available without a shader toolchain. Elided calls are printed if reported (VK)
+static void RedundantState(Benchmark& benchmark) {
+    constexpr uint32_t materialNum = 16;
+    constexpr uint32_t drawsPerMaterial = 64;
+    constexpr uint32_t drawNum = materialNum * drawsPerMaterial;
+
+    DescriptorRangeDesc descriptorRange = {};
+    descriptorRange.descriptorNum = 1;
+    descriptorRange.descriptorType = DescriptorType::SAMPLER;
+    descriptorRange.shaderStages = StageBits::COMPUTE_SHADER;
+
+    DescriptorSetDesc descriptorSetDesc = {};
+    descriptorSetDesc.ranges = &descriptorRange;
+    descriptorSetDesc.rangeNum = 1;
+
+    PipelineLayoutDesc pipelineLayoutDesc = {};
+    pipelineLayoutDesc.descriptorSets = &descriptorSetDesc;
+    pipelineLayoutDesc.descriptorSetNum = 1;
+    pipelineLayoutDesc.shaderStages = StageBits::COMPUTE_SHADER;
+
+    PipelineLayout* pipelineLayout = nullptr;
+    benchmark.core.CreatePipelineLayout(*benchmark.device, pipelineLayoutDesc, pipelineLayout);
+
+    DescriptorPoolDesc descriptorPoolDesc = {};
+    descriptorPoolDesc.descriptorSetMaxNum = materialNum;
+    descriptorPoolDesc.samplerMaxNum = materialNum;
+
+    DescriptorPool* descriptorPool = nullptr;
+    benchmark.core.CreateDescriptorPool(*benchmark.device, descriptorPoolDesc, descriptorPool);
+
+    // Materials
+    ComputePipelineDesc computePipelineDesc = {};
+    computePipelineDesc.pipelineLayout = pipelineLayout;
+    computePipelineDesc.shader = {StageBits::COMPUTE_SHADER, EMPTY_COMPUTE_SHADER_SPIRV, sizeof(EMPTY_COMPUTE_SHADER_SPIRV)};
+
+    Pipeline* pipelines[materialNum] = {};
+    for (Pipeline*& pipeline : pipelines)
+        benchmark.core.CreateComputePipeline(*benchmark.device, computePipelineDesc, pipeline);
+
+    DescriptorSet* descriptorSets[materialNum] = {};
+    benchmark.core.AllocateDescriptorSets(*descriptorPool, *pipelineLayout, 0, descriptorSets, materialNum, 0);
+
+    // Geometry, shared by all draws
+    BufferDesc bufferDesc = {};
+    bufferDesc.size = 64 * 1024;
+    bufferDesc.usage = BufferUsageBits::VERTEX | BufferUsageBits::INDEX;
+
+    Buffer* buffer = nullptr;
+    benchmark.core.CreateCommittedBuffer(*benchmark.device, MemoryLocation::DEVICE, 0.0f, bufferDesc, buffer);
+
+    CommandAllocator* commandAllocator = nullptr;
+    CommandBuffer* commandBuffer = nullptr;
+    benchmark.core.CreateCommandAllocator(*benchmark.queue, commandAllocator);
+    benchmark.core.CreateCommandBuffer(*commandAllocator, commandBuffer);
+
+    const Viewport viewport = {0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f, false};
+    const Rect scissor = {0, 0, 1920, 1080};
+    const VertexBufferDesc vertexBufferDesc = {buffer, 0, 32};
+    const DispatchDesc dispatchDesc = {1, 1, 1};
+
+    auto record = [&](bool isSorted) {
+        benchmark.PauseTiming();
+        benchmark.core.ResetCommandAllocator(*commandAllocator);
+        benchmark.ResumeTiming();
+
+        benchmark.core.BeginCommandBuffer(*commandBuffer, nullptr);
+
+        for (uint32_t i = 0; i < drawNum; i++) {
+            uint32_t material = isSorted ? i / drawsPerMaterial : i % materialNum;
+
+            SetDescriptorSetDesc setDescriptorSetDesc = {};
+            setDescriptorSetDesc.descriptorSet = descriptorSets[material];
+            setDescriptorSetDesc.bindPoint = BindPoint::COMPUTE;
+
+            benchmark.core.CmdSetPipelineLayout(*commandBuffer, BindPoint::COMPUTE, *pipelineLayout);
+            benchmark.core.CmdSetPipeline(*commandBuffer, *pipelines[material]);
+            benchmark.core.CmdSetDescriptorSet(*commandBuffer, setDescriptorSetDesc);
+            benchmark.core.CmdSetVertexBuffers(*commandBuffer, 0, &vertexBufferDesc, 1);
+            benchmark.core.CmdSetIndexBuffer(*commandBuffer, *buffer, 0, IndexType::UINT16);
+            benchmark.core.CmdSetViewports(*commandBuffer, &viewport, 1);
+            benchmark.core.CmdSetScissors(*commandBuffer, &scissor, 1);
+            benchmark.core.CmdDispatch(*commandBuffer, dispatchDesc);
+        }
+
+        benchmark.core.EndCommandBuffer(*commandBuffer);
+    };
+
+    for (bool isSorted : {true, false}) {
+        const char* name = isSorted ? "RedundantState/MaterialSorted/16x64" : "RedundantState/Unsorted/16x64";
+        if (!benchmark.IsEnabled(name))
+            continue;
+
+        RedundantCommandStats before = {};
+        benchmark.helper.GetRedundantCommandStats(*benchmark.device, before);
+
+        benchmark.Run(name, drawNum, [&]() { record(isSorted); });
+
+        RedundantCommandStats after = {};
+        benchmark.helper.GetRedundantCommandStats(*benchmark.device, after);
+
+        // Including the warm up iteration
+        uint64_t elidedNum = (after.pipelineNum - before.pipelineNum) + (after.pipelineLayoutNum - before.pipelineLayoutNum) + (after.descriptorSetNum - before.descriptorSetNum)
+            + (after.vertexBufferNum - before.vertexBufferNum) + (after.indexBufferNum - before.indexBufferNum) + (after.viewportNum - before.viewportNum) + (after.scissorNum - before.scissorNum);
+        uint64_t drawTotalNum = (benchmark.results.back().iterations + 1) * drawNum;
+
+        if (elidedNum)
+            printf("  %-48s %12s %10.2f elided calls per draw\n", "", "", double(elidedNum) / double(drawTotalNum));
+    }
+
+    benchmark.core.DestroyCommandBuffer(commandBuffer);
+    benchmark.core.DestroyCommandAllocator(commandAllocator);
+    benchmark.core.DestroyBuffer(buffer);
+
+    for (Pipeline* pipeline : pipelines)
+        benchmark.core.DestroyPipeline(pipeline);
+
+    benchmark.core.DestroyDescriptorPool(descriptorPool);
+    benchmark.core.DestroyPipelineLayout(pipelineLayout);
+}
+
+// CPU cost per draw: a loop of "CmdDraw(Indexed)" vs. a single "CmdDraw(Indexed)Multi", only the draws are timed
+static void Draws(Benchmark& benchmark) {
+    constexpr uint32_t drawNum = 1024;
+
+    PipelineLayoutDesc pipelineLayoutDesc = {};
+    pipelineLayoutDesc.shaderStages = StageBits::VERTEX_SHADER | StageBits::FRAGMENT_SHADER;
+
+    PipelineLayout* pipelineLayout = nullptr;
+    benchmark.core.CreatePipelineLayout(*benchmark.device, pipelineLayoutDesc, pipelineLayout);
+
+    const ShaderDesc shaders[] = {
+        {StageBits::VERTEX_SHADER, EMPTY_VERTEX_SHADER_SPIRV, sizeof(EMPTY_VERTEX_SHADER_SPIRV)},
+        {StageBits::FRAGMENT_SHADER, EMPTY_FRAGMENT_SHADER_SPIRV, sizeof(EMPTY_FRAGMENT_SHADER_SPIRV)},
+    };
+
+    ColorAttachmentDesc colorAttachmentDesc = {};
+    colorAttachmentDesc.format = Format::RGBA8_UNORM;
+    colorAttachmentDesc.colorWriteMask = ColorWriteBits::RGBA;
+
+    GraphicsPipelineDesc graphicsPipelineDesc = {};
+    graphicsPipelineDesc.pipelineLayout = pipelineLayout;
+    graphicsPipelineDesc.inputAssembly.topology = Topology::TRIANGLE_LIST;
+    graphicsPipelineDesc.rasterization.fillMode = FillMode::SOLID;
+    graphicsPipelineDesc.rasterization.cullMode = CullMode::NONE;
+    graphicsPipelineDesc.outputMerger.colors = &colorAttachmentDesc;
+    graphicsPipelineDesc.outputMerger.colorNum = 1;
+    graphicsPipelineDesc.shaders = shaders;
+    graphicsPipelineDesc.shaderNum = 2;
+
+    Pipeline* pipeline = nullptr;
+    benchmark.core.CreateGraphicsPipeline(*benchmark.device, graphicsPipelineDesc, pipeline);
+
+    // Render target
+    TextureDesc textureDesc = {};
+    textureDesc.type = TextureType::TEXTURE_2D;
+    textureDesc.usage = TextureUsageBits::COLOR_ATTACHMENT;
+    textureDesc.format = Format::RGBA8_UNORM;
+    textureDesc.width = 64;
+    textureDesc.height = 64;
+    textureDesc.mipNum = 1;
+
+    Texture* texture = nullptr;
+    benchmark.core.CreateCommittedTexture(*benchmark.device, MemoryLocation::DEVICE, 0.0f, textureDesc, texture);
+
+    TextureViewDesc textureViewDesc = {};
+    textureViewDesc.texture = texture;
+    textureViewDesc.type = TextureView::COLOR_ATTACHMENT;
+    textureViewDesc.format = Format::RGBA8_UNORM;
+    textureViewDesc.mipNum = 1;
+    textureViewDesc.layerNum = 1;
+    textureViewDesc.sliceNum = 1;
+
+    Descriptor* colorAttachment = nullptr;
+    benchmark.core.CreateTextureView(textureViewDesc, colorAttachment);
+
+    BufferDesc bufferDesc = {};
+    bufferDesc.size = drawNum * 3 * sizeof(uint16_t);
+    bufferDesc.usage = BufferUsageBits::INDEX;
+
+    Buffer* indexBuffer = nullptr;
+    benchmark.core.CreateCommittedBuffer(*benchmark.device, MemoryLocation::DEVICE, 0.0f, bufferDesc, indexBuffer);
+
+    CommandAllocator* commandAllocator = nullptr;
+    CommandBuffer* commandBuffer = nullptr;
+    benchmark.core.CreateCommandAllocator(*benchmark.queue, commandAllocator);
+    benchmark.core.CreateCommandBuffer(*commandAllocator, commandBuffer);
+
+    // Different draws, as in a real scene
+    std::vector<DrawDesc> drawDescs(drawNum);
+    std::vector<DrawIndexedDesc> drawIndexedDescs(drawNum);
+    for (uint32_t i = 0; i < drawNum; i++) {
+        drawDescs[i] = {3, 1, i * 3, 0};
+        drawIndexedDescs[i] = {3, 1, i * 3, 0, 0};
+    }
+
+    AttachmentDesc attachmentDesc = {};
+    attachmentDesc.descriptor = colorAttachment;
+    attachmentDesc.loadOp = LoadOp::LOAD;
+    attachmentDesc.storeOp = StoreOp::STORE;
+
+    RenderingDesc renderingDesc = {};
+    renderingDesc.colors = &attachmentDesc;
+    renderingDesc.colorNum = 1;
+
+    const Viewport viewport = {0.0f, 0.0f, 64.0f, 64.0f, 0.0f, 1.0f, false};
+    const Rect scissor = {0, 0, 64, 64};
+
+    auto record = [&](uint32_t variant) {
+        benchmark.PauseTiming();
+        benchmark.core.ResetCommandAllocator(*commandAllocator);
+        benchmark.core.BeginCommandBuffer(*commandBuffer, nullptr);
+        benchmark.core.CmdBeginRendering(*commandBuffer, renderingDesc);
+        benchmark.core.CmdSetPipelineLayout(*commandBuffer, BindPoint::GRAPHICS, *pipelineLayout);
+        benchmark.core.CmdSetPipeline(*commandBuffer, *pipeline);
+        benchmark.core.CmdSetIndexBuffer(*commandBuffer, *indexBuffer, 0, IndexType::UINT16);
+        benchmark.core.CmdSetViewports(*commandBuffer, &viewport, 1);
+        benchmark.core.CmdSetScissors(*commandBuffer, &scissor, 1);
+        benchmark.ResumeTiming();
+
+        switch (variant) {
+            case 0:
+                for (const DrawDesc& drawDesc : drawDescs)
+                    benchmark.core.CmdDraw(*commandBuffer, drawDesc);
+                break;
+            case 1:
+                benchmark.core.CmdDrawMulti(*commandBuffer, drawDescs.data(), drawNum, sizeof(DrawDesc));
+                break;
+            case 2:
+                for (const DrawIndexedDesc& drawIndexedDesc : drawIndexedDescs)
+                    benchmark.core.CmdDrawIndexed(*commandBuffer, drawIndexedDesc);
+                break;
+            default:
+                benchmark.core.CmdDrawIndexedMulti(*commandBuffer, drawIndexedDescs.data(), drawNum, sizeof(DrawIndexedDesc));
+                break;
+        }
+
+        benchmark.PauseTiming();
+        benchmark.core.CmdEndRendering(*commandBuffer);
+        benchmark.core.EndCommandBuffer(*commandBuffer);
+        benchmark.ResumeTiming();
+    };
+
+    benchmark.Run("Draws/CmdDraw/1024", drawNum, [&]() { record(0); });
+    benchmark.Run("Draws/CmdDrawMulti/1024", drawNum, [&]() { record(1); });
+    benchmark.Run("Draws/CmdDrawIndexed/1024", drawNum, [&]() { record(2); });
+    benchmark.Run("Draws/CmdDrawIndexedMulti/1024", drawNum, [&]() { record(3); });
+
+    benchmark.core.DestroyCommandBuffer(commandBuffer);
+    benchmark.core.DestroyCommandAllocator(commandAllocator);
+    benchmark.core.DestroyBuffer(indexBuffer);
+    benchmark.core.DestroyDescriptor(colorAttachment);
+    benchmark.core.DestroyTexture(texture);
+    benchmark.core.DestroyPipeline(pipeline);
+    benchmark.core.DestroyPipelineLayout(pipelineLayout);
+}
+
+static void AllocateAndBindMemory(Benchmark& benchmark) {
+    constexpr uint32_t maxBufferNum = 64;
+
+    BufferDesc bufferDesc = {};
+    bufferDesc.size = 64 * 1024;
+    bufferDesc.usage = BufferUsageBits::SHADER_RESOURCE;
+
+    std::vector<Buffer*> buffers(maxBufferNum);
+    std::vector<Memory*> memories(maxBufferNum);
+
+    for (uint32_t bufferNum : {1u, 64u}) {
+        char name[64];
+        snprintf(name, sizeof(name), "AllocateAndBindMemory/%u", bufferNum);
+
+        benchmark.Run(name, 1, [&]() {
+            benchmark.PauseTiming();
+            for (uint32_t i = 0; i < bufferNum; i++)
+                benchmark.core.CreateBuffer(*benchmark.device, bufferDesc, buffers[i]);
+
+            ResourceGroupDesc resourceGroupDesc = {};
+            resourceGroupDesc.memoryLocation = MemoryLocation::DEVICE;
+            resourceGroupDesc.buffers = buffers.data();
+            resourceGroupDesc.bufferNum = bufferNum;
+
+            uint32_t allocationNum = benchmark.helper.CalculateAllocationNumber(*benchmark.device, resourceGroupDesc);
+            benchmark.ResumeTiming();
+
+            benchmark.helper.AllocateAndBindMemory(*benchmark.device, resourceGroupDesc, memories.data());
+
+            benchmark.PauseTiming();
+            for (uint32_t i = 0; i < bufferNum; i++)
+                benchmark.core.DestroyBuffer(buffers[i]);
+
+            for (uint32_t i = 0; i < allocationNum; i++)
+                benchmark.core.FreeMemory(memories[i]);
+            benchmark.ResumeTiming();
+        });
+    }
+}
+
+// Object wrappers and debug names (validation), objects are created and destroyed in batches to exercise recycling
+static void CreateDestroy(Benchmark& benchmark) {
+    constexpr uint32_t objectNum = 256;
+
+    BufferDesc bufferDesc = {};
+    bufferDesc.size = 64 * 1024;
+    bufferDesc.usage = BufferUsageBits::SHADER_RESOURCE;
+
+    TextureDesc textureDesc = {};
+    textureDesc.type = TextureType::TEXTURE_2D;
+    textureDesc.usage = TextureUsageBits::SHADER_RESOURCE;
+    textureDesc.format = Format::RGBA8_UNORM;
+    textureDesc.width = 256;
+    textureDesc.height = 256;
+    textureDesc.mipNum = 1;
+
+    std::vector<Buffer*> buffers(objectNum);
+    std::vector<Texture*> textures(objectNum);
+    std::vector<Fence*> fences(objectNum);
+
+    // Short names fit in place, long ones don't
+    const char* shortName = "Buffer";
+    const char* longName = "Scene/Meshes/Character/LOD0/VertexBuffer/Positions";
+
+    benchmark.Run("CreateDestroy/Buffer/256", objectNum, [&]() {
+        for (uint32_t i = 0; i < objectNum; i++)
+            benchmark.core.CreateBuffer(*benchmark.device, bufferDesc, buffers[i]);
+
+        for (uint32_t i = 0; i < objectNum; i++)
+            benchmark.core.DestroyBuffer(buffers[i]);
+    });
+
+    for (const char* name : {shortName, longName}) {
+        char benchmarkName[64];
+        snprintf(benchmarkName, sizeof(benchmarkName), "CreateDestroy/NamedBuffer/%s/256", name == shortName ? "short" : "long");
+
+        benchmark.Run(benchmarkName, objectNum, [&]() {
+            for (uint32_t i = 0; i < objectNum; i++) {
+                benchmark.core.CreateBuffer(*benchmark.device, bufferDesc, buffers[i]);
+                benchmark.core.SetDebugName(buffers[i], name);
+            }
+
+            for (uint32_t i = 0; i < objectNum; i++)
+                benchmark.core.DestroyBuffer(buffers[i]);
+        });
+    }
+
+    benchmark.Run("CreateDestroy/Texture/256", objectNum, [&]() {
+        for (uint32_t i = 0; i < objectNum; i++)
+            benchmark.core.CreateTexture(*benchmark.device, textureDesc, textures[i]);
+
+        for (uint32_t i = 0; i < objectNum; i++)
+            benchmark.core.DestroyTexture(textures[i]);
+    });
+
+    benchmark.Run("CreateDestroy/Fence/256", objectNum, [&]() {
+        for (uint32_t i = 0; i < objectNum; i++)
+            benchmark.core.CreateFence(*benchmark.device, 0, fences[i]);
+
+        for (uint32_t i = 0; i < objectNum; i++)
+            benchmark.core.DestroyFence(fences[i]);
+    });
+}
+
+// Meaningful only if "NRI_ENABLE_ANNOTATION_RECORDER" is enabled (otherwise it measures NVTX or GAPI markers, if any)
+static void Annotations(Benchmark& benchmark) {
+    constexpr uint32_t rangeNum = 512;
+
+    CommandAllocator* commandAllocator = nullptr;
+    CommandBuffer* commandBuffer = nullptr;
+    benchmark.core.CreateCommandAllocator(*benchmark.queue, commandAllocator);
+    benchmark.core.CreateCommandBuffer(*commandAllocator, commandBuffer);
+
+    benchmark.Run("Annotations/CmdBeginEndAnnotation/1024", rangeNum * 2, [&]() {
+        benchmark.PauseTiming();
+        benchmark.core.ResetCommandAllocator(*commandAllocator);
+        benchmark.core.BeginCommandBuffer(*commandBuffer, nullptr);
+        benchmark.ResumeTiming();
+
+        for (uint32_t i = 0; i < rangeNum; i++) {
+            benchmark.core.CmdBeginAnnotation(*commandBuffer, "GBuffer/Opaque", BGRA_UNUSED);
+            benchmark.core.CmdEndAnnotation(*commandBuffer);
+        }
+
+        benchmark.PauseTiming();
+        benchmark.core.EndCommandBuffer(*commandBuffer);
+        benchmark.ResumeTiming();
+    });
+
+    benchmark.Run("Annotations/QueueAnnotation/1024", rangeNum * 2, [&]() {
+        for (uint32_t i = 0; i < rangeNum * 2; i++)
+            benchmark.core.QueueAnnotation(*benchmark.queue, "Present", BGRA_UNUSED);
+    });
+
+    benchmark.Run("Annotations/nriAnnotation/1024", rangeNum * 2, [&]() {
+        for (uint32_t i = 0; i < rangeNum * 2; i++)
+            nriAnnotation("Simulation", BGRA_UNUSED);
+    });
+
+    benchmark.core.DestroyCommandBuffer(commandBuffer);
+    benchmark.core.DestroyCommandAllocator(commandAllocator);
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+
+typedef void (*BenchmarkFunc)(Benchmark& benchmark);
+
+static const BenchmarkFunc g_benchmarks[] = {
+    CmdRecording,
+    DescriptorSets,
+    DescriptorWrites,
+    QueueSubmit,
+    StreamData,
+    UploadMemory,
+    UploadData,
+    RedundantState,
+    Draws,
+    AllocateAndBindMemory,
+    CreateDestroy,
+    Annotations,
+};
+
+static bool CreateDevice(Benchmark& benchmark, Backend backend) {
+    bool isVK = backend == Backend::VK || backend == Backend::VK_VALIDATION || backend == Backend::VK_DESCRIPTOR_BUFFER;
+
+    DeviceCreationDesc deviceCreationDesc = {};
+    deviceCreationDesc.graphicsAPI = isVK ? GraphicsAPI::VK : GraphicsAPI::NONE;
+    deviceCreationDesc.enableNRIValidation = g_baseBackends[(size_t)backend] != Backend::MAX_NUM;
+    deviceCreationDesc.validationLevel.commandBufferSampling = backend == Backend::VALIDATION_SAMPLED ? VALIDATION_SAMPLING : 0;
+    deviceCreationDesc.enableVKDescriptorBuffer = backend == Backend::VK_DESCRIPTOR_BUFFER;
+    deviceCreationDesc.callbackInterface.MessageCallback = MessageCallback;
+    deviceCreationDesc.callbackInterface.userArg = &benchmark;
+
+    // Prefer a software adapter (lavapipe) for VK to get numbers comparable across machines
+    AdapterDesc adapterDescs[8] = {};
+    uint32_t adapterDescNum = 8;
+    if (isVK && nriEnumerateAdapters(adapterDescs, adapterDescNum) == Result::SUCCESS) {
+        for (uint32_t i = 0; i < adapterDescNum; i++) {
+            if (adapterDescs[i].architecture == Architecture::SOFTWARE) {
+                deviceCreationDesc.adapterDesc = &adapterDescs[i];
+                break;
+            }
+        }
+    }
+
+    if (nriCreateDevice(deviceCreationDesc, benchmark.device) != Result::SUCCESS)
+        return false;
+
+    if (nriGetInterface(*benchmark.device, NRI_INTERFACE(CoreInterface), &benchmark.core) != Result::SUCCESS
+        || nriGetInterface(*benchmark.device, NRI_INTERFACE(HelperInterface), &benchmark.helper) != Result::SUCCESS
+        || benchmark.core.GetQueue(*benchmark.device, QueueType::GRAPHICS, 0, benchmark.queue) != Result::SUCCESS) {
+        nriDestroyDevice(benchmark.device);
+        return false;
+    }
+
+    nriGetInterface(*benchmark.device, NRI_INTERFACE(StreamerInterface), &benchmark.streamer); // zeroed if unsupported
+
+    const DeviceDesc& deviceDesc = benchmark.core.GetDeviceDesc(*benchmark.device);
+    printf("%s: %s\n", g_backendNames[(size_t)backend], deviceDesc.adapterDesc.name);
+
+    return true;
+}
+
+static void WriteJson(const char* path, const std::vector<BenchmarkResult>& results) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        printf("ERROR: can't open '%s' for writing\n", path);
+        return;
+    }
+
+    fprintf(file, "{\n  \"context\": {\"library\": \"NRI\", \"version\": %u, \"date\": \"%s\"},\n  \"benchmarks\": [", NRI_VERSION, NRI_VERSION_DATE);
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& result = results[i];
+
+        fprintf(file, "%s\n    {\"name\": \"%s/%s\", \"backend\": \"%s\", \"iterations\": %" PRIu64 ", \"ops\": %" PRIu64 ", \"real_time\": %.3f, \"time_unit\": \"ns\"}",
+            i ? "," : "", g_backendNames[(size_t)result.backend], result.name.c_str(), g_backendNames[(size_t)result.backend], result.iterations, result.ops, result.nsPerOp);
+    }
+
+    fprintf(file, "\n  ]\n}\n");
+    fclose(file);
+}
+
+static void PrintValidationOverhead(const std::vector<BenchmarkResult>& results) {
+    bool isHeaderPrinted = false;
+
+    for (const BenchmarkResult& result : results) {
+        Backend baseBackend = g_baseBackends[(size_t)result.backend];
+        if (baseBackend == Backend::MAX_NUM)
+            continue;
+
+        auto base = std::find_if(results.begin(), results.end(), [&](const BenchmarkResult& other) {
+            return other.backend == baseBackend && other.name == result.name;
+        });
+
+        if (base == results.end())
+            continue;
+
+        if (!isHeaderPrinted) {
+            printf("\nValidation overhead:\n");
+            isHeaderPrinted = true;
+        }
+
+        // A percentage over a (nearly) free call, i.e. NONE, means nothing, the absolute cost is what matters there
+        double overheadNs = result.nsPerOp - base->nsPerOp;
+        printf("  %-18s %-48s %10.1f ns %+10.1f ns", g_backendNames[(size_t)result.backend], result.name.c_str(), result.nsPerOp, overheadNs);
+
+        if (base->nsPerOp >= 1.0)
+            printf(" (%+.1f%%)\n", 100.0 * overheadNs / base->nsPerOp);
+        else
+            printf("\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    bool backends[(size_t)Backend::MAX_NUM] = {};
+    bool isBackendSpecified = false;
+    const char* jsonPath = nullptr;
+
+    Benchmark benchmark;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--backend") && i + 1 < argc) {
+            const char* name = argv[++i];
+
+            size_t j = 0;
+            for (; j < (size_t)Backend::MAX_NUM; j++) {
+                if (!strcmp(name, g_backendNames[j]))
+                    break;
+            }
+
+            if (j == (size_t)Backend::MAX_NUM) {
+                printf("ERROR: unknown backend '%s'\n", name);
+                return 1;
+            }
+
+            backends[j] = true;
+            isBackendSpecified = true;
+        } else if (!strcmp(argv[i], "--filter") && i + 1 < argc)
+            benchmark.filter = argv[++i];
+        else if (!strcmp(argv[i], "--min-time") && i + 1 < argc)
+            benchmark.minTimeNs = std::max(atof(argv[++i]), 1.0) * 1e6;
+        else if (!strcmp(argv[i], "--json") && i + 1 < argc)
+            jsonPath = argv[++i];
+        else {
+            printf("Usage: NRI_Benchmarks [--backend NONE|VALIDATION|VALIDATION_SAMPLED|VK|VK_VALIDATION|VK_DESCRIPTOR_BUFFER]... [--filter <substring>] [--min-time <ms>] [--json <output file>]\n");
+            return 1;
+        }
+    }
+
+    benchmark.CalibrateTimer();
+
+    for (size_t i = 0; i < (size_t)Backend::MAX_NUM; i++) {
+        if (isBackendSpecified && !backends[i])
+            continue;
+
+        benchmark.backend = (Backend)i;
+        if (!CreateDevice(benchmark, benchmark.backend)) {
+            printf("%s: SKIPPED (can't create a device)\n", g_backendNames[i]);
+            continue;
+        }
+
+        for (BenchmarkFunc func : g_benchmarks)
+            func(benchmark);
+
+        benchmark.core.DeviceWaitIdle(benchmark.device);
+        nriDestroyDevice(benchmark.device);
+    }
+
+    PrintValidationOverhead(benchmark.results);
+
+    if (jsonPath)
+        WriteJson(jsonPath, benchmark.results);
+
+    return benchmark.errorNum ? 1 : 0;
+}
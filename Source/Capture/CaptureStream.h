@@ -0,0 +1,614 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+// Binary format of NRI API captures, shared by the capture layer and the replay tool:
+// - "CaptureFileHeader" followed by records ("CaptureRecordHeader" + payload)
+// - records from different threads are interleaved, "seq" defines the global call order
+// - a payload is a sequence of 8-byte aligned arguments, each argument is followed by the data it points to
+// - handles are stored as captured pointer values and remapped by the reader
+// - "Serialize" functions are symmetric: the same code computes sizes, writes and reads (fixing up pointers and handles)
+
+namespace nri {
+
+constexpr uint32_t CAPTURE_MAGIC = 0x4349524E; // "NRIC"
+constexpr uint32_t CAPTURE_VERSION = 2;
+
+// clang-format off
+#define NRI_CAPTURE_OPS(X) \
+    X(GetQueue) \
+    X(CreateCommandAllocator) \
+    X(CreateCommandBuffer) \
+    X(CreateFence) \
+    X(CreateDescriptorPool) \
+    X(CreatePipelineLayout) \
+    X(CreateGraphicsPipeline) \
+    X(CreateComputePipeline) \
+    X(CreatePipelineCache) \
+    X(CreateQueryPool) \
+    X(CreateSampler) \
+    X(CreateBufferView) \
+    X(CreateTextureView) \
+    X(DestroyCommandAllocator) \
+    X(DestroyCommandBuffer) \
+    X(DestroyDescriptorPool) \
+    X(DestroyBuffer) \
+    X(DestroyTexture) \
+    X(DestroyDescriptor) \
+    X(DestroyPipelineLayout) \
+    X(DestroyPipeline) \
+    X(DestroyPipelineCache) \
+    X(DestroyQueryPool) \
+    X(DestroyFence) \
+    X(AllocateMemory) \
+    X(FreeMemory) \
+    X(CreateBuffer) \
+    X(CreateTexture) \
+    X(GetBufferMemoryDesc) \
+    X(GetTextureMemoryDesc) \
+    X(BindBufferMemory) \
+    X(BindTextureMemory) \
+    X(GetBufferMemoryDesc2) \
+    X(GetTextureMemoryDesc2) \
+    X(CreateCommittedBuffer) \
+    X(CreateCommittedTexture) \
+    X(CreatePlacedBuffer) \
+    X(CreatePlacedTexture) \
+    X(AllocateDescriptorSets) \
+    X(UpdateDescriptorRanges) \
+    X(CopyDescriptorRanges) \
+    X(ResetDescriptorPool) \
+    X(BeginCommandBuffer) \
+    X(CmdSetDescriptorPool) \
+    X(CmdSetPipelineLayout) \
+    X(CmdSetDescriptorSet) \
+    X(CmdSetRootConstants) \
+    X(CmdSetRootDescriptor) \
+    X(CmdSetPipeline) \
+    X(CmdBarrier) \
+    X(CmdSetIndexBuffer) \
+    X(CmdSetVertexBuffers) \
+    X(CmdSetViewports) \
+    X(CmdSetScissors) \
+    X(CmdSetStencilReference) \
+    X(CmdSetDepthBounds) \
+    X(CmdSetBlendConstants) \
+    X(CmdSetSampleLocations) \
+    X(CmdSetShadingRate) \
+    X(CmdSetDepthBias) \
+    X(CmdSetTopology) \
+    X(CmdSetCullMode) \
+    X(CmdSetFrontFace) \
+    X(CmdSetDepthState) \
+    X(CmdSetStencilState) \
+    X(CmdSetColorState) \
+    X(CmdBeginRendering) \
+    X(CmdClearAttachments) \
+    X(CmdDraw) \
+    X(CmdDrawIndexed) \
+    X(CmdDrawIndirect) \
+    X(CmdDrawIndexedIndirect) \
+    X(CmdEndRendering) \
+    X(CmdDispatch) \
+    X(CmdDispatchIndirect) \
+    X(CmdCopyBuffer) \
+    X(CmdCopyTexture) \
+    X(CmdUploadBufferToTexture) \
+    X(CmdReadbackTextureToBuffer) \
+    X(CmdZeroBuffer) \
+    X(CmdResolveTexture) \
+    X(CmdClearStorage) \
+    X(CmdResetQueries) \
+    X(CmdBeginQuery) \
+    X(CmdEndQuery) \
+    X(CmdCopyQueries) \
+    X(CmdBeginAnnotation) \
+    X(CmdEndAnnotation) \
+    X(CmdAnnotation) \
+    X(EndCommandBuffer) \
+    X(QueueBeginAnnotation) \
+    X(QueueEndAnnotation) \
+    X(QueueAnnotation) \
+    X(ResetQueries) \
+    X(QueueSubmit) \
+    X(QueueWaitIdle) \
+    X(DeviceWaitIdle) \
+    X(Wait) \
+    X(ResetCommandAllocator) \
+    X(MapBuffer) \
+    X(UnmapBuffer) \
+    X(UploadHostMemoryToTexture) \
+    X(ReadbackTextureToHostMemory) \
+    X(SetDebugName) \
+    X(CmdDrawMeshTasks) \
+    X(CmdDrawMeshTasksIndirect) \
+    X(GetSwapChainTextures) \
+    X(CreateSwapChain) \
+    X(DestroySwapChain) \
+    X(AcquireNextTexture) \
+    X(WaitForPresent) \
+    X(QueuePresent) \
+    X(SetLatencySleepMode) \
+    X(SetLatencyMarker) \
+    X(LatencySleep) \
+    X(CreateRayTracingPipeline) \
+    X(CreateAccelerationStructureDescriptor) \
+    X(GetAccelerationStructureBuffer) \
+    X(GetMicromapBuffer) \
+    X(DestroyAccelerationStructure) \
+    X(DestroyMicromap) \
+    X(CreateAccelerationStructure) \
+    X(CreateMicromap) \
+    X(GetAccelerationStructureMemoryDesc) \
+    X(GetMicromapMemoryDesc) \
+    X(BindAccelerationStructureMemory) \
+    X(BindMicromapMemory) \
+    X(GetAccelerationStructureMemoryDesc2) \
+    X(GetMicromapMemoryDesc2) \
+    X(CreateCommittedAccelerationStructure) \
+    X(CreateCommittedMicromap) \
+    X(CreatePlacedAccelerationStructure) \
+    X(CreatePlacedMicromap) \
+    X(CmdBuildMicromaps) \
+    X(CmdWriteMicromapsSizes) \
+    X(CmdCopyMicromap) \
+    X(CmdBuildTopLevelAccelerationStructures) \
+    X(CmdBuildBottomLevelAccelerationStructures) \
+    X(CmdWriteAccelerationStructuresSizes) \
+    X(CmdCopyAccelerationStructure) \
+    X(CmdDispatchRays) \
+    X(CmdDispatchRaysIndirect) \
+    X(CmdDrawMulti) \
+    X(CmdDrawIndexedMulti)
+// clang-format on
+
+#define NRI_CAPTURE_OP_ENUM(name) name,
+#define NRI_CAPTURE_OP_NAME(name) #name,
+
+enum class CaptureOp : uint16_t {
+    NRI_CAPTURE_OPS(NRI_CAPTURE_OP_ENUM)
+
+        MAX_NUM
+};
+
+constexpr const char* g_captureOpNames[] = {NRI_CAPTURE_OPS(NRI_CAPTURE_OP_NAME)};
+static_assert(sizeof(g_captureOpNames) / sizeof(g_captureOpNames[0]) == (size_t)CaptureOp::MAX_NUM, "Keep 'g_captureOpNames' in sync");
+
+#undef NRI_CAPTURE_OP_ENUM
+#undef NRI_CAPTURE_OP_NAME
+
+struct CaptureFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t nriVersion;
+    uint32_t queueNum[(size_t)QueueType::MAX_NUM]; // created queues per type
+    uint64_t device;                               // captured device handle
+    GraphicsAPI graphicsAPI;
+    uint8_t reserved[7];
+};
+
+struct CaptureRecordHeader {
+    uint64_t seq;
+    uint32_t size; // payload size
+    CaptureOp op;
+    uint16_t reserved;
+};
+
+static_assert(sizeof(CaptureRecordHeader) == 16, "Payloads must stay 8-byte aligned");
+
+constexpr size_t CaptureAlign(size_t size) {
+    return (size + 7) & ~size_t(7);
+}
+
+// Argument wrappers (a raw pointer argument is always a handle)
+template <typename T>
+struct CaptureArray {
+    T* ptr;
+    uint64_t num;
+};
+
+struct CaptureString {
+    const char* str;
+};
+
+struct CaptureBlob {
+    const void* data;
+    uint64_t size;
+};
+
+//============================================================================================================================================================================================
+// Streams
+
+// Pass 1: size computation
+struct CaptureSizer {
+    template <typename T>
+    inline void Value(T&) {
+        size += CaptureAlign(sizeof(T));
+    }
+
+    template <typename T>
+    inline std::remove_const_t<T>* Array(T*& ptr, uint64_t num) {
+        if (ptr && num)
+            size += CaptureAlign(sizeof(T) * num);
+
+        return (std::remove_const_t<T>*)ptr;
+    }
+
+    inline void String(const char*& str) {
+        if (str)
+            size += CaptureAlign(sizeof(uint64_t) + strlen(str) + 1);
+    }
+
+    inline void Blob(const void*& data, uint64_t dataSize) {
+        if (data && dataSize)
+            size += CaptureAlign(dataSize);
+    }
+
+    template <typename T>
+    inline void Handle(T*&) {
+    }
+
+    size_t size = 0;
+};
+
+// Pass 2: writing into pre-reserved memory
+struct CaptureWriter {
+    inline CaptureWriter(uint8_t* dst)
+        : m_Dst(dst) {
+    }
+
+    template <typename T>
+    inline void Value(T& value) {
+        Write(&value, sizeof(T));
+    }
+
+    template <typename T>
+    inline std::remove_const_t<T>* Array(T*& ptr, uint64_t num) {
+        if (ptr && num)
+            Write(ptr, sizeof(T) * num);
+
+        return (std::remove_const_t<T>*)ptr;
+    }
+
+    inline void String(const char*& str) {
+        if (str) {
+            uint64_t len = strlen(str);
+            memcpy(m_Dst, &len, sizeof(len));
+            memcpy(m_Dst + sizeof(len), str, len + 1);
+            m_Dst += CaptureAlign(sizeof(len) + len + 1);
+        }
+    }
+
+    inline void Blob(const void*& data, uint64_t dataSize) {
+        if (data && dataSize)
+            Write(data, dataSize);
+    }
+
+    template <typename T>
+    inline void Handle(T*&) {
+    }
+
+private:
+    inline void Write(const void* src, size_t size) {
+        memcpy(m_Dst, src, size);
+        m_Dst += CaptureAlign(size);
+    }
+
+    uint8_t* m_Dst;
+};
+
+//============================================================================================================================================================================================
+// Per-type serialization (default: plain data)
+
+template <typename S, typename T>
+inline void Serialize(S&, T&) {
+}
+
+template <typename S, typename T>
+inline void Serialize(S& s, T*& handle) {
+    s.Handle(handle);
+}
+
+template <typename S, typename T>
+inline void Serialize(S& s, CaptureArray<T>& arg) {
+    auto* elements = s.Array(arg.ptr, arg.num);
+    if (elements) {
+        for (uint64_t i = 0; i < arg.num; i++)
+            Serialize(s, elements[i]);
+    }
+}
+
+template <typename S>
+inline void Serialize(S& s, CaptureString& arg) {
+    s.String(arg.str);
+}
+
+template <typename S>
+inline void Serialize(S& s, CaptureBlob& arg) {
+    s.Blob(arg.data, arg.size);
+}
+
+template <typename S, typename T>
+inline void SerializeArray(S& s, T*& ptr, uint64_t num) {
+    auto* elements = s.Array(ptr, num);
+    if (elements) {
+        for (uint64_t i = 0; i < num; i++)
+            Serialize(s, elements[i]);
+    }
+}
+
+template <typename S>
+inline void Serialize(S& s, BufferBarrierDesc& desc) {
+    s.Handle(desc.buffer);
+}
+
+template <typename S>
+inline void Serialize(S& s, TextureBarrierDesc& desc) {
+    s.Handle(desc.texture);
+    s.Handle(desc.srcQueue);
+    s.Handle(desc.dstQueue);
+}
+
+template <typename S>
+inline void Serialize(S& s, BarrierDesc& desc) {
+    SerializeArray(s, desc.globals, desc.globalNum);
+    SerializeArray(s, desc.buffers, desc.bufferNum);
+    SerializeArray(s, desc.textures, desc.textureNum);
+}
+
+template <typename S>
+inline void Serialize(S& s, BindBufferMemoryDesc& desc) {
+    s.Handle(desc.buffer);
+    s.Handle(desc.memory);
+}
+
+template <typename S>
+inline void Serialize(S& s, BindTextureMemoryDesc& desc) {
+    s.Handle(desc.texture);
+    s.Handle(desc.memory);
+}
+
+template <typename S>
+inline void Serialize(S& s, TextureViewDesc& desc) {
+    s.Handle(desc.texture);
+}
+
+template <typename S>
+inline void Serialize(S& s, BufferViewDesc& desc) {
+    s.Handle(desc.buffer);
+}
+
+template <typename S>
+inline void Serialize(S& s, DescriptorSetDesc& desc) {
+    SerializeArray(s, desc.ranges, desc.rangeNum);
+}
+
+template <typename S>
+inline void Serialize(S& s, PipelineLayoutDesc& desc) {
+    SerializeArray(s, desc.rootConstants, desc.rootConstantNum);
+    SerializeArray(s, desc.rootDescriptors, desc.rootDescriptorNum);
+    SerializeArray(s, desc.rootSamplers, desc.rootSamplerNum);
+    SerializeArray(s, desc.descriptorSets, desc.descriptorSetNum);
+}
+
+template <typename S>
+inline void Serialize(S& s, UpdateDescriptorRangeDesc& desc) {
+    s.Handle(desc.descriptorSet);
+    SerializeArray(s, desc.descriptors, desc.descriptorNum);
+}
+
+template <typename S>
+inline void Serialize(S& s, CopyDescriptorRangeDesc& desc) {
+    s.Handle(desc.dstDescriptorSet);
+    s.Handle(desc.srcDescriptorSet);
+}
+
+template <typename S>
+inline void Serialize(S& s, SetDescriptorSetDesc& desc) {
+    s.Handle(desc.descriptorSet);
+}
+
+template <typename S>
+inline void Serialize(S& s, SetRootConstantsDesc& desc) {
+    s.Blob(desc.data, desc.size);
+}
+
+template <typename S>
+inline void Serialize(S& s, SetRootDescriptorDesc& desc) {
+    s.Handle(desc.descriptor);
+}
+
+template <typename S>
+inline void Serialize(S& s, VertexAttributeDesc& desc) {
+    s.String(desc.d3d.semanticName);
+}
+
+template <typename S>
+inline void Serialize(S& s, VertexInputDesc& desc) {
+    SerializeArray(s, desc.attributes, desc.attributeNum);
+    SerializeArray(s, desc.streams, desc.streamNum);
+}
+
+template <typename S>
+inline void Serialize(S& s, VertexBufferDesc& desc) {
+    s.Handle(desc.buffer);
+}
+
+template <typename S>
+inline void Serialize(S& s, OutputMergerDesc& desc) {
+    SerializeArray(s, desc.colors, desc.colorNum);
+}
+
+template <typename S>
+inline void Serialize(S& s, PipelineCacheDesc& desc) {
+    s.Blob(desc.data, desc.size);
+}
+
+template <typename S>
+inline void Serialize(S& s, ShaderDesc& desc) {
+    s.Blob(desc.bytecode, desc.size);
+    s.String(desc.entryPointName);
+}
+
+template <typename S>
+inline void Serialize(S& s, GraphicsPipelineDesc& desc) {
+    s.Handle(desc.pipelineLayout);
+    SerializeArray(s, desc.vertexInput, 1);
+    SerializeArray(s, desc.multisample, 1);
+    Serialize(s, desc.outputMerger);
+    SerializeArray(s, desc.shaders, desc.shaderNum);
+    s.Handle(desc.cache);
+}
+
+template <typename S>
+inline void Serialize(S& s, ComputePipelineDesc& desc) {
+    s.Handle(desc.pipelineLayout);
+    Serialize(s, desc.shader);
+    s.Handle(desc.cache);
+}
+
+template <typename S>
+inline void Serialize(S& s, AttachmentDesc& desc) {
+    s.Handle(desc.descriptor);
+    s.Handle(desc.resolveDst);
+}
+
+template <typename S>
+inline void Serialize(S& s, RenderingDesc& desc) {
+    SerializeArray(s, desc.colors, desc.colorNum);
+    Serialize(s, desc.depth);
+    Serialize(s, desc.stencil);
+    s.Handle(desc.shadingRate);
+}
+
+template <typename S>
+inline void Serialize(S& s, UploadHostMemoryToTextureDesc& desc) {
+    s.Handle(desc.dstTexture); // "srcData" is not captured
+}
+
+template <typename S>
+inline void Serialize(S& s, ReadbackTextureToHostMemoryDesc& desc) {
+    s.Handle(desc.srcTexture);
+}
+
+template <typename S>
+inline void Serialize(S& s, FenceSubmitDesc& desc) {
+    s.Handle(desc.fence);
+}
+
+template <typename S>
+inline void Serialize(S& s, QueueSubmitDesc& desc) {
+    SerializeArray(s, desc.waitFences, desc.waitFenceNum);
+    SerializeArray(s, desc.commandBuffers, desc.commandBufferNum);
+    SerializeArray(s, desc.signalFences, desc.signalFenceNum);
+    s.Handle(desc.swapChain);
+}
+
+template <typename S>
+inline void Serialize(S& s, ClearStorageDesc& desc) {
+    s.Handle(desc.descriptor);
+}
+
+template <typename S>
+inline void Serialize(S& s, SwapChainDesc& desc) {
+    s.Handle(desc.queue); // "window" is not captured
+}
+
+template <typename S>
+inline void Serialize(S& s, ShaderLibraryDesc& desc) {
+    SerializeArray(s, desc.shaders, desc.shaderNum);
+}
+
+template <typename S>
+inline void Serialize(S& s, RayTracingPipelineDesc& desc) {
+    s.Handle(desc.pipelineLayout);
+    SerializeArray(s, desc.shaderLibrary, 1);
+    SerializeArray(s, desc.shaderGroups, desc.shaderGroupNum);
+    s.Handle(desc.cache);
+}
+
+template <typename S>
+inline void Serialize(S& s, MicromapDesc& desc) {
+    SerializeArray(s, desc.usages, desc.usageNum);
+}
+
+template <typename S>
+inline void Serialize(S& s, BindMicromapMemoryDesc& desc) {
+    s.Handle(desc.micromap);
+    s.Handle(desc.memory);
+}
+
+template <typename S>
+inline void Serialize(S& s, BuildMicromapDesc& desc) {
+    s.Handle(desc.dst);
+    s.Handle(desc.dataBuffer);
+    s.Handle(desc.triangleBuffer);
+    s.Handle(desc.scratchBuffer);
+}
+
+template <typename S>
+inline void Serialize(S& s, BottomLevelMicromapDesc& desc) {
+    s.Handle(desc.micromap);
+    s.Handle(desc.indexBuffer);
+}
+
+// Buffers can be "HAS_BUFFER"
+template <typename S>
+inline void Serialize(S& s, BottomLevelGeometryDesc& desc) {
+    if (desc.type == BottomLevelGeometryType::TRIANGLES) {
+        s.Handle(desc.triangles.vertexBuffer);
+        s.Handle(desc.triangles.indexBuffer);
+        s.Handle(desc.triangles.transformBuffer);
+        SerializeArray(s, desc.triangles.micromap, 1);
+    } else
+        s.Handle(desc.aabbs.buffer);
+}
+
+template <typename S>
+inline void Serialize(S& s, AccelerationStructureDesc& desc) {
+    SerializeArray(s, desc.geometries, desc.type == AccelerationStructureType::BOTTOM_LEVEL ? desc.geometryOrInstanceNum : 0);
+}
+
+template <typename S>
+inline void Serialize(S& s, BindAccelerationStructureMemoryDesc& desc) {
+    s.Handle(desc.accelerationStructure);
+    s.Handle(desc.memory);
+}
+
+template <typename S>
+inline void Serialize(S& s, BuildTopLevelAccelerationStructureDesc& desc) {
+    s.Handle(desc.dst);
+    s.Handle(desc.src);
+    s.Handle(desc.instanceBuffer); // instances (and acceleration structure handles in them) are host data, which is not captured
+    s.Handle(desc.scratchBuffer);
+}
+
+template <typename S>
+inline void Serialize(S& s, BuildBottomLevelAccelerationStructureDesc& desc) {
+    s.Handle(desc.dst);
+    s.Handle(desc.src);
+    SerializeArray(s, desc.geometries, desc.geometryNum);
+    s.Handle(desc.scratchBuffer);
+}
+
+template <typename S>
+inline void Serialize(S& s, StridedBufferRegion& desc) {
+    s.Handle(desc.buffer);
+}
+
+template <typename S>
+inline void Serialize(S& s, DispatchRaysDesc& desc) {
+    Serialize(s, desc.raygenShader);
+    Serialize(s, desc.missShaders);
+    Serialize(s, desc.hitShaderGroups);
+    Serialize(s, desc.callableShaders);
+}
+
+// A top level argument: the value itself, followed by the data it points to
+template <typename S, typename T>
+inline void SerializeArg(S& s, T& arg) {
+    s.Value(arg);
+    Serialize(s, arg);
+}
+
+} // namespace nri
@@ -0,0 +1,151 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct CaptureExtSupported {
+    uint32_t imgui      : 1;
+    uint32_t lowLatency : 1;
+    uint32_t meshShader : 1;
+    uint32_t rayTracing : 1;
+    uint32_t streamer   : 1;
+    uint32_t swapChain  : 1;
+    uint32_t upscaler   : 1;
+};
+
+// Every thread records into its own chunk, full chunks are appended to the file under a lock
+struct CaptureChunk {
+    uint8_t* data;
+    size_t size;
+    size_t used;
+    CaptureChunk* next;
+    bool isOwned;
+};
+
+// Objects are not wrapped: the capture layer records a call and forwards it to the implementation as is,
+// only "Device" is replaced. As a consequence, there can be only one capturing device at a time
+struct DeviceCapture final : public DeviceBase {
+    DeviceCapture(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks, DeviceBase& device);
+    ~DeviceCapture();
+
+    inline Device& GetImpl() const {
+        return m_Impl;
+    }
+
+    inline const CoreInterface& GetCoreInterface() const {
+        return m_iCore;
+    }
+
+    inline const CoreInterface& GetCoreInterfaceImpl() const {
+        return m_iCoreImpl;
+    }
+
+    inline const HelperInterface& GetHelperInterfaceImpl() const {
+        return m_iHelperImpl;
+    }
+
+    inline const LowLatencyInterface& GetLowLatencyInterfaceImpl() const {
+        return m_iLowLatencyImpl;
+    }
+
+    inline const MeshShaderInterface& GetMeshShaderInterfaceImpl() const {
+        return m_iMeshShaderImpl;
+    }
+
+    inline const RayTracingInterface& GetRayTracingInterfaceImpl() const {
+        return m_iRayTracingImpl;
+    }
+
+    inline const SwapChainInterface& GetSwapChainInterfaceImpl() const {
+        return m_iSwapChainImpl;
+    }
+
+    inline Device* GetImplFor(const Device& device) const {
+        return &device == (Device*)this ? &m_Impl : (Device*)&device;
+    }
+
+    bool Create(const DeviceCreationDesc& desc);
+
+    // Allocation-free unless a single record doesn't fit into a chunk
+    template <typename... Args>
+    inline void Record(CaptureOp op, const Args&... args) {
+        CaptureSizer sizer;
+        (SerializeArg(sizer, const_cast<Args&>(args)), ...);
+
+        size_t recordSize = sizeof(CaptureRecordHeader) + sizer.size;
+        uint8_t* dst = Reserve(recordSize);
+        if (!dst)
+            return;
+
+        CaptureRecordHeader* header = (CaptureRecordHeader*)dst;
+        header->seq = m_Seq.fetch_add(1, std::memory_order_relaxed);
+        header->size = (uint32_t)sizer.size;
+        header->op = op;
+        header->reserved = 0;
+
+        CaptureWriter writer(dst + sizeof(CaptureRecordHeader));
+        (SerializeArg(writer, const_cast<Args&>(args)), ...);
+    }
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) override {
+        m_iCoreImpl.SetDebugName((Object*)&m_Impl, name);
+    }
+
+    //================================================================================================================
+    // DeviceBase
+    //================================================================================================================
+
+    const DeviceDesc& GetDesc() const override {
+        return ((DeviceBase&)m_Impl).GetDesc();
+    }
+
+    void Destruct() override;
+    Result FillFunctionTable(CoreInterface& table) const override;
+    Result FillFunctionTable(HelperInterface& table) const override;
+    Result FillFunctionTable(LowLatencyInterface& table) const override;
+    Result FillFunctionTable(MeshShaderInterface& table) const override;
+    Result FillFunctionTable(RayTracingInterface& table) const override;
+    Result FillFunctionTable(StreamerInterface& table) const override;
+    Result FillFunctionTable(SwapChainInterface& table) const override;
+    Result FillFunctionTable(UpscalerInterface& table) const override;
+
+#if NRI_ENABLE_IMGUI_EXTENSION
+    Result FillFunctionTable(ImguiInterface& table) const override;
+#endif
+
+private:
+    uint8_t* Reserve(size_t size);
+    CaptureChunk* AcquireChunk();
+    void Flush(CaptureChunk& chunk);
+
+private:
+    Device& m_Impl;
+    FILE* m_File = nullptr;
+    CaptureChunk* m_Chunks = nullptr; // guarded by "g_captureLock"
+    std::atomic_uint64_t m_Seq = 0;
+    uint32_t m_Session = 0;
+    Lock m_FileLock;
+
+    // Capture
+    CoreInterface m_iCore = {};
+
+    // Implementation
+    CoreInterface m_iCoreImpl = {};
+    HelperInterface m_iHelperImpl = {};
+    LowLatencyInterface m_iLowLatencyImpl = {};
+    MeshShaderInterface m_iMeshShaderImpl = {};
+    RayTracingInterface m_iRayTracingImpl = {};
+    SwapChainInterface m_iSwapChainImpl = {};
+
+    union {
+        uint32_t m_IsExtSupportedStorage = 0;
+        CaptureExtSupported m_IsExtSupported;
+    };
+};
+
+} // namespace nri
@@ -0,0 +1,202 @@
+// © 2021 NVIDIA Corporation
+
+constexpr size_t CAPTURE_CHUNK_SIZE = 64 * 1024;
+
+// Global state ("DeviceCapture" lifetime is shorter than lifetime of thread locals)
+static Lock g_captureLock;
+static DeviceCapture* g_deviceCapture = nullptr; // guarded by "g_captureLock"
+static uint32_t g_captureSessionCounter = 0;     // guarded by "g_captureLock"
+
+// Trivial thread locals keep the recording path free of TLS init guards. "CaptureThreadContext" is touched only once per thread to release the chunk on thread exit
+static thread_local CaptureChunk* t_captureChunk;
+static thread_local uint32_t t_captureSession;
+
+struct CaptureThreadContext {
+    inline ~CaptureThreadContext() {
+        ExclusiveScope lock(g_captureLock);
+
+        // The chunk is already gone if the device has been destroyed
+        if (g_deviceCapture && t_captureChunk && t_captureSession == g_captureSessionCounter)
+            t_captureChunk->isOwned = false;
+
+        t_captureChunk = nullptr;
+    }
+};
+
+DeviceCapture::DeviceCapture(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks, DeviceBase& device)
+    : DeviceBase(callbacks, allocationCallbacks)
+    , m_Impl(*(Device*)&device) {
+}
+
+DeviceCapture::~DeviceCapture() {
+    {
+        ExclusiveScope lock(g_captureLock);
+
+        if (g_deviceCapture == this)
+            g_deviceCapture = nullptr;
+
+        const auto& allocationCallbacks = GetAllocationCallbacks();
+        while (m_Chunks) {
+            CaptureChunk* chunk = m_Chunks;
+            m_Chunks = chunk->next;
+
+            if (m_File)
+                Flush(*chunk);
+
+            allocationCallbacks.Free(allocationCallbacks.userArg, chunk->data);
+            allocationCallbacks.Free(allocationCallbacks.userArg, chunk);
+        }
+    }
+
+    if (m_File && fclose(m_File) != 0)
+        NRI_REPORT_ERROR(this, "Failed to finalize the capture file");
+
+    ((DeviceBase*)&m_Impl)->Destruct();
+}
+
+bool DeviceCapture::Create(const DeviceCreationDesc& desc) {
+    const DeviceBase& deviceBaseImpl = (DeviceBase&)m_Impl;
+
+    Result result = deviceBaseImpl.FillFunctionTable(m_iCoreImpl);
+    NRI_RETURN_ON_FAILURE(this, result == Result::SUCCESS, false, "Failed to get 'CoreInterface' interface");
+
+    result = deviceBaseImpl.FillFunctionTable(m_iHelperImpl);
+    NRI_RETURN_ON_FAILURE(this, result == Result::SUCCESS, false, "Failed to get 'HelperInterface' interface");
+
+    m_IsExtSupported.lowLatency = deviceBaseImpl.FillFunctionTable(m_iLowLatencyImpl) == Result::SUCCESS;
+    m_IsExtSupported.meshShader = deviceBaseImpl.FillFunctionTable(m_iMeshShaderImpl) == Result::SUCCESS;
+    m_IsExtSupported.rayTracing = deviceBaseImpl.FillFunctionTable(m_iRayTracingImpl) == Result::SUCCESS;
+    m_IsExtSupported.swapChain = deviceBaseImpl.FillFunctionTable(m_iSwapChainImpl) == Result::SUCCESS;
+
+    { // Extensions implemented on top of "CoreInterface" are re-implemented on top of the capture layer
+        StreamerInterface streamerInterface = {};
+        m_IsExtSupported.streamer = deviceBaseImpl.FillFunctionTable(streamerInterface) == Result::SUCCESS;
+
+        UpscalerInterface upscalerInterface = {};
+        m_IsExtSupported.upscaler = deviceBaseImpl.FillFunctionTable(upscalerInterface) == Result::SUCCESS;
+
+#if NRI_ENABLE_IMGUI_EXTENSION
+        ImguiInterface imguiInterface = {};
+        m_IsExtSupported.imgui = deviceBaseImpl.FillFunctionTable(imguiInterface) == Result::SUCCESS;
+#endif
+    }
+
+    result = FillFunctionTable(m_iCore);
+    NRI_RETURN_ON_FAILURE(this, result == Result::SUCCESS, false, "Failed to get 'CoreInterface' interface");
+
+    {
+        ExclusiveScope lock(g_captureLock);
+        NRI_RETURN_ON_FAILURE(this, g_deviceCapture == nullptr, false, "Only one device can be captured at a time");
+
+        g_deviceCapture = this;
+        m_Session = ++g_captureSessionCounter;
+    }
+
+    m_File = fopen(desc.captureFileName, "wb");
+    NRI_RETURN_ON_FAILURE(this, m_File != nullptr, false, "Can't open '%s' for writing", desc.captureFileName);
+
+    CaptureFileHeader header = {};
+    header.magic = CAPTURE_MAGIC;
+    header.version = CAPTURE_VERSION;
+    header.nriVersion = NRI_VERSION;
+    header.device = (uint64_t)(size_t)this;
+    header.graphicsAPI = desc.graphicsAPI;
+
+    if (desc.queueFamilyNum) {
+        for (uint32_t i = 0; i < desc.queueFamilyNum; i++)
+            header.queueNum[(size_t)desc.queueFamilies[i].queueType] += desc.queueFamilies[i].queueNum;
+    } else
+        header.queueNum[(size_t)QueueType::GRAPHICS] = 1;
+
+    NRI_RETURN_ON_FAILURE(this, fwrite(&header, sizeof(header), 1, m_File) == 1, false, "Failed to write to '%s'", desc.captureFileName);
+
+    return true;
+}
+
+void DeviceCapture::Destruct() {
+    Destroy(GetAllocationCallbacks(), this);
+}
+
+CaptureChunk* DeviceCapture::AcquireChunk() {
+    static thread_local CaptureThreadContext context;
+    MaybeUnused(context);
+
+    ExclusiveScope lock(g_captureLock);
+
+    for (CaptureChunk* chunk = m_Chunks; chunk; chunk = chunk->next) {
+        if (!chunk->isOwned) {
+            chunk->isOwned = true;
+            return chunk;
+        }
+    }
+
+    const auto& allocationCallbacks = GetAllocationCallbacks();
+
+    CaptureChunk* chunk = (CaptureChunk*)allocationCallbacks.Allocate(allocationCallbacks.userArg, sizeof(CaptureChunk), alignof(CaptureChunk));
+    if (!chunk)
+        return nullptr;
+
+    chunk->data = (uint8_t*)allocationCallbacks.Allocate(allocationCallbacks.userArg, CAPTURE_CHUNK_SIZE, sizeof(uint64_t));
+    if (!chunk->data) {
+        allocationCallbacks.Free(allocationCallbacks.userArg, chunk);
+        return nullptr;
+    }
+
+    chunk->size = CAPTURE_CHUNK_SIZE;
+    chunk->used = 0;
+    chunk->isOwned = true;
+    chunk->next = m_Chunks;
+    m_Chunks = chunk;
+
+    return chunk;
+}
+
+void DeviceCapture::Flush(CaptureChunk& chunk) {
+    if (!chunk.used)
+        return;
+
+    ExclusiveScope lock(m_FileLock);
+
+    if (fwrite(chunk.data, chunk.used, 1, m_File) != 1)
+        NRI_REPORT_ERROR(this, "Failed to write to the capture file");
+
+    chunk.used = 0;
+}
+
+uint8_t* DeviceCapture::Reserve(size_t size) {
+    // Rare path: first record on this thread in this session
+    if (t_captureSession != m_Session || !t_captureChunk) {
+        t_captureChunk = AcquireChunk();
+        t_captureSession = m_Session;
+
+        if (!t_captureChunk) {
+            NRI_REPORT_ERROR(this, "Failed to allocate a capture chunk");
+            return nullptr;
+        }
+    }
+
+    CaptureChunk& chunk = *t_captureChunk;
+    if (chunk.used + size > chunk.size) {
+        Flush(chunk);
+
+        // Rare path: a huge record (for example, shader bytecode)
+        if (size > chunk.size) {
+            const auto& allocationCallbacks = GetAllocationCallbacks();
+
+            uint8_t* data = (uint8_t*)allocationCallbacks.Allocate(allocationCallbacks.userArg, size, sizeof(uint64_t));
+            if (!data) {
+                NRI_REPORT_ERROR(this, "Failed to allocate %" PRIu64 " bytes for a capture record", (uint64_t)size);
+                return nullptr;
+            }
+
+            allocationCallbacks.Free(allocationCallbacks.userArg, chunk.data);
+            chunk.data = data;
+            chunk.size = size;
+        }
+    }
+
+    uint8_t* dst = chunk.data + chunk.used;
+    chunk.used += size;
+
+    return dst;
+}
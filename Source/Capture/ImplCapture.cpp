@@ -0,0 +1,1976 @@
+// © 2021 NVIDIA Corporation
+
+#include "SharedExternal.h"
+
+#include "CaptureStream.h"
+#include "DeviceCapture.h"
+
+#include "HelperInterface.h"
+#include "ImguiInterface.h"
+#include "StreamerInterface.h"
+#include "UpscalerInterface.h"
+
+using namespace nri;
+
+#include "DeviceCapture.hpp"
+
+DeviceBase* CreateDeviceCapture(const DeviceCreationDesc& desc, DeviceBase& device) {
+    DeviceCapture* deviceCapture = Allocate<DeviceCapture>(desc.allocationCallbacks, desc.callbackInterface, desc.allocationCallbacks, device);
+
+    if (!deviceCapture->Create(desc)) {
+        Destroy(desc.allocationCallbacks, deviceCapture);
+        return nullptr;
+    }
+
+    return deviceCapture;
+}
+
+// Functions without a "Device" argument use the global capture session
+static inline DeviceCapture& GetDeviceCapture() {
+    return *g_deviceCapture;
+}
+
+// Output handles are stored as plain values, the replay tool maps them to newly created objects
+static inline uint64_t AsId(const void* handle) {
+    return (uint64_t)(size_t)handle;
+}
+
+//============================================================================================================================================================================================
+#pragma region[  Core  ]
+
+static const DeviceDesc& NRI_CALL GetDeviceDesc(const Device& device) {
+    return ((DeviceCapture&)device).GetDesc();
+}
+
+static const BufferDesc& NRI_CALL GetBufferDesc(const Buffer& buffer) {
+    return GetDeviceCapture().GetCoreInterfaceImpl().GetBufferDesc(buffer);
+}
+
+static const TextureDesc& NRI_CALL GetTextureDesc(const Texture& texture) {
+    return GetDeviceCapture().GetCoreInterfaceImpl().GetTextureDesc(texture);
+}
+
+static FormatSupportBits NRI_CALL GetFormatSupport(const Device& device, Format format) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    return deviceCapture.GetCoreInterfaceImpl().GetFormatSupport(deviceCapture.GetImpl(), format);
+}
+
+static Result NRI_CALL GetQueue(Device& device, QueueType queueType, uint32_t queueIndex, Queue*& queue) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().GetQueue(deviceCapture.GetImpl(), queueType, queueIndex, queue);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::GetQueue, &device, queueType, queueIndex, AsId(queue));
+
+    return result;
+}
+
+static Result NRI_CALL CreateCommandAllocator(Queue& queue, CommandAllocator*& commandAllocator) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateCommandAllocator(queue, commandAllocator);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateCommandAllocator, &queue, AsId(commandAllocator));
+
+    return result;
+}
+
+static Result NRI_CALL CreateCommandBuffer(CommandAllocator& commandAllocator, CommandBuffer*& commandBuffer) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateCommandBuffer(commandAllocator, commandBuffer);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateCommandBuffer, &commandAllocator, AsId(commandBuffer));
+
+    return result;
+}
+
+static Result NRI_CALL CreateFence(Device& device, uint64_t initialValue, Fence*& fence) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateFence(deviceCapture.GetImpl(), initialValue, fence);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateFence, &device, initialValue, AsId(fence));
+
+    return result;
+}
+
+static Result NRI_CALL CreateDescriptorPool(Device& device, const DescriptorPoolDesc& descriptorPoolDesc, DescriptorPool*& descriptorPool) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateDescriptorPool(deviceCapture.GetImpl(), descriptorPoolDesc, descriptorPool);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateDescriptorPool, &device, descriptorPoolDesc, AsId(descriptorPool));
+
+    return result;
+}
+
+static Result NRI_CALL CreatePipelineLayout(Device& device, const PipelineLayoutDesc& pipelineLayoutDesc, PipelineLayout*& pipelineLayout) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreatePipelineLayout(deviceCapture.GetImpl(), pipelineLayoutDesc, pipelineLayout);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreatePipelineLayout, &device, pipelineLayoutDesc, AsId(pipelineLayout));
+
+    return result;
+}
+
+static Result NRI_CALL CreateGraphicsPipeline(Device& device, const GraphicsPipelineDesc& graphicsPipelineDesc, Pipeline*& pipeline) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateGraphicsPipeline(deviceCapture.GetImpl(), graphicsPipelineDesc, pipeline);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateGraphicsPipeline, &device, graphicsPipelineDesc, AsId(pipeline));
+
+    return result;
+}
+
+static Result NRI_CALL CreateComputePipeline(Device& device, const ComputePipelineDesc& computePipelineDesc, Pipeline*& pipeline) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateComputePipeline(deviceCapture.GetImpl(), computePipelineDesc, pipeline);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateComputePipeline, &device, computePipelineDesc, AsId(pipeline));
+
+    return result;
+}
+
+static Result NRI_CALL CreatePipelineCache(Device& device, const PipelineCacheDesc& pipelineCacheDesc, PipelineCache*& pipelineCache) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreatePipelineCache(deviceCapture.GetImpl(), pipelineCacheDesc, pipelineCache);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreatePipelineCache, &device, pipelineCacheDesc, AsId(pipelineCache));
+
+    return result;
+}
+
+static Result NRI_CALL CreateQueryPool(Device& device, const QueryPoolDesc& queryPoolDesc, QueryPool*& queryPool) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateQueryPool(deviceCapture.GetImpl(), queryPoolDesc, queryPool);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateQueryPool, &device, queryPoolDesc, AsId(queryPool));
+
+    return result;
+}
+
+static Result NRI_CALL CreateSampler(Device& device, const SamplerDesc& samplerDesc, Descriptor*& sampler) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateSampler(deviceCapture.GetImpl(), samplerDesc, sampler);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateSampler, &device, samplerDesc, AsId(sampler));
+
+    return result;
+}
+
+static Result NRI_CALL CreateBufferView(const BufferViewDesc& bufferViewDesc, Descriptor*& bufferView) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateBufferView(bufferViewDesc, bufferView);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateBufferView, bufferViewDesc, AsId(bufferView));
+
+    return result;
+}
+
+static Result NRI_CALL CreateTextureView(const TextureViewDesc& textureViewDesc, Descriptor*& textureView) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateTextureView(textureViewDesc, textureView);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateTextureView, textureViewDesc, AsId(textureView));
+
+    return result;
+}
+
+static void NRI_CALL DestroyCommandAllocator(CommandAllocator* commandAllocator) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (commandAllocator)
+        deviceCapture.Record(CaptureOp::DestroyCommandAllocator, commandAllocator);
+
+    deviceCapture.GetCoreInterfaceImpl().DestroyCommandAllocator(commandAllocator);
+}
+
+static void NRI_CALL DestroyCommandBuffer(CommandBuffer* commandBuffer) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (commandBuffer)
+        deviceCapture.Record(CaptureOp::DestroyCommandBuffer, commandBuffer);
+
+    deviceCapture.GetCoreInterfaceImpl().DestroyCommandBuffer(commandBuffer);
+}
+
+static void NRI_CALL DestroyDescriptorPool(DescriptorPool* descriptorPool) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (descriptorPool)
+        deviceCapture.Record(CaptureOp::DestroyDescriptorPool, descriptorPool);
+
+    deviceCapture.GetCoreInterfaceImpl().DestroyDescriptorPool(descriptorPool);
+}
+
+static void NRI_CALL DestroyBuffer(Buffer* buffer) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (buffer)
+        deviceCapture.Record(CaptureOp::DestroyBuffer, buffer);
+
+    deviceCapture.GetCoreInterfaceImpl().DestroyBuffer(buffer);
+}
+
+static void NRI_CALL DestroyTexture(Texture* texture) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (texture)
+        deviceCapture.Record(CaptureOp::DestroyTexture, texture);
+
+    deviceCapture.GetCoreInterfaceImpl().DestroyTexture(texture);
+}
+
+static void NRI_CALL DestroyDescriptor(Descriptor* descriptor) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (descriptor)
+        deviceCapture.Record(CaptureOp::DestroyDescriptor, descriptor);
+
+    deviceCapture.GetCoreInterfaceImpl().DestroyDescriptor(descriptor);
+}
+
+static void NRI_CALL DestroyPipelineLayout(PipelineLayout* pipelineLayout) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (pipelineLayout)
+        deviceCapture.Record(CaptureOp::DestroyPipelineLayout, pipelineLayout);
+
+    deviceCapture.GetCoreInterfaceImpl().DestroyPipelineLayout(pipelineLayout);
+}
+
+static void NRI_CALL DestroyPipeline(Pipeline* pipeline) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (pipeline)
+        deviceCapture.Record(CaptureOp::DestroyPipeline, pipeline);
+
+    deviceCapture.GetCoreInterfaceImpl().DestroyPipeline(pipeline);
+}
+
+static void NRI_CALL DestroyPipelineCache(PipelineCache* pipelineCache) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (pipelineCache)
+        deviceCapture.Record(CaptureOp::DestroyPipelineCache, pipelineCache);
+
+    deviceCapture.GetCoreInterfaceImpl().DestroyPipelineCache(pipelineCache);
+}
+
+static void NRI_CALL DestroyQueryPool(QueryPool* queryPool) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (queryPool)
+        deviceCapture.Record(CaptureOp::DestroyQueryPool, queryPool);
+
+    deviceCapture.GetCoreInterfaceImpl().DestroyQueryPool(queryPool);
+}
+
+static void NRI_CALL DestroyFence(Fence* fence) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (fence)
+        deviceCapture.Record(CaptureOp::DestroyFence, fence);
+
+    deviceCapture.GetCoreInterfaceImpl().DestroyFence(fence);
+}
+
+static Result NRI_CALL AllocateMemory(Device& device, const AllocateMemoryDesc& allocateMemoryDesc, Memory*& memory) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().AllocateMemory(deviceCapture.GetImpl(), allocateMemoryDesc, memory);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::AllocateMemory, &device, allocateMemoryDesc, AsId(memory));
+
+    return result;
+}
+
+static void NRI_CALL FreeMemory(Memory* memory) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (memory)
+        deviceCapture.Record(CaptureOp::FreeMemory, memory);
+
+    deviceCapture.GetCoreInterfaceImpl().FreeMemory(memory);
+}
+
+static Result NRI_CALL CreateBuffer(Device& device, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateBuffer(deviceCapture.GetImpl(), bufferDesc, buffer);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateBuffer, &device, bufferDesc, AsId(buffer));
+
+    return result;
+}
+
+static Result NRI_CALL CreateTexture(Device& device, const TextureDesc& textureDesc, Texture*& texture) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateTexture(deviceCapture.GetImpl(), textureDesc, texture);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateTexture, &device, textureDesc, AsId(texture));
+
+    return result;
+}
+
+// Memory requirements are captured with results to remap memory types on replay
+static void NRI_CALL GetBufferMemoryDesc(const Buffer& buffer, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.GetCoreInterfaceImpl().GetBufferMemoryDesc(buffer, memoryLocation, memoryDesc);
+    deviceCapture.Record(CaptureOp::GetBufferMemoryDesc, &buffer, memoryLocation, memoryDesc);
+}
+
+static void NRI_CALL GetTextureMemoryDesc(const Texture& texture, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.GetCoreInterfaceImpl().GetTextureMemoryDesc(texture, memoryLocation, memoryDesc);
+    deviceCapture.Record(CaptureOp::GetTextureMemoryDesc, &texture, memoryLocation, memoryDesc);
+}
+
+static Result NRI_CALL BindBufferMemory(const BindBufferMemoryDesc* bindBufferMemoryDescs, uint32_t bindBufferMemoryDescNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::BindBufferMemory, CaptureArray<const BindBufferMemoryDesc>{bindBufferMemoryDescs, bindBufferMemoryDescNum});
+
+    return deviceCapture.GetCoreInterfaceImpl().BindBufferMemory(bindBufferMemoryDescs, bindBufferMemoryDescNum);
+}
+
+static Result NRI_CALL BindTextureMemory(const BindTextureMemoryDesc* bindTextureMemoryDescs, uint32_t bindTextureMemoryDescNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::BindTextureMemory, CaptureArray<const BindTextureMemoryDesc>{bindTextureMemoryDescs, bindTextureMemoryDescNum});
+
+    return deviceCapture.GetCoreInterfaceImpl().BindTextureMemory(bindTextureMemoryDescs, bindTextureMemoryDescNum);
+}
+
+static void NRI_CALL GetBufferMemoryDesc2(const Device& device, const BufferDesc& bufferDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    deviceCapture.GetCoreInterfaceImpl().GetBufferMemoryDesc2(deviceCapture.GetImpl(), bufferDesc, memoryLocation, memoryDesc);
+    deviceCapture.Record(CaptureOp::GetBufferMemoryDesc2, &device, bufferDesc, memoryLocation, memoryDesc);
+}
+
+static void NRI_CALL GetTextureMemoryDesc2(const Device& device, const TextureDesc& textureDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    deviceCapture.GetCoreInterfaceImpl().GetTextureMemoryDesc2(deviceCapture.GetImpl(), textureDesc, memoryLocation, memoryDesc);
+    deviceCapture.Record(CaptureOp::GetTextureMemoryDesc2, &device, textureDesc, memoryLocation, memoryDesc);
+}
+
+static Result NRI_CALL CreateCommittedBuffer(Device& device, MemoryLocation memoryLocation, float priority, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateCommittedBuffer(deviceCapture.GetImpl(), memoryLocation, priority, bufferDesc, buffer);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateCommittedBuffer, &device, memoryLocation, priority, bufferDesc, AsId(buffer));
+
+    return result;
+}
+
+static Result NRI_CALL CreateCommittedTexture(Device& device, MemoryLocation memoryLocation, float priority, const TextureDesc& textureDesc, Texture*& texture) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreateCommittedTexture(deviceCapture.GetImpl(), memoryLocation, priority, textureDesc, texture);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateCommittedTexture, &device, memoryLocation, priority, textureDesc, AsId(texture));
+
+    return result;
+}
+
+static Result NRI_CALL CreatePlacedBuffer(Device& device, Memory* memory, uint64_t offset, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreatePlacedBuffer(deviceCapture.GetImpl(), memory, offset, bufferDesc, buffer);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreatePlacedBuffer, &device, memory, offset, bufferDesc, AsId(buffer));
+
+    return result;
+}
+
+static Result NRI_CALL CreatePlacedTexture(Device& device, Memory* memory, uint64_t offset, const TextureDesc& textureDesc, Texture*& texture) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().CreatePlacedTexture(deviceCapture.GetImpl(), memory, offset, textureDesc, texture);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreatePlacedTexture, &device, memory, offset, textureDesc, AsId(texture));
+
+    return result;
+}
+
+static Result NRI_CALL AllocateDescriptorSets(DescriptorPool& descriptorPool, const PipelineLayout& pipelineLayout, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    Result result = deviceCapture.GetCoreInterfaceImpl().AllocateDescriptorSets(descriptorPool, pipelineLayout, setIndex, descriptorSets, instanceNum, variableDescriptorNum);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::AllocateDescriptorSets, &descriptorPool, &pipelineLayout, setIndex, CaptureArray<uint64_t>{(uint64_t*)descriptorSets, instanceNum}, variableDescriptorNum);
+
+    return result;
+}
+
+static void NRI_CALL UpdateDescriptorRanges(const UpdateDescriptorRangeDesc* updateDescriptorRangeDescs, uint32_t updateDescriptorRangeDescNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::UpdateDescriptorRanges, CaptureArray<const UpdateDescriptorRangeDesc>{updateDescriptorRangeDescs, updateDescriptorRangeDescNum});
+    deviceCapture.GetCoreInterfaceImpl().UpdateDescriptorRanges(updateDescriptorRangeDescs, updateDescriptorRangeDescNum);
+}
+
+static void NRI_CALL CopyDescriptorRanges(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CopyDescriptorRanges, CaptureArray<const CopyDescriptorRangeDesc>{copyDescriptorRangeDescs, copyDescriptorRangeDescNum});
+    deviceCapture.GetCoreInterfaceImpl().CopyDescriptorRanges(copyDescriptorRangeDescs, copyDescriptorRangeDescNum);
+}
+
+static void NRI_CALL ResetDescriptorPool(DescriptorPool& descriptorPool) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::ResetDescriptorPool, &descriptorPool);
+    deviceCapture.GetCoreInterfaceImpl().ResetDescriptorPool(descriptorPool);
+}
+
+static void NRI_CALL GetDescriptorSetOffsets(const DescriptorSet& descriptorSet, uint32_t& resourceHeapOffset, uint32_t& samplerHeapOffset) {
+    GetDeviceCapture().GetCoreInterfaceImpl().GetDescriptorSetOffsets(descriptorSet, resourceHeapOffset, samplerHeapOffset);
+}
+
+static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::BeginCommandBuffer, &commandBuffer, descriptorPool);
+
+    return deviceCapture.GetCoreInterfaceImpl().BeginCommandBuffer(commandBuffer, descriptorPool);
+}
+
+static void NRI_CALL CmdSetDescriptorPool(CommandBuffer& commandBuffer, const DescriptorPool& descriptorPool) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetDescriptorPool, &commandBuffer, &descriptorPool);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetDescriptorPool(commandBuffer, descriptorPool);
+}
+
+static void NRI_CALL CmdSetPipelineLayout(CommandBuffer& commandBuffer, BindPoint bindPoint, const PipelineLayout& pipelineLayout) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetPipelineLayout, &commandBuffer, bindPoint, &pipelineLayout);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetPipelineLayout(commandBuffer, bindPoint, pipelineLayout);
+}
+
+static void NRI_CALL CmdSetDescriptorSet(CommandBuffer& commandBuffer, const SetDescriptorSetDesc& setDescriptorSetDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetDescriptorSet, &commandBuffer, setDescriptorSetDesc);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetDescriptorSet(commandBuffer, setDescriptorSetDesc);
+}
+
+static void NRI_CALL CmdSetRootConstants(CommandBuffer& commandBuffer, const SetRootConstantsDesc& setRootConstantsDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetRootConstants, &commandBuffer, setRootConstantsDesc);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetRootConstants(commandBuffer, setRootConstantsDesc);
+}
+
+static void NRI_CALL CmdSetRootDescriptor(CommandBuffer& commandBuffer, const SetRootDescriptorDesc& setRootDescriptorDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetRootDescriptor, &commandBuffer, setRootDescriptorDesc);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetRootDescriptor(commandBuffer, setRootDescriptorDesc);
+}
+
+static void NRI_CALL CmdSetPipeline(CommandBuffer& commandBuffer, const Pipeline& pipeline) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetPipeline, &commandBuffer, &pipeline);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetPipeline(commandBuffer, pipeline);
+}
+
+static void NRI_CALL CmdBarrier(CommandBuffer& commandBuffer, const BarrierDesc& barrierDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdBarrier, &commandBuffer, barrierDesc);
+    deviceCapture.GetCoreInterfaceImpl().CmdBarrier(commandBuffer, barrierDesc);
+}
+
+static void NRI_CALL CmdSetIndexBuffer(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, IndexType indexType) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetIndexBuffer, &commandBuffer, &buffer, offset, indexType);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetIndexBuffer(commandBuffer, buffer, offset, indexType);
+}
+
+static void NRI_CALL CmdSetVertexBuffers(CommandBuffer& commandBuffer, uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetVertexBuffers, &commandBuffer, baseSlot, CaptureArray<const VertexBufferDesc>{vertexBufferDescs, vertexBufferNum});
+    deviceCapture.GetCoreInterfaceImpl().CmdSetVertexBuffers(commandBuffer, baseSlot, vertexBufferDescs, vertexBufferNum);
+}
+
+static void NRI_CALL CmdSetViewports(CommandBuffer& commandBuffer, const Viewport* viewports, uint32_t viewportNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetViewports, &commandBuffer, CaptureArray<const Viewport>{viewports, viewportNum});
+    deviceCapture.GetCoreInterfaceImpl().CmdSetViewports(commandBuffer, viewports, viewportNum);
+}
+
+static void NRI_CALL CmdSetScissors(CommandBuffer& commandBuffer, const Rect* rects, uint32_t rectNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetScissors, &commandBuffer, CaptureArray<const Rect>{rects, rectNum});
+    deviceCapture.GetCoreInterfaceImpl().CmdSetScissors(commandBuffer, rects, rectNum);
+}
+
+static void NRI_CALL CmdSetStencilReference(CommandBuffer& commandBuffer, uint8_t frontRef, uint8_t backRef) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetStencilReference, &commandBuffer, frontRef, backRef);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetStencilReference(commandBuffer, frontRef, backRef);
+}
+
+static void NRI_CALL CmdSetDepthBounds(CommandBuffer& commandBuffer, float boundsMin, float boundsMax) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetDepthBounds, &commandBuffer, boundsMin, boundsMax);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetDepthBounds(commandBuffer, boundsMin, boundsMax);
+}
+
+static void NRI_CALL CmdSetBlendConstants(CommandBuffer& commandBuffer, const Color32f& color) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetBlendConstants, &commandBuffer, color);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetBlendConstants(commandBuffer, color);
+}
+
+static void NRI_CALL CmdSetSampleLocations(CommandBuffer& commandBuffer, const SampleLocation* locations, Sample_t locationNum, Sample_t sampleNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetSampleLocations, &commandBuffer, CaptureArray<const SampleLocation>{locations, locationNum}, sampleNum);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetSampleLocations(commandBuffer, locations, locationNum, sampleNum);
+}
+
+static void NRI_CALL CmdSetShadingRate(CommandBuffer& commandBuffer, const ShadingRateDesc& shadingRateDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetShadingRate, &commandBuffer, shadingRateDesc);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetShadingRate(commandBuffer, shadingRateDesc);
+}
+
+static void NRI_CALL CmdSetDepthBias(CommandBuffer& commandBuffer, const DepthBiasDesc& depthBiasDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetDepthBias, &commandBuffer, depthBiasDesc);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetDepthBias(commandBuffer, depthBiasDesc);
+}
+
+static void NRI_CALL CmdSetTopology(CommandBuffer& commandBuffer, Topology topology, PrimitiveRestart primitiveRestart) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetTopology, &commandBuffer, topology, primitiveRestart);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetTopology(commandBuffer, topology, primitiveRestart);
+}
+
+static void NRI_CALL CmdSetCullMode(CommandBuffer& commandBuffer, CullMode cullMode) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetCullMode, &commandBuffer, cullMode);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetCullMode(commandBuffer, cullMode);
+}
+
+static void NRI_CALL CmdSetFrontFace(CommandBuffer& commandBuffer, bool frontCounterClockwise) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetFrontFace, &commandBuffer, frontCounterClockwise);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetFrontFace(commandBuffer, frontCounterClockwise);
+}
+
+static void NRI_CALL CmdSetDepthState(CommandBuffer& commandBuffer, const DepthAttachmentDesc& depth) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetDepthState, &commandBuffer, depth);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetDepthState(commandBuffer, depth);
+}
+
+static void NRI_CALL CmdSetStencilState(CommandBuffer& commandBuffer, const StencilAttachmentDesc& stencil) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetStencilState, &commandBuffer, stencil);
+    deviceCapture.GetCoreInterfaceImpl().CmdSetStencilState(commandBuffer, stencil);
+}
+
+static void NRI_CALL CmdSetColorState(CommandBuffer& commandBuffer, uint32_t baseAttachment, const ColorAttachmentDesc* colors, uint32_t colorNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdSetColorState, &commandBuffer, baseAttachment, CaptureArray<const ColorAttachmentDesc>{colors, colorNum});
+    deviceCapture.GetCoreInterfaceImpl().CmdSetColorState(commandBuffer, baseAttachment, colors, colorNum);
+}
+
+static void NRI_CALL CmdBeginRendering(CommandBuffer& commandBuffer, const RenderingDesc& renderingDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdBeginRendering, &commandBuffer, renderingDesc);
+    deviceCapture.GetCoreInterfaceImpl().CmdBeginRendering(commandBuffer, renderingDesc);
+}
+
+static void NRI_CALL CmdClearAttachments(CommandBuffer& commandBuffer, const ClearAttachmentDesc* clearAttachmentDescs, uint32_t clearAttachmentDescNum, const Rect* rects, uint32_t rectNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdClearAttachments, &commandBuffer, CaptureArray<const ClearAttachmentDesc>{clearAttachmentDescs, clearAttachmentDescNum}, CaptureArray<const Rect>{rects, rectNum});
+    deviceCapture.GetCoreInterfaceImpl().CmdClearAttachments(commandBuffer, clearAttachmentDescs, clearAttachmentDescNum, rects, rectNum);
+}
+
+static void NRI_CALL CmdDraw(CommandBuffer& commandBuffer, const DrawDesc& drawDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdDraw, &commandBuffer, drawDesc);
+    deviceCapture.GetCoreInterfaceImpl().CmdDraw(commandBuffer, drawDesc);
+}
+
+static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawIndexedDesc& drawIndexedDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdDrawIndexed, &commandBuffer, drawIndexedDesc);
+    deviceCapture.GetCoreInterfaceImpl().CmdDrawIndexed(commandBuffer, drawIndexedDesc);
+}
+
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    // Recorded tightly packed
+    Scratch<DrawDesc> packedDescs = NRI_ALLOCATE_SCRATCH(deviceCapture, DrawDesc, drawNum);
+    for (uint32_t i = 0; i < drawNum; i++)
+        packedDescs[i] = *(DrawDesc*)((uint8_t*)drawDescs + (size_t)i * stride);
+
+    deviceCapture.Record(CaptureOp::CmdDrawMulti, &commandBuffer, CaptureArray<const DrawDesc>{packedDescs, drawNum});
+    deviceCapture.GetCoreInterfaceImpl().CmdDrawMulti(commandBuffer, drawDescs, drawNum, stride);
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    // Recorded tightly packed
+    Scratch<DrawIndexedDesc> packedDescs = NRI_ALLOCATE_SCRATCH(deviceCapture, DrawIndexedDesc, drawNum);
+    for (uint32_t i = 0; i < drawNum; i++)
+        packedDescs[i] = *(DrawIndexedDesc*)((uint8_t*)drawIndexedDescs + (size_t)i * stride);
+
+    deviceCapture.Record(CaptureOp::CmdDrawIndexedMulti, &commandBuffer, CaptureArray<const DrawIndexedDesc>{packedDescs, drawNum});
+    deviceCapture.GetCoreInterfaceImpl().CmdDrawIndexedMulti(commandBuffer, drawIndexedDescs, drawNum, stride);
+}
+
+static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdDrawIndirect, &commandBuffer, &buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
+    deviceCapture.GetCoreInterfaceImpl().CmdDrawIndirect(commandBuffer, buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
+}
+
+static void NRI_CALL CmdDrawIndexedIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdDrawIndexedIndirect, &commandBuffer, &buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
+    deviceCapture.GetCoreInterfaceImpl().CmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
+}
+
+static void NRI_CALL CmdEndRendering(CommandBuffer& commandBuffer) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdEndRendering, &commandBuffer);
+    deviceCapture.GetCoreInterfaceImpl().CmdEndRendering(commandBuffer);
+}
+
+static void NRI_CALL CmdDispatch(CommandBuffer& commandBuffer, const DispatchDesc& dispatchDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdDispatch, &commandBuffer, dispatchDesc);
+    deviceCapture.GetCoreInterfaceImpl().CmdDispatch(commandBuffer, dispatchDesc);
+}
+
+static void NRI_CALL CmdDispatchIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdDispatchIndirect, &commandBuffer, &buffer, offset);
+    deviceCapture.GetCoreInterfaceImpl().CmdDispatchIndirect(commandBuffer, buffer, offset);
+}
+
+static void NRI_CALL CmdCopyBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdCopyBuffer, &commandBuffer, &dstBuffer, dstOffset, &srcBuffer, srcOffset, size);
+    deviceCapture.GetCoreInterfaceImpl().CmdCopyBuffer(commandBuffer, dstBuffer, dstOffset, srcBuffer, srcOffset, size);
+}
+
+static void NRI_CALL CmdCopyTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdCopyTexture, &commandBuffer, &dstTexture, CaptureArray<const TextureRegionDesc>{dstRegion, 1}, &srcTexture, CaptureArray<const TextureRegionDesc>{srcRegion, 1});
+    deviceCapture.GetCoreInterfaceImpl().CmdCopyTexture(commandBuffer, dstTexture, dstRegion, srcTexture, srcRegion);
+}
+
+static void NRI_CALL CmdUploadBufferToTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdUploadBufferToTexture, &commandBuffer, &dstTexture, dstRegion, &srcBuffer, srcDataLayout);
+    deviceCapture.GetCoreInterfaceImpl().CmdUploadBufferToTexture(commandBuffer, dstTexture, dstRegion, srcBuffer, srcDataLayout);
+}
+
+static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdReadbackTextureToBuffer, &commandBuffer, &dstBuffer, dstDataLayout, &srcTexture, srcRegion);
+    deviceCapture.GetCoreInterfaceImpl().CmdReadbackTextureToBuffer(commandBuffer, dstBuffer, dstDataLayout, srcTexture, srcRegion);
+}
+
+static void NRI_CALL CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdZeroBuffer, &commandBuffer, &buffer, offset, size);
+    deviceCapture.GetCoreInterfaceImpl().CmdZeroBuffer(commandBuffer, buffer, offset, size);
+}
+
+static void NRI_CALL CmdResolveTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion, ResolveOp resolveOp) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdResolveTexture, &commandBuffer, &dstTexture, CaptureArray<const TextureRegionDesc>{dstRegion, 1}, &srcTexture, CaptureArray<const TextureRegionDesc>{srcRegion, 1}, resolveOp);
+    deviceCapture.GetCoreInterfaceImpl().CmdResolveTexture(commandBuffer, dstTexture, dstRegion, srcTexture, srcRegion, resolveOp);
+}
+
+static void NRI_CALL CmdClearStorage(CommandBuffer& commandBuffer, const ClearStorageDesc& clearStorageDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdClearStorage, &commandBuffer, clearStorageDesc);
+    deviceCapture.GetCoreInterfaceImpl().CmdClearStorage(commandBuffer, clearStorageDesc);
+}
+
+static void NRI_CALL CmdResetQueries(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset, uint32_t num) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdResetQueries, &commandBuffer, &queryPool, offset, num);
+    deviceCapture.GetCoreInterfaceImpl().CmdResetQueries(commandBuffer, queryPool, offset, num);
+}
+
+static void NRI_CALL CmdBeginQuery(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdBeginQuery, &commandBuffer, &queryPool, offset);
+    deviceCapture.GetCoreInterfaceImpl().CmdBeginQuery(commandBuffer, queryPool, offset);
+}
+
+static void NRI_CALL CmdEndQuery(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdEndQuery, &commandBuffer, &queryPool, offset);
+    deviceCapture.GetCoreInterfaceImpl().CmdEndQuery(commandBuffer, queryPool, offset);
+}
+
+static void NRI_CALL CmdCopyQueries(CommandBuffer& commandBuffer, const QueryPool& queryPool, uint32_t offset, uint32_t num, Buffer& dstBuffer, uint64_t dstOffset) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdCopyQueries, &commandBuffer, &queryPool, offset, num, &dstBuffer, dstOffset);
+    deviceCapture.GetCoreInterfaceImpl().CmdCopyQueries(commandBuffer, queryPool, offset, num, dstBuffer, dstOffset);
+}
+
+static void NRI_CALL CmdBeginAnnotation(CommandBuffer& commandBuffer, const char* name, uint32_t bgra) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdBeginAnnotation, &commandBuffer, CaptureString{name}, bgra);
+    deviceCapture.GetCoreInterfaceImpl().CmdBeginAnnotation(commandBuffer, name, bgra);
+}
+
+static void NRI_CALL CmdEndAnnotation(CommandBuffer& commandBuffer) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdEndAnnotation, &commandBuffer);
+    deviceCapture.GetCoreInterfaceImpl().CmdEndAnnotation(commandBuffer);
+}
+
+static void NRI_CALL CmdAnnotation(CommandBuffer& commandBuffer, const char* name, uint32_t bgra) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdAnnotation, &commandBuffer, CaptureString{name}, bgra);
+    deviceCapture.GetCoreInterfaceImpl().CmdAnnotation(commandBuffer, name, bgra);
+}
+
+static Result NRI_CALL EndCommandBuffer(CommandBuffer& commandBuffer) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::EndCommandBuffer, &commandBuffer);
+
+    return deviceCapture.GetCoreInterfaceImpl().EndCommandBuffer(commandBuffer);
+}
+
+static void NRI_CALL QueueBeginAnnotation(Queue& queue, const char* name, uint32_t bgra) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::QueueBeginAnnotation, &queue, CaptureString{name}, bgra);
+    deviceCapture.GetCoreInterfaceImpl().QueueBeginAnnotation(queue, name, bgra);
+}
+
+static void NRI_CALL QueueEndAnnotation(Queue& queue) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::QueueEndAnnotation, &queue);
+    deviceCapture.GetCoreInterfaceImpl().QueueEndAnnotation(queue);
+}
+
+static void NRI_CALL QueueAnnotation(Queue& queue, const char* name, uint32_t bgra) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::QueueAnnotation, &queue, CaptureString{name}, bgra);
+    deviceCapture.GetCoreInterfaceImpl().QueueAnnotation(queue, name, bgra);
+}
+
+static void NRI_CALL ResetQueries(QueryPool& queryPool, uint32_t offset, uint32_t num) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::ResetQueries, &queryPool, offset, num);
+    deviceCapture.GetCoreInterfaceImpl().ResetQueries(queryPool, offset, num);
+}
+
+static uint32_t NRI_CALL GetQuerySize(const QueryPool& queryPool) {
+    return GetDeviceCapture().GetCoreInterfaceImpl().GetQuerySize(queryPool);
+}
+
+static void NRI_CALL GetCalibratedTimestamps(Queue& queue, uint64_t& timestampGPU, uint64_t& timestampCPU) {
+    GetDeviceCapture().GetCoreInterfaceImpl().GetCalibratedTimestamps(queue, timestampGPU, timestampCPU);
+}
+
+static Result NRI_CALL QueueSubmit(Queue& queue, const QueueSubmitDesc& queueSubmitDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::QueueSubmit, &queue, queueSubmitDesc);
+
+    return deviceCapture.GetCoreInterfaceImpl().QueueSubmit(queue, queueSubmitDesc);
+}
+
+static Result NRI_CALL QueueWaitIdle(Queue* queue) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (queue)
+        deviceCapture.Record(CaptureOp::QueueWaitIdle, queue);
+
+    return deviceCapture.GetCoreInterfaceImpl().QueueWaitIdle(queue);
+}
+
+static Result NRI_CALL DeviceWaitIdle(Device* device) {
+    if (!device)
+        return Result::SUCCESS;
+
+    DeviceCapture& deviceCapture = *(DeviceCapture*)device;
+    deviceCapture.Record(CaptureOp::DeviceWaitIdle, device);
+
+    return deviceCapture.GetCoreInterfaceImpl().DeviceWaitIdle(&deviceCapture.GetImpl());
+}
+
+static void NRI_CALL Wait(Fence& fence, uint64_t value) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::Wait, &fence, value);
+    deviceCapture.GetCoreInterfaceImpl().Wait(fence, value);
+}
+
+static uint64_t NRI_CALL GetFenceValue(Fence& fence) {
+    return GetDeviceCapture().GetCoreInterfaceImpl().GetFenceValue(fence);
+}
+
+static void NRI_CALL ResetCommandAllocator(CommandAllocator& commandAllocator) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::ResetCommandAllocator, &commandAllocator);
+    deviceCapture.GetCoreInterfaceImpl().ResetCommandAllocator(commandAllocator);
+}
+
+static void* NRI_CALL MapBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::MapBuffer, &buffer, offset, size);
+
+    return deviceCapture.GetCoreInterfaceImpl().MapBuffer(buffer, offset, size);
+}
+
+static void NRI_CALL UnmapBuffer(Buffer& buffer) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::UnmapBuffer, &buffer);
+    deviceCapture.GetCoreInterfaceImpl().UnmapBuffer(buffer);
+}
+
+static Result NRI_CALL UploadHostMemoryToTexture(Queue& queue, const UploadHostMemoryToTextureDesc* copyDescs, uint32_t copyDescNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::UploadHostMemoryToTexture, &queue, CaptureArray<const UploadHostMemoryToTextureDesc>{copyDescs, copyDescNum});
+
+    return deviceCapture.GetCoreInterfaceImpl().UploadHostMemoryToTexture(queue, copyDescs, copyDescNum);
+}
+
+static Result NRI_CALL ReadbackTextureToHostMemory(Queue& queue, const ReadbackTextureToHostMemoryDesc* copyDescs, uint32_t copyDescNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::ReadbackTextureToHostMemory, &queue, CaptureArray<const ReadbackTextureToHostMemoryDesc>{copyDescs, copyDescNum});
+
+    return deviceCapture.GetCoreInterfaceImpl().ReadbackTextureToHostMemory(queue, copyDescs, copyDescNum);
+}
+
+static uint64_t NRI_CALL GetBufferDeviceAddress(const Buffer& buffer) {
+    return GetDeviceCapture().GetCoreInterfaceImpl().GetBufferDeviceAddress(buffer);
+}
+
+static Result NRI_CALL GetPipelineCacheData(PipelineCache& pipelineCache, void* dst, uint64_t& size) {
+    return GetDeviceCapture().GetCoreInterfaceImpl().GetPipelineCacheData(pipelineCache, dst, size);
+}
+
+static void NRI_CALL SetDebugName(Object* object, const char* name) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (!object)
+        return;
+
+    deviceCapture.Record(CaptureOp::SetDebugName, object, CaptureString{name});
+
+    if (object == (Object*)&deviceCapture)
+        deviceCapture.SetDebugName(name);
+    else
+        deviceCapture.GetCoreInterfaceImpl().SetDebugName(object, name);
+}
+
+static void* NRI_CALL GetDeviceNativeObject(const Device* device) {
+    if (!device)
+        return nullptr;
+
+    DeviceCapture& deviceCapture = *(DeviceCapture*)device;
+
+    return deviceCapture.GetCoreInterfaceImpl().GetDeviceNativeObject(&deviceCapture.GetImpl());
+}
+
+static void* NRI_CALL GetQueueNativeObject(const Queue* queue) {
+    return GetDeviceCapture().GetCoreInterfaceImpl().GetQueueNativeObject(queue);
+}
+
+static void* NRI_CALL GetCommandBufferNativeObject(const CommandBuffer* commandBuffer) {
+    return GetDeviceCapture().GetCoreInterfaceImpl().GetCommandBufferNativeObject(commandBuffer);
+}
+
+static uint64_t NRI_CALL GetBufferNativeObject(const Buffer* buffer) {
+    return GetDeviceCapture().GetCoreInterfaceImpl().GetBufferNativeObject(buffer);
+}
+
+static uint64_t NRI_CALL GetTextureNativeObject(const Texture* texture) {
+    return GetDeviceCapture().GetCoreInterfaceImpl().GetTextureNativeObject(texture);
+}
+
+static uint64_t NRI_CALL GetDescriptorNativeObject(const Descriptor* descriptor) {
+    return GetDeviceCapture().GetCoreInterfaceImpl().GetDescriptorNativeObject(descriptor);
+}
+
+Result DeviceCapture::FillFunctionTable(CoreInterface& table) const {
+    table.GetDeviceDesc = ::GetDeviceDesc;
+    table.GetBufferDesc = ::GetBufferDesc;
+    table.GetTextureDesc = ::GetTextureDesc;
+    table.GetFormatSupport = ::GetFormatSupport;
+    table.GetQueue = ::GetQueue;
+    table.CreateCommandAllocator = ::CreateCommandAllocator;
+    table.CreateCommandBuffer = ::CreateCommandBuffer;
+    table.CreateFence = ::CreateFence;
+    table.CreateDescriptorPool = ::CreateDescriptorPool;
+    table.CreatePipelineLayout = ::CreatePipelineLayout;
+    table.CreateGraphicsPipeline = ::CreateGraphicsPipeline;
+    table.CreateComputePipeline = ::CreateComputePipeline;
+    table.CreatePipelineCache = ::CreatePipelineCache;
+    table.CreateQueryPool = ::CreateQueryPool;
+    table.CreateSampler = ::CreateSampler;
+    table.CreateBufferView = ::CreateBufferView;
+    table.CreateTextureView = ::CreateTextureView;
+    table.DestroyCommandAllocator = ::DestroyCommandAllocator;
+    table.DestroyCommandBuffer = ::DestroyCommandBuffer;
+    table.DestroyDescriptorPool = ::DestroyDescriptorPool;
+    table.DestroyBuffer = ::DestroyBuffer;
+    table.DestroyTexture = ::DestroyTexture;
+    table.DestroyDescriptor = ::DestroyDescriptor;
+    table.DestroyPipelineLayout = ::DestroyPipelineLayout;
+    table.DestroyPipeline = ::DestroyPipeline;
+    table.DestroyPipelineCache = ::DestroyPipelineCache;
+    table.DestroyQueryPool = ::DestroyQueryPool;
+    table.DestroyFence = ::DestroyFence;
+    table.AllocateMemory = ::AllocateMemory;
+    table.FreeMemory = ::FreeMemory;
+    table.CreateBuffer = ::CreateBuffer;
+    table.CreateTexture = ::CreateTexture;
+    table.GetBufferMemoryDesc = ::GetBufferMemoryDesc;
+    table.GetTextureMemoryDesc = ::GetTextureMemoryDesc;
+    table.BindBufferMemory = ::BindBufferMemory;
+    table.BindTextureMemory = ::BindTextureMemory;
+    table.GetBufferMemoryDesc2 = ::GetBufferMemoryDesc2;
+    table.GetTextureMemoryDesc2 = ::GetTextureMemoryDesc2;
+    table.CreateCommittedBuffer = ::CreateCommittedBuffer;
+    table.CreateCommittedTexture = ::CreateCommittedTexture;
+    table.CreatePlacedBuffer = ::CreatePlacedBuffer;
+    table.CreatePlacedTexture = ::CreatePlacedTexture;
+    table.AllocateDescriptorSets = ::AllocateDescriptorSets;
+    table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
+    table.CopyDescriptorRanges = ::CopyDescriptorRanges;
+    table.ResetDescriptorPool = ::ResetDescriptorPool;
+    table.GetDescriptorSetOffsets = ::GetDescriptorSetOffsets;
+    table.BeginCommandBuffer = ::BeginCommandBuffer;
+    table.CmdSetDescriptorPool = ::CmdSetDescriptorPool;
+    table.CmdSetPipelineLayout = ::CmdSetPipelineLayout;
+    table.CmdSetDescriptorSet = ::CmdSetDescriptorSet;
+    table.CmdSetRootConstants = ::CmdSetRootConstants;
+    table.CmdSetRootDescriptor = ::CmdSetRootDescriptor;
+    table.CmdSetPipeline = ::CmdSetPipeline;
+    table.CmdBarrier = ::CmdBarrier;
+    table.CmdSetIndexBuffer = ::CmdSetIndexBuffer;
+    table.CmdSetVertexBuffers = ::CmdSetVertexBuffers;
+    table.CmdSetViewports = ::CmdSetViewports;
+    table.CmdSetScissors = ::CmdSetScissors;
+    table.CmdSetStencilReference = ::CmdSetStencilReference;
+    table.CmdSetDepthBounds = ::CmdSetDepthBounds;
+    table.CmdSetBlendConstants = ::CmdSetBlendConstants;
+    table.CmdSetSampleLocations = ::CmdSetSampleLocations;
+    table.CmdSetShadingRate = ::CmdSetShadingRate;
+    table.CmdSetDepthBias = ::CmdSetDepthBias;
+    table.CmdSetTopology = ::CmdSetTopology;
+    table.CmdSetCullMode = ::CmdSetCullMode;
+    table.CmdSetFrontFace = ::CmdSetFrontFace;
+    table.CmdSetDepthState = ::CmdSetDepthState;
+    table.CmdSetStencilState = ::CmdSetStencilState;
+    table.CmdSetColorState = ::CmdSetColorState;
+    table.CmdBeginRendering = ::CmdBeginRendering;
+    table.CmdClearAttachments = ::CmdClearAttachments;
+    table.CmdDraw = ::CmdDraw;
+    table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
+    table.CmdDrawIndirect = ::CmdDrawIndirect;
+    table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
+    table.CmdEndRendering = ::CmdEndRendering;
+    table.CmdDispatch = ::CmdDispatch;
+    table.CmdDispatchIndirect = ::CmdDispatchIndirect;
+    table.CmdCopyBuffer = ::CmdCopyBuffer;
+    table.CmdCopyTexture = ::CmdCopyTexture;
+    table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
+    table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
+    table.CmdZeroBuffer = ::CmdZeroBuffer;
+    table.CmdResolveTexture = ::CmdResolveTexture;
+    table.CmdClearStorage = ::CmdClearStorage;
+    table.CmdResetQueries = ::CmdResetQueries;
+    table.CmdBeginQuery = ::CmdBeginQuery;
+    table.CmdEndQuery = ::CmdEndQuery;
+    table.CmdCopyQueries = ::CmdCopyQueries;
+    table.CmdBeginAnnotation = ::CmdBeginAnnotation;
+    table.CmdEndAnnotation = ::CmdEndAnnotation;
+    table.CmdAnnotation = ::CmdAnnotation;
+    table.EndCommandBuffer = ::EndCommandBuffer;
+    table.QueueBeginAnnotation = ::QueueBeginAnnotation;
+    table.QueueEndAnnotation = ::QueueEndAnnotation;
+    table.QueueAnnotation = ::QueueAnnotation;
+    table.ResetQueries = ::ResetQueries;
+    table.GetQuerySize = ::GetQuerySize;
+    table.GetCalibratedTimestamps = ::GetCalibratedTimestamps;
+    table.QueueSubmit = ::QueueSubmit;
+    table.QueueWaitIdle = ::QueueWaitIdle;
+    table.DeviceWaitIdle = ::DeviceWaitIdle;
+    table.Wait = ::Wait;
+    table.GetFenceValue = ::GetFenceValue;
+    table.ResetCommandAllocator = ::ResetCommandAllocator;
+    table.MapBuffer = ::MapBuffer;
+    table.UnmapBuffer = ::UnmapBuffer;
+    table.UploadHostMemoryToTexture = ::UploadHostMemoryToTexture;
+    table.ReadbackTextureToHostMemory = ::ReadbackTextureToHostMemory;
+    table.GetBufferDeviceAddress = ::GetBufferDeviceAddress;
+    table.GetPipelineCacheData = ::GetPipelineCacheData;
+    table.SetDebugName = ::SetDebugName;
+    table.GetDeviceNativeObject = ::GetDeviceNativeObject;
+    table.GetQueueNativeObject = ::GetQueueNativeObject;
+    table.GetCommandBufferNativeObject = ::GetCommandBufferNativeObject;
+    table.GetBufferNativeObject = ::GetBufferNativeObject;
+    table.GetTextureNativeObject = ::GetTextureNativeObject;
+    table.GetDescriptorNativeObject = ::GetDescriptorNativeObject;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Helper  ]
+
+static uint32_t NRI_CALL CalculateAllocationNumber(const Device& device, const ResourceGroupDesc& resourceGroupDesc) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+    HelperDeviceMemoryAllocator allocator(deviceCapture.GetCoreInterface(), (Device&)device);
+
+    return allocator.CalculateAllocationNumber(resourceGroupDesc);
+}
+
+static Result NRI_CALL AllocateAndBindMemory(Device& device, const ResourceGroupDesc& resourceGroupDesc, Memory** allocations) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+    HelperDeviceMemoryAllocator allocator(deviceCapture.GetCoreInterface(), device);
+
+    return allocator.AllocateAndBindMemory(resourceGroupDesc, allocations);
+}
+
+static Result NRI_CALL UploadData(Queue& queue, const TextureUploadDesc* textureUploadDescs, uint32_t textureUploadDescNum, const BufferUploadDesc* bufferUploadDescs, uint32_t bufferUploadDescNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+    HelperDataUpload helperDataUpload(deviceCapture.GetCoreInterface(), (Device&)deviceCapture, queue);
+
+    return helperDataUpload.UploadData(textureUploadDescs, textureUploadDescNum, bufferUploadDescs, bufferUploadDescNum);
+}
+
+static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation memoryLocation, VideoMemoryInfo& videoMemoryInfo) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    return deviceCapture.GetHelperInterfaceImpl().QueryVideoMemoryInfo(deviceCapture.GetImpl(), memoryLocation, videoMemoryInfo);
+}
+
+static Result NRI_CALL SetMemoryPriority(Memory& memory, float priority) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    return deviceCapture.GetHelperInterfaceImpl().SetMemoryPriority(memory, priority);
+}
+
+static Result NRI_CALL CreateResidencyManager(Device& device, const ResidencyManagerDesc& residencyManagerDesc, ResidencyManager*& residencyManager) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+    HelperResidencyManager* impl = Allocate<HelperResidencyManager>(deviceCapture.GetAllocationCallbacks(), device);
+    Result result = impl->Create(residencyManagerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        residencyManager = nullptr;
+    } else
+        residencyManager = (ResidencyManager*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyResidencyManager(ResidencyManager* residencyManager) {
+    Destroy((HelperResidencyManager*)residencyManager);
+}
+
+static uint32_t NRI_CALL TrackMemory(ResidencyManager& residencyManager, Memory& memory, uint64_t size, float priority) {
+    return ((HelperResidencyManager&)residencyManager).TrackMemory(memory, size, priority);
+}
+
+static void NRI_CALL UntrackMemory(ResidencyManager& residencyManager, uint32_t memoryHandle) {
+    ((HelperResidencyManager&)residencyManager).UntrackMemory(memoryHandle);
+}
+
+static void NRI_CALL MarkMemoryUsed(ResidencyManager& residencyManager, const uint32_t* memoryHandles, uint32_t memoryHandleNum) {
+    ((HelperResidencyManager&)residencyManager).MarkMemoryUsed(memoryHandles, memoryHandleNum);
+}
+
+static Result NRI_CALL UpdateResidency(ResidencyManager& residencyManager, ResidencyStats* residencyStats) {
+    return ((HelperResidencyManager&)residencyManager).UpdateResidency(residencyStats);
+}
+
+static Result NRI_CALL CreateDefragmenter(Queue& queue, const DefragmenterDesc& defragmenterDesc, Defragmenter*& defragmenter) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+    HelperDefragmenter* impl = Allocate<HelperDefragmenter>(deviceCapture.GetAllocationCallbacks(), deviceCapture.GetCoreInterface(), (Device&)deviceCapture, queue);
+    Result result = impl->Create(defragmenterDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        defragmenter = nullptr;
+    } else
+        defragmenter = (Defragmenter*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyDefragmenter(Defragmenter* defragmenter) {
+    Destroy((HelperDefragmenter*)defragmenter);
+}
+
+static uint32_t NRI_CALL PlanDefragmentation(Defragmenter& defragmenter, const DefragmentationDesc& defragmentationDesc) {
+    return ((HelperDefragmenter&)defragmenter).PlanDefragmentation(defragmentationDesc);
+}
+
+static Result NRI_CALL DefragmentStep(Defragmenter& defragmenter, DefragmentationResult& defragmentationResult) {
+    return ((HelperDefragmenter&)defragmenter).DefragmentStep(defragmentationResult);
+}
+
+static Result NRI_CALL MergePipelineCaches(PipelineCache& dstPipelineCache, const PipelineCache* const* srcPipelineCaches, uint32_t srcPipelineCacheNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    return deviceCapture.GetHelperInterfaceImpl().MergePipelineCaches(dstPipelineCache, srcPipelineCaches, srcPipelineCacheNum);
+}
+
+static Result NRI_CALL CreatePipelineCacheStore(Device& device, const PipelineCacheStoreDesc& pipelineCacheStoreDesc, PipelineCacheStore*& pipelineCacheStore) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+    HelperPipelineCacheStore* impl = Allocate<HelperPipelineCacheStore>(deviceCapture.GetAllocationCallbacks(), device);
+    Result result = impl->Create(pipelineCacheStoreDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        pipelineCacheStore = nullptr;
+    } else
+        pipelineCacheStore = (PipelineCacheStore*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyPipelineCacheStore(PipelineCacheStore* pipelineCacheStore) {
+    Destroy((HelperPipelineCacheStore*)pipelineCacheStore);
+}
+
+static PipelineCache* NRI_CALL GetPipelineCacheStoreCache(const PipelineCacheStore& pipelineCacheStore, uint32_t workerIndex) {
+    return ((HelperPipelineCacheStore&)pipelineCacheStore).GetPipelineCache(workerIndex);
+}
+
+static Result NRI_CALL SavePipelineCacheStore(PipelineCacheStore& pipelineCacheStore, bool async) {
+    return ((HelperPipelineCacheStore&)pipelineCacheStore).Save(async);
+}
+
+static void NRI_CALL GetPipelineCacheStoreStats(const PipelineCacheStore& pipelineCacheStore, PipelineCacheStoreStats& pipelineCacheStoreStats) {
+    ((HelperPipelineCacheStore&)pipelineCacheStore).GetStats(pipelineCacheStoreStats);
+}
+
+static void NRI_CALL GetPipelineLibraryStats(const Device& device, PipelineLibraryStats& pipelineLibraryStats) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    deviceCapture.GetHelperInterfaceImpl().GetPipelineLibraryStats(deviceCapture.GetImpl(), pipelineLibraryStats);
+}
+
+static Result NRI_CALL CreatePipelineCompiler(Device& device, const PipelineCompilerDesc& pipelineCompilerDesc, PipelineCompiler*& pipelineCompiler) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+    HelperPipelineCompiler* impl = Allocate<HelperPipelineCompiler>(deviceCapture.GetAllocationCallbacks(), device);
+    Result result = impl->Create(pipelineCompilerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        pipelineCompiler = nullptr;
+    } else
+        pipelineCompiler = (PipelineCompiler*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyPipelineCompiler(PipelineCompiler* pipelineCompiler) {
+    Destroy((HelperPipelineCompiler*)pipelineCompiler);
+}
+
+static uint32_t NRI_CALL CompileGraphicsPipelineAsync(PipelineCompiler& pipelineCompiler, const GraphicsPipelineDesc& graphicsPipelineDesc) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).Compile(graphicsPipelineDesc);
+}
+
+static uint32_t NRI_CALL CompileComputePipelineAsync(PipelineCompiler& pipelineCompiler, const ComputePipelineDesc& computePipelineDesc) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).Compile(computePipelineDesc);
+}
+
+static bool NRI_CALL IsPipelineReady(const PipelineCompiler& pipelineCompiler, uint32_t pipelineHandle) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).IsReady(pipelineHandle);
+}
+
+static Pipeline* NRI_CALL AcquirePipeline(const PipelineCompiler& pipelineCompiler, uint32_t pipelineHandle, Pipeline* substitute) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).Acquire(pipelineHandle, substitute);
+}
+
+static void NRI_CALL ReleasePipeline(PipelineCompiler& pipelineCompiler, uint32_t pipelineHandle) {
+    ((HelperPipelineCompiler&)pipelineCompiler).Release(pipelineHandle);
+}
+
+static Result NRI_CALL GetPipelineFeedback(const Pipeline& pipeline, PipelineFeedback& pipelineFeedback) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    return deviceCapture.GetHelperInterfaceImpl().GetPipelineFeedback(pipeline, pipelineFeedback);
+}
+
+static void NRI_CALL GetPipelineFeedbackStats(const Device& device, PipelineFeedbackStats& pipelineFeedbackStats) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    deviceCapture.GetHelperInterfaceImpl().GetPipelineFeedbackStats(deviceCapture.GetImpl(), pipelineFeedbackStats);
+}
+
+static Result NRI_CALL CreateBindlessAllocator(Device& device, const BindlessAllocatorDesc& bindlessAllocatorDesc, BindlessAllocator*& bindlessAllocator) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+    HelperBindlessAllocator* impl = Allocate<HelperBindlessAllocator>(deviceCapture.GetAllocationCallbacks(), device);
+    Result result = impl->Create(bindlessAllocatorDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        bindlessAllocator = nullptr;
+    } else
+        bindlessAllocator = (BindlessAllocator*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyBindlessAllocator(BindlessAllocator* bindlessAllocator) {
+    Destroy((HelperBindlessAllocator*)bindlessAllocator);
+}
+
+static DescriptorSet* NRI_CALL GetBindlessDescriptorSet(const BindlessAllocator& bindlessAllocator, uint32_t classIndex) {
+    return ((HelperBindlessAllocator&)bindlessAllocator).GetDescriptorSet(classIndex);
+}
+
+static Result NRI_CALL AllocateBindlessIndex(BindlessAllocator& bindlessAllocator, uint32_t classIndex, uint32_t& index) {
+    return ((HelperBindlessAllocator&)bindlessAllocator).AllocateIndex(classIndex, index);
+}
+
+static void NRI_CALL ReleaseBindlessIndex(BindlessAllocator& bindlessAllocator, uint32_t classIndex, uint32_t index) {
+    ((HelperBindlessAllocator&)bindlessAllocator).ReleaseIndex(classIndex, index);
+}
+
+static void NRI_CALL SetBindlessDescriptor(BindlessAllocator& bindlessAllocator, uint32_t classIndex, uint32_t index, const Descriptor& descriptor) {
+    ((HelperBindlessAllocator&)bindlessAllocator).SetDescriptor(classIndex, index, descriptor);
+}
+
+static void NRI_CALL UpdateBindlessAllocator(BindlessAllocator& bindlessAllocator, uint64_t completedFrameNum) {
+    ((HelperBindlessAllocator&)bindlessAllocator).Update(completedFrameNum);
+}
+
+static void NRI_CALL GetRedundantCommandStats(const Device& device, RedundantCommandStats& redundantCommandStats) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    deviceCapture.GetHelperInterfaceImpl().GetRedundantCommandStats(deviceCapture.GetImpl(), redundantCommandStats);
+}
+
+static void NRI_CALL InvalidateCommandBufferState(CommandBuffer& commandBuffer) {
+    GetDeviceCapture().GetHelperInterfaceImpl().InvalidateCommandBufferState(commandBuffer);
+}
+
+Result DeviceCapture::FillFunctionTable(HelperInterface& table) const {
+    table.CalculateAllocationNumber = ::CalculateAllocationNumber;
+    table.AllocateAndBindMemory = ::AllocateAndBindMemory;
+    table.UploadData = ::UploadData;
+    table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.SetMemoryPriority = ::SetMemoryPriority;
+    table.CreateResidencyManager = ::CreateResidencyManager;
+    table.DestroyResidencyManager = ::DestroyResidencyManager;
+    table.TrackMemory = ::TrackMemory;
+    table.UntrackMemory = ::UntrackMemory;
+    table.MarkMemoryUsed = ::MarkMemoryUsed;
+    table.UpdateResidency = ::UpdateResidency;
+    table.CreateDefragmenter = ::CreateDefragmenter;
+    table.DestroyDefragmenter = ::DestroyDefragmenter;
+    table.PlanDefragmentation = ::PlanDefragmentation;
+    table.DefragmentStep = ::DefragmentStep;
+    table.MergePipelineCaches = ::MergePipelineCaches;
+    table.CreatePipelineCacheStore = ::CreatePipelineCacheStore;
+    table.DestroyPipelineCacheStore = ::DestroyPipelineCacheStore;
+    table.GetPipelineCacheStoreCache = ::GetPipelineCacheStoreCache;
+    table.SavePipelineCacheStore = ::SavePipelineCacheStore;
+    table.GetPipelineCacheStoreStats = ::GetPipelineCacheStoreStats;
+    table.GetPipelineLibraryStats = ::GetPipelineLibraryStats;
+    table.CreatePipelineCompiler = ::CreatePipelineCompiler;
+    table.DestroyPipelineCompiler = ::DestroyPipelineCompiler;
+    table.CompileGraphicsPipelineAsync = ::CompileGraphicsPipelineAsync;
+    table.CompileComputePipelineAsync = ::CompileComputePipelineAsync;
+    table.IsPipelineReady = ::IsPipelineReady;
+    table.AcquirePipeline = ::AcquirePipeline;
+    table.ReleasePipeline = ::ReleasePipeline;
+    table.GetPipelineFeedback = ::GetPipelineFeedback;
+    table.GetPipelineFeedbackStats = ::GetPipelineFeedbackStats;
+    table.CreateBindlessAllocator = ::CreateBindlessAllocator;
+    table.DestroyBindlessAllocator = ::DestroyBindlessAllocator;
+    table.GetBindlessDescriptorSet = ::GetBindlessDescriptorSet;
+    table.AllocateBindlessIndex = ::AllocateBindlessIndex;
+    table.ReleaseBindlessIndex = ::ReleaseBindlessIndex;
+    table.SetBindlessDescriptor = ::SetBindlessDescriptor;
+    table.UpdateBindlessAllocator = ::UpdateBindlessAllocator;
+    table.GetRedundantCommandStats = ::GetRedundantCommandStats;
+    table.InvalidateCommandBufferState = ::InvalidateCommandBufferState;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Imgui  ]
+
+#if NRI_ENABLE_IMGUI_EXTENSION
+
+static Result NRI_CALL CreateImgui(Device& device, const ImguiDesc& imguiDesc, Imgui*& imgui) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+    ImguiImpl* impl = Allocate<ImguiImpl>(deviceCapture.GetAllocationCallbacks(), device, deviceCapture.GetCoreInterface());
+    Result result = impl->Create(imguiDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        imgui = nullptr;
+    } else
+        imgui = (Imgui*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyImgui(Imgui* imgui) {
+    Destroy((ImguiImpl*)imgui);
+}
+
+static void NRI_CALL CmdCopyImguiData(CommandBuffer& commandBuffer, Streamer& streamer, Imgui& imgui, const CopyImguiDataDesc& copyImguiDataDesc) {
+    ((ImguiImpl&)imgui).CmdCopyData(commandBuffer, streamer, copyImguiDataDesc);
+}
+
+static void NRI_CALL CmdDrawImgui(CommandBuffer& commandBuffer, Imgui& imgui, const DrawImguiDesc& drawImguiDesc) {
+    ((ImguiImpl&)imgui).CmdDraw(commandBuffer, drawImguiDesc);
+}
+
+Result DeviceCapture::FillFunctionTable(ImguiInterface& table) const {
+    if (!m_IsExtSupported.imgui)
+        return Result::UNSUPPORTED;
+
+    table.CreateImgui = ::CreateImgui;
+    table.DestroyImgui = ::DestroyImgui;
+    table.CmdCopyImguiData = ::CmdCopyImguiData;
+    table.CmdDrawImgui = ::CmdDrawImgui;
+
+    return Result::SUCCESS;
+}
+
+#endif
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Low latency  ]
+
+static Result NRI_CALL SetLatencySleepMode(SwapChain& swapChain, const LatencySleepMode& latencySleepMode) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::SetLatencySleepMode, &swapChain, latencySleepMode);
+
+    return deviceCapture.GetLowLatencyInterfaceImpl().SetLatencySleepMode(swapChain, latencySleepMode);
+}
+
+static Result NRI_CALL SetLatencyMarker(SwapChain& swapChain, uint64_t presentId, LatencyMarker latencyMarker) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::SetLatencyMarker, &swapChain, presentId, latencyMarker);
+
+    return deviceCapture.GetLowLatencyInterfaceImpl().SetLatencyMarker(swapChain, presentId, latencyMarker);
+}
+
+static Result NRI_CALL LatencySleep(SwapChain& swapChain, uint64_t presentId) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::LatencySleep, &swapChain, presentId);
+
+    return deviceCapture.GetLowLatencyInterfaceImpl().LatencySleep(swapChain, presentId);
+}
+
+// "GetLatencyReport" is not captured
+Result DeviceCapture::FillFunctionTable(LowLatencyInterface& table) const {
+    if (!m_IsExtSupported.lowLatency)
+        return Result::UNSUPPORTED;
+
+    table = m_iLowLatencyImpl;
+    table.SetLatencySleepMode = ::SetLatencySleepMode;
+    table.SetLatencyMarker = ::SetLatencyMarker;
+    table.LatencySleep = ::LatencySleep;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  MeshShader  ]
+
+static void NRI_CALL CmdDrawMeshTasks(CommandBuffer& commandBuffer, const DrawMeshTasksDesc& drawMeshTasksDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdDrawMeshTasks, &commandBuffer, drawMeshTasksDesc);
+    deviceCapture.GetMeshShaderInterfaceImpl().CmdDrawMeshTasks(commandBuffer, drawMeshTasksDesc);
+}
+
+static void NRI_CALL CmdDrawMeshTasksIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdDrawMeshTasksIndirect, &commandBuffer, &buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
+    deviceCapture.GetMeshShaderInterfaceImpl().CmdDrawMeshTasksIndirect(commandBuffer, buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
+}
+
+Result DeviceCapture::FillFunctionTable(MeshShaderInterface& table) const {
+    if (!m_IsExtSupported.meshShader)
+        return Result::UNSUPPORTED;
+
+    table.CmdDrawMeshTasks = ::CmdDrawMeshTasks;
+    table.CmdDrawMeshTasksIndirect = ::CmdDrawMeshTasksIndirect;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  RayTracing  ]
+
+static Result NRI_CALL CreateRayTracingPipeline(Device& device, const RayTracingPipelineDesc& rayTracingPipelineDesc, Pipeline*& pipeline) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetRayTracingInterfaceImpl().CreateRayTracingPipeline(deviceCapture.GetImpl(), rayTracingPipelineDesc, pipeline);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateRayTracingPipeline, &device, rayTracingPipelineDesc, AsId(pipeline));
+
+    return result;
+}
+
+static Result NRI_CALL CreateAccelerationStructureDescriptor(const AccelerationStructure& accelerationStructure, Descriptor*& descriptor) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    Result result = deviceCapture.GetRayTracingInterfaceImpl().CreateAccelerationStructureDescriptor(accelerationStructure, descriptor);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateAccelerationStructureDescriptor, &accelerationStructure, AsId(descriptor));
+
+    return result;
+}
+
+// Returned buffers are captured, since they can be used in barriers
+static Buffer* NRI_CALL GetAccelerationStructureBuffer(const AccelerationStructure& accelerationStructure) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    Buffer* buffer = deviceCapture.GetRayTracingInterfaceImpl().GetAccelerationStructureBuffer(accelerationStructure);
+    if (buffer)
+        deviceCapture.Record(CaptureOp::GetAccelerationStructureBuffer, &accelerationStructure, AsId(buffer));
+
+    return buffer;
+}
+
+static Buffer* NRI_CALL GetMicromapBuffer(const Micromap& micromap) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    Buffer* buffer = deviceCapture.GetRayTracingInterfaceImpl().GetMicromapBuffer(micromap);
+    if (buffer)
+        deviceCapture.Record(CaptureOp::GetMicromapBuffer, &micromap, AsId(buffer));
+
+    return buffer;
+}
+
+static void NRI_CALL DestroyAccelerationStructure(AccelerationStructure* accelerationStructure) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (accelerationStructure)
+        deviceCapture.Record(CaptureOp::DestroyAccelerationStructure, accelerationStructure);
+
+    deviceCapture.GetRayTracingInterfaceImpl().DestroyAccelerationStructure(accelerationStructure);
+}
+
+static void NRI_CALL DestroyMicromap(Micromap* micromap) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (micromap)
+        deviceCapture.Record(CaptureOp::DestroyMicromap, micromap);
+
+    deviceCapture.GetRayTracingInterfaceImpl().DestroyMicromap(micromap);
+}
+
+static Result NRI_CALL CreateAccelerationStructure(Device& device, const AccelerationStructureDesc& accelerationStructureDesc, AccelerationStructure*& accelerationStructure) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetRayTracingInterfaceImpl().CreateAccelerationStructure(deviceCapture.GetImpl(), accelerationStructureDesc, accelerationStructure);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateAccelerationStructure, &device, accelerationStructureDesc, AsId(accelerationStructure));
+
+    return result;
+}
+
+static Result NRI_CALL CreateMicromap(Device& device, const MicromapDesc& micromapDesc, Micromap*& micromap) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetRayTracingInterfaceImpl().CreateMicromap(deviceCapture.GetImpl(), micromapDesc, micromap);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateMicromap, &device, micromapDesc, AsId(micromap));
+
+    return result;
+}
+
+// Memory requirements are captured with results to remap memory types on replay
+static void NRI_CALL GetAccelerationStructureMemoryDesc(const AccelerationStructure& accelerationStructure, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.GetRayTracingInterfaceImpl().GetAccelerationStructureMemoryDesc(accelerationStructure, memoryLocation, memoryDesc);
+    deviceCapture.Record(CaptureOp::GetAccelerationStructureMemoryDesc, &accelerationStructure, memoryLocation, memoryDesc);
+}
+
+static void NRI_CALL GetMicromapMemoryDesc(const Micromap& micromap, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.GetRayTracingInterfaceImpl().GetMicromapMemoryDesc(micromap, memoryLocation, memoryDesc);
+    deviceCapture.Record(CaptureOp::GetMicromapMemoryDesc, &micromap, memoryLocation, memoryDesc);
+}
+
+static Result NRI_CALL BindAccelerationStructureMemory(const BindAccelerationStructureMemoryDesc* bindAccelerationStructureMemoryDescs, uint32_t bindAccelerationStructureMemoryDescNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::BindAccelerationStructureMemory, CaptureArray<const BindAccelerationStructureMemoryDesc>{bindAccelerationStructureMemoryDescs, bindAccelerationStructureMemoryDescNum});
+
+    return deviceCapture.GetRayTracingInterfaceImpl().BindAccelerationStructureMemory(bindAccelerationStructureMemoryDescs, bindAccelerationStructureMemoryDescNum);
+}
+
+static Result NRI_CALL BindMicromapMemory(const BindMicromapMemoryDesc* bindMicromapMemoryDescs, uint32_t bindMicromapMemoryDescNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::BindMicromapMemory, CaptureArray<const BindMicromapMemoryDesc>{bindMicromapMemoryDescs, bindMicromapMemoryDescNum});
+
+    return deviceCapture.GetRayTracingInterfaceImpl().BindMicromapMemory(bindMicromapMemoryDescs, bindMicromapMemoryDescNum);
+}
+
+static void NRI_CALL GetAccelerationStructureMemoryDesc2(const Device& device, const AccelerationStructureDesc& accelerationStructureDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    deviceCapture.GetRayTracingInterfaceImpl().GetAccelerationStructureMemoryDesc2(deviceCapture.GetImpl(), accelerationStructureDesc, memoryLocation, memoryDesc);
+    deviceCapture.Record(CaptureOp::GetAccelerationStructureMemoryDesc2, &device, accelerationStructureDesc, memoryLocation, memoryDesc);
+}
+
+static void NRI_CALL GetMicromapMemoryDesc2(const Device& device, const MicromapDesc& micromapDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    deviceCapture.GetRayTracingInterfaceImpl().GetMicromapMemoryDesc2(deviceCapture.GetImpl(), micromapDesc, memoryLocation, memoryDesc);
+    deviceCapture.Record(CaptureOp::GetMicromapMemoryDesc2, &device, micromapDesc, memoryLocation, memoryDesc);
+}
+
+static Result NRI_CALL CreateCommittedAccelerationStructure(Device& device, MemoryLocation memoryLocation, float priority, const AccelerationStructureDesc& accelerationStructureDesc, AccelerationStructure*& accelerationStructure) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetRayTracingInterfaceImpl().CreateCommittedAccelerationStructure(deviceCapture.GetImpl(), memoryLocation, priority, accelerationStructureDesc, accelerationStructure);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateCommittedAccelerationStructure, &device, memoryLocation, priority, accelerationStructureDesc, AsId(accelerationStructure));
+
+    return result;
+}
+
+static Result NRI_CALL CreateCommittedMicromap(Device& device, MemoryLocation memoryLocation, float priority, const MicromapDesc& micromapDesc, Micromap*& micromap) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetRayTracingInterfaceImpl().CreateCommittedMicromap(deviceCapture.GetImpl(), memoryLocation, priority, micromapDesc, micromap);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateCommittedMicromap, &device, memoryLocation, priority, micromapDesc, AsId(micromap));
+
+    return result;
+}
+
+static Result NRI_CALL CreatePlacedAccelerationStructure(Device& device, Memory* memory, uint64_t offset, const AccelerationStructureDesc& accelerationStructureDesc, AccelerationStructure*& accelerationStructure) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetRayTracingInterfaceImpl().CreatePlacedAccelerationStructure(deviceCapture.GetImpl(), memory, offset, accelerationStructureDesc, accelerationStructure);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreatePlacedAccelerationStructure, &device, memory, offset, accelerationStructureDesc, AsId(accelerationStructure));
+
+    return result;
+}
+
+static Result NRI_CALL CreatePlacedMicromap(Device& device, Memory* memory, uint64_t offset, const MicromapDesc& micromapDesc, Micromap*& micromap) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetRayTracingInterfaceImpl().CreatePlacedMicromap(deviceCapture.GetImpl(), memory, offset, micromapDesc, micromap);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreatePlacedMicromap, &device, memory, offset, micromapDesc, AsId(micromap));
+
+    return result;
+}
+
+static void NRI_CALL CmdBuildMicromaps(CommandBuffer& commandBuffer, const BuildMicromapDesc* buildMicromapDescs, uint32_t buildMicromapDescNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdBuildMicromaps, &commandBuffer, CaptureArray<const BuildMicromapDesc>{buildMicromapDescs, buildMicromapDescNum});
+    deviceCapture.GetRayTracingInterfaceImpl().CmdBuildMicromaps(commandBuffer, buildMicromapDescs, buildMicromapDescNum);
+}
+
+static void NRI_CALL CmdWriteMicromapsSizes(CommandBuffer& commandBuffer, const Micromap* const* micromaps, uint32_t micromapNum, QueryPool& queryPool, uint32_t queryPoolOffset) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdWriteMicromapsSizes, &commandBuffer, CaptureArray<const Micromap* const>{micromaps, micromapNum}, &queryPool, queryPoolOffset);
+    deviceCapture.GetRayTracingInterfaceImpl().CmdWriteMicromapsSizes(commandBuffer, micromaps, micromapNum, queryPool, queryPoolOffset);
+}
+
+static void NRI_CALL CmdCopyMicromap(CommandBuffer& commandBuffer, Micromap& dst, const Micromap& src, CopyMode copyMode) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdCopyMicromap, &commandBuffer, &dst, &src, copyMode);
+    deviceCapture.GetRayTracingInterfaceImpl().CmdCopyMicromap(commandBuffer, dst, src, copyMode);
+}
+
+static void NRI_CALL CmdBuildTopLevelAccelerationStructures(CommandBuffer& commandBuffer, const BuildTopLevelAccelerationStructureDesc* buildTopLevelAccelerationStructureDescs, uint32_t buildTopLevelAccelerationStructureDescNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdBuildTopLevelAccelerationStructures, &commandBuffer, CaptureArray<const BuildTopLevelAccelerationStructureDesc>{buildTopLevelAccelerationStructureDescs, buildTopLevelAccelerationStructureDescNum});
+    deviceCapture.GetRayTracingInterfaceImpl().CmdBuildTopLevelAccelerationStructures(commandBuffer, buildTopLevelAccelerationStructureDescs, buildTopLevelAccelerationStructureDescNum);
+}
+
+static void NRI_CALL CmdBuildBottomLevelAccelerationStructures(CommandBuffer& commandBuffer, const BuildBottomLevelAccelerationStructureDesc* buildBottomLevelAccelerationStructureDescs, uint32_t buildBottomLevelAccelerationStructureDescNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdBuildBottomLevelAccelerationStructures, &commandBuffer, CaptureArray<const BuildBottomLevelAccelerationStructureDesc>{buildBottomLevelAccelerationStructureDescs, buildBottomLevelAccelerationStructureDescNum});
+    deviceCapture.GetRayTracingInterfaceImpl().CmdBuildBottomLevelAccelerationStructures(commandBuffer, buildBottomLevelAccelerationStructureDescs, buildBottomLevelAccelerationStructureDescNum);
+}
+
+static void NRI_CALL CmdWriteAccelerationStructuresSizes(CommandBuffer& commandBuffer, const AccelerationStructure* const* accelerationStructures, uint32_t accelerationStructureNum, QueryPool& queryPool, uint32_t queryPoolOffset) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdWriteAccelerationStructuresSizes, &commandBuffer, CaptureArray<const AccelerationStructure* const>{accelerationStructures, accelerationStructureNum}, &queryPool, queryPoolOffset);
+    deviceCapture.GetRayTracingInterfaceImpl().CmdWriteAccelerationStructuresSizes(commandBuffer, accelerationStructures, accelerationStructureNum, queryPool, queryPoolOffset);
+}
+
+static void NRI_CALL CmdCopyAccelerationStructure(CommandBuffer& commandBuffer, AccelerationStructure& dst, const AccelerationStructure& src, CopyMode copyMode) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdCopyAccelerationStructure, &commandBuffer, &dst, &src, copyMode);
+    deviceCapture.GetRayTracingInterfaceImpl().CmdCopyAccelerationStructure(commandBuffer, dst, src, copyMode);
+}
+
+static void NRI_CALL CmdDispatchRays(CommandBuffer& commandBuffer, const DispatchRaysDesc& dispatchRaysDesc) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdDispatchRays, &commandBuffer, dispatchRaysDesc);
+    deviceCapture.GetRayTracingInterfaceImpl().CmdDispatchRays(commandBuffer, dispatchRaysDesc);
+}
+
+static void NRI_CALL CmdDispatchRaysIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::CmdDispatchRaysIndirect, &commandBuffer, &buffer, offset);
+    deviceCapture.GetRayTracingInterfaceImpl().CmdDispatchRaysIndirect(commandBuffer, buffer, offset);
+}
+
+// Queries (handles, scratch sizes, shader group identifiers, native objects) are not captured
+Result DeviceCapture::FillFunctionTable(RayTracingInterface& table) const {
+    if (!m_IsExtSupported.rayTracing)
+        return Result::UNSUPPORTED;
+
+    table = m_iRayTracingImpl;
+    table.CreateRayTracingPipeline = ::CreateRayTracingPipeline;
+    table.CreateAccelerationStructureDescriptor = ::CreateAccelerationStructureDescriptor;
+    table.GetAccelerationStructureBuffer = ::GetAccelerationStructureBuffer;
+    table.GetMicromapBuffer = ::GetMicromapBuffer;
+    table.DestroyAccelerationStructure = ::DestroyAccelerationStructure;
+    table.DestroyMicromap = ::DestroyMicromap;
+    table.CreateAccelerationStructure = ::CreateAccelerationStructure;
+    table.CreateMicromap = ::CreateMicromap;
+    table.GetAccelerationStructureMemoryDesc = ::GetAccelerationStructureMemoryDesc;
+    table.GetMicromapMemoryDesc = ::GetMicromapMemoryDesc;
+    table.BindAccelerationStructureMemory = ::BindAccelerationStructureMemory;
+    table.BindMicromapMemory = ::BindMicromapMemory;
+    table.GetAccelerationStructureMemoryDesc2 = ::GetAccelerationStructureMemoryDesc2;
+    table.GetMicromapMemoryDesc2 = ::GetMicromapMemoryDesc2;
+    table.CreateCommittedAccelerationStructure = ::CreateCommittedAccelerationStructure;
+    table.CreateCommittedMicromap = ::CreateCommittedMicromap;
+    table.CreatePlacedAccelerationStructure = ::CreatePlacedAccelerationStructure;
+    table.CreatePlacedMicromap = ::CreatePlacedMicromap;
+    table.CmdBuildMicromaps = ::CmdBuildMicromaps;
+    table.CmdWriteMicromapsSizes = ::CmdWriteMicromapsSizes;
+    table.CmdCopyMicromap = ::CmdCopyMicromap;
+    table.CmdBuildTopLevelAccelerationStructures = ::CmdBuildTopLevelAccelerationStructures;
+    table.CmdBuildBottomLevelAccelerationStructures = ::CmdBuildBottomLevelAccelerationStructures;
+    table.CmdWriteAccelerationStructuresSizes = ::CmdWriteAccelerationStructuresSizes;
+    table.CmdCopyAccelerationStructure = ::CmdCopyAccelerationStructure;
+    table.CmdDispatchRays = ::CmdDispatchRays;
+    table.CmdDispatchRaysIndirect = ::CmdDispatchRaysIndirect;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Streamer  ]
+
+static Result NRI_CALL CreateStreamer(Device& device, const StreamerDesc& streamerDesc, Streamer*& streamer) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+    StreamerImpl* impl = Allocate<StreamerImpl>(deviceCapture.GetAllocationCallbacks(), device, deviceCapture.GetCoreInterface());
+    Result result = impl->Create(streamerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        streamer = nullptr;
+    } else
+        streamer = (Streamer*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyStreamer(Streamer* streamer) {
+    Destroy((StreamerImpl*)streamer);
+}
+
+static Buffer* NRI_CALL GetStreamerConstantBuffer(Streamer& streamer) {
+    return ((StreamerImpl&)streamer).GetConstantBuffer();
+}
+
+static uint32_t NRI_CALL StreamConstantData(Streamer& streamer, const void* data, uint32_t dataSize) {
+    return ((StreamerImpl&)streamer).StreamConstantData(data, dataSize);
+}
+
+static BufferOffset NRI_CALL StreamBufferData(Streamer& streamer, const StreamBufferDataDesc& streamBufferDataDesc) {
+    return ((StreamerImpl&)streamer).StreamBufferData(streamBufferDataDesc);
+}
+
+static BufferOffset NRI_CALL StreamTextureData(Streamer& streamer, const StreamTextureDataDesc& streamTextureDataDesc) {
+    return ((StreamerImpl&)streamer).StreamTextureData(streamTextureDataDesc);
+}
+
+static void NRI_CALL EndStreamerFrame(Streamer& streamer) {
+    ((StreamerImpl&)streamer).EndFrame();
+}
+
+static void NRI_CALL CmdCopyStreamedData(CommandBuffer& commandBuffer, Streamer& streamer) {
+    ((StreamerImpl&)streamer).CmdCopyStreamedData(commandBuffer);
+}
+
+static uint64_t NRI_CALL CmdReadbackBuffer(CommandBuffer& commandBuffer, Streamer& streamer, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    return ((StreamerImpl&)streamer).CmdReadbackBuffer(commandBuffer, srcBuffer, srcOffset, size);
+}
+
+static uint64_t NRI_CALL CmdReadbackTexture(CommandBuffer& commandBuffer, Streamer& streamer, const Texture& srcTexture, const TextureRegionDesc& srcRegion, TextureDataLayoutDesc& dataLayout) {
+    return ((StreamerImpl&)streamer).CmdReadbackTexture(commandBuffer, srcTexture, srcRegion, dataLayout);
+}
+
+static const void* NRI_CALL TryGetReadbackData(Streamer& streamer, uint64_t ticket) {
+    return ((StreamerImpl&)streamer).TryGetReadbackData(ticket);
+}
+
+Result DeviceCapture::FillFunctionTable(StreamerInterface& table) const {
+    if (!m_IsExtSupported.streamer)
+        return Result::UNSUPPORTED;
+
+    table.CreateStreamer = ::CreateStreamer;
+    table.DestroyStreamer = ::DestroyStreamer;
+    table.GetStreamerConstantBuffer = ::GetStreamerConstantBuffer;
+    table.StreamBufferData = ::StreamBufferData;
+    table.StreamTextureData = ::StreamTextureData;
+    table.StreamConstantData = ::StreamConstantData;
+    table.EndStreamerFrame = ::EndStreamerFrame;
+    table.CmdCopyStreamedData = ::CmdCopyStreamedData;
+    table.CmdReadbackBuffer = ::CmdReadbackBuffer;
+    table.CmdReadbackTexture = ::CmdReadbackTexture;
+    table.TryGetReadbackData = ::TryGetReadbackData;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  SwapChain  ]
+
+static Result NRI_CALL CreateSwapChain(Device& device, const SwapChainDesc& swapChainDesc, SwapChain*& swapChain) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    Result result = deviceCapture.GetSwapChainInterfaceImpl().CreateSwapChain(deviceCapture.GetImpl(), swapChainDesc, swapChain);
+    if (result == Result::SUCCESS)
+        deviceCapture.Record(CaptureOp::CreateSwapChain, &device, swapChainDesc, AsId(swapChain));
+
+    return result;
+}
+
+static void NRI_CALL DestroySwapChain(SwapChain* swapChain) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    if (swapChain)
+        deviceCapture.Record(CaptureOp::DestroySwapChain, swapChain);
+
+    deviceCapture.GetSwapChainInterfaceImpl().DestroySwapChain(swapChain);
+}
+
+// Swap chain textures are captured to be mapped to textures of the replayed swap chain (or regular textures)
+static Texture* const* NRI_CALL GetSwapChainTextures(const SwapChain& swapChain, uint32_t& textureNum) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    Texture* const* textures = deviceCapture.GetSwapChainInterfaceImpl().GetSwapChainTextures(swapChain, textureNum);
+    if (textures && textureNum) {
+        const TextureDesc& textureDesc = deviceCapture.GetCoreInterfaceImpl().GetTextureDesc(*textures[0]);
+        deviceCapture.Record(CaptureOp::GetSwapChainTextures, AsId(&swapChain), CaptureArray<uint64_t>{(uint64_t*)textures, textureNum}, textureDesc);
+    }
+
+    return textures;
+}
+
+// The acquired index is captured for reference only
+static Result NRI_CALL AcquireNextTexture(SwapChain& swapChain, Fence& acquireSemaphore, uint32_t& textureIndex) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    Result result = deviceCapture.GetSwapChainInterfaceImpl().AcquireNextTexture(swapChain, acquireSemaphore, textureIndex);
+    deviceCapture.Record(CaptureOp::AcquireNextTexture, &swapChain, &acquireSemaphore, textureIndex);
+
+    return result;
+}
+
+static Result NRI_CALL WaitForPresent(SwapChain& swapChain, uint64_t presentId) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::WaitForPresent, &swapChain, presentId);
+
+    return deviceCapture.GetSwapChainInterfaceImpl().WaitForPresent(swapChain, presentId);
+}
+
+static Result NRI_CALL QueuePresent(SwapChain& swapChain, Fence& releaseSemaphore, uint64_t presentId) {
+    DeviceCapture& deviceCapture = GetDeviceCapture();
+
+    deviceCapture.Record(CaptureOp::QueuePresent, &swapChain, &releaseSemaphore, presentId);
+
+    return deviceCapture.GetSwapChainInterfaceImpl().QueuePresent(swapChain, releaseSemaphore, presentId);
+}
+
+// "GetDisplayDesc" is not captured
+Result DeviceCapture::FillFunctionTable(SwapChainInterface& table) const {
+    if (!m_IsExtSupported.swapChain)
+        return Result::UNSUPPORTED;
+
+    table = m_iSwapChainImpl;
+    table.CreateSwapChain = ::CreateSwapChain;
+    table.DestroySwapChain = ::DestroySwapChain;
+    table.GetSwapChainTextures = ::GetSwapChainTextures;
+    table.AcquireNextTexture = ::AcquireNextTexture;
+    table.WaitForPresent = ::WaitForPresent;
+    table.QueuePresent = ::QueuePresent;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Upscaler  ]
+
+static Result NRI_CALL CreateUpscaler(Device& device, const UpscalerDesc& upscalerDesc, Upscaler*& upscaler) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+    UpscalerImpl* impl = Allocate<UpscalerImpl>(deviceCapture.GetAllocationCallbacks(), device, deviceCapture.GetCoreInterface());
+    Result result = impl->Create(upscalerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        upscaler = nullptr;
+    } else
+        upscaler = (Upscaler*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyUpscaler(Upscaler* upscaler) {
+    Destroy((UpscalerImpl*)upscaler);
+}
+
+static bool NRI_CALL IsUpscalerSupported(const Device& device, UpscalerType upscalerType) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+
+    return IsUpscalerSupported(deviceCapture.GetDesc(), upscalerType);
+}
+
+static void NRI_CALL GetUpscalerProps(const Upscaler& upscaler, UpscalerProps& upscalerProps) {
+    ((UpscalerImpl&)upscaler).GetUpscalerProps(upscalerProps);
+}
+
+static void NRI_CALL CmdDispatchUpscale(CommandBuffer& commandBuffer, Upscaler& upscaler, const DispatchUpscaleDesc& dispatchUpscalerDesc) {
+    ((UpscalerImpl&)upscaler).CmdDispatchUpscale(commandBuffer, dispatchUpscalerDesc);
+}
+
+Result DeviceCapture::FillFunctionTable(UpscalerInterface& table) const {
+    if (!m_IsExtSupported.upscaler)
+        return Result::UNSUPPORTED;
+
+    table.CreateUpscaler = ::CreateUpscaler;
+    table.DestroyUpscaler = ::DestroyUpscaler;
+    table.IsUpscalerSupported = ::IsUpscalerSupported;
+    table.GetUpscalerProps = ::GetUpscalerProps;
+    table.CmdDispatchUpscale = ::CmdDispatchUpscale;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
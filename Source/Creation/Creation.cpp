@@ -29,6 +29,8 @@
 #    include <webgpu/wgpu.h>
 #endif
 
+#include <chrono>
+
 #include "SharedExternal.h"
 
 #define ADAPTER_MAX_NUM 32u
@@ -41,6 +43,7 @@ Result CreateDeviceD3D12(const DeviceCreationDesc& deviceCreationDesc, const Dev
 Result CreateDeviceVK(const DeviceCreationDesc& deviceCreationDesc, const DeviceCreationVKDesc& deviceCreationDescVK, DeviceBase*& device);
 Result CreateDeviceWGPU(const DeviceCreationDesc& deviceCreationDesc, DeviceBase*& device);
 DeviceBase* CreateDeviceValidation(const DeviceCreationDesc& deviceCreationDesc, DeviceBase& device);
+DeviceBase* CreateDeviceCapture(const DeviceCreationDesc& deviceCreationDesc, DeviceBase& device);
 
 constexpr uint64_t Hash(const char* name) {
     return *name != 0 ? *name ^ (33 * Hash(name + 1)) : 5381;
@@ -168,6 +171,44 @@ static int SortAdapters(const void* pa, const void* pb) {
     return 0;
 }
 
+// Process-level cache, filled by the first enumeration and reused by device creation until "nriInvalidateAdapterCache"
+struct AdapterCache {
+    std::array<AdapterDesc, ADAPTER_MAX_NUM> adapterDescs = {};
+    uint32_t adapterDescNum = 0;
+    bool isValid = false;
+
+#if NRI_ENABLE_VK_SUPPORT
+    // The loader and the instance are expensive to create (ICD and layer discovery)
+    Library* vkLoader = nullptr;
+    VkInstance vkInstance = VK_NULL_HANDLE;
+    PFN_vkDestroyInstance vkDestroyInstance = nullptr;
+    PFN_vkEnumeratePhysicalDeviceGroups vkEnumeratePhysicalDeviceGroups = nullptr;
+    PFN_vkGetPhysicalDeviceProperties2 vkGetPhysicalDeviceProperties2 = nullptr;
+    PFN_vkGetPhysicalDeviceMemoryProperties vkGetPhysicalDeviceMemoryProperties = nullptr;
+    PFN_vkGetPhysicalDeviceQueueFamilyProperties2 vkGetPhysicalDeviceQueueFamilyProperties2 = nullptr;
+#endif
+
+    Lock lock;
+};
+
+static AdapterCache g_adapterCache;
+
+// Device creation phases, reported via the message callback
+struct CreationTimings {
+    inline double EndPhase() {
+        auto now = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(now - phaseBegin).count();
+        phaseBegin = now;
+
+        return ms;
+    }
+
+    std::chrono::steady_clock::time_point phaseBegin = std::chrono::steady_clock::now();
+    double adapters = 0.0;
+    double backend = 0.0;
+    bool isAdapterCacheHit = false;
+};
+
 #if (NRI_ENABLE_D3D11_SUPPORT || NRI_ENABLE_D3D12_SUPPORT)
 
 static void UpdateAdaptersD3D(AdapterDesc* adapterDescs, uint32_t& adapterDescNum, LUID* precreatedLuid) {
@@ -282,30 +323,36 @@ static void UpdateAdaptersD3D(AdapterDesc* adapterDescs, uint32_t& adapterDescNu
 
 #if NRI_ENABLE_VK_SUPPORT
 
-static void UpdateAdaptersVK(AdapterDesc* adapterDescs, uint32_t& adapterDescNum, VkPhysicalDevice precreatedPhysicalDevice) {
-    // Variables first
+static void DestroyInstanceVK() {
+    AdapterCache& cache = g_adapterCache;
+
+    if (cache.vkDestroyInstance && cache.vkInstance)
+        cache.vkDestroyInstance(cache.vkInstance, nullptr);
+
+    if (cache.vkLoader)
+        UnloadSharedLibrary(*cache.vkLoader);
+
+    cache.vkLoader = nullptr;
+    cache.vkInstance = VK_NULL_HANDLE;
+    cache.vkDestroyInstance = nullptr;
+    cache.vkEnumeratePhysicalDeviceGroups = nullptr;
+    cache.vkGetPhysicalDeviceProperties2 = nullptr;
+    cache.vkGetPhysicalDeviceMemoryProperties = nullptr;
+    cache.vkGetPhysicalDeviceQueueFamilyProperties2 = nullptr;
+}
+
+// "g_adapterCache.lock" must be held
+static bool InitInstanceVK() {
+    AdapterCache& cache = g_adapterCache;
+    if (cache.vkInstance)
+        return true;
+
     VkApplicationInfo applicationInfo = {};
     applicationInfo.apiVersion = VK_API_VERSION_1_2; // 1.3 not needed here
 
     VkInstanceCreateInfo instanceCreateInfo = {VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO};
     instanceCreateInfo.pApplicationInfo = &applicationInfo;
 
-    VkInstance instance = VK_NULL_HANDLE;
-    Uid_t uidNeeded = {};
-    VkResult vkResult = VK_SUCCESS;
-    uint32_t deviceGroupNum = 0;
-    uint32_t maxFamilyNum = 1;
-    VkPhysicalDeviceGroupProperties* deviceGroupProperties = nullptr;
-    VkQueueFamilyProperties2* familyProps2 = nullptr;
-
-    PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr = nullptr;
-    PFN_vkCreateInstance vkCreateInstance = nullptr;
-    PFN_vkDestroyInstance vkDestroyInstance = nullptr;
-    PFN_vkEnumeratePhysicalDeviceGroups vkEnumeratePhysicalDeviceGroups = nullptr;
-    PFN_vkGetPhysicalDeviceProperties2 vkGetPhysicalDeviceProperties2 = nullptr;
-    PFN_vkGetPhysicalDeviceMemoryProperties vkGetPhysicalDeviceMemoryProperties = nullptr;
-    PFN_vkGetPhysicalDeviceQueueFamilyProperties2 vkGetPhysicalDeviceQueueFamilyProperties2 = nullptr;
-
 #    ifdef __APPLE__
     std::array<const char*, 2> instanceExtensions = {"VK_KHR_get_physical_device_properties2", VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME};
 
@@ -315,70 +362,85 @@ static void UpdateAdaptersVK(AdapterDesc* adapterDescs, uint32_t& adapterDescNum
 #    endif
 
     // Get loader
-    Library* loader = LoadSharedLibrary(NRI_VULKAN_LOADER_NAME);
-    if (!loader)
-        goto CLEANUP;
+    cache.vkLoader = LoadSharedLibrary(NRI_VULKAN_LOADER_NAME);
+    if (!cache.vkLoader)
+        return false;
 
     // Get the entry point
-    vkGetInstanceProcAddr = (PFN_vkGetInstanceProcAddr)GetSharedLibraryFunction(*loader, "vkGetInstanceProcAddr");
-    if (!vkGetInstanceProcAddr)
-        goto CLEANUP;
+    PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr = (PFN_vkGetInstanceProcAddr)GetSharedLibraryFunction(*cache.vkLoader, "vkGetInstanceProcAddr");
+    PFN_vkCreateInstance vkCreateInstance = vkGetInstanceProcAddr ? (PFN_vkCreateInstance)vkGetInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance") : nullptr;
 
     // Create instance
-    vkCreateInstance = (PFN_vkCreateInstance)vkGetInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance");
-    if (!vkCreateInstance)
-        goto CLEANUP;
+    VkResult vkResult = vkCreateInstance ? vkCreateInstance(&instanceCreateInfo, nullptr, &cache.vkInstance) : VK_ERROR_INITIALIZATION_FAILED;
+    if (vkResult != VK_SUCCESS) {
+        cache.vkInstance = VK_NULL_HANDLE;
+        DestroyInstanceVK();
 
-    vkResult = vkCreateInstance(&instanceCreateInfo, nullptr, &instance);
-    if (vkResult != VK_SUCCESS)
-        goto CLEANUP;
+        return false;
+    }
 
     // Get needed functions
-    vkDestroyInstance = (PFN_vkDestroyInstance)vkGetInstanceProcAddr(instance, "vkDestroyInstance");
-    vkEnumeratePhysicalDeviceGroups = (PFN_vkEnumeratePhysicalDeviceGroups)vkGetInstanceProcAddr(instance, "vkEnumeratePhysicalDeviceGroups");
-    vkGetPhysicalDeviceProperties2 = (PFN_vkGetPhysicalDeviceProperties2)vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceProperties2");
-    vkGetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties)vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceMemoryProperties");
-    vkGetPhysicalDeviceQueueFamilyProperties2 = (PFN_vkGetPhysicalDeviceQueueFamilyProperties2)vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceQueueFamilyProperties2");
+    cache.vkDestroyInstance = (PFN_vkDestroyInstance)vkGetInstanceProcAddr(cache.vkInstance, "vkDestroyInstance");
+    cache.vkEnumeratePhysicalDeviceGroups = (PFN_vkEnumeratePhysicalDeviceGroups)vkGetInstanceProcAddr(cache.vkInstance, "vkEnumeratePhysicalDeviceGroups");
+    cache.vkGetPhysicalDeviceProperties2 = (PFN_vkGetPhysicalDeviceProperties2)vkGetInstanceProcAddr(cache.vkInstance, "vkGetPhysicalDeviceProperties2");
+    cache.vkGetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties)vkGetInstanceProcAddr(cache.vkInstance, "vkGetPhysicalDeviceMemoryProperties");
+    cache.vkGetPhysicalDeviceQueueFamilyProperties2 = (PFN_vkGetPhysicalDeviceQueueFamilyProperties2)vkGetInstanceProcAddr(cache.vkInstance, "vkGetPhysicalDeviceQueueFamilyProperties2");
 
-    if (!vkDestroyInstance || !vkEnumeratePhysicalDeviceGroups || !vkGetPhysicalDeviceProperties2)
-        goto CLEANUP;
+    if (!cache.vkDestroyInstance || !cache.vkEnumeratePhysicalDeviceGroups || !cache.vkGetPhysicalDeviceProperties2) {
+        DestroyInstanceVK();
+
+        return false;
+    }
 
-    vkResult = vkEnumeratePhysicalDeviceGroups(instance, &deviceGroupNum, nullptr);
+    return true;
+}
+
+// "g_adapterCache.lock" must be held
+static void UpdateAdaptersVK(AdapterDesc* adapterDescs, uint32_t& adapterDescNum, VkPhysicalDevice precreatedPhysicalDevice) {
+    if (!InitInstanceVK())
+        return;
+
+    const AdapterCache& cache = g_adapterCache;
+
+    uint32_t deviceGroupNum = 0;
+    VkResult vkResult = cache.vkEnumeratePhysicalDeviceGroups(cache.vkInstance, &deviceGroupNum, nullptr);
     if (vkResult != VK_SUCCESS)
-        goto CLEANUP;
+        return;
 
     // Query device groups
-    deviceGroupProperties = (VkPhysicalDeviceGroupProperties*)alloca(sizeof(VkPhysicalDeviceGroupProperties) * deviceGroupNum);
+    VkPhysicalDeviceGroupProperties* deviceGroupProperties = (VkPhysicalDeviceGroupProperties*)alloca(sizeof(VkPhysicalDeviceGroupProperties) * deviceGroupNum);
     for (uint32_t i = 0; i < deviceGroupNum; i++) {
         deviceGroupProperties[i].sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES;
         deviceGroupProperties[i].pNext = nullptr;
     }
-    vkEnumeratePhysicalDeviceGroups(instance, &deviceGroupNum, deviceGroupProperties);
+    cache.vkEnumeratePhysicalDeviceGroups(cache.vkInstance, &deviceGroupNum, deviceGroupProperties);
 
     // Max queue families
-    if (vkGetPhysicalDeviceQueueFamilyProperties2) {
+    uint32_t maxFamilyNum = 1;
+    if (cache.vkGetPhysicalDeviceQueueFamilyProperties2) {
         for (uint32_t i = 0; i < deviceGroupNum; i++) {
             VkPhysicalDevice physicalDevice = deviceGroupProperties[i].physicalDevices[0];
 
             uint32_t familyNum = 0;
-            vkGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, &familyNum, nullptr);
+            cache.vkGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, &familyNum, nullptr);
 
             maxFamilyNum = std::max(maxFamilyNum, familyNum);
         }
     }
 
-    familyProps2 = (VkQueueFamilyProperties2*)alloca(sizeof(VkQueueFamilyProperties2) * maxFamilyNum);
+    VkQueueFamilyProperties2* familyProps2 = (VkQueueFamilyProperties2*)alloca(sizeof(VkQueueFamilyProperties2) * maxFamilyNum);
     for (uint32_t i = 0; i < maxFamilyNum; i++)
         familyProps2[i] = {VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2};
 
     // Precreated physical device
+    Uid_t uidNeeded = {};
     if (precreatedPhysicalDevice) {
         VkPhysicalDeviceProperties2 deviceProps2 = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2};
 
         VkPhysicalDeviceIDProperties deviceIDProperties = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES};
         deviceProps2.pNext = &deviceIDProperties;
 
-        vkGetPhysicalDeviceProperties2(precreatedPhysicalDevice, &deviceProps2);
+        cache.vkGetPhysicalDeviceProperties2(precreatedPhysicalDevice, &deviceProps2);
 
         uidNeeded = ConstructUid(deviceIDProperties.deviceLUID, deviceIDProperties.deviceUUID, deviceIDProperties.deviceLUIDValid);
     }
@@ -392,7 +454,7 @@ static void UpdateAdaptersVK(AdapterDesc* adapterDescs, uint32_t& adapterDescNum
         VkPhysicalDeviceIDProperties deviceIDProperties = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES};
         deviceProps2.pNext = &deviceIDProperties;
 
-        vkGetPhysicalDeviceProperties2(physicalDevice, &deviceProps2);
+        cache.vkGetPhysicalDeviceProperties2(physicalDevice, &deviceProps2);
 
         // Logic: append unique or wait for "precreated"
         Uid_t uid = ConstructUid(deviceIDProperties.deviceLUID, deviceIDProperties.deviceUUID, deviceIDProperties.deviceLUIDValid);
@@ -432,9 +494,9 @@ static void UpdateAdaptersVK(AdapterDesc* adapterDescs, uint32_t& adapterDescNum
             adapterDesc.architecture = Architecture::VIRTUAL;
 
         // Memory size
-        if (vkGetPhysicalDeviceMemoryProperties) {
+        if (cache.vkGetPhysicalDeviceMemoryProperties) {
             VkPhysicalDeviceMemoryProperties memoryProperties = {};
-            vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+            cache.vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
 
             // https://registry.khronos.org/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceMemoryProperties.html
             for (uint32_t j = 0; j < memoryProperties.memoryHeapCount; j++) {
@@ -447,9 +509,9 @@ static void UpdateAdaptersVK(AdapterDesc* adapterDescs, uint32_t& adapterDescNum
         }
 
         // Queues
-        if (vkGetPhysicalDeviceQueueFamilyProperties2) {
+        if (cache.vkGetPhysicalDeviceQueueFamilyProperties2) {
             uint32_t familyNum = maxFamilyNum;
-            vkGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, &familyNum, familyProps2);
+            cache.vkGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, &familyNum, familyProps2);
 
             std::array<uint32_t, (size_t)QueueType::MAX_NUM> scores = {};
             for (uint32_t j = 0; j < familyNum; j++) {
@@ -484,13 +546,6 @@ static void UpdateAdaptersVK(AdapterDesc* adapterDescs, uint32_t& adapterDescNum
         if (precreatedPhysicalDevice)
             break;
     }
-
-CLEANUP:
-    if (vkDestroyInstance && instance)
-        vkDestroyInstance(instance, nullptr);
-
-    if (loader)
-        UnloadSharedLibrary(*loader);
 }
 
 #endif
@@ -597,10 +652,13 @@ static void UpdateAdaptersWGPU(AdapterDesc* adapterDescs, uint32_t& adapterDescN
 
 #endif
 
-static Result FinalizeDeviceCreation(const DeviceCreationDesc& deviceCreationDesc, DeviceBase& deviceImpl, Device*& device) {
+static Result FinalizeDeviceCreation(const DeviceCreationDesc& deviceCreationDesc, DeviceBase& deviceImpl, Device*& device, CreationTimings& timings) {
     MaybeUnused(deviceCreationDesc);
+
+    timings.backend = timings.EndPhase();
+
 #if NRI_ENABLE_VALIDATION_SUPPORT
-    if (deviceCreationDesc.enableNRIValidation && deviceCreationDesc.graphicsAPI != GraphicsAPI::NONE) {
+    if (deviceCreationDesc.enableNRIValidation) {
         Device* deviceVal = (Device*)CreateDeviceValidation(deviceCreationDesc, deviceImpl);
         if (!deviceVal) {
             nriDestroyDevice((Device*)&deviceImpl);
@@ -612,10 +670,26 @@ static Result FinalizeDeviceCreation(const DeviceCreationDesc& deviceCreationDes
 #endif
         device = (Device*)&deviceImpl;
 
+#if NRI_ENABLE_CAPTURE_SUPPORT
+    // The capture layer is the outermost one, it takes ownership of the device (destroyed on failure)
+    if (deviceCreationDesc.captureFileName) {
+        Device* deviceCapture = (Device*)CreateDeviceCapture(deviceCreationDesc, *(DeviceBase*)device);
+        if (!deviceCapture)
+            return Result::FAILURE;
+
+        device = deviceCapture;
+    }
+#endif
+
+    double layers = timings.EndPhase();
+
 #if NRI_ENABLE_NVTX_SUPPORT
     nvtxInitialize(nullptr); // needed only to avoid stalls on the first use
 #endif
 
+    NRI_REPORT_INFO((DeviceBase*)device, "Device created in %.2f ms (adapters: %.2f ms%s, device: %.2f ms, validation and capture layers: %.2f ms)",
+        timings.adapters + timings.backend + layers, timings.adapters, timings.isAdapterCacheHit ? " (cached)" : "", timings.backend, layers);
+
     return Result::SUCCESS;
 }
 
@@ -705,6 +779,7 @@ NRI_API Result NRI_CALL nriGetInterface(const Device& device, const char* interf
 
 NRI_API void NRI_CALL nriBeginAnnotation(const char* name, uint32_t bgra) {
     MaybeUnused(name, bgra);
+    NRI_RECORD_ANNOTATION(HOST, BEGIN, name, bgra);
 
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
 #    if NRI_ENABLE_NVTX_SUPPORT
@@ -728,6 +803,8 @@ NRI_API void NRI_CALL nriBeginAnnotation(const char* name, uint32_t bgra) {
 }
 
 NRI_API void NRI_CALL nriEndAnnotation() {
+    NRI_RECORD_ANNOTATION(HOST, END, nullptr, BGRA_UNUSED);
+
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
 #    if NRI_ENABLE_NVTX_SUPPORT
 
@@ -743,6 +820,7 @@ NRI_API void NRI_CALL nriEndAnnotation() {
 
 NRI_API void NRI_CALL nriAnnotation(const char* name, uint32_t bgra) {
     MaybeUnused(name, bgra);
+    NRI_RECORD_ANNOTATION(HOST, MARKER, name, bgra);
 
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
 #    if NRI_ENABLE_NVTX_SUPPORT
@@ -777,6 +855,10 @@ NRI_API void NRI_CALL nriAnnotation(const char* name, uint32_t bgra) {
 #    endif
 
 NRI_API void NRI_CALL nriSetThreadName(const char* name) {
+#    if NRI_ENABLE_ANNOTATION_RECORDER
+    RecordThreadName(name);
+#    endif
+
     uint64_t tid = 0;
 #    if (defined __linux__)
     tid = syscall(SYS_gettid);
@@ -793,12 +875,61 @@ NRI_API void NRI_CALL nriSetThreadName(const char* name) {
 
 #else
 
-NRI_API void NRI_CALL nriSetThreadName(const char*) {
+NRI_API void NRI_CALL nriSetThreadName(const char* name) {
+    MaybeUnused(name);
+#    if NRI_ENABLE_ANNOTATION_RECORDER
+    RecordThreadName(name);
+#    endif
 }
 
 #endif
 
+NRI_API Result NRI_CALL nriSaveAnnotationTimeline(const char* path) {
+    MaybeUnused(path);
+#if NRI_ENABLE_ANNOTATION_RECORDER
+    return SaveAnnotationTimeline(path);
+#else
+    return Result::UNSUPPORTED;
+#endif
+}
+
+NRI_API Result NRI_CALL nriGetAllocationStats(AllocationStats* allocationStats, uint32_t& allocationStatsNum) {
+    MaybeUnused(allocationStats, allocationStatsNum);
+#if NRI_ENABLE_ALLOCATION_ACCOUNTING
+    return GetAllocationStats(allocationStats, allocationStatsNum);
+#else
+    return Result::UNSUPPORTED;
+#endif
+}
+
+NRI_API Result NRI_CALL nriDumpAllocationStats(const Device& device) {
+    MaybeUnused(device);
+#if NRI_ENABLE_ALLOCATION_ACCOUNTING
+    DeviceBase& deviceBase = (DeviceBase&)device;
+
+    uint32_t allocationStatsNum = 0;
+    GetAllocationStats(nullptr, allocationStatsNum);
+
+    Scratch<AllocationStats> allocationStats = NRI_ALLOCATE_SCRATCH(deviceBase, AllocationStats, allocationStatsNum);
+    GetAllocationStats(allocationStats, allocationStatsNum);
+
+    for (uint32_t i = 0; i < allocationStatsNum; i++) {
+        const AllocationStats& stats = allocationStats[i];
+        if (stats.liveAllocationNum || stats.frameAllocationNum) {
+            NRI_REPORT_INFO(&deviceBase, "%s %-32s live: %" PRIu64 " bytes in %u allocations, peak: %" PRIu64 " bytes, %u allocations since the previous query",
+                stats.isCallSite ? "site" : "type", stats.name, stats.liveBytes, stats.liveAllocationNum, stats.peakBytes, stats.frameAllocationNum);
+        }
+    }
+
+    return Result::SUCCESS;
+#else
+    return Result::UNSUPPORTED;
+#endif
+}
+
 NRI_API Result NRI_CALL nriCreateDevice(const DeviceCreationDesc& deviceCreationDesc, Device*& device) {
+    CreationTimings timings;
+
     Result result = Result::UNSUPPORTED;
     DeviceBase* deviceImpl = nullptr;
 
@@ -810,6 +941,11 @@ NRI_API Result NRI_CALL nriCreateDevice(const DeviceCreationDesc& deviceCreation
     std::array<AdapterDesc, ADAPTER_MAX_NUM> adapterDescs = {};
     AdapterDesc adapterDesc = {};
     if (!modifiedDeviceCreationDesc.adapterDesc) {
+        {
+            ExclusiveScope lock(g_adapterCache.lock);
+            timings.isAdapterCacheHit = g_adapterCache.isValid;
+        }
+
         nriEnumerateAdapters(adapterDescs.data(), adapterDescNum);
         for (uint32_t i = 0; i < adapterDescNum; i++) {
             if (adapterDescs[i].supportedGraphicsAPIs & modifiedDeviceCreationDesc.graphicsAPI) {
@@ -823,6 +959,8 @@ NRI_API Result NRI_CALL nriCreateDevice(const DeviceCreationDesc& deviceCreation
     if ((modifiedDeviceCreationDesc.adapterDesc->supportedGraphicsAPIs & modifiedDeviceCreationDesc.graphicsAPI) == 0)
         return Result::UNSUPPORTED;
 
+    timings.adapters = timings.EndPhase();
+
     // Valid queue families expected
     QueueFamilyDesc qraphicsQueue = {};
     qraphicsQueue.queueNum = 1;
@@ -873,10 +1011,12 @@ NRI_API Result NRI_CALL nriCreateDevice(const DeviceCreationDesc& deviceCreation
     if (result != Result::SUCCESS)
         return result;
 
-    return FinalizeDeviceCreation(modifiedDeviceCreationDesc, *deviceImpl, device);
+    return FinalizeDeviceCreation(modifiedDeviceCreationDesc, *deviceImpl, device, timings);
 }
 
 NRI_API Result NRI_CALL nriCreateDeviceFromD3D11Device(const DeviceCreationD3D11Desc& deviceCreationD3D11Desc, Device*& device) {
+    CreationTimings timings;
+
     DeviceCreationDesc deviceCreationDesc = {};
     deviceCreationDesc.graphicsAPI = GraphicsAPI::D3D11;
 
@@ -927,16 +1067,20 @@ NRI_API Result NRI_CALL nriCreateDeviceFromD3D11Device(const DeviceCreationD3D11
         deviceCreationDesc.queueFamilies = &qraphicsQueue;
     }
 
+    timings.adapters = timings.EndPhase();
+
     result = CreateDeviceD3D11(deviceCreationDesc, deviceCreationD3D11Desc, deviceImpl);
 #endif
 
     if (result != Result::SUCCESS)
         return result;
 
-    return FinalizeDeviceCreation(deviceCreationDesc, *deviceImpl, device);
+    return FinalizeDeviceCreation(deviceCreationDesc, *deviceImpl, device, timings);
 }
 
 NRI_API Result NRI_CALL nriCreateDeviceFromD3D12Device(const DeviceCreationD3D12Desc& deviceCreationD3D12Desc, Device*& device) {
+    CreationTimings timings;
+
     DeviceCreationDesc deviceCreationDesc = {};
     deviceCreationDesc.graphicsAPI = GraphicsAPI::D3D12;
 
@@ -979,16 +1123,20 @@ NRI_API Result NRI_CALL nriCreateDeviceFromD3D12Device(const DeviceCreationD3D12
             queueFamilyD3D12Desc.queueNum = supportedQueueNum;
     }
 
+    timings.adapters = timings.EndPhase();
+
     result = CreateDeviceD3D12(deviceCreationDesc, deviceCreationD3D12Desc, deviceImpl);
 #endif
 
     if (result != Result::SUCCESS)
         return result;
 
-    return FinalizeDeviceCreation(deviceCreationDesc, *deviceImpl, device);
+    return FinalizeDeviceCreation(deviceCreationDesc, *deviceImpl, device, timings);
 }
 
 NRI_API Result NRI_CALL nriCreateDeviceFromVKDevice(const DeviceCreationVKDesc& deviceCreationVKDesc, Device*& device) {
+    CreationTimings timings;
+
     DeviceCreationDesc deviceCreationDesc = {};
     deviceCreationDesc.graphicsAPI = GraphicsAPI::VK;
 
@@ -1014,7 +1162,10 @@ NRI_API Result NRI_CALL nriCreateDeviceFromVKDevice(const DeviceCreationVKDesc&
         return Result::INVALID_ARGUMENT;
 
     uint32_t unused = 0;
-    UpdateAdaptersVK(&adapterDesc, unused, (VkPhysicalDevice)deviceCreationVKDesc.vkPhysicalDevice);
+    {
+        ExclusiveScope lock(g_adapterCache.lock);
+        UpdateAdaptersVK(&adapterDesc, unused, (VkPhysicalDevice)deviceCreationVKDesc.vkPhysicalDevice);
+    }
 
     // Valid queue families expected
     for (uint32_t i = 0; i < deviceCreationVKDesc.queueFamilyNum; i++) {
@@ -1029,18 +1180,24 @@ NRI_API Result NRI_CALL nriCreateDeviceFromVKDevice(const DeviceCreationVKDesc&
             queueFamilyVKDesc.queueNum = supportedQueueNum;
     }
 
+    timings.adapters = timings.EndPhase();
+
     result = CreateDeviceVK(deviceCreationDesc, deviceCreationVKDesc, deviceImpl);
 #endif
 
     if (result != Result::SUCCESS)
         return result;
 
-    return FinalizeDeviceCreation(deviceCreationDesc, *deviceImpl, device);
+    return FinalizeDeviceCreation(deviceCreationDesc, *deviceImpl, device, timings);
 }
 
 NRI_API void NRI_CALL nriDestroyDevice(Device* device) {
     if (device)
         ((DeviceBase*)device)->Destruct();
+
+#if NRI_ENABLE_ANNOTATION_RECORDER
+    ReleaseAnnotationRings();
+#endif
 }
 
 NRI_API Format NRI_CALL nriConvertVKFormatToNRI(uint32_t vkFormat) {
@@ -1093,37 +1250,46 @@ NRI_API const char* NRI_CALL nriGetGraphicsAPIString(GraphicsAPI graphicsAPI) {
 }
 
 NRI_API Result NRI_CALL nriEnumerateAdapters(AdapterDesc* outAdapterDescs, uint32_t& outAdapterDescNum) {
-    std::array<AdapterDesc, ADAPTER_MAX_NUM> adapterDescs = {};
-    uint32_t adapterDescNum = 0;
+    ExclusiveScope lock(g_adapterCache.lock);
+
+    std::array<AdapterDesc, ADAPTER_MAX_NUM>& adapterDescs = g_adapterCache.adapterDescs;
+    uint32_t& adapterDescNum = g_adapterCache.adapterDescNum;
+
+    if (!g_adapterCache.isValid) {
+        adapterDescs = {};
+        adapterDescNum = 0;
 
 #if NRI_ENABLE_VK_SUPPORT
-    UpdateAdaptersVK(adapterDescs.data(), adapterDescNum, nullptr);
+        UpdateAdaptersVK(adapterDescs.data(), adapterDescNum, nullptr);
 #endif
 
 #if (NRI_ENABLE_D3D11_SUPPORT || NRI_ENABLE_D3D12_SUPPORT)
-    UpdateAdaptersD3D(adapterDescs.data(), adapterDescNum, nullptr);
+        UpdateAdaptersD3D(adapterDescs.data(), adapterDescNum, nullptr);
 #endif
 
 #if NRI_ENABLE_WGPU_SUPPORT
-    UpdateAdaptersWGPU(adapterDescs.data(), adapterDescNum);
+        UpdateAdaptersWGPU(adapterDescs.data(), adapterDescNum);
 #endif
 
 #if NRI_ENABLE_NONE_SUPPORT
-    if (!adapterDescNum) {
-        AdapterDesc& adapterDesc = adapterDescs[adapterDescNum++];
+        if (!adapterDescNum) {
+            AdapterDesc& adapterDesc = adapterDescs[adapterDescNum++];
 
-        adapterDesc.videoMemorySize = 128ull << 30;
-        adapterDesc.sharedSystemMemorySize = 128ull << 30;
+            adapterDesc.videoMemorySize = 128ull << 30;
+            adapterDesc.sharedSystemMemorySize = 128ull << 30;
 
-        for (uint32_t i = 0; i < GetCountOf(adapterDesc.queueNum); i++)
-            adapterDesc.queueNum[i] = 32;
+            for (uint32_t i = 0; i < GetCountOf(adapterDesc.queueNum); i++)
+                adapterDesc.queueNum[i] = 32;
 
-        strncpy(adapterDesc.name, "NONE", sizeof(adapterDesc.name));
-    }
+            strncpy(adapterDesc.name, "NONE", sizeof(adapterDesc.name));
+        }
 #endif
 
-    // Sort by video memory size and arhitecture (DISCRETE first)
-    qsort(adapterDescs.data(), adapterDescNum, sizeof(adapterDescs[0]), SortAdapters);
+        // Sort by video memory size and arhitecture (DISCRETE first)
+        qsort(adapterDescs.data(), adapterDescNum, sizeof(adapterDescs[0]), SortAdapters);
+
+        g_adapterCache.isValid = true;
+    }
 
     // Copy to output
     if (outAdapterDescs) {
@@ -1140,6 +1306,17 @@ NRI_API Result NRI_CALL nriEnumerateAdapters(AdapterDesc* outAdapterDescs, uint3
     return outAdapterDescNum == 0 ? Result::UNSUPPORTED : Result::SUCCESS;
 }
 
+NRI_API void NRI_CALL nriInvalidateAdapterCache() {
+    ExclusiveScope lock(g_adapterCache.lock);
+
+#if NRI_ENABLE_VK_SUPPORT
+    DestroyInstanceVK();
+#endif
+
+    g_adapterCache.adapterDescNum = 0;
+    g_adapterCache.isValid = false;
+}
+
 NRI_API void NRI_CALL nriReportLiveObjects() {
 #if (NRI_ENABLE_D3D11_SUPPORT || NRI_ENABLE_D3D12_SUPPORT)
     ComPtr<IDXGIDebug1> pDebug;
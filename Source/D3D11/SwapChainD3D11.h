@@ -33,13 +33,16 @@ struct SwapChainD3D11 final : public DisplayDescHelper, DebugNameBase {
     //================================================================================================================
 
     inline Result GetDisplayDesc(DisplayDesc& displayDesc) {
+        if (m_Virtual)
+            return m_Virtual->GetDisplayDesc(displayDesc);
+
         return DisplayDescHelper::GetDisplayDesc(m_Hwnd, displayDesc);
     }
 
     Texture* const* GetTextures(uint32_t& textureNum) const;
-    Result AcquireNextTexture(uint32_t& textureIndex);
+    Result AcquireNextTexture(Fence& acquireSemaphore, uint32_t& textureIndex);
     Result WaitForPresent(uint64_t presentId);
-    Result Present(uint64_t presentId);
+    Result Present(Fence& releaseSemaphore, uint64_t presentId);
 
     Result SetLatencySleepMode(const LatencySleepMode& latencySleepMode);
     Result SetLatencyMarker(uint64_t presentId, LatencyMarker latencyMarker);
@@ -50,6 +53,7 @@ private:
     DeviceD3D11& m_Device;
     ComPtr<IDXGISwapChainBest> m_SwapChain;
     TextureD3D11* m_Texture = nullptr;
+    SwapChainVirtual* m_Virtual = nullptr; // "SwapChainBits::VIRTUAL"
     HANDLE m_FrameLatencyWaitableObject = nullptr;
     void* m_Hwnd = nullptr;
     uint8_t m_Version = 0;
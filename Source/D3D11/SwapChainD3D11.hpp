@@ -39,6 +39,8 @@ static uint8_t QueryLatestInterface(ComPtr<IDXGISwapChainBest>& in, ComPtr<IDXGI
 }
 
 SwapChainD3D11::~SwapChainD3D11() {
+    Destroy(m_Virtual);
+
     if (m_FrameLatencyWaitableObject)
         CloseHandle(m_FrameLatencyWaitableObject);
 
@@ -46,6 +48,13 @@ SwapChainD3D11::~SwapChainD3D11() {
 }
 
 Result SwapChainD3D11::Create(const SwapChainDesc& swapChainDesc) {
+    if (swapChainDesc.flags & SwapChainBits::VIRTUAL) {
+        m_Flags = swapChainDesc.flags;
+        m_Virtual = Allocate<SwapChainVirtual>(m_Device.GetAllocationCallbacks(), m_Device);
+
+        return m_Virtual->Create(swapChainDesc);
+    }
+
     HWND hwnd = (HWND)swapChainDesc.window.windows.hwnd;
     if (!hwnd)
         return Result::INVALID_ARGUMENT;
@@ -169,19 +178,26 @@ Result SwapChainD3D11::Create(const SwapChainDesc& swapChainDesc) {
 }
 
 NRI_INLINE Texture* const* SwapChainD3D11::GetTextures(uint32_t& textureNum) const {
+    if (m_Virtual)
+        return m_Virtual->GetTextures(textureNum);
+
     textureNum = 1;
 
     return (Texture**)&m_Texture;
 }
 
-NRI_INLINE Result SwapChainD3D11::AcquireNextTexture(uint32_t& textureIndex) {
+NRI_INLINE Result SwapChainD3D11::AcquireNextTexture(Fence& acquireSemaphore, uint32_t& textureIndex) {
+    if (m_Virtual)
+        return m_Virtual->AcquireNextTexture(acquireSemaphore, textureIndex);
+
     textureIndex = 0; // IMPORTANT: only 1 texture is available in D3D11
 
     return Result::SUCCESS;
 }
 
 NRI_INLINE Result SwapChainD3D11::WaitForPresent(uint64_t presentId) {
-    MaybeUnused(presentId);
+    if (m_Virtual)
+        return m_Virtual->WaitForPresent(presentId);
 
     if (m_FrameLatencyWaitableObject) {
         uint32_t result = WaitForSingleObjectEx(m_FrameLatencyWaitableObject, NRI_TIMEOUT_PRESENT, TRUE);
@@ -192,8 +208,9 @@ NRI_INLINE Result SwapChainD3D11::WaitForPresent(uint64_t presentId) {
     return Result::UNSUPPORTED;
 }
 
-NRI_INLINE Result SwapChainD3D11::Present(uint64_t presentId) {
-    MaybeUnused(presentId);
+NRI_INLINE Result SwapChainD3D11::Present(Fence& releaseSemaphore, uint64_t presentId) {
+    if (m_Virtual)
+        return m_Virtual->Present(releaseSemaphore, presentId);
 
 #if NRI_ENABLE_NVAPI
     if ((m_Flags & SwapChainBits::ALLOW_LOW_LATENCY) && presentId != 0)
@@ -215,6 +232,9 @@ NRI_INLINE Result SwapChainD3D11::Present(uint64_t presentId) {
 }
 
 NRI_INLINE Result SwapChainD3D11::SetLatencySleepMode(const LatencySleepMode& latencySleepMode) {
+    if (m_Virtual)
+        return m_Virtual->SetLatencySleepMode(latencySleepMode);
+
 #if NRI_ENABLE_NVAPI
     NV_SET_SLEEP_MODE_PARAMS params = {NV_SET_SLEEP_MODE_PARAMS_VER};
     params.bLowLatencyMode = latencySleepMode.lowLatencyMode;
@@ -233,6 +253,9 @@ NRI_INLINE Result SwapChainD3D11::SetLatencySleepMode(const LatencySleepMode& la
 }
 
 NRI_INLINE Result SwapChainD3D11::SetLatencyMarker(uint64_t presentId, LatencyMarker latencyMarker) {
+    if (m_Virtual)
+        return m_Virtual->SetLatencyMarker(presentId, latencyMarker);
+
 #if NRI_ENABLE_NVAPI
     NV_LATENCY_MARKER_PARAMS params = {NV_LATENCY_MARKER_PARAMS_VER};
     params.frameID = presentId;
@@ -250,6 +273,9 @@ NRI_INLINE Result SwapChainD3D11::SetLatencyMarker(uint64_t presentId, LatencyMa
 }
 
 NRI_INLINE Result SwapChainD3D11::LatencySleep(uint64_t presentId) {
+    if (m_Virtual)
+        return m_Virtual->LatencySleep(presentId);
+
     MaybeUnused(presentId);
 
 #if NRI_ENABLE_NVAPI
@@ -262,6 +288,9 @@ NRI_INLINE Result SwapChainD3D11::LatencySleep(uint64_t presentId) {
 }
 
 NRI_INLINE Result SwapChainD3D11::GetLatencyReport(LatencyReport& latencyReport) {
+    if (m_Virtual)
+        return m_Virtual->GetLatencyReport(latencyReport);
+
     latencyReport = {};
 #if NRI_ENABLE_NVAPI
     NV_LATENCY_RESULT_PARAMS params = {NV_LATENCY_RESULT_PARAMS_VER};
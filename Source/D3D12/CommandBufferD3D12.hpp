@@ -788,6 +788,34 @@ NRI_INLINE void CommandBufferD3D12::DrawIndexed(const DrawIndexedDesc& drawIndex
     m_GraphicsCommandList->DrawIndexedInstanced(drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
 }
 
+NRI_INLINE void CommandBufferD3D12::DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    const uint8_t* descs = (uint8_t*)drawDescs;
+    bool isEmulationEnabled = m_PipelineLayout && (m_PipelineLayout->IsDrawParametersEmulationEnabled() || m_PipelineLayout->IsDrawIndexEmulationEnabled());
+
+    for (uint32_t i = 0; i < drawNum; i++) {
+        const DrawDesc& drawDesc = *(DrawDesc*)(descs + (size_t)i * stride);
+
+        if (isEmulationEnabled)
+            Draw(drawDesc);
+        else
+            m_GraphicsCommandList->DrawInstanced(drawDesc.vertexNum, drawDesc.instanceNum, drawDesc.baseVertex, drawDesc.baseInstance);
+    }
+}
+
+NRI_INLINE void CommandBufferD3D12::DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    const uint8_t* descs = (uint8_t*)drawIndexedDescs;
+    bool isEmulationEnabled = m_PipelineLayout && (m_PipelineLayout->IsDrawParametersEmulationEnabled() || m_PipelineLayout->IsDrawIndexEmulationEnabled());
+
+    for (uint32_t i = 0; i < drawNum; i++) {
+        const DrawIndexedDesc& drawIndexedDesc = *(DrawIndexedDesc*)(descs + (size_t)i * stride);
+
+        if (isEmulationEnabled)
+            DrawIndexed(drawIndexedDesc);
+        else
+            m_GraphicsCommandList->DrawIndexedInstanced(drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
+    }
+}
+
 NRI_INLINE void CommandBufferD3D12::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ID3D12Resource* pCountBuffer = nullptr;
     if (countBuffer)
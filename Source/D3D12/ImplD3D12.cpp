@@ -105,14 +105,20 @@ static Result NRI_CALL CreateDescriptorPool(Device& device, const DescriptorPool
 }
 
 static Result NRI_CALL CreatePipelineLayout(Device& device, const PipelineLayoutDesc& pipelineLayoutDesc, PipelineLayout*& pipelineLayout) {
+    NRI_ALLOCATION_SITE_SCOPE(PIPELINE);
+
     return ((DeviceD3D12&)device).CreateImplementation<PipelineLayoutD3D12>(pipelineLayout, pipelineLayoutDesc);
 }
 
 static Result NRI_CALL CreateGraphicsPipeline(Device& device, const GraphicsPipelineDesc& graphicsPipelineDesc, Pipeline*& pipeline) {
+    NRI_ALLOCATION_SITE_SCOPE(PIPELINE);
+
     return ((DeviceD3D12&)device).CreateImplementation<PipelineD3D12>(pipeline, graphicsPipelineDesc);
 }
 
 static Result NRI_CALL CreateComputePipeline(Device& device, const ComputePipelineDesc& computePipelineDesc, Pipeline*& pipeline) {
+    NRI_ALLOCATION_SITE_SCOPE(PIPELINE);
+
     return ((DeviceD3D12&)device).CreateImplementation<PipelineD3D12>(pipeline, computePipelineDesc);
 }
 
@@ -311,10 +317,14 @@ static Result NRI_CALL AllocateDescriptorSets(DescriptorPool& descriptorPool, co
 }
 
 static void NRI_CALL UpdateDescriptorRanges(const UpdateDescriptorRangeDesc* updateDescriptorRangeDescs, uint32_t updateDescriptorRangeDescNum) {
+    NRI_ALLOCATION_SITE_SCOPE(DESCRIPTOR_UPDATE);
+
     DescriptorSetD3D12::UpdateDescriptorRanges(updateDescriptorRangeDescs, updateDescriptorRangeDescNum);
 }
 
 static void NRI_CALL CopyDescriptorRanges(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum) {
+    NRI_ALLOCATION_SITE_SCOPE(DESCRIPTOR_UPDATE);
+
     DescriptorSetD3D12::Copy(copyDescriptorRangeDescs, copyDescriptorRangeDescNum);
 }
 
@@ -327,184 +337,260 @@ static void NRI_CALL GetDescriptorSetOffsets(const DescriptorSet& descriptorSet,
 }
 
 static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
+
     return ((CommandBufferD3D12&)commandBuffer).Begin(descriptorPool);
 }
 
 static void NRI_CALL CmdSetDescriptorPool(CommandBuffer& commandBuffer, const DescriptorPool& descriptorPool) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetDescriptorPool(descriptorPool);
 }
 
 static void NRI_CALL CmdSetPipelineLayout(CommandBuffer& commandBuffer, BindPoint bindPoint, const PipelineLayout& pipelineLayout) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetPipelineLayout(bindPoint, pipelineLayout);
 }
 
 static void NRI_CALL CmdSetDescriptorSet(CommandBuffer& commandBuffer, const SetDescriptorSetDesc& setDescriptorSetDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetDescriptorSet(setDescriptorSetDesc);
 }
 
 static void NRI_CALL CmdSetRootConstants(CommandBuffer& commandBuffer, const SetRootConstantsDesc& setRootConstantsDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetRootConstants(setRootConstantsDesc);
 }
 
 static void NRI_CALL CmdSetRootDescriptor(CommandBuffer& commandBuffer, const SetRootDescriptorDesc& setRootDescriptorDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetRootDescriptor(setRootDescriptorDesc);
 }
 
 static void NRI_CALL CmdSetPipeline(CommandBuffer& commandBuffer, const Pipeline& pipeline) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetPipeline(pipeline);
 }
 
 static void NRI_CALL CmdBarrier(CommandBuffer& commandBuffer, const BarrierDesc& barrierDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).Barrier(barrierDesc);
 }
 
 static void NRI_CALL CmdSetIndexBuffer(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, IndexType indexType) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetIndexBuffer(buffer, offset, indexType);
 }
 
 static void NRI_CALL CmdSetVertexBuffers(CommandBuffer& commandBuffer, uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetVertexBuffers(baseSlot, vertexBufferDescs, vertexBufferNum);
 }
 
 static void NRI_CALL CmdSetViewports(CommandBuffer& commandBuffer, const Viewport* viewports, uint32_t viewportNum) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetViewports(viewports, viewportNum);
 }
 
 static void NRI_CALL CmdSetScissors(CommandBuffer& commandBuffer, const Rect* rects, uint32_t rectNum) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetScissors(rects, rectNum);
 }
 
 static void NRI_CALL CmdSetStencilReference(CommandBuffer& commandBuffer, uint8_t frontRef, uint8_t backRef) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetStencilReference(frontRef, backRef);
 }
 
 static void NRI_CALL CmdSetDepthBounds(CommandBuffer& commandBuffer, float boundsMin, float boundsMax) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetDepthBounds(boundsMin, boundsMax);
 }
 
 static void NRI_CALL CmdSetBlendConstants(CommandBuffer& commandBuffer, const Color32f& color) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetBlendConstants(color);
 }
 
 static void NRI_CALL CmdSetSampleLocations(CommandBuffer& commandBuffer, const SampleLocation* locations, Sample_t locationNum, Sample_t sampleNum) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetSampleLocations(locations, locationNum, sampleNum);
 }
 
 static void NRI_CALL CmdSetShadingRate(CommandBuffer& commandBuffer, const ShadingRateDesc& shadingRateDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetShadingRate(shadingRateDesc);
 }
 
 static void NRI_CALL CmdSetDepthBias(CommandBuffer& commandBuffer, const DepthBiasDesc& depthBiasDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).SetDepthBias(depthBiasDesc);
 }
 
+static void NRI_CALL CmdSetTopology(CommandBuffer&, Topology, PrimitiveRestart) {
+}
+
+static void NRI_CALL CmdSetCullMode(CommandBuffer&, CullMode) {
+}
+
+static void NRI_CALL CmdSetFrontFace(CommandBuffer&, bool) {
+}
+
+static void NRI_CALL CmdSetDepthState(CommandBuffer&, const DepthAttachmentDesc&) {
+}
+
+static void NRI_CALL CmdSetStencilState(CommandBuffer&, const StencilAttachmentDesc&) {
+}
+
+static void NRI_CALL CmdSetColorState(CommandBuffer&, uint32_t, const ColorAttachmentDesc*, uint32_t) {
+}
+
 static void NRI_CALL CmdBeginRendering(CommandBuffer& commandBuffer, const RenderingDesc& renderingDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).BeginRendering(renderingDesc);
 }
 
 static void NRI_CALL CmdClearAttachments(CommandBuffer& commandBuffer, const ClearAttachmentDesc* clearAttachmentDescs, uint32_t clearAttachmentDescNum, const Rect* rects, uint32_t rectNum) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).ClearAttachments(clearAttachmentDescs, clearAttachmentDescNum, rects, rectNum);
 }
 
 static void NRI_CALL CmdDraw(CommandBuffer& commandBuffer, const DrawDesc& drawDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).Draw(drawDesc);
 }
 
 static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawIndexedDesc& drawIndexedDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
+    ((CommandBufferD3D12&)commandBuffer).DrawMulti(drawDescs, drawNum, stride);
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
+    ((CommandBufferD3D12&)commandBuffer).DrawIndexedMulti(drawIndexedDescs, drawNum, stride);
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
 
 static void NRI_CALL CmdDrawIndexedIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).DrawIndexedIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
 
 static void NRI_CALL CmdEndRendering(CommandBuffer& commandBuffer) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).EndRendering();
 }
 
 static void NRI_CALL CmdDispatch(CommandBuffer& commandBuffer, const DispatchDesc& dispatchDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).Dispatch(dispatchDesc);
 }
 
 static void NRI_CALL CmdDispatchIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).DispatchIndirect(buffer, offset);
 }
 
 static void NRI_CALL CmdCopyBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size);
 }
 
 static void NRI_CALL CmdCopyTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).CopyTexture(dstTexture, dstRegion, srcTexture, srcRegion);
 }
 
 static void NRI_CALL CmdUploadBufferToTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).UploadBufferToTexture(dstTexture, dstRegion, srcBuffer, srcDataLayout);
 }
 
 static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, dstDataLayout, srcTexture, srcRegion);
 }
 
 static void NRI_CALL CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).ZeroBuffer(buffer, offset, size);
 }
 
 static void NRI_CALL CmdResolveTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion, ResolveOp resolveOp) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).ResolveTexture(dstTexture, dstRegion, srcTexture, srcRegion, resolveOp);
 }
 
 static void NRI_CALL CmdClearStorage(CommandBuffer& commandBuffer, const ClearStorageDesc& clearStorageDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).ClearStorage(clearStorageDesc);
 }
 
 static void NRI_CALL CmdResetQueries(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset, uint32_t num) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).ResetQueries(queryPool, offset, num);
 }
 
 static void NRI_CALL CmdBeginQuery(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).BeginQuery(queryPool, offset);
 }
 
 static void NRI_CALL CmdEndQuery(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).EndQuery(queryPool, offset);
 }
 
 static void NRI_CALL CmdCopyQueries(CommandBuffer& commandBuffer, const QueryPool& queryPool, uint32_t offset, uint32_t num, Buffer& dstBuffer, uint64_t dstOffset) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).CopyQueries(queryPool, offset, num, dstBuffer, dstOffset);
 }
 
 static void NRI_CALL CmdBeginAnnotation(CommandBuffer& commandBuffer, const char* name, uint32_t bgra) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     MaybeUnused(commandBuffer, name, bgra);
+    NRI_RECORD_ANNOTATION(COMMAND_BUFFER, BEGIN, name, bgra);
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
     ((CommandBufferD3D12&)commandBuffer).BeginAnnotation(name, bgra);
 #endif
 }
 
 static void NRI_CALL CmdEndAnnotation(CommandBuffer& commandBuffer) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     MaybeUnused(commandBuffer);
+    NRI_RECORD_ANNOTATION(COMMAND_BUFFER, END, nullptr, BGRA_UNUSED);
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
     ((CommandBufferD3D12&)commandBuffer).EndAnnotation();
 #endif
 }
 
 static void NRI_CALL CmdAnnotation(CommandBuffer& commandBuffer, const char* name, uint32_t bgra) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     MaybeUnused(commandBuffer, name, bgra);
+    NRI_RECORD_ANNOTATION(COMMAND_BUFFER, MARKER, name, bgra);
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
     ((CommandBufferD3D12&)commandBuffer).Annotation(name, bgra);
 #endif
 }
 
 static Result NRI_CALL EndCommandBuffer(CommandBuffer& commandBuffer) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
+
     return ((CommandBufferD3D12&)commandBuffer).End();
 }
 
 static void NRI_CALL QueueBeginAnnotation(Queue& queue, const char* name, uint32_t bgra) {
     MaybeUnused(queue, name, bgra);
+    NRI_RECORD_ANNOTATION(QUEUE, BEGIN, name, bgra);
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
     ((QueueD3D12&)queue).BeginAnnotation(name, bgra);
 #endif
@@ -512,6 +598,7 @@ static void NRI_CALL QueueBeginAnnotation(Queue& queue, const char* name, uint32
 
 static void NRI_CALL QueueEndAnnotation(Queue& queue) {
     MaybeUnused(queue);
+    NRI_RECORD_ANNOTATION(QUEUE, END, nullptr, BGRA_UNUSED);
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
     ((QueueD3D12&)queue).EndAnnotation();
 #endif
@@ -519,6 +606,7 @@ static void NRI_CALL QueueEndAnnotation(Queue& queue) {
 
 static void NRI_CALL QueueAnnotation(Queue& queue, const char* name, uint32_t bgra) {
     MaybeUnused(queue, name, bgra);
+    NRI_RECORD_ANNOTATION(QUEUE, MARKER, name, bgra);
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
     ((QueueD3D12&)queue).Annotation(name, bgra);
 #endif
@@ -704,10 +792,18 @@ Result DeviceD3D12::FillFunctionTable(CoreInterface& table) const {
     table.CmdSetSampleLocations = ::CmdSetSampleLocations;
     table.CmdSetShadingRate = ::CmdSetShadingRate;
     table.CmdSetDepthBias = ::CmdSetDepthBias;
+    table.CmdSetTopology = ::CmdSetTopology;
+    table.CmdSetCullMode = ::CmdSetCullMode;
+    table.CmdSetFrontFace = ::CmdSetFrontFace;
+    table.CmdSetDepthState = ::CmdSetDepthState;
+    table.CmdSetStencilState = ::CmdSetStencilState;
+    table.CmdSetColorState = ::CmdSetColorState;
     table.CmdBeginRendering = ::CmdBeginRendering;
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
     table.CmdEndRendering = ::CmdEndRendering;
@@ -788,11 +884,243 @@ static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation
     return QueryVideoMemoryInfoDXGI(luid, memoryLocation, videoMemoryInfo);
 }
 
+static Result NRI_CALL SetMemoryPriority(Memory& memory, float priority) {
+    return ((MemoryD3D12&)memory).SetPriority(priority);
+}
+
+static Result NRI_CALL CreateResidencyManager(Device& device, const ResidencyManagerDesc& residencyManagerDesc, ResidencyManager*& residencyManager) {
+    DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
+    HelperResidencyManager* impl = Allocate<HelperResidencyManager>(deviceD3D12.GetAllocationCallbacks(), device);
+    Result result = impl->Create(residencyManagerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        residencyManager = nullptr;
+    } else
+        residencyManager = (ResidencyManager*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyResidencyManager(ResidencyManager* residencyManager) {
+    Destroy((HelperResidencyManager*)residencyManager);
+}
+
+static uint32_t NRI_CALL TrackMemory(ResidencyManager& residencyManager, Memory& memory, uint64_t size, float priority) {
+    return ((HelperResidencyManager&)residencyManager).TrackMemory(memory, size, priority);
+}
+
+static void NRI_CALL UntrackMemory(ResidencyManager& residencyManager, uint32_t memoryHandle) {
+    ((HelperResidencyManager&)residencyManager).UntrackMemory(memoryHandle);
+}
+
+static void NRI_CALL MarkMemoryUsed(ResidencyManager& residencyManager, const uint32_t* memoryHandles, uint32_t memoryHandleNum) {
+    ((HelperResidencyManager&)residencyManager).MarkMemoryUsed(memoryHandles, memoryHandleNum);
+}
+
+static Result NRI_CALL UpdateResidency(ResidencyManager& residencyManager, ResidencyStats* residencyStats) {
+    return ((HelperResidencyManager&)residencyManager).UpdateResidency(residencyStats);
+}
+
+static Result NRI_CALL CreateDefragmenter(Queue& queue, const DefragmenterDesc& defragmenterDesc, Defragmenter*& defragmenter) {
+    QueueD3D12& queueD3D12 = (QueueD3D12&)queue;
+    DeviceD3D12& deviceD3D12 = queueD3D12.GetDevice();
+    HelperDefragmenter* impl = Allocate<HelperDefragmenter>(deviceD3D12.GetAllocationCallbacks(), deviceD3D12.GetCoreInterface(), (Device&)deviceD3D12, queue);
+    Result result = impl->Create(defragmenterDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        defragmenter = nullptr;
+    } else
+        defragmenter = (Defragmenter*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyDefragmenter(Defragmenter* defragmenter) {
+    Destroy((HelperDefragmenter*)defragmenter);
+}
+
+static uint32_t NRI_CALL PlanDefragmentation(Defragmenter& defragmenter, const DefragmentationDesc& defragmentationDesc) {
+    return ((HelperDefragmenter&)defragmenter).PlanDefragmentation(defragmentationDesc);
+}
+
+static Result NRI_CALL DefragmentStep(Defragmenter& defragmenter, DefragmentationResult& defragmentationResult) {
+    return ((HelperDefragmenter&)defragmenter).DefragmentStep(defragmentationResult);
+}
+
+static Result NRI_CALL MergePipelineCaches(PipelineCache&, const PipelineCache* const*, uint32_t) {
+    return Result::UNSUPPORTED; // "ID3D12PipelineLibrary" can't be merged
+}
+
+static Result NRI_CALL CreatePipelineCacheStore(Device& device, const PipelineCacheStoreDesc& pipelineCacheStoreDesc, PipelineCacheStore*& pipelineCacheStore) {
+    DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
+    HelperPipelineCacheStore* impl = Allocate<HelperPipelineCacheStore>(deviceD3D12.GetAllocationCallbacks(), device);
+    Result result = impl->Create(pipelineCacheStoreDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        pipelineCacheStore = nullptr;
+    } else
+        pipelineCacheStore = (PipelineCacheStore*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyPipelineCacheStore(PipelineCacheStore* pipelineCacheStore) {
+    Destroy((HelperPipelineCacheStore*)pipelineCacheStore);
+}
+
+static PipelineCache* NRI_CALL GetPipelineCacheStoreCache(const PipelineCacheStore& pipelineCacheStore, uint32_t workerIndex) {
+    return ((HelperPipelineCacheStore&)pipelineCacheStore).GetPipelineCache(workerIndex);
+}
+
+static Result NRI_CALL SavePipelineCacheStore(PipelineCacheStore& pipelineCacheStore, bool async) {
+    return ((HelperPipelineCacheStore&)pipelineCacheStore).Save(async);
+}
+
+static void NRI_CALL GetPipelineCacheStoreStats(const PipelineCacheStore& pipelineCacheStore, PipelineCacheStoreStats& pipelineCacheStoreStats) {
+    ((HelperPipelineCacheStore&)pipelineCacheStore).GetStats(pipelineCacheStoreStats);
+}
+
+static void NRI_CALL GetPipelineLibraryStats(const Device&, PipelineLibraryStats& pipelineLibraryStats) {
+    pipelineLibraryStats = {};
+}
+
+static Result NRI_CALL CreatePipelineCompiler(Device& device, const PipelineCompilerDesc& pipelineCompilerDesc, PipelineCompiler*& pipelineCompiler) {
+    DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
+    HelperPipelineCompiler* impl = Allocate<HelperPipelineCompiler>(deviceD3D12.GetAllocationCallbacks(), device);
+    Result result = impl->Create(pipelineCompilerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        pipelineCompiler = nullptr;
+    } else
+        pipelineCompiler = (PipelineCompiler*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyPipelineCompiler(PipelineCompiler* pipelineCompiler) {
+    Destroy((HelperPipelineCompiler*)pipelineCompiler);
+}
+
+static uint32_t NRI_CALL CompileGraphicsPipelineAsync(PipelineCompiler& pipelineCompiler, const GraphicsPipelineDesc& graphicsPipelineDesc) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).Compile(graphicsPipelineDesc);
+}
+
+static uint32_t NRI_CALL CompileComputePipelineAsync(PipelineCompiler& pipelineCompiler, const ComputePipelineDesc& computePipelineDesc) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).Compile(computePipelineDesc);
+}
+
+static bool NRI_CALL IsPipelineReady(const PipelineCompiler& pipelineCompiler, uint32_t pipelineHandle) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).IsReady(pipelineHandle);
+}
+
+static Pipeline* NRI_CALL AcquirePipeline(const PipelineCompiler& pipelineCompiler, uint32_t pipelineHandle, Pipeline* substitute) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).Acquire(pipelineHandle, substitute);
+}
+
+static void NRI_CALL ReleasePipeline(PipelineCompiler& pipelineCompiler, uint32_t pipelineHandle) {
+    ((HelperPipelineCompiler&)pipelineCompiler).Release(pipelineHandle);
+}
+
+static Result NRI_CALL GetPipelineFeedback(const Pipeline&, PipelineFeedback& pipelineFeedback) {
+    pipelineFeedback = {};
+
+    return Result::UNSUPPORTED;
+}
+
+static void NRI_CALL GetPipelineFeedbackStats(const Device&, PipelineFeedbackStats& pipelineFeedbackStats) {
+    pipelineFeedbackStats = {};
+}
+
+static Result NRI_CALL CreateBindlessAllocator(Device& device, const BindlessAllocatorDesc& bindlessAllocatorDesc, BindlessAllocator*& bindlessAllocator) {
+    DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
+    HelperBindlessAllocator* impl = Allocate<HelperBindlessAllocator>(deviceD3D12.GetAllocationCallbacks(), device);
+    Result result = impl->Create(bindlessAllocatorDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        bindlessAllocator = nullptr;
+    } else
+        bindlessAllocator = (BindlessAllocator*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyBindlessAllocator(BindlessAllocator* bindlessAllocator) {
+    Destroy((HelperBindlessAllocator*)bindlessAllocator);
+}
+
+static DescriptorSet* NRI_CALL GetBindlessDescriptorSet(const BindlessAllocator& bindlessAllocator, uint32_t classIndex) {
+    return ((HelperBindlessAllocator&)bindlessAllocator).GetDescriptorSet(classIndex);
+}
+
+static Result NRI_CALL AllocateBindlessIndex(BindlessAllocator& bindlessAllocator, uint32_t classIndex, uint32_t& index) {
+    return ((HelperBindlessAllocator&)bindlessAllocator).AllocateIndex(classIndex, index);
+}
+
+static void NRI_CALL ReleaseBindlessIndex(BindlessAllocator& bindlessAllocator, uint32_t classIndex, uint32_t index) {
+    ((HelperBindlessAllocator&)bindlessAllocator).ReleaseIndex(classIndex, index);
+}
+
+static void NRI_CALL SetBindlessDescriptor(BindlessAllocator& bindlessAllocator, uint32_t classIndex, uint32_t index, const Descriptor& descriptor) {
+    ((HelperBindlessAllocator&)bindlessAllocator).SetDescriptor(classIndex, index, descriptor);
+}
+
+static void NRI_CALL UpdateBindlessAllocator(BindlessAllocator& bindlessAllocator, uint64_t completedFrameNum) {
+    ((HelperBindlessAllocator&)bindlessAllocator).Update(completedFrameNum);
+}
+
+static void NRI_CALL GetRedundantCommandStats(const Device&, RedundantCommandStats& redundantCommandStats) {
+    redundantCommandStats = {};
+}
+
+static void NRI_CALL InvalidateCommandBufferState(CommandBuffer&) {
+}
+
 Result DeviceD3D12::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.SetMemoryPriority = ::SetMemoryPriority;
+    table.CreateResidencyManager = ::CreateResidencyManager;
+    table.DestroyResidencyManager = ::DestroyResidencyManager;
+    table.TrackMemory = ::TrackMemory;
+    table.UntrackMemory = ::UntrackMemory;
+    table.MarkMemoryUsed = ::MarkMemoryUsed;
+    table.UpdateResidency = ::UpdateResidency;
+    table.CreateDefragmenter = ::CreateDefragmenter;
+    table.DestroyDefragmenter = ::DestroyDefragmenter;
+    table.PlanDefragmentation = ::PlanDefragmentation;
+    table.DefragmentStep = ::DefragmentStep;
+    table.MergePipelineCaches = ::MergePipelineCaches;
+    table.CreatePipelineCacheStore = ::CreatePipelineCacheStore;
+    table.DestroyPipelineCacheStore = ::DestroyPipelineCacheStore;
+    table.GetPipelineCacheStoreCache = ::GetPipelineCacheStoreCache;
+    table.SavePipelineCacheStore = ::SavePipelineCacheStore;
+    table.GetPipelineCacheStoreStats = ::GetPipelineCacheStoreStats;
+    table.GetPipelineLibraryStats = ::GetPipelineLibraryStats;
+    table.CreatePipelineCompiler = ::CreatePipelineCompiler;
+    table.DestroyPipelineCompiler = ::DestroyPipelineCompiler;
+    table.CompileGraphicsPipelineAsync = ::CompileGraphicsPipelineAsync;
+    table.CompileComputePipelineAsync = ::CompileComputePipelineAsync;
+    table.IsPipelineReady = ::IsPipelineReady;
+    table.AcquirePipeline = ::AcquirePipeline;
+    table.ReleasePipeline = ::ReleasePipeline;
+    table.GetPipelineFeedback = ::GetPipelineFeedback;
+    table.GetPipelineFeedbackStats = ::GetPipelineFeedbackStats;
+    table.CreateBindlessAllocator = ::CreateBindlessAllocator;
+    table.DestroyBindlessAllocator = ::DestroyBindlessAllocator;
+    table.GetBindlessDescriptorSet = ::GetBindlessDescriptorSet;
+    table.AllocateBindlessIndex = ::AllocateBindlessIndex;
+    table.ReleaseBindlessIndex = ::ReleaseBindlessIndex;
+    table.SetBindlessDescriptor = ::SetBindlessDescriptor;
+    table.UpdateBindlessAllocator = ::UpdateBindlessAllocator;
+    table.GetRedundantCommandStats = ::GetRedundantCommandStats;
+    table.InvalidateCommandBufferState = ::InvalidateCommandBufferState;
 
     return Result::SUCCESS;
 }
@@ -823,12 +1151,14 @@ static void NRI_CALL DestroyImgui(Imgui* imgui) {
 }
 
 static void NRI_CALL CmdCopyImguiData(CommandBuffer& commandBuffer, Streamer& streamer, Imgui& imgui, const CopyImguiDataDesc& copyImguiDataDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ImguiImpl& imguiImpl = (ImguiImpl&)imgui;
 
     return imguiImpl.CmdCopyData(commandBuffer, streamer, copyImguiDataDesc);
 }
 
 static void NRI_CALL CmdDrawImgui(CommandBuffer& commandBuffer, Imgui& imgui, const DrawImguiDesc& drawImguiDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ImguiImpl& imguiImpl = (ImguiImpl&)imgui;
 
     return imguiImpl.CmdDraw(commandBuffer, drawImguiDesc);
@@ -884,10 +1214,12 @@ Result DeviceD3D12::FillFunctionTable(LowLatencyInterface& table) const {
 #pragma region[  MeshShader  ]
 
 static void NRI_CALL CmdDrawMeshTasks(CommandBuffer& commandBuffer, const DrawMeshTasksDesc& drawMeshTasksDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).DrawMeshTasks(drawMeshTasksDesc);
 }
 
 static void NRI_CALL CmdDrawMeshTasksIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).DrawMeshTasksIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
 
@@ -907,6 +1239,8 @@ Result DeviceD3D12::FillFunctionTable(MeshShaderInterface& table) const {
 #pragma region[  RayTracing  ]
 
 static Result NRI_CALL CreateRayTracingPipeline(Device& device, const RayTracingPipelineDesc& rayTracingPipelineDesc, Pipeline*& pipeline) {
+    NRI_ALLOCATION_SITE_SCOPE(PIPELINE);
+
     return ((DeviceD3D12&)device).CreateImplementation<PipelineD3D12>(pipeline, rayTracingPipelineDesc);
 }
 
@@ -1063,38 +1397,47 @@ static Result NRI_CALL WriteShaderGroupIdentifiers(const Pipeline& pipeline, uin
 }
 
 static void NRI_CALL CmdBuildTopLevelAccelerationStructures(CommandBuffer& commandBuffer, const BuildTopLevelAccelerationStructureDesc* buildTopLevelAccelerationStructureDescs, uint32_t buildTopLevelAccelerationStructureDescNum) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).BuildTopLevelAccelerationStructures(buildTopLevelAccelerationStructureDescs, buildTopLevelAccelerationStructureDescNum);
 }
 
 static void NRI_CALL CmdBuildBottomLevelAccelerationStructures(CommandBuffer& commandBuffer, const BuildBottomLevelAccelerationStructureDesc* buildBottomLevelAccelerationStructureDescs, uint32_t buildBottomLevelAccelerationStructureDescNum) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).BuildBottomLevelAccelerationStructures(buildBottomLevelAccelerationStructureDescs, buildBottomLevelAccelerationStructureDescNum);
 }
 
 static void NRI_CALL CmdBuildMicromaps(CommandBuffer& commandBuffer, const BuildMicromapDesc* buildMicromapDescs, uint32_t buildMicromapDescNum) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).BuildMicromaps(buildMicromapDescs, buildMicromapDescNum);
 }
 
 static void NRI_CALL CmdDispatchRays(CommandBuffer& commandBuffer, const DispatchRaysDesc& dispatchRaysDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).DispatchRays(dispatchRaysDesc);
 }
 
 static void NRI_CALL CmdDispatchRaysIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).DispatchRaysIndirect(buffer, offset);
 }
 
 static void NRI_CALL CmdWriteAccelerationStructuresSizes(CommandBuffer& commandBuffer, const AccelerationStructure* const* accelerationStructures, uint32_t accelerationStructureNum, QueryPool& queryPool, uint32_t queryPoolOffset) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).WriteAccelerationStructuresSizes(accelerationStructures, accelerationStructureNum, queryPool, queryPoolOffset);
 }
 
 static void NRI_CALL CmdWriteMicromapsSizes(CommandBuffer& commandBuffer, const Micromap* const* micromaps, uint32_t micromapNum, QueryPool& queryPool, uint32_t queryPoolOffset) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).WriteMicromapsSizes(micromaps, micromapNum, queryPool, queryPoolOffset);
 }
 
 static void NRI_CALL CmdCopyAccelerationStructure(CommandBuffer& commandBuffer, AccelerationStructure& dst, const AccelerationStructure& src, CopyMode copyMode) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).CopyAccelerationStructure(dst, src, copyMode);
 }
 
 static void NRI_CALL CmdCopyMicromap(CommandBuffer& commandBuffer, Micromap& dst, const Micromap& src, CopyMode copyMode) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((CommandBufferD3D12&)commandBuffer).CopyMicromap(dst, src, copyMode);
 }
 
@@ -1198,9 +1541,24 @@ static void NRI_CALL EndStreamerFrame(Streamer& streamer) {
 }
 
 static void NRI_CALL CmdCopyStreamedData(CommandBuffer& commandBuffer, Streamer& streamer) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     ((StreamerImpl&)streamer).CmdCopyStreamedData(commandBuffer);
 }
 
+static uint64_t NRI_CALL CmdReadbackBuffer(CommandBuffer& commandBuffer, Streamer& streamer, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
+    return ((StreamerImpl&)streamer).CmdReadbackBuffer(commandBuffer, srcBuffer, srcOffset, size);
+}
+
+static uint64_t NRI_CALL CmdReadbackTexture(CommandBuffer& commandBuffer, Streamer& streamer, const Texture& srcTexture, const TextureRegionDesc& srcRegion, TextureDataLayoutDesc& dataLayout) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
+    return ((StreamerImpl&)streamer).CmdReadbackTexture(commandBuffer, srcTexture, srcRegion, dataLayout);
+}
+
+static const void* NRI_CALL TryGetReadbackData(Streamer& streamer, uint64_t ticket) {
+    return ((StreamerImpl&)streamer).TryGetReadbackData(ticket);
+}
+
 Result DeviceD3D12::FillFunctionTable(StreamerInterface& table) const {
     table.CreateStreamer = ::CreateStreamer;
     table.DestroyStreamer = ::DestroyStreamer;
@@ -1210,6 +1568,9 @@ Result DeviceD3D12::FillFunctionTable(StreamerInterface& table) const {
     table.StreamConstantData = ::StreamConstantData;
     table.EndStreamerFrame = ::EndStreamerFrame;
     table.CmdCopyStreamedData = ::CmdCopyStreamedData;
+    table.CmdReadbackBuffer = ::CmdReadbackBuffer;
+    table.CmdReadbackTexture = ::CmdReadbackTexture;
+    table.TryGetReadbackData = ::TryGetReadbackData;
 
     return Result::SUCCESS;
 }
@@ -1235,16 +1596,16 @@ static Result NRI_CALL GetDisplayDesc(SwapChain& swapChain, DisplayDesc& display
     return ((SwapChainD3D12&)swapChain).GetDisplayDesc(displayDesc);
 }
 
-static Result NRI_CALL AcquireNextTexture(SwapChain& swapChain, Fence&, uint32_t& textureIndex) {
-    return ((SwapChainD3D12&)swapChain).AcquireNextTexture(textureIndex);
+static Result NRI_CALL AcquireNextTexture(SwapChain& swapChain, Fence& acquireSemaphore, uint32_t& textureIndex) {
+    return ((SwapChainD3D12&)swapChain).AcquireNextTexture(acquireSemaphore, textureIndex);
 }
 
 static Result NRI_CALL WaitForPresent(SwapChain& swapChain, uint64_t presentId) {
     return ((SwapChainD3D12&)swapChain).WaitForPresent(presentId);
 }
 
-static Result NRI_CALL QueuePresent(SwapChain& swapChain, Fence&, uint64_t presentId) {
-    return ((SwapChainD3D12&)swapChain).Present(presentId);
+static Result NRI_CALL QueuePresent(SwapChain& swapChain, Fence& releaseSemaphore, uint64_t presentId) {
+    return ((SwapChainD3D12&)swapChain).Present(releaseSemaphore, presentId);
 }
 
 Result DeviceD3D12::FillFunctionTable(SwapChainInterface& table) const {
@@ -1298,6 +1659,7 @@ static void NRI_CALL GetUpscalerProps(const Upscaler& upscaler, UpscalerProps& u
 }
 
 static void NRI_CALL CmdDispatchUpscale(CommandBuffer& commandBuffer, Upscaler& upscaler, const DispatchUpscaleDesc& dispatchUpscalerDesc) {
+    NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
     UpscalerImpl& upscalerImpl = (UpscalerImpl&)upscaler;
 
     upscalerImpl.CmdDispatchUpscale(commandBuffer, dispatchUpscalerDesc);
@@ -39,6 +39,7 @@ struct MemoryD3D12 final : public DebugNameBase {
 
     Result Create(const AllocateMemoryDesc& allocateMemoryDesc);
     Result Create(const MemoryD3D12Desc& memoryD3D12Desc);
+    Result SetPriority(float priority);
 
     //================================================================================================================
     // DebugNameBase
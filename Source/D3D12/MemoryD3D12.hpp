@@ -58,3 +58,22 @@ Result MemoryD3D12::Create(const MemoryD3D12Desc& memoryD3D12Desc) {
 
     return Result::SUCCESS;
 }
+
+Result MemoryD3D12::SetPriority(float priority) {
+    m_Priority = priority;
+
+    // Committed resources pick up the priority on memory binding
+    ID3D12Heap* heap = *this;
+    if (!heap)
+        return Result::SUCCESS;
+
+    D3D12_RESIDENCY_PRIORITY residencyPriority = ConvertPriority(priority);
+    if (residencyPriority == 0)
+        residencyPriority = D3D12_RESIDENCY_PRIORITY_NORMAL;
+
+    ID3D12Pageable* obj = heap;
+    HRESULT hr = m_Device->SetResidencyPriority(1, &obj, &residencyPriority);
+    NRI_RETURN_ON_BAD_HRESULT(&m_Device, hr, "ID3D12Device1::SetResidencyPriority");
+
+    return Result::SUCCESS;
+}
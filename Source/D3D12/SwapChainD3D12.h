@@ -34,13 +34,16 @@ struct SwapChainD3D12 final : public DisplayDescHelper, DebugNameBase {
     //================================================================================================================
 
     inline Result GetDisplayDesc(DisplayDesc& displayDesc) {
+        if (m_Virtual)
+            return m_Virtual->GetDisplayDesc(displayDesc);
+
         return DisplayDescHelper::GetDisplayDesc(m_Hwnd, displayDesc);
     }
 
     Texture* const* GetTextures(uint32_t& textureNum) const;
-    Result AcquireNextTexture(uint32_t& textureIndex);
+    Result AcquireNextTexture(Fence& acquireSemaphore, uint32_t& textureIndex);
     Result WaitForPresent(uint64_t presentId);
-    Result Present(uint64_t presentId);
+    Result Present(Fence& releaseSemaphore, uint64_t presentId);
 
     Result SetLatencySleepMode(const LatencySleepMode& latencySleepMode);
     Result SetLatencyMarker(uint64_t presentId, LatencyMarker latencyMarker);
@@ -51,6 +54,7 @@ private:
     DeviceD3D12& m_Device;
     ComPtr<IDXGISwapChainBest> m_SwapChain;
     Vector<TextureD3D12*> m_Textures;
+    SwapChainVirtual* m_Virtual = nullptr; // "SwapChainBits::VIRTUAL"
     HANDLE m_FrameLatencyWaitableObject = nullptr;
     void* m_Hwnd = nullptr;
     uint8_t m_Version = 0;
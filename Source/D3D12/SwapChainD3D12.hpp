@@ -39,6 +39,8 @@ static uint8_t QueryLatestInterface(ComPtr<IDXGISwapChainBest>& in, ComPtr<IDXGI
 }
 
 SwapChainD3D12::~SwapChainD3D12() {
+    Destroy(m_Virtual);
+
     if (m_FrameLatencyWaitableObject)
         CloseHandle(m_FrameLatencyWaitableObject);
 
@@ -47,6 +49,13 @@ SwapChainD3D12::~SwapChainD3D12() {
 }
 
 Result SwapChainD3D12::Create(const SwapChainDesc& swapChainDesc) {
+    if (swapChainDesc.flags & SwapChainBits::VIRTUAL) {
+        m_Flags = swapChainDesc.flags;
+        m_Virtual = Allocate<SwapChainVirtual>(m_Device.GetAllocationCallbacks(), m_Device);
+
+        return m_Virtual->Create(swapChainDesc);
+    }
+
     HWND hwnd = (HWND)swapChainDesc.window.windows.hwnd;
     if (!hwnd)
         return Result::INVALID_ARGUMENT;
@@ -176,12 +185,18 @@ Result SwapChainD3D12::Create(const SwapChainDesc& swapChainDesc) {
 }
 
 NRI_INLINE Texture* const* SwapChainD3D12::GetTextures(uint32_t& textureNum) const {
+    if (m_Virtual)
+        return m_Virtual->GetTextures(textureNum);
+
     textureNum = (uint32_t)m_Textures.size();
 
     return (Texture**)m_Textures.data();
 }
 
-NRI_INLINE Result SwapChainD3D12::AcquireNextTexture(uint32_t& textureIndex) {
+NRI_INLINE Result SwapChainD3D12::AcquireNextTexture(Fence& acquireSemaphore, uint32_t& textureIndex) {
+    if (m_Virtual)
+        return m_Virtual->AcquireNextTexture(acquireSemaphore, textureIndex);
+
     textureIndex = m_SwapChain->GetCurrentBackBufferIndex();
 
     // Is device lost?
@@ -192,7 +207,8 @@ NRI_INLINE Result SwapChainD3D12::AcquireNextTexture(uint32_t& textureIndex) {
 }
 
 NRI_INLINE Result SwapChainD3D12::WaitForPresent(uint64_t presentId) {
-    MaybeUnused(presentId);
+    if (m_Virtual)
+        return m_Virtual->WaitForPresent(presentId);
 
     if (m_FrameLatencyWaitableObject) {
         // Is device lost?
@@ -207,8 +223,9 @@ NRI_INLINE Result SwapChainD3D12::WaitForPresent(uint64_t presentId) {
     return Result::UNSUPPORTED;
 }
 
-NRI_INLINE Result SwapChainD3D12::Present(uint64_t presentId) {
-    MaybeUnused(presentId);
+NRI_INLINE Result SwapChainD3D12::Present(Fence& releaseSemaphore, uint64_t presentId) {
+    if (m_Virtual)
+        return m_Virtual->Present(releaseSemaphore, presentId);
 
 #if NRI_ENABLE_NVAPI
     if ((m_Flags & SwapChainBits::ALLOW_LOW_LATENCY) && presentId != 0)
@@ -230,6 +247,9 @@ NRI_INLINE Result SwapChainD3D12::Present(uint64_t presentId) {
 }
 
 NRI_INLINE Result SwapChainD3D12::SetLatencySleepMode(const LatencySleepMode& latencySleepMode) {
+    if (m_Virtual)
+        return m_Virtual->SetLatencySleepMode(latencySleepMode);
+
 #if NRI_ENABLE_NVAPI
     NV_SET_SLEEP_MODE_PARAMS params = {NV_SET_SLEEP_MODE_PARAMS_VER};
     params.bLowLatencyMode = latencySleepMode.lowLatencyMode;
@@ -248,6 +268,9 @@ NRI_INLINE Result SwapChainD3D12::SetLatencySleepMode(const LatencySleepMode& la
 }
 
 NRI_INLINE Result SwapChainD3D12::SetLatencyMarker(uint64_t presentId, LatencyMarker latencyMarker) {
+    if (m_Virtual)
+        return m_Virtual->SetLatencyMarker(presentId, latencyMarker);
+
 #if NRI_ENABLE_NVAPI
     NV_LATENCY_MARKER_PARAMS params = {NV_LATENCY_MARKER_PARAMS_VER};
     params.frameID = presentId;
@@ -265,6 +288,9 @@ NRI_INLINE Result SwapChainD3D12::SetLatencyMarker(uint64_t presentId, LatencyMa
 }
 
 NRI_INLINE Result SwapChainD3D12::LatencySleep(uint64_t presentId) {
+    if (m_Virtual)
+        return m_Virtual->LatencySleep(presentId);
+
     MaybeUnused(presentId);
 
 #if NRI_ENABLE_NVAPI
@@ -277,6 +303,9 @@ NRI_INLINE Result SwapChainD3D12::LatencySleep(uint64_t presentId) {
 }
 
 NRI_INLINE Result SwapChainD3D12::GetLatencyReport(LatencyReport& latencyReport) {
+    if (m_Virtual)
+        return m_Virtual->GetLatencyReport(latencyReport);
+
     latencyReport = {};
 #if NRI_ENABLE_NVAPI
     NV_LATENCY_RESULT_PARAMS params = {NV_LATENCY_RESULT_PARAMS_VER};
@@ -2,6 +2,9 @@
 
 #include "SharedExternal.h"
 
+#include "HelperInterface.h"
+#include "StreamerInterface.h"
+
 using namespace nri;
 
 template <typename T>
@@ -9,9 +12,15 @@ constexpr T* DummyObject() {
     return (T*)(size_t)(1);
 }
 
+// Swap chains are dummy objects, unless created with "SwapChainBits::VIRTUAL"
+inline bool IsVirtualSwapChain(const SwapChain& swapChain) {
+    return &swapChain != DummyObject<SwapChain>();
+}
+
 struct DeviceNONE final : public DeviceBase {
-    inline DeviceNONE(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks, const AdapterDesc* adapterDesc)
-        : DeviceBase(callbacks, allocationCallbacks) {
+    inline DeviceNONE(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks, const AdapterDesc* adapterDesc, uint64_t videoMemoryBudget)
+        : DeviceBase(callbacks, allocationCallbacks)
+        , m_VideoMemoryBudget(videoMemoryBudget) {
         if (adapterDesc)
             m_Desc.adapterDesc = *adapterDesc;
 
@@ -171,6 +180,7 @@ struct DeviceNONE final : public DeviceBase {
         m_Desc.other.combinedClipAndCullDistanceMaxNum = 8;
         m_Desc.other.viewMaxNum = 4;
         m_Desc.other.shadingRateAttachmentTileSize = 16;
+        m_Desc.other.dynamicStates = DynamicStateBits::TOPOLOGY | DynamicStateBits::CULL_MODE | DynamicStateBits::FRONT_FACE | DynamicStateBits::DEPTH | DynamicStateBits::STENCIL | DynamicStateBits::COLOR;
 
         memset(&m_Desc.tiers, 0xFF, sizeof(m_Desc.tiers));
         memset(&m_Desc.features, 1, sizeof(m_Desc.features));
@@ -188,6 +198,18 @@ struct DeviceNONE final : public DeviceBase {
         return m_Desc;
     }
 
+    inline uint64_t GetVideoMemoryBudget() const {
+        return m_VideoMemoryBudget;
+    }
+
+    inline const CoreInterface& GetCoreInterface() const {
+        return m_iCore;
+    }
+
+    inline Result Create() {
+        return FillFunctionTable(m_iCore);
+    }
+
     inline void Destruct() override {
         Destroy(GetAllocationCallbacks(), this);
     }
@@ -206,22 +228,72 @@ struct DeviceNONE final : public DeviceBase {
 #endif
 
 private:
+    CoreInterface m_iCore = {};
     DeviceDesc m_Desc = {};
+    uint64_t m_VideoMemoryBudget = 0;
 };
 
-Result CreateDeviceNONE(const DeviceCreationDesc& desc, DeviceBase*& device) {
-    DeviceNONE* impl = Allocate<DeviceNONE>(desc.allocationCallbacks, desc.callbackInterface, desc.allocationCallbacks, desc.adapterDesc);
+// Buffers and textures keep their descs (needed by layers on top of NONE, i.e. validation), other objects are dummies
+struct BufferNONE final {
+    inline BufferNONE(DeviceNONE& device, const BufferDesc& bufferDesc)
+        : m_Device(device)
+        , m_Desc(bufferDesc)
+        , m_Data(device.GetStdAllocator()) {
+    }
 
-    if (!impl) {
-        Destroy(desc.allocationCallbacks, impl);
-        device = nullptr;
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
 
-        return Result::FAILURE;
+    inline const BufferDesc& GetDesc() const {
+        return m_Desc;
     }
 
-    device = (DeviceBase*)impl;
+    // Host memory is allocated on the first "MapBuffer", commands don't touch it
+    inline uint8_t* Map(uint64_t offset) {
+        if (m_Data.empty())
+            m_Data.resize((size_t)m_Desc.size);
 
-    return Result::SUCCESS;
+        return m_Data.data() + offset;
+    }
+
+private:
+    DeviceNONE& m_Device;
+    BufferDesc m_Desc = {};
+    Vector<uint8_t> m_Data;
+};
+
+struct TextureNONE final {
+    inline TextureNONE(DeviceNONE& device, const TextureDesc& textureDesc)
+        : m_Device(device)
+        , m_Desc(FixTextureDesc(textureDesc)) {
+    }
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+    inline const TextureDesc& GetDesc() const {
+        return m_Desc;
+    }
+
+private:
+    DeviceNONE& m_Device;
+    TextureDesc m_Desc = {};
+};
+
+Result CreateDeviceNONE(const DeviceCreationDesc& desc, DeviceBase*& device) {
+    DeviceNONE* impl = Allocate<DeviceNONE>(desc.allocationCallbacks, desc.callbackInterface, desc.allocationCallbacks, desc.adapterDesc, desc.noneVideoMemoryBudget);
+
+    Result result = impl ? impl->Create() : Result::OUT_OF_MEMORY;
+
+    if (result != Result::SUCCESS) {
+        Destroy(desc.allocationCallbacks, impl);
+        device = nullptr;
+    } else
+        device = (DeviceBase*)impl;
+
+    return result;
 }
 
 //============================================================================================================================================================================================
@@ -231,16 +303,16 @@ static const DeviceDesc& NRI_CALL GetDeviceDesc(const Device& device) {
     return ((DeviceNONE&)device).GetDesc();
 }
 
-static const BufferDesc& NRI_CALL GetBufferDesc(const Buffer&) {
+static const BufferDesc& NRI_CALL GetBufferDesc(const Buffer& buffer) {
     static const BufferDesc bufferDesc = {1};
 
-    return bufferDesc;
+    return &buffer == DummyObject<Buffer>() ? bufferDesc : ((BufferNONE&)buffer).GetDesc();
 }
 
-static const TextureDesc& NRI_CALL GetTextureDesc(const Texture&) {
+static const TextureDesc& NRI_CALL GetTextureDesc(const Texture& texture) {
     static const TextureDesc textureDesc = {TextureType::TEXTURE_1D, TextureUsageBits::NONE, Format::R8_UNORM, 1, 1, 1, 1, 1, 1};
 
-    return textureDesc;
+    return &texture == DummyObject<Texture>() ? textureDesc : ((TextureNONE&)texture).GetDesc();
 }
 
 static FormatSupportBits NRI_CALL GetFormatSupport(const Device&, Format) {
@@ -334,10 +406,14 @@ static void NRI_CALL DestroyCommandBuffer(CommandBuffer*) {
 static void NRI_CALL DestroyDescriptorPool(DescriptorPool*) {
 }
 
-static void NRI_CALL DestroyBuffer(Buffer*) {
+static void NRI_CALL DestroyBuffer(Buffer* buffer) {
+    if (buffer != DummyObject<Buffer>())
+        Destroy((BufferNONE*)buffer);
 }
 
-static void NRI_CALL DestroyTexture(Texture*) {
+static void NRI_CALL DestroyTexture(Texture* texture) {
+    if (texture != DummyObject<Texture>())
+        Destroy((TextureNONE*)texture);
 }
 
 static void NRI_CALL DestroyDescriptor(Descriptor*) {
@@ -372,20 +448,22 @@ static Result NRI_CALL AllocateMemory(Device&, const AllocateMemoryDesc&, Memory
 static void NRI_CALL FreeMemory(Memory*) {
 }
 
-static Result NRI_CALL CreateBuffer(Device&, const BufferDesc&, Buffer*& buffer) {
-    buffer = DummyObject<Buffer>();
+static Result NRI_CALL CreateBuffer(Device& device, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    buffer = (Buffer*)Allocate<BufferNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, bufferDesc);
 
-    return Result::SUCCESS;
+    return buffer ? Result::SUCCESS : Result::OUT_OF_MEMORY;
 }
 
-static Result NRI_CALL CreateTexture(Device&, const TextureDesc&, Texture*& texture) {
-    texture = DummyObject<Texture>();
+static Result NRI_CALL CreateTexture(Device& device, const TextureDesc& textureDesc, Texture*& texture) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    texture = (Texture*)Allocate<TextureNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, textureDesc);
 
-    return Result::SUCCESS;
+    return texture ? Result::SUCCESS : Result::OUT_OF_MEMORY;
 }
 
-static void NRI_CALL GetBufferMemoryDesc(const Buffer&, MemoryLocation, MemoryDesc& memoryDesc) {
-    memoryDesc = {1};
+static void NRI_CALL GetBufferMemoryDesc(const Buffer& buffer, MemoryLocation, MemoryDesc& memoryDesc) {
+    memoryDesc = {std::max(GetBufferDesc(buffer).size, (uint64_t)1), 1};
 }
 
 static void NRI_CALL GetTextureMemoryDesc(const Texture&, MemoryLocation, MemoryDesc& memoryDesc) {
@@ -400,36 +478,40 @@ static Result NRI_CALL BindTextureMemory(const BindTextureMemoryDesc*, uint32_t)
     return Result::SUCCESS;
 }
 
-static void NRI_CALL GetBufferMemoryDesc2(const Device&, const BufferDesc&, MemoryLocation, MemoryDesc& memoryDesc) {
-    memoryDesc = {1};
+static void NRI_CALL GetBufferMemoryDesc2(const Device&, const BufferDesc& bufferDesc, MemoryLocation, MemoryDesc& memoryDesc) {
+    memoryDesc = {std::max(bufferDesc.size, (uint64_t)1), 1};
 }
 
 static void NRI_CALL GetTextureMemoryDesc2(const Device&, const TextureDesc&, MemoryLocation, MemoryDesc& memoryDesc) {
     memoryDesc = {1};
 }
 
-static Result NRI_CALL CreateCommittedBuffer(Device&, MemoryLocation, float, const BufferDesc&, Buffer*& buffer) {
-    buffer = DummyObject<Buffer>();
+static Result NRI_CALL CreateCommittedBuffer(Device& device, MemoryLocation, float, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    buffer = (Buffer*)Allocate<BufferNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, bufferDesc);
 
-    return Result::SUCCESS;
+    return buffer ? Result::SUCCESS : Result::OUT_OF_MEMORY;
 }
 
-static Result NRI_CALL CreateCommittedTexture(Device&, MemoryLocation, float, const TextureDesc&, Texture*& texture) {
-    texture = DummyObject<Texture>();
+static Result NRI_CALL CreateCommittedTexture(Device& device, MemoryLocation, float, const TextureDesc& textureDesc, Texture*& texture) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    texture = (Texture*)Allocate<TextureNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, textureDesc);
 
-    return Result::SUCCESS;
+    return texture ? Result::SUCCESS : Result::OUT_OF_MEMORY;
 }
 
-static Result NRI_CALL CreatePlacedBuffer(Device&, Memory*, uint64_t, const BufferDesc&, Buffer*& buffer) {
-    buffer = DummyObject<Buffer>();
+static Result NRI_CALL CreatePlacedBuffer(Device& device, Memory*, uint64_t, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    buffer = (Buffer*)Allocate<BufferNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, bufferDesc);
 
-    return Result::SUCCESS;
+    return buffer ? Result::SUCCESS : Result::OUT_OF_MEMORY;
 }
 
-static Result NRI_CALL CreatePlacedTexture(Device&, Memory*, uint64_t, const TextureDesc&, Texture*& texture) {
-    texture = DummyObject<Texture>();
+static Result NRI_CALL CreatePlacedTexture(Device& device, Memory*, uint64_t, const TextureDesc& textureDesc, Texture*& texture) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    texture = (Texture*)Allocate<TextureNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, textureDesc);
 
-    return Result::SUCCESS;
+    return texture ? Result::SUCCESS : Result::OUT_OF_MEMORY;
 }
 
 static Result NRI_CALL AllocateDescriptorSets(DescriptorPool&, const PipelineLayout&, uint32_t, DescriptorSet**, uint32_t, uint32_t) {
@@ -505,6 +587,24 @@ static void NRI_CALL CmdSetShadingRate(CommandBuffer&, const ShadingRateDesc&) {
 static void NRI_CALL CmdSetDepthBias(CommandBuffer&, const DepthBiasDesc&) {
 }
 
+static void NRI_CALL CmdSetTopology(CommandBuffer&, Topology, PrimitiveRestart) {
+}
+
+static void NRI_CALL CmdSetCullMode(CommandBuffer&, CullMode) {
+}
+
+static void NRI_CALL CmdSetFrontFace(CommandBuffer&, bool) {
+}
+
+static void NRI_CALL CmdSetDepthState(CommandBuffer&, const DepthAttachmentDesc&) {
+}
+
+static void NRI_CALL CmdSetStencilState(CommandBuffer&, const StencilAttachmentDesc&) {
+}
+
+static void NRI_CALL CmdSetColorState(CommandBuffer&, uint32_t, const ColorAttachmentDesc*, uint32_t) {
+}
+
 static void NRI_CALL CmdBeginRendering(CommandBuffer&, const RenderingDesc&) {
 }
 
@@ -517,6 +617,12 @@ static void NRI_CALL CmdDraw(CommandBuffer&, const DrawDesc&) {
 static void NRI_CALL CmdDrawIndexed(CommandBuffer&, const DrawIndexedDesc&) {
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer&, const DrawDesc*, uint32_t, uint32_t) {
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer&, const DrawIndexedDesc*, uint32_t, uint32_t) {
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer&, const Buffer&, uint64_t, uint32_t, uint32_t, const Buffer*, uint64_t) {
 }
 
@@ -565,26 +671,36 @@ static void NRI_CALL CmdEndQuery(CommandBuffer&, QueryPool&, uint32_t) {
 static void NRI_CALL CmdCopyQueries(CommandBuffer&, const QueryPool&, uint32_t, uint32_t, Buffer&, uint64_t) {
 }
 
-static void NRI_CALL CmdBeginAnnotation(CommandBuffer&, const char*, uint32_t) {
+static void NRI_CALL CmdBeginAnnotation(CommandBuffer&, const char* name, uint32_t bgra) {
+    MaybeUnused(name, bgra);
+    NRI_RECORD_ANNOTATION(COMMAND_BUFFER, BEGIN, name, bgra);
 }
 
 static void NRI_CALL CmdEndAnnotation(CommandBuffer&) {
+    NRI_RECORD_ANNOTATION(COMMAND_BUFFER, END, nullptr, BGRA_UNUSED);
 }
 
-static void NRI_CALL CmdAnnotation(CommandBuffer&, const char*, uint32_t) {
+static void NRI_CALL CmdAnnotation(CommandBuffer&, const char* name, uint32_t bgra) {
+    MaybeUnused(name, bgra);
+    NRI_RECORD_ANNOTATION(COMMAND_BUFFER, MARKER, name, bgra);
 }
 
 static Result NRI_CALL EndCommandBuffer(CommandBuffer&) {
     return Result::SUCCESS;
 }
 
-static void NRI_CALL QueueBeginAnnotation(Queue&, const char*, uint32_t) {
+static void NRI_CALL QueueBeginAnnotation(Queue&, const char* name, uint32_t bgra) {
+    MaybeUnused(name, bgra);
+    NRI_RECORD_ANNOTATION(QUEUE, BEGIN, name, bgra);
 }
 
 static void NRI_CALL QueueEndAnnotation(Queue&) {
+    NRI_RECORD_ANNOTATION(QUEUE, END, nullptr, BGRA_UNUSED);
 }
 
-static void NRI_CALL QueueAnnotation(Queue&, const char*, uint32_t) {
+static void NRI_CALL QueueAnnotation(Queue&, const char* name, uint32_t bgra) {
+    MaybeUnused(name, bgra);
+    NRI_RECORD_ANNOTATION(QUEUE, MARKER, name, bgra);
 }
 
 static void NRI_CALL GetCalibratedTimestamps(Queue&, uint64_t& timestampGPU, uint64_t& timestampCPU) {
@@ -621,8 +737,11 @@ static uint64_t NRI_CALL GetFenceValue(Fence&) {
 static void NRI_CALL ResetCommandAllocator(CommandAllocator&) {
 }
 
-static void* NRI_CALL MapBuffer(Buffer&, uint64_t, uint64_t) {
-    return nullptr;
+static void* NRI_CALL MapBuffer(Buffer& buffer, uint64_t offset, uint64_t) {
+    if (&buffer == DummyObject<Buffer>())
+        return nullptr;
+
+    return ((BufferNONE&)buffer).Map(offset);
 }
 
 static void NRI_CALL UnmapBuffer(Buffer&) {
@@ -736,10 +855,18 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.CmdSetSampleLocations = ::CmdSetSampleLocations;
     table.CmdSetShadingRate = ::CmdSetShadingRate;
     table.CmdSetDepthBias = ::CmdSetDepthBias;
+    table.CmdSetTopology = ::CmdSetTopology;
+    table.CmdSetCullMode = ::CmdSetCullMode;
+    table.CmdSetFrontFace = ::CmdSetFrontFace;
+    table.CmdSetDepthState = ::CmdSetDepthState;
+    table.CmdSetStencilState = ::CmdSetStencilState;
+    table.CmdSetColorState = ::CmdSetColorState;
     table.CmdBeginRendering = ::CmdBeginRendering;
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
     table.CmdEndRendering = ::CmdEndRendering;
@@ -803,17 +930,246 @@ static Result NRI_CALL UploadData(Queue&, const TextureUploadDesc*, uint32_t, co
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL QueryVideoMemoryInfo(const Device&, MemoryLocation, VideoMemoryInfo& videoMemoryInfo) {
+static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation memoryLocation, VideoMemoryInfo& videoMemoryInfo) {
     videoMemoryInfo = {};
 
+    // A fake budget makes residency policies testable
+    if (memoryLocation == MemoryLocation::DEVICE)
+        videoMemoryInfo.budgetSize = ((DeviceNONE&)device).GetVideoMemoryBudget();
+
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL SetMemoryPriority(Memory&, float) {
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL CreateResidencyManager(Device& device, const ResidencyManagerDesc& residencyManagerDesc, ResidencyManager*& residencyManager) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    HelperResidencyManager* impl = Allocate<HelperResidencyManager>(deviceNONE.GetAllocationCallbacks(), device);
+    Result result = impl->Create(residencyManagerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        residencyManager = nullptr;
+    } else
+        residencyManager = (ResidencyManager*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyResidencyManager(ResidencyManager* residencyManager) {
+    Destroy((HelperResidencyManager*)residencyManager);
+}
+
+static uint32_t NRI_CALL TrackMemory(ResidencyManager& residencyManager, Memory& memory, uint64_t size, float priority) {
+    return ((HelperResidencyManager&)residencyManager).TrackMemory(memory, size, priority);
+}
+
+static void NRI_CALL UntrackMemory(ResidencyManager& residencyManager, uint32_t memoryHandle) {
+    ((HelperResidencyManager&)residencyManager).UntrackMemory(memoryHandle);
+}
+
+static void NRI_CALL MarkMemoryUsed(ResidencyManager& residencyManager, const uint32_t* memoryHandles, uint32_t memoryHandleNum) {
+    ((HelperResidencyManager&)residencyManager).MarkMemoryUsed(memoryHandles, memoryHandleNum);
+}
+
+static Result NRI_CALL UpdateResidency(ResidencyManager& residencyManager, ResidencyStats* residencyStats) {
+    return ((HelperResidencyManager&)residencyManager).UpdateResidency(residencyStats);
+}
+
+static Result NRI_CALL CreateDefragmenter(Queue&, const DefragmenterDesc&, Defragmenter*& defragmenter) {
+    defragmenter = DummyObject<Defragmenter>();
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyDefragmenter(Defragmenter*) {
+}
+
+static uint32_t NRI_CALL PlanDefragmentation(Defragmenter&, const DefragmentationDesc&) {
+    return 0;
+}
+
+static Result NRI_CALL DefragmentStep(Defragmenter&, DefragmentationResult& defragmentationResult) {
+    defragmentationResult = {};
+    defragmentationResult.isFinished = true;
+
     return Result::SUCCESS;
 }
 
+static Result NRI_CALL MergePipelineCaches(PipelineCache&, const PipelineCache* const*, uint32_t) {
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL CreatePipelineCacheStore(Device& device, const PipelineCacheStoreDesc& pipelineCacheStoreDesc, PipelineCacheStore*& pipelineCacheStore) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    HelperPipelineCacheStore* impl = Allocate<HelperPipelineCacheStore>(deviceNONE.GetAllocationCallbacks(), device);
+    Result result = impl->Create(pipelineCacheStoreDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        pipelineCacheStore = nullptr;
+    } else
+        pipelineCacheStore = (PipelineCacheStore*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyPipelineCacheStore(PipelineCacheStore* pipelineCacheStore) {
+    Destroy((HelperPipelineCacheStore*)pipelineCacheStore);
+}
+
+static PipelineCache* NRI_CALL GetPipelineCacheStoreCache(const PipelineCacheStore& pipelineCacheStore, uint32_t workerIndex) {
+    return ((HelperPipelineCacheStore&)pipelineCacheStore).GetPipelineCache(workerIndex);
+}
+
+static Result NRI_CALL SavePipelineCacheStore(PipelineCacheStore& pipelineCacheStore, bool async) {
+    return ((HelperPipelineCacheStore&)pipelineCacheStore).Save(async);
+}
+
+static void NRI_CALL GetPipelineCacheStoreStats(const PipelineCacheStore& pipelineCacheStore, PipelineCacheStoreStats& pipelineCacheStoreStats) {
+    ((HelperPipelineCacheStore&)pipelineCacheStore).GetStats(pipelineCacheStoreStats);
+}
+
+static void NRI_CALL GetPipelineLibraryStats(const Device&, PipelineLibraryStats& pipelineLibraryStats) {
+    pipelineLibraryStats = {};
+}
+
+static Result NRI_CALL CreatePipelineCompiler(Device& device, const PipelineCompilerDesc& pipelineCompilerDesc, PipelineCompiler*& pipelineCompiler) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    HelperPipelineCompiler* impl = Allocate<HelperPipelineCompiler>(deviceNONE.GetAllocationCallbacks(), device);
+    Result result = impl->Create(pipelineCompilerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        pipelineCompiler = nullptr;
+    } else
+        pipelineCompiler = (PipelineCompiler*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyPipelineCompiler(PipelineCompiler* pipelineCompiler) {
+    Destroy((HelperPipelineCompiler*)pipelineCompiler);
+}
+
+static uint32_t NRI_CALL CompileGraphicsPipelineAsync(PipelineCompiler& pipelineCompiler, const GraphicsPipelineDesc& graphicsPipelineDesc) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).Compile(graphicsPipelineDesc);
+}
+
+static uint32_t NRI_CALL CompileComputePipelineAsync(PipelineCompiler& pipelineCompiler, const ComputePipelineDesc& computePipelineDesc) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).Compile(computePipelineDesc);
+}
+
+static bool NRI_CALL IsPipelineReady(const PipelineCompiler& pipelineCompiler, uint32_t pipelineHandle) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).IsReady(pipelineHandle);
+}
+
+static Pipeline* NRI_CALL AcquirePipeline(const PipelineCompiler& pipelineCompiler, uint32_t pipelineHandle, Pipeline* substitute) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).Acquire(pipelineHandle, substitute);
+}
+
+static void NRI_CALL ReleasePipeline(PipelineCompiler& pipelineCompiler, uint32_t pipelineHandle) {
+    ((HelperPipelineCompiler&)pipelineCompiler).Release(pipelineHandle);
+}
+
+static Result NRI_CALL GetPipelineFeedback(const Pipeline&, PipelineFeedback& pipelineFeedback) {
+    pipelineFeedback = {};
+
+    return Result::UNSUPPORTED;
+}
+
+static void NRI_CALL GetPipelineFeedbackStats(const Device&, PipelineFeedbackStats& pipelineFeedbackStats) {
+    pipelineFeedbackStats = {};
+}
+
+static Result NRI_CALL CreateBindlessAllocator(Device& device, const BindlessAllocatorDesc& bindlessAllocatorDesc, BindlessAllocator*& bindlessAllocator) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    HelperBindlessAllocator* impl = Allocate<HelperBindlessAllocator>(deviceNONE.GetAllocationCallbacks(), device);
+    Result result = impl->Create(bindlessAllocatorDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        bindlessAllocator = nullptr;
+    } else
+        bindlessAllocator = (BindlessAllocator*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyBindlessAllocator(BindlessAllocator* bindlessAllocator) {
+    Destroy((HelperBindlessAllocator*)bindlessAllocator);
+}
+
+static DescriptorSet* NRI_CALL GetBindlessDescriptorSet(const BindlessAllocator& bindlessAllocator, uint32_t classIndex) {
+    return ((HelperBindlessAllocator&)bindlessAllocator).GetDescriptorSet(classIndex);
+}
+
+static Result NRI_CALL AllocateBindlessIndex(BindlessAllocator& bindlessAllocator, uint32_t classIndex, uint32_t& index) {
+    return ((HelperBindlessAllocator&)bindlessAllocator).AllocateIndex(classIndex, index);
+}
+
+static void NRI_CALL ReleaseBindlessIndex(BindlessAllocator& bindlessAllocator, uint32_t classIndex, uint32_t index) {
+    ((HelperBindlessAllocator&)bindlessAllocator).ReleaseIndex(classIndex, index);
+}
+
+static void NRI_CALL SetBindlessDescriptor(BindlessAllocator& bindlessAllocator, uint32_t classIndex, uint32_t index, const Descriptor& descriptor) {
+    ((HelperBindlessAllocator&)bindlessAllocator).SetDescriptor(classIndex, index, descriptor);
+}
+
+static void NRI_CALL UpdateBindlessAllocator(BindlessAllocator& bindlessAllocator, uint64_t completedFrameNum) {
+    ((HelperBindlessAllocator&)bindlessAllocator).Update(completedFrameNum);
+}
+
+static void NRI_CALL GetRedundantCommandStats(const Device&, RedundantCommandStats& redundantCommandStats) {
+    redundantCommandStats = {};
+}
+
+static void NRI_CALL InvalidateCommandBufferState(CommandBuffer&) {
+}
+
 Result DeviceNONE::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.SetMemoryPriority = ::SetMemoryPriority;
+    table.CreateResidencyManager = ::CreateResidencyManager;
+    table.DestroyResidencyManager = ::DestroyResidencyManager;
+    table.TrackMemory = ::TrackMemory;
+    table.UntrackMemory = ::UntrackMemory;
+    table.MarkMemoryUsed = ::MarkMemoryUsed;
+    table.UpdateResidency = ::UpdateResidency;
+    table.CreateDefragmenter = ::CreateDefragmenter;
+    table.DestroyDefragmenter = ::DestroyDefragmenter;
+    table.PlanDefragmentation = ::PlanDefragmentation;
+    table.DefragmentStep = ::DefragmentStep;
+    table.MergePipelineCaches = ::MergePipelineCaches;
+    table.CreatePipelineCacheStore = ::CreatePipelineCacheStore;
+    table.DestroyPipelineCacheStore = ::DestroyPipelineCacheStore;
+    table.GetPipelineCacheStoreCache = ::GetPipelineCacheStoreCache;
+    table.SavePipelineCacheStore = ::SavePipelineCacheStore;
+    table.GetPipelineCacheStoreStats = ::GetPipelineCacheStoreStats;
+    table.GetPipelineLibraryStats = ::GetPipelineLibraryStats;
+    table.CreatePipelineCompiler = ::CreatePipelineCompiler;
+    table.DestroyPipelineCompiler = ::DestroyPipelineCompiler;
+    table.CompileGraphicsPipelineAsync = ::CompileGraphicsPipelineAsync;
+    table.CompileComputePipelineAsync = ::CompileComputePipelineAsync;
+    table.IsPipelineReady = ::IsPipelineReady;
+    table.AcquirePipeline = ::AcquirePipeline;
+    table.ReleasePipeline = ::ReleasePipeline;
+    table.GetPipelineFeedback = ::GetPipelineFeedback;
+    table.GetPipelineFeedbackStats = ::GetPipelineFeedbackStats;
+    table.CreateBindlessAllocator = ::CreateBindlessAllocator;
+    table.DestroyBindlessAllocator = ::DestroyBindlessAllocator;
+    table.GetBindlessDescriptorSet = ::GetBindlessDescriptorSet;
+    table.AllocateBindlessIndex = ::AllocateBindlessIndex;
+    table.ReleaseBindlessIndex = ::ReleaseBindlessIndex;
+    table.SetBindlessDescriptor = ::SetBindlessDescriptor;
+    table.UpdateBindlessAllocator = ::UpdateBindlessAllocator;
+    table.GetRedundantCommandStats = ::GetRedundantCommandStats;
+    table.InvalidateCommandBufferState = ::InvalidateCommandBufferState;
 
     return Result::SUCCESS;
 }
@@ -856,19 +1212,31 @@ Result DeviceNONE::FillFunctionTable(ImguiInterface& table) const {
 //============================================================================================================================================================================================
 #pragma region[  LowLatency  ]
 
-static Result NRI_CALL SetLatencySleepMode(SwapChain&, const LatencySleepMode&) {
+static Result NRI_CALL SetLatencySleepMode(SwapChain& swapChain, const LatencySleepMode& latencySleepMode) {
+    if (IsVirtualSwapChain(swapChain))
+        return ((SwapChainVirtual&)swapChain).SetLatencySleepMode(latencySleepMode);
+
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL SetLatencyMarker(SwapChain&, uint64_t, LatencyMarker) {
+static Result NRI_CALL SetLatencyMarker(SwapChain& swapChain, uint64_t presentId, LatencyMarker latencyMarker) {
+    if (IsVirtualSwapChain(swapChain))
+        return ((SwapChainVirtual&)swapChain).SetLatencyMarker(presentId, latencyMarker);
+
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL LatencySleep(SwapChain&, uint64_t) {
+static Result NRI_CALL LatencySleep(SwapChain& swapChain, uint64_t presentId) {
+    if (IsVirtualSwapChain(swapChain))
+        return ((SwapChainVirtual&)swapChain).LatencySleep(presentId);
+
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL GetLatencyReport(const SwapChain&, LatencyReport&) {
+static Result NRI_CALL GetLatencyReport(const SwapChain& swapChain, LatencyReport& latencyReport) {
+    if (IsVirtualSwapChain(swapChain))
+        return ((SwapChainVirtual&)swapChain).GetLatencyReport(latencyReport);
+
     return Result::SUCCESS;
 }
 
@@ -1089,35 +1457,58 @@ Result DeviceNONE::FillFunctionTable(RayTracingInterface& table) const {
 //============================================================================================================================================================================================
 #pragma region[  Streamer  ]
 
-static Result NRI_CALL CreateStreamer(Device&, const StreamerDesc&, Streamer*& streamer) {
-    streamer = DummyObject<Streamer>();
+static Result NRI_CALL CreateStreamer(Device& device, const StreamerDesc& streamerDesc, Streamer*& streamer) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    StreamerImpl* impl = Allocate<StreamerImpl>(deviceNONE.GetAllocationCallbacks(), device, deviceNONE.GetCoreInterface());
+    Result result = impl->Create(streamerDesc);
 
-    return Result::SUCCESS;
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        streamer = nullptr;
+    } else
+        streamer = (Streamer*)impl;
+
+    return result;
 }
 
-static void NRI_CALL DestroyStreamer(Streamer*) {
+static void NRI_CALL DestroyStreamer(Streamer* streamer) {
+    Destroy((StreamerImpl*)streamer);
 }
 
-static Buffer* NRI_CALL GetStreamerConstantBuffer(Streamer&) {
-    return nullptr;
+static Buffer* NRI_CALL GetStreamerConstantBuffer(Streamer& streamer) {
+    return ((StreamerImpl&)streamer).GetConstantBuffer();
 }
 
-static uint32_t NRI_CALL StreamConstantData(Streamer&, const void*, uint32_t) {
-    return 0;
+static uint32_t NRI_CALL StreamConstantData(Streamer& streamer, const void* data, uint32_t dataSize) {
+    return ((StreamerImpl&)streamer).StreamConstantData(data, dataSize);
+}
+
+static BufferOffset NRI_CALL StreamBufferData(Streamer& streamer, const StreamBufferDataDesc& streamBufferDataDesc) {
+    return ((StreamerImpl&)streamer).StreamBufferData(streamBufferDataDesc);
+}
+
+static BufferOffset NRI_CALL StreamTextureData(Streamer& streamer, const StreamTextureDataDesc& streamTextureDataDesc) {
+    return ((StreamerImpl&)streamer).StreamTextureData(streamTextureDataDesc);
+}
+
+static void NRI_CALL EndStreamerFrame(Streamer& streamer) {
+    ((StreamerImpl&)streamer).EndFrame();
 }
 
-static BufferOffset NRI_CALL StreamBufferData(Streamer&, const StreamBufferDataDesc&) {
-    return {};
+static void NRI_CALL CmdCopyStreamedData(CommandBuffer& commandBuffer, Streamer& streamer) {
+    ((StreamerImpl&)streamer).CmdCopyStreamedData(commandBuffer);
 }
 
-static BufferOffset NRI_CALL StreamTextureData(Streamer&, const StreamTextureDataDesc&) {
-    return {};
+static uint64_t NRI_CALL CmdReadbackBuffer(CommandBuffer& commandBuffer, Streamer& streamer, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    return ((StreamerImpl&)streamer).CmdReadbackBuffer(commandBuffer, srcBuffer, srcOffset, size);
 }
 
-static void NRI_CALL EndStreamerFrame(Streamer&) {
+static uint64_t NRI_CALL CmdReadbackTexture(CommandBuffer& commandBuffer, Streamer& streamer, const Texture& srcTexture, const TextureRegionDesc& srcRegion, TextureDataLayoutDesc& dataLayout) {
+    return ((StreamerImpl&)streamer).CmdReadbackTexture(commandBuffer, srcTexture, srcRegion, dataLayout);
 }
 
-static void NRI_CALL CmdCopyStreamedData(CommandBuffer&, Streamer&) {
+static const void* NRI_CALL TryGetReadbackData(Streamer& streamer, uint64_t ticket) {
+    return ((StreamerImpl&)streamer).TryGetReadbackData(ticket);
 }
 
 Result DeviceNONE::FillFunctionTable(StreamerInterface& table) const {
@@ -1129,6 +1520,9 @@ Result DeviceNONE::FillFunctionTable(StreamerInterface& table) const {
     table.StreamConstantData = ::StreamConstantData;
     table.EndStreamerFrame = ::EndStreamerFrame;
     table.CmdCopyStreamedData = ::CmdCopyStreamedData;
+    table.CmdReadbackBuffer = ::CmdReadbackBuffer;
+    table.CmdReadbackTexture = ::CmdReadbackTexture;
+    table.TryGetReadbackData = ::TryGetReadbackData;
 
     return Result::SUCCESS;
 }
@@ -1138,39 +1532,70 @@ Result DeviceNONE::FillFunctionTable(StreamerInterface& table) const {
 //============================================================================================================================================================================================
 #pragma region[  SwapChain  ]
 
-static Result NRI_CALL CreateSwapChain(Device&, const SwapChainDesc&, SwapChain*& swapChain) {
-    swapChain = DummyObject<SwapChain>();
+static Result NRI_CALL CreateSwapChain(Device& device, const SwapChainDesc& swapChainDesc, SwapChain*& swapChain) {
+    if (!(swapChainDesc.flags & SwapChainBits::VIRTUAL)) {
+        swapChain = DummyObject<SwapChain>();
 
-    return Result::SUCCESS;
+        return Result::SUCCESS;
+    }
+
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    SwapChainVirtual* impl = Allocate<SwapChainVirtual>(deviceNONE.GetAllocationCallbacks(), deviceNONE);
+    Result result = impl->Create(swapChainDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        swapChain = nullptr;
+    } else
+        swapChain = (SwapChain*)impl;
+
+    return result;
 }
 
-static void NRI_CALL DestroySwapChain(SwapChain*) {
+static void NRI_CALL DestroySwapChain(SwapChain* swapChain) {
+    if (swapChain && IsVirtualSwapChain(*swapChain))
+        Destroy((SwapChainVirtual*)swapChain);
 }
 
-static Texture* const* NRI_CALL GetSwapChainTextures(const SwapChain&, uint32_t& textureNum) {
-    static const void* textures[1] = {};
+static Texture* const* NRI_CALL GetSwapChainTextures(const SwapChain& swapChain, uint32_t& textureNum) {
+    if (IsVirtualSwapChain(swapChain))
+        return ((SwapChainVirtual&)swapChain).GetTextures(textureNum);
+
+    static Texture* const textures[1] = {DummyObject<Texture>()};
     textureNum = 1;
 
-    return (Texture**)textures;
+    return textures;
 }
 
-static Result NRI_CALL GetDisplayDesc(SwapChain&, DisplayDesc& displayDesc) {
+static Result NRI_CALL GetDisplayDesc(SwapChain& swapChain, DisplayDesc& displayDesc) {
+    if (IsVirtualSwapChain(swapChain))
+        return ((SwapChainVirtual&)swapChain).GetDisplayDesc(displayDesc);
+
     displayDesc = {};
 
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL AcquireNextTexture(SwapChain&, Fence&, uint32_t& textureIndex) {
+static Result NRI_CALL AcquireNextTexture(SwapChain& swapChain, Fence& acquireSemaphore, uint32_t& textureIndex) {
+    if (IsVirtualSwapChain(swapChain))
+        return ((SwapChainVirtual&)swapChain).AcquireNextTexture(acquireSemaphore, textureIndex);
+
     textureIndex = 0;
 
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL WaitForPresent(SwapChain&, uint64_t) {
+static Result NRI_CALL WaitForPresent(SwapChain& swapChain, uint64_t presentId) {
+    if (IsVirtualSwapChain(swapChain))
+        return ((SwapChainVirtual&)swapChain).WaitForPresent(presentId);
+
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL QueuePresent(SwapChain&, Fence&, uint64_t) {
+static Result NRI_CALL QueuePresent(SwapChain& swapChain, Fence& releaseSemaphore, uint64_t presentId) {
+    if (IsVirtualSwapChain(swapChain))
+        return ((SwapChainVirtual&)swapChain).Present(releaseSemaphore, presentId);
+
     return Result::SUCCESS;
 }
 
@@ -9,6 +9,11 @@
 //#define NRI_MAX_MESSAGE_LENGTH       2048u     // 2 Kb
 //#define NRI_ZERO_BUFFER_SIZE         4194304u  // 4 Mb
 //#define NRI_MAX_STACK_ALLOC_SIZE     32768u    // 32 Kb
+//#define NRI_MAX_SCRATCH_ARENA_SIZE   4194304u  // 4 Mb, per thread per device
+//#define NRI_SCRATCH_ARENA_TRIM_SIZE  262144u   // 256 Kb, larger arenas get released if mostly unused for a while
+//#define NRI_ANNOTATION_RING_SIZE     16384u    // records per thread, used if "NRI_ENABLE_ANNOTATION_RECORDER" is ON
+//#define NRI_VAL_SLAB_OBJECT_NUM      64u       // validation wrappers per slab
+//#define NRI_VAL_INLINE_NAME_SIZE     32u       // shorter validation debug names (including the terminator) are stored in place
 //#define NRI_FILE_SEPARATOR           '\\'      // path separator used in messages
 //#define NRI_INLINE                   inline    // we want to inline all functions, which are actually wrappers for the interface functions
 
@@ -0,0 +1,1643 @@
+// © 2021 NVIDIA Corporation
+
+// Replays a capture recorded via "DeviceCreationDesc::captureFileName" and reports CPU time spent in NRI calls:
+//   NRI_Replay <capture file> [--api NONE|D3D11|D3D12|VK|WGPU] [--validation] [--runs N] [--json <output file>]
+// JSON output is meant for tracking per-call CPU cost over time (for example, NONE vs Validation vs VK on a software driver)
+// Notes:
+// - replay is single-threaded, records from all threads are executed in the captured call order
+// - host data is not captured: uploads and "MapBuffer" work with uninitialized memory
+// - swap chains are replayed as virtual swap chains ("SwapChainBits::VIRTUAL") on the virtual clock, i.e. presentation doesn't sleep
+// - without "SwapChainInterface" swap chain textures are replaced with regular textures and presentation is skipped
+// - ray tracing instance data is host data: acceleration structure handles in instances are not remapped
+// - memory types are remapped using captured "Get*MemoryDesc*" calls
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "NRI.h"
+
+#include "Extensions/NRIDeviceCreation.h"
+#include "Extensions/NRIHelper.h" // nriGetFormatProps
+#include "Extensions/NRILowLatency.h"
+#include "Extensions/NRIMeshShader.h"
+#include "Extensions/NRIRayTracing.h"
+#include "Extensions/NRISwapChain.h"
+
+#include "CaptureStream.h"
+
+using namespace nri;
+
+typedef std::unordered_map<uint64_t, void*> HandleMap;
+
+// Pass 3: reading (pointers are redirected into the loaded file, handles are remapped)
+struct CaptureReader {
+    inline CaptureReader(uint8_t* src, const HandleMap& handles)
+        : m_Src(src)
+        , m_Handles(handles) {
+    }
+
+    template <typename T>
+    inline void Value(T& value) {
+        memcpy((void*)&value, m_Src, sizeof(T));
+        m_Src += CaptureAlign(sizeof(T));
+    }
+
+    template <typename T>
+    inline std::remove_const_t<T>* Array(T*& ptr, uint64_t num) {
+        if (ptr && num) {
+            ptr = (T*)m_Src;
+            m_Src += CaptureAlign(sizeof(T) * num);
+        } else
+            ptr = nullptr;
+
+        return (std::remove_const_t<T>*)ptr;
+    }
+
+    inline void String(const char*& str) {
+        if (str) {
+            uint64_t len = 0;
+            memcpy(&len, m_Src, sizeof(len));
+            str = (const char*)m_Src + sizeof(len);
+            m_Src += CaptureAlign(sizeof(len) + len + 1);
+        }
+    }
+
+    inline void Blob(const void*& data, uint64_t dataSize) {
+        if (data && dataSize) {
+            data = m_Src;
+            m_Src += CaptureAlign(dataSize);
+        } else
+            data = nullptr;
+    }
+
+    template <typename T>
+    inline void Handle(T*& handle) {
+        if (!handle)
+            return;
+
+        auto it = m_Handles.find((uint64_t)(size_t)handle);
+        if (it == m_Handles.end()) {
+            handle = nullptr;
+            isMissing = true;
+        } else
+            handle = (T*)it->second;
+    }
+
+    bool isMissing = false;
+
+private:
+    uint8_t* m_Src;
+    const HandleMap& m_Handles;
+};
+
+struct ReplayRecord {
+    uint64_t seq;
+    uint8_t* payload;
+    CaptureOp op;
+};
+
+struct ReplayStats {
+    uint64_t num;
+    uint64_t totalNs;
+};
+
+struct Replayer {
+    template <typename... Args>
+    inline bool Read(const ReplayRecord& record, Args&... args) {
+        CaptureReader reader(record.payload, handles);
+        (SerializeArg(reader, args), ...);
+
+        return !reader.isMissing;
+    }
+
+    template <typename Func>
+    inline void Measure(CaptureOp op, Func&& func) {
+        auto begin = std::chrono::steady_clock::now();
+        func();
+        auto end = std::chrono::steady_clock::now();
+
+        ReplayStats& stat = stats[(size_t)op];
+        stat.num++;
+        stat.totalNs += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    }
+
+    template <typename T>
+    inline void Map(uint64_t id, T* handle) {
+        handles[id] = (void*)handle;
+    }
+
+    inline MemoryType RemapMemoryType(MemoryType capturedType) const {
+        auto it = memoryTypes.find(capturedType);
+
+        return it == memoryTypes.end() ? capturedType : it->second;
+    }
+
+    // An upper bound for a host copy of any region of the texture
+    inline void* GetHostScratch(const Texture& texture, uint32_t rowPitch, uint32_t slicePitch) {
+        const TextureDesc& textureDesc = core.GetTextureDesc(texture);
+        const FormatProps& formatProps = *nriGetFormatProps(textureDesc.format);
+
+        uint64_t blockWidth = std::max<uint64_t>(formatProps.blockWidth, 1);
+        uint64_t blockHeight = std::max<uint64_t>(formatProps.blockHeight, 1);
+        uint64_t rowNum = (std::max<uint64_t>(textureDesc.height, 1) + blockHeight - 1) / blockHeight;
+        uint64_t rowSize = rowPitch ? rowPitch : (textureDesc.width + blockWidth - 1) / blockWidth * formatProps.stride;
+        uint64_t sliceSize = slicePitch ? slicePitch : rowSize * rowNum;
+        uint64_t size = sliceSize * std::max<uint64_t>(textureDesc.depth, 1);
+
+        if (hostScratch.size() < size)
+            hostScratch.resize(size);
+
+        return hostScratch.data();
+    }
+
+    bool Execute(const ReplayRecord& record);
+
+    CoreInterface core = {};
+    LowLatencyInterface lowLatency = {};
+    MeshShaderInterface meshShader = {};
+    RayTracingInterface rayTracing = {};
+    SwapChainInterface swapChain = {};
+    HandleMap handles;
+    std::unordered_map<MemoryType, MemoryType> memoryTypes;
+    std::vector<uint8_t> hostScratch;
+    ReplayStats stats[(size_t)CaptureOp::MAX_NUM] = {};
+    Device* device = nullptr;
+    uint64_t skippedNum = 0;
+};
+
+// Swap chain semaphores are mapped to NULL and don't participate in submits if swap chains are not replayed
+static void RemoveNullFences(const FenceSubmitDesc*& fences, uint32_t& fenceNum, std::vector<FenceSubmitDesc>& storage) {
+    storage.clear();
+    for (uint32_t i = 0; i < fenceNum; i++) {
+        if (fences[i].fence)
+            storage.push_back(fences[i]);
+    }
+
+    fences = storage.data();
+    fenceNum = (uint32_t)storage.size();
+}
+
+#define CREATE_OP(name, DescType, HandleType) \
+    case CaptureOp::name: { \
+        Device* dev = nullptr; \
+        DescType desc = {}; \
+        uint64_t id = 0; \
+        if (!Read(record, dev, desc, id)) \
+            return false; \
+        HandleType* handle = nullptr; \
+        Measure(record.op, [&]() { core.name(*dev, desc, handle); }); \
+        Map(id, handle); \
+    } break
+
+#define DESTROY_OP(name, HandleType) \
+    case CaptureOp::name: { \
+        HandleType* handle = nullptr; \
+        if (!Read(record, handle)) \
+            return false; \
+        Measure(record.op, [&]() { core.name(handle); }); \
+    } break
+
+#define CMD_OP(name, DescType) \
+    case CaptureOp::name: { \
+        CommandBuffer* commandBuffer = nullptr; \
+        DescType desc = {}; \
+        if (!Read(record, commandBuffer, desc)) \
+            return false; \
+        Measure(record.op, [&]() { core.name(*commandBuffer, desc); }); \
+    } break
+
+#define CMD_INDIRECT_OP(name, iface) \
+    case CaptureOp::name: { \
+        if (!iface.name) \
+            return false; \
+        CommandBuffer* commandBuffer = nullptr; \
+        const Buffer* buffer = nullptr; \
+        uint64_t offset = 0; \
+        uint32_t drawNum = 0; \
+        uint32_t stride = 0; \
+        const Buffer* countBuffer = nullptr; \
+        uint64_t countBufferOffset = 0; \
+        if (!Read(record, commandBuffer, buffer, offset, drawNum, stride, countBuffer, countBufferOffset)) \
+            return false; \
+        Measure(record.op, [&]() { iface.name(*commandBuffer, *buffer, offset, drawNum, stride, countBuffer, countBufferOffset); }); \
+    } break
+
+#define RT_CREATE_OP(name, DescType, HandleType) \
+    case CaptureOp::name: { \
+        Device* dev = nullptr; \
+        DescType desc = {}; \
+        uint64_t id = 0; \
+        if (!Read(record, dev, desc, id)) \
+            return false; \
+        HandleType* handle = nullptr; \
+        Measure(record.op, [&]() { rayTracing.name(*dev, desc, handle); }); \
+        Map(id, handle); \
+    } break
+
+#define ANNOTATION_OP(name, ObjectType) \
+    case CaptureOp::name: { \
+        ObjectType* object = nullptr; \
+        CaptureString str = {}; \
+        uint32_t bgra = 0; \
+        if (!Read(record, object, str, bgra)) \
+            return false; \
+        Measure(record.op, [&]() { core.name(*object, str.str, bgra); }); \
+    } break
+
+#define QUERY_OP(name) \
+    case CaptureOp::name: { \
+        CommandBuffer* commandBuffer = nullptr; \
+        QueryPool* queryPool = nullptr; \
+        uint32_t offset = 0; \
+        if (!Read(record, commandBuffer, queryPool, offset)) \
+            return false; \
+        Measure(record.op, [&]() { core.name(*commandBuffer, *queryPool, offset); }); \
+    } break
+
+// Returns "false" if the record references an unknown object
+bool Replayer::Execute(const ReplayRecord& record) {
+    // Ray tracing ops are contiguous
+    if (record.op >= CaptureOp::CreateRayTracingPipeline && record.op <= CaptureOp::CmdDispatchRaysIndirect && !rayTracing.CreateRayTracingPipeline)
+        return false;
+
+    switch (record.op) {
+        case CaptureOp::GetQueue: {
+            Device* dev = nullptr;
+            QueueType queueType = QueueType::GRAPHICS;
+            uint32_t queueIndex = 0;
+            uint64_t id = 0;
+            if (!Read(record, dev, queueType, queueIndex, id))
+                return false;
+
+            Queue* queue = nullptr;
+            Measure(record.op, [&]() { core.GetQueue(*dev, queueType, queueIndex, queue); });
+            Map(id, queue);
+        } break;
+
+        case CaptureOp::CreateCommandAllocator: {
+            Queue* queue = nullptr;
+            uint64_t id = 0;
+            if (!Read(record, queue, id))
+                return false;
+
+            CommandAllocator* commandAllocator = nullptr;
+            Measure(record.op, [&]() { core.CreateCommandAllocator(*queue, commandAllocator); });
+            Map(id, commandAllocator);
+        } break;
+
+        case CaptureOp::CreateCommandBuffer: {
+            CommandAllocator* commandAllocator = nullptr;
+            uint64_t id = 0;
+            if (!Read(record, commandAllocator, id))
+                return false;
+
+            CommandBuffer* commandBuffer = nullptr;
+            Measure(record.op, [&]() { core.CreateCommandBuffer(*commandAllocator, commandBuffer); });
+            Map(id, commandBuffer);
+        } break;
+
+        case CaptureOp::CreateFence: {
+            Device* dev = nullptr;
+            uint64_t initialValue = 0;
+            uint64_t id = 0;
+            if (!Read(record, dev, initialValue, id))
+                return false;
+
+            Fence* fence = nullptr;
+            if (initialValue != SWAPCHAIN_SEMAPHORE || swapChain.CreateSwapChain)
+                Measure(record.op, [&]() { core.CreateFence(*dev, initialValue, fence); });
+            Map(id, fence);
+        } break;
+
+            CREATE_OP(CreateDescriptorPool, DescriptorPoolDesc, DescriptorPool);
+            CREATE_OP(CreatePipelineLayout, PipelineLayoutDesc, PipelineLayout);
+            CREATE_OP(CreateGraphicsPipeline, GraphicsPipelineDesc, Pipeline);
+            CREATE_OP(CreateComputePipeline, ComputePipelineDesc, Pipeline);
+            CREATE_OP(CreatePipelineCache, PipelineCacheDesc, PipelineCache);
+            CREATE_OP(CreateQueryPool, QueryPoolDesc, QueryPool);
+            CREATE_OP(CreateSampler, SamplerDesc, Descriptor);
+            CREATE_OP(CreateBuffer, BufferDesc, Buffer);
+            CREATE_OP(CreateTexture, TextureDesc, Texture);
+
+        case CaptureOp::CreateBufferView: {
+            BufferViewDesc desc = {};
+            uint64_t id = 0;
+            if (!Read(record, desc, id))
+                return false;
+
+            Descriptor* descriptor = nullptr;
+            Measure(record.op, [&]() { core.CreateBufferView(desc, descriptor); });
+            Map(id, descriptor);
+        } break;
+
+        case CaptureOp::CreateTextureView: {
+            TextureViewDesc desc = {};
+            uint64_t id = 0;
+            if (!Read(record, desc, id))
+                return false;
+
+            Descriptor* descriptor = nullptr;
+            Measure(record.op, [&]() { core.CreateTextureView(desc, descriptor); });
+            Map(id, descriptor);
+        } break;
+
+            DESTROY_OP(DestroyCommandAllocator, CommandAllocator);
+            DESTROY_OP(DestroyCommandBuffer, CommandBuffer);
+            DESTROY_OP(DestroyDescriptorPool, DescriptorPool);
+            DESTROY_OP(DestroyBuffer, Buffer);
+            DESTROY_OP(DestroyTexture, Texture);
+            DESTROY_OP(DestroyDescriptor, Descriptor);
+            DESTROY_OP(DestroyPipelineLayout, PipelineLayout);
+            DESTROY_OP(DestroyPipeline, Pipeline);
+            DESTROY_OP(DestroyPipelineCache, PipelineCache);
+            DESTROY_OP(DestroyQueryPool, QueryPool);
+            DESTROY_OP(DestroyFence, Fence);
+            DESTROY_OP(FreeMemory, Memory);
+
+        case CaptureOp::AllocateMemory: {
+            Device* dev = nullptr;
+            AllocateMemoryDesc desc = {};
+            uint64_t id = 0;
+            if (!Read(record, dev, desc, id))
+                return false;
+
+            desc.type = RemapMemoryType(desc.type);
+
+            Memory* memory = nullptr;
+            Measure(record.op, [&]() { core.AllocateMemory(*dev, desc, memory); });
+            Map(id, memory);
+        } break;
+
+        case CaptureOp::GetBufferMemoryDesc: {
+            const Buffer* buffer = nullptr;
+            MemoryLocation memoryLocation = MemoryLocation::DEVICE;
+            MemoryDesc capturedMemoryDesc = {};
+            if (!Read(record, buffer, memoryLocation, capturedMemoryDesc))
+                return false;
+
+            MemoryDesc memoryDesc = {};
+            Measure(record.op, [&]() { core.GetBufferMemoryDesc(*buffer, memoryLocation, memoryDesc); });
+            memoryTypes[capturedMemoryDesc.type] = memoryDesc.type;
+        } break;
+
+        case CaptureOp::GetTextureMemoryDesc: {
+            const Texture* texture = nullptr;
+            MemoryLocation memoryLocation = MemoryLocation::DEVICE;
+            MemoryDesc capturedMemoryDesc = {};
+            if (!Read(record, texture, memoryLocation, capturedMemoryDesc))
+                return false;
+
+            MemoryDesc memoryDesc = {};
+            Measure(record.op, [&]() { core.GetTextureMemoryDesc(*texture, memoryLocation, memoryDesc); });
+            memoryTypes[capturedMemoryDesc.type] = memoryDesc.type;
+        } break;
+
+        case CaptureOp::GetBufferMemoryDesc2: {
+            const Device* dev = nullptr;
+            BufferDesc desc = {};
+            MemoryLocation memoryLocation = MemoryLocation::DEVICE;
+            MemoryDesc capturedMemoryDesc = {};
+            if (!Read(record, dev, desc, memoryLocation, capturedMemoryDesc))
+                return false;
+
+            MemoryDesc memoryDesc = {};
+            Measure(record.op, [&]() { core.GetBufferMemoryDesc2(*dev, desc, memoryLocation, memoryDesc); });
+            memoryTypes[capturedMemoryDesc.type] = memoryDesc.type;
+        } break;
+
+        case CaptureOp::GetTextureMemoryDesc2: {
+            const Device* dev = nullptr;
+            TextureDesc desc = {};
+            MemoryLocation memoryLocation = MemoryLocation::DEVICE;
+            MemoryDesc capturedMemoryDesc = {};
+            if (!Read(record, dev, desc, memoryLocation, capturedMemoryDesc))
+                return false;
+
+            MemoryDesc memoryDesc = {};
+            Measure(record.op, [&]() { core.GetTextureMemoryDesc2(*dev, desc, memoryLocation, memoryDesc); });
+            memoryTypes[capturedMemoryDesc.type] = memoryDesc.type;
+        } break;
+
+        case CaptureOp::BindBufferMemory: {
+            CaptureArray<const BindBufferMemoryDesc> descs = {};
+            if (!Read(record, descs))
+                return false;
+
+            Measure(record.op, [&]() { core.BindBufferMemory(descs.ptr, (uint32_t)descs.num); });
+        } break;
+
+        case CaptureOp::BindTextureMemory: {
+            CaptureArray<const BindTextureMemoryDesc> descs = {};
+            if (!Read(record, descs))
+                return false;
+
+            Measure(record.op, [&]() { core.BindTextureMemory(descs.ptr, (uint32_t)descs.num); });
+        } break;
+
+        case CaptureOp::CreateCommittedBuffer: {
+            Device* dev = nullptr;
+            MemoryLocation memoryLocation = MemoryLocation::DEVICE;
+            float priority = 0.0f;
+            BufferDesc desc = {};
+            uint64_t id = 0;
+            if (!Read(record, dev, memoryLocation, priority, desc, id))
+                return false;
+
+            Buffer* buffer = nullptr;
+            Measure(record.op, [&]() { core.CreateCommittedBuffer(*dev, memoryLocation, priority, desc, buffer); });
+            Map(id, buffer);
+        } break;
+
+        case CaptureOp::CreateCommittedTexture: {
+            Device* dev = nullptr;
+            MemoryLocation memoryLocation = MemoryLocation::DEVICE;
+            float priority = 0.0f;
+            TextureDesc desc = {};
+            uint64_t id = 0;
+            if (!Read(record, dev, memoryLocation, priority, desc, id))
+                return false;
+
+            Texture* texture = nullptr;
+            Measure(record.op, [&]() { core.CreateCommittedTexture(*dev, memoryLocation, priority, desc, texture); });
+            Map(id, texture);
+        } break;
+
+        case CaptureOp::CreatePlacedBuffer: {
+            Device* dev = nullptr;
+            Memory* memory = nullptr;
+            uint64_t offset = 0;
+            BufferDesc desc = {};
+            uint64_t id = 0;
+            if (!Read(record, dev, memory, offset, desc, id))
+                return false;
+
+            Buffer* buffer = nullptr;
+            Measure(record.op, [&]() { core.CreatePlacedBuffer(*dev, memory, offset, desc, buffer); });
+            Map(id, buffer);
+        } break;
+
+        case CaptureOp::CreatePlacedTexture: {
+            Device* dev = nullptr;
+            Memory* memory = nullptr;
+            uint64_t offset = 0;
+            TextureDesc desc = {};
+            uint64_t id = 0;
+            if (!Read(record, dev, memory, offset, desc, id))
+                return false;
+
+            Texture* texture = nullptr;
+            Measure(record.op, [&]() { core.CreatePlacedTexture(*dev, memory, offset, desc, texture); });
+            Map(id, texture);
+        } break;
+
+        case CaptureOp::AllocateDescriptorSets: {
+            DescriptorPool* descriptorPool = nullptr;
+            const PipelineLayout* pipelineLayout = nullptr;
+            uint32_t setIndex = 0;
+            CaptureArray<uint64_t> ids = {};
+            uint32_t variableDescriptorNum = 0;
+            if (!Read(record, descriptorPool, pipelineLayout, setIndex, ids, variableDescriptorNum))
+                return false;
+
+            std::vector<DescriptorSet*> descriptorSets((size_t)ids.num);
+            Result result = Result::FAILURE;
+            Measure(record.op, [&]() { result = core.AllocateDescriptorSets(*descriptorPool, *pipelineLayout, setIndex, descriptorSets.data(), (uint32_t)ids.num, variableDescriptorNum); });
+
+            if (result == Result::SUCCESS) {
+                for (uint64_t i = 0; i < ids.num; i++)
+                    Map(ids.ptr[i], descriptorSets[i]);
+            }
+        } break;
+
+        case CaptureOp::UpdateDescriptorRanges: {
+            CaptureArray<const UpdateDescriptorRangeDesc> descs = {};
+            if (!Read(record, descs))
+                return false;
+
+            Measure(record.op, [&]() { core.UpdateDescriptorRanges(descs.ptr, (uint32_t)descs.num); });
+        } break;
+
+        case CaptureOp::CopyDescriptorRanges: {
+            CaptureArray<const CopyDescriptorRangeDesc> descs = {};
+            if (!Read(record, descs))
+                return false;
+
+            Measure(record.op, [&]() { core.CopyDescriptorRanges(descs.ptr, (uint32_t)descs.num); });
+        } break;
+
+        case CaptureOp::ResetDescriptorPool: {
+            DescriptorPool* descriptorPool = nullptr;
+            if (!Read(record, descriptorPool))
+                return false;
+
+            Measure(record.op, [&]() { core.ResetDescriptorPool(*descriptorPool); });
+        } break;
+
+        case CaptureOp::BeginCommandBuffer: {
+            CommandBuffer* commandBuffer = nullptr;
+            const DescriptorPool* descriptorPool = nullptr;
+            if (!Read(record, commandBuffer, descriptorPool))
+                return false;
+
+            Measure(record.op, [&]() { core.BeginCommandBuffer(*commandBuffer, descriptorPool); });
+        } break;
+
+        case CaptureOp::CmdSetDescriptorPool: {
+            CommandBuffer* commandBuffer = nullptr;
+            const DescriptorPool* descriptorPool = nullptr;
+            if (!Read(record, commandBuffer, descriptorPool))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetDescriptorPool(*commandBuffer, *descriptorPool); });
+        } break;
+
+        case CaptureOp::CmdSetPipelineLayout: {
+            CommandBuffer* commandBuffer = nullptr;
+            BindPoint bindPoint = BindPoint::INHERIT;
+            const PipelineLayout* pipelineLayout = nullptr;
+            if (!Read(record, commandBuffer, bindPoint, pipelineLayout))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetPipelineLayout(*commandBuffer, bindPoint, *pipelineLayout); });
+        } break;
+
+            CMD_OP(CmdSetDescriptorSet, SetDescriptorSetDesc);
+            CMD_OP(CmdSetRootConstants, SetRootConstantsDesc);
+            CMD_OP(CmdSetRootDescriptor, SetRootDescriptorDesc);
+            CMD_OP(CmdBarrier, BarrierDesc);
+            CMD_OP(CmdSetBlendConstants, Color32f);
+            CMD_OP(CmdSetShadingRate, ShadingRateDesc);
+            CMD_OP(CmdSetDepthBias, DepthBiasDesc);
+            CMD_OP(CmdSetDepthState, DepthAttachmentDesc);
+            CMD_OP(CmdSetStencilState, StencilAttachmentDesc);
+            CMD_OP(CmdBeginRendering, RenderingDesc);
+            CMD_OP(CmdDraw, DrawDesc);
+            CMD_OP(CmdDrawIndexed, DrawIndexedDesc);
+            CMD_OP(CmdDispatch, DispatchDesc);
+            CMD_OP(CmdClearStorage, ClearStorageDesc);
+
+            CMD_INDIRECT_OP(CmdDrawIndirect, core);
+            CMD_INDIRECT_OP(CmdDrawIndexedIndirect, core);
+
+        case CaptureOp::CmdSetPipeline: {
+            CommandBuffer* commandBuffer = nullptr;
+            const Pipeline* pipeline = nullptr;
+            if (!Read(record, commandBuffer, pipeline))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetPipeline(*commandBuffer, *pipeline); });
+        } break;
+
+        case CaptureOp::CmdSetIndexBuffer: {
+            CommandBuffer* commandBuffer = nullptr;
+            const Buffer* buffer = nullptr;
+            uint64_t offset = 0;
+            IndexType indexType = IndexType::UINT16;
+            if (!Read(record, commandBuffer, buffer, offset, indexType))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetIndexBuffer(*commandBuffer, *buffer, offset, indexType); });
+        } break;
+
+        case CaptureOp::CmdSetVertexBuffers: {
+            CommandBuffer* commandBuffer = nullptr;
+            uint32_t baseSlot = 0;
+            CaptureArray<const VertexBufferDesc> descs = {};
+            if (!Read(record, commandBuffer, baseSlot, descs))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetVertexBuffers(*commandBuffer, baseSlot, descs.ptr, (uint32_t)descs.num); });
+        } break;
+
+        case CaptureOp::CmdSetViewports: {
+            CommandBuffer* commandBuffer = nullptr;
+            CaptureArray<const Viewport> viewports = {};
+            if (!Read(record, commandBuffer, viewports))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetViewports(*commandBuffer, viewports.ptr, (uint32_t)viewports.num); });
+        } break;
+
+        case CaptureOp::CmdSetScissors: {
+            CommandBuffer* commandBuffer = nullptr;
+            CaptureArray<const Rect> rects = {};
+            if (!Read(record, commandBuffer, rects))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetScissors(*commandBuffer, rects.ptr, (uint32_t)rects.num); });
+        } break;
+
+        case CaptureOp::CmdSetStencilReference: {
+            CommandBuffer* commandBuffer = nullptr;
+            uint8_t frontRef = 0;
+            uint8_t backRef = 0;
+            if (!Read(record, commandBuffer, frontRef, backRef))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetStencilReference(*commandBuffer, frontRef, backRef); });
+        } break;
+
+        case CaptureOp::CmdSetTopology: {
+            CommandBuffer* commandBuffer = nullptr;
+            Topology topology = Topology::TRIANGLE_LIST;
+            PrimitiveRestart primitiveRestart = PrimitiveRestart::DISABLED;
+            if (!Read(record, commandBuffer, topology, primitiveRestart))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetTopology(*commandBuffer, topology, primitiveRestart); });
+        } break;
+
+        case CaptureOp::CmdSetCullMode: {
+            CommandBuffer* commandBuffer = nullptr;
+            CullMode cullMode = CullMode::NONE;
+            if (!Read(record, commandBuffer, cullMode))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetCullMode(*commandBuffer, cullMode); });
+        } break;
+
+        case CaptureOp::CmdSetFrontFace: {
+            CommandBuffer* commandBuffer = nullptr;
+            bool frontCounterClockwise = false;
+            if (!Read(record, commandBuffer, frontCounterClockwise))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetFrontFace(*commandBuffer, frontCounterClockwise); });
+        } break;
+
+        case CaptureOp::CmdSetColorState: {
+            CommandBuffer* commandBuffer = nullptr;
+            uint32_t baseAttachment = 0;
+            CaptureArray<const ColorAttachmentDesc> colors = {};
+            if (!Read(record, commandBuffer, baseAttachment, colors))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetColorState(*commandBuffer, baseAttachment, colors.ptr, (uint32_t)colors.num); });
+        } break;
+
+        case CaptureOp::CmdSetDepthBounds: {
+            CommandBuffer* commandBuffer = nullptr;
+            float boundsMin = 0.0f;
+            float boundsMax = 0.0f;
+            if (!Read(record, commandBuffer, boundsMin, boundsMax))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetDepthBounds(*commandBuffer, boundsMin, boundsMax); });
+        } break;
+
+        case CaptureOp::CmdSetSampleLocations: {
+            CommandBuffer* commandBuffer = nullptr;
+            CaptureArray<const SampleLocation> locations = {};
+            Sample_t sampleNum = 0;
+            if (!Read(record, commandBuffer, locations, sampleNum))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdSetSampleLocations(*commandBuffer, locations.ptr, (Sample_t)locations.num, sampleNum); });
+        } break;
+
+        case CaptureOp::CmdClearAttachments: {
+            CommandBuffer* commandBuffer = nullptr;
+            CaptureArray<const ClearAttachmentDesc> clearAttachmentDescs = {};
+            CaptureArray<const Rect> rects = {};
+            if (!Read(record, commandBuffer, clearAttachmentDescs, rects))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdClearAttachments(*commandBuffer, clearAttachmentDescs.ptr, (uint32_t)clearAttachmentDescs.num, rects.ptr, (uint32_t)rects.num); });
+        } break;
+
+        case CaptureOp::CmdEndRendering: {
+            CommandBuffer* commandBuffer = nullptr;
+            if (!Read(record, commandBuffer))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdEndRendering(*commandBuffer); });
+        } break;
+
+        case CaptureOp::CmdDispatchIndirect: {
+            CommandBuffer* commandBuffer = nullptr;
+            const Buffer* buffer = nullptr;
+            uint64_t offset = 0;
+            if (!Read(record, commandBuffer, buffer, offset))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdDispatchIndirect(*commandBuffer, *buffer, offset); });
+        } break;
+
+        case CaptureOp::CmdCopyBuffer: {
+            CommandBuffer* commandBuffer = nullptr;
+            Buffer* dstBuffer = nullptr;
+            uint64_t dstOffset = 0;
+            const Buffer* srcBuffer = nullptr;
+            uint64_t srcOffset = 0;
+            uint64_t size = 0;
+            if (!Read(record, commandBuffer, dstBuffer, dstOffset, srcBuffer, srcOffset, size))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdCopyBuffer(*commandBuffer, *dstBuffer, dstOffset, *srcBuffer, srcOffset, size); });
+        } break;
+
+        case CaptureOp::CmdCopyTexture: {
+            CommandBuffer* commandBuffer = nullptr;
+            Texture* dstTexture = nullptr;
+            CaptureArray<const TextureRegionDesc> dstRegion = {};
+            const Texture* srcTexture = nullptr;
+            CaptureArray<const TextureRegionDesc> srcRegion = {};
+            if (!Read(record, commandBuffer, dstTexture, dstRegion, srcTexture, srcRegion))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdCopyTexture(*commandBuffer, *dstTexture, dstRegion.ptr, *srcTexture, srcRegion.ptr); });
+        } break;
+
+        case CaptureOp::CmdUploadBufferToTexture: {
+            CommandBuffer* commandBuffer = nullptr;
+            Texture* dstTexture = nullptr;
+            TextureRegionDesc dstRegion = {};
+            const Buffer* srcBuffer = nullptr;
+            TextureDataLayoutDesc srcDataLayout = {};
+            if (!Read(record, commandBuffer, dstTexture, dstRegion, srcBuffer, srcDataLayout))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdUploadBufferToTexture(*commandBuffer, *dstTexture, dstRegion, *srcBuffer, srcDataLayout); });
+        } break;
+
+        case CaptureOp::CmdReadbackTextureToBuffer: {
+            CommandBuffer* commandBuffer = nullptr;
+            Buffer* dstBuffer = nullptr;
+            TextureDataLayoutDesc dstDataLayout = {};
+            const Texture* srcTexture = nullptr;
+            TextureRegionDesc srcRegion = {};
+            if (!Read(record, commandBuffer, dstBuffer, dstDataLayout, srcTexture, srcRegion))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdReadbackTextureToBuffer(*commandBuffer, *dstBuffer, dstDataLayout, *srcTexture, srcRegion); });
+        } break;
+
+        case CaptureOp::CmdZeroBuffer: {
+            CommandBuffer* commandBuffer = nullptr;
+            Buffer* buffer = nullptr;
+            uint64_t offset = 0;
+            uint64_t size = 0;
+            if (!Read(record, commandBuffer, buffer, offset, size))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdZeroBuffer(*commandBuffer, *buffer, offset, size); });
+        } break;
+
+        case CaptureOp::CmdResolveTexture: {
+            CommandBuffer* commandBuffer = nullptr;
+            Texture* dstTexture = nullptr;
+            CaptureArray<const TextureRegionDesc> dstRegion = {};
+            const Texture* srcTexture = nullptr;
+            CaptureArray<const TextureRegionDesc> srcRegion = {};
+            ResolveOp resolveOp = ResolveOp::AVERAGE;
+            if (!Read(record, commandBuffer, dstTexture, dstRegion, srcTexture, srcRegion, resolveOp))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdResolveTexture(*commandBuffer, *dstTexture, dstRegion.ptr, *srcTexture, srcRegion.ptr, resolveOp); });
+        } break;
+
+        case CaptureOp::CmdResetQueries: {
+            CommandBuffer* commandBuffer = nullptr;
+            QueryPool* queryPool = nullptr;
+            uint32_t offset = 0;
+            uint32_t num = 0;
+            if (!Read(record, commandBuffer, queryPool, offset, num))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdResetQueries(*commandBuffer, *queryPool, offset, num); });
+        } break;
+
+            QUERY_OP(CmdBeginQuery);
+            QUERY_OP(CmdEndQuery);
+
+        case CaptureOp::CmdCopyQueries: {
+            CommandBuffer* commandBuffer = nullptr;
+            const QueryPool* queryPool = nullptr;
+            uint32_t offset = 0;
+            uint32_t num = 0;
+            Buffer* dstBuffer = nullptr;
+            uint64_t dstOffset = 0;
+            if (!Read(record, commandBuffer, queryPool, offset, num, dstBuffer, dstOffset))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdCopyQueries(*commandBuffer, *queryPool, offset, num, *dstBuffer, dstOffset); });
+        } break;
+
+            ANNOTATION_OP(CmdBeginAnnotation, CommandBuffer);
+            ANNOTATION_OP(CmdAnnotation, CommandBuffer);
+            ANNOTATION_OP(QueueBeginAnnotation, Queue);
+            ANNOTATION_OP(QueueAnnotation, Queue);
+
+        case CaptureOp::CmdEndAnnotation: {
+            CommandBuffer* commandBuffer = nullptr;
+            if (!Read(record, commandBuffer))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdEndAnnotation(*commandBuffer); });
+        } break;
+
+        case CaptureOp::EndCommandBuffer: {
+            CommandBuffer* commandBuffer = nullptr;
+            if (!Read(record, commandBuffer))
+                return false;
+
+            Measure(record.op, [&]() { core.EndCommandBuffer(*commandBuffer); });
+        } break;
+
+        case CaptureOp::QueueEndAnnotation: {
+            Queue* queue = nullptr;
+            if (!Read(record, queue))
+                return false;
+
+            Measure(record.op, [&]() { core.QueueEndAnnotation(*queue); });
+        } break;
+
+        case CaptureOp::ResetQueries: {
+            QueryPool* queryPool = nullptr;
+            uint32_t offset = 0;
+            uint32_t num = 0;
+            if (!Read(record, queryPool, offset, num))
+                return false;
+
+            Measure(record.op, [&]() { core.ResetQueries(*queryPool, offset, num); });
+        } break;
+
+        case CaptureOp::QueueSubmit: {
+            Queue* queue = nullptr;
+            QueueSubmitDesc desc = {};
+            if (!Read(record, queue, desc))
+                return false;
+
+            std::vector<FenceSubmitDesc> waitFences;
+            std::vector<FenceSubmitDesc> signalFences;
+            RemoveNullFences(desc.waitFences, desc.waitFenceNum, waitFences);
+            RemoveNullFences(desc.signalFences, desc.signalFenceNum, signalFences);
+
+            Measure(record.op, [&]() { core.QueueSubmit(*queue, desc); });
+        } break;
+
+        case CaptureOp::QueueWaitIdle: {
+            Queue* queue = nullptr;
+            if (!Read(record, queue))
+                return false;
+
+            Measure(record.op, [&]() { core.QueueWaitIdle(queue); });
+        } break;
+
+        case CaptureOp::DeviceWaitIdle: {
+            Device* dev = nullptr;
+            if (!Read(record, dev))
+                return false;
+
+            Measure(record.op, [&]() { core.DeviceWaitIdle(dev); });
+        } break;
+
+        case CaptureOp::Wait: {
+            Fence* fence = nullptr;
+            uint64_t value = 0;
+            if (!Read(record, fence, value))
+                return false;
+
+            Measure(record.op, [&]() { core.Wait(*fence, value); });
+        } break;
+
+        case CaptureOp::ResetCommandAllocator: {
+            CommandAllocator* commandAllocator = nullptr;
+            if (!Read(record, commandAllocator))
+                return false;
+
+            Measure(record.op, [&]() { core.ResetCommandAllocator(*commandAllocator); });
+        } break;
+
+        case CaptureOp::MapBuffer: {
+            Buffer* buffer = nullptr;
+            uint64_t offset = 0;
+            uint64_t size = 0;
+            if (!Read(record, buffer, offset, size))
+                return false;
+
+            Measure(record.op, [&]() { core.MapBuffer(*buffer, offset, size); });
+        } break;
+
+        case CaptureOp::UnmapBuffer: {
+            Buffer* buffer = nullptr;
+            if (!Read(record, buffer))
+                return false;
+
+            Measure(record.op, [&]() { core.UnmapBuffer(*buffer); });
+        } break;
+
+        case CaptureOp::UploadHostMemoryToTexture: {
+            Queue* queue = nullptr;
+            CaptureArray<const UploadHostMemoryToTextureDesc> descs = {};
+            if (!Read(record, queue, descs))
+                return false;
+
+            UploadHostMemoryToTextureDesc* copyDescs = (UploadHostMemoryToTextureDesc*)descs.ptr;
+            for (uint64_t i = 0; i < descs.num; i++)
+                copyDescs[i].srcData = GetHostScratch(*copyDescs[i].dstTexture, copyDescs[i].srcRowPitch, copyDescs[i].srcSlicePitch);
+
+            Measure(record.op, [&]() { core.UploadHostMemoryToTexture(*queue, descs.ptr, (uint32_t)descs.num); });
+        } break;
+
+        case CaptureOp::ReadbackTextureToHostMemory: {
+            Queue* queue = nullptr;
+            CaptureArray<const ReadbackTextureToHostMemoryDesc> descs = {};
+            if (!Read(record, queue, descs))
+                return false;
+
+            // Can't share the scratch between copies
+            ReadbackTextureToHostMemoryDesc* copyDescs = (ReadbackTextureToHostMemoryDesc*)descs.ptr;
+            for (uint64_t i = 0; i < descs.num; i++) {
+                copyDescs[i].dstData = GetHostScratch(*copyDescs[i].srcTexture, copyDescs[i].dstRowPitch, copyDescs[i].dstSlicePitch);
+                Measure(record.op, [&]() { core.ReadbackTextureToHostMemory(*queue, copyDescs + i, 1); });
+            }
+        } break;
+
+        case CaptureOp::SetDebugName: {
+            Object* object = nullptr;
+            CaptureString name = {};
+            if (!Read(record, object, name))
+                return false;
+
+            Measure(record.op, [&]() { core.SetDebugName(object, name.str); });
+        } break;
+
+        case CaptureOp::CmdDrawMeshTasks: {
+            if (!meshShader.CmdDrawMeshTasks)
+                return false;
+
+            CommandBuffer* commandBuffer = nullptr;
+            DrawMeshTasksDesc desc = {};
+            if (!Read(record, commandBuffer, desc))
+                return false;
+
+            Measure(record.op, [&]() { meshShader.CmdDrawMeshTasks(*commandBuffer, desc); });
+        } break;
+
+            CMD_INDIRECT_OP(CmdDrawMeshTasksIndirect, meshShader);
+
+        case CaptureOp::GetSwapChainTextures: {
+            uint64_t swapChainId = 0;
+            CaptureArray<uint64_t> ids = {};
+            TextureDesc desc = {};
+            if (!Read(record, swapChainId, ids, desc))
+                return false;
+
+            // Textures of the replayed swap chain
+            auto it = handles.find(swapChainId);
+            SwapChain* swapChainHandle = it == handles.end() ? nullptr : (SwapChain*)it->second;
+
+            Texture* const* textures = nullptr;
+            uint32_t textureNum = 0;
+            if (swapChainHandle)
+                Measure(record.op, [&]() { textures = swapChain.GetSwapChainTextures(*swapChainHandle, textureNum); });
+
+            // Otherwise regular textures, submits referencing a swap chain work without it
+            if (it == handles.end())
+                Map(swapChainId, (SwapChain*)nullptr);
+
+            for (uint64_t i = 0; i < ids.num; i++) {
+                if (textures && i < textureNum)
+                    Map(ids.ptr[i], textures[i]);
+                else if (handles.find(ids.ptr[i]) == handles.end()) {
+                    Texture* texture = nullptr;
+                    Measure(record.op, [&]() { core.CreateCommittedTexture(*device, MemoryLocation::DEVICE, 0.0f, desc, texture); });
+                    Map(ids.ptr[i], texture);
+                }
+            }
+        } break;
+
+        case CaptureOp::CmdDrawMulti: {
+            CommandBuffer* commandBuffer = nullptr;
+            CaptureArray<const DrawDesc> descs = {};
+            if (!Read(record, commandBuffer, descs))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdDrawMulti(*commandBuffer, descs.ptr, (uint32_t)descs.num, sizeof(DrawDesc)); });
+        } break;
+
+        case CaptureOp::CmdDrawIndexedMulti: {
+            CommandBuffer* commandBuffer = nullptr;
+            CaptureArray<const DrawIndexedDesc> descs = {};
+            if (!Read(record, commandBuffer, descs))
+                return false;
+
+            Measure(record.op, [&]() { core.CmdDrawIndexedMulti(*commandBuffer, descs.ptr, (uint32_t)descs.num, sizeof(DrawIndexedDesc)); });
+        } break;
+
+        case CaptureOp::CreateSwapChain: {
+            if (!swapChain.CreateSwapChain)
+                return false;
+
+            Device* dev = nullptr;
+            SwapChainDesc desc = {};
+            uint64_t id = 0;
+            if (!Read(record, dev, desc, id))
+                return false;
+
+            // Headless, on the virtual clock
+            if (!(desc.flags & SwapChainBits::VIRTUAL)) {
+                desc.virtualDesc = {};
+                desc.virtualDesc.frameTime = 16667;
+            }
+
+            desc.window = {};
+            desc.flags |= SwapChainBits::VIRTUAL;
+
+            SwapChain* swapChainHandle = nullptr;
+            Measure(record.op, [&]() { swapChain.CreateSwapChain(*dev, desc, swapChainHandle); });
+            Map(id, swapChainHandle);
+        } break;
+
+        case CaptureOp::DestroySwapChain: {
+            SwapChain* swapChainHandle = nullptr;
+            if (!Read(record, swapChainHandle) || !swapChainHandle)
+                return false;
+
+            Measure(record.op, [&]() { swapChain.DestroySwapChain(swapChainHandle); });
+        } break;
+
+        case CaptureOp::AcquireNextTexture: {
+            SwapChain* swapChainHandle = nullptr;
+            Fence* acquireSemaphore = nullptr;
+            uint32_t capturedTextureIndex = 0;
+            if (!Read(record, swapChainHandle, acquireSemaphore, capturedTextureIndex) || !swapChainHandle || !acquireSemaphore)
+                return false;
+
+            // Rendering goes to the captured texture anyway
+            uint32_t textureIndex = 0;
+            Measure(record.op, [&]() { swapChain.AcquireNextTexture(*swapChainHandle, *acquireSemaphore, textureIndex); });
+        } break;
+
+        case CaptureOp::WaitForPresent: {
+            SwapChain* swapChainHandle = nullptr;
+            uint64_t presentId = 0;
+            if (!Read(record, swapChainHandle, presentId) || !swapChainHandle)
+                return false;
+
+            Measure(record.op, [&]() { swapChain.WaitForPresent(*swapChainHandle, presentId); });
+        } break;
+
+        case CaptureOp::QueuePresent: {
+            SwapChain* swapChainHandle = nullptr;
+            Fence* releaseSemaphore = nullptr;
+            uint64_t presentId = 0;
+            if (!Read(record, swapChainHandle, releaseSemaphore, presentId) || !swapChainHandle || !releaseSemaphore)
+                return false;
+
+            Measure(record.op, [&]() { swapChain.QueuePresent(*swapChainHandle, *releaseSemaphore, presentId); });
+        } break;
+
+        case CaptureOp::SetLatencySleepMode: {
+            SwapChain* swapChainHandle = nullptr;
+            LatencySleepMode latencySleepMode = {};
+            if (!lowLatency.SetLatencySleepMode || !Read(record, swapChainHandle, latencySleepMode) || !swapChainHandle)
+                return false;
+
+            Measure(record.op, [&]() { lowLatency.SetLatencySleepMode(*swapChainHandle, latencySleepMode); });
+        } break;
+
+        case CaptureOp::SetLatencyMarker: {
+            SwapChain* swapChainHandle = nullptr;
+            uint64_t presentId = 0;
+            LatencyMarker latencyMarker = LatencyMarker::SIMULATION_START;
+            if (!lowLatency.SetLatencyMarker || !Read(record, swapChainHandle, presentId, latencyMarker) || !swapChainHandle)
+                return false;
+
+            Measure(record.op, [&]() { lowLatency.SetLatencyMarker(*swapChainHandle, presentId, latencyMarker); });
+        } break;
+
+        case CaptureOp::LatencySleep: {
+            SwapChain* swapChainHandle = nullptr;
+            uint64_t presentId = 0;
+            if (!lowLatency.LatencySleep || !Read(record, swapChainHandle, presentId) || !swapChainHandle)
+                return false;
+
+            Measure(record.op, [&]() { lowLatency.LatencySleep(*swapChainHandle, presentId); });
+        } break;
+
+            RT_CREATE_OP(CreateRayTracingPipeline, RayTracingPipelineDesc, Pipeline);
+            RT_CREATE_OP(CreateAccelerationStructure, AccelerationStructureDesc, AccelerationStructure);
+            RT_CREATE_OP(CreateMicromap, MicromapDesc, Micromap);
+
+        case CaptureOp::CreateAccelerationStructureDescriptor: {
+            const AccelerationStructure* accelerationStructure = nullptr;
+            uint64_t id = 0;
+            if (!Read(record, accelerationStructure, id))
+                return false;
+
+            Descriptor* descriptor = nullptr;
+            Measure(record.op, [&]() { rayTracing.CreateAccelerationStructureDescriptor(*accelerationStructure, descriptor); });
+            Map(id, descriptor);
+        } break;
+
+        case CaptureOp::GetAccelerationStructureBuffer: {
+            const AccelerationStructure* accelerationStructure = nullptr;
+            uint64_t id = 0;
+            if (!Read(record, accelerationStructure, id))
+                return false;
+
+            Buffer* buffer = nullptr;
+            Measure(record.op, [&]() { buffer = rayTracing.GetAccelerationStructureBuffer(*accelerationStructure); });
+            Map(id, buffer);
+        } break;
+
+        case CaptureOp::GetMicromapBuffer: {
+            const Micromap* micromap = nullptr;
+            uint64_t id = 0;
+            if (!Read(record, micromap, id))
+                return false;
+
+            Buffer* buffer = nullptr;
+            Measure(record.op, [&]() { buffer = rayTracing.GetMicromapBuffer(*micromap); });
+            Map(id, buffer);
+        } break;
+
+        case CaptureOp::DestroyAccelerationStructure: {
+            AccelerationStructure* accelerationStructure = nullptr;
+            if (!Read(record, accelerationStructure))
+                return false;
+
+            Measure(record.op, [&]() { rayTracing.DestroyAccelerationStructure(accelerationStructure); });
+        } break;
+
+        case CaptureOp::DestroyMicromap: {
+            Micromap* micromap = nullptr;
+            if (!Read(record, micromap))
+                return false;
+
+            Measure(record.op, [&]() { rayTracing.DestroyMicromap(micromap); });
+        } break;
+
+        case CaptureOp::GetAccelerationStructureMemoryDesc: {
+            const AccelerationStructure* accelerationStructure = nullptr;
+            MemoryLocation memoryLocation = MemoryLocation::DEVICE;
+            MemoryDesc capturedMemoryDesc = {};
+            if (!Read(record, accelerationStructure, memoryLocation, capturedMemoryDesc))
+                return false;
+
+            MemoryDesc memoryDesc = {};
+            Measure(record.op, [&]() { rayTracing.GetAccelerationStructureMemoryDesc(*accelerationStructure, memoryLocation, memoryDesc); });
+            memoryTypes[capturedMemoryDesc.type] = memoryDesc.type;
+        } break;
+
+        case CaptureOp::GetMicromapMemoryDesc: {
+            const Micromap* micromap = nullptr;
+            MemoryLocation memoryLocation = MemoryLocation::DEVICE;
+            MemoryDesc capturedMemoryDesc = {};
+            if (!Read(record, micromap, memoryLocation, capturedMemoryDesc))
+                return false;
+
+            MemoryDesc memoryDesc = {};
+            Measure(record.op, [&]() { rayTracing.GetMicromapMemoryDesc(*micromap, memoryLocation, memoryDesc); });
+            memoryTypes[capturedMemoryDesc.type] = memoryDesc.type;
+        } break;
+
+        case CaptureOp::BindAccelerationStructureMemory: {
+            CaptureArray<const BindAccelerationStructureMemoryDesc> descs = {};
+            if (!Read(record, descs))
+                return false;
+
+            Measure(record.op, [&]() { rayTracing.BindAccelerationStructureMemory(descs.ptr, (uint32_t)descs.num); });
+        } break;
+
+        case CaptureOp::BindMicromapMemory: {
+            CaptureArray<const BindMicromapMemoryDesc> descs = {};
+            if (!Read(record, descs))
+                return false;
+
+            Measure(record.op, [&]() { rayTracing.BindMicromapMemory(descs.ptr, (uint32_t)descs.num); });
+        } break;
+
+        case CaptureOp::GetAccelerationStructureMemoryDesc2: {
+            const Device* dev = nullptr;
+            AccelerationStructureDesc desc = {};
+            MemoryLocation memoryLocation = MemoryLocation::DEVICE;
+            MemoryDesc capturedMemoryDesc = {};
+            if (!Read(record, dev, desc, memoryLocation, capturedMemoryDesc))
+                return false;
+
+            MemoryDesc memoryDesc = {};
+            Measure(record.op, [&]() { rayTracing.GetAccelerationStructureMemoryDesc2(*dev, desc, memoryLocation, memoryDesc); });
+            memoryTypes[capturedMemoryDesc.type] = memoryDesc.type;
+        } break;
+
+        case CaptureOp::GetMicromapMemoryDesc2: {
+            const Device* dev = nullptr;
+            MicromapDesc desc = {};
+            MemoryLocation memoryLocation = MemoryLocation::DEVICE;
+            MemoryDesc capturedMemoryDesc = {};
+            if (!Read(record, dev, desc, memoryLocation, capturedMemoryDesc))
+                return false;
+
+            MemoryDesc memoryDesc = {};
+            Measure(record.op, [&]() { rayTracing.GetMicromapMemoryDesc2(*dev, desc, memoryLocation, memoryDesc); });
+            memoryTypes[capturedMemoryDesc.type] = memoryDesc.type;
+        } break;
+
+        case CaptureOp::CreateCommittedAccelerationStructure: {
+            Device* dev = nullptr;
+            MemoryLocation memoryLocation = MemoryLocation::DEVICE;
+            float priority = 0.0f;
+            AccelerationStructureDesc desc = {};
+            uint64_t id = 0;
+            if (!Read(record, dev, memoryLocation, priority, desc, id))
+                return false;
+
+            AccelerationStructure* accelerationStructure = nullptr;
+            Measure(record.op, [&]() { rayTracing.CreateCommittedAccelerationStructure(*dev, memoryLocation, priority, desc, accelerationStructure); });
+            Map(id, accelerationStructure);
+        } break;
+
+        case CaptureOp::CreateCommittedMicromap: {
+            Device* dev = nullptr;
+            MemoryLocation memoryLocation = MemoryLocation::DEVICE;
+            float priority = 0.0f;
+            MicromapDesc desc = {};
+            uint64_t id = 0;
+            if (!Read(record, dev, memoryLocation, priority, desc, id))
+                return false;
+
+            Micromap* micromap = nullptr;
+            Measure(record.op, [&]() { rayTracing.CreateCommittedMicromap(*dev, memoryLocation, priority, desc, micromap); });
+            Map(id, micromap);
+        } break;
+
+        case CaptureOp::CreatePlacedAccelerationStructure: {
+            Device* dev = nullptr;
+            Memory* memory = nullptr;
+            uint64_t offset = 0;
+            AccelerationStructureDesc desc = {};
+            uint64_t id = 0;
+            if (!Read(record, dev, memory, offset, desc, id))
+                return false;
+
+            AccelerationStructure* accelerationStructure = nullptr;
+            Measure(record.op, [&]() { rayTracing.CreatePlacedAccelerationStructure(*dev, memory, offset, desc, accelerationStructure); });
+            Map(id, accelerationStructure);
+        } break;
+
+        case CaptureOp::CreatePlacedMicromap: {
+            Device* dev = nullptr;
+            Memory* memory = nullptr;
+            uint64_t offset = 0;
+            MicromapDesc desc = {};
+            uint64_t id = 0;
+            if (!Read(record, dev, memory, offset, desc, id))
+                return false;
+
+            Micromap* micromap = nullptr;
+            Measure(record.op, [&]() { rayTracing.CreatePlacedMicromap(*dev, memory, offset, desc, micromap); });
+            Map(id, micromap);
+        } break;
+
+        case CaptureOp::CmdBuildMicromaps: {
+            CommandBuffer* commandBuffer = nullptr;
+            CaptureArray<const BuildMicromapDesc> descs = {};
+            if (!Read(record, commandBuffer, descs))
+                return false;
+
+            Measure(record.op, [&]() { rayTracing.CmdBuildMicromaps(*commandBuffer, descs.ptr, (uint32_t)descs.num); });
+        } break;
+
+        case CaptureOp::CmdWriteMicromapsSizes: {
+            CommandBuffer* commandBuffer = nullptr;
+            CaptureArray<const Micromap* const> micromaps = {};
+            QueryPool* queryPool = nullptr;
+            uint32_t queryPoolOffset = 0;
+            if (!Read(record, commandBuffer, micromaps, queryPool, queryPoolOffset))
+                return false;
+
+            Measure(record.op, [&]() { rayTracing.CmdWriteMicromapsSizes(*commandBuffer, micromaps.ptr, (uint32_t)micromaps.num, *queryPool, queryPoolOffset); });
+        } break;
+
+        case CaptureOp::CmdCopyMicromap: {
+            CommandBuffer* commandBuffer = nullptr;
+            Micromap* dst = nullptr;
+            const Micromap* src = nullptr;
+            CopyMode copyMode = CopyMode::CLONE;
+            if (!Read(record, commandBuffer, dst, src, copyMode))
+                return false;
+
+            Measure(record.op, [&]() { rayTracing.CmdCopyMicromap(*commandBuffer, *dst, *src, copyMode); });
+        } break;
+
+        case CaptureOp::CmdBuildTopLevelAccelerationStructures: {
+            CommandBuffer* commandBuffer = nullptr;
+            CaptureArray<const BuildTopLevelAccelerationStructureDesc> descs = {};
+            if (!Read(record, commandBuffer, descs))
+                return false;
+
+            Measure(record.op, [&]() { rayTracing.CmdBuildTopLevelAccelerationStructures(*commandBuffer, descs.ptr, (uint32_t)descs.num); });
+        } break;
+
+        case CaptureOp::CmdBuildBottomLevelAccelerationStructures: {
+            CommandBuffer* commandBuffer = nullptr;
+            CaptureArray<const BuildBottomLevelAccelerationStructureDesc> descs = {};
+            if (!Read(record, commandBuffer, descs))
+                return false;
+
+            Measure(record.op, [&]() { rayTracing.CmdBuildBottomLevelAccelerationStructures(*commandBuffer, descs.ptr, (uint32_t)descs.num); });
+        } break;
+
+        case CaptureOp::CmdWriteAccelerationStructuresSizes: {
+            CommandBuffer* commandBuffer = nullptr;
+            CaptureArray<const AccelerationStructure* const> accelerationStructures = {};
+            QueryPool* queryPool = nullptr;
+            uint32_t queryPoolOffset = 0;
+            if (!Read(record, commandBuffer, accelerationStructures, queryPool, queryPoolOffset))
+                return false;
+
+            Measure(record.op, [&]() { rayTracing.CmdWriteAccelerationStructuresSizes(*commandBuffer, accelerationStructures.ptr, (uint32_t)accelerationStructures.num, *queryPool, queryPoolOffset); });
+        } break;
+
+        case CaptureOp::CmdCopyAccelerationStructure: {
+            CommandBuffer* commandBuffer = nullptr;
+            AccelerationStructure* dst = nullptr;
+            const AccelerationStructure* src = nullptr;
+            CopyMode copyMode = CopyMode::CLONE;
+            if (!Read(record, commandBuffer, dst, src, copyMode))
+                return false;
+
+            Measure(record.op, [&]() { rayTracing.CmdCopyAccelerationStructure(*commandBuffer, *dst, *src, copyMode); });
+        } break;
+
+        case CaptureOp::CmdDispatchRays: {
+            CommandBuffer* commandBuffer = nullptr;
+            DispatchRaysDesc desc = {};
+            if (!Read(record, commandBuffer, desc))
+                return false;
+
+            Measure(record.op, [&]() { rayTracing.CmdDispatchRays(*commandBuffer, desc); });
+        } break;
+
+        case CaptureOp::CmdDispatchRaysIndirect: {
+            CommandBuffer* commandBuffer = nullptr;
+            const Buffer* buffer = nullptr;
+            uint64_t offset = 0;
+            if (!Read(record, commandBuffer, buffer, offset))
+                return false;
+
+            Measure(record.op, [&]() { rayTracing.CmdDispatchRaysIndirect(*commandBuffer, *buffer, offset); });
+        } break;
+
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+#undef CREATE_OP
+#undef DESTROY_OP
+#undef CMD_OP
+#undef CMD_INDIRECT_OP
+#undef RT_CREATE_OP
+#undef ANNOTATION_OP
+#undef QUERY_OP
+
+static const GraphicsAPI g_graphicsAPIs[] = {GraphicsAPI::NONE, GraphicsAPI::D3D11, GraphicsAPI::D3D12, GraphicsAPI::VK, GraphicsAPI::WGPU};
+static const char* g_graphicsAPINames[] = {"NONE", "D3D11", "D3D12", "VK", "WGPU"};
+static_assert(sizeof(g_graphicsAPINames) / sizeof(g_graphicsAPINames[0]) == sizeof(g_graphicsAPIs) / sizeof(g_graphicsAPIs[0]), "Keep 'g_graphicsAPINames' in sync with 'g_graphicsAPIs'");
+
+static bool ParseGraphicsAPI(const char* name, GraphicsAPI& graphicsAPI) {
+    for (size_t i = 0; i < sizeof(g_graphicsAPIs) / sizeof(g_graphicsAPIs[0]); i++) {
+        if (!strcmp(name, g_graphicsAPINames[i])) {
+            graphicsAPI = g_graphicsAPIs[i];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static const char* GetGraphicsAPIName(GraphicsAPI graphicsAPI) {
+    for (size_t i = 0; i < sizeof(g_graphicsAPIs) / sizeof(g_graphicsAPIs[0]); i++) {
+        if (graphicsAPI == g_graphicsAPIs[i])
+            return g_graphicsAPINames[i];
+    }
+
+    return "UNKNOWN";
+}
+
+static bool LoadCapture(const char* path, std::vector<uint64_t>& storage, CaptureFileHeader& header, std::vector<ReplayRecord>& records) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        printf("ERROR: can't open '%s'\n", path);
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long fileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    // "uint64_t" storage keeps payloads 8-byte aligned
+    storage.resize(((size_t)std::max(fileSize, 0L) + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    size_t readSize = fileSize > 0 ? fread(storage.data(), 1, (size_t)fileSize, file) : 0;
+    fclose(file);
+
+    if (readSize != (size_t)fileSize || readSize < sizeof(CaptureFileHeader)) {
+        printf("ERROR: '%s' is truncated\n", path);
+        return false;
+    }
+
+    uint8_t* data = (uint8_t*)storage.data();
+    memcpy(&header, data, sizeof(header));
+
+    if (header.magic != CAPTURE_MAGIC || header.version != CAPTURE_VERSION) {
+        printf("ERROR: '%s' is not a compatible capture\n", path);
+        return false;
+    }
+
+    if (header.nriVersion != NRI_VERSION)
+        printf("WARNING: captured with NRI v%u, replaying with NRI v%u\n", header.nriVersion, NRI_VERSION);
+
+    size_t offset = sizeof(CaptureFileHeader);
+    while (offset + sizeof(CaptureRecordHeader) <= readSize) {
+        CaptureRecordHeader recordHeader = {};
+        memcpy(&recordHeader, data + offset, sizeof(recordHeader));
+
+        size_t payloadOffset = offset + sizeof(CaptureRecordHeader);
+        if (recordHeader.op >= CaptureOp::MAX_NUM || payloadOffset + recordHeader.size > readSize) {
+            printf("WARNING: capture is truncated at offset %zu\n", offset);
+            break;
+        }
+
+        records.push_back({recordHeader.seq, data + payloadOffset, recordHeader.op});
+        offset = payloadOffset + recordHeader.size;
+    }
+
+    // Per-thread chunks are flushed independently
+    std::stable_sort(records.begin(), records.end(), [](const ReplayRecord& a, const ReplayRecord& b) { return a.seq < b.seq; });
+
+    return true;
+}
+
+static void WriteJson(const char* path, const char* capturePath, GraphicsAPI graphicsAPI, bool enableNRIValidation, uint32_t runNum, const ReplayStats* stats, uint64_t recordNum, uint64_t skippedNum, double wallUs) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        printf("ERROR: can't open '%s' for writing\n", path);
+        return;
+    }
+
+    // Per-call stats are summed over all runs
+    fprintf(file, "{\n  \"capture\": \"");
+    for (const char* c = capturePath; *c; c++) {
+        if (*c == '"' || *c == '\\')
+            fputc('\\', file);
+        fputc(*c, file);
+    }
+
+    fprintf(file, "\",\n  \"graphicsAPI\": \"%s\",\n  \"validation\": %s,\n  \"runs\": %u,\n", GetGraphicsAPIName(graphicsAPI), enableNRIValidation ? "true" : "false", runNum);
+    fprintf(file, "  \"records\": %" PRIu64 ",\n  \"skipped\": %" PRIu64 ",\n  \"wallUs\": %.3f,\n  \"calls\": {", recordNum, skippedNum, wallUs);
+
+    bool isFirst = true;
+    for (size_t i = 0; i < (size_t)CaptureOp::MAX_NUM; i++) {
+        if (!stats[i].num)
+            continue;
+
+        fprintf(file, "%s\n    \"%s\": {\"count\": %" PRIu64 ", \"totalNs\": %" PRIu64 ", \"avgNs\": %.3f}", isFirst ? "" : ",", g_captureOpNames[i], stats[i].num, stats[i].totalNs, double(stats[i].totalNs) / double(stats[i].num));
+        isFirst = false;
+    }
+
+    fprintf(file, "\n  }\n}\n");
+    fclose(file);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printf("Usage: NRI_Replay <capture file> [--api NONE|D3D11|D3D12|VK|WGPU] [--validation] [--runs N] [--json <output file>]\n");
+        return 1;
+    }
+
+    std::vector<uint64_t> storage;
+    std::vector<ReplayRecord> records;
+    CaptureFileHeader header = {};
+    if (!LoadCapture(argv[1], storage, header, records))
+        return 1;
+
+    GraphicsAPI graphicsAPI = header.graphicsAPI;
+    bool enableNRIValidation = false;
+    uint32_t runNum = 1;
+    const char* jsonPath = nullptr;
+    for (int i = 2; i < argc; i++) {
+        if (!strcmp(argv[i], "--api") && i + 1 < argc) {
+            if (!ParseGraphicsAPI(argv[++i], graphicsAPI)) {
+                printf("ERROR: unknown API '%s'\n", argv[i]);
+                return 1;
+            }
+        } else if (!strcmp(argv[i], "--validation"))
+            enableNRIValidation = true;
+        else if (!strcmp(argv[i], "--runs") && i + 1 < argc)
+            runNum = std::max(atoi(argv[++i]), 1);
+        else if (!strcmp(argv[i], "--json") && i + 1 < argc)
+            jsonPath = argv[++i];
+        else {
+            printf("ERROR: unknown argument '%s'\n", argv[i]);
+            return 1;
+        }
+    }
+
+    // Device
+    QueueFamilyDesc queueFamilies[(size_t)QueueType::MAX_NUM] = {};
+    uint32_t queueFamilyNum = 0;
+    for (uint32_t i = 0; i < (uint32_t)QueueType::MAX_NUM; i++) {
+        if (header.queueNum[i]) {
+            queueFamilies[queueFamilyNum].queueNum = header.queueNum[i];
+            queueFamilies[queueFamilyNum].queueType = (QueueType)i;
+            queueFamilyNum++;
+        }
+    }
+
+    DeviceCreationDesc deviceCreationDesc = {};
+    deviceCreationDesc.graphicsAPI = graphicsAPI;
+    deviceCreationDesc.queueFamilies = queueFamilies;
+    deviceCreationDesc.queueFamilyNum = queueFamilyNum;
+    deviceCreationDesc.enableNRIValidation = enableNRIValidation;
+
+    // Replaying patches payloads in place, every run starts from a pristine copy
+    std::vector<uint64_t> pristine;
+    if (runNum > 1)
+        pristine = storage;
+
+    ReplayStats stats[(size_t)CaptureOp::MAX_NUM] = {};
+    uint64_t skippedNum = 0;
+    double wallUs = 0.0;
+
+    for (uint32_t run = 0; run < runNum; run++) {
+        if (run)
+            memcpy(storage.data(), pristine.data(), storage.size() * sizeof(uint64_t));
+
+        Replayer replayer;
+        if (nriCreateDevice(deviceCreationDesc, replayer.device) != Result::SUCCESS) {
+            printf("ERROR: can't create a device\n");
+            return 1;
+        }
+
+        if (nriGetInterface(*replayer.device, NRI_INTERFACE(CoreInterface), &replayer.core) != Result::SUCCESS) {
+            printf("ERROR: can't get 'CoreInterface'\n");
+            nriDestroyDevice(replayer.device);
+            return 1;
+        }
+
+        // Zeroed if unsupported
+        nriGetInterface(*replayer.device, NRI_INTERFACE(LowLatencyInterface), &replayer.lowLatency);
+        nriGetInterface(*replayer.device, NRI_INTERFACE(MeshShaderInterface), &replayer.meshShader);
+        nriGetInterface(*replayer.device, NRI_INTERFACE(RayTracingInterface), &replayer.rayTracing);
+        nriGetInterface(*replayer.device, NRI_INTERFACE(SwapChainInterface), &replayer.swapChain);
+
+        replayer.Map(header.device, replayer.device);
+        replayer.Map((uint64_t)(size_t)HAS_BUFFER, HAS_BUFFER);
+
+        // Replay
+        auto begin = std::chrono::steady_clock::now();
+        for (const ReplayRecord& record : records) {
+            if (!replayer.Execute(record))
+                replayer.skippedNum++;
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        replayer.core.DeviceWaitIdle(replayer.device);
+        nriDestroyDevice(replayer.device);
+
+        for (size_t i = 0; i < (size_t)CaptureOp::MAX_NUM; i++) {
+            stats[i].num += replayer.stats[i].num;
+            stats[i].totalNs += replayer.stats[i].totalNs;
+        }
+
+        skippedNum += replayer.skippedNum;
+        wallUs += std::chrono::duration<double, std::micro>(end - begin).count();
+    }
+
+    // Report
+    uint64_t totalNum = 0;
+    uint64_t totalNs = 0;
+
+    printf("%-32s %12s %14s %10s\n", "Call", "Count", "Total (us)", "Avg (ns)");
+    for (size_t i = 0; i < (size_t)CaptureOp::MAX_NUM; i++) {
+        const ReplayStats& stat = stats[i];
+        if (!stat.num)
+            continue;
+
+        printf("%-32s %12" PRIu64 " %14.1f %10.1f\n", g_captureOpNames[i], stat.num, stat.totalNs / 1000.0, double(stat.totalNs) / double(stat.num));
+
+        totalNum += stat.num;
+        totalNs += stat.totalNs;
+    }
+
+    printf("%-32s %12" PRIu64 " %14.1f\n", "TOTAL (in NRI calls)", totalNum, totalNs / 1000.0);
+    printf("Runs: %u, records: %zu, skipped: %" PRIu64 ", wall time: %.1f us\n", runNum, records.size() * runNum, skippedNum, wallUs);
+
+    if (jsonPath)
+        WriteJson(jsonPath, argv[1], graphicsAPI, enableNRIValidation, runNum, stats, records.size() * runNum, skippedNum, wallUs);
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+// © 2026 NVIDIA Corporation
+
+#pragma once
+
+// CPU allocation accounting, a lightweight replacement for an external heap profiler:
+// - "Allocate", "Destroy", "StdAllocator" and scratch memory report allocations, grouped by object type and by call site
+// - a call site is a thread local state, set for the duration of descriptor update, pipeline creation and command buffer recording calls
+//   (per call, never across calls, since a command buffer can be recorded and ended on different threads)
+// - allocations are tracked in a side table (not in headers), because NRI memory can be freed bypassing the instrumented functions
+// - "nriGetAllocationStats" and "nriDumpAllocationStats" query the data
+
+namespace nri {
+
+enum class AllocationSite : uint8_t {
+    OTHER,
+    DESCRIPTOR_UPDATE,
+    PIPELINE,
+    COMMAND_BUFFER, // lowest priority, i.e. a pipeline created while recording is a pipeline allocation
+
+    MAX_NUM
+};
+
+// Predefined types, objects get their own types on the first allocation
+constexpr uint32_t ALLOCATION_TYPE_CONTAINER = 0;
+constexpr uint32_t ALLOCATION_TYPE_SCRATCH = 1;
+
+#if NRI_ENABLE_ALLOCATION_ACCOUNTING
+
+void TrackAllocation(const void* memory, size_t size, uint32_t type);
+void TrackFree(const void* memory);
+void EnterAllocationSite(AllocationSite site);
+void LeaveAllocationSite(AllocationSite site);
+uint32_t RegisterAllocationType(const char* signature);
+Result GetAllocationStats(AllocationStats* allocationStats, uint32_t& allocationStatsNum);
+
+template <typename T>
+inline uint32_t GetAllocationType() {
+#    ifdef _MSC_VER
+    static const uint32_t type = RegisterAllocationType(__FUNCSIG__);
+#    else
+    static const uint32_t type = RegisterAllocationType(__PRETTY_FUNCTION__);
+#    endif
+
+    return type;
+}
+
+struct AllocationSiteScope {
+    inline AllocationSiteScope(AllocationSite site)
+        : m_Site(site) {
+        EnterAllocationSite(site);
+    }
+
+    inline ~AllocationSiteScope() {
+        LeaveAllocationSite(m_Site);
+    }
+
+private:
+    AllocationSite m_Site;
+};
+
+#    define NRI_TRACK_ALLOCATION(memory, size, type) TrackAllocation(memory, size, type)
+#    define NRI_TRACK_FREE(memory)                   TrackFree(memory)
+#    define NRI_ALLOCATION_SITE_SCOPE(site)          AllocationSiteScope allocationSiteScope(AllocationSite::site)
+
+#else
+
+#    define NRI_TRACK_ALLOCATION(memory, size, type)
+#    define NRI_TRACK_FREE(memory)
+#    define NRI_ALLOCATION_SITE_SCOPE(site)
+
+#endif
+
+} // namespace nri
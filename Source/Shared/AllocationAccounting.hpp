@@ -0,0 +1,184 @@
+// © 2026 NVIDIA Corporation
+
+#if NRI_ENABLE_ALLOCATION_ACCOUNTING
+
+constexpr uint32_t ALLOCATION_TYPE_MAX_NUM = 256; // the last one collects the rest
+
+struct AllocationCounter {
+    char name[48];
+    uint64_t liveBytes;
+    uint64_t peakBytes;
+    uint32_t liveAllocationNum;
+    uint32_t frameAllocationNum;
+};
+
+struct AllocationRecord {
+    uint64_t size;
+    uint32_t type;
+    AllocationSite site;
+};
+
+// The side table uses the default allocator, since NRI allocation callbacks are the thing being tracked
+struct AllocationRegistry {
+    std::unordered_map<const void*, AllocationRecord> records;
+    std::array<AllocationCounter, (size_t)AllocationSite::MAX_NUM> sites = {{
+        {"OTHER"},
+        {"DESCRIPTOR_UPDATE"},
+        {"PIPELINE"},
+        {"COMMAND_BUFFER"},
+    }};
+    std::array<AllocationCounter, ALLOCATION_TYPE_MAX_NUM> types = {{
+        {"Container"},
+        {"Scratch"},
+    }};
+    uint32_t typeNum = 2;
+    Lock lock;
+};
+
+static AllocationRegistry g_allocationRegistry;
+
+// Trivial thread local, no TLS init guards
+static thread_local uint8_t t_allocationSiteDepth[(size_t)AllocationSite::MAX_NUM];
+
+static inline AllocationSite GetAllocationSite() {
+    for (uint32_t i = 1; i < (uint32_t)AllocationSite::MAX_NUM; i++) {
+        if (t_allocationSiteDepth[i])
+            return (AllocationSite)i;
+    }
+
+    return AllocationSite::OTHER;
+}
+
+static inline void Increment(AllocationCounter& counter, uint64_t size) {
+    counter.liveBytes += size;
+    counter.peakBytes = std::max(counter.peakBytes, counter.liveBytes);
+    counter.liveAllocationNum++;
+    counter.frameAllocationNum++;
+}
+
+static inline void Decrement(AllocationCounter& counter, uint64_t size) {
+    counter.liveBytes -= size;
+    counter.liveAllocationNum--;
+}
+
+void nri::TrackAllocation(const void* memory, size_t size, uint32_t type) {
+    if (!memory)
+        return;
+
+    AllocationSite site = GetAllocationSite();
+
+    ExclusiveScope lock(g_allocationRegistry.lock);
+
+    g_allocationRegistry.records[memory] = {size, type, site};
+
+    Increment(g_allocationRegistry.sites[(size_t)site], size);
+    Increment(g_allocationRegistry.types[type], size);
+}
+
+void nri::TrackFree(const void* memory) {
+    if (!memory)
+        return;
+
+    ExclusiveScope lock(g_allocationRegistry.lock);
+
+    // Not found if allocated bypassing the instrumented functions
+    auto it = g_allocationRegistry.records.find(memory);
+    if (it == g_allocationRegistry.records.end())
+        return;
+
+    const AllocationRecord& record = it->second;
+    Decrement(g_allocationRegistry.sites[(size_t)record.site], record.size);
+    Decrement(g_allocationRegistry.types[record.type], record.size);
+
+    g_allocationRegistry.records.erase(it);
+}
+
+void nri::EnterAllocationSite(AllocationSite site) {
+    uint8_t& depth = t_allocationSiteDepth[(size_t)site];
+    if (depth != 0xFF)
+        depth++;
+}
+
+void nri::LeaveAllocationSite(AllocationSite site) {
+    uint8_t& depth = t_allocationSiteDepth[(size_t)site];
+    if (depth)
+        depth--;
+}
+
+uint32_t nri::RegisterAllocationType(const char* signature) {
+    // Extract "T" from "GetAllocationType<T>" signature:
+    //  GCC/Clang: "uint32_t nri::GetAllocationType() [with T = nri::BufferVK; ...]" or "[T = nri::BufferVK]"
+    //  MSVC: "unsigned int __cdecl nri::GetAllocationType<struct nri::BufferVK>(void)"
+    const char* begin = strstr(signature, "T = ");
+    const char* end = nullptr;
+    if (begin) {
+        begin += 4;
+        end = strpbrk(begin, ";]");
+    } else {
+        begin = strchr(signature, '<');
+        end = strrchr(signature, '>');
+        begin = begin ? begin + 1 : signature;
+    }
+
+    if (!end || end < begin)
+        end = begin + strlen(begin);
+
+    for (const char* prefix : {"struct ", "class ", "nri::"}) {
+        size_t prefixLength = strlen(prefix);
+        if ((size_t)(end - begin) > prefixLength && !strncmp(begin, prefix, prefixLength))
+            begin += prefixLength;
+    }
+
+    ExclusiveScope lock(g_allocationRegistry.lock);
+
+    uint32_t type = g_allocationRegistry.typeNum;
+    if (type == ALLOCATION_TYPE_MAX_NUM - 1) {
+        strcpy(g_allocationRegistry.types[type].name, "Other types");
+        return type;
+    }
+
+    g_allocationRegistry.typeNum++;
+
+    AllocationCounter& counter = g_allocationRegistry.types[type];
+    size_t length = std::min((size_t)(end - begin), sizeof(counter.name) - 1);
+    memcpy(counter.name, begin, length);
+    counter.name[length] = '\0';
+
+    return type;
+}
+
+Result nri::GetAllocationStats(AllocationStats* allocationStats, uint32_t& allocationStatsNum) {
+    ExclusiveScope lock(g_allocationRegistry.lock);
+
+    uint32_t siteNum = (uint32_t)AllocationSite::MAX_NUM;
+    uint32_t typeNum = std::min(g_allocationRegistry.typeNum + 1, ALLOCATION_TYPE_MAX_NUM); // +1 for the "collecting" type, if any
+    if (!g_allocationRegistry.types[typeNum - 1].name[0])
+        typeNum--;
+
+    if (!allocationStats) {
+        allocationStatsNum = siteNum + typeNum;
+        return Result::SUCCESS;
+    }
+
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < siteNum + typeNum && n < allocationStatsNum; i++) {
+        bool isCallSite = i < siteNum;
+        AllocationCounter& counter = isCallSite ? g_allocationRegistry.sites[i] : g_allocationRegistry.types[i - siteNum];
+
+        AllocationStats& stats = allocationStats[n++];
+        stats.name = counter.name;
+        stats.liveBytes = counter.liveBytes;
+        stats.peakBytes = counter.peakBytes;
+        stats.liveAllocationNum = counter.liveAllocationNum;
+        stats.frameAllocationNum = counter.frameAllocationNum;
+        stats.isCallSite = isCallSite;
+
+        counter.frameAllocationNum = 0;
+    }
+
+    allocationStatsNum = n;
+
+    return Result::SUCCESS;
+}
+
+#endif
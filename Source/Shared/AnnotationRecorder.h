@@ -0,0 +1,51 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+// CPU-side annotation timeline, independent of NVTX and GAPI debug markers:
+// - every thread writes into its own ring buffer (single producer, no locks on the recording path)
+// - the oldest records get overwritten if the timeline is not saved in time
+// - "nriSaveAnnotationTimeline" drains all rings into a Chrome trace (JSON), which can be opened in Perfetto or "chrome://tracing"
+// - rings of finished threads are freed once drained or on device destruction
+
+namespace nri {
+
+enum class AnnotationScope : uint8_t {
+    HOST,
+    COMMAND_BUFFER,
+    QUEUE,
+};
+
+enum class AnnotationEvent : uint8_t {
+    BEGIN,
+    END,
+    MARKER,
+};
+
+#if NRI_ENABLE_ANNOTATION_RECORDER
+
+struct AnnotationRecord {
+    uint64_t timestamp;
+    uint32_t threadId;
+    uint32_t bgra;
+    AnnotationScope scope;
+    AnnotationEvent event;
+    char name[46];
+};
+
+static_assert(sizeof(AnnotationRecord) == 64, "Keep 'AnnotationRecord' cache line sized");
+
+void RecordAnnotation(AnnotationScope scope, AnnotationEvent event, const char* name, uint32_t bgra);
+void RecordThreadName(const char* name);
+Result SaveAnnotationTimeline(const char* path);
+void ReleaseAnnotationRings();
+
+#    define NRI_RECORD_ANNOTATION(scope, event, name, bgra) RecordAnnotation(AnnotationScope::scope, AnnotationEvent::event, name, bgra)
+
+#else
+
+#    define NRI_RECORD_ANNOTATION(scope, event, name, bgra)
+
+#endif
+
+} // namespace nri
@@ -0,0 +1,277 @@
+// © 2021 NVIDIA Corporation
+
+#if NRI_ENABLE_ANNOTATION_RECORDER
+
+#    include <algorithm> // max
+#    include <chrono>
+#    include <cstdio>
+
+#    if (defined(__x86_64__) || defined(__i386__))
+#        include <x86intrin.h> // __rdtsc
+#        define NRI_ANNOTATION_RDTSC 1
+#    elif (defined(_M_X64) || defined(_M_IX86))
+#        include <intrin.h> // __rdtsc
+#        define NRI_ANNOTATION_RDTSC 1
+#    else
+#        define NRI_ANNOTATION_RDTSC 0
+#    endif
+
+#    if (defined _WIN32)
+#        include <windows.h> // GetCurrentThreadId
+#    elif (defined __linux__)
+#        include <sys/syscall.h>
+#        include <unistd.h>
+#    elif (defined __APPLE__)
+#        include <pthread.h>
+#    endif
+
+static_assert((NRI_ANNOTATION_RING_SIZE & (NRI_ANNOTATION_RING_SIZE - 1)) == 0, "'NRI_ANNOTATION_RING_SIZE' must be a power of 2");
+
+#    if (defined(__GNUC__) || defined(__clang__)) && !defined(_WIN32)
+#        define NRI_ANNOTATION_TLS_MODEL __attribute__((tls_model("initial-exec"))) // a single "fs"-relative load instead of "__tls_get_addr"
+#    else
+#        define NRI_ANNOTATION_TLS_MODEL
+#    endif
+
+struct AnnotationRing {
+    AnnotationRecord records[NRI_ANNOTATION_RING_SIZE];
+    alignas(LOCK_CACHELINE_SIZE) std::atomic_uint64_t head = 0; // written by the owning thread only
+    uint64_t tail = 0;                                           // written by "SaveAnnotationTimeline" only
+    char threadName[64] = {};                                    // guarded by "AnnotationRegistry::lock"
+    uint32_t threadId = 0;                                       // guarded by "AnnotationRegistry::lock", constant while owned
+    bool isOwned = true;                                         // guarded by "AnnotationRegistry::lock"
+    AnnotationRing* next = nullptr;                              // guarded by "AnnotationRegistry::lock"
+};
+
+// Ring lifetime (a ring is ~1 MB):
+// - a finished thread frees its ring immediately if everything has been saved, otherwise the ring is kept until the next save
+// - "SaveAnnotationTimeline" frees drained rings of finished threads
+// - "ReleaseAnnotationRings" (device destruction) frees rings of finished threads, dropping unsaved records
+// - a kept ring gets reused by the next new thread (records carry the thread ID)
+struct AnnotationRegistry {
+    inline AnnotationRegistry() {
+        timestampOrigin = GetTimestamp();
+        timeOrigin = std::chrono::steady_clock::now();
+    }
+
+    static inline uint64_t GetTimestamp() {
+#    if NRI_ANNOTATION_RDTSC
+        return __rdtsc();
+#    else
+        return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#    endif
+    }
+
+    AnnotationRing* rings = nullptr;
+    std::chrono::steady_clock::time_point timeOrigin;
+    uint64_t timestampOrigin;
+    Lock lock; // ring list and saving, never taken on the recording path
+};
+
+static AnnotationRegistry g_annotationRegistry;
+
+static uint32_t GetAnnotationThreadId() {
+    uint64_t tid = 0;
+#    if (defined _WIN32)
+    tid = GetCurrentThreadId();
+#    elif (defined __linux__)
+    tid = syscall(SYS_gettid);
+#    elif (defined __APPLE__)
+    pthread_threadid_np(nullptr, &tid);
+#    endif
+
+    return (uint32_t)tid;
+}
+
+// Expects "g_annotationRegistry.lock" to be held
+static void FreeFinishedAnnotationRings(bool drainedOnly) {
+    AnnotationRing** link = &g_annotationRegistry.rings;
+    while (*link) {
+        AnnotationRing* ring = *link;
+        if (!ring->isOwned && (!drainedOnly || ring->tail == ring->head.load(std::memory_order_relaxed))) {
+            *link = ring->next;
+            delete ring;
+        } else
+            link = &ring->next;
+    }
+}
+
+// The only thread local touched on the recording path. It's trivial (no TLS init guards), "AnnotationThreadContext" is touched only once per thread to release the ring on thread exit
+static thread_local AnnotationRing* t_annotationRing NRI_ANNOTATION_TLS_MODEL;
+
+struct AnnotationThreadContext {
+    inline AnnotationThreadContext() {
+        uint32_t threadId = GetAnnotationThreadId();
+
+        ExclusiveScope lock(g_annotationRegistry.lock);
+
+        AnnotationRing* ring = g_annotationRegistry.rings;
+        while (ring && ring->isOwned)
+            ring = ring->next;
+
+        if (!ring) {
+            ring = new AnnotationRing;
+            ring->next = g_annotationRegistry.rings;
+            g_annotationRegistry.rings = ring;
+        }
+
+        ring->isOwned = true;
+        ring->threadName[0] = '\0';
+        ring->threadId = threadId;
+
+        t_annotationRing = ring;
+    }
+
+    inline ~AnnotationThreadContext() {
+        ExclusiveScope lock(g_annotationRegistry.lock);
+
+        t_annotationRing->isOwned = false;
+        t_annotationRing = nullptr;
+
+        FreeFinishedAnnotationRings(true);
+    }
+};
+
+// Returns NULL if called from a thread local destructor after the context has been destroyed
+static inline AnnotationRing* GetAnnotationRing() {
+    AnnotationRing* ring = t_annotationRing;
+    if (!ring) {
+        static thread_local AnnotationThreadContext context;
+        MaybeUnused(context);
+
+        ring = t_annotationRing;
+    }
+
+    return ring;
+}
+
+void nri::RecordAnnotation(AnnotationScope scope, AnnotationEvent event, const char* name, uint32_t bgra) {
+    AnnotationRing* ring = GetAnnotationRing();
+    if (!ring)
+        return;
+
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+
+    AnnotationRecord& record = ring->records[head & (NRI_ANNOTATION_RING_SIZE - 1)];
+    record.timestamp = AnnotationRegistry::GetTimestamp();
+    record.threadId = ring->threadId;
+    record.bgra = bgra;
+    record.scope = scope;
+    record.event = event;
+
+    size_t nameLength = 0;
+    if (name) {
+        nameLength = strnlen(name, sizeof(record.name) - 1);
+        memcpy(record.name, name, nameLength);
+    }
+    record.name[nameLength] = '\0';
+
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+void nri::RecordThreadName(const char* name) {
+    AnnotationRing* ring = GetAnnotationRing();
+    if (!ring)
+        return;
+
+    ExclusiveScope lock(g_annotationRegistry.lock);
+    strncpy(ring->threadName, name ? name : "", sizeof(ring->threadName) - 1);
+}
+
+static void WriteAnnotationName(FILE* file, const char* name) {
+    for (; *name; name++) {
+        char c = *name;
+        if (c == '"' || c == '\\')
+            fprintf(file, "\\%c", c);
+        else if ((uint8_t)c < 0x20)
+            fprintf(file, "\\u%04x", (uint8_t)c);
+        else
+            fputc(c, file);
+    }
+}
+
+Result nri::SaveAnnotationTimeline(const char* path) {
+    if (!path)
+        return Result::INVALID_ARGUMENT;
+
+    FILE* file = fopen(path, "w");
+    if (!file)
+        return Result::FAILURE;
+
+    ExclusiveScope lock(g_annotationRegistry.lock);
+
+    // Timestamp units -> microseconds
+    double ticksPerMicrosecond = 1000.0; // "steady_clock" ticks are nanoseconds on all supported platforms
+#    if NRI_ANNOTATION_RDTSC
+    {
+        uint64_t ticks = AnnotationRegistry::GetTimestamp() - g_annotationRegistry.timestampOrigin;
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - g_annotationRegistry.timeOrigin;
+        if (elapsed.count() > 0.0)
+            ticksPerMicrosecond = double(ticks) / elapsed.count();
+    }
+#    else
+    ticksPerMicrosecond = double(std::chrono::steady_clock::period::den) / (double(std::chrono::steady_clock::period::num) * 1000000.0);
+#    endif
+
+    static const char* scopeNames[] = {"Host", "Command buffers", "Queues"};
+
+    fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for (uint32_t i = 0; i < GetCountOf(scopeNames); i++)
+        fprintf(file, "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":%u,\"args\":{\"name\":\"%s\"}},\n", i + 1, scopeNames[i]);
+
+    for (AnnotationRing* ring = g_annotationRegistry.rings; ring; ring = ring->next) {
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        uint64_t begin = std::max(ring->tail, head > NRI_ANNOTATION_RING_SIZE ? head - NRI_ANNOTATION_RING_SIZE : 0);
+
+        for (uint64_t i = begin; i < head; i++) {
+            AnnotationRecord record = ring->records[i & (NRI_ANNOTATION_RING_SIZE - 1)];
+
+            // The owning thread may have lapped the reader, skip overwritten records
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t newHead = ring->head.load(std::memory_order_acquire);
+            if (newHead > NRI_ANNOTATION_RING_SIZE && i < newHead - NRI_ANNOTATION_RING_SIZE + 1)
+                continue;
+
+            uint32_t pid = (uint32_t)record.scope + 1;
+            double ts = double(record.timestamp - g_annotationRegistry.timestampOrigin) / ticksPerMicrosecond;
+
+            if (record.event == AnnotationEvent::END)
+                fprintf(file, "{\"ph\":\"E\",\"pid\":%u,\"tid\":%u,\"ts\":%.3f},\n", pid, record.threadId, ts);
+            else {
+                fprintf(file, "{\"ph\":\"%s\",\"pid\":%u,\"tid\":%u,\"ts\":%.3f,\"name\":\"", record.event == AnnotationEvent::BEGIN ? "B" : "i\",\"s\":\"t", pid, record.threadId, ts);
+                WriteAnnotationName(file, record.name);
+                if (record.bgra != BGRA_UNUSED)
+                    fprintf(file, "\",\"args\":{\"bgra\":\"0x%08X\"}},\n", record.bgra);
+                else
+                    fprintf(file, "\"},\n");
+            }
+        }
+
+        ring->tail = head;
+
+        if (ring->threadName[0]) {
+            for (uint32_t j = 0; j < GetCountOf(scopeNames); j++) {
+                fprintf(file, "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"", j + 1, ring->threadId);
+                WriteAnnotationName(file, ring->threadName);
+                fprintf(file, "\"}},\n");
+            }
+        }
+    }
+
+    FreeFinishedAnnotationRings(true);
+
+    // Closing metadata record (avoids a trailing comma)
+    fprintf(file, "{\"ph\":\"M\",\"name\":\"process_sort_index\",\"pid\":1,\"args\":{\"sort_index\":0}}\n]}\n");
+
+    bool isOk = ferror(file) == 0;
+    isOk = fclose(file) == 0 && isOk;
+
+    return isOk ? Result::SUCCESS : Result::FAILURE;
+}
+
+void nri::ReleaseAnnotationRings() {
+    ExclusiveScope lock(g_annotationRegistry.lock);
+    FreeFinishedAnnotationRings(false);
+}
+
+#endif
@@ -39,11 +39,24 @@ struct DebugNameBaseVal {
     }
 };
 
+// Backs large "NRI_ALLOCATE_SCRATCH" requests. Allocations are released in reverse order, so a bump pointer is enough
+struct ScratchArena {
+    uint8_t* memory;
+    size_t size;
+    size_t offset;
+    size_t requiredSize; // the arena grows up to it (but not beyond "NRI_MAX_SCRATCH_ARENA_SIZE") once empty
+    size_t peakSize;     // since the arena was empty last time
+    uint32_t idleNum;    // empty periods in a row with "peakSize" below a quarter of "size"
+    const void* thread;  // owner
+};
+
 struct DeviceBase : public DebugNameBaseVal {
     inline DeviceBase(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks, uint64_t signature = 0)
         : m_CallbackInterface(callbacks)
         , m_AllocationCallbacks(allocationCallbacks)
-        , m_StdAllocator(m_AllocationCallbacks) {
+        , m_StdAllocator(m_AllocationCallbacks)
+        , m_ScratchArenas(m_StdAllocator)
+        , m_Uid(GenerateDeviceUid()) {
 #ifndef NDEBUG
         m_Signature = signature;
 #else
@@ -60,6 +73,7 @@ struct DeviceBase : public DebugNameBaseVal {
     }
 
     void ReportMessage(Message messageType, Result result, const char* file, uint32_t line, const char* format, ...) const;
+    ScratchArena* GetScratchArena(); // for the calling thread
 
     // Pure virtual
     virtual const DeviceDesc& GetDesc() const = 0;
@@ -67,6 +81,7 @@ struct DeviceBase : public DebugNameBaseVal {
 
     // Virtual
     virtual ~DeviceBase() {
+        DestroyScratchArenas();
     }
 
     virtual Result FillFunctionTable(CoreInterface&) const {
@@ -124,11 +139,20 @@ protected:
     CallbackInterface m_CallbackInterface = {};
     AllocationCallbacks m_AllocationCallbacks = {};
     StdAllocator<uint8_t> m_StdAllocator;
+
+private:
+    void DestroyScratchArenas();
+
+    Vector<ScratchArena*> m_ScratchArenas; // a thread can't free its arena on exit, so arenas live until the device is destroyed
+    Lock m_ScratchArenaLock;
+    uint64_t m_Uid; // never reused, unlike the address
 };
 
 template <typename T>
 inline void Destroy(T* object) {
     if (object) {
+        NRI_TRACK_FREE(object);
+
         object->~T();
 
         const auto& allocationCallbacks = ((DeviceBase&)(object->GetDevice())).GetAllocationCallbacks();
@@ -0,0 +1,118 @@
+// © 2021 NVIDIA Corporation
+
+#if defined(_WIN32)
+#    include <windows.h>
+#    include <io.h>
+
+bool nri::MapFileView(uint64_t fileHandle, FileView& fileView) {
+    fileView = {};
+    fileView.fileHandle = fileHandle;
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx((HANDLE)fileHandle, &fileSize) || fileSize.QuadPart == 0)
+        return false;
+
+    HANDLE mapping = CreateFileMappingA((HANDLE)fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+        return false;
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    fileView.data = (const uint8_t*)data;
+    fileView.size = (uint64_t)fileSize.QuadPart;
+    fileView.mapping = mapping;
+
+    return true;
+}
+
+void nri::UnmapFileView(FileView& fileView) {
+    if (fileView.data)
+        UnmapViewOfFile(fileView.data);
+
+    if (fileView.mapping)
+        CloseHandle((HANDLE)fileView.mapping);
+
+    fileView = {};
+}
+
+void nri::PrefetchFileView(const FileView& fileView, uint64_t offset, uint64_t size) {
+    WIN32_MEMORY_RANGE_ENTRY range = {};
+    range.VirtualAddress = (void*)(fileView.data + offset);
+    range.NumberOfBytes = (size_t)std::min(size, fileView.size - offset);
+
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+bool nri::CommitFile(FILE* file, const char* tmpFileName, const char* fileName) {
+    bool isWritten = fflush(file) == 0;
+    isWritten = FlushFileBuffers((HANDLE)_get_osfhandle(_fileno(file))) && isWritten;
+    isWritten = fclose(file) == 0 && isWritten;
+
+    if (isWritten && MoveFileExA(tmpFileName, fileName, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+        return true;
+
+    DeleteFileA(tmpFileName);
+
+    return false;
+}
+#else
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+
+bool nri::MapFileView(uint64_t fileHandle, FileView& fileView) {
+    fileView = {};
+    fileView.fileHandle = fileHandle;
+
+    struct stat fileStat = {};
+    if (fstat((int)fileHandle, &fileStat) != 0 || fileStat.st_size == 0)
+        return false;
+
+    void* data = mmap(nullptr, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, (int)fileHandle, 0);
+    if (data == MAP_FAILED)
+        return false;
+
+    // Let the kernel read ahead aggressively and drop pages behind
+    madvise(data, (size_t)fileStat.st_size, MADV_SEQUENTIAL);
+
+    fileView.data = (const uint8_t*)data;
+    fileView.size = (uint64_t)fileStat.st_size;
+
+    return true;
+}
+
+void nri::UnmapFileView(FileView& fileView) {
+    if (fileView.data)
+        munmap((void*)fileView.data, (size_t)fileView.size);
+
+    fileView = {};
+}
+
+void nri::PrefetchFileView(const FileView& fileView, uint64_t offset, uint64_t size) {
+    static const uint64_t pageSize = (uint64_t)sysconf(_SC_PAGESIZE);
+
+    // "madvise" requires a page-aligned address
+    uint64_t begin = offset & ~(pageSize - 1);
+    uint64_t end = std::min(offset + size, fileView.size);
+
+    madvise((void*)(fileView.data + begin), (size_t)(end - begin), MADV_WILLNEED);
+}
+
+bool nri::CommitFile(FILE* file, const char* tmpFileName, const char* fileName) {
+    bool isWritten = fflush(file) == 0;
+    isWritten = fsync(fileno(file)) == 0 && isWritten;
+    isWritten = fclose(file) == 0 && isWritten;
+
+    // "rename" is atomic: readers see either the old or the new file, but never a torn one
+    if (isWritten && rename(tmpFileName, fileName) == 0)
+        return true;
+
+    remove(tmpFileName);
+
+    return false;
+}
+#endif
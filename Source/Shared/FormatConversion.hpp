@@ -0,0 +1,410 @@
+// © 2026 NVIDIA Corporation
+
+#include <cmath> // powf
+
+// Supported channel types (all channels of a format must have the same type)
+enum class ChannelType : uint8_t {
+    UNSUPPORTED,
+    UNORM8, // including sRGB
+    SFLOAT16,
+    SFLOAT32,
+};
+
+struct ConversionFormat {
+    ChannelType channelType;
+    uint8_t channelNum;
+    uint8_t stride;
+    uint8_t channelOrder[4]; // logical channel (RGBA) for each channel in memory
+    bool isSrgb;
+};
+
+constexpr uint32_t CONVERSION_CHUNK_SIZE = 4096; // bytes, converted on the stack before streaming to upload memory
+
+static ConversionFormat GetConversionFormat(Format format) {
+    const FormatProps& props = GetFormatProps(format);
+
+    ConversionFormat conversionFormat = {};
+    conversionFormat.channelNum = (props.redBits ? 1 : 0) + (props.greenBits ? 1 : 0) + (props.blueBits ? 1 : 0) + (props.alphaBits ? 1 : 0);
+    conversionFormat.stride = props.stride;
+    conversionFormat.isSrgb = props.isSrgb;
+
+    bool isPlain = !props.isCompressed && !props.isPacked && !props.isDepth && !props.isExpShared && !props.isInteger && format != Format::UNKNOWN;
+    bool isUniform = (!props.greenBits || props.greenBits == props.redBits) && (!props.blueBits || props.blueBits == props.redBits) && (!props.alphaBits || props.alphaBits == props.redBits);
+    if (!isPlain || !isUniform || props.stride != conversionFormat.channelNum * props.redBits / 8)
+        return conversionFormat;
+
+    if (props.isFloat)
+        conversionFormat.channelType = props.redBits == 16 ? ChannelType::SFLOAT16 : (props.redBits == 32 ? ChannelType::SFLOAT32 : ChannelType::UNSUPPORTED);
+    else if ((props.isNorm || props.isSrgb) && !props.isSigned && props.redBits == 8)
+        conversionFormat.channelType = ChannelType::UNORM8;
+
+    for (uint8_t i = 0; i < 4; i++)
+        conversionFormat.channelOrder[i] = i;
+
+    if (props.isBgr) {
+        conversionFormat.channelOrder[0] = 2;
+        conversionFormat.channelOrder[2] = 0;
+    }
+
+    return conversionFormat;
+}
+
+static inline uint16_t FloatToHalf(float x) {
+    uint32_t f = 0;
+    memcpy(&f, &x, sizeof(f));
+
+    uint32_t sign = f & 0x80000000u;
+    f ^= sign;
+
+    uint16_t h = 0;
+    if (f >= 0x47800000u) // overflow, INF or NAN
+        h = f > 0x7F800000u ? 0x7E00 : 0x7C00;
+    else if (f < 0x38800000u) { // denormal or zero, rounded by the FPU via a magic addend
+        constexpr uint32_t denormMagicBits = ((127 - 15) + (23 - 10) + 1) << 23;
+
+        float denormMagic = 0.0f;
+        memcpy(&denormMagic, &denormMagicBits, sizeof(denormMagic));
+
+        float y = 0.0f;
+        memcpy(&y, &f, sizeof(y));
+        y += denormMagic;
+        memcpy(&f, &y, sizeof(f));
+
+        h = uint16_t(f - denormMagicBits);
+    } else { // normal, round to nearest even
+        uint32_t mantissaOdd = (f >> 13) & 1;
+        f += (uint32_t(15 - 127) << 23) + 0xFFF + mantissaOdd;
+        h = uint16_t(f >> 13);
+    }
+
+    return h | uint16_t(sign >> 16);
+}
+
+static inline float HalfToFloat(uint16_t h) {
+    uint32_t sign = uint32_t(h & 0x8000) << 16;
+    uint32_t exponent = (h >> 10) & 0x1F;
+    uint32_t mantissa = h & 0x3FF;
+
+    uint32_t f = 0;
+    if (exponent == 0x1F) // INF or NAN
+        f = sign | 0x7F800000u | (mantissa << 13);
+    else if (exponent) // normal
+        f = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    else if (mantissa) { // denormal
+        float y = float(mantissa) * (1.0f / 16777216.0f); // 2^-24
+        memcpy(&f, &y, sizeof(f));
+        f |= sign;
+    } else
+        f = sign;
+
+    float x = 0.0f;
+    memcpy(&x, &f, sizeof(x));
+
+    return x;
+}
+
+#if NRI_SSE2
+
+// 4 floats => 4 halfs (in the low 16 bits, sign-extended to be compatible with "_mm_packs_epi32"), same rounding as "FloatToHalf"
+static inline __m128i FloatToHalf(__m128 x) {
+    const __m128i f16Max = _mm_set1_epi32((127 + 16) << 23);
+    const __m128i minNormal = _mm_set1_epi32((127 - 14) << 23);
+    const __m128i denormMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+    const __m128i normalBias = _mm_set1_epi32(0xFFF - ((127 - 15) << 23));
+
+    __m128 sign = _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x80000000)));
+    __m128 absX = _mm_xor_ps(x, sign);
+    __m128i absBits = _mm_castps_si128(absX);
+
+    // INF or NAN
+    __m128i isNan = _mm_castps_si128(_mm_cmpunord_ps(absX, absX));
+    __m128i special = _mm_or_si128(_mm_and_si128(isNan, _mm_set1_epi32(0x200)), _mm_set1_epi32(0x7C00));
+    __m128i isRegular = _mm_cmpgt_epi32(f16Max, absBits);
+
+    // Denormal
+    __m128i isDenormal = _mm_cmpgt_epi32(minNormal, absBits);
+    __m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(absX, _mm_castsi128_ps(denormMagic))), denormMagic);
+
+    // Normal
+    __m128i mantissaOdd = _mm_srai_epi32(_mm_slli_epi32(absBits, 31 - 13), 31);
+    __m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(absBits, normalBias), mantissaOdd), 13);
+
+    __m128i result = _mm_or_si128(_mm_and_si128(isDenormal, denormal), _mm_andnot_si128(isDenormal, normal));
+    result = _mm_or_si128(_mm_and_si128(isRegular, result), _mm_andnot_si128(isRegular, special));
+
+    return _mm_or_si128(result, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+}
+
+#endif
+
+static inline float SrgbToLinear(float x) {
+    return x <= 0.04045f ? x / 12.92f : powf((x + 0.055f) / 1.055f, 2.4f);
+}
+
+static inline float LinearToSrgb(float x) {
+    return x <= 0.0031308f ? x * 12.92f : 1.055f * powf(x, 1.0f / 2.4f) - 0.055f;
+}
+
+struct SrgbTables {
+    float toLinear[256];
+    uint8_t toLinear8[256];
+    uint8_t toSrgb8[256];
+};
+
+static const SrgbTables& GetSrgbTables() {
+    static const SrgbTables tables = [] {
+        SrgbTables t = {};
+        for (uint32_t i = 0; i < 256; i++) {
+            float x = i / 255.0f;
+            t.toLinear[i] = SrgbToLinear(x);
+            t.toLinear8[i] = uint8_t(t.toLinear[i] * 255.0f + 0.5f);
+            t.toSrgb8[i] = uint8_t(LinearToSrgb(x) * 255.0f + 0.5f);
+        }
+
+        return t;
+    }();
+
+    return tables;
+}
+
+// UNORM8 => UNORM8 (channel expansion, swizzle and sRGB conversion via LUT)
+static void ConvertPixels8(uint8_t* dst, const ConversionFormat& dstFormat, const uint8_t* src, const ConversionFormat& srcFormat, uint32_t pixelNum) {
+    uint32_t i = 0;
+
+    bool isSameSpace = srcFormat.isSrgb == dstFormat.isSrgb;
+    if (isSameSpace && srcFormat.channelNum == 4 && dstFormat.channelNum == 4) {
+        // Plain copy or R <=> B swap
+        if (srcFormat.channelOrder[0] == dstFormat.channelOrder[0]) {
+            memcpy(dst, src, pixelNum * 4);
+            return;
+        }
+
+#if NRI_SSE2
+        const __m128i maskGA = _mm_set1_epi32((int32_t)0xFF00FF00);
+        const __m128i maskB = _mm_set1_epi32(0x000000FF);
+
+        for (; i + 4 <= pixelNum; i += 4) {
+            __m128i pixels = _mm_loadu_si128((const __m128i*)(src + i * 4));
+            __m128i rb = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(pixels, 16), maskB), _mm_slli_epi32(_mm_and_si128(pixels, maskB), 16));
+            _mm_storeu_si128((__m128i*)(dst + i * 4), _mm_or_si128(_mm_and_si128(pixels, maskGA), rb));
+        }
+#endif
+    }
+
+    const SrgbTables& srgbTables = GetSrgbTables();
+    const uint8_t* lut = isSameSpace ? nullptr : (srcFormat.isSrgb ? srgbTables.toLinear8 : srgbTables.toSrgb8);
+
+    for (; i < pixelNum; i++) {
+        uint8_t rgba[4] = {0, 0, 0, 255};
+        for (uint32_t c = 0; c < srcFormat.channelNum; c++)
+            rgba[srcFormat.channelOrder[c]] = src[i * srcFormat.channelNum + c];
+
+        if (lut) {
+            for (uint32_t c = 0; c < 3; c++)
+                rgba[c] = lut[rgba[c]];
+        }
+
+        for (uint32_t c = 0; c < dstFormat.channelNum; c++)
+            dst[i * dstFormat.channelNum + c] = rgba[dstFormat.channelOrder[c]];
+    }
+}
+
+static inline void DecodePixel(const uint8_t* pixel, const ConversionFormat& format, float rgba[4]) {
+    rgba[0] = 0.0f;
+    rgba[1] = 0.0f;
+    rgba[2] = 0.0f;
+    rgba[3] = 1.0f;
+
+    if (format.channelType == ChannelType::SFLOAT32) {
+        for (uint32_t c = 0; c < format.channelNum; c++)
+            memcpy(&rgba[format.channelOrder[c]], pixel + c * sizeof(float), sizeof(float));
+    } else if (format.channelType == ChannelType::SFLOAT16) {
+        for (uint32_t c = 0; c < format.channelNum; c++) {
+            uint16_t h = 0;
+            memcpy(&h, pixel + c * sizeof(uint16_t), sizeof(uint16_t));
+            rgba[format.channelOrder[c]] = HalfToFloat(h);
+        }
+    } else {
+        const SrgbTables& srgbTables = GetSrgbTables();
+
+        for (uint32_t c = 0; c < format.channelNum; c++) {
+            uint8_t channel = pixel[c];
+            bool isColor = format.channelOrder[c] < 3;
+            rgba[format.channelOrder[c]] = format.isSrgb && isColor ? srgbTables.toLinear[channel] : channel / 255.0f;
+        }
+    }
+}
+
+static inline void EncodePixel(uint8_t* pixel, const ConversionFormat& format, const float rgba[4]) {
+    if (format.channelType == ChannelType::SFLOAT32) {
+        for (uint32_t c = 0; c < format.channelNum; c++)
+            memcpy(pixel + c * sizeof(float), &rgba[format.channelOrder[c]], sizeof(float));
+    } else if (format.channelType == ChannelType::SFLOAT16) {
+        float ordered[4] = {};
+        for (uint32_t c = 0; c < format.channelNum; c++)
+            ordered[c] = rgba[format.channelOrder[c]];
+
+#if NRI_SSE2
+        alignas(16) uint16_t h[8];
+        _mm_store_si128((__m128i*)h, _mm_packs_epi32(FloatToHalf(_mm_loadu_ps(ordered)), _mm_setzero_si128()));
+#else
+        uint16_t h[4];
+        for (uint32_t c = 0; c < 4; c++)
+            h[c] = FloatToHalf(ordered[c]);
+#endif
+
+        memcpy(pixel, h, format.channelNum * sizeof(uint16_t));
+    } else {
+        for (uint32_t c = 0; c < format.channelNum; c++) {
+            float channel = std::min(std::max(rgba[format.channelOrder[c]], 0.0f), 1.0f);
+            bool isColor = format.channelOrder[c] < 3;
+            channel = format.isSrgb && isColor ? LinearToSrgb(channel) : channel;
+            pixel[c] = uint8_t(channel * 255.0f + 0.5f);
+        }
+    }
+}
+
+// Any => any (via linear floats)
+static void ConvertPixels(uint8_t* dst, const ConversionFormat& dstFormat, const uint8_t* src, const ConversionFormat& srcFormat, uint32_t pixelNum) {
+    for (uint32_t i = 0; i < pixelNum; i++) {
+        float rgba[4];
+        DecodePixel(src + i * srcFormat.stride, srcFormat, rgba);
+        EncodePixel(dst + i * dstFormat.stride, dstFormat, rgba);
+    }
+}
+
+// SFLOAT32 => SFLOAT16 with the same channel layout (the most common case for HDR data)
+static void ConvertPixelsToHalf(uint8_t* dst, const uint8_t* src, uint32_t channelNum) {
+    const float* srcChannels = (const float*)src;
+    uint16_t* dstChannels = (uint16_t*)dst;
+    uint32_t i = 0;
+
+#if NRI_SSE2
+    for (; i + 8 <= channelNum; i += 8) {
+        __m128i lo = FloatToHalf(_mm_loadu_ps(srcChannels + i));
+        __m128i hi = FloatToHalf(_mm_loadu_ps(srcChannels + i + 4));
+        _mm_storeu_si128((__m128i*)(dstChannels + i), _mm_packs_epi32(lo, hi));
+    }
+#endif
+
+    for (; i < channelNum; i++) {
+        float x = 0.0f;
+        memcpy(&x, srcChannels + i, sizeof(x));
+        dstChannels[i] = FloatToHalf(x);
+    }
+}
+
+bool nri::IsFormatConversionSupported(Format srcFormat, Format dstFormat) {
+    if (srcFormat == dstFormat)
+        return true;
+
+    ConversionFormat src = GetConversionFormat(srcFormat);
+    ConversionFormat dst = GetConversionFormat(dstFormat);
+
+    return src.channelType != ChannelType::UNSUPPORTED && dst.channelType != ChannelType::UNSUPPORTED;
+}
+
+void nri::ConvertTextureData(void* dstData, uint64_t dstRowPitch, uint64_t dstSlicePitch, Format dstFormat, const void* srcData, uint64_t srcRowPitch, uint64_t srcSlicePitch, Format srcFormat, uint32_t width, uint32_t rowNum, uint32_t sliceNum) {
+    ConversionFormat src = GetConversionFormat(srcFormat);
+    ConversionFormat dst = GetConversionFormat(dstFormat);
+
+    bool isSameLayout = src.channelNum == dst.channelNum && src.channelOrder[0] == dst.channelOrder[0];
+    bool isToHalf = isSameLayout && src.channelType == ChannelType::SFLOAT32 && dst.channelType == ChannelType::SFLOAT16;
+    bool is8 = src.channelType == ChannelType::UNORM8 && dst.channelType == ChannelType::UNORM8;
+
+    // Convert a chunk of pixels in cached memory, then stream it to (write-combined) upload memory
+    alignas(16) uint8_t chunk[CONVERSION_CHUNK_SIZE];
+    uint32_t chunkPixelNum = CONVERSION_CHUNK_SIZE / dst.stride;
+
+    for (uint32_t z = 0; z < sliceNum; z++) {
+        for (uint32_t y = 0; y < rowNum; y++) {
+            uint8_t* dstRow = (uint8_t*)dstData + z * dstSlicePitch + y * dstRowPitch;
+            const uint8_t* srcRow = (const uint8_t*)srcData + z * srcSlicePitch + y * srcRowPitch;
+
+            for (uint32_t x = 0; x < width; x += chunkPixelNum) {
+                uint32_t pixelNum = std::min(chunkPixelNum, width - x);
+                const uint8_t* srcPixels = srcRow + x * src.stride;
+
+                if (isToHalf)
+                    ConvertPixelsToHalf(chunk, srcPixels, pixelNum * src.channelNum);
+                else if (is8)
+                    ConvertPixels8(chunk, dst, srcPixels, src, pixelNum);
+                else
+                    ConvertPixels(chunk, dst, srcPixels, src, pixelNum);
+
+                CopyToUploadMemory(dstRow + x * dst.stride, chunk, pixelNum * dst.stride);
+            }
+        }
+    }
+
+    FlushUploadMemoryWrites();
+}
+
+bool nri::IsMipGenerationSupported(Format format) {
+    return GetConversionFormat(format).channelType != ChannelType::UNSUPPORTED;
+}
+
+void nri::GenerateMip(void* dstData, uint32_t dstRowPitch, const void* srcData, uint32_t srcRowPitch, Format format, Dim_t srcWidth, Dim_t srcHeight, bool isNormalMap) {
+    ConversionFormat conversionFormat = GetConversionFormat(format);
+    bool isUnorm = conversionFormat.channelType == ChannelType::UNORM8;
+    bool isZReconstructed = conversionFormat.channelNum < 3;
+
+    Dim_t w = (Dim_t)std::max(srcWidth >> 1, 1);
+    Dim_t h = (Dim_t)std::max(srcHeight >> 1, 1);
+
+    for (Dim_t y = 0; y < h; y++) {
+        // Odd dimensions: the last row and column get clamped
+        const uint8_t* srcRows[2] = {
+            (const uint8_t*)srcData + std::min(y * 2, srcHeight - 1) * srcRowPitch,
+            (const uint8_t*)srcData + std::min(y * 2 + 1, srcHeight - 1) * srcRowPitch,
+        };
+
+        uint8_t* dstRow = (uint8_t*)dstData + y * dstRowPitch;
+
+        for (Dim_t x = 0; x < w; x++) {
+            uint32_t srcColumns[2] = {
+                uint32_t(std::min(x * 2, srcWidth - 1)) * conversionFormat.stride,
+                uint32_t(std::min(x * 2 + 1, srcWidth - 1)) * conversionFormat.stride,
+            };
+
+            alignas(16) float taps[4][4];
+            for (uint32_t i = 0; i < 4; i++) {
+                float* tap = taps[i];
+                DecodePixel(srcRows[i >> 1] + srcColumns[i & 1], conversionFormat, tap);
+
+                if (isNormalMap) {
+                    if (isUnorm) {
+                        for (uint32_t c = 0; c < 3; c++)
+                            tap[c] = tap[c] * 2.0f - 1.0f;
+                    }
+
+                    if (isZReconstructed)
+                        tap[2] = sqrtf(std::max(1.0f - tap[0] * tap[0] - tap[1] * tap[1], 0.0f));
+                }
+            }
+
+            // Box filter
+            alignas(16) float rgba[4];
+#if NRI_SSE2
+            __m128 sum = _mm_add_ps(_mm_add_ps(_mm_load_ps(taps[0]), _mm_load_ps(taps[1])), _mm_add_ps(_mm_load_ps(taps[2]), _mm_load_ps(taps[3])));
+            _mm_store_ps(rgba, _mm_mul_ps(sum, _mm_set1_ps(0.25f)));
+#else
+            for (uint32_t c = 0; c < 4; c++)
+                rgba[c] = (taps[0][c] + taps[1][c] + taps[2][c] + taps[3][c]) * 0.25f;
+#endif
+
+            if (isNormalMap) {
+                float len = sqrtf(rgba[0] * rgba[0] + rgba[1] * rgba[1] + rgba[2] * rgba[2]);
+                float invLen = len > 0.0f ? 1.0f / len : 0.0f;
+
+                for (uint32_t c = 0; c < 3; c++) {
+                    rgba[c] *= invLen;
+                    if (isUnorm)
+                        rgba[c] = rgba[c] * 0.5f + 0.5f;
+                }
+            }
+
+            EncodePixel(dstRow + x * conversionFormat.stride, conversionFormat, rgba);
+        }
+    }
+}
@@ -2,13 +2,34 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 namespace nri {
 
+constexpr uint64_t MIP_GENERATION_PARALLEL_MIN_SIZE = 256 * 1024; // below this size of generated mips spawning threads is not worth it
+
+// A mip chain of a layer, each mip is generated from the previous one (chains are independent)
+struct MipChain {
+    const TextureDesc* textureDesc;
+    const TextureSubresourceUploadDesc* topMip;
+    TextureSubresourceUploadDesc* subresources; // "mipNum" subresources, "slices" and pitches are set up front
+    Format dataFormat;
+    bool isConverted;
+    bool isNormalMap;
+};
+
 struct HelperDataUpload {
     inline HelperDataUpload(const CoreInterface& NRI, Device& device, Queue& queue)
         : m_iCore(NRI)
         , m_Device(device)
-        , m_Queue(queue) {
+        , m_Queue(queue)
+        , m_FileViews(((DeviceBase&)device).GetStdAllocator())
+        , m_TextureUploadDescs(((DeviceBase&)device).GetStdAllocator())
+        , m_GeneratedSubresources(((DeviceBase&)device).GetStdAllocator())
+        , m_GeneratedMips(((DeviceBase&)device).GetStdAllocator())
+        , m_MipChains(((DeviceBase&)device).GetStdAllocator()) {
     }
 
     Result UploadData(const TextureUploadDesc* textureDataDescs, uint32_t textureDataDescNum, const BufferUploadDesc* bufferDataDescs, uint32_t bufferDataDescNum);
@@ -16,14 +37,23 @@ struct HelperDataUpload {
 private:
     Result Create(const TextureUploadDesc* textureUploadDescs, uint32_t textureUploadDescNum, const BufferUploadDesc* bufferUploadDescs, uint32_t bufferUploadDescNum);
     Result UploadTextures(const TextureUploadDesc* textureDataDescs, uint32_t textureDataDescNum);
+    Result GenerateMips(const TextureUploadDesc* textureUploadDescs, uint32_t textureUploadDescNum);
+    void GenerateMipChain(const MipChain& mipChain) const;
     Result UploadBuffers(const BufferUploadDesc* bufferDataDescs, uint32_t bufferDataDescNum);
     Result EndCommandBuffersAndSubmit();
     bool CopyTextureContent(const TextureUploadDesc& textureDataDesc, Dim_t& layerOffset, Dim_t& mipOffset);
     bool CopyBufferContent(const BufferUploadDesc& bufferDataDesc, uint64_t& bufferContentOffset);
+    Result MapFile(const UploadFileDesc& file, uint64_t offset, uint64_t size);
+    FileView GetFileView(const UploadFileDesc& file) const;
 
     const CoreInterface& m_iCore;
     Device& m_Device;
     Queue& m_Queue;
+    Vector<FileView> m_FileViews; // files mapped for the duration of "UploadData"
+    Vector<TextureUploadDesc> m_TextureUploadDescs;                 // with generated mips (if "mipGeneration" is used)
+    Vector<TextureSubresourceUploadDesc> m_GeneratedSubresources;
+    Vector<uint8_t> m_GeneratedMips;                                // not in staging: each mip is read to filter the next one (slow from write-combined memory) and staging gets recycled once full
+    Vector<MipChain> m_MipChains;                                   // generated in parallel
     CommandBuffer* m_CommandBuffer = nullptr;
     Fence* m_Fence = nullptr;
     CommandAllocator* m_CommandAllocator = nullptr;
@@ -70,4 +100,262 @@ private:
     Vector<BindTextureMemoryDesc> m_TextureBindingDescs;
 };
 
+struct ResidencyEntry {
+    Memory* memory; // "nullptr" if the handle is free
+    uint64_t size;
+    uint64_t lastUsedFrame;
+    float priority;
+    bool isDemoted;
+};
+
+// Device-agnostic: works on top of the device's own "HelperInterface", i.e. "Memory" objects of the layer the manager is created on
+struct HelperResidencyManager final {
+    HelperResidencyManager(Device& device);
+
+    inline Device& GetDevice() const {
+        return m_Device;
+    }
+
+    Result Create(const ResidencyManagerDesc& residencyManagerDesc);
+    uint32_t TrackMemory(Memory& memory, uint64_t size, float priority);
+    void UntrackMemory(uint32_t memoryHandle);
+    void MarkMemoryUsed(const uint32_t* memoryHandles, uint32_t memoryHandleNum);
+    Result UpdateResidency(ResidencyStats* residencyStats);
+
+private:
+    Device& m_Device;
+    HelperInterface m_iHelper = {};
+    ResidencyManagerDesc m_Desc = {};
+    Vector<ResidencyEntry> m_Entries; // handle = index + 1
+    Vector<uint32_t> m_FreeHandles;
+    Vector<uint32_t> m_Candidates;
+    ResidencyStats m_Stats = {};
+    uint64_t m_FrameIndex = 0;
+    Lock m_Lock;
+};
+
+struct DefragmentationAllocation {
+    uint32_t memoryIndex;
+    uint32_t alignment;
+    uint64_t size;
+    MemoryType type;
+    bool mustBeDedicated;
+    bool isMultisample;
+};
+
+struct DefragmentationPlannedMove {
+    uint32_t resourceIndex;
+    uint32_t dstMemoryIndex; // in "m_NewMemories"
+    uint64_t dstOffset;
+    uint64_t size;
+    Buffer* buffer;
+    Texture* texture;
+};
+
+struct DefragmentationNewMemory {
+    Memory* memory;
+    uint64_t size;
+    MemoryType type;
+    bool allowMultisampleTextures;
+    bool isHandedOut;
+};
+
+// CPU-only planning (a free function to be testable in isolation): "defragmenterDesc" must have defaults applied
+void PlanDefragmentationMoves(const DefragmenterDesc& defragmenterDesc, const Vector<uint64_t>& memorySizes, const Vector<DefragmentationAllocation>& allocations,
+    Vector<DefragmentationPlannedMove>& moves, Vector<DefragmentationNewMemory>& newMemories);
+
+struct HelperDefragmenter final {
+    HelperDefragmenter(const CoreInterface& NRI, Device& device, Queue& queue);
+    ~HelperDefragmenter();
+
+    inline Device& GetDevice() const {
+        return m_Device;
+    }
+
+    Result Create(const DefragmenterDesc& defragmenterDesc);
+    uint32_t PlanDefragmentation(const DefragmentationDesc& defragmentationDesc);
+    Result DefragmentStep(DefragmentationResult& defragmentationResult);
+
+
+private:
+    Result RecordAndSubmit();
+    void CompleteInFlightMoves();
+
+    const CoreInterface& m_iCore;
+    Device& m_Device;
+    Queue& m_Queue;
+    DefragmenterDesc m_Desc = {};
+    Vector<DefragmentationResourceDesc> m_Resources;
+    Vector<DefragmentationAllocation> m_Allocations;
+    Vector<uint64_t> m_MemorySizes;
+    Vector<uint32_t> m_PendingMoveNums; // per source memory
+    Vector<DefragmentationPlannedMove> m_Moves;
+    Vector<DefragmentationNewMemory> m_NewMemories;
+    Vector<BufferBarrierDesc> m_BufferBarriers;
+    Vector<TextureBarrierDesc> m_TextureBarriers;
+    Vector<DefragmentationMove> m_CompletedMoves;
+    Vector<Memory*> m_CompletedMemories;
+    Vector<uint32_t> m_EmptiedMemories;
+    CommandAllocator* m_CommandAllocator = nullptr;
+    CommandBuffer* m_CommandBuffer = nullptr;
+    Fence* m_Fence = nullptr;
+    uint64_t m_FenceValue = 0;
+    uint32_t m_NextMove = 0;     // first not yet recorded move
+    uint32_t m_InFlightMove = 0; // first recorded but not yet completed move
+};
+
+// Device-agnostic: works on top of the device's own "CoreInterface" and "HelperInterface"
+struct HelperPipelineCacheStore final {
+    HelperPipelineCacheStore(Device& device);
+    ~HelperPipelineCacheStore();
+
+    inline Device& GetDevice() const {
+        return m_Device;
+    }
+
+    Result Create(const PipelineCacheStoreDesc& pipelineCacheStoreDesc);
+    PipelineCache* GetPipelineCache(uint32_t workerIndex) const;
+    Result Save(bool async);
+    void GetStats(PipelineCacheStoreStats& pipelineCacheStoreStats) const;
+
+private:
+    Vector<uint8_t> Load();
+    Result SaveSync();
+
+    Device& m_Device;
+    CoreInterface m_iCore = {};
+    HelperInterface m_iHelper = {};
+    String m_FileName;
+    Vector<PipelineCache*> m_PipelineCaches; // main, then worker caches
+    Vector<uint8_t> m_Blob;                  // header + payload, reused between saves
+    std::thread m_SaveThread;
+    PipelineCacheStoreStats m_Stats = {};
+    uint64_t m_SavedHash = 0;
+    Result m_AsyncSaveResult = Result::SUCCESS;
+    bool m_IsMergeSupported = false;
+    Lock m_SaveLock;
+    mutable Lock m_StatsLock;
+};
+
+enum class AsyncPipelineState : uint32_t {
+    PENDING,
+    READY,
+    FAILED
+};
+
+// A pipeline handle is [generation : 12][slot index + 1 : 20], a released slot gets the next generation
+constexpr uint32_t PIPELINE_HANDLE_INDEX_BITS = 20;
+constexpr uint32_t PIPELINE_HANDLE_INDEX_MASK = (1u << PIPELINE_HANDLE_INDEX_BITS) - 1;
+constexpr uint32_t PIPELINE_HANDLE_GENERATION_MASK = (1u << (32 - PIPELINE_HANDLE_INDEX_BITS)) - 1;
+constexpr uint32_t PIPELINE_COMPILER_DEFAULT_PIPELINE_MAX_NUM = 4096;
+
+struct AsyncPipeline {
+    GraphicsPipelineDesc graphicsPipelineDesc = {};
+    ComputePipelineDesc computePipelineDesc = {};
+    std::atomic<Pipeline*> pipeline = {nullptr}; // published by "status"
+    std::atomic_uint32_t status = {0};           // [generation : 12][AsyncPipelineState : 2], readers don't lock
+    bool isCompute = false;                      // guarded by "m_Mutex"
+    bool isReleased = false;                     // guarded by "m_Mutex", released while pending, a worker frees the slot
+};
+
+// Device-agnostic: works on top of the device's own "CoreInterface"
+struct HelperPipelineCompiler final {
+    HelperPipelineCompiler(Device& device);
+    ~HelperPipelineCompiler();
+
+    inline Device& GetDevice() const {
+        return m_Device;
+    }
+
+    Result Create(const PipelineCompilerDesc& pipelineCompilerDesc);
+    uint32_t Compile(const GraphicsPipelineDesc& graphicsPipelineDesc);
+    uint32_t Compile(const ComputePipelineDesc& computePipelineDesc);
+    bool IsReady(uint32_t pipelineHandle) const;
+    Pipeline* Acquire(uint32_t pipelineHandle, Pipeline* substitute) const;
+    void Release(uint32_t pipelineHandle);
+
+private:
+    uint32_t Enqueue(const GraphicsPipelineDesc* graphicsPipelineDesc, const ComputePipelineDesc* computePipelineDesc);
+    AsyncPipeline* GetSlot(uint32_t pipelineHandle, uint32_t& status) const;
+    void WorkerThread();
+
+    Device& m_Device;
+    CoreInterface m_iCore = {};
+    PipelineCompilerDesc m_Desc = {};
+    AsyncPipeline* m_Slots = nullptr; // never reallocated, i.e. readers can access slots without locking
+    Vector<uint32_t> m_FreeSlots;     // guarded by "m_Mutex"
+    Vector<uint32_t> m_Queue;         // FIFO, starting at "m_QueueHead", guarded by "m_Mutex"
+    Vector<std::thread> m_Threads;
+    size_t m_QueueHead = 0;
+    uint32_t m_SlotMaxNum = 0;
+    uint32_t m_SlotNum = 0; // slots starting from it have never been used, guarded by "m_Mutex"
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    bool m_IsStopped = false;
+};
+
+struct BindlessClass {
+    DescriptorSet* descriptorSet;
+    std::atomic_uint32_t* freeListNext; // "index + 1" of the next free index, 0 terminates the list
+    uint32_t rangeIndex;
+    uint32_t descriptorNum;
+    DescriptorType descriptorType;
+    alignas(LOCK_CACHELINE_SIZE) std::atomic_uint64_t freeListHead; // [tag : 32][index + 1 : 32], the tag protects from ABA
+    std::atomic_uint32_t unusedIndex;                               // indices starting from it have never been allocated
+    alignas(LOCK_CACHELINE_SIZE) std::atomic_uint32_t retireHead;   // "index + 1" of the last released index (MPSC, also linked via "freeListNext", emptied by "Update")
+};
+
+struct BindlessWrite {
+    const Descriptor* descriptor;
+    uint32_t classIndex;
+    uint32_t index;
+};
+
+struct BindlessRelease {
+    uint64_t frameIndex;
+    uint32_t classIndex;
+    uint32_t index;
+};
+
+// Device-agnostic: works on top of the device's own "CoreInterface"
+struct HelperBindlessAllocator final {
+    HelperBindlessAllocator(Device& device);
+    ~HelperBindlessAllocator();
+
+    inline Device& GetDevice() const {
+        return m_Device;
+    }
+
+    inline uint32_t GetClassNum() const {
+        return m_ClassNum;
+    }
+
+    inline uint32_t GetDescriptorNum(uint32_t classIndex) const {
+        return m_Classes[classIndex].descriptorNum;
+    }
+
+    Result Create(const BindlessAllocatorDesc& bindlessAllocatorDesc);
+    DescriptorSet* GetDescriptorSet(uint32_t classIndex) const;
+    Result AllocateIndex(uint32_t classIndex, uint32_t& index);
+    void ReleaseIndex(uint32_t classIndex, uint32_t index);
+    void SetDescriptor(uint32_t classIndex, uint32_t index, const Descriptor& descriptor);
+    void Update(uint64_t completedFrameNum);
+
+private:
+    void PushFreeIndex(BindlessClass& bindlessClass, uint32_t index);
+
+    Device& m_Device;
+    CoreInterface m_iCore = {};
+    DescriptorPool* m_DescriptorPool = nullptr;
+    BindlessClass* m_Classes = nullptr;
+    std::atomic_uint32_t* m_FreeListNext = nullptr; // shared by all classes
+    Vector<BindlessWrite> m_Writes;
+    Vector<BindlessRelease> m_Releases; // retired, waiting for the GPU, owned by "Update"
+    Vector<const Descriptor*> m_UpdateDescriptors; // reused between updates
+    Vector<UpdateDescriptorRangeDesc> m_UpdateRanges;
+    uint64_t m_FrameIndex = 0;
+    uint32_t m_ClassNum = 0;
+    Lock m_Lock;
+};
+
 } // namespace nri
\ No newline at end of file
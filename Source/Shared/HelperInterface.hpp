@@ -12,6 +12,24 @@ enum class BarrierMode {
     FINAL_NO_DATA, // initial state is not needed, since there is nothing to upload
 };
 
+static inline bool HasData(const BufferUploadDesc& bufferUploadDesc) {
+    return bufferUploadDesc.data || bufferUploadDesc.file;
+}
+
+static inline bool IsConverted(const TextureUploadDesc& textureUploadDesc, const TextureDesc& textureDesc) {
+    return textureUploadDesc.dataFormat != Format::UNKNOWN && textureUploadDesc.dataFormat != textureDesc.format;
+}
+
+// Row size in the upload buffer (differs from the source "rowPitch" if data gets converted)
+static inline uint32_t GetUploadRowSize(const DeviceDesc& deviceDesc, const TextureUploadDesc& textureUploadDesc, const TextureDesc& textureDesc, const TextureSubresourceUploadDesc& subresource, Dim_t mip) {
+    if (!IsConverted(textureUploadDesc, textureDesc))
+        return subresource.rowPitch;
+
+    Dim_t w = GetDimension(deviceDesc.graphicsAPI, textureDesc, 0, mip);
+
+    return w * GetFormatProps(textureDesc.format).stride;
+}
+
 static void DoTransition(const CoreInterface& m_iCore, CommandBuffer* commandBuffer, BarrierMode barrierMode, const TextureUploadDesc* textureUploadDescs, uint32_t textureDataDescNum) {
     TextureBarrierDesc textureBarriers[BARRIERS_PER_PASS];
 
@@ -83,8 +101,12 @@ static void DoTransition(const CoreInterface& m_iCore, CommandBuffer* commandBuf
 }
 
 Result HelperDataUpload::UploadData(const TextureUploadDesc* textureUploadDescs, uint32_t textureUploadDescNum, const BufferUploadDesc* bufferUploadDescs, uint32_t bufferUploadDescNum) {
-    Result result = Create(textureUploadDescs, textureUploadDescNum, bufferUploadDescs, bufferUploadDescNum);
+    Result result = GenerateMips(textureUploadDescs, textureUploadDescNum);
+    if (!m_TextureUploadDescs.empty())
+        textureUploadDescs = m_TextureUploadDescs.data();
 
+    if (result == Result::SUCCESS)
+        result = Create(textureUploadDescs, textureUploadDescNum, bufferUploadDescs, bufferUploadDescNum);
     if (result == Result::SUCCESS)
         result = UploadTextures(textureUploadDescs, textureUploadDescNum);
     if (result == Result::SUCCESS)
@@ -95,12 +117,184 @@ Result HelperDataUpload::UploadData(const TextureUploadDesc* textureUploadDescs,
     m_iCore.DestroyFence(m_Fence);
     m_iCore.DestroyBuffer(m_UploadBuffer);
 
+    for (FileView& fileView : m_FileViews)
+        UnmapFileView(fileView);
+    m_FileViews.clear();
+
+    m_TextureUploadDescs.clear();
+    m_GeneratedSubresources.clear();
+    m_GeneratedMips.clear();
+
     return result;
 }
 
+Result HelperDataUpload::GenerateMips(const TextureUploadDesc* textureUploadDescs, uint32_t textureUploadDescNum) {
+    const DeviceDesc& deviceDesc = m_iCore.GetDeviceDesc(m_Device);
+
+    // Calculate the size of generated mip chains (tightly packed, top mips only if converted)
+    uint64_t mipsSize = 0;
+    size_t subresourceNum = 0;
+
+    for (uint32_t i = 0; i < textureUploadDescNum; i++) {
+        const TextureUploadDesc& textureUploadDesc = textureUploadDescs[i];
+        if (!textureUploadDesc.subresources || textureUploadDesc.mipGeneration == MipGeneration::NONE)
+            continue;
+
+        const TextureDesc& textureDesc = m_iCore.GetTextureDesc(*textureUploadDesc.texture);
+        const FormatProps& formatProps = GetFormatProps(textureDesc.format);
+
+        for (Dim_t mip = IsConverted(textureUploadDesc, textureDesc) ? 0 : 1; mip < textureDesc.mipNum; mip++) {
+            Dim_t w = GetDimension(deviceDesc.graphicsAPI, textureDesc, 0, mip);
+            Dim_t h = GetDimension(deviceDesc.graphicsAPI, textureDesc, 1, mip);
+
+            mipsSize += uint64_t(w) * h * formatProps.stride * textureDesc.layerNum;
+        }
+
+        subresourceNum += textureDesc.layerNum * textureDesc.mipNum;
+    }
+
+    if (!subresourceNum)
+        return Result::SUCCESS;
+
+    m_TextureUploadDescs.assign(textureUploadDescs, textureUploadDescs + textureUploadDescNum);
+    m_GeneratedSubresources.resize(subresourceNum);
+    m_GeneratedMips.resize((size_t)mipsSize);
+
+    uint8_t* mips = m_GeneratedMips.data();
+    TextureSubresourceUploadDesc* subresources = m_GeneratedSubresources.data();
+
+    // Lay out generated mips (offsets don't depend on the content)
+    for (TextureUploadDesc& textureUploadDesc : m_TextureUploadDescs) {
+        if (!textureUploadDesc.subresources || textureUploadDesc.mipGeneration == MipGeneration::NONE)
+            continue;
+
+        const TextureDesc& textureDesc = m_iCore.GetTextureDesc(*textureUploadDesc.texture);
+        const FormatProps& formatProps = GetFormatProps(textureDesc.format);
+        bool isConverted = IsConverted(textureUploadDesc, textureDesc);
+
+        for (Dim_t layer = 0; layer < textureDesc.layerNum; layer++) {
+            MipChain& mipChain = m_MipChains.emplace_back();
+            mipChain.textureDesc = &textureDesc;
+            mipChain.topMip = textureUploadDesc.subresources + layer;
+            mipChain.subresources = subresources + layer * textureDesc.mipNum;
+            mipChain.dataFormat = textureUploadDesc.dataFormat;
+            mipChain.isConverted = isConverted;
+            mipChain.isNormalMap = textureUploadDesc.mipGeneration == MipGeneration::NORMAL_MAP;
+
+            for (Dim_t mip = 0; mip < textureDesc.mipNum; mip++) {
+                Dim_t w = GetDimension(deviceDesc.graphicsAPI, textureDesc, 0, mip);
+                Dim_t h = GetDimension(deviceDesc.graphicsAPI, textureDesc, 1, mip);
+
+                TextureSubresourceUploadDesc& subresource = mipChain.subresources[mip];
+
+                // Not converted top mips are used in place
+                if (mip == 0 && !isConverted) {
+                    subresource = *mipChain.topMip;
+                    continue;
+                }
+
+                subresource = {};
+                subresource.slices = mips;
+                subresource.sliceNum = 1;
+                subresource.rowPitch = w * formatProps.stride;
+                subresource.slicePitch = subresource.rowPitch * h;
+
+                mips += subresource.slicePitch;
+            }
+        }
+
+        textureUploadDesc.subresources = subresources;
+        textureUploadDesc.dataFormat = Format::UNKNOWN;
+        textureUploadDesc.mipGeneration = MipGeneration::NONE;
+
+        subresources += textureDesc.layerNum * textureDesc.mipNum;
+    }
+
+    // Generate chains in parallel (the calling thread participates)
+    uint32_t threadNum = std::max(std::thread::hardware_concurrency() / 2, 1u);
+    threadNum = std::min(threadNum, (uint32_t)m_MipChains.size());
+    if (mipsSize < MIP_GENERATION_PARALLEL_MIN_SIZE)
+        threadNum = 1;
+
+    std::atomic_size_t nextMipChain = {0};
+    auto worker = [&]() {
+        for (size_t i = nextMipChain++; i < m_MipChains.size(); i = nextMipChain++)
+            GenerateMipChain(m_MipChains[i]);
+    };
+
+    Vector<std::thread> threads(((DeviceBase&)m_Device).GetStdAllocator());
+    for (uint32_t i = 1; i < threadNum; i++)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    m_MipChains.clear();
+
+    return Result::SUCCESS;
+}
+
+void HelperDataUpload::GenerateMipChain(const MipChain& mipChain) const {
+    const DeviceDesc& deviceDesc = m_iCore.GetDeviceDesc(m_Device);
+    const TextureDesc& textureDesc = *mipChain.textureDesc;
+    const TextureSubresourceUploadDesc& topMip = *mipChain.topMip;
+
+    // Each mip from the previous one
+    for (Dim_t mip = mipChain.isConverted ? 0 : 1; mip < textureDesc.mipNum; mip++) {
+        Dim_t w = GetDimension(deviceDesc.graphicsAPI, textureDesc, 0, mip);
+        Dim_t h = GetDimension(deviceDesc.graphicsAPI, textureDesc, 1, mip);
+
+        const TextureSubresourceUploadDesc& subresource = mipChain.subresources[mip];
+        uint8_t* dst = (uint8_t*)subresource.slices;
+
+        if (mip == 0)
+            ConvertTextureData(dst, subresource.rowPitch, subresource.slicePitch, textureDesc.format, topMip.slices, topMip.rowPitch, topMip.slicePitch, mipChain.dataFormat, w, h, 1);
+        else {
+            const TextureSubresourceUploadDesc& prevMip = mipChain.subresources[mip - 1];
+            Dim_t prevW = GetDimension(deviceDesc.graphicsAPI, textureDesc, 0, mip - 1);
+            Dim_t prevH = GetDimension(deviceDesc.graphicsAPI, textureDesc, 1, mip - 1);
+
+            GenerateMip(dst, subresource.rowPitch, prevMip.slices, prevMip.rowPitch, textureDesc.format, prevW, prevH, mipChain.isNormalMap);
+        }
+    }
+}
+
 Result HelperDataUpload::Create(const TextureUploadDesc* textureUploadDescs, uint32_t textureUploadDescNum, const BufferUploadDesc* bufferUploadDescs, uint32_t bufferUploadDescNum) {
     const DeviceDesc& deviceDesc = m_iCore.GetDeviceDesc(m_Device);
 
+    { // Map files (each file once) and validate ranges
+        for (uint32_t i = 0; i < textureUploadDescNum; i++) {
+            const TextureUploadDesc& textureUploadDesc = textureUploadDescs[i];
+            if (!textureUploadDesc.subresources || !textureUploadDesc.file)
+                continue;
+
+            const TextureDesc& textureDesc = m_iCore.GetTextureDesc(*textureUploadDesc.texture);
+            uint32_t subresourceNum = textureDesc.layerNum * textureDesc.mipNum;
+
+            for (uint32_t j = 0; j < subresourceNum; j++) {
+                const TextureSubresourceUploadDesc& subresource = textureUploadDesc.subresources[j];
+
+                Result result = MapFile(*textureUploadDesc.file, subresource.fileOffset, uint64_t(subresource.slicePitch) * subresource.sliceNum);
+                if (result != Result::SUCCESS)
+                    return result;
+            }
+        }
+
+        for (uint32_t i = 0; i < bufferUploadDescNum; i++) {
+            const BufferUploadDesc& bufferUploadDesc = bufferUploadDescs[i];
+            if (!bufferUploadDesc.file)
+                continue;
+
+            const BufferDesc& bufferDesc = m_iCore.GetBufferDesc(*bufferUploadDesc.buffer);
+
+            Result result = MapFile(*bufferUploadDesc.file, bufferUploadDesc.fileOffset, bufferDesc.size);
+            if (result != Result::SUCCESS)
+                return result;
+        }
+    }
+
     { // Calculate upload buffer size
         uint64_t maxSubresourceSize = 0;
         uint64_t totalSize = 0;
@@ -112,7 +306,7 @@ Result HelperDataUpload::Create(const TextureUploadDesc* textureUploadDescs, uin
                 const TextureDesc& textureDesc = m_iCore.GetTextureDesc(*textureUploadDesc.texture);
 
                 uint32_t sliceRowNum = subresource0.slicePitch / subresource0.rowPitch;
-                uint64_t alignedRowPitch = Align(subresource0.rowPitch, deviceDesc.memoryAlignment.uploadBufferTextureRow);
+                uint64_t alignedRowPitch = Align(GetUploadRowSize(deviceDesc, textureUploadDesc, textureDesc, subresource0, 0), deviceDesc.memoryAlignment.uploadBufferTextureRow);
                 uint64_t alignedSlicePitch = Align(sliceRowNum * alignedRowPitch, deviceDesc.memoryAlignment.uploadBufferTextureSlice);
                 uint64_t alignedSize = alignedSlicePitch * subresource0.sliceNum;
 
@@ -131,7 +325,7 @@ Result HelperDataUpload::Create(const TextureUploadDesc* textureUploadDescs, uin
         for (uint32_t i = 0; i < bufferUploadDescNum; i++) {
             // Doesn't contribute to "maxSubresourceSize" because buffer copies can work with any non-0 upload buffer size
             const BufferUploadDesc& bufferUploadDesc = bufferUploadDescs[i];
-            if (bufferUploadDesc.data) {
+            if (HasData(bufferUploadDesc)) {
                 const BufferDesc& bufferDesc = m_iCore.GetBufferDesc(*bufferUploadDesc.buffer);
 
                 totalSize += bufferDesc.size;
@@ -224,7 +418,7 @@ Result HelperDataUpload::UploadBuffers(const BufferUploadDesc* bufferUploadDescs
     uint32_t i = 0;
     for (; i < bufferUploadDescNum; i++) {
         const BufferUploadDesc& bufferUploadDesc = bufferUploadDescs[i];
-        if (bufferUploadDesc.data)
+        if (HasData(bufferUploadDesc))
             break;
     }
 
@@ -303,7 +497,8 @@ bool HelperDataUpload::CopyTextureContent(const TextureUploadDesc& textureUpload
             const auto& subresource = textureUploadDesc.subresources[layerOffset * textureDesc.mipNum + mipOffset];
 
             uint32_t sliceRowNum = subresource.slicePitch / subresource.rowPitch;
-            uint32_t alignedRowPitch = Align(subresource.rowPitch, deviceDesc.memoryAlignment.uploadBufferTextureRow);
+            uint32_t rowSize = GetUploadRowSize(deviceDesc, textureUploadDesc, textureDesc, subresource, mipOffset);
+            uint32_t alignedRowPitch = Align(rowSize, deviceDesc.memoryAlignment.uploadBufferTextureRow);
             uint32_t alignedSlicePitch = Align(sliceRowNum * alignedRowPitch, deviceDesc.memoryAlignment.uploadBufferTextureSlice);
             uint64_t alignedSize = uint64_t(alignedSlicePitch) * subresource.sliceNum;
             uint64_t freeSpace = m_UploadBufferSize - m_UploadBufferOffset;
@@ -313,17 +508,22 @@ bool HelperDataUpload::CopyTextureContent(const TextureUploadDesc& textureUpload
                 return false;
             }
 
+            // Source data: user memory or mapped file pages
+            const uint8_t* src = (const uint8_t*)subresource.slices;
+            if (textureUploadDesc.file) {
+                FileView fileView = GetFileView(*textureUploadDesc.file);
+                PrefetchFileView(fileView, subresource.fileOffset, uint64_t(subresource.slicePitch) * subresource.sliceNum);
+
+                src = fileView.data + subresource.fileOffset;
+            }
+
             // Upload data (D3D11 does not allow to use upload buffer while it's mapped)
             uint8_t* slices = (uint8_t*)m_iCore.MapBuffer(*m_UploadBuffer, m_UploadBufferOffset, subresource.sliceNum * alignedSlicePitch);
-            {
-                for (uint32_t k = 0; k < subresource.sliceNum; k++) {
-                    for (uint32_t l = 0; l < sliceRowNum; l++) {
-                        uint8_t* dstRow = slices + k * alignedSlicePitch + l * alignedRowPitch;
-                        uint8_t* srcRow = (uint8_t*)subresource.slices + k * subresource.slicePitch + l * subresource.rowPitch;
-                        memcpy(dstRow, srcRow, subresource.rowPitch);
-                    }
-                }
-            }
+            if (IsConverted(textureUploadDesc, textureDesc)) {
+                uint32_t w = rowSize / GetFormatProps(textureDesc.format).stride;
+                ConvertTextureData(slices, alignedRowPitch, alignedSlicePitch, textureDesc.format, src, subresource.rowPitch, subresource.slicePitch, textureUploadDesc.dataFormat, w, sliceRowNum, subresource.sliceNum);
+            } else
+                CopyTextureData(slices, alignedRowPitch, alignedSlicePitch, src, subresource.rowPitch, subresource.slicePitch, subresource.rowPitch, sliceRowNum, subresource.sliceNum, true);
             m_iCore.UnmapBuffer(*m_UploadBuffer);
 
             { // Copy
@@ -350,7 +550,7 @@ bool HelperDataUpload::CopyTextureContent(const TextureUploadDesc& textureUpload
 }
 
 bool HelperDataUpload::CopyBufferContent(const BufferUploadDesc& bufferUploadDesc, uint64_t& bufferContentOffset) {
-    if (!bufferUploadDesc.data)
+    if (!HasData(bufferUploadDesc))
         return true;
 
     const BufferDesc& bufferDesc = m_iCore.GetBufferDesc(*bufferUploadDesc.buffer);
@@ -361,7 +561,16 @@ bool HelperDataUpload::CopyBufferContent(const BufferUploadDesc& bufferUploadDes
     if (freeSpace == 0)
         return false;
 
-    memcpy(m_MappedMemory + m_UploadBufferOffset, (uint8_t*)bufferUploadDesc.data + bufferContentOffset, copySize);
+    const uint8_t* src = (const uint8_t*)bufferUploadDesc.data;
+    if (bufferUploadDesc.file) {
+        FileView fileView = GetFileView(*bufferUploadDesc.file);
+        PrefetchFileView(fileView, bufferUploadDesc.fileOffset + bufferContentOffset, copySize);
+
+        src = fileView.data + bufferUploadDesc.fileOffset;
+    }
+
+    CopyToUploadMemory(m_MappedMemory + m_UploadBufferOffset, src + bufferContentOffset, copySize);
+    FlushUploadMemoryWrites();
 
     m_iCore.CmdCopyBuffer(*m_CommandBuffer, *bufferUploadDesc.buffer, bufferContentOffset, *m_UploadBuffer, m_UploadBufferOffset, copySize);
 
@@ -376,6 +585,40 @@ bool HelperDataUpload::CopyBufferContent(const BufferUploadDesc& bufferUploadDes
     return true;
 }
 
+Result HelperDataUpload::MapFile(const UploadFileDesc& file, uint64_t offset, uint64_t size) {
+    if (!file.mappedView && !GetFileView(file).data) {
+        FileView fileView = {};
+        if (!MapFileView(file.fileHandle, fileView))
+            return Result::FAILURE;
+
+        m_FileViews.push_back(fileView);
+    }
+
+    // The size of a user-provided view is unknown
+    FileView fileView = GetFileView(file);
+    if (offset + size > fileView.size)
+        return Result::INVALID_ARGUMENT;
+
+    return Result::SUCCESS;
+}
+
+FileView HelperDataUpload::GetFileView(const UploadFileDesc& file) const {
+    if (file.mappedView) {
+        FileView fileView = {};
+        fileView.data = (const uint8_t*)file.mappedView;
+        fileView.size = uint64_t(-1);
+
+        return fileView;
+    }
+
+    for (const FileView& fileView : m_FileViews) {
+        if (fileView.fileHandle == file.fileHandle)
+            return fileView;
+    }
+
+    return {};
+}
+
 // HelperDeviceMemoryAllocator
 HelperDeviceMemoryAllocator::MemoryHeap::MemoryHeap(MemoryType memoryType, const StdAllocator<uint8_t>& stdAllocator)
     : buffers(stdAllocator)
@@ -643,3 +886,1263 @@ void HelperDeviceMemoryAllocator::FillMemoryBindingDescs(Texture* const* texture
         desc.offset = textureOffsets[i];
     }
 }
+
+constexpr float RESIDENCY_DEMOTED_PRIORITY = -1.0f;
+
+HelperResidencyManager::HelperResidencyManager(Device& device)
+    : m_Device(device)
+    , m_Entries(((DeviceBase&)device).GetStdAllocator())
+    , m_FreeHandles(((DeviceBase&)device).GetStdAllocator())
+    , m_Candidates(((DeviceBase&)device).GetStdAllocator()) {
+}
+
+Result HelperResidencyManager::Create(const ResidencyManagerDesc& residencyManagerDesc) {
+    Result result = ((DeviceBase&)m_Device).FillFunctionTable(m_iHelper);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_Desc = residencyManagerDesc;
+    if (m_Desc.demoteThreshold == 0.0f)
+        m_Desc.demoteThreshold = 0.9f;
+    if (m_Desc.promoteThreshold == 0.0f)
+        m_Desc.promoteThreshold = 0.8f;
+    if (m_Desc.coldFrameNum == 0)
+        m_Desc.coldFrameNum = 3;
+
+    return Result::SUCCESS;
+}
+
+uint32_t HelperResidencyManager::TrackMemory(Memory& memory, uint64_t size, float priority) {
+    ExclusiveScope lock(m_Lock);
+
+    uint32_t index;
+    if (m_FreeHandles.empty()) {
+        index = (uint32_t)m_Entries.size();
+        m_Entries.push_back({});
+    } else {
+        index = m_FreeHandles.back();
+        m_FreeHandles.pop_back();
+    }
+
+    ResidencyEntry& entry = m_Entries[index];
+    entry.memory = &memory;
+    entry.size = size;
+    entry.lastUsedFrame = m_FrameIndex;
+    entry.priority = priority;
+    entry.isDemoted = false;
+
+    m_Stats.trackedSize += size;
+
+    return index + 1;
+}
+
+void HelperResidencyManager::UntrackMemory(uint32_t memoryHandle) {
+    ExclusiveScope lock(m_Lock);
+
+    uint32_t index = memoryHandle - 1;
+    if (index >= m_Entries.size() || !m_Entries[index].memory)
+        return;
+
+    ResidencyEntry& entry = m_Entries[index];
+    m_Stats.trackedSize -= entry.size;
+    if (entry.isDemoted)
+        m_Stats.demotedSize -= entry.size;
+
+    entry.memory = nullptr;
+    m_FreeHandles.push_back(index);
+}
+
+void HelperResidencyManager::MarkMemoryUsed(const uint32_t* memoryHandles, uint32_t memoryHandleNum) {
+    ExclusiveScope lock(m_Lock);
+
+    for (uint32_t i = 0; i < memoryHandleNum; i++) {
+        uint32_t index = memoryHandles[i] - 1;
+        if (index < m_Entries.size())
+            m_Entries[index].lastUsedFrame = m_FrameIndex;
+    }
+}
+
+Result HelperResidencyManager::UpdateResidency(ResidencyStats* residencyStats) {
+    ExclusiveScope lock(m_Lock);
+
+    VideoMemoryInfo videoMemoryInfo = {};
+    Result result = m_iHelper.QueryVideoMemoryInfo(m_Device, m_Desc.memoryLocation, videoMemoryInfo);
+
+    m_Stats.budgetSize = videoMemoryInfo.budgetSize;
+    m_Stats.usageSize = std::max(videoMemoryInfo.usageSize, m_Stats.trackedSize);
+    m_Stats.demotedNum = 0;
+    m_Stats.promotedNum = 0;
+
+    // Nothing to do without a budget
+    if (result == Result::SUCCESS && m_Stats.budgetSize) {
+        // Demoted allocations are assumed to be evicted (if the OS needs the memory)
+        uint64_t residentSize = m_Stats.usageSize - std::min(m_Stats.usageSize, m_Stats.demotedSize);
+        uint64_t demoteSize = uint64_t(double(m_Stats.budgetSize) * m_Desc.demoteThreshold + 0.5);
+        uint64_t promoteSize = uint64_t(double(m_Stats.budgetSize) * m_Desc.promoteThreshold + 0.5);
+        uint64_t coldFrame = m_FrameIndex >= m_Desc.coldFrameNum ? m_FrameIndex - m_Desc.coldFrameNum : 0;
+
+        if (residentSize > demoteSize) {
+            // Demote cold allocations, starting from the least important and the least recently used
+            m_Candidates.clear();
+            for (uint32_t i = 0; i < (uint32_t)m_Entries.size(); i++) {
+                const ResidencyEntry& entry = m_Entries[i];
+                if (entry.memory && !entry.isDemoted && entry.lastUsedFrame < coldFrame)
+                    m_Candidates.push_back(i);
+            }
+
+            std::sort(m_Candidates.begin(), m_Candidates.end(), [this](uint32_t a, uint32_t b) {
+                const ResidencyEntry& ea = m_Entries[a];
+                const ResidencyEntry& eb = m_Entries[b];
+
+                return ea.priority != eb.priority ? ea.priority < eb.priority : ea.lastUsedFrame < eb.lastUsedFrame;
+            });
+
+            for (uint32_t i = 0; i < (uint32_t)m_Candidates.size() && residentSize > demoteSize; i++) {
+                ResidencyEntry& entry = m_Entries[m_Candidates[i]];
+
+                result = m_iHelper.SetMemoryPriority(*entry.memory, RESIDENCY_DEMOTED_PRIORITY);
+                if (result != Result::SUCCESS)
+                    break;
+
+                entry.isDemoted = true;
+                residentSize -= std::min(residentSize, entry.size);
+
+                m_Stats.demotedSize += entry.size;
+                m_Stats.demotedNum++;
+            }
+        } else if (m_Stats.demotedSize) {
+            // Promote hot allocations, starting from the most recently used and the most important
+            m_Candidates.clear();
+            for (uint32_t i = 0; i < (uint32_t)m_Entries.size(); i++) {
+                const ResidencyEntry& entry = m_Entries[i];
+                if (entry.memory && entry.isDemoted && entry.lastUsedFrame >= coldFrame)
+                    m_Candidates.push_back(i);
+            }
+
+            std::sort(m_Candidates.begin(), m_Candidates.end(), [this](uint32_t a, uint32_t b) {
+                const ResidencyEntry& ea = m_Entries[a];
+                const ResidencyEntry& eb = m_Entries[b];
+
+                return ea.lastUsedFrame != eb.lastUsedFrame ? ea.lastUsedFrame > eb.lastUsedFrame : ea.priority > eb.priority;
+            });
+
+            for (uint32_t i = 0; i < (uint32_t)m_Candidates.size(); i++) {
+                ResidencyEntry& entry = m_Entries[m_Candidates[i]];
+                if (residentSize + entry.size > promoteSize)
+                    continue;
+
+                result = m_iHelper.SetMemoryPriority(*entry.memory, entry.priority);
+                if (result != Result::SUCCESS)
+                    break;
+
+                entry.isDemoted = false;
+                residentSize += entry.size;
+
+                m_Stats.demotedSize -= entry.size;
+                m_Stats.promotedNum++;
+            }
+        }
+    }
+
+    m_FrameIndex++;
+
+    if (residencyStats)
+        *residencyStats = m_Stats;
+
+    return result;
+}
+
+constexpr uint32_t DEFRAGMENTATION_NO_MEMORY = uint32_t(-1);
+
+HelperDefragmenter::HelperDefragmenter(const CoreInterface& NRI, Device& device, Queue& queue)
+    : m_iCore(NRI)
+    , m_Device(device)
+    , m_Queue(queue)
+    , m_Resources(((DeviceBase&)device).GetStdAllocator())
+    , m_Allocations(((DeviceBase&)device).GetStdAllocator())
+    , m_MemorySizes(((DeviceBase&)device).GetStdAllocator())
+    , m_PendingMoveNums(((DeviceBase&)device).GetStdAllocator())
+    , m_Moves(((DeviceBase&)device).GetStdAllocator())
+    , m_NewMemories(((DeviceBase&)device).GetStdAllocator())
+    , m_BufferBarriers(((DeviceBase&)device).GetStdAllocator())
+    , m_TextureBarriers(((DeviceBase&)device).GetStdAllocator())
+    , m_CompletedMoves(((DeviceBase&)device).GetStdAllocator())
+    , m_CompletedMemories(((DeviceBase&)device).GetStdAllocator())
+    , m_EmptiedMemories(((DeviceBase&)device).GetStdAllocator()) {
+}
+
+HelperDefragmenter::~HelperDefragmenter() {
+    if (m_InFlightMove != m_NextMove)
+        m_iCore.Wait(*m_Fence, m_FenceValue);
+
+    // Everything not handed out yet is still owned by the defragmenter
+    for (uint32_t i = m_InFlightMove; i < (uint32_t)m_Moves.size(); i++) {
+        const DefragmentationPlannedMove& move = m_Moves[i];
+
+        m_iCore.DestroyBuffer(move.buffer);
+        m_iCore.DestroyTexture(move.texture);
+    }
+
+    for (const DefragmentationNewMemory& newMemory : m_NewMemories) {
+        if (!newMemory.isHandedOut)
+            m_iCore.FreeMemory(newMemory.memory);
+    }
+
+    m_iCore.DestroyCommandBuffer(m_CommandBuffer);
+    m_iCore.DestroyCommandAllocator(m_CommandAllocator);
+    m_iCore.DestroyFence(m_Fence);
+}
+
+Result HelperDefragmenter::Create(const DefragmenterDesc& defragmenterDesc) {
+    m_Desc = defragmenterDesc;
+    if (m_Desc.preferredMemorySize == 0)
+        m_Desc.preferredMemorySize = 256 * 1024 * 1024;
+    if (m_Desc.maxBytesPerStep == 0)
+        m_Desc.maxBytesPerStep = 32 * 1024 * 1024;
+    if (m_Desc.occupancyThreshold == 0.0f)
+        m_Desc.occupancyThreshold = 0.5f;
+
+    Result result = m_iCore.CreateFence(m_Device, 0, m_Fence);
+    if (result != Result::SUCCESS)
+        return result;
+
+    result = m_iCore.CreateCommandAllocator(m_Queue, m_CommandAllocator);
+    if (result != Result::SUCCESS)
+        return result;
+
+    return m_iCore.CreateCommandBuffer(*m_CommandAllocator, m_CommandBuffer);
+}
+
+uint32_t HelperDefragmenter::PlanDefragmentation(const DefragmentationDesc& defragmentationDesc) {
+    // The previous plan must be finished
+    if (m_InFlightMove != (uint32_t)m_Moves.size())
+        return 0;
+
+    m_Resources.assign(defragmentationDesc.resources, defragmentationDesc.resources + defragmentationDesc.resourceNum);
+
+    m_MemorySizes.resize(defragmentationDesc.memoryNum);
+    for (uint32_t i = 0; i < defragmentationDesc.memoryNum; i++)
+        m_MemorySizes[i] = defragmentationDesc.memories[i].size;
+
+    m_Allocations.resize(defragmentationDesc.resourceNum);
+    for (uint32_t i = 0; i < defragmentationDesc.resourceNum; i++) {
+        const DefragmentationResourceDesc& resource = defragmentationDesc.resources[i];
+
+        MemoryDesc memoryDesc = {};
+        bool isMultisample = false;
+        if (resource.buffer)
+            m_iCore.GetBufferMemoryDesc(*resource.buffer, m_Desc.memoryLocation, memoryDesc);
+        else {
+            m_iCore.GetTextureMemoryDesc(*resource.texture, m_Desc.memoryLocation, memoryDesc);
+            isMultisample = m_iCore.GetTextureDesc(*resource.texture).sampleNum > 1;
+        }
+
+        DefragmentationAllocation& allocation = m_Allocations[i];
+        allocation.memoryIndex = resource.memoryIndex;
+        allocation.alignment = std::max(memoryDesc.alignment, 1u);
+        allocation.size = memoryDesc.size;
+        allocation.type = memoryDesc.type;
+        allocation.mustBeDedicated = memoryDesc.mustBeDedicated;
+        allocation.isMultisample = isMultisample;
+    }
+
+    PlanDefragmentationMoves(m_Desc, m_MemorySizes, m_Allocations, m_Moves, m_NewMemories);
+
+    m_PendingMoveNums.assign(defragmentationDesc.memoryNum, 0);
+    for (const DefragmentationPlannedMove& move : m_Moves)
+        m_PendingMoveNums[m_Allocations[move.resourceIndex].memoryIndex]++;
+
+    m_NextMove = 0;
+    m_InFlightMove = 0;
+
+    return (uint32_t)m_Moves.size();
+}
+
+void nri::PlanDefragmentationMoves(const DefragmenterDesc& defragmenterDesc, const Vector<uint64_t>& memorySizes, const Vector<DefragmentationAllocation>& allocations,
+    Vector<DefragmentationPlannedMove>& moves, Vector<DefragmentationNewMemory>& newMemories) {
+    const auto& allocator = moves.get_allocator();
+    uint32_t memoryNum = (uint32_t)memorySizes.size();
+
+    moves.clear();
+    newMemories.clear();
+
+    // Occupancy (memory objects with dedicated allocations can't be emptied)
+    Vector<uint64_t> usedSizes(memoryNum, 0, allocator);
+    for (const DefragmentationAllocation& allocation : allocations) {
+        uint64_t& usedSize = usedSizes[allocation.memoryIndex];
+        if (allocation.mustBeDedicated || usedSize == UINT64_MAX)
+            usedSize = UINT64_MAX; // sticky, regardless of the allocation order
+        else
+            usedSize = std::min(usedSize + allocation.size, UINT64_MAX - 1);
+    }
+
+    // All allocations from sparsely occupied memory objects are moved
+    Vector<uint32_t> candidates(allocator);
+    for (uint32_t i = 0; i < (uint32_t)allocations.size(); i++) {
+        uint32_t memoryIndex = allocations[i].memoryIndex;
+        if (usedSizes[memoryIndex] < uint64_t(double(memorySizes[memoryIndex]) * defragmenterDesc.occupancyThreshold))
+            candidates.push_back(i);
+    }
+
+    // First fit decreasing, per memory type
+    std::sort(candidates.begin(), candidates.end(), [&allocations](uint32_t a, uint32_t b) {
+        const DefragmentationAllocation& aa = allocations[a];
+        const DefragmentationAllocation& ab = allocations[b];
+
+        return aa.type != ab.type ? aa.type < ab.type : aa.size > ab.size;
+    });
+
+    Vector<uint64_t> capacities(allocator);
+    for (uint32_t resourceIndex : candidates) {
+        const DefragmentationAllocation& allocation = allocations[resourceIndex];
+
+        uint32_t dstMemoryIndex = DEFRAGMENTATION_NO_MEMORY;
+        uint64_t dstOffset = 0;
+        for (uint32_t i = 0; i < (uint32_t)newMemories.size(); i++) {
+            const DefragmentationNewMemory& newMemory = newMemories[i];
+            uint64_t offset = Align(newMemory.size, (uint64_t)allocation.alignment);
+
+            if (newMemory.type == allocation.type && offset + allocation.size <= capacities[i]) {
+                dstMemoryIndex = i;
+                dstOffset = offset;
+                break;
+            }
+        }
+
+        if (dstMemoryIndex == DEFRAGMENTATION_NO_MEMORY) {
+            dstMemoryIndex = (uint32_t)newMemories.size();
+            newMemories.push_back({nullptr, 0, allocation.type, false, false});
+            capacities.push_back(std::max(defragmenterDesc.preferredMemorySize, allocation.size));
+        }
+
+        DefragmentationNewMemory& newMemory = newMemories[dstMemoryIndex];
+        newMemory.size = dstOffset + allocation.size;
+        newMemory.allowMultisampleTextures |= allocation.isMultisample;
+
+        moves.push_back({resourceIndex, dstMemoryIndex, dstOffset, allocation.size, nullptr, nullptr});
+    }
+
+    // Not worth it, if compaction doesn't save memory
+    uint64_t srcSize = 0;
+    for (uint32_t i = 0; i < memoryNum; i++) {
+        if (usedSizes[i] < uint64_t(double(memorySizes[i]) * defragmenterDesc.occupancyThreshold))
+            srcSize += memorySizes[i];
+    }
+
+    uint64_t dstSize = 0;
+    for (const DefragmentationNewMemory& newMemory : newMemories)
+        dstSize += newMemory.size;
+
+    if (dstSize >= srcSize) {
+        moves.clear();
+        newMemories.clear();
+    }
+}
+
+Result HelperDefragmenter::RecordAndSubmit() {
+    // Moves fitting into the budget (at least one)
+    uint32_t moveNum = (uint32_t)m_Moves.size();
+    uint32_t moveEnd = m_NextMove;
+    uint64_t totalSize = 0;
+
+    while (moveEnd < moveNum && (moveEnd == m_NextMove || totalSize + m_Moves[moveEnd].size <= m_Desc.maxBytesPerStep))
+        totalSize += m_Moves[moveEnd++].size;
+
+    // Create new memory objects and resources
+    for (uint32_t i = m_NextMove; i < moveEnd; i++) {
+        DefragmentationPlannedMove& move = m_Moves[i];
+        DefragmentationNewMemory& newMemory = m_NewMemories[move.dstMemoryIndex];
+
+        if (!newMemory.memory) {
+            AllocateMemoryDesc allocateMemoryDesc = {};
+            allocateMemoryDesc.size = newMemory.size;
+            allocateMemoryDesc.type = newMemory.type;
+            allocateMemoryDesc.allowMultisampleTextures = newMemory.allowMultisampleTextures;
+
+            Result result = m_iCore.AllocateMemory(m_Device, allocateMemoryDesc, newMemory.memory);
+            if (result != Result::SUCCESS)
+                return result;
+        }
+
+        // Already created, if the previous attempt failed
+        if (move.buffer || move.texture)
+            continue;
+
+        const DefragmentationResourceDesc& resource = m_Resources[move.resourceIndex];
+
+        Result result;
+        if (resource.buffer)
+            result = m_iCore.CreatePlacedBuffer(m_Device, newMemory.memory, move.dstOffset, m_iCore.GetBufferDesc(*resource.buffer), move.buffer);
+        else
+            result = m_iCore.CreatePlacedTexture(m_Device, newMemory.memory, move.dstOffset, m_iCore.GetTextureDesc(*resource.texture), move.texture);
+
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
+    Result result = m_iCore.BeginCommandBuffer(*m_CommandBuffer, nullptr);
+    if (result != Result::SUCCESS)
+        return result;
+
+    constexpr AccessLayoutStage copySourceState = {AccessBits::COPY_SOURCE, Layout::COPY_SOURCE, StageBits::COPY};
+    constexpr AccessLayoutStage copyDestState = {AccessBits::COPY_DESTINATION, Layout::COPY_DESTINATION, StageBits::COPY};
+    constexpr AccessLayoutStage unknownState = {AccessBits::NONE, Layout::UNDEFINED, StageBits::NONE};
+
+    for (uint32_t pass = 0; pass < 2; pass++) {
+        bool isInitial = pass == 0;
+
+        // Barriers: "old" to "COPY_SOURCE" and "new" to "COPY_DESTINATION" (initial), back to the resource state (final)
+        m_BufferBarriers.clear();
+        m_TextureBarriers.clear();
+
+        for (uint32_t i = m_NextMove; i < moveEnd; i++) {
+            const DefragmentationPlannedMove& move = m_Moves[i];
+            const DefragmentationResourceDesc& resource = m_Resources[move.resourceIndex];
+
+            if (resource.buffer) {
+                BufferBarrierDesc barrier = {};
+                barrier.buffer = resource.buffer;
+                barrier.before = isInitial ? AccessStage{resource.state.access, resource.state.stages} : AccessStage{copySourceState.access, copySourceState.stages};
+                barrier.after = isInitial ? AccessStage{copySourceState.access, copySourceState.stages} : AccessStage{resource.state.access, resource.state.stages};
+                m_BufferBarriers.push_back(barrier);
+
+                barrier.buffer = move.buffer;
+                barrier.before = isInitial ? AccessStage{unknownState.access, unknownState.stages} : AccessStage{copyDestState.access, copyDestState.stages};
+                barrier.after = isInitial ? AccessStage{copyDestState.access, copyDestState.stages} : AccessStage{resource.state.access, resource.state.stages};
+                m_BufferBarriers.push_back(barrier);
+            } else {
+                const TextureDesc& textureDesc = m_iCore.GetTextureDesc(*resource.texture);
+
+                TextureBarrierDesc barrier = {};
+                barrier.texture = resource.texture;
+                barrier.mipNum = textureDesc.mipNum;
+                barrier.layerNum = textureDesc.layerNum;
+                barrier.before = isInitial ? resource.state : copySourceState;
+                barrier.after = isInitial ? copySourceState : resource.state;
+                m_TextureBarriers.push_back(barrier);
+
+                barrier.texture = move.texture;
+                barrier.before = isInitial ? unknownState : copyDestState;
+                barrier.after = isInitial ? copyDestState : resource.state;
+                m_TextureBarriers.push_back(barrier);
+            }
+        }
+
+        BarrierDesc barrierDesc = {};
+        barrierDesc.buffers = m_BufferBarriers.data();
+        barrierDesc.bufferNum = (uint32_t)m_BufferBarriers.size();
+        barrierDesc.textures = m_TextureBarriers.data();
+        barrierDesc.textureNum = (uint32_t)m_TextureBarriers.size();
+
+        m_iCore.CmdBarrier(*m_CommandBuffer, barrierDesc);
+
+        // Copies
+        if (isInitial) {
+            for (uint32_t i = m_NextMove; i < moveEnd; i++) {
+                const DefragmentationPlannedMove& move = m_Moves[i];
+                const DefragmentationResourceDesc& resource = m_Resources[move.resourceIndex];
+
+                if (resource.buffer)
+                    m_iCore.CmdCopyBuffer(*m_CommandBuffer, *move.buffer, 0, *resource.buffer, 0, m_iCore.GetBufferDesc(*resource.buffer).size);
+                else
+                    m_iCore.CmdCopyTexture(*m_CommandBuffer, *move.texture, nullptr, *resource.texture, nullptr);
+            }
+        }
+    }
+
+    result = m_iCore.EndCommandBuffer(*m_CommandBuffer);
+    if (result != Result::SUCCESS)
+        return result;
+
+    FenceSubmitDesc fenceSubmitDesc = {};
+    fenceSubmitDesc.fence = m_Fence;
+    fenceSubmitDesc.value = m_FenceValue + 1;
+
+    QueueSubmitDesc queueSubmitDesc = {};
+    queueSubmitDesc.commandBufferNum = 1;
+    queueSubmitDesc.commandBuffers = &m_CommandBuffer;
+    queueSubmitDesc.signalFences = &fenceSubmitDesc;
+    queueSubmitDesc.signalFenceNum = 1;
+
+    result = m_iCore.QueueSubmit(m_Queue, queueSubmitDesc);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_FenceValue++;
+    m_NextMove = moveEnd;
+
+    return Result::SUCCESS;
+}
+
+void HelperDefragmenter::CompleteInFlightMoves() {
+    for (uint32_t i = m_InFlightMove; i < m_NextMove; i++) {
+        const DefragmentationPlannedMove& move = m_Moves[i];
+        m_CompletedMoves.push_back({move.resourceIndex, move.buffer, move.texture});
+
+        DefragmentationNewMemory& newMemory = m_NewMemories[move.dstMemoryIndex];
+        if (!newMemory.isHandedOut) {
+            newMemory.isHandedOut = true;
+            m_CompletedMemories.push_back(newMemory.memory);
+        }
+
+        uint32_t memoryIndex = m_Allocations[move.resourceIndex].memoryIndex;
+        if (--m_PendingMoveNums[memoryIndex] == 0)
+            m_EmptiedMemories.push_back(memoryIndex);
+    }
+
+    m_InFlightMove = m_NextMove;
+}
+
+Result HelperDefragmenter::DefragmentStep(DefragmentationResult& defragmentationResult) {
+    m_CompletedMoves.clear();
+    m_CompletedMemories.clear();
+    m_EmptiedMemories.clear();
+
+    // Hand out completed moves
+    if (m_InFlightMove != m_NextMove && m_iCore.GetFenceValue(*m_Fence) >= m_FenceValue)
+        CompleteInFlightMoves();
+
+    // Submit the next portion, if nothing is in flight
+    Result result = Result::SUCCESS;
+    if (m_InFlightMove == m_NextMove && m_NextMove < (uint32_t)m_Moves.size()) {
+        m_iCore.ResetCommandAllocator(*m_CommandAllocator);
+        result = RecordAndSubmit();
+    }
+
+    defragmentationResult = {};
+    defragmentationResult.moves = m_CompletedMoves.data();
+    defragmentationResult.moveNum = (uint32_t)m_CompletedMoves.size();
+    defragmentationResult.memories = m_CompletedMemories.data();
+    defragmentationResult.memoryNum = (uint32_t)m_CompletedMemories.size();
+    defragmentationResult.emptiedMemoryIndices = m_EmptiedMemories.data();
+    defragmentationResult.emptiedMemoryNum = (uint32_t)m_EmptiedMemories.size();
+    defragmentationResult.isFinished = m_InFlightMove == (uint32_t)m_Moves.size();
+
+    return result;
+}
+
+// HelperPipelineCacheStore
+constexpr uint32_t PIPELINE_CACHE_STORE_MAGIC = 0x4352504E; // "NPRC"
+constexpr uint32_t PIPELINE_CACHE_STORE_VERSION = 1;
+
+struct PipelineCacheStoreHeader {
+    uint32_t magic;
+    uint32_t version;
+    Uid_t uid; // "UUID" only, since "LUID" changes on reboot
+    uint32_t vendor;
+    uint32_t deviceId;
+    uint32_t driverVersion;
+    uint16_t nriVersion;
+    uint16_t graphicsAPI;
+    uint64_t payloadSize;
+    uint64_t payloadHash;
+};
+
+static PipelineCacheStoreHeader GetPipelineCacheStoreHeader(const DeviceDesc& deviceDesc) {
+    PipelineCacheStoreHeader header = {};
+    header.magic = PIPELINE_CACHE_STORE_MAGIC;
+    header.version = PIPELINE_CACHE_STORE_VERSION;
+    header.vendor = (uint32_t)deviceDesc.adapterDesc.vendor;
+    header.deviceId = deviceDesc.adapterDesc.deviceId;
+    header.driverVersion = deviceDesc.adapterDesc.driverVersion;
+    header.nriVersion = deviceDesc.nriVersion;
+    header.graphicsAPI = (uint16_t)deviceDesc.graphicsAPI;
+
+    if (deviceDesc.adapterDesc.uid.high)
+        header.uid = deviceDesc.adapterDesc.uid;
+
+    return header;
+}
+
+HelperPipelineCacheStore::HelperPipelineCacheStore(Device& device)
+    : m_Device(device)
+    , m_FileName(((DeviceBase&)device).GetStdAllocator())
+    , m_PipelineCaches(((DeviceBase&)device).GetStdAllocator())
+    , m_Blob(((DeviceBase&)device).GetStdAllocator()) {
+}
+
+HelperPipelineCacheStore::~HelperPipelineCacheStore() {
+    if (m_SaveThread.joinable())
+        m_SaveThread.join();
+
+    for (PipelineCache* pipelineCache : m_PipelineCaches)
+        m_iCore.DestroyPipelineCache(pipelineCache);
+}
+
+Vector<uint8_t> HelperPipelineCacheStore::Load() {
+    Vector<uint8_t> payload(((DeviceBase&)m_Device).GetStdAllocator());
+
+    FILE* file = fopen(m_FileName.c_str(), "rb");
+    if (!file)
+        return payload;
+
+    // Reject quickly: the header is checked before reading the payload
+    PipelineCacheStoreHeader expected = GetPipelineCacheStoreHeader(m_iCore.GetDeviceDesc(m_Device));
+    PipelineCacheStoreHeader header = {};
+
+    bool isValid = fread(&header, sizeof(header), 1, file) == 1;
+    if (isValid) {
+        expected.payloadSize = header.payloadSize;
+        expected.payloadHash = header.payloadHash;
+        isValid = memcmp(&header, &expected, sizeof(header)) == 0;
+    }
+
+    if (isValid) {
+        payload.resize((size_t)header.payloadSize);
+        isValid = header.payloadSize && fread(payload.data(), payload.size(), 1, file) == 1;
+        isValid = isValid && HashBytes(payload.data(), payload.size()) == header.payloadHash;
+    }
+
+    fclose(file);
+
+    if (!isValid) {
+        payload.clear();
+        m_Stats.isRejected = true;
+    }
+
+    return payload;
+}
+
+Result HelperPipelineCacheStore::Create(const PipelineCacheStoreDesc& pipelineCacheStoreDesc) {
+    Result result = ((DeviceBase&)m_Device).FillFunctionTable(m_iCore);
+    if (result != Result::SUCCESS)
+        return result;
+
+    result = ((DeviceBase&)m_Device).FillFunctionTable(m_iHelper);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_FileName = pipelineCacheStoreDesc.fileName;
+
+    Vector<uint8_t> payload = Load();
+
+    PipelineCacheDesc pipelineCacheDesc = {};
+    pipelineCacheDesc.data = payload.empty() ? nullptr : payload.data();
+    pipelineCacheDesc.size = payload.size();
+
+    // Main cache
+    PipelineCache* pipelineCache = nullptr;
+    result = m_iCore.CreatePipelineCache(m_Device, pipelineCacheDesc, pipelineCache);
+    if (result == Result::OUT_OF_DATE) {
+        m_iCore.DestroyPipelineCache(pipelineCache);
+
+        payload.clear();
+        pipelineCacheDesc = {};
+        m_Stats.isRejected = true;
+
+        result = m_iCore.CreatePipelineCache(m_Device, pipelineCacheDesc, pipelineCache);
+    }
+
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_PipelineCaches.push_back(pipelineCache);
+    m_Stats.loadedSize = payload.size();
+
+    // Worker caches, warmed up with the same data (merging a cache into itself is not allowed, so probe with an empty merge first)
+    m_IsMergeSupported = m_iHelper.MergePipelineCaches(*pipelineCache, nullptr, 0) == Result::SUCCESS;
+
+    if (m_IsMergeSupported) {
+        for (uint32_t i = 0; i < pipelineCacheStoreDesc.workerCacheNum; i++) {
+            result = m_iCore.CreatePipelineCache(m_Device, pipelineCacheDesc, pipelineCache);
+            if (result != Result::SUCCESS)
+                return result;
+
+            m_PipelineCaches.push_back(pipelineCache);
+        }
+    }
+
+    // The loaded data is already in the file
+    m_SavedHash = payload.empty() ? 0 : HashBytes(payload.data(), payload.size());
+
+    return Result::SUCCESS;
+}
+
+PipelineCache* HelperPipelineCacheStore::GetPipelineCache(uint32_t workerIndex) const {
+    if (m_PipelineCaches.size() == 1)
+        return m_PipelineCaches[0];
+
+    return m_PipelineCaches[1 + workerIndex % (m_PipelineCaches.size() - 1)];
+}
+
+Result HelperPipelineCacheStore::Save(bool async) {
+    ExclusiveScope lock(m_SaveLock);
+
+    if (m_SaveThread.joinable())
+        m_SaveThread.join();
+
+    if (!async)
+        return SaveSync();
+
+    Result previousResult = m_AsyncSaveResult;
+    m_SaveThread = std::thread([this]() {
+        m_AsyncSaveResult = SaveSync();
+    });
+
+    return previousResult;
+}
+
+Result HelperPipelineCacheStore::SaveSync() {
+    PipelineCache& mainPipelineCache = *m_PipelineCaches[0];
+
+    // Gather worker caches
+    if (m_PipelineCaches.size() > 1) {
+        Result result = m_iHelper.MergePipelineCaches(mainPipelineCache, m_PipelineCaches.data() + 1, (uint32_t)m_PipelineCaches.size() - 1);
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
+    // Serialize
+    uint64_t payloadSize = 0;
+    Result result = m_iCore.GetPipelineCacheData(mainPipelineCache, nullptr, payloadSize);
+    if (result != Result::SUCCESS)
+        return result;
+
+    if (!payloadSize)
+        return Result::SUCCESS;
+
+    m_Blob.resize(sizeof(PipelineCacheStoreHeader) + (size_t)payloadSize);
+    uint8_t* payload = m_Blob.data() + sizeof(PipelineCacheStoreHeader);
+
+    result = m_iCore.GetPipelineCacheData(mainPipelineCache, payload, payloadSize);
+    if (result != Result::SUCCESS)
+        return result;
+
+    // Skip if nothing has changed
+    uint64_t payloadHash = HashBytes(payload, (size_t)payloadSize);
+    if (payloadHash == m_SavedHash) {
+        ExclusiveScope lock(m_StatsLock);
+        m_Stats.skippedSaveNum++;
+
+        return Result::SUCCESS;
+    }
+
+    PipelineCacheStoreHeader header = GetPipelineCacheStoreHeader(m_iCore.GetDeviceDesc(m_Device));
+    header.payloadSize = payloadSize;
+    header.payloadHash = payloadHash;
+    memcpy(m_Blob.data(), &header, sizeof(header));
+
+    // Write a temporary file and replace the old one with it to avoid torn files
+    String tmpFileName = m_FileName;
+    tmpFileName += ".tmp";
+
+    FILE* file = fopen(tmpFileName.c_str(), "wb");
+    if (!file)
+        return Result::FAILURE;
+
+    if (fwrite(m_Blob.data(), sizeof(header) + (size_t)payloadSize, 1, file) != 1) {
+        fclose(file);
+        remove(tmpFileName.c_str());
+
+        return Result::FAILURE;
+    }
+
+    if (!CommitFile(file, tmpFileName.c_str(), m_FileName.c_str()))
+        return Result::FAILURE;
+
+    m_SavedHash = payloadHash;
+
+    ExclusiveScope lock(m_StatsLock);
+    m_Stats.savedSize = payloadSize;
+    m_Stats.saveNum++;
+
+    return Result::SUCCESS;
+}
+
+void HelperPipelineCacheStore::GetStats(PipelineCacheStoreStats& pipelineCacheStoreStats) const {
+    ExclusiveScope lock(m_StatsLock);
+
+    pipelineCacheStoreStats = m_Stats;
+}
+
+static inline uint32_t GetPipelineStatus(uint32_t generation, AsyncPipelineState state) {
+    return (generation << 2) | (uint32_t)state;
+}
+
+HelperPipelineCompiler::HelperPipelineCompiler(Device& device)
+    : m_Device(device)
+    , m_FreeSlots(((DeviceBase&)device).GetStdAllocator())
+    , m_Queue(((DeviceBase&)device).GetStdAllocator())
+    , m_Threads(((DeviceBase&)device).GetStdAllocator()) {
+}
+
+HelperPipelineCompiler::~HelperPipelineCompiler() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_IsStopped = true;
+    }
+
+    m_Condition.notify_all();
+
+    for (std::thread& thread : m_Threads)
+        thread.join();
+
+    if (m_Slots) {
+        for (uint32_t i = 0; i < m_SlotMaxNum; i++) {
+            Pipeline* pipeline = m_Slots[i].pipeline.load(std::memory_order_relaxed);
+            if (pipeline)
+                m_iCore.DestroyPipeline(pipeline);
+
+            m_Slots[i].~AsyncPipeline();
+        }
+
+        const AllocationCallbacks& allocationCallbacks = ((DeviceBase&)m_Device).GetAllocationCallbacks();
+        allocationCallbacks.Free(allocationCallbacks.userArg, m_Slots);
+    }
+}
+
+Result HelperPipelineCompiler::Create(const PipelineCompilerDesc& pipelineCompilerDesc) {
+    Result result = ((DeviceBase&)m_Device).FillFunctionTable(m_iCore);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_Desc = pipelineCompilerDesc;
+
+    // Slots (atomics can't live in "Vector")
+    uint32_t slotMaxNum = m_Desc.pipelineMaxNum ? m_Desc.pipelineMaxNum : PIPELINE_COMPILER_DEFAULT_PIPELINE_MAX_NUM;
+    slotMaxNum = std::min(slotMaxNum, PIPELINE_HANDLE_INDEX_MASK);
+
+    const AllocationCallbacks& allocationCallbacks = ((DeviceBase&)m_Device).GetAllocationCallbacks();
+
+    m_Slots = (AsyncPipeline*)allocationCallbacks.Allocate(allocationCallbacks.userArg, slotMaxNum * sizeof(AsyncPipeline), alignof(AsyncPipeline));
+    if (!m_Slots)
+        return Result::OUT_OF_MEMORY;
+
+    Construct(m_Slots, slotMaxNum);
+    m_SlotMaxNum = slotMaxNum;
+
+    // Threads
+    uint32_t threadNum = m_Desc.threadNum;
+    if (!threadNum)
+        threadNum = std::max(std::thread::hardware_concurrency() / 2, 1u);
+
+    for (uint32_t i = 0; i < threadNum; i++)
+        m_Threads.emplace_back(&HelperPipelineCompiler::WorkerThread, this);
+
+    return Result::SUCCESS;
+}
+
+uint32_t HelperPipelineCompiler::Compile(const GraphicsPipelineDesc& graphicsPipelineDesc) {
+    return Enqueue(&graphicsPipelineDesc, nullptr);
+}
+
+uint32_t HelperPipelineCompiler::Compile(const ComputePipelineDesc& computePipelineDesc) {
+    return Enqueue(nullptr, &computePipelineDesc);
+}
+
+uint32_t HelperPipelineCompiler::Enqueue(const GraphicsPipelineDesc* graphicsPipelineDesc, const ComputePipelineDesc* computePipelineDesc) {
+    uint32_t pipelineHandle = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_IsStopped)
+            return 0;
+
+        // A released slot or a never used one
+        uint32_t index = 0;
+        if (!m_FreeSlots.empty()) {
+            index = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+        } else if (m_SlotNum < m_SlotMaxNum)
+            index = m_SlotNum++;
+        else
+            return 0;
+
+        AsyncPipeline& asyncPipeline = m_Slots[index];
+        asyncPipeline.isCompute = computePipelineDesc != nullptr;
+        if (computePipelineDesc)
+            asyncPipeline.computePipelineDesc = *computePipelineDesc;
+        else
+            asyncPipeline.graphicsPipelineDesc = *graphicsPipelineDesc;
+
+        // A free slot is "PENDING" with the generation of the next handle
+        uint32_t generation = asyncPipeline.status.load(std::memory_order_relaxed) >> 2;
+        pipelineHandle = (generation << PIPELINE_HANDLE_INDEX_BITS) | (index + 1);
+
+        m_Queue.push_back(index);
+    }
+
+    m_Condition.notify_one();
+
+    return pipelineHandle;
+}
+
+AsyncPipeline* HelperPipelineCompiler::GetSlot(uint32_t pipelineHandle, uint32_t& status) const {
+    uint32_t index = pipelineHandle & PIPELINE_HANDLE_INDEX_MASK;
+    if (index == 0 || index > m_SlotMaxNum)
+        return nullptr;
+
+    AsyncPipeline& asyncPipeline = m_Slots[index - 1];
+
+    // Acquire: pairs with the release store of a worker, i.e. "pipeline" is visible if "READY" is observed
+    uint32_t generation = pipelineHandle >> PIPELINE_HANDLE_INDEX_BITS;
+    status = asyncPipeline.status.load(std::memory_order_acquire);
+    if ((status >> 2) != generation)
+        return nullptr; // released
+
+    return &asyncPipeline;
+}
+
+bool HelperPipelineCompiler::IsReady(uint32_t pipelineHandle) const {
+    uint32_t status = 0;
+    const AsyncPipeline* asyncPipeline = GetSlot(pipelineHandle, status);
+
+    return asyncPipeline && (AsyncPipelineState)(status & 0x3) == AsyncPipelineState::READY;
+}
+
+Pipeline* HelperPipelineCompiler::Acquire(uint32_t pipelineHandle, Pipeline* substitute) const {
+    uint32_t status = 0;
+    const AsyncPipeline* asyncPipeline = GetSlot(pipelineHandle, status);
+    if (!asyncPipeline || (AsyncPipelineState)(status & 0x3) != AsyncPipelineState::READY)
+        return substitute;
+
+    return asyncPipeline->pipeline.load(std::memory_order_relaxed);
+}
+
+void HelperPipelineCompiler::Release(uint32_t pipelineHandle) {
+    Pipeline* pipeline = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        uint32_t status = 0;
+        AsyncPipeline* asyncPipeline = GetSlot(pipelineHandle, status);
+        if (!asyncPipeline)
+            return; // invalid or already released
+
+        // Invalidate the handle
+        uint32_t generation = ((status >> 2) + 1) & PIPELINE_HANDLE_GENERATION_MASK;
+        asyncPipeline->status.store(GetPipelineStatus(generation, AsyncPipelineState::PENDING), std::memory_order_relaxed);
+
+        // A pending request is owned by a worker, which frees the slot
+        if ((AsyncPipelineState)(status & 0x3) == AsyncPipelineState::PENDING) {
+            asyncPipeline->isReleased = true;
+            return;
+        }
+
+        pipeline = asyncPipeline->pipeline.exchange(nullptr, std::memory_order_relaxed);
+
+        uint32_t index = (pipelineHandle & PIPELINE_HANDLE_INDEX_MASK) - 1;
+        m_FreeSlots.push_back(index);
+    }
+
+    if (pipeline)
+        m_iCore.DestroyPipeline(pipeline);
+}
+
+void HelperPipelineCompiler::WorkerThread() {
+    for (;;) {
+        AsyncPipeline* asyncPipeline = nullptr;
+        uint32_t index = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Condition.wait(lock, [this]() {
+                return m_IsStopped || m_QueueHead < m_Queue.size();
+            });
+
+            if (m_IsStopped)
+                return;
+
+            index = m_Queue[m_QueueHead++];
+            if (m_QueueHead == m_Queue.size()) {
+                m_Queue.clear();
+                m_QueueHead = 0;
+            }
+
+            // Released before compilation started: drop the request
+            asyncPipeline = m_Slots + index;
+            if (asyncPipeline->isReleased) {
+                asyncPipeline->isReleased = false;
+                m_FreeSlots.push_back(index);
+
+                continue;
+            }
+        }
+
+        // The slot can't be reused while pending, i.e. the desc is stable
+        if (m_Desc.injectedLatency)
+            std::this_thread::sleep_for(std::chrono::milliseconds(m_Desc.injectedLatency));
+
+        Pipeline* pipeline = nullptr;
+        Result result = asyncPipeline->isCompute ? m_iCore.CreateComputePipeline(m_Device, asyncPipeline->computePipelineDesc, pipeline) : m_iCore.CreateGraphicsPipeline(m_Device, asyncPipeline->graphicsPipelineDesc, pipeline);
+        if (result != Result::SUCCESS)
+            pipeline = nullptr;
+
+        uint32_t pipelineHandle = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
+            if (asyncPipeline->isReleased) {
+                // Released while compiling: nobody can observe the pipeline
+                asyncPipeline->isReleased = false;
+                m_FreeSlots.push_back(index);
+            } else {
+                uint32_t generation = asyncPipeline->status.load(std::memory_order_relaxed) >> 2;
+                pipelineHandle = (generation << PIPELINE_HANDLE_INDEX_BITS) | (index + 1);
+
+                // Release: publishes "pipeline" to lock-free readers
+                asyncPipeline->pipeline.store(pipeline, std::memory_order_relaxed);
+                asyncPipeline->status.store(GetPipelineStatus(generation, pipeline ? AsyncPipelineState::READY : AsyncPipelineState::FAILED), std::memory_order_release);
+            }
+        }
+
+        if (!pipelineHandle) {
+            if (pipeline)
+                m_iCore.DestroyPipeline(pipeline);
+        } else if (m_Desc.CompletionCallback)
+            m_Desc.CompletionCallback(pipelineHandle, result, pipeline, m_Desc.userArg);
+    }
+}
+
+// Bindless allocator
+static void AddDescriptorNum(DescriptorPoolDesc& descriptorPoolDesc, DescriptorType descriptorType, uint32_t descriptorNum) {
+    switch (descriptorType) {
+        case DescriptorType::SAMPLER:
+            descriptorPoolDesc.samplerMaxNum += descriptorNum;
+            break;
+        case DescriptorType::MUTABLE:
+            descriptorPoolDesc.mutableMaxNum += descriptorNum;
+            break;
+        case DescriptorType::TEXTURE:
+            descriptorPoolDesc.textureMaxNum += descriptorNum;
+            break;
+        case DescriptorType::STORAGE_TEXTURE:
+            descriptorPoolDesc.storageTextureMaxNum += descriptorNum;
+            break;
+        case DescriptorType::INPUT_ATTACHMENT:
+            descriptorPoolDesc.inputAttachmentMaxNum += descriptorNum;
+            break;
+        case DescriptorType::BUFFER:
+            descriptorPoolDesc.bufferMaxNum += descriptorNum;
+            break;
+        case DescriptorType::STORAGE_BUFFER:
+            descriptorPoolDesc.storageBufferMaxNum += descriptorNum;
+            break;
+        case DescriptorType::CONSTANT_BUFFER:
+            descriptorPoolDesc.constantBufferMaxNum += descriptorNum;
+            break;
+        case DescriptorType::STRUCTURED_BUFFER:
+            descriptorPoolDesc.structuredBufferMaxNum += descriptorNum;
+            break;
+        case DescriptorType::STORAGE_STRUCTURED_BUFFER:
+            descriptorPoolDesc.storageStructuredBufferMaxNum += descriptorNum;
+            break;
+        case DescriptorType::ACCELERATION_STRUCTURE:
+            descriptorPoolDesc.accelerationStructureMaxNum += descriptorNum;
+            break;
+        default:
+            break;
+    }
+}
+
+HelperBindlessAllocator::HelperBindlessAllocator(Device& device)
+    : m_Device(device)
+    , m_Writes(((DeviceBase&)device).GetStdAllocator())
+    , m_Releases(((DeviceBase&)device).GetStdAllocator())
+    , m_UpdateDescriptors(((DeviceBase&)device).GetStdAllocator())
+    , m_UpdateRanges(((DeviceBase&)device).GetStdAllocator()) {
+}
+
+HelperBindlessAllocator::~HelperBindlessAllocator() {
+    const AllocationCallbacks& allocationCallbacks = ((DeviceBase&)m_Device).GetAllocationCallbacks();
+
+    if (m_Classes) {
+        for (uint32_t i = 0; i < m_ClassNum; i++)
+            m_Classes[i].~BindlessClass();
+
+        allocationCallbacks.Free(allocationCallbacks.userArg, m_Classes);
+    }
+
+    if (m_FreeListNext) // trivially destructible
+        allocationCallbacks.Free(allocationCallbacks.userArg, m_FreeListNext);
+
+    // Descriptor sets are owned by the pool
+    if (m_DescriptorPool)
+        m_iCore.DestroyDescriptorPool(m_DescriptorPool);
+}
+
+Result HelperBindlessAllocator::Create(const BindlessAllocatorDesc& bindlessAllocatorDesc) {
+    Result result = ((DeviceBase&)m_Device).FillFunctionTable(m_iCore);
+    if (result != Result::SUCCESS)
+        return result;
+
+    // One pool for all classes
+    DescriptorPoolDesc descriptorPoolDesc = {};
+    descriptorPoolDesc.descriptorSetMaxNum = bindlessAllocatorDesc.classNum;
+    descriptorPoolDesc.flags = DescriptorPoolBits::ALLOW_UPDATE_AFTER_SET;
+
+    uint32_t freeListNextNum = 0;
+    for (uint32_t i = 0; i < bindlessAllocatorDesc.classNum; i++) {
+        const BindlessClassDesc& bindlessClassDesc = bindlessAllocatorDesc.classes[i];
+        AddDescriptorNum(descriptorPoolDesc, bindlessClassDesc.descriptorType, bindlessClassDesc.descriptorNum);
+
+        freeListNextNum += bindlessClassDesc.descriptorNum;
+    }
+
+    result = m_iCore.CreateDescriptorPool(m_Device, descriptorPoolDesc, m_DescriptorPool);
+    if (result != Result::SUCCESS)
+        return result;
+
+    // Classes and free-list links (atomics can't live in "Vector")
+    const AllocationCallbacks& allocationCallbacks = ((DeviceBase&)m_Device).GetAllocationCallbacks();
+
+    m_Classes = (BindlessClass*)allocationCallbacks.Allocate(allocationCallbacks.userArg, bindlessAllocatorDesc.classNum * sizeof(BindlessClass), alignof(BindlessClass));
+    m_FreeListNext = (std::atomic_uint32_t*)allocationCallbacks.Allocate(allocationCallbacks.userArg, freeListNextNum * sizeof(std::atomic_uint32_t), alignof(std::atomic_uint32_t));
+    if (!m_Classes || (!m_FreeListNext && freeListNextNum))
+        return Result::OUT_OF_MEMORY;
+
+    Construct(m_Classes, bindlessAllocatorDesc.classNum);
+    Construct(m_FreeListNext, freeListNextNum, 0u);
+    m_ClassNum = bindlessAllocatorDesc.classNum;
+
+    uint32_t freeListOffset = 0;
+    for (uint32_t i = 0; i < bindlessAllocatorDesc.classNum; i++) {
+        const BindlessClassDesc& bindlessClassDesc = bindlessAllocatorDesc.classes[i];
+
+        BindlessClass& bindlessClass = m_Classes[i];
+        bindlessClass.descriptorSet = nullptr;
+        bindlessClass.freeListNext = m_FreeListNext + freeListOffset;
+        bindlessClass.rangeIndex = bindlessClassDesc.rangeIndex;
+        bindlessClass.descriptorNum = bindlessClassDesc.descriptorNum;
+        bindlessClass.descriptorType = bindlessClassDesc.descriptorType;
+        bindlessClass.freeListHead.store(0, std::memory_order_relaxed);
+        bindlessClass.unusedIndex.store(0, std::memory_order_relaxed);
+        bindlessClass.retireHead.store(0, std::memory_order_relaxed);
+
+        freeListOffset += bindlessClassDesc.descriptorNum;
+
+        result = m_iCore.AllocateDescriptorSets(*m_DescriptorPool, *bindlessAllocatorDesc.pipelineLayout, bindlessClassDesc.setIndex, &bindlessClass.descriptorSet, 1, bindlessClassDesc.descriptorNum);
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
+    return Result::SUCCESS;
+}
+
+DescriptorSet* HelperBindlessAllocator::GetDescriptorSet(uint32_t classIndex) const {
+    return m_Classes[classIndex].descriptorSet;
+}
+
+Result HelperBindlessAllocator::AllocateIndex(uint32_t classIndex, uint32_t& index) {
+    BindlessClass& bindlessClass = m_Classes[classIndex];
+
+    // Pop a released index
+    uint64_t head = bindlessClass.freeListHead.load(std::memory_order_acquire);
+    while ((uint32_t)head) {
+        uint32_t candidate = (uint32_t)head - 1;
+        uint64_t tag = (head >> 32) + 1;
+        uint64_t newHead = (tag << 32) | bindlessClass.freeListNext[candidate].load(std::memory_order_relaxed);
+
+        if (bindlessClass.freeListHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire)) {
+            index = candidate;
+            return Result::SUCCESS;
+        }
+    }
+
+    // Or take a never used one
+    uint32_t unusedIndex = bindlessClass.unusedIndex.load(std::memory_order_relaxed);
+    while (unusedIndex < bindlessClass.descriptorNum) {
+        if (bindlessClass.unusedIndex.compare_exchange_weak(unusedIndex, unusedIndex + 1, std::memory_order_relaxed)) {
+            index = unusedIndex;
+            return Result::SUCCESS;
+        }
+    }
+
+    return Result::OUT_OF_MEMORY;
+}
+
+void HelperBindlessAllocator::PushFreeIndex(BindlessClass& bindlessClass, uint32_t index) {
+    uint64_t head = bindlessClass.freeListHead.load(std::memory_order_relaxed);
+    uint64_t newHead = 0;
+
+    do {
+        bindlessClass.freeListNext[index].store((uint32_t)head, std::memory_order_relaxed);
+
+        uint64_t tag = (head >> 32) + 1;
+        newHead = (tag << 32) | (index + 1);
+    } while (!bindlessClass.freeListHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void HelperBindlessAllocator::ReleaseIndex(uint32_t classIndex, uint32_t index) {
+    BindlessClass& bindlessClass = m_Classes[classIndex];
+
+    // Can be still in use by the GPU: push to the retire list, which is emptied only by "Update", i.e. no ABA
+    uint32_t head = bindlessClass.retireHead.load(std::memory_order_relaxed);
+
+    do {
+        bindlessClass.freeListNext[index].store(head, std::memory_order_relaxed);
+    } while (!bindlessClass.retireHead.compare_exchange_weak(head, index + 1, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void HelperBindlessAllocator::SetDescriptor(uint32_t classIndex, uint32_t index, const Descriptor& descriptor) {
+    ExclusiveScope lock(m_Lock);
+
+    m_Writes.push_back({&descriptor, classIndex, index});
+}
+
+void HelperBindlessAllocator::Update(uint64_t completedFrameNum) {
+    ExclusiveScope lock(m_Lock);
+
+    // Writes: sort, keep the last write per index and merge consecutive indices into ranges
+    if (!m_Writes.empty()) {
+        std::stable_sort(m_Writes.begin(), m_Writes.end(), [](const BindlessWrite& a, const BindlessWrite& b) {
+            return a.classIndex != b.classIndex ? a.classIndex < b.classIndex : a.index < b.index;
+        });
+
+        m_UpdateDescriptors.clear();
+        m_UpdateRanges.clear();
+
+        for (size_t i = 0; i < m_Writes.size(); i++) {
+            const BindlessWrite& write = m_Writes[i];
+
+            bool isOverwritten = i + 1 < m_Writes.size() && m_Writes[i + 1].classIndex == write.classIndex && m_Writes[i + 1].index == write.index;
+            if (isOverwritten)
+                continue;
+
+            m_UpdateDescriptors.push_back(write.descriptor);
+
+            // All descriptors in a range must have the same type, i.e. "MUTABLE" writes can't be merged
+            const BindlessClass& bindlessClass = m_Classes[write.classIndex];
+            UpdateDescriptorRangeDesc* last = m_UpdateRanges.empty() ? nullptr : &m_UpdateRanges.back();
+            bool isContinuation = last && bindlessClass.descriptorType != DescriptorType::MUTABLE && last->descriptorSet == bindlessClass.descriptorSet && last->baseDescriptor + last->descriptorNum == write.index;
+
+            if (isContinuation)
+                last->descriptorNum++;
+            else
+                m_UpdateRanges.push_back({bindlessClass.descriptorSet, bindlessClass.rangeIndex, write.index, nullptr, 1});
+        }
+
+        // "m_UpdateDescriptors" could have been reallocated above
+        size_t descriptorOffset = 0;
+        for (UpdateDescriptorRangeDesc& updateRange : m_UpdateRanges) {
+            updateRange.descriptors = m_UpdateDescriptors.data() + descriptorOffset;
+            descriptorOffset += updateRange.descriptorNum;
+        }
+
+        m_iCore.UpdateDescriptorRanges(m_UpdateRanges.data(), (uint32_t)m_UpdateRanges.size());
+        m_Writes.clear();
+    }
+
+    // Retire lists: indices released since the previous update belong to the current frame (a release racing with "Update" can land in the next one, which is only later)
+    for (uint32_t i = 0; i < m_ClassNum; i++) {
+        BindlessClass& bindlessClass = m_Classes[i];
+
+        uint32_t head = bindlessClass.retireHead.exchange(0, std::memory_order_acquire);
+        while (head) {
+            uint32_t index = head - 1;
+            head = bindlessClass.freeListNext[index].load(std::memory_order_relaxed);
+
+            m_Releases.push_back({m_FrameIndex, i, index});
+        }
+    }
+
+    // Releases: frames complete in order, i.e. an index released in frame "N" is not referenced by the GPU anymore if "completedFrameNum > N"
+    size_t releaseNum = 0;
+    for (const BindlessRelease& release : m_Releases) {
+        if (release.frameIndex < completedFrameNum)
+            PushFreeIndex(m_Classes[release.classIndex], release.index);
+        else
+            m_Releases[releaseNum++] = release;
+    }
+    m_Releases.resize(releaseNum);
+
+    m_FrameIndex++;
+}
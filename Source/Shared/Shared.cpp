@@ -14,5 +14,10 @@ using namespace nri;
 #include "StreamerInterface.hpp"
 #include "UpscalerInterface.hpp"
 
+#include "AllocationAccounting.hpp"
+#include "AnnotationRecorder.hpp"
 #include "SharedExternal.hpp"
+#include "FormatConversion.hpp"
+#include "FileView.hpp"
 #include "SharedLibrary.hpp"
+#include "SwapChainVirtual.hpp"
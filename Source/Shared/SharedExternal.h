@@ -4,12 +4,14 @@
 
 #include <cassert>   // assert
 #include <cinttypes> // PRIu64
+#include <cstdio>    // FILE
 #include <cstring>   // memcpy
 #include <numeric>   // lcm
 
 #include <array>
 #include <map>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
@@ -42,6 +44,8 @@ typedef uint32_t DXGI_FORMAT;
 
 #include "Lock.h"
 
+#include "AllocationAccounting.h" // required by "Allocate", "Destroy" and "StdAllocator"
+
 // NRI default settings (if not provided in "NRIConfig.h")
 #ifdef NRI_USER_CONFIG
 #    include NRI_USER_CONFIG
@@ -69,6 +73,26 @@ typedef uint32_t DXGI_FORMAT;
 #    define NRI_MAX_STACK_ALLOC_SIZE 32768u // 32 Kb
 #endif
 
+#ifndef NRI_MAX_SCRATCH_ARENA_SIZE
+#    define NRI_MAX_SCRATCH_ARENA_SIZE 4194304u // 4 Mb, per thread per device (larger scratch allocations go to the allocator)
+#endif
+
+#ifndef NRI_SCRATCH_ARENA_TRIM_SIZE
+#    define NRI_SCRATCH_ARENA_TRIM_SIZE 262144u // 256 Kb, larger arenas get released if mostly unused for a while (a spike doesn't pin memory forever)
+#endif
+
+#ifndef NRI_ANNOTATION_RING_SIZE
+#    define NRI_ANNOTATION_RING_SIZE 16384u // records per thread (64 bytes each), must be a power of 2
+#endif
+
+#ifndef NRI_VAL_SLAB_OBJECT_NUM
+#    define NRI_VAL_SLAB_OBJECT_NUM 64u // validation wrappers per slab
+#endif
+
+#ifndef NRI_VAL_INLINE_NAME_SIZE
+#    define NRI_VAL_INLINE_NAME_SIZE 32u // shorter validation debug names (including the terminator) are stored in place
+#endif
+
 #ifndef NRI_FILE_SEPARATOR
 #    ifdef _WIN32
 #        define NRI_FILE_SEPARATOR '\\'
@@ -327,10 +351,10 @@ protected:
 
 // clang-format off
 #define NRI_ALLOCATE_SCRATCH(device, T, elementNum) { \
-        (device).GetAllocationCallbacks(), \
+        (DeviceBase&)(device), \
         !(elementNum) ? nullptr : ( \
             ((elementNum) * sizeof(T) + alignof(T)) > NRI_MAX_STACK_ALLOC_SIZE \
-                ? (T*)(device).GetAllocationCallbacks().Allocate((device).GetAllocationCallbacks().userArg, (elementNum) * sizeof(T), alignof(T)) \
+                ? (T*)AllocateScratch((DeviceBase&)(device), (elementNum) * sizeof(T), alignof(T)) \
                 : (T*)Align((T*)alloca((elementNum) * sizeof(T) + alignof(T)), alignof(T)) \
         ), \
         (elementNum) \
@@ -344,12 +368,18 @@ constexpr uint32_t NODE_MASK = 0x1;               // mGPU is not planned
 constexpr uint32_t ROOT_SIGNATURE_DWORD_NUM = 64; // https://learn.microsoft.com/en-us/windows/win32/direct3d12/root-signature-limits
 constexpr uint64_t MAX_CACHED_HOST_COPY_RESOURCE_SIZE = 64 * 1024 * 1024;
 
-// Scratch
+// Scratch (stack for small allocations, otherwise a per-thread arena owned by the device)
+struct DeviceBase;
+
+uint64_t GenerateDeviceUid();
+void* AllocateScratch(DeviceBase& device, size_t size, size_t alignment);
+void FreeScratch(DeviceBase& device, void* mem); // must be called in reverse allocation order (guaranteed by "Scratch" scoping)
+
 template <typename T>
 class Scratch {
 public:
-    Scratch(const AllocationCallbacks& allocator, T* mem, size_t num)
-        : m_Allocator(allocator)
+    Scratch(DeviceBase& device, T* mem, size_t num)
+        : m_Device(device)
         , m_Mem(mem)
         , m_Num(num) {
         m_IsHeap = (num * sizeof(T) + alignof(T)) > NRI_MAX_STACK_ALLOC_SIZE;
@@ -357,7 +387,7 @@ public:
 
     ~Scratch() {
         if (m_IsHeap)
-            m_Allocator.Free(m_Allocator.userArg, m_Mem);
+            FreeScratch(m_Device, m_Mem);
     }
 
     inline operator T*() const {
@@ -370,7 +400,7 @@ public:
     }
 
 private:
-    const AllocationCallbacks& m_Allocator;
+    DeviceBase& m_Device;
     T* m_Mem = nullptr;
     size_t m_Num = 0;
     bool m_IsHeap = false;
@@ -383,32 +413,82 @@ Library* LoadSharedLibrary(const char* path);
 void* GetSharedLibraryFunction(Library& library, const char* name);
 void UnloadSharedLibrary(Library& library);
 
+// Read-only memory-mapped file
+struct FileView {
+    const uint8_t* data;
+    uint64_t size;
+    uint64_t fileHandle;
+    void* mapping; // Windows only
+};
+
+bool MapFileView(uint64_t fileHandle, FileView& fileView); // sequential access is assumed
+void UnmapFileView(FileView& fileView);
+void PrefetchFileView(const FileView& fileView, uint64_t offset, uint64_t size);
+
+bool CommitFile(FILE* file, const char* tmpFileName, const char* fileName); // flushes and closes "file" ("tmpFileName"), then atomically replaces "fileName" with it
+
+// Write-combined memory (mapped "HOST_UPLOAD" and "DEVICE_UPLOAD" resources)
+constexpr size_t STREAMING_COPY_MIN_SIZE = 256; // below this size the alignment prologue and the fence are not worth it
+
+void CopyToUploadMemory(void* dst, const void* src, size_t size); // uses non-temporal stores (if supported), which bypass caches and don't read destination lines
+void FlushUploadMemoryWrites();                                    // must be called after a batch of "CopyToUploadMemory" calls
+
+// Texture data conversion (plain formats with 8-bit UNORM/sRGB, 16-bit SFLOAT or 32-bit SFLOAT channels), "dstData" is upload memory
+bool IsFormatConversionSupported(Format srcFormat, Format dstFormat);
+void ConvertTextureData(void* dstData, uint64_t dstRowPitch, uint64_t dstSlicePitch, Format dstFormat, const void* srcData, uint64_t srcRowPitch, uint64_t srcSlicePitch, Format srcFormat, uint32_t width, uint32_t rowNum, uint32_t sliceNum);
+
+// Mip generation (2x2 box filter in linear space, the same formats as for conversion), "dstData" is cached memory
+bool IsMipGenerationSupported(Format format);
+void GenerateMip(void* dstData, uint32_t dstRowPitch, const void* srcData, uint32_t srcRowPitch, Format format, Dim_t srcWidth, Dim_t srcHeight, bool isNormalMap);
+
 // Helpers
 template <typename T>
 inline T Align(T x, size_t alignment) {
     return (T)((size_t(x) + alignment - 1) & ~(alignment - 1));
 }
 
-inline void CopyTextureData(void* dstData, uint64_t dstRowPitch, uint64_t dstSlicePitch, const void* srcData, uint64_t srcRowPitch, uint64_t srcSlicePitch, uint64_t rowSize, uint32_t rowNum, uint32_t sliceNum) {
-    uint8_t* dst = (uint8_t*)dstData;
-    const uint8_t* src = (const uint8_t*)srcData;
+// FNV-1a (pass the previous hash to hash a sequence of values)
+inline uint64_t HashBytes(const void* data, size_t size, uint64_t hash = 0xCBF29CE484222325ull) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; i++)
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+
+    return hash;
+}
+
+template <typename CopyFunc>
+inline void CopyTextureRows(CopyFunc copy, uint8_t* dst, uint64_t dstRowPitch, uint64_t dstSlicePitch, const uint8_t* src, uint64_t srcRowPitch, uint64_t srcSlicePitch, uint64_t rowSize, uint32_t rowNum, uint32_t sliceNum) {
     uint64_t sliceSize = rowSize * rowNum;
 
     if (dstRowPitch == rowSize && srcRowPitch == rowSize) {
-        if (dstSlicePitch == sliceSize && srcSlicePitch == sliceSize) {
-            memcpy(dst, src, (size_t)(sliceSize * sliceNum));
-            return;
+        if (dstSlicePitch == sliceSize && srcSlicePitch == sliceSize)
+            copy(dst, src, (size_t)(sliceSize * sliceNum));
+        else {
+            for (uint32_t z = 0; z < sliceNum; z++)
+                copy(dst + uint64_t(z) * dstSlicePitch, src + uint64_t(z) * srcSlicePitch, (size_t)sliceSize);
+        }
+    } else {
+        for (uint32_t z = 0; z < sliceNum; z++) {
+            for (uint32_t y = 0; y < rowNum; y++)
+                copy(dst + uint64_t(z) * dstSlicePitch + uint64_t(y) * dstRowPitch, src + uint64_t(z) * srcSlicePitch + uint64_t(y) * srcRowPitch, (size_t)rowSize);
         }
+    }
+}
 
-        for (uint32_t z = 0; z < sliceNum; z++)
-            memcpy(dst + uint64_t(z) * dstSlicePitch, src + uint64_t(z) * srcSlicePitch, (size_t)sliceSize);
+// "isUploadMemory = true" if "dstData" is write-combined upload memory
+inline void CopyTextureData(void* dstData, uint64_t dstRowPitch, uint64_t dstSlicePitch, const void* srcData, uint64_t srcRowPitch, uint64_t srcSlicePitch, uint64_t rowSize, uint32_t rowNum, uint32_t sliceNum, bool isUploadMemory = false) {
+    uint8_t* dst = (uint8_t*)dstData;
+    const uint8_t* src = (const uint8_t*)srcData;
 
-        return;
-    }
+    if (isUploadMemory) {
+        CopyTextureRows(CopyToUploadMemory, dst, dstRowPitch, dstSlicePitch, src, srcRowPitch, srcSlicePitch, rowSize, rowNum, sliceNum);
+        FlushUploadMemoryWrites();
+    } else {
+        auto copy = [](void* d, const void* s, size_t size) {
+            memcpy(d, s, size);
+        };
 
-    for (uint32_t z = 0; z < sliceNum; z++) {
-        for (uint32_t y = 0; y < rowNum; y++)
-            memcpy(dst + uint64_t(z) * dstSlicePitch + uint64_t(y) * dstRowPitch, src + uint64_t(z) * srcSlicePitch + uint64_t(y) * srcRowPitch, (size_t)rowSize);
+        CopyTextureRows(copy, dst, dstRowPitch, dstSlicePitch, src, srcRowPitch, srcSlicePitch, rowSize, rowNum, sliceNum);
     }
 }
 
@@ -438,12 +518,16 @@ inline T* Allocate(const AllocationCallbacks& allocationCallbacks, Args&&... arg
     if (object)
         new (object) T(std::forward<Args>(args)...);
 
+    NRI_TRACK_ALLOCATION(object, sizeof(T), GetAllocationType<T>());
+
     return object;
 }
 
 template <typename T>
 inline void Destroy(const AllocationCallbacks& allocationCallbacks, T* object) {
     if (object) {
+        NRI_TRACK_FREE(object);
+
         object->~T();
         allocationCallbacks.Free(allocationCallbacks.userArg, object);
     }
@@ -484,10 +568,14 @@ struct StdAllocator {
     }
 
     T* allocate(size_t n) noexcept {
-        return (T*)m_Interface.Allocate(m_Interface.userArg, n * sizeof(T), alignof(T));
+        T* memory = (T*)m_Interface.Allocate(m_Interface.userArg, n * sizeof(T), alignof(T));
+        NRI_TRACK_ALLOCATION(memory, n * sizeof(T), ALLOCATION_TYPE_CONTAINER);
+
+        return memory;
     }
 
     void deallocate(T* memory, size_t) noexcept {
+        NRI_TRACK_FREE(memory);
         m_Interface.Free(m_Interface.userArg, memory);
     }
 
@@ -690,4 +778,6 @@ inline Uid_t ConstructUid(uint8_t luid[8], uint8_t uuid[16], bool isLuidValid) {
 
 } // namespace nri
 
+#include "AnnotationRecorder.h"
 #include "DeviceBase.h" // requires "StdAllocator"
+#include "SwapChainVirtual.h"
@@ -2,6 +2,13 @@
 
 #include <cstdarg> // va_start, va_end
 
+#if (defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__))
+#    include <emmintrin.h> // _mm_stream_si128
+#    define NRI_SSE2 1
+#else
+#    define NRI_SSE2 0
+#endif
+
 #if (NRI_ENABLE_D3D11_SUPPORT || NRI_ENABLE_D3D12_SUPPORT)
 
 constexpr std::array<DxgiFormat, (size_t)Format::MAX_NUM> g_dxgiFormats = {{
@@ -916,6 +923,141 @@ void DeviceBase::ReportMessage(Message messageType, Result result, const char* f
         m_CallbackInterface.AbortExecution(m_CallbackInterface.userArg);
 }
 
+constexpr uint32_t SCRATCH_ARENA_CACHE_SIZE = 4; // devices per thread (a validation device and its implementation take 2)
+constexpr size_t SCRATCH_ARENA_ALIGNMENT = 64;
+constexpr uint32_t SCRATCH_ARENA_IDLE_NUM = 64; // empty periods in a row using less than a quarter of the arena, after which it gets trimmed
+
+struct ScratchArenaCacheEntry {
+    uint64_t deviceUid;
+    ScratchArena* arena;
+};
+
+// Trivial thread locals, no TLS init guards. The address of "t_scratchThreadTag" identifies the thread
+static thread_local ScratchArenaCacheEntry t_scratchArenaCache[SCRATCH_ARENA_CACHE_SIZE];
+static thread_local uint32_t t_scratchArenaCacheNext;
+static thread_local uint8_t t_scratchThreadTag;
+
+static std::atomic<uint64_t> g_deviceUid = {1};
+
+uint64_t nri::GenerateDeviceUid() {
+    return g_deviceUid.fetch_add(1, std::memory_order_relaxed);
+}
+
+ScratchArena* DeviceBase::GetScratchArena() {
+    for (const ScratchArenaCacheEntry& entry : t_scratchArenaCache) {
+        if (entry.deviceUid == m_Uid)
+            return entry.arena;
+    }
+
+    // Slow path: find or create the arena of this thread
+    ScratchArena* arena = nullptr;
+    {
+        ExclusiveScope lock(m_ScratchArenaLock);
+
+        for (ScratchArena* candidate : m_ScratchArenas) {
+            if (candidate->thread == &t_scratchThreadTag) {
+                arena = candidate;
+                break;
+            }
+        }
+
+        if (!arena) {
+            arena = (ScratchArena*)m_AllocationCallbacks.Allocate(m_AllocationCallbacks.userArg, sizeof(ScratchArena), alignof(ScratchArena));
+            if (!arena)
+                return nullptr;
+
+            *arena = {};
+            arena->thread = &t_scratchThreadTag;
+
+            m_ScratchArenas.push_back(arena);
+        }
+    }
+
+    t_scratchArenaCache[t_scratchArenaCacheNext++ % SCRATCH_ARENA_CACHE_SIZE] = {m_Uid, arena};
+
+    return arena;
+}
+
+void DeviceBase::DestroyScratchArenas() {
+    for (ScratchArena* arena : m_ScratchArenas) {
+        NRI_TRACK_FREE(arena->memory);
+        m_AllocationCallbacks.Free(m_AllocationCallbacks.userArg, arena->memory);
+        m_AllocationCallbacks.Free(m_AllocationCallbacks.userArg, arena);
+    }
+
+    m_ScratchArenas.clear();
+}
+
+void* nri::AllocateScratch(DeviceBase& device, size_t size, size_t alignment) {
+    const AllocationCallbacks& allocationCallbacks = device.GetAllocationCallbacks();
+
+    ScratchArena* arena = size <= NRI_MAX_SCRATCH_ARENA_SIZE ? device.GetScratchArena() : nullptr;
+    if (arena) {
+        size_t offset = Align(arena->offset, alignment);
+        arena->requiredSize = std::max(arena->requiredSize, offset + size);
+        arena->peakSize = std::max(arena->peakSize, offset + size);
+
+        // Grow geometrically, but only if empty, since outstanding allocations point into the current memory
+        if (!arena->offset && arena->requiredSize > arena->size) {
+            size_t newSize = std::max(arena->requiredSize, arena->size * 2);
+            newSize = std::min(newSize, (size_t)NRI_MAX_SCRATCH_ARENA_SIZE);
+
+            NRI_TRACK_FREE(arena->memory);
+            allocationCallbacks.Free(allocationCallbacks.userArg, arena->memory);
+
+            arena->memory = (uint8_t*)allocationCallbacks.Allocate(allocationCallbacks.userArg, newSize, SCRATCH_ARENA_ALIGNMENT);
+            arena->size = arena->memory ? newSize : 0;
+            NRI_TRACK_ALLOCATION(arena->memory, newSize, ALLOCATION_TYPE_SCRATCH);
+        }
+
+        if (alignment <= SCRATCH_ARENA_ALIGNMENT && offset + size <= arena->size) {
+            arena->offset = offset + size;
+            return arena->memory + offset;
+        }
+    }
+
+    // Too large or doesn't fit (the arena will be grown next time it's empty)
+    void* mem = allocationCallbacks.Allocate(allocationCallbacks.userArg, size, alignment);
+    NRI_TRACK_ALLOCATION(mem, size, ALLOCATION_TYPE_SCRATCH);
+
+    return mem;
+}
+
+void nri::FreeScratch(DeviceBase& device, void* mem) {
+    if (!mem)
+        return;
+
+    const AllocationCallbacks& allocationCallbacks = device.GetAllocationCallbacks();
+
+    ScratchArena* arena = device.GetScratchArena();
+    if (!arena || mem < arena->memory || mem >= arena->memory + arena->size) {
+        NRI_TRACK_FREE(mem);
+        allocationCallbacks.Free(allocationCallbacks.userArg, mem);
+
+        return;
+    }
+
+    arena->offset = (uint8_t*)mem - arena->memory;
+    if (arena->offset)
+        return;
+
+    // Empty: release a large arena if recent peaks have been well below its size for a while, it regrows to the recent peak on demand
+    bool isIdle = arena->size > NRI_SCRATCH_ARENA_TRIM_SIZE && arena->peakSize <= arena->size / 4;
+    arena->idleNum = isIdle ? arena->idleNum + 1 : 0;
+
+    if (arena->idleNum >= SCRATCH_ARENA_IDLE_NUM) {
+        NRI_TRACK_FREE(arena->memory);
+        allocationCallbacks.Free(allocationCallbacks.userArg, arena->memory);
+
+        arena->memory = nullptr;
+        arena->size = 0;
+        arena->requiredSize = arena->peakSize;
+        arena->idleNum = 0;
+    }
+
+    arena->peakSize = 0;
+}
+
 void nri::ConvertCharToWchar(const char* in, wchar_t* out, size_t outLength) {
     if (outLength == 0)
         return;
@@ -935,3 +1077,41 @@ void nri::ConvertWcharToChar(const wchar_t* in, char* out, size_t outLength) {
 
     *out = 0;
 }
+
+void nri::CopyToUploadMemory(void* dstData, const void* srcData, size_t size) {
+    uint8_t* dst = (uint8_t*)dstData;
+    const uint8_t* src = (const uint8_t*)srcData;
+
+#if NRI_SSE2
+    if (size >= STREAMING_COPY_MIN_SIZE) {
+        // Align destination to 16 bytes
+        size_t headSize = (0 - (size_t)dst) & 15;
+        memcpy(dst, src, headSize);
+
+        dst += headSize;
+        src += headSize;
+        size -= headSize;
+
+        // Fill full 64-byte write-combining lines
+        for (; size >= 64; size -= 64, dst += 64, src += 64) {
+            __m128i a = _mm_loadu_si128((const __m128i*)src + 0);
+            __m128i b = _mm_loadu_si128((const __m128i*)src + 1);
+            __m128i c = _mm_loadu_si128((const __m128i*)src + 2);
+            __m128i d = _mm_loadu_si128((const __m128i*)src + 3);
+
+            _mm_stream_si128((__m128i*)dst + 0, a);
+            _mm_stream_si128((__m128i*)dst + 1, b);
+            _mm_stream_si128((__m128i*)dst + 2, c);
+            _mm_stream_si128((__m128i*)dst + 3, d);
+        }
+    }
+#endif
+
+    memcpy(dst, src, size);
+}
+
+void nri::FlushUploadMemoryWrites() {
+#if NRI_SSE2
+    _mm_sfence();
+#endif
+}
@@ -48,6 +48,9 @@ struct StreamerImpl final : public DebugNameBase {
     BufferOffset StreamBufferData(const StreamBufferDataDesc& streamBufferDataDesc);
     BufferOffset StreamTextureData(const StreamTextureDataDesc& streamTextureDataDesc);
     void CmdCopyStreamedData(CommandBuffer& commandBuffer);
+    uint64_t CmdReadbackBuffer(CommandBuffer& commandBuffer, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size);
+    uint64_t CmdReadbackTexture(CommandBuffer& commandBuffer, const Texture& srcTexture, const TextureRegionDesc& srcRegion, TextureDataLayoutDesc& dataLayout);
+    const void* TryGetReadbackData(uint64_t ticket);
     void EndFrame();
 
     //================================================================================================================
@@ -57,10 +60,13 @@ struct StreamerImpl final : public DebugNameBase {
     void SetDebugName(const char* name) NRI_DEBUG_NAME_OVERRIDE {
         m_iCore.SetDebugName(m_ConstantBuffer, name);
         m_iCore.SetDebugName(m_DynamicBuffer, name);
+        m_iCore.SetDebugName(m_ReadbackBuffer, name);
     }
 
 private:
+    BufferOffset StreamTextureDataFromMemory(const StreamTextureDataDesc& streamTextureDataDesc, const void* data, Dim_t w, Dim_t h, Dim_t d);
     bool Grow();
+    uint64_t AllocateReadback(uint64_t size, uint32_t alignment, uint64_t& offset);
 
 private:
     Device& m_Device;
@@ -71,8 +77,12 @@ private:
     Vector<GarbageInFlight> m_GarbageInFlight;
     Buffer* m_DynamicBuffer = nullptr;
     Buffer* m_ConstantBuffer = nullptr;
+    Buffer* m_ReadbackBuffer = nullptr;
+    uint8_t* m_ReadbackMemory = nullptr; // mapped on demand, unmapped in "EndFrame"
     uint64_t m_DynamicBufferOffset = 0;
     uint64_t m_DynamicBufferSizePerFrame = 0;
+    uint64_t m_ReadbackBufferOffset = 0;
+    uint64_t m_FrameNum = 1; // "0" is reserved for invalid readback tickets
     uint32_t m_ConstantBufferOffset = 0;
     uint32_t m_FrameIndex = 0;
 
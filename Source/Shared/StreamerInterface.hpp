@@ -1,13 +1,18 @@
 // © 2024 NVIDIA Corporation
 
 constexpr uint64_t CHUNK_SIZE = 65536;
+constexpr uint32_t READBACK_ALIGNMENT = 16;
 
 StreamerImpl::~StreamerImpl() {
     for (GarbageInFlight& garbageInFlight : m_GarbageInFlight)
         m_iCore.DestroyBuffer(garbageInFlight.buffer);
 
+    if (m_ReadbackMemory)
+        m_iCore.UnmapBuffer(*m_ReadbackBuffer);
+
     m_iCore.DestroyBuffer(m_ConstantBuffer);
     m_iCore.DestroyBuffer(m_DynamicBuffer);
+    m_iCore.DestroyBuffer(m_ReadbackBuffer);
 }
 
 bool StreamerImpl::Grow() {
@@ -30,6 +35,21 @@ bool StreamerImpl::Grow() {
     return result == Result::SUCCESS;
 }
 
+uint64_t StreamerImpl::AllocateReadback(uint64_t size, uint32_t alignment, uint64_t& offset) {
+    m_ReadbackBufferOffset = Align(m_ReadbackBufferOffset, alignment);
+    if (!m_ReadbackBuffer || m_ReadbackBufferOffset + size > m_Desc.readbackBufferSize)
+        return 0;
+
+    uint64_t offsetInFrame = m_ReadbackBufferOffset;
+    offset = (m_FrameNum % (m_Desc.queuedFrameNum + 1)) * m_Desc.readbackBufferSize + offsetInFrame;
+
+    // Increment head
+    m_ReadbackBufferOffset += size;
+
+    // Ticket = frame number + offset in the frame region
+    return (m_FrameNum << 32) | offsetInFrame;
+}
+
 Result StreamerImpl::Create(const StreamerDesc& desc) {
     if (desc.constantBufferSize) {
         // Create the constant buffer
@@ -42,6 +62,16 @@ Result StreamerImpl::Create(const StreamerDesc& desc) {
             return result;
     }
 
+    if (desc.readbackBufferSize) {
+        // Create the readback buffer (+1 frame for the current frame, since the oldest one is being read on the host)
+        BufferDesc bufferDesc = {};
+        bufferDesc.size = desc.readbackBufferSize * (desc.queuedFrameNum + 1);
+
+        Result result = m_iCore.CreateCommittedBuffer(m_Device, MemoryLocation::HOST_READBACK, 0.0f, bufferDesc, m_ReadbackBuffer);
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
     m_Desc = desc;
 
     return Result::SUCCESS;
@@ -68,7 +98,8 @@ uint32_t StreamerImpl::StreamConstantData(const void* data, uint32_t dataSize) {
     if (dataSize) {
         uint8_t* dst = (uint8_t*)m_iCore.MapBuffer(*m_ConstantBuffer, offset, dataSize);
 
-        memcpy(dst, data, dataSize);
+        CopyToUploadMemory(dst, data, dataSize);
+        FlushUploadMemoryWrites();
 
         m_iCore.UnmapBuffer(*m_ConstantBuffer);
     }
@@ -103,9 +134,10 @@ BufferOffset StreamerImpl::StreamBufferData(const StreamBufferDataDesc& streamBu
 
         for (uint32_t i = 0; i < streamBufferDataDesc.dataChunkNum; i++) {
             const DataSize& dataChunk = streamBufferDataDesc.dataChunks[i];
-            memcpy(dst, dataChunk.data, dataChunk.size);
+            CopyToUploadMemory(dst, dataChunk.data, dataChunk.size);
             dst += dataChunk.size;
         }
+        FlushUploadMemoryWrites();
 
         m_iCore.UnmapBuffer(*m_DynamicBuffer);
 
@@ -125,10 +157,6 @@ BufferOffset StreamerImpl::StreamBufferData(const StreamBufferDataDesc& streamBu
 }
 
 BufferOffset StreamerImpl::StreamTextureData(const StreamTextureDataDesc& streamTextureDataDesc) {
-#if NRI_STREAMER_THREAD_SAFE
-    ExclusiveScope lock(m_Lock);
-#endif
-
     const DeviceDesc& deviceDesc = m_iCore.GetDeviceDesc(m_Device);
     const TextureDesc& textureDesc = m_iCore.GetTextureDesc(*streamTextureDataDesc.dstTexture);
 
@@ -141,6 +169,47 @@ BufferOffset StreamerImpl::StreamTextureData(const StreamTextureDataDesc& stream
     Dim_t d = streamTextureDataDesc.dstRegion.depth;
     d = d == WHOLE_SIZE ? GetDimension(deviceDesc.graphicsAPI, textureDesc, 2, streamTextureDataDesc.dstRegion.mipOffset) : d;
 
+    // Source (mapping happens outside of the lock)
+    const void* data = streamTextureDataDesc.data;
+    FileView fileView = {};
+
+    if (streamTextureDataDesc.file) {
+        const UploadFileDesc& file = *streamTextureDataDesc.file;
+        uint64_t size = uint64_t(streamTextureDataDesc.dataSlicePitch) * d;
+
+        if (file.mappedView) {
+            fileView.data = (const uint8_t*)file.mappedView;
+            fileView.size = uint64_t(-1); // unknown
+        } else if (!MapFileView(file.fileHandle, fileView))
+            return {};
+
+        if (streamTextureDataDesc.fileOffset + size > fileView.size) {
+            if (!file.mappedView)
+                UnmapFileView(fileView);
+
+            return {};
+        }
+
+        PrefetchFileView(fileView, streamTextureDataDesc.fileOffset, size);
+        data = fileView.data + streamTextureDataDesc.fileOffset;
+    }
+
+    BufferOffset bufferOffset = StreamTextureDataFromMemory(streamTextureDataDesc, data, w, h, d);
+
+    if (streamTextureDataDesc.file && !streamTextureDataDesc.file->mappedView)
+        UnmapFileView(fileView);
+
+    return bufferOffset;
+}
+
+BufferOffset StreamerImpl::StreamTextureDataFromMemory(const StreamTextureDataDesc& streamTextureDataDesc, const void* data, Dim_t w, Dim_t h, Dim_t d) {
+#if NRI_STREAMER_THREAD_SAFE
+    ExclusiveScope lock(m_Lock);
+#endif
+
+    const DeviceDesc& deviceDesc = m_iCore.GetDeviceDesc(m_Device);
+    const TextureDesc& textureDesc = m_iCore.GetTextureDesc(*streamTextureDataDesc.dstTexture);
+
     // Allocate a minimum continous region in a buffer encompassing the destination texture region
     const FormatProps& formatProps = GetFormatProps(textureDesc.format);
     uint32_t rowPitch = w * formatProps.stride;
@@ -163,13 +232,11 @@ BufferOffset StreamerImpl::StreamTextureData(const StreamTextureDataDesc& stream
     if (dataSize) {
         uint8_t* dst = (uint8_t*)m_iCore.MapBuffer(*m_DynamicBuffer, offset, dataSize);
 
-        for (uint32_t z = 0; z < d; z++) {
-            for (uint32_t y = 0; y < h; y++) {
-                uint8_t* dstRow = dst + z * alignedSlicePitch + y * alignedRowPitch;
-                const uint8_t* srcRow = (uint8_t*)streamTextureDataDesc.data + z * streamTextureDataDesc.dataSlicePitch + y * streamTextureDataDesc.dataRowPitch;
-                memcpy(dstRow, srcRow, rowPitch);
-            }
-        }
+        Format dataFormat = streamTextureDataDesc.dataFormat;
+        if (dataFormat != Format::UNKNOWN && dataFormat != textureDesc.format)
+            ConvertTextureData(dst, alignedRowPitch, alignedSlicePitch, textureDesc.format, data, streamTextureDataDesc.dataRowPitch, streamTextureDataDesc.dataSlicePitch, dataFormat, w, h, d);
+        else
+            CopyTextureData(dst, alignedRowPitch, alignedSlicePitch, data, streamTextureDataDesc.dataRowPitch, streamTextureDataDesc.dataSlicePitch, rowPitch, h, d, true);
 
         m_iCore.UnmapBuffer(*m_DynamicBuffer);
 
@@ -207,6 +274,78 @@ void StreamerImpl::CmdCopyStreamedData(CommandBuffer& commandBuffer) {
     m_TextureRequestsWithDst.clear();
 }
 
+uint64_t StreamerImpl::CmdReadbackBuffer(CommandBuffer& commandBuffer, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+#if NRI_STREAMER_THREAD_SAFE
+    ExclusiveScope lock(m_Lock);
+#endif
+
+    uint64_t offset = 0;
+    uint64_t ticket = AllocateReadback(size, READBACK_ALIGNMENT, offset);
+    if (ticket)
+        m_iCore.CmdCopyBuffer(commandBuffer, *m_ReadbackBuffer, offset, srcBuffer, srcOffset, size);
+
+    return ticket;
+}
+
+uint64_t StreamerImpl::CmdReadbackTexture(CommandBuffer& commandBuffer, const Texture& srcTexture, const TextureRegionDesc& srcRegion, TextureDataLayoutDesc& dataLayout) {
+#if NRI_STREAMER_THREAD_SAFE
+    ExclusiveScope lock(m_Lock);
+#endif
+
+    const DeviceDesc& deviceDesc = m_iCore.GetDeviceDesc(m_Device);
+    const TextureDesc& textureDesc = m_iCore.GetTextureDesc(srcTexture);
+
+    Dim_t w = srcRegion.width;
+    w = w == WHOLE_SIZE ? GetDimension(deviceDesc.graphicsAPI, textureDesc, 0, srcRegion.mipOffset) : w;
+
+    Dim_t h = srcRegion.height;
+    h = h == WHOLE_SIZE ? GetDimension(deviceDesc.graphicsAPI, textureDesc, 1, srcRegion.mipOffset) : h;
+
+    Dim_t d = srcRegion.depth;
+    d = d == WHOLE_SIZE ? GetDimension(deviceDesc.graphicsAPI, textureDesc, 2, srcRegion.mipOffset) : d;
+
+    // Allocate a minimum continous region in the readback buffer encompassing the source texture region (rows of blocks for compressed formats)
+    const FormatProps& formatProps = GetFormatProps(textureDesc.format);
+    uint32_t rowBlockNum = (w + formatProps.blockWidth - 1) / formatProps.blockWidth;
+    uint32_t rowNum = (h + formatProps.blockHeight - 1) / formatProps.blockHeight;
+    uint32_t rowPitch = rowBlockNum * formatProps.stride;
+    uint32_t alignedRowPitch = Align(rowPitch, deviceDesc.memoryAlignment.uploadBufferTextureRow);
+    uint32_t alignedSlicePitch = Align(alignedRowPitch * rowNum, deviceDesc.memoryAlignment.uploadBufferTextureSlice);
+    uint64_t dataSize = alignedSlicePitch * d;
+
+    uint64_t offset = 0;
+    uint64_t ticket = AllocateReadback(dataSize, deviceDesc.memoryAlignment.uploadBufferTextureSlice, offset);
+    if (ticket) {
+        TextureDataLayoutDesc dstDataLayout = {offset, alignedRowPitch, alignedSlicePitch};
+        m_iCore.CmdReadbackTextureToBuffer(commandBuffer, *m_ReadbackBuffer, dstDataLayout, srcTexture, srcRegion);
+
+        dataLayout = {0, alignedRowPitch, alignedSlicePitch};
+    }
+
+    return ticket;
+}
+
+const void* StreamerImpl::TryGetReadbackData(uint64_t ticket) {
+#if NRI_STREAMER_THREAD_SAFE
+    ExclusiveScope lock(m_Lock);
+#endif
+
+    // The app waits for frame "N - queuedFrameNum" before recording frame "N", and the region gets reused on the next frame
+    uint64_t frameNum = ticket >> 32;
+    if (!m_ReadbackBuffer || !frameNum || frameNum + m_Desc.queuedFrameNum != m_FrameNum)
+        return nullptr;
+
+    if (!m_ReadbackMemory) {
+        m_ReadbackMemory = (uint8_t*)m_iCore.MapBuffer(*m_ReadbackBuffer, 0, WHOLE_SIZE);
+        if (!m_ReadbackMemory)
+            return nullptr;
+    }
+
+    uint64_t offset = (frameNum % (m_Desc.queuedFrameNum + 1)) * m_Desc.readbackBufferSize + (ticket & 0xFFFFFFFF);
+
+    return m_ReadbackMemory + offset;
+}
+
 void StreamerImpl::EndFrame() {
     // Process garbage
     for (size_t i = 0; i < m_GarbageInFlight.size(); i++) {
@@ -228,4 +367,13 @@ void StreamerImpl::EndFrame() {
     // Next frame
     m_FrameIndex = (m_FrameIndex + 1) % m_Desc.queuedFrameNum;
     m_DynamicBufferOffset = 0;
+
+    // Readback data of the oldest frame is not needed anymore
+    if (m_ReadbackMemory) {
+        m_iCore.UnmapBuffer(*m_ReadbackBuffer);
+        m_ReadbackMemory = nullptr;
+    }
+
+    m_ReadbackBufferOffset = 0;
+    m_FrameNum++;
 }
@@ -0,0 +1,79 @@
+// © 2026 NVIDIA Corporation
+
+#pragma once
+
+// Headless swap chain ("SwapChainBits::VIRTUAL"), shared by all backends via "CoreInterface":
+// - textures are ordinary committed textures, presentation is simulated on the host timeline
+// - GPU synchronization is real: acquire and present are empty queue submissions signaling / waiting the semaphores
+// - a presented texture gets available again once the next frame is displayed (or immediately, if the frame is dropped)
+// - time comes from "steady_clock" or, if "frameTime" is set, from a virtual clock advanced by "Present" and blocking calls
+
+namespace nri {
+
+constexpr uint32_t VIRTUAL_SWAP_CHAIN_FRAME_HISTORY = 64;
+
+struct VirtualFrame {
+    LatencyReport latencyReport;
+    uint64_t presentId;
+    uint64_t fenceValue;
+    uint64_t displayTimeUs;
+};
+
+struct SwapChainVirtual {
+    inline SwapChainVirtual(DeviceBase& device)
+        : m_Device(device)
+        , m_Textures(device.GetStdAllocator())
+        , m_AvailableTimesUs(device.GetStdAllocator()) {
+        device.FillFunctionTable(m_iCore);
+    }
+
+    ~SwapChainVirtual();
+
+    inline DeviceBase& GetDevice() const {
+        return m_Device;
+    }
+
+    Result Create(const SwapChainDesc& swapChainDesc);
+    Texture* const* GetTextures(uint32_t& textureNum) const;
+    Result GetDisplayDesc(DisplayDesc& displayDesc) const;
+    Result AcquireNextTexture(Fence& acquireSemaphore, uint32_t& textureIndex);
+    Result WaitForPresent(uint64_t presentId);
+    Result Present(Fence& releaseSemaphore, uint64_t presentId);
+
+    Result SetLatencySleepMode(const LatencySleepMode& latencySleepMode);
+    Result SetLatencyMarker(uint64_t presentId, LatencyMarker latencyMarker);
+    Result LatencySleep(uint64_t presentId);
+    Result GetLatencyReport(LatencyReport& latencyReport);
+
+private:
+    VirtualFrame& GetFrame(uint64_t presentId);
+    uint64_t GetTimeUs() const;
+    void SleepUntil(uint64_t timeUs);
+
+private:
+    DeviceBase& m_Device;
+    CoreInterface m_iCore = {};
+    Vector<Texture*> m_Textures;
+    Vector<uint64_t> m_AvailableTimesUs;
+    std::array<VirtualFrame, VIRTUAL_SWAP_CHAIN_FRAME_HISTORY> m_Frames = {};
+    LatencySleepMode m_LatencySleepMode = {};
+    Queue* m_Queue = nullptr;
+    Fence* m_Fence = nullptr;
+    uint64_t m_FenceValue = 0;
+    std::atomic_uint64_t m_VirtualTimeUs = 0;
+    uint64_t m_OriginTimeUs = 0;
+    uint64_t m_LastDisplayTimeUs = 0;
+    uint64_t m_LastSleepTimeUs = 0;
+    uint32_t m_RefreshPeriodUs = 0;
+    uint32_t m_PresentLatencyUs = 0;
+    uint32_t m_DropFrameInterval = 0;
+    uint32_t m_FrameTimeUs = 0; // 0 - host clock
+    uint32_t m_PresentNum = 0;
+    uint32_t m_TextureIndex = 0;
+    uint32_t m_AcquiredTextureIndex = 0;
+    uint32_t m_DisplayedTextureIndex = uint32_t(-1);
+    SwapChainBits m_Flags = SwapChainBits::NONE;
+    Lock m_Lock;
+};
+
+} // namespace nri
@@ -0,0 +1,316 @@
+// © 2026 NVIDIA Corporation
+
+#include <chrono>
+#include <thread>
+
+constexpr uint32_t VIRTUAL_SWAP_CHAIN_DEFAULT_REFRESH_PERIOD = 16667; // us, 60 Hz
+
+static inline Format GetVirtualSwapChainFormat(SwapChainFormat format) {
+    switch (format) {
+        case SwapChainFormat::BT709_G10_16BIT:
+            return Format::RGBA16_SFLOAT;
+
+        case SwapChainFormat::BT709_G22_10BIT:
+        case SwapChainFormat::BT2020_G2084_10BIT:
+            return Format::R10_G10_B10_A2_UNORM;
+
+        default:
+            return Format::BGRA8_UNORM;
+    }
+}
+
+SwapChainVirtual::~SwapChainVirtual() {
+    for (Texture* texture : m_Textures)
+        m_iCore.DestroyTexture(texture);
+
+    if (m_Fence)
+        m_iCore.DestroyFence(m_Fence);
+}
+
+Result SwapChainVirtual::Create(const SwapChainDesc& swapChainDesc) {
+    const VirtualSwapChainDesc& virtualDesc = swapChainDesc.virtualDesc;
+
+    m_Queue = (Queue*)swapChainDesc.queue;
+    m_Flags = swapChainDesc.flags;
+    m_RefreshPeriodUs = virtualDesc.refreshPeriod ? virtualDesc.refreshPeriod : VIRTUAL_SWAP_CHAIN_DEFAULT_REFRESH_PERIOD;
+    m_PresentLatencyUs = virtualDesc.presentLatency;
+    m_DropFrameInterval = virtualDesc.dropFrameInterval;
+    m_FrameTimeUs = virtualDesc.frameTime;
+
+    Result result = m_iCore.CreateFence((Device&)m_Device, 0, m_Fence);
+    if (result != Result::SUCCESS)
+        return result;
+
+    TextureDesc textureDesc = {};
+    textureDesc.type = TextureType::TEXTURE_2D;
+    textureDesc.usage = TextureUsageBits::COLOR_ATTACHMENT | TextureUsageBits::SHADER_RESOURCE;
+    textureDesc.format = GetVirtualSwapChainFormat(swapChainDesc.format);
+    textureDesc.width = swapChainDesc.width;
+    textureDesc.height = swapChainDesc.height;
+    textureDesc.mipNum = 1;
+    textureDesc.layerNum = 1;
+    textureDesc.sampleNum = 1;
+
+    uint32_t textureNum = std::max<uint32_t>(swapChainDesc.textureNum, 1);
+    m_Textures.reserve(textureNum);
+    m_AvailableTimesUs.resize(textureNum, 0);
+
+    for (uint32_t i = 0; i < textureNum; i++) {
+        Texture* texture = nullptr;
+        result = m_iCore.CreateCommittedTexture((Device&)m_Device, MemoryLocation::DEVICE, 0.0f, textureDesc, texture);
+        if (result != Result::SUCCESS)
+            return result;
+
+        m_Textures.push_back(texture);
+    }
+
+    m_OriginTimeUs = GetTimeUs();
+
+    return Result::SUCCESS;
+}
+
+Texture* const* SwapChainVirtual::GetTextures(uint32_t& textureNum) const {
+    textureNum = (uint32_t)m_Textures.size();
+
+    return m_Textures.data();
+}
+
+Result SwapChainVirtual::GetDisplayDesc(DisplayDesc& displayDesc) const {
+    // An SDR BT.709 display
+    displayDesc = {};
+    displayDesc.redPrimary = {0.640f, 0.330f};
+    displayDesc.greenPrimary = {0.300f, 0.600f};
+    displayDesc.bluePrimary = {0.150f, 0.060f};
+    displayDesc.whitePoint = {0.3127f, 0.3290f};
+    displayDesc.maxLuminance = 80.0f;
+    displayDesc.maxFullFrameLuminance = 80.0f;
+    displayDesc.sdrLuminance = 80.0f;
+
+    return Result::SUCCESS;
+}
+
+Result SwapChainVirtual::AcquireNextTexture(Fence& acquireSemaphore, uint32_t& textureIndex) {
+    uint64_t availableTimeUs = 0;
+    {
+        ExclusiveScope lock(m_Lock);
+
+        textureIndex = m_TextureIndex++ % (uint32_t)m_Textures.size();
+        m_AcquiredTextureIndex = textureIndex;
+
+        availableTimeUs = m_AvailableTimesUs[textureIndex];
+    }
+
+    // Block like a real swap chain does if all textures are queued for presentation
+    SleepUntil(availableTimeUs);
+
+    FenceSubmitDesc signalFence = {};
+    signalFence.fence = &acquireSemaphore;
+
+    QueueSubmitDesc queueSubmitDesc = {};
+    queueSubmitDesc.signalFences = &signalFence;
+    queueSubmitDesc.signalFenceNum = 1;
+
+    return m_iCore.QueueSubmit(*m_Queue, queueSubmitDesc);
+}
+
+Result SwapChainVirtual::WaitForPresent(uint64_t presentId) {
+    uint64_t fenceValue = 0;
+    uint64_t displayTimeUs = 0;
+    {
+        ExclusiveScope lock(m_Lock);
+
+        // Too old or not queued yet
+        const VirtualFrame& frame = m_Frames[presentId % VIRTUAL_SWAP_CHAIN_FRAME_HISTORY];
+        if (frame.presentId != presentId || !frame.fenceValue)
+            return Result::SUCCESS;
+
+        fenceValue = frame.fenceValue;
+        displayTimeUs = frame.displayTimeUs;
+    }
+
+    m_iCore.Wait(*m_Fence, fenceValue);
+    SleepUntil(displayTimeUs);
+
+    return Result::SUCCESS;
+}
+
+Result SwapChainVirtual::Present(Fence& releaseSemaphore, uint64_t presentId) {
+    // The virtual clock moves by a frame
+    if (m_FrameTimeUs)
+        m_VirtualTimeUs += m_FrameTimeUs;
+
+    uint64_t presentStartTimeUs = GetTimeUs();
+
+    ExclusiveScope lock(m_Lock);
+
+    // The presentation engine waits for rendering on the queue
+    FenceSubmitDesc waitFence = {};
+    waitFence.fence = &releaseSemaphore;
+
+    FenceSubmitDesc signalFence = {};
+    signalFence.fence = m_Fence;
+    signalFence.value = m_FenceValue + 1;
+
+    QueueSubmitDesc queueSubmitDesc = {};
+    queueSubmitDesc.waitFences = &waitFence;
+    queueSubmitDesc.waitFenceNum = 1;
+    queueSubmitDesc.signalFences = &signalFence;
+    queueSubmitDesc.signalFenceNum = 1;
+
+    Result result = m_iCore.QueueSubmit(*m_Queue, queueSubmitDesc);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_FenceValue++;
+
+    // Schedule the display
+    uint64_t presentEndTimeUs = GetTimeUs();
+    uint64_t displayTimeUs = std::max(presentEndTimeUs + m_PresentLatencyUs, m_LastDisplayTimeUs);
+
+    if (m_Flags & SwapChainBits::VSYNC) {
+        // One display per refresh, aligned to the vsync grid
+        displayTimeUs = std::max(displayTimeUs, m_LastDisplayTimeUs + m_RefreshPeriodUs);
+
+        uint64_t refreshNum = (displayTimeUs - m_OriginTimeUs + m_RefreshPeriodUs - 1) / m_RefreshPeriodUs;
+        displayTimeUs = m_OriginTimeUs + refreshNum * m_RefreshPeriodUs;
+    }
+
+    m_PresentNum++;
+    bool isDropped = m_DropFrameInterval && (m_PresentNum % m_DropFrameInterval) == 0;
+
+    if (isDropped) {
+        // Never displayed, doesn't occupy a refresh
+        m_AvailableTimesUs[m_AcquiredTextureIndex] = presentEndTimeUs;
+    } else {
+        // The previously displayed texture gets released once replaced
+        if (m_DisplayedTextureIndex != uint32_t(-1))
+            m_AvailableTimesUs[m_DisplayedTextureIndex] = displayTimeUs;
+
+        m_AvailableTimesUs[m_AcquiredTextureIndex] = displayTimeUs; // updated by the next presentation, if there are 2+ textures
+        m_DisplayedTextureIndex = m_AcquiredTextureIndex;
+        m_LastDisplayTimeUs = displayTimeUs;
+    }
+
+    if (presentId) {
+        VirtualFrame& frame = GetFrame(presentId);
+        frame.fenceValue = m_FenceValue;
+        frame.displayTimeUs = displayTimeUs;
+
+        // GPU timings are unknown on the host
+        LatencyReport& latencyReport = frame.latencyReport;
+        latencyReport.presentStartTimeUs = presentStartTimeUs;
+        latencyReport.presentEndTimeUs = presentEndTimeUs;
+        latencyReport.driverStartTimeUs = latencyReport.renderSubmitStartTimeUs;
+        latencyReport.driverEndTimeUs = latencyReport.renderSubmitEndTimeUs;
+        latencyReport.osRenderQueueStartTimeUs = presentEndTimeUs;
+        latencyReport.osRenderQueueEndTimeUs = displayTimeUs;
+    }
+
+    return Result::SUCCESS;
+}
+
+uint64_t SwapChainVirtual::GetTimeUs() const {
+    if (m_FrameTimeUs)
+        return m_VirtualTimeUs;
+
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SwapChainVirtual::SleepUntil(uint64_t timeUs) {
+    if (m_FrameTimeUs) {
+        // Nothing to wait for, the virtual clock jumps forward (but never backward, if other threads got further)
+        uint64_t currentTimeUs = m_VirtualTimeUs;
+        while (currentTimeUs < timeUs && !m_VirtualTimeUs.compare_exchange_weak(currentTimeUs, timeUs))
+            ;
+
+        return;
+    }
+
+    std::chrono::steady_clock::time_point timePoint(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::microseconds(timeUs)));
+    std::this_thread::sleep_until(timePoint);
+}
+
+VirtualFrame& SwapChainVirtual::GetFrame(uint64_t presentId) {
+    VirtualFrame& frame = m_Frames[presentId % VIRTUAL_SWAP_CHAIN_FRAME_HISTORY];
+    if (frame.presentId != presentId) {
+        frame = {};
+        frame.presentId = presentId;
+    }
+
+    return frame;
+}
+
+Result SwapChainVirtual::SetLatencySleepMode(const LatencySleepMode& latencySleepMode) {
+    ExclusiveScope lock(m_Lock);
+
+    m_LatencySleepMode = latencySleepMode;
+
+    return Result::SUCCESS;
+}
+
+Result SwapChainVirtual::SetLatencyMarker(uint64_t presentId, LatencyMarker latencyMarker) {
+    uint64_t timeUs = GetTimeUs();
+
+    ExclusiveScope lock(m_Lock);
+
+    LatencyReport& latencyReport = GetFrame(presentId).latencyReport;
+    switch (latencyMarker) {
+        case LatencyMarker::SIMULATION_START:
+            latencyReport.simulationStartTimeUs = timeUs;
+            break;
+        case LatencyMarker::SIMULATION_END:
+            latencyReport.simulationEndTimeUs = timeUs;
+            break;
+        case LatencyMarker::RENDER_SUBMIT_START:
+            latencyReport.renderSubmitStartTimeUs = timeUs;
+            break;
+        case LatencyMarker::RENDER_SUBMIT_END:
+            latencyReport.renderSubmitEndTimeUs = timeUs;
+            break;
+        case LatencyMarker::INPUT_SAMPLE:
+            latencyReport.inputSampleTimeUs = timeUs;
+            break;
+        default:
+            return Result::INVALID_ARGUMENT;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result SwapChainVirtual::LatencySleep(uint64_t) {
+    uint64_t sleepTimeUs = 0;
+    {
+        ExclusiveScope lock(m_Lock);
+
+        if (m_LatencySleepMode.minIntervalUs)
+            sleepTimeUs = m_LastSleepTimeUs + m_LatencySleepMode.minIntervalUs;
+
+        // Low latency mode: don't start a new frame until the previous one is displayed, i.e. no frames are queued
+        if (m_LatencySleepMode.lowLatencyMode)
+            sleepTimeUs = std::max(sleepTimeUs, m_LastDisplayTimeUs);
+    }
+
+    SleepUntil(sleepTimeUs);
+
+    ExclusiveScope lock(m_Lock);
+    m_LastSleepTimeUs = std::max(GetTimeUs(), sleepTimeUs);
+
+    return Result::SUCCESS;
+}
+
+Result SwapChainVirtual::GetLatencyReport(LatencyReport& latencyReport) {
+    uint64_t timeUs = GetTimeUs();
+
+    ExclusiveScope lock(m_Lock);
+
+    // The latest displayed frame
+    const VirtualFrame* latestFrame = nullptr;
+    for (const VirtualFrame& frame : m_Frames) {
+        if (frame.fenceValue && frame.displayTimeUs <= timeUs && (!latestFrame || frame.presentId > latestFrame->presentId))
+            latestFrame = &frame;
+    }
+
+    latencyReport = latestFrame ? latestFrame->latencyReport : LatencyReport{};
+
+    return Result::SUCCESS;
+}
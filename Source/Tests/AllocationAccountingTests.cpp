@@ -0,0 +1,121 @@
+// © 2026 NVIDIA Corporation
+
+// CPU allocation accounting (requires "NRI_ENABLE_ALLOCATION_ACCOUNTING"): per call site live bytes, no call site leaks between threads
+
+#include "Tests.h"
+
+#include <thread>
+
+#include "SharedExternal.h"
+
+using namespace nri;
+
+#if NRI_ENABLE_ALLOCATION_ACCOUNTING
+
+// "NRI_Shared" is linked into both NRI and the tests, i.e. "isLocal" queries the registry of the tests executable
+static uint64_t GetSiteLiveBytes(const char* name, bool isLocal = false) {
+    AllocationStats allocationStats[64] = {};
+    uint32_t allocationStatsNum = 64;
+    if (isLocal)
+        GetAllocationStats(allocationStats, allocationStatsNum);
+    else
+        nriGetAllocationStats(allocationStats, allocationStatsNum);
+
+    for (uint32_t i = 0; i < allocationStatsNum; i++) {
+        if (allocationStats[i].isCallSite && !strcmp(allocationStats[i].name, name))
+            return allocationStats[i].liveBytes;
+    }
+
+    return 0;
+}
+
+NRI_TEST(NONE, AllocationAccounting_SiteScopes) {
+    uint8_t memory[4] = {};
+    uint64_t otherBytes = GetSiteLiveBytes("OTHER", true);
+    uint64_t commandBufferBytes = GetSiteLiveBytes("COMMAND_BUFFER", true);
+    uint64_t pipelineBytes = GetSiteLiveBytes("PIPELINE", true);
+
+    {
+        NRI_ALLOCATION_SITE_SCOPE(COMMAND_BUFFER);
+        TrackAllocation(memory + 0, 100, ALLOCATION_TYPE_SCRATCH);
+
+        // A nested higher priority site wins
+        {
+            NRI_ALLOCATION_SITE_SCOPE(PIPELINE);
+            TrackAllocation(memory + 1, 10, ALLOCATION_TYPE_SCRATCH);
+        }
+
+        // Sites are per thread
+        std::thread thread([&]() {
+            TrackAllocation(memory + 2, 1000, ALLOCATION_TYPE_SCRATCH);
+        });
+        thread.join();
+    }
+
+    TrackAllocation(memory + 3, 10000, ALLOCATION_TYPE_SCRATCH);
+
+    TEST_CHECK(GetSiteLiveBytes("COMMAND_BUFFER", true) - commandBufferBytes == 100);
+    TEST_CHECK(GetSiteLiveBytes("PIPELINE", true) - pipelineBytes == 10);
+    TEST_CHECK(GetSiteLiveBytes("OTHER", true) - otherBytes == 11000);
+
+    for (uint8_t& byte : memory)
+        TrackFree(&byte);
+
+    TEST_CHECK(GetSiteLiveBytes("COMMAND_BUFFER", true) == commandBufferBytes);
+    TEST_CHECK(GetSiteLiveBytes("PIPELINE", true) == pipelineBytes);
+    TEST_CHECK(GetSiteLiveBytes("OTHER", true) == otherBytes);
+}
+
+// "EndCommandBuffer" on another thread must not leave the recording thread in "COMMAND_BUFFER"
+static void TestRecordingOnTwoThreads(TestContext& context, GraphicsAPI graphicsAPI) {
+    TestDevice device(context, graphicsAPI);
+    if (!device && graphicsAPI == GraphicsAPI::VK)
+        TEST_SKIP("no Vulkan adapter");
+
+    TEST_REQUIRE(device);
+
+    CommandAllocator* commandAllocator = nullptr;
+    CommandBuffer* commandBuffer = nullptr;
+    TEST_REQUIRE(device.core.CreateCommandAllocator(*device.queue, commandAllocator) == Result::SUCCESS);
+    TEST_REQUIRE(device.core.CreateCommandBuffer(*commandAllocator, commandBuffer) == Result::SUCCESS);
+
+    uint64_t commandBufferBytes = GetSiteLiveBytes("COMMAND_BUFFER");
+
+    device.core.BeginCommandBuffer(*commandBuffer, nullptr);
+    std::thread thread([&]() {
+        device.core.EndCommandBuffer(*commandBuffer);
+    });
+    thread.join();
+
+    BufferDesc bufferDesc = {};
+    bufferDesc.size = 256;
+    bufferDesc.usage = BufferUsageBits::SHADER_RESOURCE;
+
+    Buffer* buffer = nullptr;
+    TEST_CHECK(device.core.CreateBuffer(*device.device, bufferDesc, buffer) == Result::SUCCESS);
+
+    TEST_CHECK(GetSiteLiveBytes("COMMAND_BUFFER") == commandBufferBytes);
+
+    if (buffer)
+        device.core.DestroyBuffer(buffer);
+
+    device.core.DestroyCommandBuffer(commandBuffer);
+    device.core.DestroyCommandAllocator(commandAllocator);
+}
+
+NRI_TEST(NONE, AllocationAccounting_RecordingOnTwoThreads) {
+    TestRecordingOnTwoThreads(context, GraphicsAPI::NONE);
+}
+
+NRI_TEST(VK, AllocationAccounting_RecordingOnTwoThreads) {
+    TestRecordingOnTwoThreads(context, GraphicsAPI::VK);
+}
+
+#else
+
+NRI_TEST(NONE, AllocationAccounting_Unsupported) {
+    uint32_t allocationStatsNum = 0;
+    TEST_CHECK(nriGetAllocationStats(nullptr, allocationStatsNum) == Result::UNSUPPORTED);
+}
+
+#endif
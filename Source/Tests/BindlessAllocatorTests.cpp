@@ -0,0 +1,302 @@
+// © 2026 NVIDIA Corporation
+
+// Bindless allocator: index allocation and deferred reuse on NONE + validation, update-after-bind on VK (lavapipe)
+
+#include "Tests.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace nri;
+
+constexpr uint32_t THREAD_NUM = 4;
+
+struct BindlessTest {
+    inline BindlessTest(TestContext& context, GraphicsAPI graphicsAPI, uint32_t descriptorNum)
+        : device(context, graphicsAPI, true) {
+        if (!device)
+            return;
+
+        const DeviceDesc& deviceDesc = device.core.GetDeviceDesc(*device.device);
+        if (graphicsAPI != GraphicsAPI::NONE && (!deviceDesc.tiers.bindless || deviceDesc.descriptorSet.updateAfterSet.samplerMaxNum < descriptorNum))
+            return;
+
+        DescriptorRangeDesc descriptorRangeDesc = {};
+        descriptorRangeDesc.descriptorNum = descriptorNum;
+        descriptorRangeDesc.descriptorType = DescriptorType::SAMPLER;
+        descriptorRangeDesc.shaderStages = StageBits::COMPUTE_SHADER;
+        descriptorRangeDesc.flags = DescriptorRangeBits::VARIABLE_SIZED_ARRAY | DescriptorRangeBits::PARTIALLY_BOUND | DescriptorRangeBits::ALLOW_UPDATE_AFTER_SET;
+
+        DescriptorSetDesc descriptorSetDesc = {};
+        descriptorSetDesc.ranges = &descriptorRangeDesc;
+        descriptorSetDesc.rangeNum = 1;
+        descriptorSetDesc.flags = DescriptorSetBits::ALLOW_UPDATE_AFTER_SET;
+
+        PipelineLayoutDesc pipelineLayoutDesc = {};
+        pipelineLayoutDesc.descriptorSets = &descriptorSetDesc;
+        pipelineLayoutDesc.descriptorSetNum = 1;
+        pipelineLayoutDesc.shaderStages = StageBits::COMPUTE_SHADER;
+
+        if (device.core.CreatePipelineLayout(*device.device, pipelineLayoutDesc, pipelineLayout) != Result::SUCCESS)
+            return;
+
+        BindlessClassDesc bindlessClassDesc = {};
+        bindlessClassDesc.descriptorType = DescriptorType::SAMPLER;
+        bindlessClassDesc.descriptorNum = descriptorNum;
+
+        BindlessAllocatorDesc bindlessAllocatorDesc = {};
+        bindlessAllocatorDesc.pipelineLayout = pipelineLayout;
+        bindlessAllocatorDesc.classes = &bindlessClassDesc;
+        bindlessAllocatorDesc.classNum = 1;
+
+        device.helper.CreateBindlessAllocator(*device.device, bindlessAllocatorDesc, bindlessAllocator);
+    }
+
+    inline ~BindlessTest() {
+        if (bindlessAllocator)
+            device.helper.DestroyBindlessAllocator(bindlessAllocator);
+
+        for (Descriptor* sampler : samplers)
+            device.core.DestroyDescriptor(sampler);
+
+        if (pipelineLayout)
+            device.core.DestroyPipelineLayout(pipelineLayout);
+    }
+
+    inline Descriptor* CreateSampler() {
+        SamplerDesc samplerDesc = {};
+
+        Descriptor* sampler = nullptr;
+        if (device.core.CreateSampler(*device.device, samplerDesc, sampler) != Result::SUCCESS)
+            return nullptr;
+
+        samplers.push_back(sampler);
+
+        return sampler;
+    }
+
+    inline uint32_t Allocate() {
+        uint32_t index = 0;
+        if (device.helper.AllocateBindlessIndex(*bindlessAllocator, 0, index) != Result::SUCCESS)
+            return ~0u;
+
+        return index;
+    }
+
+    // Allocates until the class is full, returns the number of allocated indices
+    inline uint32_t AllocateAll() {
+        uint32_t num = 0;
+        while (Allocate() != ~0u)
+            num++;
+
+        return num;
+    }
+
+    TestDevice device;
+    PipelineLayout* pipelineLayout = nullptr;
+    BindlessAllocator* bindlessAllocator = nullptr;
+    std::vector<Descriptor*> samplers;
+};
+
+NRI_TEST(NONE, Bindless_AllocateUntilFull) {
+    BindlessTest test(context, GraphicsAPI::NONE, 16);
+    TEST_REQUIRE(test.bindlessAllocator);
+
+    for (uint32_t i = 0; i < 16; i++)
+        TEST_CHECK(test.Allocate() == i);
+
+    uint32_t index = 0;
+    TEST_CHECK(test.device.helper.AllocateBindlessIndex(*test.bindlessAllocator, 0, index) == Result::OUT_OF_MEMORY);
+}
+
+NRI_TEST(NONE, Bindless_DeferredReuse) {
+    BindlessTest test(context, GraphicsAPI::NONE, 2);
+    TEST_REQUIRE(test.bindlessAllocator);
+
+    uint32_t a = test.Allocate();
+    uint32_t b = test.Allocate();
+    TEST_REQUIRE(a == 0 && b == 1);
+
+    // Released in frame 0
+    test.device.helper.ReleaseBindlessIndex(*test.bindlessAllocator, 0, a);
+    TEST_CHECK(test.Allocate() == ~0u);
+
+    // Frame 0 is not completed
+    test.device.helper.UpdateBindlessAllocator(*test.bindlessAllocator, 0);
+    TEST_CHECK(test.Allocate() == ~0u);
+
+    // Frame 0 is completed
+    test.device.helper.UpdateBindlessAllocator(*test.bindlessAllocator, 1);
+    TEST_CHECK(test.Allocate() == a);
+    TEST_CHECK(test.Allocate() == ~0u);
+}
+
+NRI_TEST(NONE, Bindless_ConcurrentAllocateRelease) {
+    constexpr uint32_t DESCRIPTOR_NUM = 1024;
+    constexpr uint32_t ROUND_NUM = 64;
+
+    BindlessTest test(context, GraphicsAPI::NONE, DESCRIPTOR_NUM);
+    TEST_REQUIRE(test.bindlessAllocator);
+
+    // Producers allocate and release concurrently, while the only consumer ("Update") retires released indices with no GPU latency
+    std::atomic_uint32_t owners[DESCRIPTOR_NUM] = {};
+    std::atomic_uint32_t errorNum = {0};
+    std::atomic_uint32_t runningNum = {THREAD_NUM};
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < THREAD_NUM; t++) {
+        threads.emplace_back([&, t]() {
+            uint32_t indices[DESCRIPTOR_NUM / THREAD_NUM] = {};
+
+            for (uint32_t round = 0; round < ROUND_NUM; round++) {
+                uint32_t num = 0;
+                for (; num < DESCRIPTOR_NUM / THREAD_NUM; num++) {
+                    uint32_t index = test.Allocate();
+                    if (index == ~0u)
+                        break; // some indices are still retiring
+
+                    // An index must not be handed out twice
+                    if (owners[index].exchange(t + 1) != 0)
+                        errorNum++;
+
+                    indices[num] = index;
+                }
+
+                for (uint32_t i = 0; i < num; i++) {
+                    owners[indices[i]].store(0);
+                    test.device.helper.ReleaseBindlessIndex(*test.bindlessAllocator, 0, indices[i]);
+                }
+            }
+
+            runningNum--;
+        });
+    }
+
+    uint64_t frameIndex = 0;
+    while (runningNum)
+        test.device.helper.UpdateBindlessAllocator(*test.bindlessAllocator, ++frameIndex);
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    TEST_CHECK(errorNum == 0);
+
+    // No index is lost
+    test.device.helper.UpdateBindlessAllocator(*test.bindlessAllocator, ++frameIndex);
+    test.device.helper.UpdateBindlessAllocator(*test.bindlessAllocator, ++frameIndex);
+    TEST_CHECK(test.AllocateAll() == DESCRIPTOR_NUM);
+}
+
+NRI_TEST(NONE, Bindless_BatchedWrites) {
+    BindlessTest test(context, GraphicsAPI::NONE, 16);
+    TEST_REQUIRE(test.bindlessAllocator);
+
+    Descriptor* a = test.CreateSampler();
+    Descriptor* b = test.CreateSampler();
+    TEST_REQUIRE(a && b);
+
+    // Overwrites, gaps and consecutive indices, all applied by one update
+    for (uint32_t i = 0; i < 8; i++)
+        test.Allocate();
+
+    test.device.helper.SetBindlessDescriptor(*test.bindlessAllocator, 0, 3, *a);
+    test.device.helper.SetBindlessDescriptor(*test.bindlessAllocator, 0, 0, *a);
+    test.device.helper.SetBindlessDescriptor(*test.bindlessAllocator, 0, 1, *b);
+    test.device.helper.SetBindlessDescriptor(*test.bindlessAllocator, 0, 3, *b);
+    test.device.helper.SetBindlessDescriptor(*test.bindlessAllocator, 0, 7, *a);
+    test.device.helper.UpdateBindlessAllocator(*test.bindlessAllocator, 0);
+
+    // Nothing is pending
+    test.device.helper.UpdateBindlessAllocator(*test.bindlessAllocator, 1);
+}
+
+NRI_TEST(NONE, Bindless_Validation) {
+    BindlessTest test(context, GraphicsAPI::NONE, 4);
+    TEST_REQUIRE(test.bindlessAllocator);
+
+    context.expectedErrorMessageNum = 3;
+
+    uint32_t index = 0;
+    TEST_CHECK(test.device.helper.AllocateBindlessIndex(*test.bindlessAllocator, 1, index) == Result::INVALID_ARGUMENT);
+    test.device.helper.ReleaseBindlessIndex(*test.bindlessAllocator, 0, 4);
+
+    Descriptor* sampler = test.CreateSampler();
+    TEST_REQUIRE(sampler);
+
+    test.device.helper.SetBindlessDescriptor(*test.bindlessAllocator, 0, 4, *sampler);
+}
+
+NRI_TEST(VK, Bindless_UpdateAfterBind) {
+    constexpr uint32_t DESCRIPTOR_NUM = 256;
+
+    BindlessTest test(context, GraphicsAPI::VK, DESCRIPTOR_NUM);
+    if (!test.device)
+        TEST_SKIP("no Vulkan adapter");
+
+    if (!test.bindlessAllocator)
+        TEST_SKIP("update-after-set descriptors are not supported");
+
+    CoreInterface& core = test.device.core;
+    HelperInterface& helper = test.device.helper;
+
+    CommandAllocator* commandAllocator = nullptr;
+    CommandBuffer* commandBuffer = nullptr;
+    Fence* fence = nullptr;
+    TEST_REQUIRE(core.CreateCommandAllocator(*test.device.queue, commandAllocator) == Result::SUCCESS);
+    TEST_REQUIRE(core.CreateCommandBuffer(*commandAllocator, commandBuffer) == Result::SUCCESS);
+    TEST_REQUIRE(core.CreateFence(*test.device.device, 0, fence) == Result::SUCCESS);
+
+    // Frame 0: the set is bound before any descriptor is written
+    uint32_t a = test.Allocate();
+    uint32_t b = test.Allocate();
+    Descriptor* sampler = test.CreateSampler();
+    TEST_REQUIRE(a != ~0u && b != ~0u && sampler);
+
+    SetDescriptorSetDesc setDescriptorSetDesc = {};
+    setDescriptorSetDesc.descriptorSet = helper.GetBindlessDescriptorSet(*test.bindlessAllocator, 0);
+    setDescriptorSetDesc.bindPoint = BindPoint::COMPUTE;
+
+    TEST_CHECK(core.BeginCommandBuffer(*commandBuffer, nullptr) == Result::SUCCESS);
+    {
+        core.CmdSetPipelineLayout(*commandBuffer, BindPoint::COMPUTE, *test.pipelineLayout);
+        core.CmdSetDescriptorSet(*commandBuffer, setDescriptorSetDesc);
+    }
+    TEST_CHECK(core.EndCommandBuffer(*commandBuffer) == Result::SUCCESS);
+
+    // Written after "CmdSetDescriptorSet", but before "QueueSubmit"
+    helper.SetBindlessDescriptor(*test.bindlessAllocator, 0, a, *sampler);
+    helper.SetBindlessDescriptor(*test.bindlessAllocator, 0, b, *sampler);
+    helper.UpdateBindlessAllocator(*test.bindlessAllocator, 0);
+
+    FenceSubmitDesc signalFence = {};
+    signalFence.fence = fence;
+    signalFence.value = 1;
+
+    QueueSubmitDesc queueSubmitDesc = {};
+    queueSubmitDesc.commandBuffers = &commandBuffer;
+    queueSubmitDesc.commandBufferNum = 1;
+    queueSubmitDesc.signalFences = &signalFence;
+    queueSubmitDesc.signalFenceNum = 1;
+
+    TEST_CHECK(core.QueueSubmit(*test.device.queue, queueSubmitDesc) == Result::SUCCESS);
+
+    // Frame 1: "b" is released while frame 0 is in flight, rewriting "a" doesn't require rebinding
+    helper.ReleaseBindlessIndex(*test.bindlessAllocator, 0, b);
+    helper.SetBindlessDescriptor(*test.bindlessAllocator, 0, a, *sampler);
+    helper.UpdateBindlessAllocator(*test.bindlessAllocator, 0);
+
+    core.Wait(*fence, 1);
+
+    // "b" is reused only once frame 1 is completed
+    for (uint32_t i = 2; i < DESCRIPTOR_NUM; i++)
+        test.Allocate();
+
+    TEST_CHECK(test.Allocate() == ~0u);
+
+    helper.UpdateBindlessAllocator(*test.bindlessAllocator, 2);
+    TEST_CHECK(test.Allocate() == b);
+
+    core.DestroyFence(fence);
+    core.DestroyCommandBuffer(commandBuffer);
+    core.DestroyCommandAllocator(commandAllocator);
+}
@@ -0,0 +1,190 @@
+// © 2026 NVIDIA Corporation
+
+// Capture layer (requires "NRI_ENABLE_CAPTURE_SUPPORT"): swap chain, low latency and ray tracing calls are recorded, not only forwarded
+
+#include "Tests.h"
+
+#include "SharedExternal.h"
+
+#if NRI_ENABLE_CAPTURE_SUPPORT
+
+#    include "CaptureStream.h"
+
+using namespace nri;
+
+constexpr const char* CAPTURE_FILE_NAME = "NRI_Tests_Capture.bin";
+
+// Counts records per op
+static bool ReadCapture(const char* path, std::vector<uint32_t>& opNum) {
+    opNum.assign((size_t)CaptureOp::MAX_NUM, 0);
+
+    FILE* file = fopen(path, "rb");
+    if (!file)
+        return false;
+
+    std::vector<uint8_t> data;
+    uint8_t buffer[4096];
+    for (size_t size = fread(buffer, 1, sizeof(buffer), file); size; size = fread(buffer, 1, sizeof(buffer), file))
+        data.insert(data.end(), buffer, buffer + size);
+
+    fclose(file);
+
+    CaptureFileHeader header = {};
+    if (data.size() < sizeof(header))
+        return false;
+
+    memcpy(&header, data.data(), sizeof(header));
+    if (header.magic != CAPTURE_MAGIC || header.version != CAPTURE_VERSION)
+        return false;
+
+    size_t offset = sizeof(header);
+    while (offset + sizeof(CaptureRecordHeader) <= data.size()) {
+        CaptureRecordHeader recordHeader = {};
+        memcpy(&recordHeader, data.data() + offset, sizeof(recordHeader));
+
+        offset += sizeof(CaptureRecordHeader) + recordHeader.size;
+        if (recordHeader.op >= CaptureOp::MAX_NUM || offset > data.size())
+            return false;
+
+        opNum[(size_t)recordHeader.op]++;
+    }
+
+    return offset == data.size();
+}
+
+NRI_TEST(NONE, Capture_SwapChainAndRayTracing) {
+    DeviceCreationDesc deviceCreationDesc = {};
+    deviceCreationDesc.graphicsAPI = GraphicsAPI::NONE;
+    deviceCreationDesc.captureFileName = CAPTURE_FILE_NAME;
+
+    Device* device = nullptr;
+    TEST_REQUIRE(nriCreateDevice(deviceCreationDesc, device) == Result::SUCCESS);
+
+    CoreInterface core = {};
+    SwapChainInterface swapChainInterface = {};
+    LowLatencyInterface lowLatencyInterface = {};
+    RayTracingInterface rayTracingInterface = {};
+    Queue* queue = nullptr;
+
+    bool isSupported = nriGetInterface(*device, NRI_INTERFACE(CoreInterface), &core) == Result::SUCCESS
+        && nriGetInterface(*device, NRI_INTERFACE(SwapChainInterface), &swapChainInterface) == Result::SUCCESS
+        && nriGetInterface(*device, NRI_INTERFACE(LowLatencyInterface), &lowLatencyInterface) == Result::SUCCESS
+        && nriGetInterface(*device, NRI_INTERFACE(RayTracingInterface), &rayTracingInterface) == Result::SUCCESS
+        && core.GetQueue(*device, QueueType::GRAPHICS, 0, queue) == Result::SUCCESS;
+    TEST_CHECK(isSupported);
+
+    if (isSupported) { // Presentation
+        Fence* acquireSemaphore = nullptr;
+        Fence* releaseSemaphore = nullptr;
+        TEST_CHECK(core.CreateFence(*device, SWAPCHAIN_SEMAPHORE, acquireSemaphore) == Result::SUCCESS);
+        TEST_CHECK(core.CreateFence(*device, SWAPCHAIN_SEMAPHORE, releaseSemaphore) == Result::SUCCESS);
+
+        SwapChainDesc swapChainDesc = {};
+        swapChainDesc.queue = queue;
+        swapChainDesc.width = 64;
+        swapChainDesc.height = 64;
+        swapChainDesc.textureNum = 2;
+        swapChainDesc.flags = SwapChainBits::WAITABLE | SwapChainBits::ALLOW_LOW_LATENCY;
+
+        SwapChain* swapChain = nullptr;
+        TEST_CHECK(swapChainInterface.CreateSwapChain(*device, swapChainDesc, swapChain) == Result::SUCCESS);
+
+        if (swapChain && acquireSemaphore && releaseSemaphore) {
+            uint32_t textureNum = 0;
+            TEST_CHECK(swapChainInterface.GetSwapChainTextures(*swapChain, textureNum) && textureNum);
+
+            LatencySleepMode latencySleepMode = {};
+            latencySleepMode.lowLatencyMode = true;
+            lowLatencyInterface.SetLatencySleepMode(*swapChain, latencySleepMode);
+
+            for (uint64_t presentId = 1; presentId <= 2; presentId++) {
+                lowLatencyInterface.LatencySleep(*swapChain, presentId);
+                lowLatencyInterface.SetLatencyMarker(*swapChain, presentId, LatencyMarker::SIMULATION_START);
+
+                uint32_t textureIndex = 0;
+                swapChainInterface.AcquireNextTexture(*swapChain, *acquireSemaphore, textureIndex);
+                swapChainInterface.QueuePresent(*swapChain, *releaseSemaphore, presentId);
+                swapChainInterface.WaitForPresent(*swapChain, presentId);
+            }
+        }
+
+        swapChainInterface.DestroySwapChain(swapChain);
+
+        if (releaseSemaphore)
+            core.DestroyFence(releaseSemaphore);
+        if (acquireSemaphore)
+            core.DestroyFence(acquireSemaphore);
+    }
+
+    if (isSupported) { // Acceleration structure build
+        BufferDesc bufferDesc = {};
+        bufferDesc.size = 1024;
+        bufferDesc.usage = BufferUsageBits::ACCELERATION_STRUCTURE_BUILD_INPUT | BufferUsageBits::SCRATCH;
+
+        Buffer* buffer = nullptr;
+        TEST_CHECK(core.CreateCommittedBuffer(*device, MemoryLocation::DEVICE, 0.0f, bufferDesc, buffer) == Result::SUCCESS);
+
+        BottomLevelGeometryDesc geometry = {};
+        geometry.type = BottomLevelGeometryType::TRIANGLES;
+        geometry.triangles.vertexBuffer = HAS_BUFFER;
+        geometry.triangles.vertexNum = 3;
+        geometry.triangles.vertexStride = 12;
+        geometry.triangles.vertexFormat = Format::RGB32_SFLOAT;
+
+        AccelerationStructureDesc accelerationStructureDesc = {};
+        accelerationStructureDesc.type = AccelerationStructureType::BOTTOM_LEVEL;
+        accelerationStructureDesc.geometries = &geometry;
+        accelerationStructureDesc.geometryOrInstanceNum = 1;
+
+        AccelerationStructure* accelerationStructure = nullptr;
+        TEST_CHECK(rayTracingInterface.CreateCommittedAccelerationStructure(*device, MemoryLocation::DEVICE, 0.0f, accelerationStructureDesc, accelerationStructure) == Result::SUCCESS);
+
+        CommandAllocator* commandAllocator = nullptr;
+        CommandBuffer* commandBuffer = nullptr;
+        TEST_CHECK(core.CreateCommandAllocator(*queue, commandAllocator) == Result::SUCCESS);
+        TEST_CHECK(commandAllocator && core.CreateCommandBuffer(*commandAllocator, commandBuffer) == Result::SUCCESS);
+
+        if (buffer && accelerationStructure && commandBuffer) {
+            geometry.triangles.vertexBuffer = buffer;
+
+            BuildBottomLevelAccelerationStructureDesc buildDesc = {};
+            buildDesc.dst = accelerationStructure;
+            buildDesc.geometries = &geometry;
+            buildDesc.geometryNum = 1;
+            buildDesc.scratchBuffer = buffer;
+
+            core.BeginCommandBuffer(*commandBuffer, nullptr);
+            rayTracingInterface.CmdBuildBottomLevelAccelerationStructures(*commandBuffer, &buildDesc, 1);
+            core.EndCommandBuffer(*commandBuffer);
+        }
+
+        if (commandBuffer)
+            core.DestroyCommandBuffer(commandBuffer);
+        if (commandAllocator)
+            core.DestroyCommandAllocator(commandAllocator);
+
+        rayTracingInterface.DestroyAccelerationStructure(accelerationStructure);
+        core.DestroyBuffer(buffer);
+    }
+
+    nriDestroyDevice(device);
+
+    std::vector<uint32_t> opNum;
+    TEST_CHECK(ReadCapture(CAPTURE_FILE_NAME, opNum));
+    remove(CAPTURE_FILE_NAME);
+
+    TEST_CHECK(opNum[(size_t)CaptureOp::CreateSwapChain] == 1);
+    TEST_CHECK(opNum[(size_t)CaptureOp::GetSwapChainTextures] == 1);
+    TEST_CHECK(opNum[(size_t)CaptureOp::SetLatencySleepMode] == 1);
+    TEST_CHECK(opNum[(size_t)CaptureOp::LatencySleep] == 2);
+    TEST_CHECK(opNum[(size_t)CaptureOp::SetLatencyMarker] == 2);
+    TEST_CHECK(opNum[(size_t)CaptureOp::AcquireNextTexture] == 2);
+    TEST_CHECK(opNum[(size_t)CaptureOp::QueuePresent] == 2);
+    TEST_CHECK(opNum[(size_t)CaptureOp::WaitForPresent] == 2);
+    TEST_CHECK(opNum[(size_t)CaptureOp::DestroySwapChain] == 1);
+    TEST_CHECK(opNum[(size_t)CaptureOp::CreateCommittedAccelerationStructure] == 1);
+    TEST_CHECK(opNum[(size_t)CaptureOp::CmdBuildBottomLevelAccelerationStructures] == 1);
+    TEST_CHECK(opNum[(size_t)CaptureOp::DestroyAccelerationStructure] == 1);
+}
+
+#endif
@@ -0,0 +1,399 @@
+// © 2026 NVIDIA Corporation
+
+// Defragmentation: the CPU planner in isolation ("PlanDefragmentationMoves") and content preservation on a real device
+
+#include "Tests.h"
+
+#include "SharedExternal.h"
+
+#include "HelperInterface.h"
+
+using namespace nri;
+
+// Planner containers hold types with fundamental alignment only, "malloc" is enough
+static void* NRI_CALL AllocateTest(void*, size_t size, size_t) {
+    return malloc(size);
+}
+
+static void* NRI_CALL ReallocateTest(void*, void* memory, size_t size, size_t) {
+    return realloc(memory, size);
+}
+
+static void NRI_CALL FreeTest(void*, void* memory) {
+    free(memory);
+}
+
+static const AllocationCallbacks g_testAllocationCallbacks = {AllocateTest, ReallocateTest, FreeTest};
+
+struct Planner {
+    inline Planner(uint64_t preferredMemorySize, float occupancyThreshold = 0.5f)
+        : allocator(g_testAllocationCallbacks)
+        , memorySizes(allocator)
+        , allocations(allocator)
+        , moves(allocator)
+        , newMemories(allocator) {
+        desc.memoryLocation = MemoryLocation::DEVICE;
+        desc.preferredMemorySize = preferredMemorySize;
+        desc.maxBytesPerStep = UINT64_MAX;
+        desc.occupancyThreshold = occupancyThreshold;
+    }
+
+    inline uint32_t Memory(uint64_t size) {
+        memorySizes.push_back(size);
+
+        return (uint32_t)memorySizes.size() - 1;
+    }
+
+    inline uint32_t Allocation(uint32_t memoryIndex, uint64_t size, uint32_t alignment = 1, MemoryType type = 0, bool mustBeDedicated = false, bool isMultisample = false) {
+        allocations.push_back({memoryIndex, alignment, size, type, mustBeDedicated, isMultisample});
+
+        return (uint32_t)allocations.size() - 1;
+    }
+
+    inline void Plan() {
+        PlanDefragmentationMoves(desc, memorySizes, allocations, moves, newMemories);
+    }
+
+    inline const DefragmentationPlannedMove* FindMove(uint32_t resourceIndex) const {
+        for (const DefragmentationPlannedMove& move : moves) {
+            if (move.resourceIndex == resourceIndex)
+                return &move;
+        }
+
+        return nullptr;
+    }
+
+    StdAllocator<uint8_t> allocator;
+    DefragmenterDesc desc = {};
+    Vector<uint64_t> memorySizes;
+    Vector<DefragmentationAllocation> allocations;
+    Vector<DefragmentationPlannedMove> moves;
+    Vector<DefragmentationNewMemory> newMemories;
+};
+
+//============================================================================================================================================================================================
+#pragma region[  Planner  ]
+//============================================================================================================================================================================================
+
+NRI_TEST(NONE, Defragmenter_PlanCompactsSparseMemories) {
+    Planner planner(1000);
+
+    uint32_t m0 = planner.Memory(1000);
+    uint32_t m1 = planner.Memory(1000);
+    uint32_t a = planner.Allocation(m0, 100);
+    uint32_t b = planner.Allocation(m0, 200);
+    uint32_t c = planner.Allocation(m1, 150);
+
+    planner.Plan();
+
+    // First fit decreasing: "B", "C", "A" packed into one new memory object
+    TEST_REQUIRE(planner.moves.size() == 3);
+    TEST_REQUIRE(planner.newMemories.size() == 1);
+
+    TEST_CHECK(planner.moves[0].resourceIndex == b && planner.moves[0].dstOffset == 0);
+    TEST_CHECK(planner.moves[1].resourceIndex == c && planner.moves[1].dstOffset == 200);
+    TEST_CHECK(planner.moves[2].resourceIndex == a && planner.moves[2].dstOffset == 350);
+    TEST_CHECK(planner.newMemories[0].size == 450);
+
+    for (const DefragmentationPlannedMove& move : planner.moves) {
+        TEST_CHECK(move.dstMemoryIndex == 0);
+        TEST_CHECK(move.size == planner.allocations[move.resourceIndex].size);
+        TEST_CHECK(!move.buffer && !move.texture);
+    }
+}
+
+NRI_TEST(NONE, Defragmenter_PlanKeepsDenseMemories) {
+    Planner planner(1000);
+
+    uint32_t m0 = planner.Memory(1000);
+    uint32_t m1 = planner.Memory(1000);
+    uint32_t a = planner.Allocation(m0, 300);
+    uint32_t b = planner.Allocation(m0, 300); // 600 >= 500
+    uint32_t c = planner.Allocation(m1, 100);
+
+    planner.Plan();
+
+    TEST_REQUIRE(planner.moves.size() == 1);
+    TEST_CHECK(planner.moves[0].resourceIndex == c);
+    TEST_CHECK(!planner.FindMove(a) && !planner.FindMove(b));
+}
+
+NRI_TEST(NONE, Defragmenter_PlanSkipsDedicatedMemories) {
+    Planner planner(1000);
+
+    uint32_t m0 = planner.Memory(1000);
+    uint32_t m1 = planner.Memory(1000);
+    planner.Allocation(m0, 100, 1, 0, true);
+    planner.Allocation(m0, 100);
+    uint32_t c = planner.Allocation(m1, 100);
+
+    planner.Plan();
+
+    // Nothing from "m0" can be moved, since it can't be emptied
+    TEST_REQUIRE(planner.moves.size() == 1);
+    TEST_CHECK(planner.moves[0].resourceIndex == c);
+}
+
+NRI_TEST(NONE, Defragmenter_PlanRespectsAlignment) {
+    Planner planner(1000);
+
+    uint32_t m0 = planner.Memory(1000);
+    uint32_t a = planner.Allocation(m0, 100);
+    uint32_t b = planner.Allocation(m0, 64, 256);
+
+    planner.Plan();
+
+    TEST_REQUIRE(planner.moves.size() == 2);
+    TEST_CHECK(planner.FindMove(a)->dstOffset == 0);
+    TEST_CHECK(planner.FindMove(b)->dstOffset == 256);
+    TEST_CHECK(planner.newMemories[0].size == 320);
+}
+
+NRI_TEST(NONE, Defragmenter_PlanSeparatesMemoryTypes) {
+    Planner planner(1000);
+
+    uint32_t m0 = planner.Memory(1000);
+    uint32_t m1 = planner.Memory(1000);
+    uint32_t a = planner.Allocation(m0, 100, 1, 1);
+    uint32_t b = planner.Allocation(m1, 100, 1, 2, false, true);
+    uint32_t c = planner.Allocation(m1, 50, 1, 1);
+
+    planner.Plan();
+
+    TEST_REQUIRE(planner.moves.size() == 3);
+    TEST_REQUIRE(planner.newMemories.size() == 2);
+
+    const DefragmentationNewMemory& memoryA = planner.newMemories[planner.FindMove(a)->dstMemoryIndex];
+    const DefragmentationNewMemory& memoryB = planner.newMemories[planner.FindMove(b)->dstMemoryIndex];
+
+    TEST_CHECK(planner.FindMove(a)->dstMemoryIndex == planner.FindMove(c)->dstMemoryIndex);
+    TEST_CHECK(memoryA.type == 1 && memoryA.size == 150 && !memoryA.allowMultisampleTextures);
+    TEST_CHECK(memoryB.type == 2 && memoryB.size == 100 && memoryB.allowMultisampleTextures);
+}
+
+NRI_TEST(NONE, Defragmenter_PlanSplitsByPreferredSize) {
+    Planner planner(1000);
+
+    uint32_t m0 = planner.Memory(4000);
+    uint32_t a = planner.Allocation(m0, 600);
+    uint32_t b = planner.Allocation(m0, 550);
+    uint32_t c = planner.Allocation(m0, 300);
+    uint32_t d = planner.Allocation(m0, 1500); // 2950 >= 2000, must not be a candidate...
+
+    planner.Plan();
+    TEST_CHECK(planner.moves.empty());
+
+    // ... unless the threshold allows it
+    planner.desc.occupancyThreshold = 1.0f;
+    planner.Plan();
+
+    // "D" (oversized) gets its own memory object, "A" and "B" don't fit together, "C" goes after "A"
+    TEST_REQUIRE(planner.moves.size() == 4);
+    TEST_REQUIRE(planner.newMemories.size() == 3);
+
+    TEST_CHECK(planner.FindMove(d)->dstMemoryIndex == 0 && planner.newMemories[0].size == 1500);
+    TEST_CHECK(planner.FindMove(a)->dstMemoryIndex == 1 && planner.FindMove(a)->dstOffset == 0);
+    TEST_CHECK(planner.FindMove(b)->dstMemoryIndex == 2 && planner.FindMove(b)->dstOffset == 0);
+    TEST_CHECK(planner.FindMove(c)->dstMemoryIndex == 1 && planner.FindMove(c)->dstOffset == 600);
+}
+
+NRI_TEST(NONE, Defragmenter_PlanDropsUselessCompaction) {
+    Planner planner(1000, 1.0f);
+
+    // 2 x 99 bytes with 128 bytes alignment need 227 bytes, more than the 200 bytes freed
+    uint32_t m0 = planner.Memory(100);
+    uint32_t m1 = planner.Memory(100);
+    planner.Allocation(m0, 99, 128);
+    planner.Allocation(m1, 99, 128);
+
+    planner.Plan();
+
+    TEST_CHECK(planner.moves.empty());
+    TEST_CHECK(planner.newMemories.empty());
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Device  ]
+//============================================================================================================================================================================================
+
+// Buffers placed sparsely into big memory objects get compacted, their content must survive the move
+NRI_TEST(VK, Defragmenter_PreservesContent) {
+    constexpr uint32_t memoryNum = 4;
+    constexpr uint32_t bufferNum = 8;
+    constexpr uint64_t memorySize = 4 * 1024 * 1024;
+    constexpr uint64_t bufferSize = 64 * 1024;
+
+    TestDevice device(context, GraphicsAPI::VK);
+    if (!device)
+        TEST_SKIP("no Vulkan adapter");
+
+    CoreInterface& core = device.core;
+    HelperInterface& helper = device.helper;
+
+    BufferDesc bufferDesc = {};
+    bufferDesc.size = bufferSize;
+    bufferDesc.usage = BufferUsageBits::SHADER_RESOURCE;
+
+    MemoryDesc memoryDesc = {};
+    core.GetBufferMemoryDesc2(*device.device, bufferDesc, MemoryLocation::DEVICE, memoryDesc);
+
+    // Sparse: 2 buffers per 4 Mb memory object
+    Memory* memories[memoryNum] = {};
+    Buffer* buffers[bufferNum] = {};
+    DefragmentationMemoryDesc memoryDescs[memoryNum] = {};
+    DefragmentationResourceDesc resourceDescs[bufferNum] = {};
+
+    for (uint32_t i = 0; i < memoryNum; i++) {
+        AllocateMemoryDesc allocateMemoryDesc = {};
+        allocateMemoryDesc.size = memorySize;
+        allocateMemoryDesc.type = memoryDesc.type;
+
+        TEST_REQUIRE(core.AllocateMemory(*device.device, allocateMemoryDesc, memories[i]) == Result::SUCCESS);
+        memoryDescs[i] = {memories[i], memorySize};
+    }
+
+    for (uint32_t i = 0; i < bufferNum; i++) {
+        uint32_t memoryIndex = i / 2;
+        uint64_t offset = (i % 2) * memorySize / 2;
+
+        TEST_REQUIRE(core.CreatePlacedBuffer(*device.device, memories[memoryIndex], offset, bufferDesc, buffers[i]) == Result::SUCCESS);
+        resourceDescs[i] = {buffers[i], nullptr, memoryIndex, {AccessBits::COPY_DESTINATION, Layout::UNDEFINED, StageBits::COPY}};
+    }
+
+    // Upload a unique pattern per buffer
+    BufferDesc stagingDesc = {};
+    stagingDesc.size = bufferSize * bufferNum;
+
+    Buffer* uploadBuffer = nullptr;
+    Buffer* readbackBuffer = nullptr;
+    TEST_REQUIRE(core.CreateCommittedBuffer(*device.device, MemoryLocation::HOST_UPLOAD, 0.0f, stagingDesc, uploadBuffer) == Result::SUCCESS);
+    TEST_REQUIRE(core.CreateCommittedBuffer(*device.device, MemoryLocation::HOST_READBACK, 0.0f, stagingDesc, readbackBuffer) == Result::SUCCESS);
+
+    uint32_t* upload = (uint32_t*)core.MapBuffer(*uploadBuffer, 0, WHOLE_SIZE);
+    TEST_REQUIRE(upload);
+
+    for (uint32_t i = 0; i < bufferNum * bufferSize / sizeof(uint32_t); i++)
+        upload[i] = i * 2654435761u;
+
+    core.UnmapBuffer(*uploadBuffer);
+
+    CommandAllocator* commandAllocator = nullptr;
+    CommandBuffer* commandBuffer = nullptr;
+    TEST_REQUIRE(core.CreateCommandAllocator(*device.queue, commandAllocator) == Result::SUCCESS);
+    TEST_REQUIRE(core.CreateCommandBuffer(*commandAllocator, commandBuffer) == Result::SUCCESS);
+
+    auto submitAndWait = [&]() {
+        QueueSubmitDesc queueSubmitDesc = {};
+        queueSubmitDesc.commandBuffers = &commandBuffer;
+        queueSubmitDesc.commandBufferNum = 1;
+
+        core.QueueSubmit(*device.queue, queueSubmitDesc);
+        core.QueueWaitIdle(device.queue);
+        core.ResetCommandAllocator(*commandAllocator);
+    };
+
+    core.BeginCommandBuffer(*commandBuffer, nullptr);
+    for (uint32_t i = 0; i < bufferNum; i++)
+        core.CmdCopyBuffer(*commandBuffer, *buffers[i], 0, *uploadBuffer, i * bufferSize, bufferSize);
+    core.EndCommandBuffer(*commandBuffer);
+    submitAndWait();
+
+    // Defragment
+    DefragmenterDesc defragmenterDesc = {};
+    defragmenterDesc.memoryLocation = MemoryLocation::DEVICE;
+    defragmenterDesc.preferredMemorySize = memorySize;
+    defragmenterDesc.maxBytesPerStep = 3 * bufferSize; // several steps
+
+    Defragmenter* defragmenter = nullptr;
+    TEST_REQUIRE(helper.CreateDefragmenter(*device.queue, defragmenterDesc, defragmenter) == Result::SUCCESS);
+
+    DefragmentationDesc defragmentationDesc = {};
+    defragmentationDesc.memories = memoryDescs;
+    defragmentationDesc.memoryNum = memoryNum;
+    defragmentationDesc.resources = resourceDescs;
+    defragmentationDesc.resourceNum = bufferNum;
+
+    TEST_CHECK(helper.PlanDefragmentation(*defragmenter, defragmentationDesc) == bufferNum);
+
+    std::vector<Memory*> newMemories;
+    uint32_t emptiedMemoryNum = 0;
+    uint32_t movedNum = 0;
+
+    for (uint32_t step = 0; step < 64; step++) {
+        DefragmentationResult defragmentationResult = {};
+        TEST_REQUIRE(helper.DefragmentStep(*defragmenter, defragmentationResult) == Result::SUCCESS);
+
+        for (uint32_t i = 0; i < defragmentationResult.moveNum; i++) {
+            const DefragmentationMove& move = defragmentationResult.moves[i];
+
+            core.DestroyBuffer(buffers[move.resourceIndex]);
+            buffers[move.resourceIndex] = move.buffer;
+            movedNum++;
+        }
+
+        newMemories.insert(newMemories.end(), defragmentationResult.memories, defragmentationResult.memories + defragmentationResult.memoryNum);
+
+        for (uint32_t i = 0; i < defragmentationResult.emptiedMemoryNum; i++) {
+            uint32_t memoryIndex = defragmentationResult.emptiedMemoryIndices[i];
+
+            core.FreeMemory(memories[memoryIndex]);
+            memories[memoryIndex] = nullptr;
+            emptiedMemoryNum++;
+        }
+
+        if (defragmentationResult.isFinished)
+            break;
+
+        core.QueueWaitIdle(device.queue);
+    }
+
+    TEST_CHECK(movedNum == bufferNum);
+    TEST_CHECK(emptiedMemoryNum == memoryNum);
+    TEST_CHECK(newMemories.size() == 1);
+
+    helper.DestroyDefragmenter(defragmenter);
+
+    // Read back and compare (new buffers inherit "COPY_DESTINATION")
+    BufferBarrierDesc bufferBarriers[bufferNum] = {};
+    for (uint32_t i = 0; i < bufferNum; i++)
+        bufferBarriers[i] = {buffers[i], {AccessBits::COPY_DESTINATION, StageBits::COPY}, {AccessBits::COPY_SOURCE, StageBits::COPY}};
+
+    BarrierDesc barrierDesc = {};
+    barrierDesc.buffers = bufferBarriers;
+    barrierDesc.bufferNum = bufferNum;
+
+    core.BeginCommandBuffer(*commandBuffer, nullptr);
+    core.CmdBarrier(*commandBuffer, barrierDesc);
+    for (uint32_t i = 0; i < bufferNum; i++)
+        core.CmdCopyBuffer(*commandBuffer, *readbackBuffer, i * bufferSize, *buffers[i], 0, bufferSize);
+    core.EndCommandBuffer(*commandBuffer);
+    submitAndWait();
+
+    const uint32_t* readback = (const uint32_t*)core.MapBuffer(*readbackBuffer, 0, WHOLE_SIZE);
+    TEST_REQUIRE(readback);
+
+    uint32_t mismatchNum = 0;
+    for (uint32_t i = 0; i < bufferNum * bufferSize / sizeof(uint32_t); i++)
+        mismatchNum += readback[i] != i * 2654435761u ? 1 : 0;
+
+    core.UnmapBuffer(*readbackBuffer);
+    TEST_CHECK(mismatchNum == 0);
+
+    for (Buffer* buffer : buffers)
+        core.DestroyBuffer(buffer);
+
+    for (Memory* memory : memories)
+        core.FreeMemory(memory);
+
+    for (Memory* memory : newMemories)
+        core.FreeMemory(memory);
+
+    core.DestroyBuffer(uploadBuffer);
+    core.DestroyBuffer(readbackBuffer);
+    core.DestroyCommandBuffer(commandBuffer);
+    core.DestroyCommandAllocator(commandAllocator);
+}
+
+#pragma endregion
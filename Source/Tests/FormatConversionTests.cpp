@@ -0,0 +1,475 @@
+// © 2026 NVIDIA Corporation
+
+// CPU format conversion and mip generation kernels ("FormatConversion.hpp") against straightforward double precision references
+// UNORM results may differ from the references by 1 (float vs double rounding), halfs must match exactly (round to nearest even)
+
+#include "Tests.h"
+
+#include <cmath>
+
+#include "SharedExternal.h"
+
+using namespace nri;
+
+//============================================================================================================================================================================================
+// References
+
+static double RefSrgbToLinear(double x) {
+    return x <= 0.04045 ? x / 12.92 : pow((x + 0.055) / 1.055, 2.4);
+}
+
+static double RefLinearToSrgb(double x) {
+    return x <= 0.0031308 ? x * 12.92 : 1.055 * pow(x, 1.0 / 2.4) - 0.055;
+}
+
+static uint8_t RefEncodeUnorm8(double x) {
+    return (uint8_t)floor(std::min(std::max(x, 0.0), 1.0) * 255.0 + 0.5);
+}
+
+static uint16_t RefFloatToHalf(float x) {
+    uint16_t sign = std::signbit(x) ? 0x8000 : 0;
+    double a = fabs((double)x);
+
+    if (std::isnan(x))
+        return sign | 0x7E00;
+
+    if (a >= 65520.0) // the first value rounding up to INF
+        return sign | 0x7C00;
+
+    // Denormals (and the smallest normal, if rounded up to it)
+    if (a < ldexp(1.0, -14))
+        return sign | (uint16_t)nearbyint(a * ldexp(1.0, 24));
+
+    int e = 0;
+    double m = frexp(a, &e) * 2.0; // [1; 2)
+    e -= 1;
+
+    uint32_t mantissa = (uint32_t)nearbyint((m - 1.0) * 1024.0);
+    if (mantissa == 1024) {
+        mantissa = 0;
+        e++;
+    }
+
+    return sign | (uint16_t)(((e + 15) << 10) | mantissa);
+}
+
+static float RefHalfToFloat(uint16_t h) {
+    double sign = (h & 0x8000) ? -1.0 : 1.0;
+    uint32_t exponent = (h >> 10) & 0x1F;
+    uint32_t mantissa = h & 0x3FF;
+
+    if (exponent == 0x1F)
+        return mantissa ? NAN : (float)(sign * INFINITY);
+
+    if (!exponent)
+        return (float)(sign * ldexp((double)mantissa, -24));
+
+    return (float)(sign * ldexp(1.0 + mantissa / 1024.0, (int)exponent - 15));
+}
+
+static bool IsNear(uint8_t a, uint8_t b) {
+    return abs(int32_t(a) - int32_t(b)) <= 1;
+}
+
+static bool IsNear(uint16_t a, uint16_t b) {
+    return abs(int32_t(a) - int32_t(b)) <= 1;
+}
+
+static bool IsNear(float a, float b) {
+    return std::fabs(a - b) <= 1e-6f * std::max(1.0f, std::fabs(b));
+}
+
+// Deterministic pseudo-random bytes
+static void FillBytes(uint8_t* data, size_t size, uint32_t seed) {
+    for (size_t i = 0; i < size; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        data[i] = uint8_t(seed >> 24);
+    }
+}
+
+template <typename T>
+static void Convert(std::vector<T>& dst, Format dstFormat, uint32_t dstChannelNum, const void* src, Format srcFormat, uint32_t srcStride, uint32_t width, uint32_t rowNum = 1) {
+    dst.assign(width * rowNum * dstChannelNum, T(0));
+
+    uint64_t dstRowPitch = width * dstChannelNum * sizeof(T);
+    uint64_t srcRowPitch = width * srcStride;
+    ConvertTextureData(dst.data(), dstRowPitch, dstRowPitch * rowNum, dstFormat, src, srcRowPitch, srcRowPitch * rowNum, srcFormat, width, rowNum, 1);
+}
+
+//============================================================================================================================================================================================
+// Conversion
+
+NRI_TEST(NONE, FormatConversion_Supported) {
+    TEST_CHECK(IsFormatConversionSupported(Format::RGBA8_UNORM, Format::RGBA8_UNORM));
+    TEST_CHECK(IsFormatConversionSupported(Format::RGBA32_SFLOAT, Format::RGBA16_SFLOAT));
+    TEST_CHECK(IsFormatConversionSupported(Format::R8_UNORM, Format::BGRA8_SRGB));
+    TEST_CHECK(!IsFormatConversionSupported(Format::RGBA8_UINT, Format::RGBA8_UNORM));
+    TEST_CHECK(!IsFormatConversionSupported(Format::RGBA8_UNORM, Format::BC1_RGBA_UNORM));
+    TEST_CHECK(!IsFormatConversionSupported(Format::R10_G10_B10_A2_UNORM, Format::RGBA8_UNORM));
+
+    TEST_CHECK(IsMipGenerationSupported(Format::RGBA8_SRGB));
+    TEST_CHECK(IsMipGenerationSupported(Format::R32_SFLOAT));
+    TEST_CHECK(!IsMipGenerationSupported(Format::D32_SFLOAT));
+}
+
+// UNORM8 => UNORM8: plain copy and R <=> B swap (SIMD body + scalar tail)
+NRI_TEST(NONE, FormatConversion_Unorm8Swizzle) {
+    constexpr uint32_t PIXEL_NUM = 37;
+
+    uint8_t src[PIXEL_NUM * 4];
+    FillBytes(src, sizeof(src), 1);
+
+    std::vector<uint8_t> dst;
+    Convert(dst, Format::RGBA8_UNORM, 4, src, Format::RGBA8_UNORM, 4, PIXEL_NUM);
+    TEST_CHECK(!memcmp(dst.data(), src, sizeof(src)));
+
+    Convert(dst, Format::BGRA8_UNORM, 4, src, Format::RGBA8_UNORM, 4, PIXEL_NUM);
+
+    uint32_t errorNum = 0;
+    for (uint32_t i = 0; i < PIXEL_NUM; i++) {
+        const uint8_t* s = src + i * 4;
+        const uint8_t* d = dst.data() + i * 4;
+        errorNum += d[0] != s[2] || d[1] != s[1] || d[2] != s[0] || d[3] != s[3];
+    }
+
+    TEST_CHECK(errorNum == 0);
+}
+
+// UNORM8 => UNORM8: sRGB encoding and decoding via LUTs, alpha is linear
+NRI_TEST(NONE, FormatConversion_Unorm8Srgb) {
+    uint8_t src[256 * 4];
+    for (uint32_t i = 0; i < 256; i++) {
+        src[i * 4 + 0] = uint8_t(i);
+        src[i * 4 + 1] = uint8_t(255 - i);
+        src[i * 4 + 2] = uint8_t(i * 7);
+        src[i * 4 + 3] = uint8_t(i);
+    }
+
+    for (bool isToLinear : {true, false}) {
+        std::vector<uint8_t> dst;
+        if (isToLinear)
+            Convert(dst, Format::RGBA8_UNORM, 4, src, Format::RGBA8_SRGB, 4, 256);
+        else
+            Convert(dst, Format::RGBA8_SRGB, 4, src, Format::RGBA8_UNORM, 4, 256);
+
+        uint32_t errorNum = 0;
+        for (uint32_t i = 0; i < 256 * 4; i++) {
+            double x = src[i] / 255.0;
+            uint8_t ref = (i % 4) == 3 ? src[i] : RefEncodeUnorm8(isToLinear ? RefSrgbToLinear(x) : RefLinearToSrgb(x));
+            errorNum += !IsNear(dst[i], ref) || ((i % 4) == 3 && dst[i] != ref);
+        }
+
+        TEST_CHECK(errorNum == 0);
+    }
+}
+
+// UNORM8 => UNORM8: missing channels are "0" (color) and "1" (alpha), extra channels are dropped
+NRI_TEST(NONE, FormatConversion_Unorm8Channels) {
+    constexpr uint32_t PIXEL_NUM = 19;
+
+    uint8_t src[PIXEL_NUM * 4];
+    FillBytes(src, sizeof(src), 2);
+
+    std::vector<uint8_t> dst;
+    Convert(dst, Format::RGBA8_UNORM, 4, src, Format::R8_UNORM, 1, PIXEL_NUM);
+
+    uint32_t errorNum = 0;
+    for (uint32_t i = 0; i < PIXEL_NUM; i++)
+        errorNum += dst[i * 4 + 0] != src[i] || dst[i * 4 + 1] != 0 || dst[i * 4 + 2] != 0 || dst[i * 4 + 3] != 255;
+
+    Convert(dst, Format::RG8_UNORM, 2, src, Format::BGRA8_UNORM, 4, PIXEL_NUM);
+
+    for (uint32_t i = 0; i < PIXEL_NUM; i++)
+        errorNum += dst[i * 2 + 0] != src[i * 4 + 2] || dst[i * 2 + 1] != src[i * 4 + 1];
+
+    TEST_CHECK(errorNum == 0);
+}
+
+// Float values hitting every rounding case of "FloatToHalf": all halfs, midpoints between them (ties), overflow, denormals and specials
+static std::vector<float> GetHalfTestValues() {
+    std::vector<float> values;
+    for (uint32_t h = 0; h < 0x7C00; h++) {
+        float x = RefHalfToFloat((uint16_t)h);
+        float next = RefHalfToFloat((uint16_t)(h + 1));
+        float mid = (float)(((double)x + (double)next) * 0.5);
+
+        values.push_back(x);
+        values.push_back(mid);
+        values.push_back(std::nextafter(mid, 0.0f));
+        values.push_back(std::nextafter(mid, INFINITY));
+    }
+
+    for (float x : {65504.0f, 65519.0f, 65520.0f, 65536.0f, 1e10f, INFINITY, NAN, 1e-10f, 2.9802322e-08f, 5.9604645e-08f, 6.1035156e-05f})
+        values.push_back(x);
+
+    size_t n = values.size();
+    for (size_t i = 0; i < n; i++)
+        values.push_back(-values[i]);
+
+    // Not a multiple of 8, to exercise the scalar tail
+    if (values.size() % 8 == 0)
+        values.push_back(0.5f);
+
+    return values;
+}
+
+// SFLOAT32 => SFLOAT16, the dedicated SIMD path ("ConvertPixelsToHalf") and its scalar fallback
+NRI_TEST(NONE, FormatConversion_FloatToHalf) {
+    std::vector<float> src = GetHalfTestValues();
+    uint32_t width = (uint32_t)src.size();
+
+    std::vector<uint16_t> dst;
+    Convert(dst, Format::R16_SFLOAT, 1, src.data(), Format::R32_SFLOAT, sizeof(float), width);
+
+    uint32_t errorNum = 0;
+    for (uint32_t i = 0; i < width; i++)
+        errorNum += dst[i] != RefFloatToHalf(src[i]);
+
+    TEST_CHECK(errorNum == 0);
+
+    // Rows of 7 channels are too narrow for the SIMD path
+    uint32_t rowNum = width / 7;
+    Convert(dst, Format::R16_SFLOAT, 1, src.data(), Format::R32_SFLOAT, sizeof(float), 7, rowNum);
+
+    errorNum = 0;
+    for (uint32_t i = 0; i < 7 * rowNum; i++)
+        errorNum += dst[i] != RefFloatToHalf(src[i]);
+
+    TEST_CHECK(errorNum == 0);
+}
+
+// SFLOAT16 => SFLOAT32 ("HalfToFloat" via the generic path), every half value
+NRI_TEST(NONE, FormatConversion_HalfToFloat) {
+    std::vector<uint16_t> src(65536);
+    for (uint32_t h = 0; h < 65536; h++)
+        src[h] = (uint16_t)h;
+
+    std::vector<float> dst;
+    Convert(dst, Format::R32_SFLOAT, 1, src.data(), Format::R16_SFLOAT, sizeof(uint16_t), 65536);
+
+    uint32_t errorNum = 0;
+    for (uint32_t h = 0; h < 65536; h++) {
+        float ref = RefHalfToFloat((uint16_t)h);
+        if (std::isnan(ref))
+            errorNum += !std::isnan(dst[h]);
+        else
+            errorNum += memcmp(&dst[h], &ref, sizeof(float)) != 0; // including the sign of zero
+    }
+
+    TEST_CHECK(errorNum == 0);
+}
+
+// Any => any via linear floats: clamping, sRGB encoding, swizzle and rows longer than a conversion chunk
+NRI_TEST(NONE, FormatConversion_Generic) {
+    constexpr uint32_t PIXEL_NUM = 1500; // > "CONVERSION_CHUNK_SIZE / 4"
+
+    std::vector<float> src(PIXEL_NUM * 4);
+    for (uint32_t i = 0; i < PIXEL_NUM * 4; i++)
+        src[i] = float(i % 97) / 80.0f - 0.1f; // [-0.1; 1.1]
+
+    std::vector<uint16_t> half(PIXEL_NUM * 4);
+    for (uint32_t i = 0; i < PIXEL_NUM * 4; i++)
+        half[i] = RefFloatToHalf(src[i]);
+
+    // SFLOAT16 => BGRA8 sRGB
+    std::vector<uint8_t> dst;
+    Convert(dst, Format::BGRA8_SRGB, 4, half.data(), Format::RGBA16_SFLOAT, 8, PIXEL_NUM);
+
+    uint32_t errorNum = 0;
+    for (uint32_t i = 0; i < PIXEL_NUM; i++) {
+        for (uint32_t c = 0; c < 4; c++) {
+            double x = std::min(std::max((double)RefHalfToFloat(half[i * 4 + c]), 0.0), 1.0);
+            uint8_t ref = RefEncodeUnorm8(c == 3 ? x : RefLinearToSrgb(x));
+            uint32_t dstChannel = c == 3 ? 3 : 2 - c;
+            errorNum += !IsNear(dst[i * 4 + dstChannel], ref);
+        }
+    }
+
+    TEST_CHECK(errorNum == 0);
+
+    // BGRA8 sRGB => SFLOAT32 (linear)
+    std::vector<float> back;
+    Convert(back, Format::RGBA32_SFLOAT, 4, dst.data(), Format::BGRA8_SRGB, 4, PIXEL_NUM);
+
+    errorNum = 0;
+    for (uint32_t i = 0; i < PIXEL_NUM; i++) {
+        for (uint32_t c = 0; c < 4; c++) {
+            uint32_t srcChannel = c == 3 ? 3 : 2 - c;
+            double x = dst[i * 4 + srcChannel] / 255.0;
+            float ref = (float)(c == 3 ? x : RefSrgbToLinear(x));
+            errorNum += !IsNear(back[i * 4 + c], ref);
+        }
+    }
+
+    TEST_CHECK(errorNum == 0);
+}
+
+//============================================================================================================================================================================================
+// Mip generation
+
+// Decodes a texel of the test formats to linear RGBA (double precision)
+static void RefDecode(const uint8_t* texel, Format format, double rgba[4]) {
+    rgba[0] = rgba[1] = rgba[2] = 0.0;
+    rgba[3] = 1.0;
+
+    switch (format) {
+        case Format::RGBA8_UNORM:
+        case Format::RGBA8_SRGB:
+            for (uint32_t c = 0; c < 4; c++) {
+                double x = texel[c] / 255.0;
+                rgba[c] = format == Format::RGBA8_SRGB && c < 3 ? RefSrgbToLinear(x) : x;
+            }
+            break;
+        case Format::RG8_UNORM:
+            rgba[0] = texel[0] / 255.0;
+            rgba[1] = texel[1] / 255.0;
+            break;
+        case Format::RGBA16_SFLOAT:
+            for (uint32_t c = 0; c < 4; c++) {
+                uint16_t h = 0;
+                memcpy(&h, texel + c * 2, 2);
+                rgba[c] = RefHalfToFloat(h);
+            }
+            break;
+        case Format::R32_SFLOAT:
+        case Format::RGBA32_SFLOAT:
+            for (uint32_t c = 0; c < (format == Format::R32_SFLOAT ? 1u : 4u); c++) {
+                float x = 0.0f;
+                memcpy(&x, texel + c * 4, 4);
+                rgba[c] = x;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+// Checks an encoded texel against a linear RGBA reference
+static bool RefCheck(const uint8_t* texel, Format format, const double rgba[4]) {
+    bool isOk = true;
+
+    switch (format) {
+        case Format::RGBA8_UNORM:
+        case Format::RGBA8_SRGB:
+            for (uint32_t c = 0; c < 4; c++)
+                isOk = isOk && IsNear(texel[c], RefEncodeUnorm8(format == Format::RGBA8_SRGB && c < 3 ? RefLinearToSrgb(rgba[c]) : rgba[c]));
+            break;
+        case Format::RG8_UNORM:
+            for (uint32_t c = 0; c < 2; c++)
+                isOk = isOk && IsNear(texel[c], RefEncodeUnorm8(rgba[c]));
+            break;
+        case Format::RGBA16_SFLOAT:
+            for (uint32_t c = 0; c < 4; c++) {
+                uint16_t h = 0;
+                memcpy(&h, texel + c * 2, 2);
+                isOk = isOk && IsNear(h, RefFloatToHalf((float)rgba[c])); // the average is rounded twice (float, then half)
+            }
+            break;
+        case Format::R32_SFLOAT:
+        case Format::RGBA32_SFLOAT:
+            for (uint32_t c = 0; c < (format == Format::R32_SFLOAT ? 1u : 4u); c++) {
+                float x = 0.0f;
+                memcpy(&x, texel + c * 4, 4);
+                isOk = isOk && IsNear(x, (float)rgba[c]);
+            }
+            break;
+        default:
+            isOk = false;
+            break;
+    }
+
+    return isOk;
+}
+
+// 2x2 box filter with clamped odd edges, normal maps are renormalized (UNORM: "xyz * 0.5 + 0.5", 2 channels: "Z" is reconstructed)
+static uint32_t CheckMip(Format format, uint32_t stride, Dim_t srcWidth, Dim_t srcHeight, bool isNormalMap, uint32_t seed) {
+    uint32_t srcRowPitch = srcWidth * stride;
+    std::vector<uint8_t> src(srcRowPitch * srcHeight);
+    FillBytes(src.data(), src.size(), seed);
+
+    // Keep float inputs finite and in a sane range
+    if (format == Format::RGBA16_SFLOAT) {
+        for (size_t i = 0; i < src.size(); i += 2) {
+            uint16_t h = RefFloatToHalf(src[i] / 64.0f - 1.0f);
+            memcpy(&src[i], &h, 2);
+        }
+    } else if (format == Format::R32_SFLOAT || format == Format::RGBA32_SFLOAT) {
+        for (size_t i = 0; i < src.size(); i += 4) {
+            float x = src[i] / 64.0f - 1.0f;
+            memcpy(&src[i], &x, 4);
+        }
+    }
+
+    Dim_t w = (Dim_t)std::max(srcWidth >> 1, 1);
+    Dim_t h = (Dim_t)std::max(srcHeight >> 1, 1);
+    uint32_t dstRowPitch = w * stride + 4; // padded
+    std::vector<uint8_t> dst(dstRowPitch * h, 0xCD);
+
+    GenerateMip(dst.data(), dstRowPitch, src.data(), srcRowPitch, format, srcWidth, srcHeight, isNormalMap);
+
+    bool isUnorm = format == Format::RGBA8_UNORM || format == Format::RG8_UNORM;
+
+    uint32_t errorNum = 0;
+    for (Dim_t y = 0; y < h; y++) {
+        for (Dim_t x = 0; x < w; x++) {
+            double sum[4] = {};
+            for (uint32_t i = 0; i < 4; i++) {
+                uint32_t sx = std::min(x * 2u + (i & 1), srcWidth - 1u);
+                uint32_t sy = std::min(y * 2u + (i >> 1), srcHeight - 1u);
+
+                double tap[4];
+                RefDecode(src.data() + sy * srcRowPitch + sx * stride, format, tap);
+
+                if (isNormalMap) {
+                    if (isUnorm) {
+                        for (uint32_t c = 0; c < 3; c++)
+                            tap[c] = tap[c] * 2.0 - 1.0;
+                    }
+
+                    if (format == Format::RG8_UNORM)
+                        tap[2] = sqrt(std::max(1.0 - tap[0] * tap[0] - tap[1] * tap[1], 0.0));
+                }
+
+                for (uint32_t c = 0; c < 4; c++)
+                    sum[c] += tap[c] * 0.25;
+            }
+
+            if (isNormalMap) {
+                double len = sqrt(sum[0] * sum[0] + sum[1] * sum[1] + sum[2] * sum[2]);
+                for (uint32_t c = 0; c < 3; c++) {
+                    sum[c] = len > 0.0 ? sum[c] / len : 0.0;
+                    if (isUnorm)
+                        sum[c] = sum[c] * 0.5 + 0.5;
+                }
+            }
+
+            errorNum += !RefCheck(dst.data() + y * dstRowPitch + x * stride, format, sum);
+        }
+
+        // Padding is untouched
+        errorNum += dst[y * dstRowPitch + w * stride] != 0xCD;
+    }
+
+    return errorNum;
+}
+
+NRI_TEST(NONE, MipGeneration_Box) {
+    TEST_CHECK(CheckMip(Format::RGBA8_UNORM, 4, 8, 8, false, 10) == 0);
+    TEST_CHECK(CheckMip(Format::RGBA8_SRGB, 4, 16, 4, false, 11) == 0);
+    TEST_CHECK(CheckMip(Format::RGBA16_SFLOAT, 8, 8, 6, false, 12) == 0);
+    TEST_CHECK(CheckMip(Format::R32_SFLOAT, 4, 4, 4, false, 13) == 0);
+}
+
+NRI_TEST(NONE, MipGeneration_OddAndThin) {
+    TEST_CHECK(CheckMip(Format::RGBA8_UNORM, 4, 5, 3, false, 20) == 0);
+    TEST_CHECK(CheckMip(Format::RGBA8_SRGB, 4, 7, 1, false, 21) == 0);
+    TEST_CHECK(CheckMip(Format::RGBA16_SFLOAT, 8, 1, 9, false, 22) == 0);
+    TEST_CHECK(CheckMip(Format::R32_SFLOAT, 4, 3, 1, false, 23) == 0);
+    TEST_CHECK(CheckMip(Format::RGBA32_SFLOAT, 4 * 4, 1, 1, false, 24) == 0);
+}
+
+NRI_TEST(NONE, MipGeneration_NormalMap) {
+    TEST_CHECK(CheckMip(Format::RGBA8_UNORM, 4, 8, 8, true, 30) == 0);
+    TEST_CHECK(CheckMip(Format::RG8_UNORM, 2, 9, 5, true, 31) == 0);
+    TEST_CHECK(CheckMip(Format::RGBA32_SFLOAT, 4 * 4, 6, 6, true, 32) == 0);
+}
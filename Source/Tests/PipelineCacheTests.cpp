@@ -0,0 +1,90 @@
+// © 2026 NVIDIA Corporation
+
+// Persistent pipeline cache store: a cold run populates the file, a warm run must be served from it
+
+#include "Tests.h"
+
+using namespace nri;
+
+constexpr const char* CACHE_FILE_NAME = "NRI_Tests_PipelineCache.bin";
+
+// Creates a pipeline using the store cache, saves the store and returns the feedback flags of the pipeline
+static PipelineFeedbackBits CreatePipelineAndSave(TestContext& context, TestDevice& device, PipelineCacheStoreStats& stats) {
+    CoreInterface& core = device.core;
+    HelperInterface& helper = device.helper;
+
+    PipelineFeedbackBits flags = PipelineFeedbackBits::NONE;
+
+    PipelineCacheStoreDesc pipelineCacheStoreDesc = {};
+    pipelineCacheStoreDesc.fileName = CACHE_FILE_NAME;
+
+    PipelineCacheStore* pipelineCacheStore = nullptr;
+    TEST_CHECK(helper.CreatePipelineCacheStore(*device.device, pipelineCacheStoreDesc, pipelineCacheStore) == Result::SUCCESS);
+    if (!pipelineCacheStore)
+        return flags;
+
+    PipelineLayoutDesc pipelineLayoutDesc = {};
+    pipelineLayoutDesc.shaderStages = StageBits::COMPUTE_SHADER;
+
+    PipelineLayout* pipelineLayout = nullptr;
+    TEST_CHECK(core.CreatePipelineLayout(*device.device, pipelineLayoutDesc, pipelineLayout) == Result::SUCCESS);
+
+    if (pipelineLayout) {
+        ComputePipelineDesc computePipelineDesc = {};
+        computePipelineDesc.pipelineLayout = pipelineLayout;
+        computePipelineDesc.shader = {StageBits::COMPUTE_SHADER, EMPTY_COMPUTE_SHADER_SPIRV, sizeof(EMPTY_COMPUTE_SHADER_SPIRV)};
+        computePipelineDesc.cache = helper.GetPipelineCacheStoreCache(*pipelineCacheStore, 0);
+
+        Pipeline* pipeline = nullptr;
+        TEST_CHECK(core.CreateComputePipeline(*device.device, computePipelineDesc, pipeline) == Result::SUCCESS);
+
+        if (pipeline) {
+            PipelineFeedback pipelineFeedback = {};
+            if (helper.GetPipelineFeedback(*pipeline, pipelineFeedback) == Result::SUCCESS)
+                flags = pipelineFeedback.flags;
+
+            core.DestroyPipeline(pipeline);
+        }
+
+        core.DestroyPipelineLayout(pipelineLayout);
+    }
+
+    TEST_CHECK(helper.SavePipelineCacheStore(*pipelineCacheStore, false) == Result::SUCCESS);
+    helper.GetPipelineCacheStoreStats(*pipelineCacheStore, stats);
+    helper.DestroyPipelineCacheStore(pipelineCacheStore);
+
+    return flags;
+}
+
+NRI_TEST(VK, PipelineCacheStore_WarmRunHitsCache) {
+    TestDevice device(context, GraphicsAPI::VK);
+    if (!device)
+        TEST_SKIP("no Vulkan adapter");
+
+    remove(CACHE_FILE_NAME);
+
+    // Cold: nothing to load, the pipeline gets compiled and saved
+    PipelineCacheStoreStats coldStats = {};
+    PipelineFeedbackBits coldFlags = CreatePipelineAndSave(context, device, coldStats);
+
+    TEST_CHECK(coldStats.loadedSize == 0);
+    TEST_CHECK(!coldStats.isRejected);
+    TEST_CHECK(coldStats.saveNum == 1);
+    TEST_CHECK(coldStats.savedSize != 0);
+
+    // Warm: the file is accepted and the pipeline is served from it
+    PipelineCacheStoreStats warmStats = {};
+    PipelineFeedbackBits warmFlags = CreatePipelineAndSave(context, device, warmStats);
+
+    TEST_CHECK(warmStats.loadedSize == coldStats.savedSize);
+    TEST_CHECK(!warmStats.isRejected);
+    TEST_CHECK(warmStats.saveNum + warmStats.skippedSaveNum == 1); // skipped if the driver serializes the same content
+
+    remove(CACHE_FILE_NAME);
+
+    if (!(coldFlags & PipelineFeedbackBits::VALID) || !(warmFlags & PipelineFeedbackBits::VALID))
+        TEST_SKIP("pipeline creation feedback is not supported, cache hits can't be observed");
+
+    TEST_CHECK(!(coldFlags & PipelineFeedbackBits::CACHE_HIT));
+    TEST_CHECK(warmFlags & PipelineFeedbackBits::CACHE_HIT);
+}
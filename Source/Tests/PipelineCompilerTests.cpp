@@ -0,0 +1,215 @@
+// © 2026 NVIDIA Corporation
+
+// Asynchronous pipeline compiler on top of NONE: handles, slot reuse and lock-free polling from many threads
+
+#include "Tests.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace nri;
+
+constexpr uint32_t CLIENT_THREAD_NUM = 4;
+constexpr uint32_t PIPELINES_PER_THREAD = 64;
+constexpr uint32_t TIMEOUT_MS = 5000;
+
+struct PipelineCompilerTest {
+    inline PipelineCompilerTest(TestContext& context, uint32_t threadNum, uint32_t pipelineMaxNum, uint32_t injectedLatency)
+        : device(context, GraphicsAPI::NONE) {
+        if (!device)
+            return;
+
+        PipelineLayoutDesc pipelineLayoutDesc = {};
+        pipelineLayoutDesc.shaderStages = StageBits::COMPUTE_SHADER;
+
+        if (device.core.CreatePipelineLayout(*device.device, pipelineLayoutDesc, pipelineLayout) != Result::SUCCESS)
+            return;
+
+        PipelineCompilerDesc pipelineCompilerDesc = {};
+        pipelineCompilerDesc.threadNum = threadNum;
+        pipelineCompilerDesc.pipelineMaxNum = pipelineMaxNum;
+        pipelineCompilerDesc.injectedLatency = injectedLatency;
+        pipelineCompilerDesc.CompletionCallback = CompletionCallback;
+        pipelineCompilerDesc.userArg = this;
+
+        device.helper.CreatePipelineCompiler(*device.device, pipelineCompilerDesc, pipelineCompiler);
+    }
+
+    inline ~PipelineCompilerTest() {
+        DestroyCompiler();
+
+        if (pipelineLayout)
+            device.core.DestroyPipelineLayout(pipelineLayout);
+    }
+
+    static void NRI_CALL CompletionCallback(uint32_t, Result result, Pipeline* pipeline, void* userArg) {
+        PipelineCompilerTest& test = *(PipelineCompilerTest*)userArg;
+
+        if (result == Result::SUCCESS && pipeline)
+            test.completedNum++;
+    }
+
+    // Waits for running compilations, i.e. all callbacks have been called
+    inline void DestroyCompiler() {
+        if (pipelineCompiler)
+            device.helper.DestroyPipelineCompiler(pipelineCompiler);
+
+        pipelineCompiler = nullptr;
+    }
+
+    inline uint32_t Compile() {
+        ComputePipelineDesc computePipelineDesc = {};
+        computePipelineDesc.pipelineLayout = pipelineLayout;
+        computePipelineDesc.shader = {StageBits::COMPUTE_SHADER, EMPTY_COMPUTE_SHADER_SPIRV, sizeof(EMPTY_COMPUTE_SHADER_SPIRV)};
+
+        return device.helper.CompileComputePipelineAsync(*pipelineCompiler, computePipelineDesc);
+    }
+
+    inline bool WaitForReady(uint32_t pipelineHandle) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(TIMEOUT_MS);
+        while (!device.helper.IsPipelineReady(*pipelineCompiler, pipelineHandle)) {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+
+    TestDevice device;
+    PipelineLayout* pipelineLayout = nullptr;
+    PipelineCompiler* pipelineCompiler = nullptr;
+    std::atomic_uint32_t completedNum = {0};
+};
+
+NRI_TEST(NONE, PipelineCompiler_ConcurrentCompileAcquireRelease) {
+    PipelineCompilerTest test(context, 4, CLIENT_THREAD_NUM * PIPELINES_PER_THREAD, 0);
+    TEST_REQUIRE(test.pipelineCompiler);
+
+    // Client threads compile, poll and release concurrently with each other and with the workers
+    std::atomic_uint32_t errorNum = {0};
+    Pipeline* substitute = (Pipeline*)&test; // never dereferenced
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < CLIENT_THREAD_NUM; t++) {
+        threads.emplace_back([&]() {
+            uint32_t handles[PIPELINES_PER_THREAD] = {};
+            for (uint32_t i = 0; i < PIPELINES_PER_THREAD; i++) {
+                handles[i] = test.Compile();
+                if (!handles[i])
+                    errorNum++;
+            }
+
+            for (uint32_t i = 0; i < PIPELINES_PER_THREAD; i++) {
+                if (!handles[i] || !test.WaitForReady(handles[i])) {
+                    errorNum++;
+                    continue;
+                }
+
+                Pipeline* pipeline = test.device.helper.AcquirePipeline(*test.pipelineCompiler, handles[i], substitute);
+                if (!pipeline || pipeline == substitute)
+                    errorNum++;
+
+                // Release a half, the rest is destroyed with the compiler
+                if (i % 2 == 0) {
+                    test.device.helper.ReleasePipeline(*test.pipelineCompiler, handles[i]);
+
+                    if (test.device.helper.IsPipelineReady(*test.pipelineCompiler, handles[i]))
+                        errorNum++;
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    test.DestroyCompiler();
+
+    TEST_CHECK(errorNum == 0);
+    TEST_CHECK(test.completedNum == CLIENT_THREAD_NUM * PIPELINES_PER_THREAD);
+}
+
+NRI_TEST(NONE, PipelineCompiler_ReleaseInvalidatesHandle) {
+    PipelineCompilerTest test(context, 1, 1, 0);
+    TEST_REQUIRE(test.pipelineCompiler);
+
+    Pipeline* substitute = (Pipeline*)&test; // never dereferenced
+
+    uint32_t a = test.Compile();
+    TEST_REQUIRE(a && test.WaitForReady(a));
+    TEST_CHECK(test.device.helper.AcquirePipeline(*test.pipelineCompiler, a, substitute) != substitute);
+
+    test.device.helper.ReleasePipeline(*test.pipelineCompiler, a);
+    test.device.helper.ReleasePipeline(*test.pipelineCompiler, a); // ignored
+
+    TEST_CHECK(!test.device.helper.IsPipelineReady(*test.pipelineCompiler, a));
+    TEST_CHECK(test.device.helper.AcquirePipeline(*test.pipelineCompiler, a, substitute) == substitute);
+
+    // The slot is reused, the stale handle stays invalid
+    uint32_t b = test.Compile();
+    TEST_REQUIRE(b && test.WaitForReady(b));
+    TEST_CHECK(b != a);
+    TEST_CHECK(!test.device.helper.IsPipelineReady(*test.pipelineCompiler, a));
+    TEST_CHECK(test.device.helper.AcquirePipeline(*test.pipelineCompiler, b, substitute) != substitute);
+
+    // Invalid handles
+    TEST_CHECK(!test.device.helper.IsPipelineReady(*test.pipelineCompiler, 0));
+    TEST_CHECK(test.device.helper.AcquirePipeline(*test.pipelineCompiler, ~0u, substitute) == substitute);
+}
+
+NRI_TEST(NONE, PipelineCompiler_PipelineMaxNum) {
+    PipelineCompilerTest test(context, 1, 2, 0);
+    TEST_REQUIRE(test.pipelineCompiler);
+
+    uint32_t a = test.Compile();
+    uint32_t b = test.Compile();
+    TEST_REQUIRE(a && b);
+    TEST_CHECK(test.Compile() == 0);
+
+    TEST_REQUIRE(test.WaitForReady(a));
+    test.device.helper.ReleasePipeline(*test.pipelineCompiler, a);
+
+    uint32_t c = test.Compile();
+    TEST_CHECK(c != 0);
+    TEST_CHECK(test.Compile() == 0);
+}
+
+NRI_TEST(NONE, PipelineCompiler_ReleasePendingDropsRequest) {
+    PipelineCompilerTest test(context, 1, 2, 50);
+    TEST_REQUIRE(test.pipelineCompiler);
+
+    // "A" is compiling or queued, "B" is queued behind it
+    uint32_t a = test.Compile();
+    uint32_t b = test.Compile();
+    TEST_REQUIRE(a && b);
+
+    test.device.helper.ReleasePipeline(*test.pipelineCompiler, a);
+    test.device.helper.ReleasePipeline(*test.pipelineCompiler, b);
+
+    TEST_CHECK(!test.device.helper.IsPipelineReady(*test.pipelineCompiler, a));
+    TEST_CHECK(!test.device.helper.IsPipelineReady(*test.pipelineCompiler, b));
+
+    // Both slots are freed by the worker
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(TIMEOUT_MS);
+    uint32_t c = 0;
+    uint32_t d = 0;
+    while ((!c || !d) && std::chrono::steady_clock::now() < deadline) {
+        if (!c)
+            c = test.Compile();
+        else if (!d)
+            d = test.Compile();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    TEST_REQUIRE(c && d);
+    TEST_CHECK(test.WaitForReady(c) && test.WaitForReady(d));
+
+    test.DestroyCompiler();
+
+    // No callbacks for dropped requests
+    TEST_CHECK(test.completedNum == 2);
+}
@@ -0,0 +1,124 @@
+// © 2026 NVIDIA Corporation
+
+// Pipeline libraries ("USE_LIBRARIES"): pipelines sharing states share libraries, libraries of a pipeline layout are released with it
+
+#include "Tests.h"
+
+using namespace nri;
+
+// Hand-assembled SPIR-V 1.0 of empty vertex and fragment shaders ("main")
+constexpr uint32_t EMPTY_VERTEX_SHADER_SPIRV[] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000005, 0x00000000, // header (bound = 5)
+    0x00020011, 0x00000001,                                     // OpCapability Shader
+    0x0003000E, 0x00000000, 0x00000001,                         // OpMemoryModel Logical GLSL450
+    0x0005000F, 0x00000000, 0x00000001, 0x6E69616D, 0x00000000, // OpEntryPoint Vertex %1 "main"
+    0x00020013, 0x00000002,                                     // %2 = OpTypeVoid
+    0x00030021, 0x00000003, 0x00000002,                         // %3 = OpTypeFunction %2
+    0x00050036, 0x00000002, 0x00000001, 0x00000000, 0x00000003, // %1 = OpFunction %2 None %3
+    0x000200F8, 0x00000004,                                     // %4 = OpLabel
+    0x000100FD,                                                 // OpReturn
+    0x00010038,                                                 // OpFunctionEnd
+};
+
+constexpr uint32_t EMPTY_FRAGMENT_SHADER_SPIRV[] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000005, 0x00000000, // header (bound = 5)
+    0x00020011, 0x00000001,                                     // OpCapability Shader
+    0x0003000E, 0x00000000, 0x00000001,                         // OpMemoryModel Logical GLSL450
+    0x0005000F, 0x00000004, 0x00000001, 0x6E69616D, 0x00000000, // OpEntryPoint Fragment %1 "main"
+    0x00030010, 0x00000001, 0x00000007,                         // OpExecutionMode %1 OriginUpperLeft
+    0x00020013, 0x00000002,                                     // %2 = OpTypeVoid
+    0x00030021, 0x00000003, 0x00000002,                         // %3 = OpTypeFunction %2
+    0x00050036, 0x00000002, 0x00000001, 0x00000000, 0x00000003, // %1 = OpFunction %2 None %3
+    0x000200F8, 0x00000004,                                     // %4 = OpLabel
+    0x000100FD,                                                 // OpReturn
+    0x00010038,                                                 // OpFunctionEnd
+};
+
+static Pipeline* CreatePipeline(TestDevice& device, PipelineLayout& pipelineLayout, bool blendEnabled) {
+    const ShaderDesc shaders[] = {
+        {StageBits::VERTEX_SHADER, EMPTY_VERTEX_SHADER_SPIRV, sizeof(EMPTY_VERTEX_SHADER_SPIRV)},
+        {StageBits::FRAGMENT_SHADER, EMPTY_FRAGMENT_SHADER_SPIRV, sizeof(EMPTY_FRAGMENT_SHADER_SPIRV)},
+    };
+
+    ColorAttachmentDesc colorAttachmentDesc = {};
+    colorAttachmentDesc.format = Format::RGBA8_UNORM;
+    colorAttachmentDesc.colorWriteMask = ColorWriteBits::RGBA;
+    colorAttachmentDesc.blendEnabled = blendEnabled;
+    colorAttachmentDesc.colorBlend = {BlendFactor::SRC_ALPHA, BlendFactor::ONE_MINUS_SRC_ALPHA, BlendOp::ADD};
+    colorAttachmentDesc.alphaBlend = {BlendFactor::ONE, BlendFactor::ZERO, BlendOp::ADD};
+
+    GraphicsPipelineDesc graphicsPipelineDesc = {};
+    graphicsPipelineDesc.pipelineLayout = &pipelineLayout;
+    graphicsPipelineDesc.inputAssembly.topology = Topology::TRIANGLE_LIST;
+    graphicsPipelineDesc.rasterization.fillMode = FillMode::SOLID;
+    graphicsPipelineDesc.rasterization.cullMode = CullMode::NONE;
+    graphicsPipelineDesc.outputMerger.colors = &colorAttachmentDesc;
+    graphicsPipelineDesc.outputMerger.colorNum = 1;
+    graphicsPipelineDesc.shaders = shaders;
+    graphicsPipelineDesc.shaderNum = 2;
+    graphicsPipelineDesc.flags = GraphicsPipelineBits::USE_LIBRARIES;
+
+    Pipeline* pipeline = nullptr;
+    device.core.CreateGraphicsPipeline(*device.device, graphicsPipelineDesc, pipeline);
+
+    return pipeline;
+}
+
+NRI_TEST(VK, PipelineLibrary_SharedBetweenPipelines) {
+    TestDevice device(context, GraphicsAPI::VK);
+    if (!device)
+        TEST_SKIP("no Vulkan adapter");
+
+    if (!device.core.GetDeviceDesc(*device.device).features.graphicsPipelineLibrary)
+        TEST_SKIP("no 'graphicsPipelineLibrary' support");
+
+    PipelineLayoutDesc pipelineLayoutDesc = {};
+    pipelineLayoutDesc.shaderStages = StageBits::VERTEX_SHADER | StageBits::FRAGMENT_SHADER;
+
+    PipelineLayout* pipelineLayout = nullptr;
+    TEST_REQUIRE(device.core.CreatePipelineLayout(*device.device, pipelineLayoutDesc, pipelineLayout) == Result::SUCCESS);
+
+    PipelineLibraryStats before = {};
+    device.helper.GetPipelineLibraryStats(*device.device, before);
+
+    // Vertex input, pre-rasterization shaders, fragment shader and fragment output
+    Pipeline* opaque = CreatePipeline(device, *pipelineLayout, false);
+    TEST_CHECK(opaque);
+
+    PipelineLibraryStats stats = {};
+    device.helper.GetPipelineLibraryStats(*device.device, stats);
+
+    TEST_CHECK(stats.missNum - before.missNum == 4);
+    TEST_CHECK(stats.hitNum - before.hitNum == 0);
+    TEST_CHECK(stats.libraryNum - before.libraryNum == 4);
+
+    // Only the fragment output interface differs
+    Pipeline* blended = CreatePipeline(device, *pipelineLayout, true);
+    TEST_CHECK(blended);
+
+    device.helper.GetPipelineLibraryStats(*device.device, stats);
+
+    TEST_CHECK(stats.missNum - before.missNum == 5);
+    TEST_CHECK(stats.hitNum - before.hitNum == 3);
+    TEST_CHECK(stats.libraryNum - before.libraryNum == 5);
+
+    // An identical pipeline doesn't compile anything
+    Pipeline* blendedAgain = CreatePipeline(device, *pipelineLayout, true);
+    TEST_CHECK(blendedAgain);
+
+    device.helper.GetPipelineLibraryStats(*device.device, stats);
+
+    TEST_CHECK(stats.missNum - before.missNum == 5);
+    TEST_CHECK(stats.hitNum - before.hitNum == 7);
+
+    for (Pipeline* pipeline : {opaque, blended, blendedAgain}) {
+        if (pipeline)
+            device.core.DestroyPipeline(pipeline);
+    }
+
+    // Shader libraries depend on the layout, vertex input and fragment output libraries stay cached
+    device.core.DestroyPipelineLayout(pipelineLayout);
+    device.helper.GetPipelineLibraryStats(*device.device, stats);
+
+    TEST_CHECK(stats.libraryNum - before.libraryNum == 2);
+}
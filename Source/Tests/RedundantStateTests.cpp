@@ -0,0 +1,137 @@
+// © 2026 NVIDIA Corporation
+
+// Redundant state filtering: elided binds and explicit invalidation (VK), no-op entry points elsewhere
+
+#include "Tests.h"
+
+using namespace nri;
+
+struct RedundantStateTest {
+    inline RedundantStateTest(TestContext& context, GraphicsAPI graphicsAPI)
+        : device(context, graphicsAPI) {
+        if (!device)
+            return;
+
+        PipelineLayoutDesc pipelineLayoutDesc = {};
+        pipelineLayoutDesc.shaderStages = StageBits::COMPUTE_SHADER;
+
+        if (device.core.CreatePipelineLayout(*device.device, pipelineLayoutDesc, pipelineLayout) != Result::SUCCESS)
+            return;
+
+        ComputePipelineDesc computePipelineDesc = {};
+        computePipelineDesc.pipelineLayout = pipelineLayout;
+        computePipelineDesc.shader = {StageBits::COMPUTE_SHADER, EMPTY_COMPUTE_SHADER_SPIRV, sizeof(EMPTY_COMPUTE_SHADER_SPIRV)};
+
+        if (device.core.CreateComputePipeline(*device.device, computePipelineDesc, pipeline) != Result::SUCCESS)
+            return;
+
+        if (device.core.CreateCommandAllocator(*device.queue, commandAllocator) != Result::SUCCESS)
+            return;
+
+        device.core.CreateCommandBuffer(*commandAllocator, commandBuffer);
+    }
+
+    inline ~RedundantStateTest() {
+        if (commandBuffer)
+            device.core.DestroyCommandBuffer(commandBuffer);
+
+        if (commandAllocator)
+            device.core.DestroyCommandAllocator(commandAllocator);
+
+        if (pipeline)
+            device.core.DestroyPipeline(pipeline);
+
+        if (pipelineLayout)
+            device.core.DestroyPipelineLayout(pipelineLayout);
+    }
+
+    // Records "body" and returns the stats of this recording only
+    template <typename F>
+    inline RedundantCommandStats Record(F&& body) {
+        RedundantCommandStats before = {};
+        device.helper.GetRedundantCommandStats(*device.device, before);
+
+        device.core.ResetCommandAllocator(*commandAllocator);
+        device.core.BeginCommandBuffer(*commandBuffer, nullptr);
+        body();
+        device.core.EndCommandBuffer(*commandBuffer);
+
+        RedundantCommandStats after = {};
+        device.helper.GetRedundantCommandStats(*device.device, after);
+
+        RedundantCommandStats delta = {};
+        delta.pipelineNum = after.pipelineNum - before.pipelineNum;
+        delta.pipelineLayoutNum = after.pipelineLayoutNum - before.pipelineLayoutNum;
+
+        return delta;
+    }
+
+    inline void Bind() {
+        device.core.CmdSetPipelineLayout(*commandBuffer, BindPoint::COMPUTE, *pipelineLayout);
+        device.core.CmdSetPipeline(*commandBuffer, *pipeline);
+    }
+
+    TestDevice device;
+    PipelineLayout* pipelineLayout = nullptr;
+    Pipeline* pipeline = nullptr;
+    CommandAllocator* commandAllocator = nullptr;
+    CommandBuffer* commandBuffer = nullptr;
+};
+
+NRI_TEST(NONE, RedundantState_NotFiltered) {
+    RedundantStateTest test(context, GraphicsAPI::NONE);
+    TEST_REQUIRE(test.commandBuffer);
+
+    RedundantCommandStats stats = test.Record([&]() {
+        test.Bind();
+        test.Bind();
+        test.device.helper.InvalidateCommandBufferState(*test.commandBuffer);
+        test.Bind();
+    });
+
+    TEST_CHECK(stats.pipelineNum == 0);
+    TEST_CHECK(stats.pipelineLayoutNum == 0);
+}
+
+NRI_TEST(VK, RedundantState_RepeatedBindsAreElided) {
+    RedundantStateTest test(context, GraphicsAPI::VK);
+    if (!test.device)
+        TEST_SKIP("no Vulkan adapter");
+
+    TEST_REQUIRE(test.commandBuffer);
+
+    RedundantCommandStats stats = test.Record([&]() {
+        test.Bind();
+        test.Bind();
+        test.Bind();
+    });
+
+    TEST_CHECK(stats.pipelineNum == 2);
+    TEST_CHECK(stats.pipelineLayoutNum == 2);
+
+    // "BeginCommandBuffer" forgets everything
+    stats = test.Record([&]() {
+        test.Bind();
+    });
+
+    TEST_CHECK(stats.pipelineNum == 0);
+    TEST_CHECK(stats.pipelineLayoutNum == 0);
+}
+
+NRI_TEST(VK, RedundantState_InvalidateCommandBufferState) {
+    RedundantStateTest test(context, GraphicsAPI::VK);
+    if (!test.device)
+        TEST_SKIP("no Vulkan adapter");
+
+    TEST_REQUIRE(test.commandBuffer);
+
+    // Native commands could have changed the state, i.e. nothing can be elided after invalidation
+    RedundantCommandStats stats = test.Record([&]() {
+        test.Bind();
+        test.device.helper.InvalidateCommandBufferState(*test.commandBuffer);
+        test.Bind();
+    });
+
+    TEST_CHECK(stats.pipelineNum == 0);
+    TEST_CHECK(stats.pipelineLayoutNum == 0);
+}
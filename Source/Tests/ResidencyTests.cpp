@@ -0,0 +1,223 @@
+// © 2026 NVIDIA Corporation
+
+// Residency manager policies on top of the NONE fake budget ("noneVideoMemoryBudget"), fully deterministic
+
+#include "Tests.h"
+
+using namespace nri;
+
+constexpr uint64_t BUDGET = 1000;
+constexpr uint64_t SIZE = 300;
+
+struct ResidencyTest {
+    inline ResidencyTest(TestContext& context, uint64_t budget, bool enableValidation = false)
+        : device(context, GraphicsAPI::NONE, enableValidation, budget) {
+        if (!device)
+            return;
+
+        ResidencyManagerDesc residencyManagerDesc = {};
+        residencyManagerDesc.memoryLocation = MemoryLocation::DEVICE;
+
+        device.helper.CreateResidencyManager(*device.device, residencyManagerDesc, residencyManager);
+
+        // A valid memory type (validation requires it to be queried first)
+        BufferDesc bufferDesc = {};
+        bufferDesc.size = SIZE;
+
+        MemoryDesc memoryDesc = {};
+        device.core.GetBufferMemoryDesc2(*device.device, bufferDesc, MemoryLocation::DEVICE, memoryDesc);
+
+        memoryType = memoryDesc.type;
+    }
+
+    inline ~ResidencyTest() {
+        if (residencyManager)
+            device.helper.DestroyResidencyManager(residencyManager);
+
+        for (Memory* memory : memories)
+            device.core.FreeMemory(memory);
+    }
+
+    inline uint32_t Track(uint64_t size, float priority) {
+        AllocateMemoryDesc allocateMemoryDesc = {};
+        allocateMemoryDesc.size = size;
+        allocateMemoryDesc.type = memoryType;
+        allocateMemoryDesc.priority = priority;
+
+        Memory* memory = nullptr;
+        if (device.core.AllocateMemory(*device.device, allocateMemoryDesc, memory) != Result::SUCCESS)
+            return 0;
+
+        memories.push_back(memory);
+
+        return device.helper.TrackMemory(*residencyManager, *memory, size, priority);
+    }
+
+    // Marks "handles" as used and ends the frame
+    inline ResidencyStats Frame(std::initializer_list<uint32_t> handles) {
+        device.helper.MarkMemoryUsed(*residencyManager, handles.begin(), (uint32_t)handles.size());
+
+        ResidencyStats residencyStats = {};
+        device.helper.UpdateResidency(*residencyManager, &residencyStats);
+
+        return residencyStats;
+    }
+
+    TestDevice device;
+    ResidencyManager* residencyManager = nullptr;
+    std::vector<Memory*> memories;
+    MemoryType memoryType = 0;
+};
+
+NRI_TEST(NONE, Residency_NoBudgetNoDemotion) {
+    ResidencyTest test(context, 0);
+    TEST_REQUIRE(test.residencyManager);
+
+    test.Track(SIZE, 0.0f);
+    test.Track(SIZE, 0.0f);
+
+    for (uint32_t i = 0; i < 8; i++) {
+        ResidencyStats stats = test.Frame({});
+
+        TEST_CHECK(stats.budgetSize == 0);
+        TEST_CHECK(stats.trackedSize == 2 * SIZE);
+        TEST_CHECK(stats.demotedNum == 0);
+        TEST_CHECK(stats.demotedSize == 0);
+    }
+}
+
+NRI_TEST(NONE, Residency_UnderBudgetNoDemotion) {
+    ResidencyTest test(context, BUDGET);
+    TEST_REQUIRE(test.residencyManager);
+
+    // 600 <= 900 (demote threshold)
+    test.Track(SIZE, -1.0f);
+    test.Track(SIZE, -1.0f);
+
+    for (uint32_t i = 0; i < 8; i++) {
+        ResidencyStats stats = test.Frame({});
+
+        TEST_CHECK(stats.budgetSize == BUDGET);
+        TEST_CHECK(stats.usageSize == 2 * SIZE);
+        TEST_CHECK(stats.demotedNum == 0);
+    }
+}
+
+NRI_TEST(NONE, Residency_DemotesLowestPriorityColdFirst) {
+    ResidencyTest test(context, BUDGET);
+    TEST_REQUIRE(test.residencyManager);
+
+    // 1200 > 900 (demote threshold)
+    uint32_t a = test.Track(SIZE, 0.0f);
+    uint32_t b = test.Track(SIZE, -0.5f);
+    uint32_t c = test.Track(SIZE, 0.5f);
+    uint32_t d = test.Track(SIZE, 0.0f);
+    TEST_REQUIRE(a && b && c && d);
+
+    // Frames 0-3: "B" and "D" are not used, but not cold yet (3 frames)
+    for (uint32_t i = 0; i < 4; i++) {
+        ResidencyStats stats = test.Frame({a, c});
+
+        TEST_CHECK(stats.trackedSize == 4 * SIZE);
+        TEST_CHECK(stats.demotedNum == 0);
+    }
+
+    // Frame 4: "B" and "D" are cold, demoting "B" (lower priority) is enough to get to 900
+    ResidencyStats stats = test.Frame({a, c});
+    TEST_CHECK(stats.demotedNum == 1);
+    TEST_CHECK(stats.demotedSize == SIZE);
+
+    // Stable afterwards
+    stats = test.Frame({a, c});
+    TEST_CHECK(stats.demotedNum == 0);
+    TEST_CHECK(stats.promotedNum == 0);
+    TEST_CHECK(stats.demotedSize == SIZE);
+
+    // "B" gets hot again, but 900 + 300 doesn't fit under 800 (promote threshold)
+    stats = test.Frame({a, b, c});
+    TEST_CHECK(stats.promotedNum == 0);
+    TEST_CHECK(stats.demotedSize == SIZE);
+
+    // Freeing "A" and "D" leaves 300 resident, promoting "B" gives 600 <= 800
+    test.device.helper.UntrackMemory(*test.residencyManager, a);
+    test.device.helper.UntrackMemory(*test.residencyManager, d);
+
+    stats = test.Frame({b, c});
+    TEST_CHECK(stats.trackedSize == 2 * SIZE);
+    TEST_CHECK(stats.promotedNum == 1);
+    TEST_CHECK(stats.demotedSize == 0);
+}
+
+NRI_TEST(NONE, Residency_DemotesLeastRecentlyUsedOnTie) {
+    ResidencyTest test(context, BUDGET);
+    TEST_REQUIRE(test.residencyManager);
+
+    // 900 <= 900 (demote threshold)
+    uint32_t a = test.Track(SIZE, 0.0f);
+    uint32_t b = test.Track(SIZE, 0.0f);
+    uint32_t c = test.Track(SIZE, 0.0f);
+    TEST_REQUIRE(a && b && c);
+
+    // "A" is last used in frame 1, "B" in frame 0, both are cold since frame 5
+    test.Frame({a, b, c});
+    test.Frame({a, c});
+
+    for (uint32_t i = 0; i < 4; i++)
+        test.Frame({c});
+
+    // Frame 6: 1200 > 900, demoting "B" (older) is enough
+    uint32_t d = test.Track(SIZE, 0.0f);
+    TEST_REQUIRE(d);
+
+    ResidencyStats stats = test.Frame({c, d});
+    TEST_CHECK(stats.demotedNum == 1);
+    TEST_CHECK(stats.demotedSize == SIZE);
+
+    // Untracking "B" must remove exactly its demoted size, i.e. "B" was the demoted one
+    test.device.helper.UntrackMemory(*test.residencyManager, b);
+
+    stats = test.Frame({c, d});
+    TEST_CHECK(stats.trackedSize == 3 * SIZE);
+    TEST_CHECK(stats.demotedSize == 0);
+}
+
+NRI_TEST(NONE, Residency_HandleRecycling) {
+    ResidencyTest test(context, BUDGET);
+    TEST_REQUIRE(test.residencyManager);
+
+    uint32_t a = test.Track(SIZE, 0.0f);
+    uint32_t b = test.Track(SIZE, 0.0f);
+    TEST_CHECK(a != 0 && b != 0 && a != b);
+
+    test.device.helper.UntrackMemory(*test.residencyManager, a);
+    test.device.helper.UntrackMemory(*test.residencyManager, a); // ignored
+
+    uint32_t c = test.Track(2 * SIZE, 0.0f);
+    TEST_CHECK(c == a);
+
+    ResidencyStats stats = test.Frame({});
+    TEST_CHECK(stats.trackedSize == 3 * SIZE);
+}
+
+NRI_TEST(NONE, Residency_Validation) {
+    ResidencyTest test(context, BUDGET, true);
+    TEST_REQUIRE(test.residencyManager);
+
+    uint32_t a = test.Track(SIZE, 0.0f);
+    uint32_t b = test.Track(SIZE, -0.5f);
+    uint32_t c = test.Track(SIZE, 0.0f);
+    uint32_t d = test.Track(SIZE, 0.0f);
+    TEST_REQUIRE(a && b && c && d);
+
+    ResidencyStats stats = {};
+    for (uint32_t i = 0; i < 5; i++)
+        stats = test.Frame({a, c, d});
+
+    TEST_CHECK(stats.demotedSize == SIZE);
+
+    test.device.helper.UntrackMemory(*test.residencyManager, a);
+    test.device.helper.UntrackMemory(*test.residencyManager, d);
+
+    stats = test.Frame({b, c});
+    TEST_CHECK(stats.demotedSize == 0);
+}
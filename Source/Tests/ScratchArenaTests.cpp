@@ -0,0 +1,159 @@
+// © 2026 NVIDIA Corporation
+
+// Per-thread scratch arenas of "DeviceBase": reuse without allocations in steady state, growth and trimming once idle
+
+#include "Tests.h"
+
+#include "SharedExternal.h"
+
+using namespace nri;
+
+struct AllocationCounter {
+    uint32_t allocationNum;
+    uint32_t liveNum;
+};
+
+// The original pointer is stored right before the aligned one
+static void* NRI_CALL AllocateCounted(void* userArg, size_t size, size_t alignment) {
+    uint8_t* memory = (uint8_t*)malloc(size + sizeof(void*) + alignment - 1);
+    if (!memory)
+        return nullptr;
+
+    AllocationCounter& counter = *(AllocationCounter*)userArg;
+    counter.allocationNum++;
+    counter.liveNum++;
+
+    uint8_t* alignedMemory = Align(memory + sizeof(void*), alignment);
+    ((void**)alignedMemory)[-1] = memory;
+
+    return alignedMemory;
+}
+
+static void* NRI_CALL ReallocateCounted(void*, void*, size_t, size_t) {
+    return nullptr; // not used by scratch
+}
+
+static void NRI_CALL FreeCounted(void* userArg, void* memory) {
+    if (!memory)
+        return;
+
+    AllocationCounter& counter = *(AllocationCounter*)userArg;
+    counter.liveNum--;
+
+    free(((void**)memory)[-1]);
+}
+
+// Only the arena part of a device is needed
+struct ScratchDevice final : public DeviceBase {
+    inline ScratchDevice(AllocationCounter& counter)
+        : DeviceBase({}, {AllocateCounted, ReallocateCounted, FreeCounted, &counter, false}) {
+    }
+
+    const DeviceDesc& GetDesc() const override {
+        return m_Desc;
+    }
+
+    void Destruct() override {
+    }
+
+    // A scope using "size" bytes of scratch memory
+    inline void Use(size_t size) {
+        Scratch<uint8_t> scratch = NRI_ALLOCATE_SCRATCH(*this, uint8_t, size);
+        memset(scratch, 0, size);
+    }
+
+    DeviceDesc m_Desc = {};
+};
+
+constexpr size_t LARGE_SIZE = 1024 * 1024;
+constexpr size_t SMALL_SIZE = 64 * 1024; // above "NRI_MAX_STACK_ALLOC_SIZE"
+
+NRI_TEST(NONE, ScratchArena_SteadyStateDoesNotAllocate) {
+    AllocationCounter counter = {};
+    {
+        ScratchDevice device(counter);
+
+        device.Use(SMALL_SIZE);
+        uint32_t allocationNum = counter.allocationNum;
+
+        for (uint32_t i = 0; i < 1000; i++)
+            device.Use(SMALL_SIZE);
+
+        TEST_CHECK(counter.allocationNum == allocationNum);
+
+        // Nested scopes don't fit the first time, the arena grows once empty
+        {
+            Scratch<uint8_t> outer = NRI_ALLOCATE_SCRATCH(device, uint8_t, SMALL_SIZE);
+            device.Use(SMALL_SIZE);
+        }
+
+        allocationNum = counter.allocationNum;
+        for (uint32_t i = 0; i < 1000; i++) {
+            Scratch<uint8_t> outer = NRI_ALLOCATE_SCRATCH(device, uint8_t, SMALL_SIZE);
+            device.Use(SMALL_SIZE);
+        }
+
+        TEST_CHECK(counter.allocationNum == allocationNum + 1);
+        TEST_CHECK(device.GetScratchArena()->size >= 2 * SMALL_SIZE);
+    }
+
+    TEST_CHECK(counter.liveNum == 0);
+}
+
+NRI_TEST(NONE, ScratchArena_TrimmedWhenIdle) {
+    AllocationCounter counter = {};
+    {
+        ScratchDevice device(counter);
+
+        // A spike grows the arena
+        device.Use(LARGE_SIZE);
+        device.Use(LARGE_SIZE);
+
+        const ScratchArena& arena = *device.GetScratchArena();
+        TEST_REQUIRE(arena.size >= LARGE_SIZE);
+
+        // Mostly unused for a while: released and regrown to the recent peak
+        bool isTrimmed = false;
+        for (uint32_t i = 0; i < 1000 && !isTrimmed; i++) {
+            device.Use(SMALL_SIZE);
+            isTrimmed = arena.size < LARGE_SIZE;
+        }
+
+        TEST_CHECK(isTrimmed);
+
+        device.Use(SMALL_SIZE);
+        TEST_CHECK(arena.size >= SMALL_SIZE && arena.size < LARGE_SIZE);
+
+        // And stays there
+        uint32_t allocationNum = counter.allocationNum;
+        for (uint32_t i = 0; i < 1000; i++)
+            device.Use(SMALL_SIZE);
+
+        TEST_CHECK(counter.allocationNum == allocationNum);
+    }
+
+    TEST_CHECK(counter.liveNum == 0);
+}
+
+NRI_TEST(NONE, ScratchArena_NotTrimmedWhenBusy) {
+    AllocationCounter counter = {};
+    {
+        ScratchDevice device(counter);
+
+        device.Use(LARGE_SIZE);
+        device.Use(LARGE_SIZE);
+
+        const ScratchArena& arena = *device.GetScratchArena();
+        size_t size = arena.size;
+        uint32_t allocationNum = counter.allocationNum;
+
+        // Occasional large uses keep the arena
+        for (uint32_t i = 0; i < 1000; i++)
+            device.Use(i % 32 ? SMALL_SIZE : LARGE_SIZE);
+
+        TEST_CHECK(arena.size == size);
+        TEST_CHECK(counter.allocationNum == allocationNum);
+    }
+
+    TEST_CHECK(counter.liveNum == 0);
+}
@@ -0,0 +1,336 @@
+// © 2026 NVIDIA Corporation
+
+// Streamer on top of NONE (+ validation), which runs the real "StreamerImpl" with host-backed buffers
+
+#include "Tests.h"
+
+#if defined(_WIN32)
+#    include <io.h>
+#endif
+
+using namespace nri;
+
+constexpr Dim_t SIZE = 4;
+constexpr uint32_t ROW_PITCH = SIZE * 4;
+constexpr uint64_t FILE_OFFSET = 64;
+
+struct StreamerTest {
+    inline StreamerTest(TestContext& context)
+        : device(context, GraphicsAPI::NONE, true) {
+        if (!device || !device.streamer.CreateStreamer)
+            return;
+
+        StreamerDesc streamerDesc = {};
+        streamerDesc.constantBufferMemoryLocation = MemoryLocation::HOST_UPLOAD;
+        streamerDesc.dynamicBufferMemoryLocation = MemoryLocation::HOST_UPLOAD;
+        streamerDesc.dynamicBufferDesc.usage = BufferUsageBits::NONE;
+        streamerDesc.queuedFrameNum = 1;
+
+        if (device.streamer.CreateStreamer(*device.device, streamerDesc, streamer) != Result::SUCCESS)
+            return;
+
+        TextureDesc textureDesc = {};
+        textureDesc.type = TextureType::TEXTURE_2D;
+        textureDesc.format = Format::RGBA8_UNORM;
+        textureDesc.width = SIZE;
+        textureDesc.height = SIZE;
+
+        device.core.CreateCommittedTexture(*device.device, MemoryLocation::DEVICE, 0.0f, textureDesc, texture);
+
+        for (uint32_t i = 0; i < sizeof(pixels); i++)
+            pixels[i] = uint8_t(i * 7 + 1);
+    }
+
+    inline ~StreamerTest() {
+        if (texture)
+            device.core.DestroyTexture(texture);
+
+        if (streamer)
+            device.streamer.DestroyStreamer(streamer);
+    }
+
+    inline StreamTextureDataDesc GetDesc() const {
+        StreamTextureDataDesc streamTextureDataDesc = {};
+        streamTextureDataDesc.dataRowPitch = ROW_PITCH;
+        streamTextureDataDesc.dataSlicePitch = ROW_PITCH * SIZE;
+        streamTextureDataDesc.dstTexture = texture;
+
+        return streamTextureDataDesc;
+    }
+
+    // NONE has no upload alignment requirements, i.e. the streamed texels are tightly packed
+    inline bool IsStreamed(const BufferOffset& bufferOffset) {
+        if (!bufferOffset.buffer)
+            return false;
+
+        const void* data = device.core.MapBuffer(*bufferOffset.buffer, bufferOffset.offset, sizeof(pixels));
+        bool isEqual = data && !memcmp(data, pixels, sizeof(pixels));
+        device.core.UnmapBuffer(*bufferOffset.buffer);
+
+        return isEqual;
+    }
+
+    TestDevice device;
+    Streamer* streamer = nullptr;
+    Texture* texture = nullptr;
+    uint8_t pixels[ROW_PITCH * SIZE] = {};
+};
+
+// A temporary file with "pixels" at "FILE_OFFSET", deleted on close
+struct TempFile {
+    inline TempFile(const uint8_t* data, size_t size) {
+        file = tmpfile();
+        if (!file)
+            return;
+
+        uint8_t header[FILE_OFFSET] = {};
+        fwrite(header, 1, sizeof(header), file);
+        fwrite(data, 1, size, file);
+        fflush(file);
+
+#if defined(_WIN32)
+        handle = (uint64_t)_get_osfhandle(_fileno(file));
+#else
+        handle = (uint64_t)fileno(file);
+#endif
+    }
+
+    inline ~TempFile() {
+        if (file)
+            fclose(file);
+    }
+
+    FILE* file = nullptr;
+    uint64_t handle = 0;
+};
+
+NRI_TEST(NONE, Streamer_TextureFromMemory) {
+    StreamerTest test(context);
+    TEST_REQUIRE(test.streamer && test.texture);
+
+    StreamTextureDataDesc streamTextureDataDesc = test.GetDesc();
+    streamTextureDataDesc.data = test.pixels;
+
+    TEST_CHECK(test.IsStreamed(test.device.streamer.StreamTextureData(*test.streamer, streamTextureDataDesc)));
+}
+
+NRI_TEST(NONE, Streamer_TextureFromFileHandle) {
+    StreamerTest test(context);
+    TEST_REQUIRE(test.streamer && test.texture);
+
+    TempFile tempFile(test.pixels, sizeof(test.pixels));
+    TEST_REQUIRE(tempFile.file);
+
+    UploadFileDesc uploadFileDesc = {};
+    uploadFileDesc.fileHandle = tempFile.handle;
+
+    StreamTextureDataDesc streamTextureDataDesc = test.GetDesc();
+    streamTextureDataDesc.file = &uploadFileDesc;
+    streamTextureDataDesc.fileOffset = FILE_OFFSET;
+
+    TEST_CHECK(test.IsStreamed(test.device.streamer.StreamTextureData(*test.streamer, streamTextureDataDesc)));
+
+    // The file is not closed, i.e. it can be streamed again
+    TEST_CHECK(test.IsStreamed(test.device.streamer.StreamTextureData(*test.streamer, streamTextureDataDesc)));
+}
+
+NRI_TEST(NONE, Streamer_TextureFromMappedView) {
+    StreamerTest test(context);
+    TEST_REQUIRE(test.streamer && test.texture);
+
+    uint8_t view[FILE_OFFSET + sizeof(test.pixels)] = {};
+    memcpy(view + FILE_OFFSET, test.pixels, sizeof(test.pixels));
+
+    UploadFileDesc uploadFileDesc = {};
+    uploadFileDesc.mappedView = view;
+
+    StreamTextureDataDesc streamTextureDataDesc = test.GetDesc();
+    streamTextureDataDesc.data = test.pixels + 1; // ignored
+    streamTextureDataDesc.file = &uploadFileDesc;
+    streamTextureDataDesc.fileOffset = FILE_OFFSET;
+
+    TEST_CHECK(test.IsStreamed(test.device.streamer.StreamTextureData(*test.streamer, streamTextureDataDesc)));
+}
+
+NRI_TEST(NONE, Streamer_TextureFromFileOutOfRange) {
+    StreamerTest test(context);
+    TEST_REQUIRE(test.streamer && test.texture);
+
+    TempFile tempFile(test.pixels, sizeof(test.pixels));
+    TEST_REQUIRE(tempFile.file);
+
+    UploadFileDesc uploadFileDesc = {};
+    uploadFileDesc.fileHandle = tempFile.handle;
+
+    StreamTextureDataDesc streamTextureDataDesc = test.GetDesc();
+    streamTextureDataDesc.file = &uploadFileDesc;
+    streamTextureDataDesc.fileOffset = FILE_OFFSET + 1;
+
+    BufferOffset bufferOffset = test.device.streamer.StreamTextureData(*test.streamer, streamTextureDataDesc);
+    TEST_CHECK(bufferOffset.buffer == nullptr);
+}
+
+// Plain NONE: commands don't copy, but tickets and the readback ring-buffer are real
+struct ReadbackTest {
+    inline ReadbackTest(TestContext& context)
+        : device(context, GraphicsAPI::NONE) {
+        if (!device)
+            return;
+
+        StreamerDesc streamerDesc = {};
+        streamerDesc.readbackBufferSize = READBACK_BUFFER_SIZE;
+        streamerDesc.queuedFrameNum = QUEUED_FRAME_NUM;
+
+        if (device.streamer.CreateStreamer(*device.device, streamerDesc, streamer) != Result::SUCCESS)
+            return;
+
+        BufferDesc bufferDesc = {};
+        bufferDesc.size = sizeof(pixels);
+
+        device.core.CreateCommittedBuffer(*device.device, MemoryLocation::DEVICE, 0.0f, bufferDesc, buffer);
+
+        TextureDesc textureDesc = {};
+        textureDesc.type = TextureType::TEXTURE_2D;
+        textureDesc.format = Format::RGBA8_UNORM;
+        textureDesc.width = SIZE;
+        textureDesc.height = SIZE;
+
+        device.core.CreateCommittedTexture(*device.device, MemoryLocation::DEVICE, 0.0f, textureDesc, texture);
+
+        if (device.core.CreateCommandAllocator(*device.queue, commandAllocator) == Result::SUCCESS)
+            device.core.CreateCommandBuffer(*commandAllocator, commandBuffer);
+    }
+
+    inline ~ReadbackTest() {
+        if (commandBuffer)
+            device.core.DestroyCommandBuffer(commandBuffer);
+
+        if (commandAllocator)
+            device.core.DestroyCommandAllocator(commandAllocator);
+
+        if (texture)
+            device.core.DestroyTexture(texture);
+
+        if (buffer)
+            device.core.DestroyBuffer(buffer);
+
+        if (streamer)
+            device.streamer.DestroyStreamer(streamer);
+    }
+
+    inline bool IsValid() const {
+        return streamer && buffer && texture && commandBuffer;
+    }
+
+    inline void EndFrames(uint32_t frameNum) {
+        for (uint32_t i = 0; i < frameNum; i++)
+            device.streamer.EndStreamerFrame(*streamer);
+    }
+
+    static constexpr uint64_t READBACK_BUFFER_SIZE = 256;
+    static constexpr uint32_t QUEUED_FRAME_NUM = 2;
+
+    TestDevice device;
+    Streamer* streamer = nullptr;
+    Buffer* buffer = nullptr;
+    Texture* texture = nullptr;
+    CommandAllocator* commandAllocator = nullptr;
+    CommandBuffer* commandBuffer = nullptr;
+    uint8_t pixels[ROW_PITCH * SIZE] = {};
+};
+
+NRI_TEST(NONE, Streamer_ReadbackBuffer) {
+    ReadbackTest test(context);
+    TEST_REQUIRE(test.IsValid());
+
+    StreamerInterface& streamer = test.device.streamer;
+
+    uint64_t a = streamer.CmdReadbackBuffer(*test.commandBuffer, *test.streamer, *test.buffer, 0, 20);
+    uint64_t b = streamer.CmdReadbackBuffer(*test.commandBuffer, *test.streamer, *test.buffer, 0, 20);
+    TEST_REQUIRE(a && b && a != b);
+
+    // Not ready until "queuedFrameNum" frames later
+    TEST_CHECK(streamer.TryGetReadbackData(*test.streamer, a) == nullptr);
+    test.EndFrames(ReadbackTest::QUEUED_FRAME_NUM - 1);
+    TEST_CHECK(streamer.TryGetReadbackData(*test.streamer, a) == nullptr);
+    test.EndFrames(1);
+
+    uint8_t* dataA = (uint8_t*)streamer.TryGetReadbackData(*test.streamer, a);
+    uint8_t* dataB = (uint8_t*)streamer.TryGetReadbackData(*test.streamer, b);
+    TEST_REQUIRE(dataA && dataB);
+    TEST_CHECK(dataB - dataA == 32); // 16 bytes aligned
+
+    // Host-backed, i.e. readable and writable
+    memset(dataA, 0xAB, 20);
+    TEST_CHECK(dataA[19] == 0xAB);
+
+    // Overwritten on the next frame
+    test.EndFrames(1);
+    TEST_CHECK(streamer.TryGetReadbackData(*test.streamer, a) == nullptr);
+}
+
+NRI_TEST(NONE, Streamer_ReadbackTexture) {
+    ReadbackTest test(context);
+    TEST_REQUIRE(test.IsValid());
+
+    StreamerInterface& streamer = test.device.streamer;
+
+    TextureRegionDesc textureRegionDesc = {};
+    textureRegionDesc.width = WHOLE_SIZE;
+    textureRegionDesc.height = WHOLE_SIZE;
+    textureRegionDesc.depth = WHOLE_SIZE;
+
+    // NONE has no readback alignment requirements
+    TextureDataLayoutDesc dataLayout = {};
+    uint64_t ticket = streamer.CmdReadbackTexture(*test.commandBuffer, *test.streamer, *test.texture, textureRegionDesc, dataLayout);
+    TEST_REQUIRE(ticket);
+    TEST_CHECK(dataLayout.offset == 0);
+    TEST_CHECK(dataLayout.rowPitch == ROW_PITCH);
+    TEST_CHECK(dataLayout.slicePitch == ROW_PITCH * SIZE);
+
+    test.EndFrames(ReadbackTest::QUEUED_FRAME_NUM);
+    TEST_CHECK(streamer.TryGetReadbackData(*test.streamer, ticket) != nullptr);
+}
+
+NRI_TEST(NONE, Streamer_ReadbackCompressedTexture) {
+    ReadbackTest test(context);
+    TEST_REQUIRE(test.IsValid());
+
+    TextureDesc textureDesc = {};
+    textureDesc.type = TextureType::TEXTURE_2D;
+    textureDesc.format = Format::BC1_RGBA_UNORM;
+    textureDesc.width = 16;
+    textureDesc.height = 16;
+
+    Texture* texture = nullptr;
+    TEST_REQUIRE(test.device.core.CreateCommittedTexture(*test.device.device, MemoryLocation::DEVICE, 0.0f, textureDesc, texture) == Result::SUCCESS);
+
+    TextureRegionDesc textureRegionDesc = {};
+    textureRegionDesc.width = WHOLE_SIZE;
+    textureRegionDesc.height = WHOLE_SIZE;
+    textureRegionDesc.depth = WHOLE_SIZE;
+
+    // 4x4 blocks of 8 bytes, i.e. it fits into the readback buffer (in texels it wouldn't)
+    TextureDataLayoutDesc dataLayout = {};
+    uint64_t ticket = test.device.streamer.CmdReadbackTexture(*test.commandBuffer, *test.streamer, *texture, textureRegionDesc, dataLayout);
+    TEST_CHECK(ticket);
+    TEST_CHECK(dataLayout.rowPitch == 4 * 8);
+    TEST_CHECK(dataLayout.slicePitch == 4 * 4 * 8);
+
+    test.device.core.DestroyTexture(texture);
+}
+
+NRI_TEST(NONE, Streamer_ReadbackOutOfMemory) {
+    ReadbackTest test(context);
+    TEST_REQUIRE(test.IsValid());
+
+    StreamerInterface& streamer = test.device.streamer;
+
+    TEST_CHECK(streamer.CmdReadbackBuffer(*test.commandBuffer, *test.streamer, *test.buffer, 0, ReadbackTest::READBACK_BUFFER_SIZE + 1) == 0);
+    TEST_CHECK(streamer.CmdReadbackBuffer(*test.commandBuffer, *test.streamer, *test.buffer, 0, ReadbackTest::READBACK_BUFFER_SIZE) != 0);
+    TEST_CHECK(streamer.CmdReadbackBuffer(*test.commandBuffer, *test.streamer, *test.buffer, 0, 1) == 0);
+
+    // The ring-buffer region is free again on the next frame
+    test.EndFrames(1);
+    TEST_CHECK(streamer.CmdReadbackBuffer(*test.commandBuffer, *test.streamer, *test.buffer, 0, 1) != 0);
+}
@@ -0,0 +1,132 @@
+// © 2026 NVIDIA Corporation
+
+// Virtual swap chain on the virtual clock ("VirtualSwapChainDesc::frameTime"): exact presentation and display timestamps
+
+#include "Tests.h"
+
+#include "Extensions/NRILowLatency.h"
+#include "Extensions/NRISwapChain.h"
+
+using namespace nri;
+
+constexpr uint64_t REFRESH_PERIOD = 16667;
+constexpr uint64_t PRESENT_LATENCY = 1000;
+constexpr uint64_t FRAME_TIME = 5000;
+
+struct SwapChainVirtualTest {
+    inline SwapChainVirtualTest(TestContext& context, SwapChainBits flags, bool enableValidation)
+        : device(context, GraphicsAPI::NONE, enableValidation) {
+        if (!device)
+            return;
+
+        if (nriGetInterface(*device.device, NRI_INTERFACE(SwapChainInterface), &swapChainInterface) != Result::SUCCESS
+            || nriGetInterface(*device.device, NRI_INTERFACE(LowLatencyInterface), &lowLatencyInterface) != Result::SUCCESS)
+            return;
+
+        if (device.core.CreateFence(*device.device, SWAPCHAIN_SEMAPHORE, acquireSemaphore) != Result::SUCCESS
+            || device.core.CreateFence(*device.device, SWAPCHAIN_SEMAPHORE, releaseSemaphore) != Result::SUCCESS)
+            return;
+
+        SwapChainDesc swapChainDesc = {};
+        swapChainDesc.queue = device.queue;
+        swapChainDesc.width = 64;
+        swapChainDesc.height = 64;
+        swapChainDesc.textureNum = 2;
+        swapChainDesc.flags = flags | SwapChainBits::VIRTUAL | SwapChainBits::WAITABLE | SwapChainBits::ALLOW_LOW_LATENCY;
+        swapChainDesc.virtualDesc.refreshPeriod = (uint32_t)REFRESH_PERIOD;
+        swapChainDesc.virtualDesc.presentLatency = (uint32_t)PRESENT_LATENCY;
+        swapChainDesc.virtualDesc.frameTime = (uint32_t)FRAME_TIME;
+
+        swapChainInterface.CreateSwapChain(*device.device, swapChainDesc, swapChain);
+    }
+
+    inline ~SwapChainVirtualTest() {
+        if (swapChain)
+            swapChainInterface.DestroySwapChain(swapChain);
+
+        if (releaseSemaphore)
+            device.core.DestroyFence(releaseSemaphore);
+
+        if (acquireSemaphore)
+            device.core.DestroyFence(acquireSemaphore);
+    }
+
+    // Acquires, marks the simulation start, presents and waits for the display, returning the report of this frame
+    inline LatencyReport Frame(uint64_t presentId) {
+        uint32_t textureIndex = 0;
+        swapChainInterface.AcquireNextTexture(*swapChain, *acquireSemaphore, textureIndex);
+        lowLatencyInterface.SetLatencyMarker(*swapChain, presentId, LatencyMarker::SIMULATION_START);
+        swapChainInterface.QueuePresent(*swapChain, *releaseSemaphore, presentId);
+        swapChainInterface.WaitForPresent(*swapChain, presentId);
+
+        LatencyReport latencyReport = {};
+        lowLatencyInterface.GetLatencyReport(*swapChain, latencyReport);
+
+        return latencyReport;
+    }
+
+    TestDevice device;
+    SwapChainInterface swapChainInterface = {};
+    LowLatencyInterface lowLatencyInterface = {};
+    Fence* acquireSemaphore = nullptr;
+    Fence* releaseSemaphore = nullptr;
+    SwapChain* swapChain = nullptr;
+};
+
+NRI_TEST(NONE, SwapChainVirtual_VsyncTimestamps) {
+    for (bool enableValidation : {false, true}) {
+        SwapChainVirtualTest test(context, SwapChainBits::VSYNC, enableValidation);
+        TEST_REQUIRE(test.swapChain);
+
+        // The clock starts at 0, a frame takes "FRAME_TIME", "WaitForPresent" jumps to the display, which happens on the next refresh
+        for (uint64_t i = 1; i <= 8; i++) {
+            LatencyReport latencyReport = test.Frame(i);
+
+            TEST_CHECK(latencyReport.simulationStartTimeUs == (i - 1) * REFRESH_PERIOD);
+            TEST_CHECK(latencyReport.presentStartTimeUs == (i - 1) * REFRESH_PERIOD + FRAME_TIME);
+            TEST_CHECK(latencyReport.presentEndTimeUs == (i - 1) * REFRESH_PERIOD + FRAME_TIME);
+            TEST_CHECK(latencyReport.osRenderQueueEndTimeUs == i * REFRESH_PERIOD);
+        }
+    }
+}
+
+NRI_TEST(NONE, SwapChainVirtual_ImmediateTimestamps) {
+    SwapChainVirtualTest test(context, SwapChainBits::NONE, false);
+    TEST_REQUIRE(test.swapChain);
+
+    // Not aligned to refreshes, a frame is displayed "PRESENT_LATENCY" after presentation
+    for (uint64_t i = 1; i <= 8; i++) {
+        LatencyReport latencyReport = test.Frame(i);
+
+        uint64_t presentTimeUs = (i - 1) * (FRAME_TIME + PRESENT_LATENCY) + FRAME_TIME;
+        TEST_CHECK(latencyReport.simulationStartTimeUs == presentTimeUs - FRAME_TIME);
+        TEST_CHECK(latencyReport.presentStartTimeUs == presentTimeUs);
+        TEST_CHECK(latencyReport.osRenderQueueStartTimeUs == presentTimeUs);
+        TEST_CHECK(latencyReport.osRenderQueueEndTimeUs == presentTimeUs + PRESENT_LATENCY);
+    }
+}
+
+NRI_TEST(NONE, SwapChainVirtual_AcquireBlocksUntilDisplay) {
+    SwapChainVirtualTest test(context, SwapChainBits::VSYNC, false);
+    TEST_REQUIRE(test.swapChain);
+
+    // No waiting for presentation: the 3rd acquire (2 textures) can only return once the 2nd frame replaces the 1st on screen
+    uint32_t textureIndex = 0;
+    for (uint64_t i = 1; i <= 2; i++) {
+        test.swapChainInterface.AcquireNextTexture(*test.swapChain, *test.acquireSemaphore, textureIndex);
+        test.swapChainInterface.QueuePresent(*test.swapChain, *test.releaseSemaphore, i);
+    }
+
+    test.swapChainInterface.AcquireNextTexture(*test.swapChain, *test.acquireSemaphore, textureIndex);
+    test.lowLatencyInterface.SetLatencyMarker(*test.swapChain, 3, LatencyMarker::SIMULATION_START);
+    test.swapChainInterface.QueuePresent(*test.swapChain, *test.releaseSemaphore, 3);
+    test.swapChainInterface.WaitForPresent(*test.swapChain, 3);
+
+    LatencyReport latencyReport = {};
+    test.lowLatencyInterface.GetLatencyReport(*test.swapChain, latencyReport);
+
+    TEST_CHECK(textureIndex == 0);
+    TEST_CHECK(latencyReport.simulationStartTimeUs == 2 * REFRESH_PERIOD);
+    TEST_CHECK(latencyReport.presentStartTimeUs == 2 * REFRESH_PERIOD + FRAME_TIME);
+    TEST_CHECK(latencyReport.osRenderQueueEndTimeUs == 3 * REFRESH_PERIOD);
+}
@@ -0,0 +1,133 @@
+// © 2026 NVIDIA Corporation
+
+// Unit and integration tests:
+//   NRI_Tests [--group NONE|VK] [--filter <substring>]
+// Exit codes: 0 - passed, 1 - failed, 77 - nothing passed, i.e. all selected tests skipped or none selected (for "SKIP_RETURN_CODE" in CTest)
+
+#include "Tests.h"
+
+using namespace nri;
+
+constexpr int SKIP_RETURN_CODE = 77;
+
+std::vector<TestInfo>& GetTests() {
+    static std::vector<TestInfo> tests;
+
+    return tests;
+}
+
+static void NRI_CALL MessageCallback(Message messageType, const char* file, uint32_t line, const char* message, void* userArg) {
+    if (messageType != Message::ERROR)
+        return;
+
+    TestContext& context = *(TestContext*)userArg;
+    context.errorMessageNum++;
+
+    printf("    NRI ERROR: %s (%s:%u)\n", message, file, line);
+}
+
+static void NRI_CALL AbortExecution(void*) {
+    // Errors are counted, not fatal
+}
+
+TestDevice::TestDevice(TestContext& context, GraphicsAPI graphicsAPI, bool enableValidation, uint64_t noneVideoMemoryBudget) {
+    DeviceCreationDesc deviceCreationDesc = {};
+    deviceCreationDesc.graphicsAPI = graphicsAPI;
+    deviceCreationDesc.enableNRIValidation = enableValidation;
+    deviceCreationDesc.noneVideoMemoryBudget = noneVideoMemoryBudget;
+    deviceCreationDesc.callbackInterface.MessageCallback = MessageCallback;
+    deviceCreationDesc.callbackInterface.AbortExecution = AbortExecution;
+    deviceCreationDesc.callbackInterface.userArg = &context;
+
+    AdapterDesc adapterDescs[8] = {};
+    uint32_t adapterDescNum = 8;
+    if (graphicsAPI == GraphicsAPI::VK && nriEnumerateAdapters(adapterDescs, adapterDescNum) == Result::SUCCESS) {
+        for (uint32_t i = 0; i < adapterDescNum; i++) {
+            if (adapterDescs[i].architecture == Architecture::SOFTWARE) {
+                deviceCreationDesc.adapterDesc = &adapterDescs[i];
+                break;
+            }
+        }
+    }
+
+    if (nriCreateDevice(deviceCreationDesc, device) != Result::SUCCESS) {
+        device = nullptr;
+        return;
+    }
+
+    if (nriGetInterface(*device, NRI_INTERFACE(CoreInterface), &core) != Result::SUCCESS
+        || nriGetInterface(*device, NRI_INTERFACE(HelperInterface), &helper) != Result::SUCCESS
+        || core.GetQueue(*device, QueueType::GRAPHICS, 0, queue) != Result::SUCCESS) {
+        nriDestroyDevice(device);
+        device = nullptr;
+        return;
+    }
+
+    nriGetInterface(*device, NRI_INTERFACE(StreamerInterface), &streamer); // zeroed if unsupported
+}
+
+TestDevice::~TestDevice() {
+    if (!device)
+        return;
+
+    core.DeviceWaitIdle(device);
+    nriDestroyDevice(device);
+}
+
+int main(int argc, char** argv) {
+    const char* group = nullptr;
+    const char* filter = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--group") && i + 1 < argc)
+            group = argv[++i];
+        else if (!strcmp(argv[i], "--filter") && i + 1 < argc)
+            filter = argv[++i];
+        else {
+            printf("Usage: NRI_Tests [--group NONE|VK] [--filter <substring>]\n");
+            return 1;
+        }
+    }
+
+    uint32_t passedNum = 0;
+    uint32_t failedNum = 0;
+    uint32_t skippedNum = 0;
+
+    for (const TestInfo& test : GetTests()) {
+        if (group && strcmp(test.group, group))
+            continue;
+
+        if (filter && !strstr(test.name, filter))
+            continue;
+
+        printf("[ RUN  ] %s.%s\n", test.group, test.name);
+        fflush(stdout);
+
+        TestContext context = {};
+        context.name = test.name;
+        test.func(context);
+
+        if (context.errorMessageNum != context.expectedErrorMessageNum) {
+            printf("    FAILED: %u NRI error(s) reported, %u expected\n", context.errorMessageNum, context.expectedErrorMessageNum);
+            context.failureNum++;
+        }
+
+        if (context.failureNum) {
+            printf("[ FAIL ] %s.%s\n", test.group, test.name);
+            failedNum++;
+        } else if (context.isSkipped) {
+            printf("[ SKIP ] %s.%s\n", test.group, test.name);
+            skippedNum++;
+        } else {
+            printf("[  OK  ] %s.%s\n", test.group, test.name);
+            passedNum++;
+        }
+    }
+
+    printf("\n%u passed, %u failed, %u skipped\n", passedNum, failedNum, skippedNum);
+
+    if (failedNum)
+        return 1;
+
+    return passedNum ? 0 : SKIP_RETURN_CODE;
+}
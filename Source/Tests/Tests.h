@@ -0,0 +1,104 @@
+// © 2026 NVIDIA Corporation
+
+#pragma once
+
+// Minimal self-registering test framework for "NRI_Tests":
+// - "NRI_TEST(Group, Name)" defines a test, "Group" is "NONE" (runs everywhere) or "VK" (needs a Vulkan adapter, preferably lavapipe)
+// - "TEST_CHECK" records a failure and continues, "TEST_REQUIRE" records a failure and leaves the test
+// - a test can call "TEST_SKIP" if the environment can't run it
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "NRI.h"
+
+#include "Extensions/NRIDeviceCreation.h"
+#include "Extensions/NRIHelper.h"
+#include "Extensions/NRIStreamer.h"
+
+struct TestContext {
+    const char* name = nullptr;
+    uint32_t failureNum = 0;
+    uint32_t errorMessageNum = 0;         // NRI "ERROR" messages reported via "CallbackInterface"
+    uint32_t expectedErrorMessageNum = 0; // a test triggering errors on purpose states how many, any mismatch is a failure
+    bool isSkipped = false;
+};
+
+typedef void (*TestFunc)(TestContext& context);
+
+struct TestInfo {
+    const char* group;
+    const char* name;
+    TestFunc func;
+};
+
+std::vector<TestInfo>& GetTests();
+
+struct TestRegistrar {
+    inline TestRegistrar(const char* group, const char* name, TestFunc func) {
+        GetTests().push_back({group, name, func});
+    }
+};
+
+#define NRI_TEST(group, name) \
+    static void group##_##name(TestContext& context); \
+    static TestRegistrar g_##group##_##name##_registrar(#group, #name, group##_##name); \
+    static void group##_##name(TestContext& context)
+
+#define TEST_CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            printf("    FAILED: %s (%s:%u)\n", #condition, __FILE__, __LINE__); \
+            context.failureNum++; \
+        } \
+    } while (0)
+
+#define TEST_REQUIRE(condition) \
+    do { \
+        if (!(condition)) { \
+            printf("    FAILED: %s (%s:%u)\n", #condition, __FILE__, __LINE__); \
+            context.failureNum++; \
+            return; \
+        } \
+    } while (0)
+
+#define TEST_SKIP(reason) \
+    do { \
+        printf("    SKIPPED: %s\n", reason); \
+        context.isSkipped = true; \
+        return; \
+    } while (0)
+
+// Hand-assembled SPIR-V 1.0 of an empty compute shader ("main", local size 1x1x1), no shader toolchain is needed to build the tests
+inline constexpr uint32_t EMPTY_COMPUTE_SHADER_SPIRV[] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000005, 0x00000000, // header (bound = 5)
+    0x00020011, 0x00000001,                                     // OpCapability Shader
+    0x0003000E, 0x00000000, 0x00000001,                         // OpMemoryModel Logical GLSL450
+    0x0005000F, 0x00000005, 0x00000001, 0x6E69616D, 0x00000000, // OpEntryPoint GLCompute %1 "main"
+    0x00060010, 0x00000001, 0x00000011, 0x00000001, 0x00000001, 0x00000001, // OpExecutionMode %1 LocalSize 1 1 1
+    0x00020013, 0x00000002,                                     // %2 = OpTypeVoid
+    0x00030021, 0x00000003, 0x00000002,                         // %3 = OpTypeFunction %2
+    0x00050036, 0x00000002, 0x00000001, 0x00000000, 0x00000003, // %1 = OpFunction %2 None %3
+    0x000200F8, 0x00000004,                                     // %4 = OpLabel
+    0x000100FD,                                                 // OpReturn
+    0x00010038,                                                 // OpFunctionEnd
+};
+
+// A device with the commonly used interfaces, destroyed with the object. "VK" prefers a software adapter (lavapipe) for reproducibility
+// "enableValidation" puts NRI validation on top, "noneVideoMemoryBudget" is the fake "DEVICE" budget reported by NONE
+struct TestDevice {
+    TestDevice(TestContext& context, nri::GraphicsAPI graphicsAPI, bool enableValidation = false, uint64_t noneVideoMemoryBudget = 0);
+    ~TestDevice();
+
+    inline operator bool() const {
+        return device != nullptr;
+    }
+
+    nri::Device* device = nullptr;
+    nri::Queue* queue = nullptr;
+    nri::CoreInterface core = {};
+    nri::HelperInterface helper = {};
+    nri::StreamerInterface streamer = {};
+};
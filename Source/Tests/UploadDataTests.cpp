@@ -0,0 +1,368 @@
+// © 2026 NVIDIA Corporation
+
+// "UploadData" with CPU mip generation against hand-computed golden mip chains:
+// - the CPU chain (each golden mip must be generated from the previous one)
+// - the upload path on top of NONE + validation (top mips used in place or converted, rejected cases)
+// - the uploaded texture content, read back per mip (VK)
+// - array textures, which layers are generated in parallel, against chains generated serially
+
+#include "Tests.h"
+
+#include "SharedExternal.h"
+
+using namespace nri;
+
+struct GoldenChain {
+    const char* name;
+    Format format;
+    Format dataFormat; // "UNKNOWN" if the top mip is provided in the texture format
+    MipGeneration mipGeneration;
+    Dim_t width;
+    Dim_t height;
+    std::vector<uint8_t> topMip;              // in "dataFormat" (if set)
+    std::vector<std::vector<uint8_t>> mips;   // all mips in the texture format, tightly packed
+};
+
+static std::vector<uint8_t> Halfs(std::initializer_list<uint16_t> halfs) {
+    std::vector<uint8_t> bytes(halfs.size() * sizeof(uint16_t));
+    memcpy(bytes.data(), halfs.begin(), bytes.size());
+
+    return bytes;
+}
+
+static std::vector<uint8_t> Floats(std::initializer_list<float> floats) {
+    std::vector<uint8_t> bytes(floats.size() * sizeof(float));
+    memcpy(bytes.data(), floats.begin(), bytes.size());
+
+    return bytes;
+}
+
+static std::vector<GoldenChain> GetGoldenChains() {
+    std::vector<GoldenChain> chains;
+
+    { // texel (x, y) = (64x, 64y, 32(x + y), 255)
+        GoldenChain chain = {"RGBA8_UNORM 4x4", Format::RGBA8_UNORM, Format::UNKNOWN, MipGeneration::BOX, 4, 4};
+        for (uint32_t y = 0; y < 4; y++) {
+            for (uint32_t x = 0; x < 4; x++)
+                chain.topMip.insert(chain.topMip.end(), {uint8_t(x * 64), uint8_t(y * 64), uint8_t((x + y) * 32), 255});
+        }
+
+        chain.mips.push_back(chain.topMip);
+        chain.mips.push_back({32, 32, 32, 255, 160, 32, 96, 255, 32, 160, 96, 255, 160, 160, 160, 255});
+        chain.mips.push_back({96, 96, 96, 255});
+        chains.push_back(chain);
+    }
+
+    { // filtered in linear space: the average of "0" and "255" is "188", not "128" (alpha is linear)
+        GoldenChain chain = {"RGBA8_SRGB 2x2", Format::RGBA8_SRGB, Format::UNKNOWN, MipGeneration::BOX, 2, 2};
+        chain.topMip = {255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0};
+        chain.mips.push_back(chain.topMip);
+        chain.mips.push_back({188, 188, 188, 128});
+        chains.push_back(chain);
+    }
+
+    { // odd width: the last column is clamped
+        GoldenChain chain = {"R8_UNORM 3x1", Format::R8_UNORM, Format::UNKNOWN, MipGeneration::BOX, 3, 1};
+        chain.topMip = {0, 100, 200};
+        chain.mips.push_back(chain.topMip);
+        chain.mips.push_back({50});
+        chains.push_back(chain);
+    }
+
+    { // the top mip is converted first, then filtered
+        GoldenChain chain = {"RGBA16_SFLOAT 2x2 from RGBA32_SFLOAT", Format::RGBA16_SFLOAT, Format::RGBA32_SFLOAT, MipGeneration::BOX, 2, 2};
+        chain.topMip = Floats({0.0f, 1.0f, 2.0f, 1.0f, 1.0f, 1.0f, 2.0f, 1.0f, 0.0f, 3.0f, 2.0f, 1.0f, 1.0f, 3.0f, 2.0f, 1.0f});
+        chain.mips.push_back(Halfs({0x0000, 0x3C00, 0x4000, 0x3C00, 0x3C00, 0x3C00, 0x4000, 0x3C00, 0x0000, 0x4200, 0x4000, 0x3C00, 0x3C00, 0x4200, 0x4000, 0x3C00}));
+        chain.mips.push_back(Halfs({0x3800, 0x4000, 0x4000, 0x3C00}));
+        chains.push_back(chain);
+    }
+
+    { // two "+X" and two "+Y" normals (Z is reconstructed) average to a renormalized diagonal
+        GoldenChain chain = {"RG8_UNORM 2x2 normal map", Format::RG8_UNORM, Format::UNKNOWN, MipGeneration::NORMAL_MAP, 2, 2};
+        chain.topMip = {255, 128, 255, 128, 128, 255, 128, 255};
+        chain.mips.push_back(chain.topMip);
+        chain.mips.push_back({218, 218});
+        chains.push_back(chain);
+    }
+
+    return chains;
+}
+
+static uint32_t GetStride(Format format) {
+    return GetFormatProps(format).stride;
+}
+
+static Dim_t GetMipDim(Dim_t dim, uint32_t mip) {
+    return (Dim_t)std::max(dim >> mip, 1);
+}
+
+// Big enough to be generated on several threads, each layer is different
+static std::vector<GoldenChain> GetLayerChains(Dim_t layerNum) {
+    constexpr Dim_t size = 256;
+    constexpr uint32_t stride = 4;
+
+    std::vector<GoldenChain> chains;
+    for (Dim_t layer = 0; layer < layerNum; layer++) {
+        GoldenChain chain = {"RGBA8_UNORM 256x256 layer", Format::RGBA8_UNORM, Format::UNKNOWN, MipGeneration::BOX, size, size};
+        chain.topMip.resize(size * size * stride);
+        for (size_t i = 0; i < chain.topMip.size(); i++)
+            chain.topMip[i] = uint8_t((i * 2654435761u + layer * 40503u) >> 13);
+
+        chain.mips.push_back(chain.topMip);
+        for (Dim_t w = size; w > 1; w >>= 1) {
+            std::vector<uint8_t> mip((w / 2) * (w / 2) * stride);
+            GenerateMip(mip.data(), (w / 2) * stride, chain.mips.back().data(), w * stride, chain.format, w, w, false);
+            chain.mips.push_back(mip);
+        }
+
+        chains.push_back(chain);
+    }
+
+    return chains;
+}
+
+NRI_TEST(NONE, UploadData_GoldenChainsOnCpu) {
+    for (const GoldenChain& chain : GetGoldenChains()) {
+        uint32_t stride = GetStride(chain.format);
+
+        // Top mip conversion
+        if (chain.dataFormat != Format::UNKNOWN) {
+            std::vector<uint8_t> converted(chain.mips[0].size());
+            uint32_t dataStride = GetStride(chain.dataFormat);
+            ConvertTextureData(converted.data(), chain.width * stride, converted.size(), chain.format, chain.topMip.data(), chain.width * dataStride, chain.topMip.size(), chain.dataFormat, chain.width, chain.height, 1);
+
+            if (converted != chain.mips[0]) {
+                printf("    %s: mip 0 mismatch\n", chain.name);
+                TEST_CHECK(false);
+            }
+        }
+
+        for (uint32_t mip = 1; mip < chain.mips.size(); mip++) {
+            Dim_t w = GetMipDim(chain.width, mip - 1);
+            Dim_t h = GetMipDim(chain.height, mip - 1);
+
+            std::vector<uint8_t> generated(chain.mips[mip].size());
+            GenerateMip(generated.data(), GetMipDim(chain.width, mip) * stride, chain.mips[mip - 1].data(), w * stride, chain.format, w, h, chain.mipGeneration == MipGeneration::NORMAL_MAP);
+
+            if (generated != chain.mips[mip]) {
+                printf("    %s: mip %u mismatch\n", chain.name, mip);
+                TEST_CHECK(false);
+            }
+        }
+    }
+}
+
+struct UploadDataTest {
+    // NONE doesn't implement "UploadData", validation runs the real one on top of it
+    inline UploadDataTest(TestContext& context, GraphicsAPI graphicsAPI)
+        : device(context, graphicsAPI, graphicsAPI == GraphicsAPI::NONE) {
+    }
+
+    inline ~UploadDataTest() {
+        if (texture)
+            device.core.DestroyTexture(texture);
+    }
+
+    inline Result Upload(const GoldenChain& chain, TextureType type = TextureType::TEXTURE_2D) {
+        return Upload(&chain, 1, type);
+    }
+
+    // A chain per layer
+    inline Result Upload(const GoldenChain* layers, Dim_t layerNum, TextureType type = TextureType::TEXTURE_2D) {
+        const GoldenChain& chain = layers[0];
+
+        if (texture)
+            device.core.DestroyTexture(texture);
+        texture = nullptr;
+
+        TextureDesc textureDesc = {};
+        textureDesc.type = type;
+        textureDesc.usage = TextureUsageBits::SHADER_RESOURCE;
+        textureDesc.format = chain.format;
+        textureDesc.width = chain.width;
+        textureDesc.height = chain.height;
+        textureDesc.mipNum = (Dim_t)chain.mips.size();
+        textureDesc.layerNum = layerNum;
+
+        Result result = device.core.CreateCommittedTexture(*device.device, MemoryLocation::DEVICE, 0.0f, textureDesc, texture);
+        if (result != Result::SUCCESS)
+            return result;
+
+        uint32_t dataStride = GetStride(chain.dataFormat != Format::UNKNOWN ? chain.dataFormat : chain.format);
+
+        std::vector<TextureSubresourceUploadDesc> subresources(layerNum);
+        for (Dim_t layer = 0; layer < layerNum; layer++) {
+            TextureSubresourceUploadDesc& subresource = subresources[layer];
+            subresource.slices = layers[layer].topMip.data();
+            subresource.sliceNum = 1;
+            subresource.rowPitch = chain.width * dataStride;
+            subresource.slicePitch = subresource.rowPitch * chain.height;
+        }
+
+        TextureUploadDesc textureUploadDesc = {};
+        textureUploadDesc.subresources = subresources.data();
+        textureUploadDesc.texture = texture;
+        textureUploadDesc.after = {AccessBits::COPY_SOURCE, Layout::COPY_SOURCE, StageBits::COPY};
+        textureUploadDesc.dataFormat = chain.dataFormat;
+        textureUploadDesc.mipGeneration = chain.mipGeneration;
+
+        return device.helper.UploadData(*device.queue, &textureUploadDesc, 1, nullptr, 0);
+    }
+
+    TestDevice device;
+    Texture* texture = nullptr;
+};
+
+NRI_TEST(NONE, UploadData_MipGeneration) {
+    UploadDataTest test(context, GraphicsAPI::NONE);
+    TEST_REQUIRE(test.device);
+
+    for (const GoldenChain& chain : GetGoldenChains())
+        TEST_CHECK(test.Upload(chain) == Result::SUCCESS);
+
+    // 3D textures are not supported
+    context.expectedErrorMessageNum = 1;
+    TEST_CHECK(test.Upload(GetGoldenChains()[0], TextureType::TEXTURE_3D) != Result::SUCCESS);
+}
+
+NRI_TEST(NONE, UploadData_MipGenerationLayers) {
+    UploadDataTest test(context, GraphicsAPI::NONE);
+    TEST_REQUIRE(test.device);
+
+    std::vector<GoldenChain> layers = GetLayerChains(8);
+    TEST_CHECK(test.Upload(layers.data(), (Dim_t)layers.size()) == Result::SUCCESS);
+}
+
+struct Readback {
+    inline Readback(TestContext& context, UploadDataTest& test)
+        : test(test) {
+        CoreInterface& core = test.device.core;
+
+        StreamerDesc streamerDesc = {};
+        streamerDesc.readbackBufferSize = 4 * 1024 * 1024;
+        streamerDesc.queuedFrameNum = 1;
+
+        TEST_CHECK(test.device.streamer.CreateStreamer(*test.device.device, streamerDesc, streamer) == Result::SUCCESS);
+        TEST_CHECK(core.CreateCommandAllocator(*test.device.queue, commandAllocator) == Result::SUCCESS);
+        TEST_CHECK(commandAllocator && core.CreateCommandBuffer(*commandAllocator, commandBuffer) == Result::SUCCESS);
+        TEST_CHECK(core.CreateFence(*test.device.device, 0, fence) == Result::SUCCESS);
+    }
+
+    inline ~Readback() {
+        CoreInterface& core = test.device.core;
+
+        if (fence)
+            core.DestroyFence(fence);
+        if (commandBuffer)
+            core.DestroyCommandBuffer(commandBuffer);
+        if (commandAllocator)
+            core.DestroyCommandAllocator(commandAllocator);
+        if (streamer)
+            test.device.streamer.DestroyStreamer(streamer);
+    }
+
+    inline explicit operator bool() const {
+        return streamer && commandBuffer && fence;
+    }
+
+    // Reads back all mips of a layer and compares them row by row (readback rows are aligned)
+    inline void Compare(TestContext& context, const GoldenChain& chain, Dim_t layer) {
+        CoreInterface& core = test.device.core;
+        StreamerInterface& iStreamer = test.device.streamer;
+
+        std::vector<uint64_t> tickets(chain.mips.size());
+        std::vector<TextureDataLayoutDesc> layouts(chain.mips.size());
+
+        core.ResetCommandAllocator(*commandAllocator);
+        core.BeginCommandBuffer(*commandBuffer, nullptr);
+        for (uint32_t mip = 0; mip < chain.mips.size(); mip++) {
+            TextureRegionDesc textureRegionDesc = {};
+            textureRegionDesc.width = WHOLE_SIZE;
+            textureRegionDesc.height = WHOLE_SIZE;
+            textureRegionDesc.depth = WHOLE_SIZE;
+            textureRegionDesc.mipOffset = (Dim_t)mip;
+            textureRegionDesc.layerOffset = layer;
+
+            tickets[mip] = iStreamer.CmdReadbackTexture(*commandBuffer, *streamer, *test.texture, textureRegionDesc, layouts[mip]);
+        }
+        core.EndCommandBuffer(*commandBuffer);
+
+        FenceSubmitDesc fenceSubmitDesc = {};
+        fenceSubmitDesc.fence = fence;
+        fenceSubmitDesc.value = ++fenceValue;
+
+        QueueSubmitDesc queueSubmitDesc = {};
+        queueSubmitDesc.commandBuffers = &commandBuffer;
+        queueSubmitDesc.commandBufferNum = 1;
+        queueSubmitDesc.signalFences = &fenceSubmitDesc;
+        queueSubmitDesc.signalFenceNum = 1;
+
+        core.QueueSubmit(*test.device.queue, queueSubmitDesc);
+        core.Wait(*fence, fenceValue);
+
+        iStreamer.EndStreamerFrame(*streamer);
+
+        uint32_t stride = GetStride(chain.format);
+        for (uint32_t mip = 0; mip < chain.mips.size(); mip++) {
+            const uint8_t* data = (const uint8_t*)iStreamer.TryGetReadbackData(*streamer, tickets[mip]);
+            if (!tickets[mip] || !data) {
+                printf("    %s %u: mip %u readback failed\n", chain.name, layer, mip);
+                TEST_CHECK(false);
+                continue;
+            }
+
+            Dim_t w = GetMipDim(chain.width, mip);
+            Dim_t h = GetMipDim(chain.height, mip);
+
+            bool isEqual = true;
+            for (Dim_t y = 0; y < h; y++)
+                isEqual = isEqual && !memcmp(data + layouts[mip].offset + y * layouts[mip].rowPitch, chain.mips[mip].data() + y * w * stride, w * stride);
+
+            if (!isEqual) {
+                printf("    %s %u: mip %u mismatch\n", chain.name, layer, mip);
+                TEST_CHECK(false);
+            }
+        }
+    }
+
+    UploadDataTest& test;
+    Streamer* streamer = nullptr;
+    CommandAllocator* commandAllocator = nullptr;
+    CommandBuffer* commandBuffer = nullptr;
+    Fence* fence = nullptr;
+    uint64_t fenceValue = 0;
+};
+
+NRI_TEST(VK, UploadData_GoldenChains) {
+    UploadDataTest test(context, GraphicsAPI::VK);
+    if (!test.device)
+        TEST_SKIP("no Vulkan adapter");
+
+    Readback readback(context, test);
+    TEST_REQUIRE(readback);
+
+    for (const GoldenChain& chain : GetGoldenChains()) {
+        if (test.Upload(chain) != Result::SUCCESS) {
+            printf("    %s: upload failed\n", chain.name);
+            TEST_CHECK(false);
+            continue;
+        }
+
+        readback.Compare(context, chain, 0);
+    }
+}
+
+NRI_TEST(VK, UploadData_GoldenChainsLayers) {
+    UploadDataTest test(context, GraphicsAPI::VK);
+    if (!test.device)
+        TEST_SKIP("no Vulkan adapter");
+
+    Readback readback(context, test);
+    TEST_REQUIRE(readback);
+
+    std::vector<GoldenChain> layers = GetLayerChains(8);
+    TEST_REQUIRE(test.Upload(layers.data(), (Dim_t)layers.size()) == Result::SUCCESS);
+
+    for (Dim_t layer = 0; layer < (Dim_t)layers.size(); layer++)
+        readback.Compare(context, layers[layer], layer);
+}
@@ -0,0 +1,55 @@
+// © 2026 NVIDIA Corporation
+
+// "CopyToUploadMemory" (non-temporal stores) against "memcpy": misaligned source and destination, sizes around vector, write-combining line and streaming thresholds
+
+#include "Tests.h"
+
+#include "SharedExternal.h"
+
+using namespace nri;
+
+constexpr size_t GUARD_SIZE = 64;
+constexpr uint8_t GUARD_VALUE = 0xCD;
+
+NRI_TEST(NONE, UploadMemory_CopyMatchesMemcpy) {
+    const size_t sizes[] = {
+        0, 1, 15, 16, 17, 63, 64, 65, 127, 128, 129,
+        STREAMING_COPY_MIN_SIZE - 1, STREAMING_COPY_MIN_SIZE, STREAMING_COPY_MIN_SIZE + 1,
+        STREAMING_COPY_MIN_SIZE + 15, STREAMING_COPY_MIN_SIZE + 63, STREAMING_COPY_MIN_SIZE + 65,
+        4096 + 3,
+    };
+
+    constexpr size_t maxSize = 4096 + 3;
+    constexpr size_t alignmentNum = 16;
+
+    // Guards on both sides catch writes out of "[dst, dst + size)"
+    std::vector<uint8_t> src(maxSize + alignmentNum);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = uint8_t(i * 7 + 1);
+
+    std::vector<uint8_t> dst(GUARD_SIZE + maxSize + alignmentNum + GUARD_SIZE);
+    std::vector<uint8_t> reference(dst.size());
+
+    // 16-byte aligned base, so "dstOffset" is the actual misalignment
+    uint8_t* dstBase = Align(dst.data() + GUARD_SIZE, 16);
+    uint8_t* referenceBase = reference.data() + (dstBase - dst.data());
+
+    for (size_t size : sizes) {
+        for (size_t dstOffset = 0; dstOffset < alignmentNum; dstOffset++) {
+            for (size_t srcOffset : {(size_t)0, (size_t)3}) {
+                memset(dst.data(), GUARD_VALUE, dst.size());
+                memset(reference.data(), GUARD_VALUE, reference.size());
+
+                CopyToUploadMemory(dstBase + dstOffset, src.data() + srcOffset, size);
+                FlushUploadMemoryWrites();
+
+                memcpy(referenceBase + dstOffset, src.data() + srcOffset, size);
+
+                if (memcmp(dst.data(), reference.data(), dst.size())) {
+                    printf("    size = %zu, dst offset = %zu, src offset = %zu\n", size, dstOffset, srcOffset);
+                    TEST_REQUIRE(false);
+                }
+            }
+        }
+    }
+}
@@ -13,6 +13,32 @@ struct InputAttachmentRange {
     Dim_t layerNum;
 };
 
+constexpr uint32_t SHADOW_DESCRIPTOR_SET_NUM = 8;
+constexpr uint32_t SHADOW_VERTEX_BUFFER_NUM = 16;
+constexpr uint32_t SHADOW_VIEWPORT_NUM = 16;
+constexpr uint64_t SHADOW_UNKNOWN = uint64_t(-1);
+
+struct VertexBufferBindingVK {
+    VkBuffer handle;
+    VkDeviceSize offset; // "SHADOW_UNKNOWN" if unknown
+    VkDeviceSize stride;
+};
+
+// The last state set by "CmdXxx" calls, used to drop redundant Vulkan calls. Anything beyond the fixed capacities is not filtered
+struct ShadowStateVK {
+    std::array<VkPipeline, (size_t)BindPoint::MAX_NUM> pipelines;
+    std::array<const PipelineLayoutVK*, (size_t)BindPoint::MAX_NUM> pipelineLayouts;
+    std::array<std::array<uint64_t, SHADOW_DESCRIPTOR_SET_NUM>, (size_t)BindPoint::MAX_NUM> descriptorSets; // handle or descriptor buffer offset
+    std::array<VertexBufferBindingVK, SHADOW_VERTEX_BUFFER_NUM> vertexBuffers;
+    std::array<VkViewport, SHADOW_VIEWPORT_NUM> viewports;
+    std::array<VkRect2D, SHADOW_VIEWPORT_NUM> scissors;
+    VkBuffer indexBuffer;
+    VkDeviceSize indexBufferOffset; // "SHADOW_UNKNOWN" if unknown
+    VkIndexType indexType;
+    uint32_t viewportNum; // "SHADOW_VIEWPORT_NUM + 1" if unknown
+    uint32_t scissorNum;  // "SHADOW_VIEWPORT_NUM + 1" if unknown
+};
+
 struct CommandBufferVK final : public DebugNameBase {
     inline CommandBufferVK(DeviceVK& device)
         : m_Device(device)
@@ -31,6 +57,8 @@ struct CommandBufferVK final : public DebugNameBase {
 
     void Create(VkCommandPool commandPool, VkCommandBuffer commandBuffer, QueueType type);
     Result Create(const CommandBufferVKDesc& commandBufferVKDesc);
+    void InvalidateShadowState();
+    void ExecuteCommands(const VkCommandBuffer* commandBuffers, uint32_t commandBufferNum);
 
     //================================================================================================================
     // DebugNameBase
@@ -44,6 +72,7 @@ struct CommandBufferVK final : public DebugNameBase {
 
     Result Begin(const DescriptorPool* descriptorPool);
     Result End();
+    void SetDescriptorPool(const DescriptorPool& descriptorPool);
     void SetPipeline(const Pipeline& pipeline);
     void SetPipelineLayout(BindPoint bindPoint, const PipelineLayout& pipelineLayout);
     void SetDescriptorSet(const SetDescriptorSetDesc& setDescriptorSetDesc);
@@ -60,12 +89,20 @@ struct CommandBufferVK final : public DebugNameBase {
     void SetBlendConstants(const Color32f& color);
     void SetShadingRate(const ShadingRateDesc& shadingRateDesc);
     void SetDepthBias(const DepthBiasDesc& depthBiasDesc);
+    void SetTopology(Topology topology, PrimitiveRestart primitiveRestart);
+    void SetCullMode(CullMode cullMode);
+    void SetFrontFace(bool frontCounterClockwise);
+    void SetDepthState(const DepthAttachmentDesc& depth);
+    void SetStencilState(const StencilAttachmentDesc& stencil);
+    void SetColorState(uint32_t baseAttachment, const ColorAttachmentDesc* colors, uint32_t colorNum);
     void ClearAttachments(const ClearAttachmentDesc* clearAttachmentDescs, uint32_t clearAttachmentDescNum, const Rect* rects, uint32_t rectNum);
     void ClearStorage(const ClearStorageDesc& clearStorageDesc);
     void SetIndexBuffer(const Buffer& buffer, uint64_t offset, IndexType indexType);
     void SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum);
     void Draw(const DrawDesc& drawDesc);
     void DrawIndexed(const DrawIndexedDesc& drawIndexedDesc);
+    void DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride);
+    void DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride);
     void DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void Dispatch(const DispatchDesc& dispatchDesc);
@@ -96,7 +133,12 @@ struct CommandBufferVK final : public DebugNameBase {
     void DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
 
 private:
+    void InvalidateDescriptorSets(BindPoint bindPoint);
+    void InvalidateVertexBuffers();
+
     DeviceVK& m_Device;
+    ShadowStateVK m_ShadowState = {};
+    RedundantCommandStats m_RedundantCommandStats = {}; // flushed to the device in "End"
     const PipelineLayoutVK* m_PipelineLayout = nullptr;
     const DescriptorVK* m_DepthStencil = nullptr;
     Vector<InputAttachmentRange> m_InputAttachmentRanges;
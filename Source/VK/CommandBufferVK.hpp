@@ -13,6 +13,17 @@ static inline VkPipelineBindPoint GetPipelineBindPoint(BindPoint bindPoint) {
     }
 }
 
+static inline BindPoint GetBindPoint(VkPipelineBindPoint vkPipelineBindPoint) {
+    switch (vkPipelineBindPoint) {
+        case VK_PIPELINE_BIND_POINT_COMPUTE:
+            return BindPoint::COMPUTE;
+        case VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR:
+            return BindPoint::RAY_TRACING;
+        default:
+            return BindPoint::GRAPHICS;
+    }
+}
+
 static inline bool RangesOverlap(const InputAttachmentRange& a, const VkImageSubresourceRange& b) {
     uint32_t mipOffset = a.mipOffset;
     uint32_t mipNum = a.mipNum;
@@ -338,11 +349,42 @@ Result CommandBufferVK::Create(const CommandBufferVKDesc& commandBufferVKDesc) {
     return Result::SUCCESS;
 }
 
+void CommandBufferVK::InvalidateShadowState() {
+    m_ShadowState.pipelines = {};
+    m_ShadowState.pipelineLayouts = {};
+
+    for (uint32_t i = 0; i < (uint32_t)BindPoint::MAX_NUM; i++)
+        InvalidateDescriptorSets((BindPoint)i);
+
+    InvalidateVertexBuffers();
+
+    m_ShadowState.indexBufferOffset = SHADOW_UNKNOWN;
+    m_ShadowState.viewportNum = SHADOW_VIEWPORT_NUM + 1;
+    m_ShadowState.scissorNum = SHADOW_VIEWPORT_NUM + 1;
+}
+
+void CommandBufferVK::InvalidateDescriptorSets(BindPoint bindPoint) {
+    m_ShadowState.descriptorSets[(size_t)bindPoint].fill(SHADOW_UNKNOWN);
+}
+
+void CommandBufferVK::InvalidateVertexBuffers() {
+    for (VertexBufferBindingVK& vertexBuffer : m_ShadowState.vertexBuffers)
+        vertexBuffer.offset = SHADOW_UNKNOWN;
+}
+
+void CommandBufferVK::ExecuteCommands(const VkCommandBuffer* commandBuffers, uint32_t commandBufferNum) {
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdExecuteCommands(m_Handle, commandBufferNum, commandBuffers);
+
+    // The state bound in the primary command buffer is undefined after "vkCmdExecuteCommands"
+    InvalidateShadowState();
+}
+
 NRI_INLINE void CommandBufferVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_COMMAND_BUFFER, (uint64_t)m_Handle, name);
 }
 
-NRI_INLINE Result CommandBufferVK::Begin(const DescriptorPool*) {
+NRI_INLINE Result CommandBufferVK::Begin(const DescriptorPool* descriptorPool) {
     VkCommandBufferBeginInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
     info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 
@@ -353,15 +395,46 @@ NRI_INLINE Result CommandBufferVK::Begin(const DescriptorPool*) {
     m_PipelineLayout = nullptr;
     m_PipelineBindPoint = BindPoint::INHERIT;
     m_InputAttachmentRanges.clear();
+    m_RedundantCommandStats = {};
+
+    InvalidateShadowState();
+
+    if (descriptorPool)
+        SetDescriptorPool(*descriptorPool);
 
     return Result::SUCCESS;
 }
 
+NRI_INLINE void CommandBufferVK::SetDescriptorPool(const DescriptorPool& descriptorPool) {
+    if (!m_Device.m_IsSupported.descriptorBuffer)
+        return;
+
+    const DescriptorPoolVK& descriptorPoolVK = (DescriptorPoolVK&)descriptorPool;
+    const DescriptorBufferPropsVK& props = m_Device.GetDescriptorBufferProps();
+
+    VkDescriptorBufferBindingPushDescriptorBufferHandleEXT pushDescriptorBufferHandle = {VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_PUSH_DESCRIPTOR_BUFFER_HANDLE_EXT};
+    pushDescriptorBufferHandle.buffer = descriptorPoolVK.GetDescriptorBuffer();
+
+    VkDescriptorBufferBindingInfoEXT info = {VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT};
+    info.pNext = props.bufferlessPushDescriptors ? nullptr : &pushDescriptorBufferHandle;
+    info.address = descriptorPoolVK.GetDescriptorBufferAddress();
+    info.usage = descriptorPoolVK.GetDescriptorBufferUsage();
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdBindDescriptorBuffersEXT(m_Handle, 1, &info);
+
+    // Offsets are relative to the bound descriptor buffer
+    for (uint32_t i = 0; i < (uint32_t)BindPoint::MAX_NUM; i++)
+        InvalidateDescriptorSets((BindPoint)i);
+}
+
 NRI_INLINE Result CommandBufferVK::End() {
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.EndCommandBuffer(m_Handle);
     NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkEndCommandBuffer");
 
+    m_Device.AccumulateRedundantCommandStats(m_RedundantCommandStats);
+
     return Result::SUCCESS;
 }
 
@@ -389,6 +462,17 @@ NRI_INLINE void CommandBufferVK::SetViewports(const Viewport* viewports, uint32_
     for (uint32_t i = viewportNum; i < vkViewportNum; i++)
         vkViewports[i] = vkViewports[viewportNum - 1];
 
+    if (vkViewportNum <= SHADOW_VIEWPORT_NUM) {
+        if (m_ShadowState.viewportNum == vkViewportNum && !memcmp(m_ShadowState.viewports.data(), vkViewports, vkViewportNum * sizeof(VkViewport))) {
+            m_RedundantCommandStats.viewportNum++;
+            return;
+        }
+
+        memcpy(m_ShadowState.viewports.data(), vkViewports, vkViewportNum * sizeof(VkViewport));
+        m_ShadowState.viewportNum = vkViewportNum;
+    } else
+        m_ShadowState.viewportNum = SHADOW_VIEWPORT_NUM + 1;
+
     const auto& vk = m_Device.GetDispatchTable();
     if (deviceDesc.features.extendedDynamicState)
         vk.CmdSetViewportWithCount(m_Handle, viewportNum, vkViewports);
@@ -412,6 +496,17 @@ NRI_INLINE void CommandBufferVK::SetScissors(const Rect* rects, uint32_t rectNum
     for (uint32_t i = rectNum; i < vkRectNum; i++)
         vkRects[i] = vkRects[rectNum - 1];
 
+    if (vkRectNum <= SHADOW_VIEWPORT_NUM) {
+        if (m_ShadowState.scissorNum == vkRectNum && !memcmp(m_ShadowState.scissors.data(), vkRects, vkRectNum * sizeof(VkRect2D))) {
+            m_RedundantCommandStats.scissorNum++;
+            return;
+        }
+
+        memcpy(m_ShadowState.scissors.data(), vkRects, vkRectNum * sizeof(VkRect2D));
+        m_ShadowState.scissorNum = vkRectNum;
+    } else
+        m_ShadowState.scissorNum = SHADOW_VIEWPORT_NUM + 1;
+
     const auto& vk = m_Device.GetDispatchTable();
     if (deviceDesc.features.extendedDynamicState)
         vk.CmdSetScissorWithCount(m_Handle, rectNum, vkRects);
@@ -473,6 +568,71 @@ NRI_INLINE void CommandBufferVK::SetDepthBias(const DepthBiasDesc& depthBiasDesc
     vk.CmdSetDepthBias(m_Handle, depthBiasDesc.constant, depthBiasDesc.clamp, depthBiasDesc.slope);
 }
 
+NRI_INLINE void CommandBufferVK::SetTopology(Topology topology, PrimitiveRestart primitiveRestart) {
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdSetPrimitiveTopology(m_Handle, GetTopology(topology));
+    vk.CmdSetPrimitiveRestartEnable(m_Handle, primitiveRestart != PrimitiveRestart::DISABLED);
+}
+
+NRI_INLINE void CommandBufferVK::SetCullMode(CullMode cullMode) {
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdSetCullMode(m_Handle, GetCullMode(cullMode));
+}
+
+NRI_INLINE void CommandBufferVK::SetFrontFace(bool frontCounterClockwise) {
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdSetFrontFace(m_Handle, frontCounterClockwise ? VK_FRONT_FACE_COUNTER_CLOCKWISE : VK_FRONT_FACE_CLOCKWISE);
+}
+
+NRI_INLINE void CommandBufferVK::SetDepthState(const DepthAttachmentDesc& depth) {
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdSetDepthTestEnable(m_Handle, depth.compareOp != CompareOp::NONE);
+    vk.CmdSetDepthWriteEnable(m_Handle, depth.write);
+    vk.CmdSetDepthCompareOp(m_Handle, GetCompareOp(depth.compareOp));
+
+    if (m_Device.GetDesc().features.depthBoundsTest)
+        vk.CmdSetDepthBoundsTestEnable(m_Handle, depth.boundsTest);
+}
+
+NRI_INLINE void CommandBufferVK::SetStencilState(const StencilAttachmentDesc& stencil) {
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdSetStencilTestEnable(m_Handle, (stencil.front.compareOp == CompareOp::NONE && stencil.back.compareOp == CompareOp::NONE) ? VK_FALSE : VK_TRUE);
+
+    vk.CmdSetStencilOp(m_Handle, VK_STENCIL_FACE_FRONT_BIT, GetStencilOp(stencil.front.failOp), GetStencilOp(stencil.front.passOp), GetStencilOp(stencil.front.depthFailOp), GetCompareOp(stencil.front.compareOp));
+    vk.CmdSetStencilCompareMask(m_Handle, VK_STENCIL_FACE_FRONT_BIT, stencil.front.compareMask);
+    vk.CmdSetStencilWriteMask(m_Handle, VK_STENCIL_FACE_FRONT_BIT, stencil.front.writeMask);
+
+    vk.CmdSetStencilOp(m_Handle, VK_STENCIL_FACE_BACK_BIT, GetStencilOp(stencil.back.failOp), GetStencilOp(stencil.back.passOp), GetStencilOp(stencil.back.depthFailOp), GetCompareOp(stencil.back.compareOp));
+    vk.CmdSetStencilCompareMask(m_Handle, VK_STENCIL_FACE_BACK_BIT, stencil.back.compareMask);
+    vk.CmdSetStencilWriteMask(m_Handle, VK_STENCIL_FACE_BACK_BIT, stencil.back.writeMask);
+}
+
+NRI_INLINE void CommandBufferVK::SetColorState(uint32_t baseAttachment, const ColorAttachmentDesc* colors, uint32_t colorNum) {
+    Scratch<VkBool32> blendEnables = NRI_ALLOCATE_SCRATCH(m_Device, VkBool32, colorNum);
+    Scratch<VkColorBlendEquationEXT> blendEquations = NRI_ALLOCATE_SCRATCH(m_Device, VkColorBlendEquationEXT, colorNum);
+    Scratch<VkColorComponentFlags> writeMasks = NRI_ALLOCATE_SCRATCH(m_Device, VkColorComponentFlags, colorNum);
+
+    for (uint32_t i = 0; i < colorNum; i++) {
+        const ColorAttachmentDesc& in = colors[i];
+
+        blendEnables[i] = VkBool32(in.blendEnabled);
+        blendEquations[i] = {
+            GetBlendFactor(in.colorBlend.srcFactor),
+            GetBlendFactor(in.colorBlend.dstFactor),
+            GetBlendOp(in.colorBlend.op),
+            GetBlendFactor(in.alphaBlend.srcFactor),
+            GetBlendFactor(in.alphaBlend.dstFactor),
+            GetBlendOp(in.alphaBlend.op),
+        };
+        writeMasks[i] = GetColorComponent(in.colorWriteMask);
+    }
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdSetColorBlendEnableEXT(m_Handle, baseAttachment, colorNum, blendEnables);
+    vk.CmdSetColorBlendEquationEXT(m_Handle, baseAttachment, colorNum, blendEquations);
+    vk.CmdSetColorWriteMaskEXT(m_Handle, baseAttachment, colorNum, writeMasks);
+}
+
 NRI_INLINE void CommandBufferVK::ClearAttachments(const ClearAttachmentDesc* clearAttachmentDescs, uint32_t clearAttachmentDescNum, const Rect* rects, uint32_t rectNum) {
     static_assert(sizeof(VkClearValue) == sizeof(ClearValue), "Sizeof mismatch");
 
@@ -565,6 +725,10 @@ NRI_INLINE void CommandBufferVK::ClearStorage(const ClearStorageDesc& clearStora
 }
 
 NRI_INLINE void CommandBufferVK::BeginRendering(const RenderingDesc& renderingDesc) {
+    // Be conservative: viewports and scissors are expected to be set for each pass
+    m_ShadowState.viewportNum = SHADOW_VIEWPORT_NUM + 1;
+    m_ShadowState.scissorNum = SHADOW_VIEWPORT_NUM + 1;
+
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
     Dim_t renderWidth = deviceDesc.dimensions.attachmentMaxDim;
     Dim_t renderHeight = deviceDesc.dimensions.attachmentMaxDim;
@@ -858,28 +1022,74 @@ NRI_INLINE void CommandBufferVK::SetVertexBuffers(uint32_t baseSlot, const Verte
         }
     }
 
+    // Bind only the sub-range which differs from the shadow state
+    uint32_t first = 0;
+    uint32_t last = vertexBufferNum;
+    if (baseSlot + vertexBufferNum <= SHADOW_VERTEX_BUFFER_NUM) {
+        first = vertexBufferNum;
+        last = 0;
+
+        for (uint32_t i = 0; i < vertexBufferNum; i++) {
+            VertexBufferBindingVK& binding = m_ShadowState.vertexBuffers[baseSlot + i];
+            if (binding.handle != handles[i] || binding.offset != offsets[i] || binding.stride != strides[i]) {
+                binding = {handles[i], offsets[i], strides[i]};
+
+                first = std::min(first, i);
+                last = i + 1;
+            }
+        }
+
+        if (first >= last) {
+            m_RedundantCommandStats.vertexBufferNum++;
+            return;
+        }
+    } else
+        InvalidateVertexBuffers();
+
+    uint32_t num = last - first;
+
     const auto& vk = m_Device.GetDispatchTable();
     if (m_Device.GetDesc().features.extendedDynamicState)
-        vk.CmdBindVertexBuffers2(m_Handle, baseSlot, vertexBufferNum, handles, offsets, sizes, strides);
+        vk.CmdBindVertexBuffers2(m_Handle, baseSlot + first, num, handles + first, offsets + first, sizes + first, strides + first);
     else
-        vk.CmdBindVertexBuffers(m_Handle, baseSlot, vertexBufferNum, handles, offsets);
+        vk.CmdBindVertexBuffers(m_Handle, baseSlot + first, num, handles + first, offsets + first);
 }
 
 NRI_INLINE void CommandBufferVK::SetIndexBuffer(const Buffer& buffer, uint64_t offset, IndexType indexType) {
     const BufferVK& bufferVK = (BufferVK&)buffer;
+    VkIndexType vkIndexType = GetIndexType(indexType);
+
+    if (m_ShadowState.indexBuffer == bufferVK.GetHandle() && m_ShadowState.indexBufferOffset == offset && m_ShadowState.indexType == vkIndexType) {
+        m_RedundantCommandStats.indexBufferNum++;
+        return;
+    }
+
+    m_ShadowState.indexBuffer = bufferVK.GetHandle();
+    m_ShadowState.indexBufferOffset = offset;
+    m_ShadowState.indexType = vkIndexType;
 
     const auto& vk = m_Device.GetDispatchTable();
     if (m_Device.m_IsSupported.maintenance5) {
         uint64_t size = bufferVK.GetDesc().size - offset;
-        vk.CmdBindIndexBuffer2(m_Handle, bufferVK.GetHandle(), offset, size, GetIndexType(indexType));
+        vk.CmdBindIndexBuffer2(m_Handle, bufferVK.GetHandle(), offset, size, vkIndexType);
     } else
-        vk.CmdBindIndexBuffer(m_Handle, bufferVK.GetHandle(), offset, GetIndexType(indexType));
+        vk.CmdBindIndexBuffer(m_Handle, bufferVK.GetHandle(), offset, vkIndexType);
 }
 
 NRI_INLINE void CommandBufferVK::SetPipelineLayout(BindPoint bindPoint, const PipelineLayout& pipelineLayout) {
     m_PipelineLayout = (PipelineLayoutVK*)&pipelineLayout;
     m_PipelineBindPoint = bindPoint;
 
+    // Same layout: immutable samplers and bound descriptor sets are still valid
+    BindPoint shadowBindPoint = GetBindPoint(GetPipelineBindPoint(bindPoint));
+    if (m_ShadowState.pipelineLayouts[(size_t)shadowBindPoint] == m_PipelineLayout) {
+        m_RedundantCommandStats.pipelineLayoutNum++;
+        return;
+    }
+
+    m_ShadowState.pipelineLayouts[(size_t)shadowBindPoint] = m_PipelineLayout;
+    InvalidateDescriptorSets(shadowBindPoint);
+
     { // Push immutable samplers
         const auto& bindingInfo = m_PipelineLayout->GetBindingInfo();
 
@@ -904,9 +1114,28 @@ NRI_INLINE void CommandBufferVK::SetPipelineLayout(BindPoint bindPoint, const Pi
 
 NRI_INLINE void CommandBufferVK::SetPipeline(const Pipeline& pipeline) {
     const PipelineVK& pipelineVK = (PipelineVK&)pipeline;
+    VkPipeline vkPipeline = pipelineVK;
 
     const auto& vk = m_Device.GetDispatchTable();
-    vk.CmdBindPipeline(m_Handle, pipelineVK.GetBindPoint(), pipelineVK);
+    BindPoint shadowBindPoint = GetBindPoint(pipelineVK.GetBindPoint());
+    if (m_ShadowState.pipelines[(size_t)shadowBindPoint] == vkPipeline)
+        m_RedundantCommandStats.pipelineNum++;
+    else {
+        m_ShadowState.pipelines[(size_t)shadowBindPoint] = vkPipeline;
+
+        vk.CmdBindPipeline(m_Handle, pipelineVK.GetBindPoint(), vkPipeline);
+
+        // Static pipeline state overrides previously set dynamic state
+        if (shadowBindPoint == BindPoint::GRAPHICS) {
+            if (!pipelineVK.HasDynamicVertexStride())
+                InvalidateVertexBuffers();
+
+            if (!pipelineVK.OwnsNativeObjects()) {
+                m_ShadowState.viewportNum = SHADOW_VIEWPORT_NUM + 1;
+                m_ShadowState.scissorNum = SHADOW_VIEWPORT_NUM + 1;
+            }
+        }
+    }
 
     // Set depth bias provided at pipeline creation time to match D3D12 behavior
     const DepthBiasDesc& depthBias = pipelineVK.GetDepthBias();
@@ -923,7 +1152,27 @@ NRI_INLINE void CommandBufferVK::SetDescriptorSet(const SetDescriptorSetDesc& se
 
     BindPoint bindPoint = setDescriptorSetDesc.bindPoint == BindPoint::INHERIT ? m_PipelineBindPoint : setDescriptorSetDesc.bindPoint;
 
+    if (registerSpace < SHADOW_DESCRIPTOR_SET_NUM) {
+        uint64_t key = m_Device.m_IsSupported.descriptorBuffer ? descriptorSetVK.GetDescriptorBufferOffset() : (uint64_t)vkDescriptorSet;
+        uint64_t& shadowKey = m_ShadowState.descriptorSets[(size_t)GetBindPoint(GetPipelineBindPoint(bindPoint))][registerSpace];
+        if (shadowKey == key) {
+            m_RedundantCommandStats.descriptorSetNum++;
+            return;
+        }
+
+        shadowKey = key;
+    }
+
     const auto& vk = m_Device.GetDispatchTable();
+    if (m_Device.m_IsSupported.descriptorBuffer) {
+        VkPipelineBindPoint vkPipelineBindPoint = GetPipelineBindPoint(bindPoint);
+        VkDeviceSize offset = descriptorSetVK.GetDescriptorBufferOffset();
+        uint32_t bufferIndex = 0; // the descriptor pool buffer (see "SetDescriptorPool")
+
+        vk.CmdSetDescriptorBufferOffsetsEXT(m_Handle, vkPipelineBindPoint, *m_PipelineLayout, registerSpace, 1, &bufferIndex, &offset);
+        return;
+    }
+
 #if 0 // TODO: NV driver can crash if VVL is enabled...
     if (m_Device.m_IsSupported.maintenance6) {
         StageBits shaderStages = StageBits::NONE;
@@ -1032,6 +1281,73 @@ NRI_INLINE void CommandBufferVK::DrawIndexed(const DrawIndexedDesc& drawIndexedD
     vk.CmdDrawIndexed(m_Handle, drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
 }
 
+NRI_INLINE void CommandBufferVK::DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    const auto& vk = m_Device.GetDispatchTable();
+    const uint8_t* descs = (uint8_t*)drawDescs;
+
+    if (!m_Device.m_IsSupported.multiDraw) {
+        for (uint32_t i = 0; i < drawNum; i++) {
+            const DrawDesc& drawDesc = *(DrawDesc*)(descs + (size_t)i * stride);
+            vk.CmdDraw(m_Handle, drawDesc.vertexNum, drawDesc.instanceNum, drawDesc.baseVertex, drawDesc.baseInstance);
+        }
+
+        return;
+    }
+
+    // "instanceCount" and "firstInstance" are shared, so batch consecutive draws with the same instancing
+    uint32_t batchMaxNum = std::min(drawNum, m_Device.GetMultiDrawMaxNum());
+    Scratch<VkMultiDrawInfoEXT> infos = NRI_ALLOCATE_SCRATCH(m_Device, VkMultiDrawInfoEXT, batchMaxNum);
+
+    for (uint32_t i = 0; i < drawNum;) {
+        const DrawDesc& firstDrawDesc = *(DrawDesc*)(descs + (size_t)i * stride);
+
+        uint32_t batchNum = 0;
+        for (; i < drawNum && batchNum < batchMaxNum; i++) {
+            const DrawDesc& drawDesc = *(DrawDesc*)(descs + (size_t)i * stride);
+            if (drawDesc.instanceNum != firstDrawDesc.instanceNum || drawDesc.baseInstance != firstDrawDesc.baseInstance)
+                break;
+
+            infos[batchNum++] = {drawDesc.baseVertex, drawDesc.vertexNum};
+        }
+
+        vk.CmdDrawMultiEXT(m_Handle, batchNum, infos, firstDrawDesc.instanceNum, firstDrawDesc.baseInstance, sizeof(VkMultiDrawInfoEXT));
+    }
+}
+
+NRI_INLINE void CommandBufferVK::DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    const auto& vk = m_Device.GetDispatchTable();
+    const uint8_t* descs = (uint8_t*)drawIndexedDescs;
+
+    if (!m_Device.m_IsSupported.multiDraw) {
+        for (uint32_t i = 0; i < drawNum; i++) {
+            const DrawIndexedDesc& drawIndexedDesc = *(DrawIndexedDesc*)(descs + (size_t)i * stride);
+            vk.CmdDrawIndexed(m_Handle, drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
+        }
+
+        return;
+    }
+
+    // "instanceCount" and "firstInstance" are shared, so batch consecutive draws with the same instancing
+    uint32_t batchMaxNum = std::min(drawNum, m_Device.GetMultiDrawMaxNum());
+    Scratch<VkMultiDrawIndexedInfoEXT> infos = NRI_ALLOCATE_SCRATCH(m_Device, VkMultiDrawIndexedInfoEXT, batchMaxNum);
+
+    for (uint32_t i = 0; i < drawNum;) {
+        const DrawIndexedDesc& firstDrawIndexedDesc = *(DrawIndexedDesc*)(descs + (size_t)i * stride);
+
+        uint32_t batchNum = 0;
+        for (; i < drawNum && batchNum < batchMaxNum; i++) {
+            const DrawIndexedDesc& drawIndexedDesc = *(DrawIndexedDesc*)(descs + (size_t)i * stride);
+            if (drawIndexedDesc.instanceNum != firstDrawIndexedDesc.instanceNum || drawIndexedDesc.baseInstance != firstDrawIndexedDesc.baseInstance)
+                break;
+
+            infos[batchNum++] = {drawIndexedDesc.baseIndex, drawIndexedDesc.indexNum, drawIndexedDesc.baseVertex};
+        }
+
+        // "pVertexOffset = NULL": per draw "vertexOffset" is used
+        vk.CmdDrawMultiIndexedEXT(m_Handle, batchNum, infos, firstDrawIndexedDesc.instanceNum, firstDrawIndexedDesc.baseInstance, sizeof(VkMultiDrawIndexedInfoEXT), nullptr);
+    }
+}
+
 NRI_INLINE void CommandBufferVK::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     const BufferVK& bufferVK = (BufferVK&)buffer;
     const auto& vk = m_Device.GetDispatchTable();
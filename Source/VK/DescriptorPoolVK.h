@@ -20,6 +20,18 @@ struct DescriptorPoolVK final : public DebugNameBase {
         return m_Device;
     }
 
+    inline VkDeviceAddress GetDescriptorBufferAddress() const {
+        return m_DescriptorBufferAddress;
+    }
+
+    inline VkBuffer GetDescriptorBuffer() const {
+        return m_DescriptorBuffer;
+    }
+
+    inline VkBufferUsageFlags GetDescriptorBufferUsage() const {
+        return m_DescriptorBufferUsage;
+    }
+
     ~DescriptorPoolVK();
 
     Result Create(const DescriptorPoolDesc& descriptorPoolDesc);
@@ -39,9 +51,22 @@ struct DescriptorPoolVK final : public DebugNameBase {
     Result AllocateDescriptorSets(const PipelineLayout& pipelineLayout, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum);
 
 private:
+    Result CreateDescriptorBuffer(const DescriptorPoolDesc& descriptorPoolDesc);
+    Result AllocateDescriptorBufferSets(const PipelineLayoutVK& pipelineLayoutVK, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum);
+
     DeviceVK& m_Device;
     VkDescriptorPool m_Handle = VK_NULL_HANDLE;
     Vector<DescriptorSetVK> m_DescriptorSets;
+
+    // "VK_EXT_descriptor_buffer" only
+    VkBuffer m_DescriptorBuffer = VK_NULL_HANDLE;
+    VmaAllocation m_DescriptorBufferAllocation = nullptr;
+    uint8_t* m_DescriptorBufferData = nullptr;
+    VkDeviceAddress m_DescriptorBufferAddress = 0;
+    VkDeviceSize m_DescriptorBufferSize = 0;
+    VkDeviceSize m_DescriptorBufferOffset = 0;
+    VkBufferUsageFlags m_DescriptorBufferUsage = 0;
+
     uint32_t m_DescriptorSetNum = 0;
     bool m_OwnsNativeObjects = true;
     Lock m_Lock;
@@ -2,8 +2,12 @@
 
 DescriptorPoolVK::~DescriptorPoolVK() {
     if (m_OwnsNativeObjects) {
-        const auto& vk = m_Device.GetDispatchTable();
-        vk.DestroyDescriptorPool(m_Device, m_Handle, m_Device.GetVkAllocationCallbacks());
+        if (m_DescriptorBufferAllocation)
+            vmaDestroyBuffer(m_Device.GetVma(), m_DescriptorBuffer, m_DescriptorBufferAllocation);
+        else {
+            const auto& vk = m_Device.GetDispatchTable();
+            vk.DestroyDescriptorPool(m_Device, m_Handle, m_Device.GetVkAllocationCallbacks());
+        }
     }
 }
 
@@ -15,7 +19,59 @@ static inline void AddDescriptorPoolSize(std::array<VkDescriptorPoolSize, 16>& p
     }
 }
 
+Result DescriptorPoolVK::CreateDescriptorBuffer(const DescriptorPoolDesc& descriptorPoolDesc) {
+    const DescriptorBufferPropsVK& props = m_Device.GetDescriptorBufferProps();
+    const auto& sizes = props.descriptorSizes;
+
+    // Worst case: each set is padded to "offsetAlignment"
+    VkDeviceSize size = descriptorPoolDesc.descriptorSetMaxNum * props.offsetAlignment;
+    size += (VkDeviceSize)descriptorPoolDesc.samplerMaxNum * sizes[(size_t)DescriptorType::SAMPLER];
+    size += (VkDeviceSize)descriptorPoolDesc.mutableMaxNum * sizes[(size_t)DescriptorType::MUTABLE];
+    size += (VkDeviceSize)descriptorPoolDesc.constantBufferMaxNum * sizes[(size_t)DescriptorType::CONSTANT_BUFFER];
+    size += (VkDeviceSize)descriptorPoolDesc.textureMaxNum * sizes[(size_t)DescriptorType::TEXTURE];
+    size += (VkDeviceSize)descriptorPoolDesc.storageTextureMaxNum * sizes[(size_t)DescriptorType::STORAGE_TEXTURE];
+    size += (VkDeviceSize)descriptorPoolDesc.bufferMaxNum * sizes[(size_t)DescriptorType::BUFFER];
+    size += (VkDeviceSize)descriptorPoolDesc.storageBufferMaxNum * sizes[(size_t)DescriptorType::STORAGE_BUFFER];
+    size += (VkDeviceSize)(descriptorPoolDesc.structuredBufferMaxNum + descriptorPoolDesc.storageStructuredBufferMaxNum) * sizes[(size_t)DescriptorType::STRUCTURED_BUFFER];
+    size += (VkDeviceSize)descriptorPoolDesc.accelerationStructureMaxNum * sizes[(size_t)DescriptorType::ACCELERATION_STRUCTURE];
+    size += (VkDeviceSize)descriptorPoolDesc.inputAttachmentMaxNum * sizes[(size_t)DescriptorType::INPUT_ATTACHMENT];
+
+    m_DescriptorBufferUsage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    if (!props.bufferlessPushDescriptors)
+        m_DescriptorBufferUsage |= VK_BUFFER_USAGE_PUSH_DESCRIPTORS_DESCRIPTOR_BUFFER_BIT_EXT;
+
+    VkBufferCreateInfo bufferCreateInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    bufferCreateInfo.size = std::max(size, (VkDeviceSize)props.offsetAlignment);
+    bufferCreateInfo.usage = m_DescriptorBufferUsage;
+    bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    // Descriptors are written by CPU and read by GPU, as in D3D12 shader-visible heaps
+    VmaAllocationCreateInfo allocationCreateInfo = {};
+    allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
+    allocationCreateInfo.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+    VmaAllocationInfo allocationInfo = {};
+    VkResult vkResult = vmaCreateBuffer(m_Device.GetVma(), &bufferCreateInfo, &allocationCreateInfo, &m_DescriptorBuffer, &m_DescriptorBufferAllocation, &allocationInfo);
+    NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vmaCreateBuffer");
+
+    VkBufferDeviceAddressInfo bufferDeviceAddressInfo = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO};
+    bufferDeviceAddressInfo.buffer = m_DescriptorBuffer;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    m_DescriptorBufferAddress = vk.GetBufferDeviceAddress(m_Device, &bufferDeviceAddressInfo);
+    m_DescriptorBufferData = (uint8_t*)allocationInfo.pMappedData;
+    m_DescriptorBufferSize = bufferCreateInfo.size;
+
+    m_DescriptorSets.resize(descriptorPoolDesc.descriptorSetMaxNum);
+
+    return Result::SUCCESS;
+}
+
 Result DescriptorPoolVK::Create(const DescriptorPoolDesc& descriptorPoolDesc) {
+    if (m_Device.m_IsSupported.descriptorBuffer)
+        return CreateDescriptorBuffer(descriptorPoolDesc);
+
     std::array<VkDescriptorPoolSize, 16> poolSizes = {};
     uint32_t poolSizeNum = 0;
 
@@ -54,13 +110,54 @@ Result DescriptorPoolVK::Create(const DescriptorPoolVKDesc& descriptorPoolVKDesc
 }
 
 NRI_INLINE void DescriptorPoolVK::SetDebugName(const char* name) {
-    m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_DESCRIPTOR_POOL, (uint64_t)m_Handle, name);
+    if (m_DescriptorBuffer)
+        m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_BUFFER, (uint64_t)m_DescriptorBuffer, name);
+    else
+        m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_DESCRIPTOR_POOL, (uint64_t)m_Handle, name);
+}
+
+Result DescriptorPoolVK::AllocateDescriptorBufferSets(const PipelineLayoutVK& pipelineLayoutVK, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum) {
+    const DescriptorBufferPropsVK& props = m_Device.GetDescriptorBufferProps();
+    const DescriptorBufferSetLayoutVK& setLayout = pipelineLayoutVK.GetDescriptorBufferSetLayout(setIndex);
+    const DescriptorSetDesc* descriptorSetDesc = &pipelineLayoutVK.GetBindingInfo().sets[setIndex];
+
+    // A variable sized array is always the last binding, i.e. the set ends right after it
+    VkDeviceSize setSize = setLayout.size;
+    if (descriptorSetDesc->rangeNum) {
+        uint32_t lastRangeIndex = descriptorSetDesc->rangeNum - 1;
+        const DescriptorRangeDesc& lastRange = descriptorSetDesc->ranges[lastRangeIndex];
+
+        if (lastRange.flags & DescriptorRangeBits::VARIABLE_SIZED_ARRAY) {
+            VkDeviceSize bindingOffset = setLayout.bindingOffsets[setLayout.rangeBindings[lastRangeIndex]];
+            setSize = bindingOffset + (VkDeviceSize)variableDescriptorNum * props.descriptorSizes[(size_t)lastRange.descriptorType];
+        }
+    }
+
+    for (uint32_t i = 0; i < instanceNum; i++) {
+        VkDeviceSize offset = Align(m_DescriptorBufferOffset, props.offsetAlignment);
+        if (offset + setSize > m_DescriptorBufferSize || m_DescriptorSetNum == m_DescriptorSets.size()) {
+            NRI_REPORT_ERROR(&m_Device, "Descriptor pool is out of memory");
+            return Result::OUT_OF_MEMORY;
+        }
+
+        m_DescriptorBufferOffset = offset + setSize;
+
+        DescriptorSetVK* descriptorSet = &m_DescriptorSets[m_DescriptorSetNum++];
+        descriptorSet->Create(&m_Device, offset, m_DescriptorBufferData + offset, descriptorSetDesc, &setLayout);
+
+        descriptorSets[i] = (DescriptorSet*)descriptorSet;
+    }
+
+    return Result::SUCCESS;
 }
 
 NRI_INLINE Result DescriptorPoolVK::AllocateDescriptorSets(const PipelineLayout& pipelineLayout, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum) {
     ExclusiveScope lock(m_Lock);
 
     const PipelineLayoutVK& pipelineLayoutVK = (PipelineLayoutVK&)pipelineLayout;
+    if (m_DescriptorBuffer)
+        return AllocateDescriptorBufferSets(pipelineLayoutVK, setIndex, descriptorSets, instanceNum, variableDescriptorNum);
+
     VkDescriptorSetLayout setLayout = pipelineLayoutVK.GetDescriptorSetLayout(setIndex);
 
     const auto& bindingInfo = pipelineLayoutVK.GetBindingInfo();
@@ -102,9 +199,13 @@ NRI_INLINE Result DescriptorPoolVK::AllocateDescriptorSets(const PipelineLayout&
 NRI_INLINE void DescriptorPoolVK::Reset() {
     ExclusiveScope lock(m_Lock);
 
+    m_DescriptorSetNum = 0;
+    m_DescriptorBufferOffset = 0;
+
+    if (m_DescriptorBuffer)
+        return;
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.ResetDescriptorPool(m_Device, m_Handle, (VkDescriptorPoolResetFlags)0);
     NRI_RETURN_VOID_ON_BAD_VKRESULT(&m_Device, vkResult, "vkResetDescriptorPool");
-
-    m_DescriptorSetNum = 0;
 }
@@ -12,6 +12,10 @@ struct DescriptorSetVK final : public DebugNameBase {
         return m_Handle;
     }
 
+    inline VkDeviceSize GetDescriptorBufferOffset() const {
+        return m_DescriptorBufferOffset;
+    }
+
     inline DeviceVK& GetDevice() const {
         return *m_Device;
     }
@@ -26,6 +30,28 @@ struct DescriptorSetVK final : public DebugNameBase {
         m_Desc = desc;
     }
 
+    inline void Create(DeviceVK* device, VkDeviceSize descriptorBufferOffset, uint8_t* descriptorBufferData, const DescriptorSetDesc* desc, const DescriptorBufferSetLayoutVK* descriptorBufferSetLayout) {
+        m_Device = device;
+        m_DescriptorBufferOffset = descriptorBufferOffset;
+        m_Desc = desc;
+        m_DescriptorBufferSetLayout = descriptorBufferSetLayout;
+        m_DescriptorBufferData = descriptorBufferData;
+    }
+
+    // "VK_EXT_descriptor_buffer": where a descriptor lives in the mapped memory
+    inline uint8_t* GetDescriptorData(uint32_t rangeIndex, uint32_t descriptorIndex) const {
+        const DescriptorRangeDesc& rangeDesc = m_Desc->ranges[rangeIndex];
+        uint32_t binding = m_DescriptorBufferSetLayout->rangeBindings[rangeIndex];
+
+        bool isArray = rangeDesc.flags & (DescriptorRangeBits::ARRAY | DescriptorRangeBits::VARIABLE_SIZED_ARRAY);
+        if (isArray) {
+            uint32_t descriptorSize = m_Device->GetDescriptorBufferProps().descriptorSizes[(size_t)rangeDesc.descriptorType];
+            return m_DescriptorBufferData + m_DescriptorBufferSetLayout->bindingOffsets[binding] + (VkDeviceSize)descriptorIndex * descriptorSize;
+        }
+
+        return m_DescriptorBufferData + m_DescriptorBufferSetLayout->bindingOffsets[binding + descriptorIndex];
+    }
+
     //================================================================================================================
     // DebugNameBase
     //================================================================================================================
@@ -34,8 +60,15 @@ struct DescriptorSetVK final : public DebugNameBase {
 
 private:
     DeviceVK* m_Device = nullptr;
-    VkDescriptorSet m_Handle = VK_NULL_HANDLE;
+
+    union {
+        VkDescriptorSet m_Handle = VK_NULL_HANDLE;
+        VkDeviceSize m_DescriptorBufferOffset; // "VK_EXT_descriptor_buffer"
+    };
+
     const DescriptorSetDesc* m_Desc = nullptr;
+    const DescriptorBufferSetLayoutVK* m_DescriptorBufferSetLayout = nullptr; // "VK_EXT_descriptor_buffer"
+    uint8_t* m_DescriptorBufferData = nullptr;                                // "VK_EXT_descriptor_buffer"
 };
 
 } // namespace nri
\ No newline at end of file
@@ -68,7 +68,8 @@ struct DescriptorVK final : public DebugNameBase {
     Result Create(const BufferViewDesc& bufferViewDesc);
     Result Create(const TextureViewDesc& textureViewDesc);
     Result Create(const SamplerDesc& samplerDesc);
-    Result Create(VkAccelerationStructureKHR accelerationStructure);
+    Result Create(VkAccelerationStructureKHR accelerationStructure, VkDeviceAddress deviceAddress);
+    void GetDescriptorData(void* data) const; // "VK_EXT_descriptor_buffer"
 
     //================================================================================================================
     // DebugNameBase
@@ -91,6 +92,7 @@ private:
         VkDescriptorBufferInfo buffer;
     } m_ViewDesc;
 
+    VkDeviceAddress m_DeviceAddress = 0; // "VK_EXT_descriptor_buffer": buffer (including "offset") or acceleration structure address
     DescriptorType m_Type = DescriptorType::MAX_NUM;
     Format m_Format = Format::UNKNOWN;
 };
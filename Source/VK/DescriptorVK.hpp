@@ -182,6 +182,9 @@ Result DescriptorVK::Create(const BufferViewDesc& bufferViewDesc) {
     m_ViewDesc.buffer.offset = bufferViewDesc.offset;
     m_ViewDesc.buffer.range = (bufferViewDesc.size == WHOLE_SIZE) ? bufferDesc.size : bufferViewDesc.size;
 
+    if (m_Device.m_IsSupported.descriptorBuffer)
+        m_DeviceAddress = bufferVK.GetDeviceAddress() + bufferViewDesc.offset; // memory must be bound
+
     if (m_Format != Format::UNKNOWN) {
         VkBufferViewCreateInfo createInfo = {VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO};
         createInfo.flags = (VkBufferViewCreateFlags)0;
@@ -213,13 +216,65 @@ Result DescriptorVK::Create(const SamplerDesc& samplerDesc) {
     return Result::SUCCESS;
 }
 
-Result DescriptorVK::Create(VkAccelerationStructureKHR accelerationStructure) {
+Result DescriptorVK::Create(VkAccelerationStructureKHR accelerationStructure, VkDeviceAddress deviceAddress) {
     m_Type = DescriptorType::ACCELERATION_STRUCTURE;
     m_View.accelerationStructure = accelerationStructure;
+    m_DeviceAddress = deviceAddress;
 
     return Result::SUCCESS;
 }
 
+void DescriptorVK::GetDescriptorData(void* data) const {
+    VkDescriptorImageInfo imageInfo = {};
+    imageInfo.imageView = m_View.image;
+    imageInfo.imageLayout = m_ViewDesc.texture.expectedLayout;
+
+    VkDescriptorAddressInfoEXT addressInfo = {VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT};
+    addressInfo.address = m_DeviceAddress;
+    addressInfo.range = m_ViewDesc.buffer.range;
+    addressInfo.format = GetVkFormat(m_Format);
+
+    VkDescriptorGetInfoEXT info = {VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT};
+    info.type = GetDescriptorType(m_Type);
+
+    switch (m_Type) {
+        case DescriptorType::SAMPLER:
+            info.data.pSampler = &m_View.sampler;
+            break;
+        case DescriptorType::TEXTURE:
+            info.data.pSampledImage = &imageInfo;
+            break;
+        case DescriptorType::STORAGE_TEXTURE:
+            info.data.pStorageImage = &imageInfo;
+            break;
+        case DescriptorType::INPUT_ATTACHMENT:
+            info.data.pInputAttachmentImage = &imageInfo;
+            break;
+        case DescriptorType::BUFFER:
+            info.data.pUniformTexelBuffer = &addressInfo;
+            break;
+        case DescriptorType::STORAGE_BUFFER:
+            info.data.pStorageTexelBuffer = &addressInfo;
+            break;
+        case DescriptorType::CONSTANT_BUFFER:
+            info.data.pUniformBuffer = &addressInfo;
+            break;
+        case DescriptorType::STRUCTURED_BUFFER:
+        case DescriptorType::STORAGE_STRUCTURED_BUFFER:
+            info.data.pStorageBuffer = &addressInfo;
+            break;
+        case DescriptorType::ACCELERATION_STRUCTURE:
+            info.data.accelerationStructure = m_DeviceAddress;
+            break;
+        default:
+            NRI_CHECK(false, "Unexpected 'm_Type'");
+            break;
+    }
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.GetDescriptorEXT(m_Device, &info, m_Device.GetDescriptorBufferProps().descriptorSizes[(size_t)m_Type], data);
+}
+
 NRI_INLINE void DescriptorVK::SetDebugName(const char* name) {
     switch (m_Type) {
         case DescriptorType::SAMPLER:
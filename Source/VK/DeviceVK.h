@@ -102,6 +102,48 @@ struct FramebufferCacheEntry {
     VkFramebuffer handle = VK_NULL_HANDLE;
 };
 
+// Everything a pipeline library is compiled from. Variable size data is prefixed with its size, pointers are never stored
+struct PipelineLibraryDesc {
+    PipelineLibraryDesc(const StdAllocator<uint8_t>& allocator)
+        : inputs(allocator) {
+    }
+
+    bool operator==(const PipelineLibraryDesc& other) const {
+        return layoutUid == other.layoutUid && inputs == other.inputs;
+    }
+
+    inline void AddRaw(const void* data, size_t size) {
+        const uint8_t* bytes = (const uint8_t*)data;
+        inputs.insert(inputs.end(), bytes, bytes + size);
+    }
+
+    inline void AddBytes(const void* data, size_t size) {
+        Add(size);
+        AddRaw(data, size);
+    }
+
+    inline void Add(const PipelineLibraryDesc& other) {
+        inputs.insert(inputs.end(), other.inputs.begin(), other.inputs.end());
+    }
+
+    template <typename T>
+    inline void Add(const T& value) {
+        AddRaw(&value, sizeof(value));
+    }
+
+    Vector<uint8_t> inputs;
+    uint64_t layoutUid = 0; // 0 if the library doesn't depend on the pipeline layout
+};
+
+struct PipelineLibraryCacheEntry {
+    PipelineLibraryCacheEntry(const StdAllocator<uint8_t>& allocator)
+        : desc(allocator) {
+    }
+
+    PipelineLibraryDesc desc;
+    VkPipeline handle = VK_NULL_HANDLE;
+};
+
 struct IsSupported {
     uint32_t deviceAddress                : 1;
     uint32_t dynamicRendering             : 1;
@@ -110,6 +152,7 @@ struct IsSupported {
     uint32_t presentId                    : 1;
     uint32_t memoryPriority               : 1;
     uint32_t memoryBudget                 : 1;
+    uint32_t pageableDeviceLocalMemory    : 1;
     uint32_t maintenance4                 : 1;
     uint32_t maintenance5                 : 1;
     uint32_t maintenance6                 : 1;
@@ -126,10 +169,25 @@ struct IsSupported {
     uint32_t fifoLatestReady              : 1;
     uint32_t unifiedImageLayoutsVideo     : 1;
     uint32_t hostImageCopy                : 1;
+    uint32_t pipelineCreationFeedback     : 1;
+    uint32_t descriptorBuffer             : 1;
+    uint32_t multiDraw                    : 1;
 };
 
 static_assert(sizeof(IsSupported) == sizeof(uint32_t), "4 bytes expected");
 
+struct DescriptorBufferPropsVK {
+    std::array<uint32_t, (size_t)DescriptorType::MAX_NUM> descriptorSizes; // "MUTABLE" is the max of all mutable types
+    VkDeviceSize offsetAlignment;
+    bool bufferlessPushDescriptors;
+};
+
+struct DescriptorBufferSetLayoutVK {
+    const uint32_t* rangeBindings;      // per range: index of the first binding in "bindingOffsets"
+    const VkDeviceSize* bindingOffsets; // per binding (an array range is 1 binding, other ranges are "descriptorNum" bindings)
+    VkDeviceSize size;                  // a variable sized array is accounted with max "descriptorNum"
+};
+
 struct HostCopyLayoutVK {
     TextureDataLayoutDesc dataLayout;
     uint64_t slicePitch;
@@ -179,10 +237,22 @@ struct DeviceVK final : public DeviceBase {
         return m_IsMemoryZeroInitializationEnabled;
     }
 
+    inline const DescriptorBufferPropsVK& GetDescriptorBufferProps() const {
+        return m_DescriptorBufferProps;
+    }
+
+    inline uint32_t GetMultiDrawMaxNum() const {
+        return m_MultiDrawMaxNum;
+    }
+
     inline VmaAllocator_T* GetVma() const {
         return m_Vma;
     }
 
+    inline uint64_t GenerateUid() {
+        return ++m_UidCounter;
+    }
+
     template <typename Implementation, typename Interface, typename... Args>
     inline Result CreateImplementation(Interface*& entity, const Args&... args) {
         Implementation* impl = Allocate<Implementation>(GetAllocationCallbacks(), *this);
@@ -203,6 +273,17 @@ struct DeviceVK final : public DeviceBase {
     Result Create(const DeviceCreationDesc& desc, const DeviceCreationVKDesc& descVK);
     VkRenderPass GetOrCreateRenderPass(const RenderPassDesc& desc);
     VkFramebuffer GetOrCreateFramebuffer(const FramebufferDesc& desc);
+    VkResult GetOrCreatePipelineLibrary(PipelineLibraryDesc& desc, const VkGraphicsPipelineCreateInfo& info, VkPipelineCache pipelineCache, VkPipeline& library);
+    void ReleasePipelineLibraries(uint64_t layoutUid);
+    void GetPipelineLibraryStats(PipelineLibraryStats& pipelineLibraryStats);
+    void QueueOptimizedLink(PipelineVK& pipeline);
+    void CancelOptimizedLink(PipelineVK& pipeline);
+    void AddPipelineFeedback(const PipelineVK& pipeline, const PipelineFeedback& pipelineFeedback);
+    void SetPipelineFeedbackName(const PipelineVK& pipeline, const char* name);
+    void RemovePipelineFeedback(const PipelineVK& pipeline);
+    void GetPipelineFeedbackStats(PipelineFeedbackStats& pipelineFeedbackStats);
+    void AccumulateRedundantCommandStats(const RedundantCommandStats& redundantCommandStats);
+    void GetRedundantCommandStats(RedundantCommandStats& redundantCommandStats);
     void FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info) const;
     void FillCreateInfo(const TextureDesc& bufferDesc, VkImageCreateInfo& info) const;
     void FillCreateInfo(const SamplerDesc& samplerDesc, VkSamplerCreateInfo& info, VkSamplerReductionModeCreateInfo& reductionModeInfo, VkSamplerCustomBorderColorCreateInfoEXT& borderColorInfo) const;
@@ -270,12 +351,13 @@ private:
     VkResult CreateVma();
     void FilterInstanceLayers(Vector<const char*>& layers);
     void ProcessInstanceExtensions(Vector<const char*>& desiredInstanceExts);
-    void ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, bool disableRayTracing);
+    void ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, bool disableRayTracing, bool enableDescriptorBuffer);
     void ReportMemoryTypes();
     Result CreateInstance(bool enableGraphicsAPIValidation, const Vector<const char*>& desiredInstanceExts);
     Result ResolvePreInstanceDispatchTable();
     Result ResolveInstanceDispatchTable(const Vector<const char*>& desiredInstanceExts);
     Result ResolveDispatchTable(const Vector<const char*>& desiredDeviceExts);
+    void OptimizedLinkThread();
 
 public:
     union {
@@ -290,10 +372,23 @@ private:
     Vector<RenderPassCacheEntry> m_RenderPasses;
     Vector<FramebufferCacheEntry> m_Framebuffers;
     Vector<TransferContextVK*> m_TransferContexts;
+    std::unordered_multimap<uint64_t, PipelineLibraryCacheEntry, std::hash<uint64_t>, std::equal_to<uint64_t>, StdAllocator<std::pair<const uint64_t, PipelineLibraryCacheEntry>>> m_PipelineLibraries; // by "inputs" hash, guarded by "m_Lock"
+    PipelineLibraryStats m_PipelineLibraryStats = {}; // guarded by "m_Lock"
+    Vector<PipelineVK*> m_LinkQueue;                         // guarded by "m_LinkMutex"
+    std::thread m_LinkThread;                                // started on first use
+    std::mutex m_LinkMutex;
+    std::condition_variable m_LinkCondition;
+    PipelineVK* m_LinkingPipeline = nullptr; // guarded by "m_LinkMutex"
+    bool m_IsLinkThreadStopped = false;      // guarded by "m_LinkMutex"
+    PipelineFeedbackStats m_PipelineFeedbackStats = {};                                                                  // guarded by "m_PipelineFeedbackLock"
+    std::array<const PipelineVK*, sizeof(PipelineFeedbackStats::slowestPipelines) / sizeof(SlowPipeline)> m_SlowestPipelines = {}; // NULL if destroyed, guarded by "m_PipelineFeedbackLock"
+    RedundantCommandStats m_RedundantCommandStats = {}; // guarded by "m_RedundantCommandStatsLock"
+    std::atomic_uint64_t m_UidCounter = 0;
     DispatchTable m_VK = {};
     VkPhysicalDeviceMemoryProperties m_MemoryProps = {};
     VkAllocationCallbacks m_AllocationCallbacks = {};
     VKBindingOffsets m_BindingOffsets = {};
+    DescriptorBufferPropsVK m_DescriptorBufferProps = {};
     CoreInterface m_iCore = {};
     DeviceDesc m_Desc = {};
     Library* m_Loader = nullptr;
@@ -304,12 +399,15 @@ private:
     VmaAllocator_T* m_Vma = nullptr;
     uint32_t m_NumActiveFamilyIndices = 0;
     uint32_t m_MinorVersion = 0;
+    uint32_t m_MultiDrawMaxNum = 0; // "VK_EXT_multi_draw"
     uint64_t m_NonCoherentAtomSize = 1;
     bool m_OwnsNativeObjects = true;
     bool m_IsMemoryZeroInitializationEnabled = false;
 
     Lock m_Lock;
     Lock m_TransferContextLock;
+    Lock m_PipelineFeedbackLock;
+    Lock m_RedundantCommandStatsLock;
 };
 
 } // namespace nri
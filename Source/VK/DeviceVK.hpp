@@ -324,7 +324,7 @@ void DeviceVK::ProcessInstanceExtensions(Vector<const char*>& desiredInstanceExt
         desiredInstanceExts.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
 }
 
-void DeviceVK::ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, bool disableRayTracing) {
+void DeviceVK::ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, bool disableRayTracing, bool enableDescriptorBuffer) {
     // Query extensions
     uint32_t extensionNum = 0;
     m_VK.EnumerateDeviceExtensionProperties(m_PhysicalDevice, nullptr, &extensionNum, nullptr);
@@ -348,9 +348,11 @@ void DeviceVK::ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, b
     APPEND_EXT(m_MinorVersion < 3, VK_KHR_MAINTENANCE_4_EXTENSION_NAME);
     APPEND_EXT(m_MinorVersion < 3, VK_KHR_SHADER_INTEGER_DOT_PRODUCT_EXTENSION_NAME);
     APPEND_EXT(m_MinorVersion < 3, VK_EXT_IMAGE_ROBUSTNESS_EXTENSION_NAME);
-    APPEND_EXT(m_MinorVersion < 3, VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME); // TODO: there are 2 and 3 versions...
+    APPEND_EXT(m_MinorVersion < 3, VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+    APPEND_EXT(m_MinorVersion < 3, VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME);
     APPEND_EXT(m_MinorVersion < 3, VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME);
     APPEND_EXT(m_MinorVersion < 3, VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME);
+    APPEND_EXT(m_MinorVersion < 3, VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
 
     APPEND_EXT(m_MinorVersion < 4, VK_KHR_LINE_RASTERIZATION_EXTENSION_NAME);
     APPEND_EXT(m_MinorVersion < 4, VK_KHR_MAINTENANCE_5_EXTENSION_NAME);
@@ -367,6 +369,8 @@ void DeviceVK::ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, b
     APPEND_EXT(!disableRayTracing, VK_KHR_RAY_TRACING_POSITION_FETCH_EXTENSION_NAME);
     APPEND_EXT(!disableRayTracing, VK_EXT_OPACITY_MICROMAP_EXTENSION_NAME);
 
+    APPEND_EXT(enableDescriptorBuffer, VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+
     APPEND_EXT(true, VK_KHR_COMPUTE_SHADER_DERIVATIVES_EXTENSION_NAME);
     APPEND_EXT(true, VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME);
     APPEND_EXT(true, VK_KHR_FRAGMENT_SHADER_BARYCENTRIC_EXTENSION_NAME);
@@ -385,11 +389,15 @@ void DeviceVK::ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, b
     APPEND_EXT(true, VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME); // TODO: use KHR (currently coverage is lower)
     APPEND_EXT(true, VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_CUSTOM_BORDER_COLOR_EXTENSION_NAME);
+    APPEND_EXT(true, VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_FRAGMENT_SHADER_INTERLOCK_EXTENSION_NAME);
+    APPEND_EXT(true, VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_IMAGE_SLICED_VIEW_OF_3D_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_MESH_SHADER_EXTENSION_NAME);
+    APPEND_EXT(true, VK_EXT_MULTI_DRAW_EXTENSION_NAME);
+    APPEND_EXT(true, VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_PRESENT_MODE_FIFO_LATEST_READY_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_ROBUSTNESS_2_EXTENSION_NAME); // TODO: use KHR (currently coverage is lower)
     APPEND_EXT(true, VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME);
@@ -412,7 +420,9 @@ DeviceVK::DeviceVK(const CallbackInterface& callbacks, const AllocationCallbacks
       }
     , m_RenderPasses(GetStdAllocator())
     , m_Framebuffers(GetStdAllocator())
-    , m_TransferContexts(GetStdAllocator()) {
+    , m_TransferContexts(GetStdAllocator())
+    , m_PipelineLibraries(GetStdAllocator())
+    , m_LinkQueue(GetStdAllocator()) {
     m_AllocationCallbacks.pUserData = (void*)&GetAllocationCallbacks();
     m_AllocationCallbacks.pfnAllocation = vkAllocateHostMemory;
     m_AllocationCallbacks.pfnReallocation = vkReallocateHostMemory;
@@ -423,6 +433,19 @@ DeviceVK::DeviceVK(const CallbackInterface& callbacks, const AllocationCallbacks
 }
 
 DeviceVK::~DeviceVK() {
+    if (m_LinkThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_LinkMutex);
+            m_IsLinkThreadStopped = true;
+        }
+
+        m_LinkCondition.notify_all();
+        m_LinkThread.join();
+    }
+
+    for (auto& entry : m_PipelineLibraries)
+        m_VK.DestroyPipeline(m_Device, entry.second.handle, m_AllocationCallbackPtr);
+
     for (TransferContextVK* context : m_TransferContexts)
         Destroy(context);
 
@@ -606,7 +629,7 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         desiredDeviceExts.push_back(desc.vkExtensions.deviceExtensions[i]);
 
     if (!isWrapper)
-        ProcessDeviceExtensions(desiredDeviceExts, desc.disableVKRayTracing);
+        ProcessDeviceExtensions(desiredDeviceExts, desc.disableVKRayTracing, desc.enableVKDescriptorBuffer);
 
     NRI_REPORT_INFO(this, "Using Vulkan v1.%u (%u device extensions initialized)", m_MinorVersion, (uint32_t)desiredDeviceExts.size());
 
@@ -633,6 +656,7 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     PNEXTCHAIN_APPEND_FEATURES(m_MinorVersion < 3, KHR, Synchronization2, SYNCHRONIZATION_2);
     PNEXTCHAIN_APPEND_FEATURES(m_MinorVersion < 3, KHR, ShaderIntegerDotProduct, SHADER_INTEGER_DOT_PRODUCT);
     PNEXTCHAIN_APPEND_FEATURES(m_MinorVersion < 3, EXT, ExtendedDynamicState, EXTENDED_DYNAMIC_STATE);
+    PNEXTCHAIN_APPEND_FEATURES(m_MinorVersion < 3, EXT, ExtendedDynamicState2, EXTENDED_DYNAMIC_STATE_2);
     PNEXTCHAIN_APPEND_FEATURES(m_MinorVersion < 3, EXT, ImageRobustness, IMAGE_ROBUSTNESS);
     PNEXTCHAIN_APPEND_FEATURES(m_MinorVersion < 3, EXT, SubgroupSizeControl, SUBGROUP_SIZE_CONTROL);
     PNEXTCHAIN_APPEND_FEATURES(m_MinorVersion < 3, EXT, PipelineCreationCacheControl, PIPELINE_CREATION_CACHE_CONTROL);
@@ -661,11 +685,16 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     PNEXTCHAIN_APPEND_FEATURES(true, KHR, DynamicRenderingLocalRead, DYNAMIC_RENDERING_LOCAL_READ);
     PNEXTCHAIN_APPEND_FEATURES(true, KHR, UnifiedImageLayouts, UNIFIED_IMAGE_LAYOUTS);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, CustomBorderColor, CUSTOM_BORDER_COLOR);
+    PNEXTCHAIN_APPEND_FEATURES(true, EXT, DescriptorBuffer, DESCRIPTOR_BUFFER);
+    PNEXTCHAIN_APPEND_FEATURES(true, EXT, ExtendedDynamicState3, EXTENDED_DYNAMIC_STATE_3);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, FragmentShaderInterlock, FRAGMENT_SHADER_INTERLOCK);
+    PNEXTCHAIN_APPEND_FEATURES(true, EXT, GraphicsPipelineLibrary, GRAPHICS_PIPELINE_LIBRARY);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, ImageSlicedViewOf3D, IMAGE_SLICED_VIEW_OF_3D);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, MemoryPriority, MEMORY_PRIORITY);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, MeshShader, MESH_SHADER);
+    PNEXTCHAIN_APPEND_FEATURES(true, EXT, MultiDraw, MULTI_DRAW);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, OpacityMicromap, OPACITY_MICROMAP);
+    PNEXTCHAIN_APPEND_FEATURES(true, EXT, PageableDeviceLocalMemory, PAGEABLE_DEVICE_LOCAL_MEMORY);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, PresentModeFifoLatestReady, PRESENT_MODE_FIFO_LATEST_READY);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, Robustness2, ROBUSTNESS_2);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, ShaderAtomicFloat, SHADER_ATOMIC_FLOAT);
@@ -699,8 +728,10 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         features14.hostImageCopy = HostImageCopyFeatures.hostImageCopy;
     }
 
-    if (m_MinorVersion > 2)
+    if (m_MinorVersion > 2) {
         ExtendedDynamicStateFeatures.extendedDynamicState = true;
+        ExtendedDynamicState2Features.extendedDynamicState2 = true;
+    }
 
     m_IsSupported.maintenance4 = features13.maintenance4;
     m_IsSupported.maintenance5 = features14.maintenance5;
@@ -716,6 +747,7 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     m_IsSupported.presentId = PresentIdFeatures.presentId;
     m_IsSupported.memoryPriority = MemoryPriorityFeatures.memoryPriority;
     m_IsSupported.memoryBudget = IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, desiredDeviceExts);
+    m_IsSupported.pageableDeviceLocalMemory = PageableDeviceLocalMemoryFeatures.pageableDeviceLocalMemory && MemoryPriorityFeatures.memoryPriority;
     m_IsSupported.imageSlicedView = ImageSlicedViewOf3DFeatures.imageSlicedViewOf3D != 0;
     m_IsSupported.customBorderColor = CustomBorderColorFeatures.customBorderColors != 0 && CustomBorderColorFeatures.customBorderColorWithoutFormat != 0;
     m_IsSupported.robustness = features.features.robustBufferAccess != 0 && features13.robustImageAccess != 0;
@@ -725,6 +757,9 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     m_IsSupported.fifoLatestReady = PresentModeFifoLatestReadyFeatures.presentModeFifoLatestReady;
     m_IsSupported.unifiedImageLayoutsVideo = UnifiedImageLayoutsFeatures.unifiedImageLayoutsVideo;
     m_IsSupported.hostImageCopy = features14.hostImageCopy;
+    m_IsSupported.pipelineCreationFeedback = m_MinorVersion > 2 || IsExtensionSupported(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME, desiredDeviceExts);
+    m_IsSupported.descriptorBuffer = desc.enableVKDescriptorBuffer && DescriptorBufferFeatures.descriptorBuffer && DescriptorBufferFeatures.descriptorBufferPushDescriptors && features12.bufferDeviceAddress;
+    m_IsSupported.multiDraw = MultiDrawFeatures.multiDraw;
 
     m_IsMemoryZeroInitializationEnabled = desc.enableMemoryZeroInitialization && ZeroInitializeDeviceMemoryFeatures.zeroInitializeDeviceMemory;
 
@@ -738,6 +773,9 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     if (!features13.dynamicRendering)
         NRI_REPORT_INFO(this, "'dynamicRendering' is not supported, using 'render passes'");
 
+    if (desc.enableVKDescriptorBuffer && !m_IsSupported.descriptorBuffer)
+        NRI_REPORT_INFO(this, "'descriptorBuffer' is not supported, using 'descriptor pools'");
+
     { // Create device
         if (isWrapper)
             m_Device = (VkDevice)descVK.vkDevice;
@@ -753,6 +791,9 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
                 features13.robustImageAccess = 0;
             }
 
+            // Only needed for capture/replay tools
+            DescriptorBufferFeatures.descriptorBufferCaptureReplay = 0;
+
             // Create device
             std::array<VkDeviceQueueCreateInfo, (size_t)QueueType::MAX_NUM> queueCreateInfos = {};
 
@@ -883,7 +924,10 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         PNEXTCHAIN_APPEND_PROPS(true, KHR, Maintenance10, MAINTENANCE_10);
         PNEXTCHAIN_APPEND_PROPS(true, KHR, RayTracingPipeline, RAY_TRACING_PIPELINE);
         PNEXTCHAIN_APPEND_PROPS(true, EXT, ConservativeRasterization, CONSERVATIVE_RASTERIZATION);
+        PNEXTCHAIN_APPEND_PROPS(true, EXT, DescriptorBuffer, DESCRIPTOR_BUFFER);
+        PNEXTCHAIN_APPEND_PROPS(true, EXT, GraphicsPipelineLibrary, GRAPHICS_PIPELINE_LIBRARY);
         PNEXTCHAIN_APPEND_PROPS(true, EXT, MeshShader, MESH_SHADER);
+        PNEXTCHAIN_APPEND_PROPS(true, EXT, MultiDraw, MULTI_DRAW);
         PNEXTCHAIN_APPEND_PROPS(true, EXT, OpacityMicromap, OPACITY_MICROMAP);
         PNEXTCHAIN_APPEND_PROPS(true, EXT, SampleLocations, SAMPLE_LOCATIONS);
 
@@ -1177,6 +1221,15 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         m_Desc.other.viewMaxNum = features11.multiview ? (uint8_t)props11.maxMultiviewViewCount : 1;
         m_Desc.other.shadingRateAttachmentTileSize = (uint8_t)FragmentShadingRateProps.minFragmentShadingRateAttachmentTexelSize.width;
 
+        if (ExtendedDynamicStateFeatures.extendedDynamicState) {
+            m_Desc.other.dynamicStates |= DynamicStateBits::CULL_MODE | DynamicStateBits::FRONT_FACE | DynamicStateBits::DEPTH | DynamicStateBits::STENCIL;
+            if (ExtendedDynamicState2Features.extendedDynamicState2)
+                m_Desc.other.dynamicStates |= DynamicStateBits::TOPOLOGY;
+        }
+
+        if (ExtendedDynamicState3Features.extendedDynamicState3ColorBlendEnable && ExtendedDynamicState3Features.extendedDynamicState3ColorBlendEquation && ExtendedDynamicState3Features.extendedDynamicState3ColorWriteMask)
+            m_Desc.other.dynamicStates |= DynamicStateBits::COLOR;
+
         if (IsExtensionSupported(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME, desiredDeviceExts)) {
             m_Desc.tiers.conservativeRaster = 1;
             if (ConservativeRasterizationProps.primitiveOverestimationSize < 1.0f / 2.0f && ConservativeRasterizationProps.degenerateTrianglesRasterized)
@@ -1198,6 +1251,40 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         if (m_Desc.tiers.rayTracing == 2 && OpacityMicromapFeatures.micromap)
             m_Desc.tiers.rayTracing = 3;
 
+        if (m_IsSupported.descriptorBuffer) {
+            bool isRobust = features.features.robustBufferAccess != 0;
+
+            auto& sizes = m_DescriptorBufferProps.descriptorSizes;
+            sizes[(size_t)DescriptorType::SAMPLER] = (uint32_t)DescriptorBufferProps.samplerDescriptorSize;
+            sizes[(size_t)DescriptorType::TEXTURE] = (uint32_t)DescriptorBufferProps.sampledImageDescriptorSize;
+            sizes[(size_t)DescriptorType::STORAGE_TEXTURE] = (uint32_t)DescriptorBufferProps.storageImageDescriptorSize;
+            sizes[(size_t)DescriptorType::INPUT_ATTACHMENT] = (uint32_t)DescriptorBufferProps.inputAttachmentDescriptorSize;
+            sizes[(size_t)DescriptorType::BUFFER] = (uint32_t)(isRobust ? DescriptorBufferProps.robustUniformTexelBufferDescriptorSize : DescriptorBufferProps.uniformTexelBufferDescriptorSize);
+            sizes[(size_t)DescriptorType::STORAGE_BUFFER] = (uint32_t)(isRobust ? DescriptorBufferProps.robustStorageTexelBufferDescriptorSize : DescriptorBufferProps.storageTexelBufferDescriptorSize);
+            sizes[(size_t)DescriptorType::CONSTANT_BUFFER] = (uint32_t)(isRobust ? DescriptorBufferProps.robustUniformBufferDescriptorSize : DescriptorBufferProps.uniformBufferDescriptorSize);
+            sizes[(size_t)DescriptorType::STRUCTURED_BUFFER] = (uint32_t)(isRobust ? DescriptorBufferProps.robustStorageBufferDescriptorSize : DescriptorBufferProps.storageBufferDescriptorSize);
+            sizes[(size_t)DescriptorType::STORAGE_STRUCTURED_BUFFER] = sizes[(size_t)DescriptorType::STRUCTURED_BUFFER];
+            sizes[(size_t)DescriptorType::ACCELERATION_STRUCTURE] = (uint32_t)DescriptorBufferProps.accelerationStructureDescriptorSize;
+
+            // A "mutable" descriptor occupies the size of the largest type in the list (must match "CreateSetLayout")
+            uint32_t mutableSize = 0;
+            for (size_t i = (size_t)DescriptorType::BUFFER; i < (size_t)DescriptorType::ACCELERATION_STRUCTURE; i++)
+                mutableSize = std::max(mutableSize, sizes[i]);
+
+            mutableSize = std::max(mutableSize, sizes[(size_t)DescriptorType::TEXTURE]);
+            mutableSize = std::max(mutableSize, sizes[(size_t)DescriptorType::STORAGE_TEXTURE]);
+            if (m_Desc.tiers.rayTracing)
+                mutableSize = std::max(mutableSize, sizes[(size_t)DescriptorType::ACCELERATION_STRUCTURE]);
+
+            sizes[(size_t)DescriptorType::MUTABLE] = mutableSize;
+
+            m_DescriptorBufferProps.offsetAlignment = DescriptorBufferProps.descriptorBufferOffsetAlignment;
+            m_DescriptorBufferProps.bufferlessPushDescriptors = DescriptorBufferProps.bufferlessPushDescriptors != 0;
+        }
+
+        if (m_IsSupported.multiDraw)
+            m_MultiDrawMaxNum = MultiDrawProps.maxMultiDrawCount;
+
         m_Desc.tiers.shadingRate = FragmentShadingRateFeatures.pipelineFragmentShadingRate != 0 ? 1 : 0;
         if (m_Desc.tiers.shadingRate && FragmentShadingRateFeatures.primitiveFragmentShadingRate && FragmentShadingRateFeatures.attachmentFragmentShadingRate)
             m_Desc.tiers.shadingRate = 2;
@@ -1226,6 +1313,7 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         m_Desc.features.resolveOpMinMax = m_IsSupported.maintenance10 && m_IsSupported.copyCommands2; // TODO: it's "all or nothing", without it "min/max" resolve is supported only in a render pass
         m_Desc.features.pipelineCache = true;
         m_Desc.features.pipelineCacheControl = features13.pipelineCreationCacheControl;
+        m_Desc.features.graphicsPipelineLibrary = GraphicsPipelineLibraryFeatures.graphicsPipelineLibrary && GraphicsPipelineLibraryProps.graphicsPipelineLibraryFastLinking;
         m_Desc.features.getMemoryDesc2 = m_IsSupported.maintenance4;
         m_Desc.features.enhancedBarriers = true;
         m_Desc.features.tessellationShader = features.features.tessellationShader != 0;
@@ -1867,6 +1955,7 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(CreatePipelineCache);
     GET_DEVICE_CORE_FUNC(DestroyPipelineCache);
     GET_DEVICE_CORE_FUNC(GetPipelineCacheData);
+    GET_DEVICE_CORE_FUNC(MergePipelineCaches);
     GET_DEVICE_CORE_FUNC(AllocateMemory);
     GET_DEVICE_CORE_FUNC(DestroyBuffer);
     GET_DEVICE_CORE_FUNC(DestroyImage);
@@ -1897,6 +1986,8 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(BeginCommandBuffer);
     GET_DEVICE_CORE_FUNC(CmdSetDepthBounds);
     GET_DEVICE_CORE_FUNC(CmdSetStencilReference);
+    GET_DEVICE_CORE_FUNC(CmdSetStencilCompareMask);
+    GET_DEVICE_CORE_FUNC(CmdSetStencilWriteMask);
     GET_DEVICE_CORE_FUNC(CmdSetBlendConstants);
     GET_DEVICE_CORE_FUNC(CmdSetDepthBias);
     GET_DEVICE_CORE_FUNC(CmdClearAttachments);
@@ -1912,6 +2003,7 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(CmdDispatchIndirect);
     GET_DEVICE_CORE_FUNC(CmdDraw);
     GET_DEVICE_CORE_FUNC(CmdDrawIndexed);
+    GET_DEVICE_CORE_FUNC(CmdExecuteCommands);
     GET_DEVICE_CORE_FUNC(CmdDrawIndirect);
     GET_DEVICE_CORE_FUNC(CmdDrawIndexedIndirect);
     GET_DEVICE_CORE_FUNC(CmdBeginQuery);
@@ -1963,6 +2055,18 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_OPTIONAL_CORE_FUNC(CmdBindVertexBuffers2);
     GET_DEVICE_OPTIONAL_CORE_FUNC(CmdSetViewportWithCount);
     GET_DEVICE_OPTIONAL_CORE_FUNC(CmdSetScissorWithCount);
+    GET_DEVICE_OPTIONAL_CORE_FUNC(CmdSetPrimitiveTopology);
+    GET_DEVICE_OPTIONAL_CORE_FUNC(CmdSetCullMode);
+    GET_DEVICE_OPTIONAL_CORE_FUNC(CmdSetFrontFace);
+    GET_DEVICE_OPTIONAL_CORE_FUNC(CmdSetDepthTestEnable);
+    GET_DEVICE_OPTIONAL_CORE_FUNC(CmdSetDepthWriteEnable);
+    GET_DEVICE_OPTIONAL_CORE_FUNC(CmdSetDepthCompareOp);
+    GET_DEVICE_OPTIONAL_CORE_FUNC(CmdSetDepthBoundsTestEnable);
+    GET_DEVICE_OPTIONAL_CORE_FUNC(CmdSetStencilTestEnable);
+    GET_DEVICE_OPTIONAL_CORE_FUNC(CmdSetStencilOp);
+
+    // v1.3 or VK_EXT_extended_dynamic_state2
+    GET_DEVICE_OPTIONAL_CORE_FUNC(CmdSetPrimitiveRestartEnable);
 
     // v1.3 or VK_KHR_maintenance4
     GET_DEVICE_OPTIONAL_CORE_FUNC(GetDeviceBufferMemoryRequirements);
@@ -2022,6 +2126,14 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
         GET_DEVICE_FUNC(GetCalibratedTimestampsEXT);
     }
 
+    if (IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(GetDescriptorSetLayoutSizeEXT);
+        GET_DEVICE_FUNC(GetDescriptorSetLayoutBindingOffsetEXT);
+        GET_DEVICE_FUNC(GetDescriptorEXT);
+        GET_DEVICE_FUNC(CmdBindDescriptorBuffersEXT);
+        GET_DEVICE_FUNC(CmdSetDescriptorBufferOffsetsEXT);
+    }
+
     if (IsExtensionSupported(VK_EXT_OPACITY_MICROMAP_EXTENSION_NAME, desiredDeviceExts)) {
         GET_DEVICE_FUNC(CreateMicromapEXT);
         GET_DEVICE_FUNC(DestroyMicromapEXT);
@@ -2031,16 +2143,31 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
         GET_DEVICE_FUNC(CmdWriteMicromapsPropertiesEXT);
     }
 
+    if (IsExtensionSupported(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(SetDeviceMemoryPriorityEXT);
+    }
+
     if (IsExtensionSupported(VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME, desiredDeviceExts)) {
         GET_DEVICE_FUNC(CmdSetSampleLocationsEXT);
     }
 
+    if (IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(CmdSetColorBlendEnableEXT);
+        GET_DEVICE_FUNC(CmdSetColorBlendEquationEXT);
+        GET_DEVICE_FUNC(CmdSetColorWriteMaskEXT);
+    }
+
     if (IsExtensionSupported(VK_EXT_MESH_SHADER_EXTENSION_NAME, desiredDeviceExts)) {
         GET_DEVICE_FUNC(CmdDrawMeshTasksEXT);
         GET_DEVICE_FUNC(CmdDrawMeshTasksIndirectEXT);
         GET_DEVICE_FUNC(CmdDrawMeshTasksIndirectCountEXT);
     }
 
+    if (IsExtensionSupported(VK_EXT_MULTI_DRAW_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(CmdDrawMultiEXT);
+        GET_DEVICE_FUNC(CmdDrawMultiIndexedEXT);
+    }
+
     if (IsExtensionSupported(VK_NV_LOW_LATENCY_2_EXTENSION_NAME, desiredDeviceExts)) {
         GET_DEVICE_FUNC(GetLatencyTimingsNV);
         GET_DEVICE_FUNC(LatencySleepNV);
@@ -2066,6 +2193,210 @@ NRI_INLINE void DeviceVK::SetDebugName(const char* name) {
     SetDebugNameToTrivialObject(VK_OBJECT_TYPE_DEVICE, (uint64_t)m_Device, name);
 }
 
+NRI_INLINE VkResult DeviceVK::GetOrCreatePipelineLibrary(PipelineLibraryDesc& desc, const VkGraphicsPipelineCreateInfo& info, VkPipelineCache pipelineCache, VkPipeline& library) {
+    uint64_t hash = HashBytes(desc.inputs.data(), desc.inputs.size());
+
+    // The hash is only a bucket, a hit requires equal inputs
+    const auto find = [&]() -> VkPipeline {
+        auto range = m_PipelineLibraries.equal_range(hash);
+        for (auto it = range.first; it != range.second; it++) {
+            if (it->second.desc == desc)
+                return it->second.handle;
+        }
+
+        return VK_NULL_HANDLE;
+    };
+
+    {
+        ExclusiveScope lock(m_Lock);
+
+        library = find();
+        if (library) {
+            m_PipelineLibraryStats.hitNum++;
+            return VK_SUCCESS;
+        }
+    }
+
+    // Compile outside of the lock
+    VkPipeline newLibrary = VK_NULL_HANDLE;
+    VkResult vkResult = m_VK.CreateGraphicsPipelines(m_Device, pipelineCache, 1, &info, m_AllocationCallbackPtr, &newLibrary);
+    if (vkResult != VK_SUCCESS)
+        return vkResult;
+
+    ExclusiveScope lock(m_Lock);
+
+    // Another thread may have created the same library meanwhile
+    library = find();
+    if (library) {
+        m_VK.DestroyPipeline(m_Device, newLibrary, m_AllocationCallbackPtr);
+        m_PipelineLibraryStats.hitNum++;
+
+        return VK_SUCCESS;
+    }
+
+    auto it = m_PipelineLibraries.emplace(hash, PipelineLibraryCacheEntry(GetStdAllocator()));
+    it->second.desc = std::move(desc);
+    it->second.handle = newLibrary;
+
+    library = newLibrary;
+    m_PipelineLibraryStats.missNum++;
+
+    return VK_SUCCESS;
+}
+
+NRI_INLINE void DeviceVK::ReleasePipelineLibraries(uint64_t layoutUid) {
+    ExclusiveScope lock(m_Lock);
+
+    // Libraries of a destroyed layout can't be hit anymore, pipelines linked from them are already destroyed ("USE_LIBRARIES")
+    for (auto it = m_PipelineLibraries.begin(); it != m_PipelineLibraries.end();) {
+        if (it->second.desc.layoutUid == layoutUid) {
+            m_VK.DestroyPipeline(m_Device, it->second.handle, m_AllocationCallbackPtr);
+            it = m_PipelineLibraries.erase(it);
+        } else
+            it++;
+    }
+}
+
+NRI_INLINE void DeviceVK::GetPipelineLibraryStats(PipelineLibraryStats& pipelineLibraryStats) {
+    ExclusiveScope lock(m_Lock);
+
+    pipelineLibraryStats = m_PipelineLibraryStats;
+    pipelineLibraryStats.libraryNum = (uint32_t)m_PipelineLibraries.size();
+}
+
+NRI_INLINE void DeviceVK::QueueOptimizedLink(PipelineVK& pipeline) {
+    {
+        std::lock_guard<std::mutex> lock(m_LinkMutex);
+
+        if (!m_LinkThread.joinable())
+            m_LinkThread = std::thread(&DeviceVK::OptimizedLinkThread, this);
+
+        m_LinkQueue.push_back(&pipeline);
+    }
+
+    m_LinkCondition.notify_all();
+}
+
+NRI_INLINE void DeviceVK::CancelOptimizedLink(PipelineVK& pipeline) {
+    std::unique_lock<std::mutex> lock(m_LinkMutex);
+
+    auto it = std::find(m_LinkQueue.begin(), m_LinkQueue.end(), &pipeline);
+    if (it != m_LinkQueue.end())
+        m_LinkQueue.erase(it);
+
+    // Wait if the pipeline is being linked right now
+    m_LinkCondition.wait(lock, [&]() {
+        return m_LinkingPipeline != &pipeline;
+    });
+}
+
+void DeviceVK::OptimizedLinkThread() {
+    for (;;) {
+        PipelineVK* pipeline = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_LinkMutex);
+            m_LinkCondition.wait(lock, [&]() {
+                return m_IsLinkThreadStopped || !m_LinkQueue.empty();
+            });
+
+            if (m_IsLinkThreadStopped)
+                return;
+
+            pipeline = m_LinkQueue.front();
+            m_LinkQueue.erase(m_LinkQueue.begin());
+            m_LinkingPipeline = pipeline;
+        }
+
+        pipeline->LinkOptimized();
+
+        {
+            std::lock_guard<std::mutex> lock(m_LinkMutex);
+            m_LinkingPipeline = nullptr;
+        }
+
+        m_LinkCondition.notify_all();
+    }
+}
+
+NRI_INLINE void DeviceVK::AddPipelineFeedback(const PipelineVK& pipeline, const PipelineFeedback& pipelineFeedback) {
+    ExclusiveScope lock(m_PipelineFeedbackLock);
+
+    PipelineFeedbackStats& stats = m_PipelineFeedbackStats;
+    stats.totalDuration += pipelineFeedback.duration;
+    stats.pipelineNum++;
+
+    if (pipelineFeedback.flags & PipelineFeedbackBits::CACHE_HIT)
+        stats.cacheHitNum++;
+
+    // Keep the list sorted, the slowest first
+    uint32_t i = stats.slowestPipelineNum;
+    if (i == GetCountOf(stats.slowestPipelines)) {
+        if (pipelineFeedback.duration <= stats.slowestPipelines[i - 1].duration)
+            return;
+
+        i--;
+    } else
+        stats.slowestPipelineNum++;
+
+    for (; i > 0 && stats.slowestPipelines[i - 1].duration < pipelineFeedback.duration; i--) {
+        stats.slowestPipelines[i] = stats.slowestPipelines[i - 1];
+        m_SlowestPipelines[i] = m_SlowestPipelines[i - 1];
+    }
+
+    SlowPipeline& slowPipeline = stats.slowestPipelines[i];
+    slowPipeline = {};
+    slowPipeline.duration = pipelineFeedback.duration;
+    slowPipeline.flags = pipelineFeedback.flags;
+
+    m_SlowestPipelines[i] = &pipeline;
+}
+
+NRI_INLINE void DeviceVK::SetPipelineFeedbackName(const PipelineVK& pipeline, const char* name) {
+    ExclusiveScope lock(m_PipelineFeedbackLock);
+
+    for (uint32_t i = 0; i < m_PipelineFeedbackStats.slowestPipelineNum; i++) {
+        if (m_SlowestPipelines[i] == &pipeline) {
+            char* debugName = m_PipelineFeedbackStats.slowestPipelines[i].debugName;
+            strncpy(debugName, name ? name : "", sizeof(SlowPipeline::debugName) - 1);
+        }
+    }
+}
+
+NRI_INLINE void DeviceVK::RemovePipelineFeedback(const PipelineVK& pipeline) {
+    ExclusiveScope lock(m_PipelineFeedbackLock);
+
+    // The entry stays in the stats, but can't be renamed anymore
+    for (uint32_t i = 0; i < m_PipelineFeedbackStats.slowestPipelineNum; i++) {
+        if (m_SlowestPipelines[i] == &pipeline)
+            m_SlowestPipelines[i] = nullptr;
+    }
+}
+
+NRI_INLINE void DeviceVK::GetPipelineFeedbackStats(PipelineFeedbackStats& pipelineFeedbackStats) {
+    ExclusiveScope lock(m_PipelineFeedbackLock);
+
+    pipelineFeedbackStats = m_PipelineFeedbackStats;
+}
+
+NRI_INLINE void DeviceVK::AccumulateRedundantCommandStats(const RedundantCommandStats& redundantCommandStats) {
+    ExclusiveScope lock(m_RedundantCommandStatsLock);
+
+    RedundantCommandStats& stats = m_RedundantCommandStats;
+    stats.pipelineNum += redundantCommandStats.pipelineNum;
+    stats.pipelineLayoutNum += redundantCommandStats.pipelineLayoutNum;
+    stats.descriptorSetNum += redundantCommandStats.descriptorSetNum;
+    stats.vertexBufferNum += redundantCommandStats.vertexBufferNum;
+    stats.indexBufferNum += redundantCommandStats.indexBufferNum;
+    stats.viewportNum += redundantCommandStats.viewportNum;
+    stats.scissorNum += redundantCommandStats.scissorNum;
+}
+
+NRI_INLINE void DeviceVK::GetRedundantCommandStats(RedundantCommandStats& redundantCommandStats) {
+    ExclusiveScope lock(m_RedundantCommandStatsLock);
+
+    redundantCommandStats = m_RedundantCommandStats;
+}
+
 NRI_INLINE VkRenderPass DeviceVK::GetOrCreateRenderPass(const RenderPassDesc& desc) {
     ExclusiveScope lock(m_Lock);
 
@@ -2486,7 +2817,7 @@ Result DeviceVK::UploadHostMemoryToTexture(QueueVK& queue, const UploadHostMemor
             const HostCopyLayoutVK& layout = layouts[i];
             uint32_t srcRowPitch = copyDesc.srcRowPitch ? copyDesc.srcRowPitch : layout.rowSize;
             uint32_t srcSlicePitch = copyDesc.srcSlicePitch ? copyDesc.srcSlicePitch : srcRowPitch * layout.rowNum;
-            CopyTextureData(stagingData + layout.dataLayout.offset, layout.dataLayout.rowPitch, layout.slicePitch, copyDesc.srcData, srcRowPitch, srcSlicePitch, layout.rowSize, layout.rowNum, layout.depth);
+            CopyTextureData(stagingData + layout.dataLayout.offset, layout.dataLayout.rowPitch, layout.slicePitch, copyDesc.srcData, srcRowPitch, srcSlicePitch, layout.rowSize, layout.rowNum, layout.depth, true);
         }
 
         context->GetUploadBuffer().Unmap();
@@ -2836,6 +3167,37 @@ void DeviceVK::ReleaseTransferContext(TransferContextVK& context) {
 }
 
 NRI_INLINE void DeviceVK::CopyDescriptorRanges(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum) {
+    if (m_IsSupported.descriptorBuffer) {
+        // Descriptors are plain data in mapped memory
+        for (uint32_t i = 0; i < copyDescriptorRangeDescNum; i++) {
+            const CopyDescriptorRangeDesc& copyDescriptorSetDesc = copyDescriptorRangeDescs[i];
+
+            const DescriptorSetVK& dst = *(DescriptorSetVK*)copyDescriptorSetDesc.dstDescriptorSet;
+            const DescriptorSetVK& src = *(DescriptorSetVK*)copyDescriptorSetDesc.srcDescriptorSet;
+
+            const DescriptorRangeDesc& dstRangeDesc = dst.GetDesc()->ranges[copyDescriptorSetDesc.dstRangeIndex];
+            const DescriptorRangeDesc& srcRangeDesc = src.GetDesc()->ranges[copyDescriptorSetDesc.srcRangeIndex];
+
+            uint32_t descriptorNum = copyDescriptorSetDesc.descriptorNum;
+            if (descriptorNum == ALL)
+                descriptorNum = srcRangeDesc.descriptorNum;
+
+            // "MUTABLE" descriptors are bigger than any other type
+            uint32_t dstDescriptorSize = m_DescriptorBufferProps.descriptorSizes[(size_t)dstRangeDesc.descriptorType];
+            uint32_t srcDescriptorSize = m_DescriptorBufferProps.descriptorSizes[(size_t)srcRangeDesc.descriptorType];
+            uint32_t descriptorSize = std::min(dstDescriptorSize, srcDescriptorSize);
+
+            for (uint32_t j = 0; j < descriptorNum; j++) {
+                uint8_t* dstData = dst.GetDescriptorData(copyDescriptorSetDesc.dstRangeIndex, copyDescriptorSetDesc.dstBaseDescriptor + j);
+                const uint8_t* srcData = src.GetDescriptorData(copyDescriptorSetDesc.srcRangeIndex, copyDescriptorSetDesc.srcBaseDescriptor + j);
+
+                memcpy(dstData, srcData, descriptorSize);
+            }
+        }
+
+        return;
+    }
+
     Scratch<VkCopyDescriptorSet> copies = NRI_ALLOCATE_SCRATCH(*this, VkCopyDescriptorSet, copyDescriptorRangeDescNum);
     for (uint32_t i = 0; i < copyDescriptorRangeDescNum; i++) {
         const CopyDescriptorRangeDesc& copyDescriptorSetDesc = copyDescriptorRangeDescs[i];
@@ -2965,6 +3327,21 @@ constexpr std::array<WriteDescriptorsFunc, (size_t)DescriptorType::MAX_NUM> g_Wr
 NRI_VALIDATE_ARRAY_BY_PTR(g_WriteFuncs);
 
 NRI_INLINE void DeviceVK::UpdateDescriptorRanges(const UpdateDescriptorRangeDesc* updateDescriptorRangeDescs, uint32_t updateDescriptorRangeDescNum) {
+    if (m_IsSupported.descriptorBuffer) {
+        // Descriptors are written directly into mapped memory, no "vkUpdateDescriptorSets" overhead
+        for (uint32_t i = 0; i < updateDescriptorRangeDescNum; i++) {
+            const UpdateDescriptorRangeDesc& updateDescriptorRangeDesc = updateDescriptorRangeDescs[i];
+            const DescriptorSetVK& dst = *(DescriptorSetVK*)updateDescriptorRangeDesc.descriptorSet;
+
+            for (uint32_t j = 0; j < updateDescriptorRangeDesc.descriptorNum; j++) {
+                const DescriptorVK& descriptorVK = *(DescriptorVK*)updateDescriptorRangeDesc.descriptors[j];
+                descriptorVK.GetDescriptorData(dst.GetDescriptorData(updateDescriptorRangeDesc.rangeIndex, updateDescriptorRangeDesc.baseDescriptor + j));
+            }
+        }
+
+        return;
+    }
+
     // Count and allocate scratch memory
     size_t scratchOffset = updateDescriptorRangeDescNum * sizeof(VkWriteDescriptorSet);
     size_t scratchSize = scratchOffset;
@@ -80,6 +80,7 @@ struct DispatchTable {
     VK_FUNC(CreatePipelineCache);                         // + | +
     VK_FUNC(DestroyPipelineCache);                        // - | +
     VK_FUNC(GetPipelineCacheData);                        // - | +
+    VK_FUNC(MergePipelineCaches);                         // - | +
     VK_FUNC(AllocateMemory);                              // + | +
     VK_FUNC(DestroyBuffer);                               // - | +
     VK_FUNC(DestroyImage);                                // - | +
@@ -110,6 +111,8 @@ struct DispatchTable {
     VK_FUNC(BeginCommandBuffer);                          // - | +
     VK_FUNC(CmdSetDepthBounds);                           // - | +
     VK_FUNC(CmdSetStencilReference);                      // - | +
+    VK_FUNC(CmdSetStencilCompareMask);                    // - | +
+    VK_FUNC(CmdSetStencilWriteMask);                      // - | +
     VK_FUNC(CmdSetBlendConstants);                        // - | +
     VK_FUNC(CmdSetDepthBias);                             // - | + TODO: "VK_EXT_depth_bias_control" offers "2" but MoltenVK doesn't support it yet
     VK_FUNC(CmdClearAttachments);                         // - | +
@@ -125,6 +128,7 @@ struct DispatchTable {
     VK_FUNC(CmdDispatchIndirect);                         // - | +
     VK_FUNC(CmdDraw);                                     // - | +
     VK_FUNC(CmdDrawIndexed);                              // - | +
+    VK_FUNC(CmdExecuteCommands);                          // - | +
     VK_FUNC(CmdDrawIndirect);                             // - | +
     VK_FUNC(CmdDrawIndexedIndirect);                      // - | +
     VK_FUNC(CmdBeginQuery);                               // - | +
@@ -170,6 +174,17 @@ struct DispatchTable {
     VK_FUNC(CmdBindVertexBuffers2);                       // - | +
     VK_FUNC(CmdSetViewportWithCount);                     // - | +
     VK_FUNC(CmdSetScissorWithCount);                      // - | +
+    VK_FUNC(CmdSetPrimitiveTopology);                     // - | +
+    VK_FUNC(CmdSetCullMode);                              // - | +
+    VK_FUNC(CmdSetFrontFace);                             // - | +
+    VK_FUNC(CmdSetDepthTestEnable);                       // - | +
+    VK_FUNC(CmdSetDepthWriteEnable);                      // - | +
+    VK_FUNC(CmdSetDepthCompareOp);                        // - | +
+    VK_FUNC(CmdSetDepthBoundsTestEnable);                 // - | +
+    VK_FUNC(CmdSetStencilTestEnable);                     // - | +
+    VK_FUNC(CmdSetStencilOp);                             // - | +
+                                                          // v1.3 or VK_EXT_extended_dynamic_state2
+    VK_FUNC(CmdSetPrimitiveRestartEnable);                // - | +
                                                           // v1.3 or VK_KHR_maintenance4
     VK_FUNC(GetDeviceBufferMemoryRequirements);           // + | +
     VK_FUNC(GetDeviceImageMemoryRequirements);            // + | +
@@ -212,6 +227,12 @@ struct DispatchTable {
     VK_FUNC(CmdTraceRaysIndirect2KHR);                    // - | +
                                                           // VK_EXT_calibrated_timestamps
     VK_FUNC(GetCalibratedTimestampsEXT);                  // + | +
+                                                          // VK_EXT_descriptor_buffer
+    VK_FUNC(GetDescriptorSetLayoutSizeEXT);               // + | +
+    VK_FUNC(GetDescriptorSetLayoutBindingOffsetEXT);      // + | +
+    VK_FUNC(GetDescriptorEXT);                            // + | +
+    VK_FUNC(CmdBindDescriptorBuffersEXT);                 // - | +
+    VK_FUNC(CmdSetDescriptorBufferOffsetsEXT);            // - | +
                                                           // VK_EXT_opacity_micromap
     VK_FUNC(CreateMicromapEXT);                           // + | +
     VK_FUNC(DestroyMicromapEXT);                          // - | +
@@ -219,12 +240,21 @@ struct DispatchTable {
     VK_FUNC(CmdBuildMicromapsEXT);                        // - | +
     VK_FUNC(CmdCopyMicromapEXT);                          // - | +
     VK_FUNC(CmdWriteMicromapsPropertiesEXT);              // - | +
+                                                          // VK_EXT_pageable_device_local_memory
+    VK_FUNC(SetDeviceMemoryPriorityEXT);                  // + | +
                                                           // VK_EXT_sample_locations
     VK_FUNC(CmdSetSampleLocationsEXT);                    // - | +
+                                                          // VK_EXT_extended_dynamic_state3
+    VK_FUNC(CmdSetColorBlendEnableEXT);                   // - | +
+    VK_FUNC(CmdSetColorBlendEquationEXT);                 // - | +
+    VK_FUNC(CmdSetColorWriteMaskEXT);                     // - | +
                                                           // VK_EXT_mesh_shader
     VK_FUNC(CmdDrawMeshTasksEXT);                         // - | +
     VK_FUNC(CmdDrawMeshTasksIndirectEXT);                 // - | +
     VK_FUNC(CmdDrawMeshTasksIndirectCountEXT);            // - | +
+                                                          // VK_EXT_multi_draw
+    VK_FUNC(CmdDrawMultiEXT);                             // - | +
+    VK_FUNC(CmdDrawMultiIndexedEXT);                      // - | +
                                                           // VK_NV_low_latency2
     VK_FUNC(GetLatencyTimingsNV);                         // + | +
     VK_FUNC(LatencySleepNV);                              // + | +
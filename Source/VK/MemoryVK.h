@@ -57,6 +57,7 @@ struct MemoryVK final : public DebugNameBase {
     Result Create(const MemoryVKDesc& memoryVKDesc);
     Result Create(const AllocateMemoryDesc& allocateMemoryDesc);
     Result CreateDedicated(const BufferVK* buffer, const TextureVK* texture);
+    Result SetPriority(float priority);
 
     //================================================================================================================
     // DebugNameBase
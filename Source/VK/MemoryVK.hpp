@@ -143,6 +143,23 @@ Result MemoryVK::CreateDedicated(const BufferVK* buffer, const TextureVK* textur
     return Result::SUCCESS;
 }
 
+Result MemoryVK::SetPriority(float priority) {
+    if (!m_Device.m_IsSupported.pageableDeviceLocalMemory)
+        return Result::UNSUPPORTED;
+
+    m_Priority = priority * 0.5f + 0.5f;
+
+    // A not yet allocated dedicated allocation picks up the priority on memory binding
+    // (for VMA allocations the priority applies to the whole block)
+    VkDeviceMemory handle = GetHandle();
+    if (handle) {
+        const auto& vk = m_Device.GetDispatchTable();
+        vk.SetDeviceMemoryPriorityEXT(m_Device, handle, m_Priority);
+    }
+
+    return Result::SUCCESS;
+}
+
 NRI_INLINE void MemoryVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_DEVICE_MEMORY, (uint64_t)m_Handle, name);
 }
@@ -31,6 +31,7 @@ struct PipelineCacheVK final : public DebugNameBase {
 
     Result Create(const PipelineCacheDesc& pipelineCacheDesc);
     Result GetData(void* dst, uint64_t& size) const;
+    Result Merge(const PipelineCache* const* srcPipelineCaches, uint32_t srcPipelineCacheNum);
 
 private:
     DeviceVK& m_Device;
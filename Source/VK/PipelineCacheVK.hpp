@@ -47,6 +47,21 @@ Result PipelineCacheVK::GetData(void* dst, uint64_t& size) const {
     return Result::SUCCESS;
 }
 
+Result PipelineCacheVK::Merge(const PipelineCache* const* srcPipelineCaches, uint32_t srcPipelineCacheNum) {
+    if (!m_Handle || !srcPipelineCacheNum)
+        return Result::SUCCESS;
+
+    Scratch<VkPipelineCache> vkPipelineCaches = NRI_ALLOCATE_SCRATCH(m_Device, VkPipelineCache, srcPipelineCacheNum);
+    for (uint32_t i = 0; i < srcPipelineCacheNum; i++)
+        vkPipelineCaches[i] = *(PipelineCacheVK*)srcPipelineCaches[i];
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.MergePipelineCaches(m_Device, m_Handle, srcPipelineCacheNum, vkPipelineCaches);
+    NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkMergePipelineCaches");
+
+    return Result::SUCCESS;
+}
+
 NRI_INLINE void PipelineCacheVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_PIPELINE_CACHE, (uint64_t)m_Handle, name);
 }
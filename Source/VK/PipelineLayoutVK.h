@@ -30,7 +30,11 @@ struct PipelineLayoutVK final : public DebugNameBase {
         : m_Device(device)
         , m_BindingInfo(device.GetStdAllocator())
         , m_DescriptorSetLayouts(device.GetStdAllocator())
-        , m_ImmutableSamplers(device.GetStdAllocator()) {
+        , m_ImmutableSamplers(device.GetStdAllocator())
+        , m_DescriptorBufferSetLayouts(device.GetStdAllocator())
+        , m_DescriptorBufferRangeBindings(device.GetStdAllocator())
+        , m_DescriptorBufferBindingOffsets(device.GetStdAllocator())
+        , m_Uid(device.GenerateUid()) {
     }
 
     inline operator VkPipelineLayout() const {
@@ -41,6 +45,10 @@ struct PipelineLayoutVK final : public DebugNameBase {
         return m_Device;
     }
 
+    inline uint64_t GetUid() const { // unlike the handle, never reused
+        return m_Uid;
+    }
+
     inline const BindingInfo& GetBindingInfo() const {
         return m_BindingInfo;
     }
@@ -49,6 +57,10 @@ struct PipelineLayoutVK final : public DebugNameBase {
         return m_DescriptorSetLayouts[setIndex];
     }
 
+    inline const DescriptorBufferSetLayoutVK& GetDescriptorBufferSetLayout(uint32_t setIndex) const {
+        return m_DescriptorBufferSetLayouts[setIndex];
+    }
+
     ~PipelineLayoutVK();
 
     Result Create(const PipelineLayoutDesc& pipelineLayoutDesc);
@@ -68,6 +80,10 @@ private:
     BindingInfo m_BindingInfo;
     Vector<VkDescriptorSetLayout> m_DescriptorSetLayouts;
     Vector<VkSampler> m_ImmutableSamplers;
+    Vector<DescriptorBufferSetLayoutVK> m_DescriptorBufferSetLayouts; // "VK_EXT_descriptor_buffer" only
+    Vector<uint32_t> m_DescriptorBufferRangeBindings;
+    Vector<VkDeviceSize> m_DescriptorBufferBindingOffsets;
+    uint64_t m_Uid = 0;
 };
 
 } // namespace nri
\ No newline at end of file
@@ -1,6 +1,9 @@
 // © 2021 NVIDIA Corporation
 
 PipelineLayoutVK::~PipelineLayoutVK() {
+    if (m_Device.GetDesc().features.graphicsPipelineLibrary)
+        m_Device.ReleasePipelineLibraries(m_Uid);
+
     const auto& vk = m_Device.GetDispatchTable();
     const auto allocationCallbacks = m_Device.GetVkAllocationCallbacks();
 
@@ -15,6 +18,8 @@ PipelineLayoutVK::~PipelineLayoutVK() {
 }
 
 Result PipelineLayoutVK::Create(const PipelineLayoutDesc& pipelineLayoutDesc) {
+    const auto& vk = m_Device.GetDispatchTable();
+
     // Binding offsets
     bool ignoreGlobalSPIRVOffsets = (pipelineLayoutDesc.flags & PipelineLayoutBits::IGNORE_GLOBAL_SPIRV_OFFSETS) != 0;
 
@@ -35,8 +40,17 @@ Result PipelineLayoutVK::Create(const PipelineLayoutDesc& pipelineLayoutDesc) {
 
     // Binding info
     size_t rangeNum = 0;
-    for (uint32_t i = 0; i < pipelineLayoutDesc.descriptorSetNum; i++)
-        rangeNum += pipelineLayoutDesc.descriptorSets[i].rangeNum;
+    size_t bindingNum = 0;
+    for (uint32_t i = 0; i < pipelineLayoutDesc.descriptorSetNum; i++) {
+        const DescriptorSetDesc& descriptorSetDesc = pipelineLayoutDesc.descriptorSets[i];
+        rangeNum += descriptorSetDesc.rangeNum;
+
+        for (uint32_t j = 0; j < descriptorSetDesc.rangeNum; j++) {
+            const DescriptorRangeDesc& range = descriptorSetDesc.ranges[j];
+            bool isArray = range.flags & (DescriptorRangeBits::ARRAY | DescriptorRangeBits::VARIABLE_SIZED_ARRAY);
+            bindingNum += isArray ? 1 : range.descriptorNum;
+        }
+    }
 
     m_BindingInfo.sets.insert(m_BindingInfo.sets.begin(), pipelineLayoutDesc.descriptorSets, pipelineLayoutDesc.descriptorSets + pipelineLayoutDesc.descriptorSetNum);
     m_BindingInfo.ranges.reserve(rangeNum);
@@ -45,8 +59,16 @@ Result PipelineLayoutVK::Create(const PipelineLayoutDesc& pipelineLayoutDesc) {
     m_BindingInfo.rootRegisterSpace = pipelineLayoutDesc.rootRegisterSpace;
     m_BindingInfo.rootSamplerBindingOffset = pipelineLayoutDesc.rootDescriptorNum;
 
+    bool isDescriptorBuffer = m_Device.m_IsSupported.descriptorBuffer;
+    if (isDescriptorBuffer) {
+        m_DescriptorBufferSetLayouts.resize(pipelineLayoutDesc.descriptorSetNum);
+        m_DescriptorBufferRangeBindings.resize(rangeNum);
+        m_DescriptorBufferBindingOffsets.resize(bindingNum);
+    }
+
     // Descriptor sets
     uint32_t setNum = 0;
+    uint32_t descriptorBufferBindingNum = 0;
 
     for (uint32_t i = 0; i < pipelineLayoutDesc.descriptorSetNum; i++) {
         const DescriptorSetDesc& descriptorSetDesc = pipelineLayoutDesc.descriptorSets[i];
@@ -65,6 +87,30 @@ Result PipelineLayoutVK::Create(const PipelineLayoutDesc& pipelineLayoutDesc) {
         DescriptorRangeDesc* ranges = (DescriptorRangeDesc*)m_BindingInfo.sets[i].ranges;
         for (uint32_t j = 0; j < descriptorSetDesc.rangeNum; j++)
             ranges[j].baseRegisterIndex += bindingOffsets[(uint32_t)descriptorSetDesc.ranges[j].descriptorType];
+
+        // Descriptor buffer layout (bindings are enumerated in the same order as in "CreateSetLayout")
+        if (isDescriptorBuffer && descriptorSetLayout) {
+            uint32_t* rangeBindings = m_DescriptorBufferRangeBindings.data() + (ranges - m_BindingInfo.ranges.data());
+            VkDeviceSize* bindingOffsetsInSet = m_DescriptorBufferBindingOffsets.data() + descriptorBufferBindingNum;
+            uint32_t setBindingNum = 0;
+
+            for (uint32_t j = 0; j < descriptorSetDesc.rangeNum; j++) {
+                const DescriptorRangeDesc& range = ranges[j];
+                bool isArray = range.flags & (DescriptorRangeBits::ARRAY | DescriptorRangeBits::VARIABLE_SIZED_ARRAY);
+                uint32_t rangeBindingNum = isArray ? 1 : range.descriptorNum;
+
+                rangeBindings[j] = setBindingNum;
+                for (uint32_t k = 0; k < rangeBindingNum; k++)
+                    vk.GetDescriptorSetLayoutBindingOffsetEXT(m_Device, descriptorSetLayout, range.baseRegisterIndex + k, &bindingOffsetsInSet[setBindingNum++]);
+            }
+
+            DescriptorBufferSetLayoutVK& descriptorBufferSetLayout = m_DescriptorBufferSetLayouts[i];
+            descriptorBufferSetLayout.rangeBindings = rangeBindings;
+            descriptorBufferSetLayout.bindingOffsets = bindingOffsetsInSet;
+            vk.GetDescriptorSetLayoutSizeEXT(m_Device, descriptorSetLayout, &descriptorBufferSetLayout.size);
+
+            descriptorBufferBindingNum += setBindingNum;
+        }
     }
 
     // Root constants
@@ -163,7 +209,6 @@ Result PipelineLayoutVK::Create(const PipelineLayoutDesc& pipelineLayoutDesc) {
     pipelineLayoutCreateInfo.pushConstantRangeCount = pipelineLayoutDesc.rootConstantNum;
     pipelineLayoutCreateInfo.pPushConstantRanges = pushConstantRanges;
 
-    const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.CreatePipelineLayout(m_Device, &pipelineLayoutCreateInfo, m_Device.GetVkAllocationCallbacks(), &m_Handle);
     NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreatePipelineLayout");
 
@@ -172,6 +217,7 @@ Result PipelineLayoutVK::Create(const PipelineLayoutDesc& pipelineLayoutDesc) {
 
 void PipelineLayoutVK::CreateSetLayout(VkDescriptorSetLayout* setLayout, const DescriptorSetDesc& descriptorSetDesc, const RootSamplerDesc* rootSamplers, uint32_t rootSamplerNum, bool ignoreGlobalSPIRVOffsets, bool isPush) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
+    bool isDescriptorBuffer = m_Device.m_IsSupported.descriptorBuffer;
 
     // Binding offsets
     VKBindingOffsets vkBindingOffsets = {};
@@ -223,7 +269,7 @@ void PipelineLayoutVK::CreateSetLayout(VkDescriptorSetLayout* setLayout, const D
         VkDescriptorBindingFlags flags = 0;
         if (range.flags & DescriptorRangeBits::PARTIALLY_BOUND)
             flags |= VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
-        if (range.flags & DescriptorRangeBits::ALLOW_UPDATE_AFTER_SET)
+        if ((range.flags & DescriptorRangeBits::ALLOW_UPDATE_AFTER_SET) && !isDescriptorBuffer) // descriptor buffers can always be updated after binding
             flags |= VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
 
         uint32_t descriptorNum = 1;
@@ -302,6 +348,9 @@ void PipelineLayoutVK::CreateSetLayout(VkDescriptorSetLayout* setLayout, const D
     if (isPush)
         info.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT;
 
+    if (isDescriptorBuffer)
+        info.flags = (info.flags & ~VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT) | VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.CreateDescriptorSetLayout(m_Device, &info, m_Device.GetVkAllocationCallbacks(), setLayout);
     NRI_RETURN_VOID_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateDescriptorSetLayout");
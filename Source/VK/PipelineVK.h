@@ -10,7 +10,9 @@ struct PipelineVK final : public DebugNameBase {
     }
 
     inline operator VkPipeline() const {
-        return m_Handle;
+        VkPipeline optimizedHandle = m_OptimizedHandle.load(std::memory_order_acquire);
+
+        return optimizedHandle ? optimizedHandle : m_Handle;
     }
 
     inline DeviceVK& GetDevice() const {
@@ -25,12 +27,25 @@ struct PipelineVK final : public DebugNameBase {
         return m_DepthBias;
     }
 
+    inline const PipelineFeedback& GetFeedback() const {
+        return m_Feedback;
+    }
+
+    inline bool HasDynamicVertexStride() const {
+        return m_HasDynamicVertexStride;
+    }
+
+    inline bool OwnsNativeObjects() const {
+        return m_OwnsNativeObjects;
+    }
+
     ~PipelineVK();
 
     Result Create(const GraphicsPipelineDesc& graphicsPipelineDesc);
     Result Create(const ComputePipelineDesc& computePipelineDesc);
     Result Create(const RayTracingPipelineDesc& rayTracingPipelineDesc);
     Result Create(const PipelineVKDesc& pipelineVKDesc);
+    void LinkOptimized();
 
     //================================================================================================================
     // DebugNameBase
@@ -46,13 +61,22 @@ struct PipelineVK final : public DebugNameBase {
 
 private:
     Result SetupShaderStage(VkPipelineShaderStageCreateInfo& stage, const ShaderDesc& shaderDesc, VkShaderModule& module);
+    VkResult CreateFromLibraries(const GraphicsPipelineDesc& graphicsPipelineDesc, const VkGraphicsPipelineCreateInfo& info, VkPipelineCache pipelineCache, VkPipelineCreationFeedbackCreateInfo* feedbackInfo);
+    void ProcessFeedback(const VkPipelineCreationFeedbackCreateInfo& feedbackInfo, const ShaderDesc* shaders);
 
 private:
     DeviceVK& m_Device;
     VkPipeline m_Handle = VK_NULL_HANDLE;
     VkPipelineBindPoint m_BindPoint = VK_PIPELINE_BIND_POINT_MAX_ENUM;
     DepthBiasDesc m_DepthBias = {};
+    PipelineFeedback m_Feedback = {};
+    std::array<VkPipeline, 4> m_Libraries = {}; // owned by the device
+    std::atomic<VkPipeline> m_OptimizedHandle = VK_NULL_HANDLE;
+    VkPipelineLayout m_Layout = VK_NULL_HANDLE;
+    VkPipelineCreateFlags m_LinkFlags = 0;
+    uint32_t m_LibraryNum = 0;
     bool m_OwnsNativeObjects = true;
+    bool m_HasDynamicVertexStride = false; // "VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE"
 };
 
 } // namespace nri
@@ -87,10 +87,36 @@ static bool FillPipelineRobustness(const DeviceVK& device, Robustness robustness
     return true;
 }
 
+static inline PipelineFeedbackBits GetPipelineFeedbackBits(VkPipelineCreationFeedbackFlags flags) {
+    PipelineFeedbackBits pipelineFeedbackBits = PipelineFeedbackBits::NONE;
+
+    if (flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT)
+        pipelineFeedbackBits |= PipelineFeedbackBits::VALID;
+    if (flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT)
+        pipelineFeedbackBits |= PipelineFeedbackBits::CACHE_HIT;
+
+    return pipelineFeedbackBits;
+}
+
+template <typename T, typename M>
+static inline void AddStateAfterNext(PipelineLibraryDesc& desc, const T& state, const M& lastMember) {
+    // Only for states with 32-bit members (no pointers) after "pNext". Stops at the end of "lastMember", because tail padding is not initialized
+    const uint8_t* begin = (const uint8_t*)&state + offsetof(T, pNext) + sizeof(void*);
+    const uint8_t* end = (const uint8_t*)&lastMember + sizeof(M);
+    desc.AddRaw(begin, (size_t)(end - begin));
+}
+
 PipelineVK::~PipelineVK() {
+    if (m_LibraryNum)
+        m_Device.CancelOptimizedLink(*this);
+
+    if (m_Feedback.flags & PipelineFeedbackBits::VALID)
+        m_Device.RemovePipelineFeedback(*this);
+
     if (m_OwnsNativeObjects) {
         const auto& vk = m_Device.GetDispatchTable();
         vk.DestroyPipeline(m_Device, m_Handle, m_Device.GetVkAllocationCallbacks());
+        vk.DestroyPipeline(m_Device, m_OptimizedHandle.load(), m_Device.GetVkAllocationCallbacks());
     }
 }
 
@@ -333,8 +359,10 @@ Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
     }
 
     // Dynamic state
+    const DynamicStateBits dynamic = graphicsPipelineDesc.dynamicStates;
+
     uint32_t dynamicStateNum = 0;
-    std::array<VkDynamicState, 16> dynamicStates;
+    std::array<VkDynamicState, 32> dynamicStates;
     if (m_Device.GetDesc().features.extendedDynamicState) {
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT;
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT;
@@ -343,21 +371,55 @@ Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_SCISSOR;
     }
 
-    if (vi && m_Device.GetDesc().features.extendedDynamicState)
+    if (vi && m_Device.GetDesc().features.extendedDynamicState) {
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE;
+        m_HasDynamicVertexStride = true;
+    }
     if (rasterizationState.depthBiasEnable)
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_DEPTH_BIAS;
-    if (depthStencilState.depthBoundsTestEnable)
+    if (depthStencilState.depthBoundsTestEnable || ((dynamic & DynamicStateBits::DEPTH) && m_Device.GetDesc().features.depthBoundsTest))
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_DEPTH_BOUNDS;
-    if (depthStencilState.stencilTestEnable)
+    if (depthStencilState.stencilTestEnable || (dynamic & DynamicStateBits::STENCIL))
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_STENCIL_REFERENCE;
     if (sampleLocationsState.sampleLocationsEnable)
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_SAMPLE_LOCATIONS_EXT;
-    if (isConstantColorReferenced)
+    if (isConstantColorReferenced || (dynamic & DynamicStateBits::COLOR))
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_BLEND_CONSTANTS;
     if (r.shadingRate)
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR;
 
+    if (dynamic & DynamicStateBits::TOPOLOGY) {
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE;
+    }
+
+    if (dynamic & DynamicStateBits::CULL_MODE)
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_CULL_MODE;
+
+    if (dynamic & DynamicStateBits::FRONT_FACE)
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_FRONT_FACE;
+
+    if (dynamic & DynamicStateBits::DEPTH) {
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_DEPTH_COMPARE_OP;
+        if (m_Device.GetDesc().features.depthBoundsTest)
+            dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_DEPTH_BOUNDS_TEST_ENABLE;
+    }
+
+    if (dynamic & DynamicStateBits::STENCIL) {
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_STENCIL_OP;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_STENCIL_WRITE_MASK;
+    }
+
+    if (dynamic & DynamicStateBits::COLOR) {
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT;
+        dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT;
+    }
+
     VkPipelineDynamicStateCreateInfo dynamicState = {VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO};
     dynamicState.dynamicStateCount = dynamicStateNum;
     dynamicState.pDynamicStates = dynamicStates.data();
@@ -368,6 +430,8 @@ Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
         flags |= VK_PIPELINE_CREATE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR;
     if ((graphicsPipelineDesc.flags & GraphicsPipelineBits::FAIL_ON_CACHE_MISS) && m_Device.GetDesc().features.pipelineCacheControl)
         flags |= VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT;
+    if (m_Device.m_IsSupported.descriptorBuffer)
+        flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     const PipelineLayoutVK& pipelineLayoutVK = *(PipelineLayoutVK*)graphicsPipelineDesc.pipelineLayout;
 
@@ -401,11 +465,29 @@ Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
     if (FillPipelineRobustness(m_Device, graphicsPipelineDesc.robustness, robustnessInfo))
         PNEXTCHAIN_APPEND_STRUCT(robustnessInfo);
 
+    // Feedback is not chained for libraries, because "info.pNext" is inherited by library creation having different stage counts
+    Scratch<VkPipelineCreationFeedback> stageFeedbacks = NRI_ALLOCATE_SCRATCH(m_Device, VkPipelineCreationFeedback, graphicsPipelineDesc.shaderNum);
+    VkPipelineCreationFeedback pipelineFeedback = {};
+
+    VkPipelineCreationFeedbackCreateInfo feedbackInfo = {VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO};
+    feedbackInfo.pPipelineCreationFeedback = &pipelineFeedback;
+    feedbackInfo.pipelineStageCreationFeedbackCount = graphicsPipelineDesc.shaderNum;
+    feedbackInfo.pPipelineStageCreationFeedbacks = stageFeedbacks;
+
+    bool useLibraries = (graphicsPipelineDesc.flags & GraphicsPipelineBits::USE_LIBRARIES) && m_Device.GetDesc().features.graphicsPipelineLibrary;
+    if (m_Device.m_IsSupported.pipelineCreationFeedback && !useLibraries)
+        PNEXTCHAIN_APPEND_STRUCT(feedbackInfo);
+
     const auto& vk = m_Device.GetDispatchTable();
     VkPipelineCache pipelineCache = VK_NULL_HANDLE;
     if (graphicsPipelineDesc.cache)
         pipelineCache = *(PipelineCacheVK*)graphicsPipelineDesc.cache;
-    VkResult vkResult = vk.CreateGraphicsPipelines(m_Device, pipelineCache, 1, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
+
+    VkResult vkResult = VK_SUCCESS;
+    if (useLibraries)
+        vkResult = CreateFromLibraries(graphicsPipelineDesc, info, pipelineCache, m_Device.m_IsSupported.pipelineCreationFeedback ? &feedbackInfo : nullptr);
+    else
+        vkResult = vk.CreateGraphicsPipelines(m_Device, pipelineCache, 1, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
 
     for (size_t i = 0; i < graphicsPipelineDesc.shaderNum; i++)
         vk.DestroyShaderModule(m_Device, modules[i], m_Device.GetVkAllocationCallbacks());
@@ -414,6 +496,9 @@ Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
         return Result::FAILURE;
     NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateGraphicsPipelines");
 
+    if (m_Device.m_IsSupported.pipelineCreationFeedback)
+        ProcessFeedback(feedbackInfo, graphicsPipelineDesc.shaders);
+
     return Result::SUCCESS;
 }
 
@@ -448,6 +533,8 @@ Result PipelineVK::Create(const ComputePipelineDesc& computePipelineDesc) {
     VkPipelineCreateFlags computeFlags = 0;
     if ((computePipelineDesc.flags & ComputePipelineBits::FAIL_ON_CACHE_MISS) && m_Device.GetDesc().features.pipelineCacheControl)
         computeFlags |= VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT;
+    if (m_Device.m_IsSupported.descriptorBuffer)
+        computeFlags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     VkComputePipelineCreateInfo info = {
         VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
@@ -459,9 +546,22 @@ Result PipelineVK::Create(const ComputePipelineDesc& computePipelineDesc) {
         -1,
     };
 
+    PNEXTCHAIN_DECLARE(info.pNext);
+
     VkPipelineRobustnessCreateInfoEXT robustnessInfo = {VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT};
     if (FillPipelineRobustness(m_Device, computePipelineDesc.robustness, robustnessInfo))
-        info.pNext = &robustnessInfo;
+        PNEXTCHAIN_APPEND_STRUCT(robustnessInfo);
+
+    VkPipelineCreationFeedback stageFeedback = {};
+    VkPipelineCreationFeedback pipelineFeedback = {};
+
+    VkPipelineCreationFeedbackCreateInfo feedbackInfo = {VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO};
+    feedbackInfo.pPipelineCreationFeedback = &pipelineFeedback;
+    feedbackInfo.pipelineStageCreationFeedbackCount = 1;
+    feedbackInfo.pPipelineStageCreationFeedbacks = &stageFeedback;
+
+    if (m_Device.m_IsSupported.pipelineCreationFeedback)
+        PNEXTCHAIN_APPEND_STRUCT(feedbackInfo);
 
     VkPipelineCache pipelineCache = VK_NULL_HANDLE;
     if (computePipelineDesc.cache)
@@ -474,6 +574,9 @@ Result PipelineVK::Create(const ComputePipelineDesc& computePipelineDesc) {
         return Result::FAILURE;
     NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateComputePipelines");
 
+    if (m_Device.m_IsSupported.pipelineCreationFeedback)
+        ProcessFeedback(feedbackInfo, &computePipelineDesc.shader);
+
     return Result::SUCCESS;
 }
 
@@ -567,10 +670,25 @@ Result PipelineVK::Create(const RayTracingPipelineDesc& rayTracingPipelineDesc)
         createInfo.flags |= VK_PIPELINE_CREATE_RAY_TRACING_OPACITY_MICROMAP_BIT_EXT;
     if ((rayTracingPipelineDesc.flags & RayTracingPipelineBits::FAIL_ON_CACHE_MISS) && m_Device.GetDesc().features.pipelineCacheControl)
         createInfo.flags |= VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT;
+    if (m_Device.m_IsSupported.descriptorBuffer)
+        createInfo.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+
+    PNEXTCHAIN_DECLARE(createInfo.pNext);
 
     VkPipelineRobustnessCreateInfoEXT robustnessInfo = {VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT};
     if (FillPipelineRobustness(m_Device, rayTracingPipelineDesc.robustness, robustnessInfo))
-        createInfo.pNext = &robustnessInfo;
+        PNEXTCHAIN_APPEND_STRUCT(robustnessInfo);
+
+    Scratch<VkPipelineCreationFeedback> stageFeedbacks = NRI_ALLOCATE_SCRATCH(m_Device, VkPipelineCreationFeedback, stageNum);
+    VkPipelineCreationFeedback pipelineFeedback = {};
+
+    VkPipelineCreationFeedbackCreateInfo feedbackInfo = {VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO};
+    feedbackInfo.pPipelineCreationFeedback = &pipelineFeedback;
+    feedbackInfo.pipelineStageCreationFeedbackCount = stageNum;
+    feedbackInfo.pPipelineStageCreationFeedbacks = stageFeedbacks;
+
+    if (m_Device.m_IsSupported.pipelineCreationFeedback)
+        PNEXTCHAIN_APPEND_STRUCT(feedbackInfo);
 
     const auto& vk = m_Device.GetDispatchTable();
     VkPipelineCache pipelineCache = VK_NULL_HANDLE;
@@ -587,6 +705,9 @@ Result PipelineVK::Create(const RayTracingPipelineDesc& rayTracingPipelineDesc)
         return Result::FAILURE;
     NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateRayTracingPipelinesKHR");
 
+    if (m_Device.m_IsSupported.pipelineCreationFeedback)
+        ProcessFeedback(feedbackInfo, rayTracingPipelineDesc.shaderLibrary->shaders);
+
     return Result::SUCCESS;
 }
 
@@ -598,6 +719,183 @@ Result PipelineVK::Create(const PipelineVKDesc& pipelineVKDesc) {
     return Result::SUCCESS;
 }
 
+VkResult PipelineVK::CreateFromLibraries(const GraphicsPipelineDesc& graphicsPipelineDesc, const VkGraphicsPipelineCreateInfo& info, VkPipelineCache pipelineCache, VkPipelineCreationFeedbackCreateInfo* feedbackInfo) {
+    const PipelineLayoutVK& pipelineLayoutVK = *(PipelineLayoutVK*)graphicsPipelineDesc.pipelineLayout;
+    const OutputMergerDesc& om = graphicsPipelineDesc.outputMerger;
+    const RasterizationDesc& r = graphicsPipelineDesc.rasterization;
+    const MultisampleDesc* ms = graphicsPipelineDesc.multisample;
+
+    // Library descs are built from the states each library consumes
+    const StdAllocator<uint8_t>& allocator = m_Device.GetStdAllocator();
+
+    PipelineLibraryDesc common(allocator);
+    common.AddBytes(info.pDynamicState->pDynamicStates, info.pDynamicState->dynamicStateCount * sizeof(VkDynamicState));
+    common.Add(info.flags);
+    common.Add(info.renderPass); // render passes live as long as the device
+    common.Add(om.viewMask);
+    common.Add(graphicsPipelineDesc.robustness);
+
+    PipelineLibraryDesc multisample(allocator);
+    multisample.Add(info.pMultisampleState->rasterizationSamples);
+    multisample.Add(info.pMultisampleState->pSampleMask ? *info.pMultisampleState->pSampleMask : (VkSampleMask)ALL);
+    multisample.Add(info.pMultisampleState->alphaToCoverageEnable);
+    multisample.Add(ms ? ms->sampleLocations : false);
+
+    PipelineLibraryDesc renderTarget(allocator);
+    renderTarget.Add(om.colorNum);
+    for (uint32_t i = 0; i < om.colorNum; i++)
+        renderTarget.Add(om.colors[i].format);
+    renderTarget.Add(om.depthStencilFormat);
+
+    // Vertex input interface
+    const VkPipelineVertexInputStateCreateInfo& vertexInputState = *info.pVertexInputState;
+
+    PipelineLibraryDesc vertexInput = common;
+    vertexInput.AddBytes(vertexInputState.pVertexAttributeDescriptions, vertexInputState.vertexAttributeDescriptionCount * sizeof(VkVertexInputAttributeDescription));
+    vertexInput.AddBytes(vertexInputState.pVertexBindingDescriptions, vertexInputState.vertexBindingDescriptionCount * sizeof(VkVertexInputBindingDescription));
+    vertexInput.Add(info.pInputAssemblyState->topology);
+    vertexInput.Add(info.pInputAssemblyState->primitiveRestartEnable);
+
+    // Shaders
+    Scratch<VkPipelineShaderStageCreateInfo> preRasterizationStages = NRI_ALLOCATE_SCRATCH(m_Device, VkPipelineShaderStageCreateInfo, info.stageCount);
+    uint32_t preRasterizationStageNum = 0;
+    const VkPipelineShaderStageCreateInfo* fragmentStage = nullptr;
+    bool isMeshPipeline = false;
+
+    PipelineLibraryDesc preRasterization = common;
+    PipelineLibraryDesc fragmentShader = common;
+    for (uint32_t i = 0; i < info.stageCount; i++) {
+        const VkPipelineShaderStageCreateInfo& stage = info.pStages[i];
+        const ShaderDesc& shaderDesc = graphicsPipelineDesc.shaders[i];
+
+        PipelineLibraryDesc& desc = stage.stage == VK_SHADER_STAGE_FRAGMENT_BIT ? fragmentShader : preRasterization;
+        desc.AddBytes(shaderDesc.bytecode, (size_t)shaderDesc.size);
+        desc.AddBytes(stage.pName, strlen(stage.pName));
+        desc.Add(stage.stage);
+
+        if (stage.stage == VK_SHADER_STAGE_FRAGMENT_BIT)
+            fragmentStage = &stage;
+        else
+            preRasterizationStages[preRasterizationStageNum++] = stage;
+
+        if (stage.stage == VK_SHADER_STAGE_MESH_BIT_EXT)
+            isMeshPipeline = true;
+    }
+
+    // Pre-rasterization shaders
+    preRasterization.layoutUid = pipelineLayoutVK.GetUid();
+    preRasterization.Add(info.pTessellationState->patchControlPoints);
+    preRasterization.Add(info.pViewportState->viewportCount);
+    preRasterization.Add(info.pViewportState->scissorCount);
+    AddStateAfterNext(preRasterization, *info.pRasterizationState, info.pRasterizationState->lineWidth);
+    preRasterization.Add(r.conservativeRaster);
+    preRasterization.Add(r.lineSmoothing);
+
+    // Fragment shader
+    fragmentShader.layoutUid = pipelineLayoutVK.GetUid();
+    AddStateAfterNext(fragmentShader, *info.pDepthStencilState, info.pDepthStencilState->maxDepthBounds);
+    fragmentShader.Add(multisample);
+    fragmentShader.Add(renderTarget);
+
+    // Fragment output interface
+    const VkPipelineColorBlendStateCreateInfo& colorBlendState = *info.pColorBlendState;
+
+    PipelineLibraryDesc fragmentOutput = common;
+    fragmentOutput.AddBytes(colorBlendState.pAttachments, colorBlendState.attachmentCount * sizeof(VkPipelineColorBlendAttachmentState));
+    fragmentOutput.Add(colorBlendState.logicOpEnable);
+    fragmentOutput.Add(colorBlendState.logicOp);
+    fragmentOutput.Add(multisample);
+    fragmentOutput.Add(renderTarget);
+
+    // Get or create libraries. States not belonging to a library are ignored by the driver, so "info" is reused as is
+    struct LibraryDesc {
+        VkGraphicsPipelineLibraryFlagsEXT flags;
+        PipelineLibraryDesc* desc;
+        const VkPipelineShaderStageCreateInfo* stages;
+        uint32_t stageNum;
+    };
+
+    const std::array<LibraryDesc, 4> libraryDescs = {{
+        {VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, &vertexInput, nullptr, 0},
+        {VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT, &preRasterization, preRasterizationStages, preRasterizationStageNum},
+        {VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, &fragmentShader, fragmentStage, fragmentStage ? 1u : 0u},
+        {VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, &fragmentOutput, nullptr, 0},
+    }};
+
+    VkGraphicsPipelineLibraryCreateInfoEXT libraryCreateInfo = {VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT};
+    libraryCreateInfo.pNext = info.pNext;
+
+    VkGraphicsPipelineCreateInfo libraryInfo = info;
+    libraryInfo.pNext = &libraryCreateInfo;
+    libraryInfo.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+
+    for (const LibraryDesc& libraryDesc : libraryDescs) {
+        if (isMeshPipeline && libraryDesc.flags == VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT)
+            continue;
+
+        libraryCreateInfo.flags = libraryDesc.flags;
+        libraryInfo.stageCount = libraryDesc.stageNum;
+        libraryInfo.pStages = libraryDesc.stages;
+
+        libraryDesc.desc->Add(libraryDesc.flags);
+
+        VkResult vkResult = m_Device.GetOrCreatePipelineLibrary(*libraryDesc.desc, libraryInfo, pipelineCache, m_Libraries[m_LibraryNum]);
+        if (vkResult != VK_SUCCESS)
+            return vkResult;
+
+        m_LibraryNum++;
+    }
+
+    // Fast link
+    m_Layout = info.layout;
+    m_LinkFlags = info.flags;
+
+    VkPipelineLibraryCreateInfoKHR linkInfo = {VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR};
+    linkInfo.libraryCount = m_LibraryNum;
+    linkInfo.pLibraries = m_Libraries.data();
+
+    VkGraphicsPipelineCreateInfo pipelineInfo = {VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+    pipelineInfo.pNext = &linkInfo;
+    pipelineInfo.flags = m_LinkFlags;
+    pipelineInfo.layout = m_Layout;
+
+    // Only the fast link gets measured, since libraries are shared between pipelines
+    if (feedbackInfo) {
+        feedbackInfo->pipelineStageCreationFeedbackCount = 0;
+        linkInfo.pNext = feedbackInfo;
+    }
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.CreateGraphicsPipelines(m_Device, pipelineCache, 1, &pipelineInfo, m_Device.GetVkAllocationCallbacks(), &m_Handle);
+    if (vkResult != VK_SUCCESS)
+        return vkResult;
+
+    // Optimized link
+    m_Device.QueueOptimizedLink(*this);
+
+    return VK_SUCCESS;
+}
+
+void PipelineVK::LinkOptimized() {
+    VkPipelineLibraryCreateInfoKHR linkInfo = {VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR};
+    linkInfo.libraryCount = m_LibraryNum;
+    linkInfo.pLibraries = m_Libraries.data();
+
+    // No "FAIL_ON_PIPELINE_COMPILE_REQUIRED": there is no cache here, since the user one can be already destroyed
+    VkGraphicsPipelineCreateInfo pipelineInfo = {VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+    pipelineInfo.pNext = &linkInfo;
+    pipelineInfo.flags = (m_LinkFlags & ~VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT) | VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT;
+    pipelineInfo.layout = m_Layout;
+
+    VkPipeline handle = VK_NULL_HANDLE;
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.CreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &pipelineInfo, m_Device.GetVkAllocationCallbacks(), &handle);
+
+    // Keep using the fast-linked pipeline on failure
+    if (vkResult == VK_SUCCESS)
+        m_OptimizedHandle.store(handle, std::memory_order_release);
+}
+
 Result PipelineVK::SetupShaderStage(VkPipelineShaderStageCreateInfo& stage, const ShaderDesc& shaderDesc, VkShaderModule& module) {
     const VkShaderModuleCreateInfo moduleInfo = {
         VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
@@ -624,8 +922,32 @@ Result PipelineVK::SetupShaderStage(VkPipelineShaderStageCreateInfo& stage, cons
     return Result::SUCCESS;
 }
 
+void PipelineVK::ProcessFeedback(const VkPipelineCreationFeedbackCreateInfo& feedbackInfo, const ShaderDesc* shaders) {
+    const VkPipelineCreationFeedback& pipelineFeedback = *feedbackInfo.pPipelineCreationFeedback;
+    if (!(pipelineFeedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT))
+        return;
+
+    m_Feedback.duration = pipelineFeedback.duration;
+    m_Feedback.flags = GetPipelineFeedbackBits(pipelineFeedback.flags);
+    m_Feedback.stageNum = std::min(feedbackInfo.pipelineStageCreationFeedbackCount, GetCountOf(m_Feedback.stages));
+
+    for (uint32_t i = 0; i < m_Feedback.stageNum; i++) {
+        const VkPipelineCreationFeedback& stageFeedback = feedbackInfo.pPipelineStageCreationFeedbacks[i];
+
+        PipelineStageFeedback& pipelineStageFeedback = m_Feedback.stages[i];
+        pipelineStageFeedback.stage = shaders[i].stage;
+        pipelineStageFeedback.duration = stageFeedback.duration;
+        pipelineStageFeedback.flags = GetPipelineFeedbackBits(stageFeedback.flags);
+    }
+
+    m_Device.AddPipelineFeedback(*this, m_Feedback);
+}
+
 NRI_INLINE void PipelineVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_PIPELINE, (uint64_t)m_Handle, name);
+
+    if (m_Feedback.flags & PipelineFeedbackBits::VALID)
+        m_Device.SetPipelineFeedbackName(*this, name);
 }
 
 NRI_INLINE Result PipelineVK::WriteShaderGroupIdentifiers(uint32_t baseShaderGroupIndex, uint32_t shaderGroupNum, void* dst) const {
@@ -8,6 +8,11 @@
 #endif
 #undef CreateSemaphore
 
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "DispatchTable.h"
 #include "SharedExternal.h"
 
@@ -29,6 +29,9 @@ struct SwapChainVK final : public DisplayDescHelper, DebugNameBase {
     //================================================================================================================
 
     inline Result GetDisplayDesc(DisplayDesc& displayDesc) {
+        if (m_Virtual)
+            return m_Virtual->GetDisplayDesc(displayDesc);
+
         return DisplayDescHelper::GetDisplayDesc(m_Hwnd, displayDesc);
     }
 
@@ -45,6 +48,7 @@ struct SwapChainVK final : public DisplayDescHelper, DebugNameBase {
 private:
     DeviceVK& m_Device;
     Vector<TextureVK*> m_Textures;
+    SwapChainVirtual* m_Virtual = nullptr; // "SwapChainBits::VIRTUAL"
     FenceVK* m_LatencyFence = nullptr;
     VkSwapchainKHR m_Handle = VK_NULL_HANDLE;
     VkSurfaceKHR m_Surface = VK_NULL_HANDLE;
@@ -18,6 +18,8 @@ constexpr VkPresentGravityFlagBitsKHR GetGravity(Gravity gravity) {
 SwapChainVK::~SwapChainVK() {
     // TODO: use "vkReleaseSwapchainImagesEXT" to release acquired but not presented images?
 
+    Destroy(m_Virtual);
+
     for (size_t i = 0; i < m_Textures.size(); i++)
         Destroy(m_Textures[i]);
 
@@ -32,6 +34,13 @@ SwapChainVK::~SwapChainVK() {
 }
 
 Result SwapChainVK::Create(const SwapChainDesc& swapChainDesc) {
+    if (swapChainDesc.flags & SwapChainBits::VIRTUAL) {
+        m_Flags = swapChainDesc.flags;
+        m_Virtual = Allocate<SwapChainVirtual>(m_Device.GetAllocationCallbacks(), m_Device);
+
+        return m_Virtual->Create(swapChainDesc);
+    }
+
     const auto& vk = m_Device.GetDispatchTable();
 
     m_Queue = (QueueVK*)swapChainDesc.queue;
@@ -430,12 +439,18 @@ NRI_INLINE void SwapChainVK::SetDebugName(const char* name) {
 }
 
 NRI_INLINE Texture* const* SwapChainVK::GetTextures(uint32_t& textureNum) const {
+    if (m_Virtual)
+        return m_Virtual->GetTextures(textureNum);
+
     textureNum = (uint32_t)m_Textures.size();
 
     return (Texture* const*)m_Textures.data();
 }
 
 NRI_INLINE Result SwapChainVK::AcquireNextTexture(FenceVK& acquireSemaphore, uint32_t& textureIndex) {
+    if (m_Virtual)
+        return m_Virtual->AcquireNextTexture((Fence&)acquireSemaphore, textureIndex);
+
     ExclusiveScope lock(m_Queue->GetLock());
 
     // Acquire next image (signal)
@@ -455,6 +470,9 @@ NRI_INLINE Result SwapChainVK::AcquireNextTexture(FenceVK& acquireSemaphore, uin
 }
 
 NRI_INLINE Result SwapChainVK::WaitForPresent(uint64_t presentId) {
+    if (m_Virtual)
+        return m_Virtual->WaitForPresent(presentId);
+
     if (!(m_Flags & SwapChainBits::WAITABLE) || presentId == 0)
         return Result::UNSUPPORTED;
 
@@ -466,6 +484,9 @@ NRI_INLINE Result SwapChainVK::WaitForPresent(uint64_t presentId) {
 }
 
 NRI_INLINE Result SwapChainVK::Present(FenceVK& releaseSemaphore, uint64_t presentIdValue) {
+    if (m_Virtual)
+        return m_Virtual->Present((Fence&)releaseSemaphore, presentIdValue);
+
     ExclusiveScope lock(m_Queue->GetLock());
 
     // Present (wait)
@@ -500,6 +521,9 @@ NRI_INLINE Result SwapChainVK::Present(FenceVK& releaseSemaphore, uint64_t prese
 }
 
 NRI_INLINE Result SwapChainVK::SetLatencySleepMode(const LatencySleepMode& latencySleepMode) {
+    if (m_Virtual)
+        return m_Virtual->SetLatencySleepMode(latencySleepMode);
+
     VkLatencySleepModeInfoNV sleepModeInfo = {VK_STRUCTURE_TYPE_LATENCY_SLEEP_MODE_INFO_NV};
     sleepModeInfo.lowLatencyMode = latencySleepMode.lowLatencyMode;
     sleepModeInfo.lowLatencyBoost = latencySleepMode.lowLatencyBoost;
@@ -513,6 +537,9 @@ NRI_INLINE Result SwapChainVK::SetLatencySleepMode(const LatencySleepMode& laten
 }
 
 NRI_INLINE Result SwapChainVK::SetLatencyMarker(uint64_t presentId, LatencyMarker latencyMarker) {
+    if (m_Virtual)
+        return m_Virtual->SetLatencyMarker(presentId, latencyMarker);
+
     VkSetLatencyMarkerInfoNV markerInfo = {VK_STRUCTURE_TYPE_SET_LATENCY_MARKER_INFO_NV};
     markerInfo.presentID = presentId;
     markerInfo.marker = (VkLatencyMarkerNV)latencyMarker;
@@ -524,6 +551,9 @@ NRI_INLINE Result SwapChainVK::SetLatencyMarker(uint64_t presentId, LatencyMarke
 }
 
 NRI_INLINE Result SwapChainVK::LatencySleep(uint64_t presentId) {
+    if (m_Virtual)
+        return m_Virtual->LatencySleep(presentId);
+
     VkLatencySleepInfoNV sleepInfo = {VK_STRUCTURE_TYPE_LATENCY_SLEEP_INFO_NV};
     sleepInfo.signalSemaphore = *m_LatencyFence;
     sleepInfo.value = presentId;
@@ -538,6 +568,9 @@ NRI_INLINE Result SwapChainVK::LatencySleep(uint64_t presentId) {
 }
 
 NRI_INLINE Result SwapChainVK::GetLatencyReport(LatencyReport& latencyReport) {
+    if (m_Virtual)
+        return m_Virtual->GetLatencyReport(latencyReport);
+
     VkLatencyTimingsFrameReportNV timingsInfo[64] = {};
     for (uint32_t i = 0; i < GetCountOf(timingsInfo); i++)
         timingsInfo[i].sType = VK_STRUCTURE_TYPE_LATENCY_TIMINGS_FRAME_REPORT_NV;
@@ -4,7 +4,7 @@ AccelerationStructureVal::~AccelerationStructureVal() {
     if (m_Memory)
         m_Memory->Unbind(*this);
 
-    Destroy(m_Buffer);
+    m_Device.DestroyObject(m_Buffer);
 }
 
 NRI_INLINE uint64_t AccelerationStructureVal::GetUpdateScratchBufferSize() const {
@@ -32,7 +32,7 @@ NRI_INLINE Buffer* AccelerationStructureVal::GetBuffer() {
 
     if (!m_Buffer) {
         Buffer* buffer = GetRayTracingInterfaceImpl().GetAccelerationStructureBuffer(*GetImpl());
-        m_Buffer = Allocate<BufferVal>(m_Device.GetAllocationCallbacks(), m_Device, buffer, false);
+        m_Buffer = m_Device.AllocateObject<BufferVal>(m_Device, buffer, false);
     }
 
     return (Buffer*)m_Buffer;
@@ -46,7 +46,7 @@ NRI_INLINE Result AccelerationStructureVal::CreateDescriptor(Descriptor*& descri
 
     descriptor = nullptr;
     if (result == Result::SUCCESS)
-        descriptor = (Descriptor*)Allocate<DescriptorVal>(m_Device.GetAllocationCallbacks(), m_Device, descriptorImpl, DescriptorType::ACCELERATION_STRUCTURE);
+        descriptor = (Descriptor*)m_Device.AllocateObject<DescriptorVal>(m_Device, descriptorImpl, DescriptorType::ACCELERATION_STRUCTURE);
 
     return result;
 }
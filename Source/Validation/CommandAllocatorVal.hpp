@@ -6,7 +6,7 @@ NRI_INLINE Result CommandAllocatorVal::CreateCommandBuffer(CommandBuffer*& comma
 
     commandBuffer = nullptr;
     if (result == Result::SUCCESS)
-        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(m_Device.GetAllocationCallbacks(), m_Device, commandBufferImpl, false);
+        commandBuffer = (CommandBuffer*)m_Device.AllocateObject<CommandBufferVal>(m_Device, commandBufferImpl, false);
 
     return result;
 }
@@ -8,6 +8,7 @@ struct CommandBufferVal final : public ObjectVal {
     CommandBufferVal(DeviceVal& device, CommandBuffer* commandBuffer, bool isWrapped)
         : ObjectVal(device, commandBuffer)
         , m_DescriptorSets(device.GetStdAllocator())
+        , m_Validation(device.GetCommandBufferValidation())
         , m_IsRecordingStarted(isWrapped)
         , m_IsWrapped(isWrapped) {
     }
@@ -20,6 +21,10 @@ struct CommandBufferVal final : public ObjectVal {
         return GetCoreInterfaceImpl().GetCommandBufferNativeObject(GetImpl());
     }
 
+    inline bool IsSubmittable() const {
+        return !m_IsRecordingStarted || m_IsWrapped;
+    }
+
     inline void ResetAttachments() {
         m_RenderTargetNum = 0;
         for (auto& renderTarget : m_RenderTargets)
@@ -47,6 +52,12 @@ struct CommandBufferVal final : public ObjectVal {
     void SetBlendConstants(const Color32f& color);
     void SetShadingRate(const ShadingRateDesc& shadingRateDesc);
     void SetDepthBias(const DepthBiasDesc& depthBiasDesc);
+    void SetTopology(Topology topology, PrimitiveRestart primitiveRestart);
+    void SetCullMode(CullMode cullMode);
+    void SetFrontFace(bool frontCounterClockwise);
+    void SetDepthState(const DepthAttachmentDesc& depth);
+    void SetStencilState(const StencilAttachmentDesc& stencil);
+    void SetColorState(uint32_t baseAttachment, const ColorAttachmentDesc* colors, uint32_t colorNum);
     void ClearAttachments(const ClearAttachmentDesc* clearAttachmentDescs, uint32_t clearAttachmentDescNum, const Rect* rects, uint32_t rectNum);
     void ClearStorage(const ClearStorageDesc& clearStorageDesc);
     void BeginRendering(const RenderingDesc& renderingDesc);
@@ -61,6 +72,8 @@ struct CommandBufferVal final : public ObjectVal {
     void SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc);
     void Draw(const DrawDesc& drawDesc);
     void DrawIndexed(const DrawIndexedDesc& drawIndexedDesc);
+    void DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride);
+    void DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride);
     void DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size);
@@ -90,6 +103,7 @@ struct CommandBufferVal final : public ObjectVal {
     void DispatchRaysIndirect(const Buffer& buffer, uint64_t offset);
     void DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc);
     void DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
+    void ExecuteCommandsVK(const VKHandle* vkCommandBuffers, uint32_t vkCommandBufferNum);
 
 private:
     void ValidateReadonlyDepthStencil();
@@ -101,6 +115,7 @@ private:
     PipelineVal* m_Pipeline = nullptr;
     uint32_t m_RenderTargetNum = 0;
     int32_t m_AnnotationStack = 0;
+    ValidationBits m_Validation = ValidationBits::NONE; // for the current recording
     bool m_IsRecordingStarted = false;
     bool m_IsWrapped = false;
     bool m_IsRenderPass = false;
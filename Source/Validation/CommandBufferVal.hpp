@@ -1,5 +1,9 @@
 // © 2021 NVIDIA Corporation
 
+// A check from an optional category: a single well-predicted branch if the category is disabled or the recording is sampled out
+#define NRI_VALIDATE(category, condition, returnCode, format, ...) \
+    NRI_RETURN_ON_FAILURE(&m_Device, !(m_Validation & ValidationBits::category) || (condition), returnCode, format, ##__VA_ARGS__)
+
 static inline bool IsAccessMaskSupported(const BufferDesc& bufferDesc, AccessBits accessMask) {
     bool isSupported = true;
     if (accessMask & AccessBits::INDEX_BUFFER)
@@ -176,6 +180,8 @@ NRI_INLINE Result CommandBufferVal::Begin(const DescriptorPool* descriptorPool)
     if (result == Result::SUCCESS)
         m_IsRecordingStarted = true;
 
+    m_Validation = m_Device.GetCommandBufferValidation();
+
     m_Pipeline = nullptr;
     m_PipelineLayout = nullptr;
 
@@ -201,7 +207,7 @@ NRI_INLINE Result CommandBufferVal::End() {
 }
 
 NRI_INLINE void CommandBufferVal::SetViewports(const Viewport* viewports, uint32_t viewportNum) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
     NRI_RETURN_ON_FAILURE(&m_Device, viewportNum != 0, ReturnVoid(), "'viewportNum' is 0");
@@ -217,7 +223,7 @@ NRI_INLINE void CommandBufferVal::SetViewports(const Viewport* viewports, uint32
 }
 
 NRI_INLINE void CommandBufferVal::SetScissors(const Rect* rects, uint32_t rectNum) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, rectNum != 0, ReturnVoid(), "'rectNum' is 0");
     NRI_RETURN_ON_FAILURE(&m_Device, rectNum <= m_Device.GetDesc().viewport.maxNum, ReturnVoid(), "'rectNum' is greater than 'DeviceDesc::viewport.maxNum'");
 
@@ -227,14 +233,14 @@ NRI_INLINE void CommandBufferVal::SetScissors(const Rect* rects, uint32_t rectNu
 NRI_INLINE void CommandBufferVal::SetDepthBounds(float boundsMin, float boundsMax) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.features.depthBoundsTest, ReturnVoid(), "'features.depthBoundsTest' is false");
 
     GetCoreInterfaceImpl().CmdSetDepthBounds(*GetImpl(), boundsMin, boundsMax);
 }
 
 NRI_INLINE void CommandBufferVal::SetStencilReference(uint8_t frontRef, uint8_t backRef) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
     GetCoreInterfaceImpl().CmdSetStencilReference(*GetImpl(), frontRef, backRef);
 }
@@ -242,14 +248,14 @@ NRI_INLINE void CommandBufferVal::SetStencilReference(uint8_t frontRef, uint8_t
 NRI_INLINE void CommandBufferVal::SetSampleLocations(const SampleLocation* locations, Sample_t locationNum, Sample_t sampleNum) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.tiers.sampleLocations != 0, ReturnVoid(), "'tiers.sampleLocations > 0' required");
 
     GetCoreInterfaceImpl().CmdSetSampleLocations(*GetImpl(), locations, locationNum, sampleNum);
 }
 
 NRI_INLINE void CommandBufferVal::SetBlendConstants(const Color32f& color) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
     GetCoreInterfaceImpl().CmdSetBlendConstants(*GetImpl(), color);
 }
@@ -257,7 +263,7 @@ NRI_INLINE void CommandBufferVal::SetBlendConstants(const Color32f& color) {
 NRI_INLINE void CommandBufferVal::SetShadingRate(const ShadingRateDesc& shadingRateDesc) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.tiers.shadingRate, ReturnVoid(), "'tiers.shadingRate > 0' required");
     NRI_RETURN_ON_FAILURE(&m_Device, shadingRateDesc.shadingRate < ShadingRate::MAX_NUM, ReturnVoid(), "'shadingRate' is invalid");
     NRI_RETURN_ON_FAILURE(&m_Device, shadingRateDesc.primitiveCombiner < ShadingRateCombiner::MAX_NUM, ReturnVoid(), "'primitiveCombiner' is invalid");
@@ -275,15 +281,68 @@ NRI_INLINE void CommandBufferVal::SetShadingRate(const ShadingRateDesc& shadingR
 NRI_INLINE void CommandBufferVal::SetDepthBias(const DepthBiasDesc& depthBiasDesc) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.features.dynamicDepthBias, ReturnVoid(), "'features.dynamicDepthBias' is false");
 
     GetCoreInterfaceImpl().CmdSetDepthBias(*GetImpl(), depthBiasDesc);
 }
 
+NRI_INLINE void CommandBufferVal::SetTopology(Topology topology, PrimitiveRestart primitiveRestart) {
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_RETURN_ON_FAILURE(&m_Device, m_Device.GetDesc().other.dynamicStates & DynamicStateBits::TOPOLOGY, ReturnVoid(), "'other.dynamicStates' doesn't have 'TOPOLOGY'");
+    NRI_RETURN_ON_FAILURE(&m_Device, topology < Topology::MAX_NUM, ReturnVoid(), "'topology' is invalid");
+    NRI_RETURN_ON_FAILURE(&m_Device, primitiveRestart < PrimitiveRestart::MAX_NUM, ReturnVoid(), "'primitiveRestart' is invalid");
+
+    GetCoreInterfaceImpl().CmdSetTopology(*GetImpl(), topology, primitiveRestart);
+}
+
+NRI_INLINE void CommandBufferVal::SetCullMode(CullMode cullMode) {
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_RETURN_ON_FAILURE(&m_Device, m_Device.GetDesc().other.dynamicStates & DynamicStateBits::CULL_MODE, ReturnVoid(), "'other.dynamicStates' doesn't have 'CULL_MODE'");
+    NRI_RETURN_ON_FAILURE(&m_Device, cullMode < CullMode::MAX_NUM, ReturnVoid(), "'cullMode' is invalid");
+
+    GetCoreInterfaceImpl().CmdSetCullMode(*GetImpl(), cullMode);
+}
+
+NRI_INLINE void CommandBufferVal::SetFrontFace(bool frontCounterClockwise) {
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_RETURN_ON_FAILURE(&m_Device, m_Device.GetDesc().other.dynamicStates & DynamicStateBits::FRONT_FACE, ReturnVoid(), "'other.dynamicStates' doesn't have 'FRONT_FACE'");
+
+    GetCoreInterfaceImpl().CmdSetFrontFace(*GetImpl(), frontCounterClockwise);
+}
+
+NRI_INLINE void CommandBufferVal::SetDepthState(const DepthAttachmentDesc& depth) {
+    const DeviceDesc& deviceDesc = m_Device.GetDesc();
+
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.other.dynamicStates & DynamicStateBits::DEPTH, ReturnVoid(), "'other.dynamicStates' doesn't have 'DEPTH'");
+    NRI_RETURN_ON_FAILURE(&m_Device, depth.compareOp < CompareOp::MAX_NUM, ReturnVoid(), "'depth.compareOp' is invalid");
+    NRI_RETURN_ON_FAILURE(&m_Device, !depth.boundsTest || deviceDesc.features.depthBoundsTest, ReturnVoid(), "'features.depthBoundsTest' is false");
+
+    GetCoreInterfaceImpl().CmdSetDepthState(*GetImpl(), depth);
+}
+
+NRI_INLINE void CommandBufferVal::SetStencilState(const StencilAttachmentDesc& stencil) {
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_RETURN_ON_FAILURE(&m_Device, m_Device.GetDesc().other.dynamicStates & DynamicStateBits::STENCIL, ReturnVoid(), "'other.dynamicStates' doesn't have 'STENCIL'");
+    NRI_RETURN_ON_FAILURE(&m_Device, stencil.front.compareOp < CompareOp::MAX_NUM, ReturnVoid(), "'stencil.front.compareOp' is invalid");
+    NRI_RETURN_ON_FAILURE(&m_Device, stencil.back.compareOp < CompareOp::MAX_NUM, ReturnVoid(), "'stencil.back.compareOp' is invalid");
+
+    GetCoreInterfaceImpl().CmdSetStencilState(*GetImpl(), stencil);
+}
+
+NRI_INLINE void CommandBufferVal::SetColorState(uint32_t baseAttachment, const ColorAttachmentDesc* colors, uint32_t colorNum) {
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_RETURN_ON_FAILURE(&m_Device, m_Device.GetDesc().other.dynamicStates & DynamicStateBits::COLOR, ReturnVoid(), "'other.dynamicStates' doesn't have 'COLOR'");
+    NRI_RETURN_ON_FAILURE(&m_Device, colorNum == 0 || colors != nullptr, ReturnVoid(), "'colors' is NULL");
+    NRI_RETURN_ON_FAILURE(&m_Device, baseAttachment + colorNum <= m_Device.GetDesc().shaderStage.fragment.attachmentMaxNum, ReturnVoid(), "'baseAttachment + colorNum' is out of bounds");
+
+    GetCoreInterfaceImpl().CmdSetColorState(*GetImpl(), baseAttachment, colors, colorNum);
+}
+
 NRI_INLINE void CommandBufferVal::ClearAttachments(const ClearAttachmentDesc* clearAttachmentDescs, uint32_t clearAttachmentDescNum, const Rect* rects, uint32_t rectNum) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
     for (uint32_t i = 0; i < clearAttachmentDescNum; i++) {
@@ -295,11 +354,11 @@ NRI_INLINE void CommandBufferVal::ClearAttachments(const ClearAttachmentDesc* cl
 
         if (clearAttachmentDesc.planes & PlaneBits::COLOR) {
             NRI_RETURN_ON_FAILURE(&m_Device, clearAttachmentDesc.colorAttachmentIndex < deviceDesc.shaderStage.fragment.attachmentMaxNum, ReturnVoid(), "'[%u].colorAttachmentIndex=%u' is out of bounds", i, clearAttachmentDesc.colorAttachmentIndex);
-            NRI_RETURN_ON_FAILURE(&m_Device, m_RenderTargets[clearAttachmentDesc.colorAttachmentIndex], ReturnVoid(), "'[%u].colorAttachmentIndex=%u' references a NULL COLOR attachment", i, clearAttachmentDesc.colorAttachmentIndex);
+            NRI_VALIDATE(RENDER_PASS, m_RenderTargets[clearAttachmentDesc.colorAttachmentIndex], ReturnVoid(), "'[%u].colorAttachmentIndex=%u' references a NULL COLOR attachment", i, clearAttachmentDesc.colorAttachmentIndex);
         }
 
         if (clearAttachmentDesc.planes & (PlaneBits::DEPTH | PlaneBits::STENCIL)) {
-            NRI_RETURN_ON_FAILURE(&m_Device, m_DepthStencil, ReturnVoid(), "DEPTH_STENCIL attachment is NULL", i);
+            NRI_VALIDATE(RENDER_PASS, m_DepthStencil, ReturnVoid(), "DEPTH_STENCIL attachment is NULL", i);
             NRI_RETURN_ON_FAILURE(&m_Device, clearAttachmentDesc.colorAttachmentIndex == 0, ReturnVoid(), "'[%u].planes' is not COLOR, but `colorAttachmentIndex != 0`", i);
         }
     }
@@ -308,14 +367,14 @@ NRI_INLINE void CommandBufferVal::ClearAttachments(const ClearAttachmentDesc* cl
 }
 
 NRI_INLINE void CommandBufferVal::ClearStorage(const ClearStorageDesc& clearStorageDesc) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, clearStorageDesc.descriptor, ReturnVoid(), "'storage' is NULL");
 
     const DescriptorVal& descriptorVal = *(DescriptorVal*)clearStorageDesc.descriptor;
     NRI_RETURN_ON_FAILURE(&m_Device, descriptorVal.IsShaderResourceStorage(), ReturnVoid(), "'.storage' is not a 'SHADER_RESOURCE_STORAGE' descriptor");
-    NRI_RETURN_ON_FAILURE(&m_Device, clearStorageDesc.setIndex < m_DescriptorSets.size(), ReturnVoid(), "'setIndex=%u' is out of bounds", clearStorageDesc.setIndex);
-    NRI_RETURN_ON_FAILURE(&m_Device, m_DescriptorSets[clearStorageDesc.setIndex], ReturnVoid(), "descriptor set %u is not bound", clearStorageDesc.setIndex);
+    NRI_VALIDATE(DESCRIPTOR_BOUNDS, clearStorageDesc.setIndex < m_DescriptorSets.size(), ReturnVoid(), "'setIndex=%u' is out of bounds", clearStorageDesc.setIndex);
+    NRI_VALIDATE(DESCRIPTOR_BOUNDS, m_DescriptorSets[clearStorageDesc.setIndex], ReturnVoid(), "descriptor set %u is not bound", clearStorageDesc.setIndex);
 
     auto clearStorageDescImpl = clearStorageDesc;
     clearStorageDescImpl.descriptor = NRI_GET_IMPL(Descriptor, clearStorageDesc.descriptor);
@@ -324,8 +383,8 @@ NRI_INLINE void CommandBufferVal::ClearStorage(const ClearStorageDesc& clearStor
 }
 
 NRI_INLINE void CommandBufferVal::BeginRendering(const RenderingDesc& renderingDesc) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "'CmdBeginRendering' has already been called");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "'CmdBeginRendering' has already been called");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
     if (renderingDesc.shadingRate) {
@@ -337,7 +396,8 @@ NRI_INLINE void CommandBufferVal::BeginRendering(const RenderingDesc& renderingD
     if (renderingDesc.viewMask)
         NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.other.viewMaxNum > 1, ReturnVoid(), "'viewMask' is non-zero, but 'DeviceDesc::other.viewMaxNum <= 1'");
 
-    ResetAttachments();
+    if (m_Validation & ValidationBits::RENDER_PASS)
+        ResetAttachments();
 
     NRI_RETURN_ON_FAILURE(&m_Device, renderingDesc.colorNum == 0 || renderingDesc.colors != nullptr, ReturnVoid(), "'colors' is NULL");
     NRI_RETURN_ON_FAILURE(&m_Device, renderingDesc.depth.loadOp < LoadOp::MAX_NUM, ReturnVoid(), "'depth.loadOp' is invalid");
@@ -369,7 +429,8 @@ NRI_INLINE void CommandBufferVal::BeginRendering(const RenderingDesc& renderingD
         colors[i].descriptor = NRI_GET_IMPL(Descriptor, renderingDesc.colors[i].descriptor);
         colors[i].resolveDst = NRI_GET_IMPL(Descriptor, renderingDesc.colors[i].resolveDst);
 
-        m_RenderTargets[i] = (DescriptorVal*)renderingDesc.colors[i].descriptor;
+        if (m_Validation & ValidationBits::RENDER_PASS)
+            m_RenderTargets[i] = (DescriptorVal*)renderingDesc.colors[i].descriptor;
     }
 
     auto attachmentsDescImpl = renderingDesc;
@@ -406,30 +467,33 @@ NRI_INLINE void CommandBufferVal::BeginRendering(const RenderingDesc& renderingD
             NRI_RETURN_ON_FAILURE(&m_Device, renderingDesc.stencil.resolveOp == ResolveOp::AVERAGE, ReturnVoid(), "'features.resolveOpMinMax' is false");
     }
 
-    Descriptor* depthStencil = renderingDesc.depth.descriptor ? renderingDesc.depth.descriptor : renderingDesc.stencil.descriptor;
-    m_DepthStencil = depthStencil ? (DescriptorVal*)depthStencil : nullptr;
-
-    m_RenderTargetNum = renderingDesc.colorNum;
     m_IsRenderPass = true;
 
-    ValidateReadonlyDepthStencil();
+    if (m_Validation & ValidationBits::RENDER_PASS) {
+        Descriptor* depthStencil = renderingDesc.depth.descriptor ? renderingDesc.depth.descriptor : renderingDesc.stencil.descriptor;
+        m_DepthStencil = depthStencil ? (DescriptorVal*)depthStencil : nullptr;
+        m_RenderTargetNum = renderingDesc.colorNum;
+
+        ValidateReadonlyDepthStencil();
+    }
 
     GetCoreInterfaceImpl().CmdBeginRendering(*GetImpl(), attachmentsDescImpl);
 }
 
 NRI_INLINE void CommandBufferVal::EndRendering() {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "'CmdBeginRendering' has not been called");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, m_IsRenderPass, ReturnVoid(), "'CmdBeginRendering' has not been called");
 
     m_IsRenderPass = false;
 
-    ResetAttachments();
+    if (m_Validation & ValidationBits::RENDER_PASS)
+        ResetAttachments();
 
     GetCoreInterfaceImpl().CmdEndRendering(*GetImpl());
 }
 
 NRI_INLINE void CommandBufferVal::SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
     Scratch<VertexBufferDesc> vertexBufferDescsImpl = NRI_ALLOCATE_SCRATCH(m_Device, VertexBufferDesc, vertexBufferNum);
     for (uint32_t i = 0; i < vertexBufferNum; i++) {
@@ -441,7 +505,7 @@ NRI_INLINE void CommandBufferVal::SetVertexBuffers(uint32_t baseSlot, const Vert
 }
 
 NRI_INLINE void CommandBufferVal::SetIndexBuffer(const Buffer& buffer, uint64_t offset, IndexType indexType) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, indexType < IndexType::MAX_NUM, ReturnVoid(), "'indexType' is invalid");
 
     Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
@@ -450,21 +514,24 @@ NRI_INLINE void CommandBufferVal::SetIndexBuffer(const Buffer& buffer, uint64_t
 }
 
 NRI_INLINE void CommandBufferVal::SetPipelineLayout(BindPoint bindPoint, const PipelineLayout& pipelineLayout) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, bindPoint < BindPoint::MAX_NUM, ReturnVoid(), "'bindPoint' is invalid");
     NRI_RETURN_ON_FAILURE(&m_Device, bindPoint != BindPoint::INHERIT, ReturnVoid(), "'INHERIT' is not allowed");
 
     PipelineLayout* pipelineLayoutImpl = NRI_GET_IMPL(PipelineLayout, &pipelineLayout);
 
     m_PipelineLayout = (PipelineLayoutVal*)&pipelineLayout;
-    ResetDescriptorSets();
-    m_DescriptorSets.resize(m_PipelineLayout->GetPipelineLayoutDesc().descriptorSetNum, nullptr);
+
+    if (m_Validation & ValidationBits::DESCRIPTOR_BOUNDS) {
+        ResetDescriptorSets();
+        m_DescriptorSets.resize(m_PipelineLayout->GetPipelineLayoutDesc().descriptorSetNum, nullptr);
+    }
 
     GetCoreInterfaceImpl().CmdSetPipelineLayout(*GetImpl(), bindPoint, *pipelineLayoutImpl);
 }
 
 NRI_INLINE void CommandBufferVal::SetPipeline(const Pipeline& pipeline) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
     Pipeline* pipelineImpl = NRI_GET_IMPL(Pipeline, &pipeline);
 
@@ -476,7 +543,7 @@ NRI_INLINE void CommandBufferVal::SetPipeline(const Pipeline& pipeline) {
 }
 
 NRI_INLINE void CommandBufferVal::SetDescriptorPool(const DescriptorPool& descriptorPool) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
     DescriptorPool* descriptorPoolImpl = NRI_GET_IMPL(DescriptorPool, &descriptorPool);
 
@@ -484,24 +551,25 @@ NRI_INLINE void CommandBufferVal::SetDescriptorPool(const DescriptorPool& descri
 }
 
 NRI_INLINE void CommandBufferVal::SetDescriptorSet(const SetDescriptorSetDesc& setDescriptorSetDesc) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, m_PipelineLayout, ReturnVoid(), "'SetPipelineLayout' has not been called");
     NRI_RETURN_ON_FAILURE(&m_Device, setDescriptorSetDesc.descriptorSet, ReturnVoid(), "'descriptorSet' is NULL");
     NRI_RETURN_ON_FAILURE(&m_Device, setDescriptorSetDesc.bindPoint < BindPoint::MAX_NUM, ReturnVoid(), "'bindPoint' is invalid");
-    NRI_RETURN_ON_FAILURE(&m_Device, setDescriptorSetDesc.setIndex < m_DescriptorSets.size(), ReturnVoid(), "'setIndex=%u' is out of bounds", setDescriptorSetDesc.setIndex);
+    NRI_VALIDATE(DESCRIPTOR_BOUNDS, setDescriptorSetDesc.setIndex < m_DescriptorSets.size(), ReturnVoid(), "'setIndex=%u' is out of bounds", setDescriptorSetDesc.setIndex);
 
     auto descriptorSetBindingDescImpl = setDescriptorSetDesc;
     descriptorSetBindingDescImpl.descriptorSet = NRI_GET_IMPL(DescriptorSet, setDescriptorSetDesc.descriptorSet);
 
     GetCoreInterfaceImpl().CmdSetDescriptorSet(*GetImpl(), descriptorSetBindingDescImpl);
 
-    m_DescriptorSets[setDescriptorSetDesc.setIndex] = (DescriptorSetVal*)setDescriptorSetDesc.descriptorSet;
+    if (m_Validation & ValidationBits::DESCRIPTOR_BOUNDS)
+        m_DescriptorSets[setDescriptorSetDesc.setIndex] = (DescriptorSetVal*)setDescriptorSetDesc.descriptorSet;
 }
 
 NRI_INLINE void CommandBufferVal::SetRootConstants(const SetRootConstantsDesc& setRootConstantsDesc) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, m_PipelineLayout, ReturnVoid(), "'SetPipelineLayout' has not been called");
     NRI_RETURN_ON_FAILURE(&m_Device, setRootConstantsDesc.offset == 0 || deviceDesc.features.rootConstantsOffset, ReturnVoid(), "Non-zero 'setRootConstantsDesc.offset' is not supported");
     NRI_RETURN_ON_FAILURE(&m_Device, setRootConstantsDesc.bindPoint < BindPoint::MAX_NUM, ReturnVoid(), "'bindPoint' is invalid");
@@ -510,7 +578,7 @@ NRI_INLINE void CommandBufferVal::SetRootConstants(const SetRootConstantsDesc& s
 }
 
 NRI_INLINE void CommandBufferVal::SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, m_PipelineLayout, ReturnVoid(), "'SetPipelineLayout' has not been called");
     NRI_RETURN_ON_FAILURE(&m_Device, setRootDescriptorDesc.descriptor, ReturnVoid(), "'descriptor' is NULL");
     NRI_RETURN_ON_FAILURE(&m_Device, setRootDescriptorDesc.bindPoint < BindPoint::MAX_NUM, ReturnVoid(), "'bindPoint' is invalid");
@@ -530,24 +598,44 @@ NRI_INLINE void CommandBufferVal::SetRootDescriptor(const SetRootDescriptorDesc&
 }
 
 NRI_INLINE void CommandBufferVal::Draw(const DrawDesc& drawDesc) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
 
     GetCoreInterfaceImpl().CmdDraw(*GetImpl(), drawDesc);
 }
 
 NRI_INLINE void CommandBufferVal::DrawIndexed(const DrawIndexedDesc& drawIndexedDesc) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
 
     GetCoreInterfaceImpl().CmdDrawIndexed(*GetImpl(), drawIndexedDesc);
 }
 
+NRI_INLINE void CommandBufferVal::DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_RETURN_ON_FAILURE(&m_Device, drawDescs || !drawNum, ReturnVoid(), "'drawDescs' is NULL");
+    NRI_RETURN_ON_FAILURE(&m_Device, stride >= sizeof(DrawDesc), ReturnVoid(), "'stride' is too small, expected >= %u", (uint32_t)sizeof(DrawDesc));
+    NRI_RETURN_ON_FAILURE(&m_Device, (stride % 4) == 0, ReturnVoid(), "'stride' must be 4-byte aligned");
+
+    GetCoreInterfaceImpl().CmdDrawMulti(*GetImpl(), drawDescs, drawNum, stride);
+}
+
+NRI_INLINE void CommandBufferVal::DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_RETURN_ON_FAILURE(&m_Device, drawIndexedDescs || !drawNum, ReturnVoid(), "'drawIndexedDescs' is NULL");
+    NRI_RETURN_ON_FAILURE(&m_Device, stride >= sizeof(DrawIndexedDesc), ReturnVoid(), "'stride' is too small, expected >= %u", (uint32_t)sizeof(DrawIndexedDesc));
+    NRI_RETURN_ON_FAILURE(&m_Device, (stride % 4) == 0, ReturnVoid(), "'stride' must be 4-byte aligned");
+
+    GetCoreInterfaceImpl().CmdDrawIndexedMulti(*GetImpl(), drawIndexedDescs, drawNum, stride);
+}
+
 NRI_INLINE void CommandBufferVal::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, m_PipelineLayout, ReturnVoid(), "'SetPipelineLayout' has not been called");
     NRI_RETURN_ON_FAILURE(&m_Device, !countBuffer || deviceDesc.features.drawIndirectCount, ReturnVoid(), "'countBuffer' is not supported");
 
@@ -566,8 +654,8 @@ NRI_INLINE void CommandBufferVal::DrawIndirect(const Buffer& buffer, uint64_t of
 NRI_INLINE void CommandBufferVal::DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, m_PipelineLayout, ReturnVoid(), "'SetPipelineLayout' has not been called");
     NRI_RETURN_ON_FAILURE(&m_Device, !countBuffer || deviceDesc.features.drawIndirectCount, ReturnVoid(), "'countBuffer' is not supported");
 
@@ -587,8 +675,8 @@ NRI_INLINE void CommandBufferVal::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffs
     const BufferDesc& dstDesc = ((BufferVal&)dstBuffer).GetDesc();
     const BufferDesc& srcDesc = ((BufferVal&)srcBuffer).GetDesc();
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
     if (size == WHOLE_SIZE) {
         NRI_RETURN_ON_FAILURE(&m_Device, dstOffset == 0, ReturnVoid(), "'WHOLE_SIZE' is used but 'dstOffset' is not 0");
         NRI_RETURN_ON_FAILURE(&m_Device, srcOffset == 0, ReturnVoid(), "'WHOLE_SIZE' is used but 'srcOffset' is not 0");
@@ -605,8 +693,8 @@ NRI_INLINE void CommandBufferVal::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffs
 }
 
 NRI_INLINE void CommandBufferVal::CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
     Texture* dstTextureImpl = NRI_GET_IMPL(Texture, &dstTexture);
     Texture* srcTextureImpl = NRI_GET_IMPL(Texture, &srcTexture);
@@ -615,8 +703,8 @@ NRI_INLINE void CommandBufferVal::CopyTexture(Texture& dstTexture, const Texture
 }
 
 NRI_INLINE void CommandBufferVal::ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion, ResolveOp resolveOp) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, resolveOp < ResolveOp::MAX_NUM, ReturnVoid(), "'resolveOp' is invalid");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
@@ -637,8 +725,8 @@ NRI_INLINE void CommandBufferVal::ResolveTexture(Texture& dstTexture, const Text
 }
 
 NRI_INLINE void CommandBufferVal::UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
     Texture* dstTextureImpl = NRI_GET_IMPL(Texture, &dstTexture);
     Buffer* srcBufferImpl = NRI_GET_IMPL(Buffer, &srcBuffer);
@@ -647,8 +735,8 @@ NRI_INLINE void CommandBufferVal::UploadBufferToTexture(Texture& dstTexture, con
 }
 
 NRI_INLINE void CommandBufferVal::ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
     Buffer* dstBufferImpl = NRI_GET_IMPL(Buffer, &dstBuffer);
     Texture* srcTextureImpl = NRI_GET_IMPL(Texture, &srcTexture);
@@ -657,8 +745,8 @@ NRI_INLINE void CommandBufferVal::ReadbackTextureToBuffer(Buffer& dstBuffer, con
 }
 
 NRI_INLINE void CommandBufferVal::ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
     if (size == WHOLE_SIZE) {
         NRI_RETURN_ON_FAILURE(&m_Device, offset == 0, ReturnVoid(), "'WHOLE_SIZE' is used but 'offset' is not 0");
@@ -673,8 +761,8 @@ NRI_INLINE void CommandBufferVal::ZeroBuffer(Buffer& buffer, uint64_t offset, ui
 }
 
 NRI_INLINE void CommandBufferVal::Dispatch(const DispatchDesc& dispatchDesc) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
     GetCoreInterfaceImpl().CmdDispatch(*GetImpl(), dispatchDesc);
 }
@@ -682,8 +770,8 @@ NRI_INLINE void CommandBufferVal::Dispatch(const DispatchDesc& dispatchDesc) {
 NRI_INLINE void CommandBufferVal::DispatchIndirect(const Buffer& buffer, uint64_t offset) {
     const BufferDesc& bufferDesc = ((BufferVal&)buffer).GetDesc();
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, offset < bufferDesc.size, ReturnVoid(), "offset is greater than the buffer size");
 
     Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
@@ -691,16 +779,18 @@ NRI_INLINE void CommandBufferVal::DispatchIndirect(const Buffer& buffer, uint64_
 }
 
 NRI_INLINE void CommandBufferVal::Barrier(const BarrierDesc& barrierDesc) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
-    for (uint32_t i = 0; i < barrierDesc.bufferNum; i++) {
-        if (!ValidateBufferBarrierDesc(m_Device, i, barrierDesc.buffers[i]))
-            return;
-    }
+    if (m_Validation & ValidationBits::BARRIERS) {
+        for (uint32_t i = 0; i < barrierDesc.bufferNum; i++) {
+            if (!ValidateBufferBarrierDesc(m_Device, i, barrierDesc.buffers[i]))
+                return;
+        }
 
-    for (uint32_t i = 0; i < barrierDesc.textureNum; i++) {
-        if (!ValidateTextureBarrierDesc(m_Device, i, barrierDesc.textures[i]))
-            return;
+        for (uint32_t i = 0; i < barrierDesc.textureNum; i++) {
+            if (!ValidateTextureBarrierDesc(m_Device, i, barrierDesc.textures[i]))
+                return;
+        }
     }
 
     Scratch<BufferBarrierDesc> buffers = NRI_ALLOCATE_SCRATCH(m_Device, BufferBarrierDesc, barrierDesc.bufferNum);
@@ -730,7 +820,7 @@ NRI_INLINE void CommandBufferVal::Barrier(const BarrierDesc& barrierDesc) {
 NRI_INLINE void CommandBufferVal::BeginQuery(QueryPool& queryPool, uint32_t offset) {
     QueryPoolVal& queryPoolVal = (QueryPoolVal&)queryPool;
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, queryPoolVal.GetQueryType() != QueryType::TIMESTAMP, ReturnVoid(), "'BeginQuery' is not supported for timestamp queries");
 
     if (!queryPoolVal.IsImported())
@@ -743,7 +833,7 @@ NRI_INLINE void CommandBufferVal::BeginQuery(QueryPool& queryPool, uint32_t offs
 NRI_INLINE void CommandBufferVal::EndQuery(QueryPool& queryPool, uint32_t offset) {
     QueryPoolVal& queryPoolVal = (QueryPoolVal&)queryPool;
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
     if (!queryPoolVal.IsImported())
         NRI_RETURN_ON_FAILURE(&m_Device, offset < queryPoolVal.GetQueryNum(), ReturnVoid(), "'offset=%u' is out of range", offset);
@@ -753,8 +843,8 @@ NRI_INLINE void CommandBufferVal::EndQuery(QueryPool& queryPool, uint32_t offset
 }
 
 NRI_INLINE void CommandBufferVal::CopyQueries(const QueryPool& queryPool, uint32_t offset, uint32_t num, Buffer& dstBuffer, uint64_t dstOffset) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
     const QueryPoolVal& queryPoolVal = (QueryPoolVal&)queryPool;
     if (!queryPoolVal.IsImported())
@@ -767,8 +857,8 @@ NRI_INLINE void CommandBufferVal::CopyQueries(const QueryPool& queryPool, uint32
 }
 
 NRI_INLINE void CommandBufferVal::ResetQueries(QueryPool& queryPool, uint32_t offset, uint32_t num) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
     QueryPoolVal& queryPoolVal = (QueryPoolVal&)queryPool;
     if (!queryPoolVal.IsImported())
@@ -779,28 +869,28 @@ NRI_INLINE void CommandBufferVal::ResetQueries(QueryPool& queryPool, uint32_t of
 }
 
 NRI_INLINE void CommandBufferVal::BeginAnnotation(const char* name, uint32_t bgra) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
     m_AnnotationStack++;
     GetCoreInterfaceImpl().CmdBeginAnnotation(*GetImpl(), name, bgra);
 }
 
 NRI_INLINE void CommandBufferVal::EndAnnotation() {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
     GetCoreInterfaceImpl().CmdEndAnnotation(*GetImpl());
     m_AnnotationStack--;
 }
 
 NRI_INLINE void CommandBufferVal::Annotation(const char* name, uint32_t bgra) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
     GetCoreInterfaceImpl().CmdAnnotation(*GetImpl(), name, bgra);
 }
 
 NRI_INLINE void CommandBufferVal::BuildTopLevelAccelerationStructure(const BuildTopLevelAccelerationStructureDesc* buildTopLevelAccelerationStructureDescs, uint32_t buildTopLevelAccelerationStructureDescNum) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
     Scratch<BuildTopLevelAccelerationStructureDesc> buildTopLevelAccelerationStructureDescsImpl = NRI_ALLOCATE_SCRATCH(m_Device, BuildTopLevelAccelerationStructureDesc, buildTopLevelAccelerationStructureDescNum);
 
@@ -827,8 +917,8 @@ NRI_INLINE void CommandBufferVal::BuildTopLevelAccelerationStructure(const Build
 }
 
 NRI_INLINE void CommandBufferVal::BuildBottomLevelAccelerationStructure(const BuildBottomLevelAccelerationStructureDesc* buildBottomLevelAccelerationStructureDescs, uint32_t buildBottomLevelAccelerationStructureDescNum) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
     uint32_t geometryTotalNum = 0;
     uint32_t micromapTotalNum = 0;
@@ -885,8 +975,8 @@ NRI_INLINE void CommandBufferVal::BuildBottomLevelAccelerationStructure(const Bu
 }
 
 NRI_INLINE void CommandBufferVal::BuildMicromaps(const BuildMicromapDesc* buildMicromapDescs, uint32_t buildMicromapDescNum) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
     Scratch<BuildMicromapDesc> buildMicromapDescsImpl = NRI_ALLOCATE_SCRATCH(m_Device, BuildMicromapDesc, buildMicromapDescNum);
 
@@ -916,8 +1006,8 @@ NRI_INLINE void CommandBufferVal::BuildMicromaps(const BuildMicromapDesc* buildM
 }
 
 NRI_INLINE void CommandBufferVal::CopyMicromap(Micromap& dst, const Micromap& src, CopyMode copyMode) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, copyMode < CopyMode::MAX_NUM, ReturnVoid(), "'copyMode' is invalid");
 
     Micromap& dstImpl = *NRI_GET_IMPL(Micromap, &dst);
@@ -927,8 +1017,8 @@ NRI_INLINE void CommandBufferVal::CopyMicromap(Micromap& dst, const Micromap& sr
 }
 
 NRI_INLINE void CommandBufferVal::CopyAccelerationStructure(AccelerationStructure& dst, const AccelerationStructure& src, CopyMode copyMode) {
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, copyMode < CopyMode::MAX_NUM, ReturnVoid(), "'copyMode' is invalid");
 
     AccelerationStructure& dstImpl = *NRI_GET_IMPL(AccelerationStructure, &dst);
@@ -941,8 +1031,8 @@ NRI_INLINE void CommandBufferVal::WriteMicromapsSizes(const Micromap* const* mic
     const QueryPoolVal& queryPoolVal = (QueryPoolVal&)queryPool;
     bool isTypeValid = queryPoolVal.GetQueryType() == QueryType::MICROMAP_COMPACTED_SIZE;
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, isTypeValid, ReturnVoid(), "'queryPool' query type must be 'MICROMAP_COMPACTED_SIZE'");
 
     Scratch<Micromap*> micromapsImpl = NRI_ALLOCATE_SCRATCH(m_Device, Micromap*, micromapNum);
@@ -961,8 +1051,8 @@ NRI_INLINE void CommandBufferVal::WriteAccelerationStructuresSizes(const Acceler
     const QueryPoolVal& queryPoolVal = (QueryPoolVal&)queryPool;
     bool isTypeValid = queryPoolVal.GetQueryType() == QueryType::ACCELERATION_STRUCTURE_SIZE || queryPoolVal.GetQueryType() == QueryType::ACCELERATION_STRUCTURE_COMPACTED_SIZE;
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, isTypeValid, ReturnVoid(), "'queryPool' query type must be 'ACCELERATION_STRUCTURE_SIZE' or 'ACCELERATION_STRUCTURE_COMPACTED_SIZE'");
 
     Scratch<AccelerationStructure*> accelerationStructuresImpl = NRI_ALLOCATE_SCRATCH(m_Device, AccelerationStructure*, accelerationStructureNum);
@@ -981,8 +1071,8 @@ NRI_INLINE void CommandBufferVal::DispatchRays(const DispatchRaysDesc& dispatchR
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
     uint64_t align = deviceDesc.memoryAlignment.shaderBindingTable;
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, dispatchRaysDesc.raygenShader.buffer, ReturnVoid(), "'raygenShader.buffer' is NULL");
     NRI_RETURN_ON_FAILURE(&m_Device, dispatchRaysDesc.raygenShader.size != 0, ReturnVoid(), "'raygenShader.size' is 0");
     NRI_RETURN_ON_FAILURE(&m_Device, dispatchRaysDesc.raygenShader.offset % align == 0, ReturnVoid(), "'raygenShader.offset' is misaligned");
@@ -1003,8 +1093,8 @@ NRI_INLINE void CommandBufferVal::DispatchRaysIndirect(const Buffer& buffer, uin
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
     const BufferDesc& bufferDesc = ((BufferVal&)buffer).GetDesc();
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, offset < bufferDesc.size, ReturnVoid(), "offset is greater than the buffer size");
     NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.tiers.rayTracing >= 2, ReturnVoid(), "'tiers.rayTracing' must be >= 2");
 
@@ -1016,8 +1106,8 @@ NRI_INLINE void CommandBufferVal::DispatchRaysIndirect(const Buffer& buffer, uin
 NRI_INLINE void CommandBufferVal::DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.features.meshShader, ReturnVoid(), "'features.meshShader' is false");
 
     GetMeshShaderInterfaceImpl().CmdDrawMeshTasks(*GetImpl(), drawMeshTasksDesc);
@@ -1027,8 +1117,8 @@ NRI_INLINE void CommandBufferVal::DrawMeshTasksIndirect(const Buffer& buffer, ui
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
     const BufferDesc& bufferDesc = ((BufferVal&)buffer).GetDesc();
 
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
-    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.features.meshShader, ReturnVoid(), "'features.meshShader' is false");
     NRI_RETURN_ON_FAILURE(&m_Device, !countBuffer || deviceDesc.features.drawIndirectCount, ReturnVoid(), "'countBuffer' is not supported");
     NRI_RETURN_ON_FAILURE(&m_Device, offset < bufferDesc.size, ReturnVoid(), "'offset' is greater than the buffer size");
@@ -1039,6 +1129,19 @@ NRI_INLINE void CommandBufferVal::DrawMeshTasksIndirect(const Buffer& buffer, ui
     GetMeshShaderInterfaceImpl().CmdDrawMeshTasksIndirect(*GetImpl(), *bufferImpl, offset, drawNum, stride, countBufferImpl, countBufferOffset);
 }
 
+NRI_INLINE void CommandBufferVal::ExecuteCommandsVK(const VKHandle* vkCommandBuffers, uint32_t vkCommandBufferNum) {
+    NRI_VALIDATE(LIFETIME, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_VALIDATE(RENDER_PASS, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    NRI_RETURN_ON_FAILURE(&m_Device, vkCommandBuffers || !vkCommandBufferNum, ReturnVoid(), "'vkCommandBuffers' is NULL");
+
+    GetWrapperVKInterfaceImpl().CmdExecuteCommandsVK(*GetImpl(), vkCommandBuffers, vkCommandBufferNum);
+
+    // The bound state is undefined afterwards
+    m_PipelineLayout = nullptr;
+    m_Pipeline = nullptr;
+    ResetDescriptorSets();
+}
+
 NRI_INLINE void CommandBufferVal::ValidateReadonlyDepthStencil() {
     if (m_Pipeline && m_DepthStencil) {
         if (m_DepthStencil->IsDepthReadonly() && m_Pipeline->WritesToDepth())
@@ -1048,3 +1151,5 @@ NRI_INLINE void CommandBufferVal::ValidateReadonlyDepthStencil() {
             NRI_REPORT_WARNING(&m_Device, "Stencil is read-only, but the pipeline writes to stencil. Writing happens only in VK!");
     }
 }
+
+#undef NRI_VALIDATE
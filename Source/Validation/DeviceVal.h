@@ -14,6 +14,79 @@ struct IsExtSupported {
     uint32_t wrapperVK    : 1;
 };
 
+// Thread-safe pool of "T"-sized slots, carved out of slabs of "NRI_VAL_SLAB_OBJECT_NUM" objects. Freed slots are reused in LIFO order,
+// slabs are returned to "AllocationCallbacks" only on device destruction. "T" can be incomplete until "Allocate" is used
+template <typename T>
+struct SlabPool {
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    struct Slab {
+        Slab* next;
+    };
+
+    static inline size_t GetSlotSize() {
+        return Align(sizeof(T) > sizeof(FreeSlot) ? sizeof(T) : sizeof(FreeSlot), alignof(T));
+    }
+
+    static inline size_t GetHeaderSize() {
+        return Align(sizeof(Slab), alignof(T));
+    }
+
+    inline void* Allocate(const AllocationCallbacks& allocationCallbacks) {
+        ExclusiveScope lock(m_Lock);
+
+        if (!m_FreeSlots) {
+            constexpr size_t alignment = alignof(T) > alignof(Slab) ? alignof(T) : alignof(Slab);
+
+            uint8_t* memory = (uint8_t*)allocationCallbacks.Allocate(allocationCallbacks.userArg, GetHeaderSize() + GetSlotSize() * NRI_VAL_SLAB_OBJECT_NUM, alignment);
+            if (!memory)
+                return nullptr;
+
+            Slab* slab = (Slab*)memory;
+            slab->next = m_Slabs;
+            m_Slabs = slab;
+
+            uint8_t* slots = memory + GetHeaderSize();
+            for (uint32_t i = NRI_VAL_SLAB_OBJECT_NUM; i > 0; i--) {
+                FreeSlot* slot = (FreeSlot*)(slots + (i - 1) * GetSlotSize());
+                slot->next = m_FreeSlots;
+                m_FreeSlots = slot;
+            }
+        }
+
+        FreeSlot* slot = m_FreeSlots;
+        m_FreeSlots = slot->next;
+
+        return slot;
+    }
+
+    inline void Free(void* memory) {
+        ExclusiveScope lock(m_Lock);
+
+        FreeSlot* slot = (FreeSlot*)memory;
+        slot->next = m_FreeSlots;
+        m_FreeSlots = slot;
+    }
+
+    inline void Release(const AllocationCallbacks& allocationCallbacks) {
+        while (m_Slabs) {
+            Slab* slab = m_Slabs;
+            m_Slabs = slab->next;
+
+            allocationCallbacks.Free(allocationCallbacks.userArg, slab);
+        }
+
+        m_FreeSlots = nullptr;
+    }
+
+private:
+    Lock m_Lock;
+    FreeSlot* m_FreeSlots = nullptr; // guarded by "m_Lock"
+    Slab* m_Slabs = nullptr;         // guarded by "m_Lock"
+};
+
 struct DeviceVal final : public DeviceBase {
     DeviceVal(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks, DeviceBase& device);
     ~DeviceVal();
@@ -70,7 +143,37 @@ struct DeviceVal final : public DeviceBase {
         return m_Lock;
     }
 
-    bool Create();
+    inline bool IsValidationEnabled(ValidationBits category) const {
+        return (m_ValidationBits & category) != 0;
+    }
+
+    // Sampled out recordings skip all optional categories
+    inline ValidationBits GetCommandBufferValidation() {
+        if (m_CommandBufferSampling > 1 && m_CommandBufferCounter.fetch_add(1, std::memory_order_relaxed) % m_CommandBufferSampling != 0)
+            return ValidationBits::NONE;
+
+        return m_ValidationBits;
+    }
+
+    // Frequently created wrappers live in per-type slab pools
+    template <typename T, typename... Args>
+    inline T* AllocateObject(Args&&... args) {
+        T* object = (T*)std::get<SlabPool<T>>(m_Pools).Allocate(GetAllocationCallbacks());
+        if (object)
+            new (object) T(std::forward<Args>(args)...);
+
+        return object;
+    }
+
+    template <typename T>
+    inline void DestroyObject(T* object) {
+        if (object) {
+            object->~T();
+            std::get<SlabPool<T>>(m_Pools).Free(object);
+        }
+    }
+
+    bool Create(const DeviceCreationDesc& desc);
     void RegisterMemoryType(MemoryType memoryType, MemoryLocation memoryLocation);
 
     //================================================================================================================
@@ -217,7 +320,21 @@ private:
         IsExtSupported m_IsExtSupported;
     };
 
+    std::tuple<
+        SlabPool<AccelerationStructureVal>,
+        SlabPool<BufferVal>,
+        SlabPool<CommandBufferVal>,
+        SlabPool<DescriptorVal>,
+        SlabPool<FenceVal>,
+        SlabPool<MemoryVal>,
+        SlabPool<MicromapVal>,
+        SlabPool<TextureVal>>
+        m_Pools;
+
     Lock m_Lock;
+    std::atomic_uint32_t m_CommandBufferCounter = 0;
+    uint32_t m_CommandBufferSampling = 1;
+    ValidationBits m_ValidationBits = ValidationBits::NONE;
 };
 
 } // namespace nri
@@ -117,6 +117,8 @@ DeviceVal::~DeviceVal() {
     for (size_t i = 0; i < m_Queues.size(); i++)
         Destroy(m_Queues[i]);
 
+    std::apply([this](auto&... pools) { (pools.Release(GetAllocationCallbacks()), ...); }, m_Pools);
+
     if (m_Name) {
         const auto& allocationCallbacks = GetAllocationCallbacks();
         allocationCallbacks.Free(allocationCallbacks.userArg, m_Name);
@@ -125,7 +127,7 @@ DeviceVal::~DeviceVal() {
     ((DeviceBase*)&m_Impl)->Destruct();
 }
 
-bool DeviceVal::Create() {
+bool DeviceVal::Create(const DeviceCreationDesc& desc) {
     const DeviceBase& deviceBaseImpl = (DeviceBase&)m_Impl;
 
     Result result = deviceBaseImpl.FillFunctionTable(m_iCoreImpl);
@@ -144,6 +146,10 @@ bool DeviceVal::Create() {
 
     m_Desc = GetDesc();
 
+    constexpr ValidationBits allCategories = ValidationBits::LIFETIME | ValidationBits::BARRIERS | ValidationBits::DESCRIPTOR_BOUNDS | ValidationBits::RENDER_PASS;
+    m_ValidationBits = (ValidationBits)(allCategories & ~desc.validationLevel.disabledCategories);
+    m_CommandBufferSampling = desc.validationLevel.commandBufferSampling;
+
     return FillFunctionTable(m_iCore) == Result::SUCCESS;
 }
 
@@ -241,7 +247,7 @@ NRI_INLINE Result DeviceVal::CreateBuffer(const BufferDesc& bufferDesc, Buffer*&
 
     buffer = nullptr;
     if (result == Result::SUCCESS)
-        buffer = (Buffer*)Allocate<BufferVal>(GetAllocationCallbacks(), *this, bufferImpl, false);
+        buffer = (Buffer*)AllocateObject<BufferVal>(*this, bufferImpl, false);
 
     return result;
 }
@@ -267,7 +273,7 @@ NRI_INLINE Result DeviceVal::CreateTexture(const TextureDesc& textureDesc, Textu
 
     texture = nullptr;
     if (result == Result::SUCCESS)
-        texture = (Texture*)Allocate<TextureVal>(GetAllocationCallbacks(), *this, textureImpl, false);
+        texture = (Texture*)AllocateObject<TextureVal>(*this, textureImpl, false);
 
     return result;
 }
@@ -300,7 +306,7 @@ NRI_INLINE Result DeviceVal::CreateDescriptor(const BufferViewDesc& bufferViewDe
 
     bufferView = nullptr;
     if (result == Result::SUCCESS)
-        bufferView = (Descriptor*)Allocate<DescriptorVal>(GetAllocationCallbacks(), *this, descriptorImpl, bufferViewDesc);
+        bufferView = (Descriptor*)AllocateObject<DescriptorVal>(*this, descriptorImpl, bufferViewDesc);
 
     return result;
 }
@@ -346,7 +352,7 @@ NRI_INLINE Result DeviceVal::CreateDescriptor(const TextureViewDesc& textureView
 
     textureView = nullptr;
     if (result == Result::SUCCESS)
-        textureView = (Descriptor*)Allocate<DescriptorVal>(GetAllocationCallbacks(), *this, descriptorImpl, textureViewDesc);
+        textureView = (Descriptor*)AllocateObject<DescriptorVal>(*this, descriptorImpl, textureViewDesc);
 
     return result;
 }
@@ -372,7 +378,7 @@ NRI_INLINE Result DeviceVal::CreateDescriptor(const SamplerDesc& samplerDesc, De
 
     sampler = nullptr;
     if (result == Result::SUCCESS)
-        sampler = (Descriptor*)Allocate<DescriptorVal>(GetAllocationCallbacks(), *this, samplerImpl, DescriptorType::SAMPLER);
+        sampler = (Descriptor*)AllocateObject<DescriptorVal>(*this, samplerImpl, DescriptorType::SAMPLER);
 
     return result;
 }
@@ -489,6 +495,7 @@ NRI_INLINE Result DeviceVal::CreatePipeline(const GraphicsPipelineDesc& graphics
     NRI_RETURN_ON_FAILURE(this, graphicsPipelineDesc.outputMerger.logicOp < LogicOp::MAX_NUM, Result::INVALID_ARGUMENT, "'outputMerger.logicOp' is invalid");
     NRI_RETURN_ON_FAILURE(this, graphicsPipelineDesc.outputMerger.multiview < Multiview::MAX_NUM, Result::INVALID_ARGUMENT, "'outputMerger.multiview' is invalid");
     NRI_RETURN_ON_FAILURE(this, graphicsPipelineDesc.robustness < Robustness::MAX_NUM, Result::INVALID_ARGUMENT, "'robustness' is invalid");
+    NRI_RETURN_ON_FAILURE(this, (graphicsPipelineDesc.dynamicStates & ~GetDesc().other.dynamicStates) == 0, Result::UNSUPPORTED, "'dynamicStates' is not a subset of 'other.dynamicStates'");
     NRI_RETURN_ON_FAILURE(this, graphicsPipelineDesc.outputMerger.colorNum == 0 || graphicsPipelineDesc.outputMerger.colors != nullptr, Result::INVALID_ARGUMENT, "'outputMerger.colors' is NULL");
 
     if (graphicsPipelineDesc.vertexInput) {
@@ -664,14 +671,14 @@ NRI_INLINE Result DeviceVal::CreateFence(uint64_t initialValue, Fence*& fence) {
 
     fence = nullptr;
     if (result == Result::SUCCESS)
-        fence = (Fence*)Allocate<FenceVal>(GetAllocationCallbacks(), *this, fenceImpl);
+        fence = (Fence*)AllocateObject<FenceVal>(*this, fenceImpl);
 
     return result;
 }
 
 NRI_INLINE void DeviceVal::DestroyCommandBuffer(CommandBuffer* commandBuffer) {
     m_iCoreImpl.DestroyCommandBuffer(NRI_GET_IMPL(CommandBuffer, commandBuffer));
-    Destroy((CommandBufferVal*)commandBuffer);
+    DestroyObject((CommandBufferVal*)commandBuffer);
 }
 
 NRI_INLINE void DeviceVal::DestroyCommandAllocator(CommandAllocator* commandAllocator) {
@@ -686,17 +693,17 @@ NRI_INLINE void DeviceVal::DestroyDescriptorPool(DescriptorPool* descriptorPool)
 
 NRI_INLINE void DeviceVal::DestroyBuffer(Buffer* buffer) {
     m_iCoreImpl.DestroyBuffer(NRI_GET_IMPL(Buffer, buffer));
-    Destroy((BufferVal*)buffer);
+    DestroyObject((BufferVal*)buffer);
 }
 
 NRI_INLINE void DeviceVal::DestroyTexture(Texture* texture) {
     m_iCoreImpl.DestroyTexture(NRI_GET_IMPL(Texture, texture));
-    Destroy((TextureVal*)texture);
+    DestroyObject((TextureVal*)texture);
 }
 
 NRI_INLINE void DeviceVal::DestroyDescriptor(Descriptor* descriptor) {
     m_iCoreImpl.DestroyDescriptor(NRI_GET_IMPL(Descriptor, descriptor));
-    Destroy((DescriptorVal*)descriptor);
+    DestroyObject((DescriptorVal*)descriptor);
 }
 
 NRI_INLINE void DeviceVal::DestroyPipelineLayout(PipelineLayout* pipelineLayout) {
@@ -716,7 +723,7 @@ NRI_INLINE void DeviceVal::DestroyQueryPool(QueryPool* queryPool) {
 
 NRI_INLINE void DeviceVal::DestroyFence(Fence* fence) {
     m_iCoreImpl.DestroyFence(NRI_GET_IMPL(Fence, fence));
-    Destroy((FenceVal*)fence);
+    DestroyObject((FenceVal*)fence);
 }
 
 NRI_INLINE Result DeviceVal::CreateCommittedBuffer(MemoryLocation memoryLocation, float priority, const BufferDesc& bufferDesc, Buffer*& buffer) {
@@ -728,7 +735,7 @@ NRI_INLINE Result DeviceVal::CreateCommittedBuffer(MemoryLocation memoryLocation
 
     buffer = nullptr;
     if (result == Result::SUCCESS)
-        buffer = (Buffer*)Allocate<BufferVal>(GetAllocationCallbacks(), *this, bufferImpl, true);
+        buffer = (Buffer*)AllocateObject<BufferVal>(*this, bufferImpl, true);
 
     return result;
 }
@@ -755,7 +762,7 @@ NRI_INLINE Result DeviceVal::CreateCommittedTexture(MemoryLocation memoryLocatio
 
     texture = nullptr;
     if (result == Result::SUCCESS)
-        texture = (Texture*)Allocate<TextureVal>(GetAllocationCallbacks(), *this, textureImpl, true);
+        texture = (Texture*)AllocateObject<TextureVal>(*this, textureImpl, true);
 
     return result;
 }
@@ -773,7 +780,7 @@ NRI_INLINE Result DeviceVal::CreateCommittedMicromap(MemoryLocation memoryLocati
 
     micromap = nullptr;
     if (result == Result::SUCCESS)
-        micromap = (Micromap*)Allocate<MicromapVal>(GetAllocationCallbacks(), *this, micromapImpl, true);
+        micromap = (Micromap*)AllocateObject<MicromapVal>(*this, micromapImpl, true);
 
     return result;
 }
@@ -825,7 +832,7 @@ NRI_INLINE Result DeviceVal::CreateCommittedAccelerationStructure(MemoryLocation
 
     accelerationStructure = nullptr;
     if (result == Result::SUCCESS)
-        accelerationStructure = (AccelerationStructure*)Allocate<AccelerationStructureVal>(GetAllocationCallbacks(), *this, accelerationStructureImpl, true);
+        accelerationStructure = (AccelerationStructure*)AllocateObject<AccelerationStructureVal>(*this, accelerationStructureImpl, true);
 
     return result;
 }
@@ -858,7 +865,7 @@ NRI_INLINE Result DeviceVal::CreatePlacedBuffer(Memory* memory, uint64_t offset,
 
     buffer = nullptr;
     if (result == Result::SUCCESS)
-        buffer = (Buffer*)Allocate<BufferVal>(GetAllocationCallbacks(), *this, bufferImpl, !memory);
+        buffer = (Buffer*)AllocateObject<BufferVal>(*this, bufferImpl, !memory);
 
     // Update
     if (buffer && memory) {
@@ -910,7 +917,7 @@ NRI_INLINE Result DeviceVal::CreatePlacedTexture(Memory* memory, uint64_t offset
 
     texture = nullptr;
     if (result == Result::SUCCESS)
-        texture = (Texture*)Allocate<TextureVal>(GetAllocationCallbacks(), *this, textureImpl, !memory);
+        texture = (Texture*)AllocateObject<TextureVal>(*this, textureImpl, !memory);
 
     // Update
     if (texture && memory) {
@@ -953,7 +960,7 @@ NRI_INLINE Result DeviceVal::CreatePlacedMicromap(Memory* memory, uint64_t offse
 
     micromap = nullptr;
     if (result == Result::SUCCESS)
-        micromap = (Micromap*)Allocate<MicromapVal>(GetAllocationCallbacks(), *this, micromapImpl, !memory);
+        micromap = (Micromap*)AllocateObject<MicromapVal>(*this, micromapImpl, !memory);
 
     // Update
     if (micromap && memory) {
@@ -1029,7 +1036,7 @@ NRI_INLINE Result DeviceVal::CreatePlacedAccelerationStructure(Memory* memory, u
 
     accelerationStructure = nullptr;
     if (result == Result::SUCCESS)
-        accelerationStructure = (AccelerationStructure*)Allocate<AccelerationStructureVal>(GetAllocationCallbacks(), *this, accelerationStructureImpl, !memory);
+        accelerationStructure = (AccelerationStructure*)AllocateObject<AccelerationStructureVal>(*this, accelerationStructureImpl, !memory);
 
     // Update
     if (accelerationStructure && memory) {
@@ -1059,7 +1066,7 @@ NRI_INLINE Result DeviceVal::AllocateMemory(const AllocateMemoryDesc& allocateMe
 
     memory = nullptr;
     if (result == Result::SUCCESS)
-        memory = (Memory*)Allocate<MemoryVal>(GetAllocationCallbacks(), *this, memoryImpl, allocateMemoryDesc.size, it->second);
+        memory = (Memory*)AllocateObject<MemoryVal>(*this, memoryImpl, allocateMemoryDesc.size, it->second);
 
     return result;
 }
@@ -1077,7 +1084,7 @@ NRI_INLINE void DeviceVal::FreeMemory(Memory* memory) {
 
     m_iCoreImpl.FreeMemory(NRI_GET_IMPL(Memory, memory));
 
-    Destroy(memoryVal);
+    DestroyObject(memoryVal);
 }
 
 NRI_INLINE void DeviceVal::CopyDescriptorRanges(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum) {
@@ -1204,7 +1211,7 @@ NRI_INLINE Result DeviceVal::CreateCommandBuffer(const CommandBufferVKDesc& comm
 
     commandBuffer = nullptr;
     if (result == Result::SUCCESS)
-        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, true);
+        commandBuffer = (CommandBuffer*)AllocateObject<CommandBufferVal>(*this, commandBufferImpl, true);
 
     return result;
 }
@@ -1232,7 +1239,7 @@ NRI_INLINE Result DeviceVal::CreateBuffer(const BufferVKDesc& bufferVKDesc, Buff
 
     buffer = nullptr;
     if (result == Result::SUCCESS)
-        buffer = (Buffer*)Allocate<BufferVal>(GetAllocationCallbacks(), *this, bufferImpl, true);
+        buffer = (Buffer*)AllocateObject<BufferVal>(*this, bufferImpl, true);
 
     return result;
 }
@@ -1249,7 +1256,7 @@ NRI_INLINE Result DeviceVal::CreateTexture(const TextureVKDesc& textureVKDesc, T
 
     texture = nullptr;
     if (result == Result::SUCCESS)
-        texture = (Texture*)Allocate<TextureVal>(GetAllocationCallbacks(), *this, textureImpl, true);
+        texture = (Texture*)AllocateObject<TextureVal>(*this, textureImpl, true);
 
     return result;
 }
@@ -1263,7 +1270,7 @@ NRI_INLINE Result DeviceVal::CreateMemory(const MemoryVKDesc& memoryVKDesc, Memo
 
     memory = nullptr;
     if (result == Result::SUCCESS)
-        memory = (Memory*)Allocate<MemoryVal>(GetAllocationCallbacks(), *this, memoryImpl, memoryVKDesc.size, MemoryLocation::MAX_NUM);
+        memory = (Memory*)AllocateObject<MemoryVal>(*this, memoryImpl, memoryVKDesc.size, MemoryLocation::MAX_NUM);
 
     return result;
 }
@@ -1304,7 +1311,7 @@ NRI_INLINE Result DeviceVal::CreateFence(const FenceVKDesc& fenceVKDesc, Fence*&
 
     fence = nullptr;
     if (result == Result::SUCCESS)
-        fence = (Fence*)Allocate<FenceVal>(GetAllocationCallbacks(), *this, fenceImpl);
+        fence = (Fence*)AllocateObject<FenceVal>(*this, fenceImpl);
 
     return result;
 }
@@ -1317,7 +1324,7 @@ NRI_INLINE Result DeviceVal::CreateAccelerationStructure(const AccelerationStruc
 
     accelerationStructure = nullptr;
     if (result == Result::SUCCESS)
-        accelerationStructure = (AccelerationStructure*)Allocate<AccelerationStructureVal>(GetAllocationCallbacks(), *this, accelerationStructureImpl, true);
+        accelerationStructure = (AccelerationStructure*)AllocateObject<AccelerationStructureVal>(*this, accelerationStructureImpl, true);
 
     return result;
 }
@@ -1334,7 +1341,7 @@ NRI_INLINE Result DeviceVal::CreateCommandBuffer(const CommandBufferD3D11Desc& c
 
     commandBuffer = nullptr;
     if (result == Result::SUCCESS)
-        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, true);
+        commandBuffer = (CommandBuffer*)AllocateObject<CommandBufferVal>(*this, commandBufferImpl, true);
 
     return result;
 }
@@ -1347,7 +1354,7 @@ NRI_INLINE Result DeviceVal::CreateBuffer(const BufferD3D11Desc& bufferD3D11Desc
 
     buffer = nullptr;
     if (result == Result::SUCCESS)
-        buffer = (Buffer*)Allocate<BufferVal>(GetAllocationCallbacks(), *this, bufferImpl, true);
+        buffer = (Buffer*)AllocateObject<BufferVal>(*this, bufferImpl, true);
 
     return result;
 }
@@ -1360,7 +1367,7 @@ NRI_INLINE Result DeviceVal::CreateTexture(const TextureD3D11Desc& textureD3D11D
 
     texture = nullptr;
     if (result == Result::SUCCESS)
-        texture = (Texture*)Allocate<TextureVal>(GetAllocationCallbacks(), *this, textureImpl, true);
+        texture = (Texture*)AllocateObject<TextureVal>(*this, textureImpl, true);
 
     return result;
 }
@@ -1377,7 +1384,7 @@ NRI_INLINE Result DeviceVal::CreateCommandBuffer(const CommandBufferD3D12Desc& c
 
     commandBuffer = nullptr;
     if (result == Result::SUCCESS)
-        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, true);
+        commandBuffer = (CommandBuffer*)AllocateObject<CommandBufferVal>(*this, commandBufferImpl, true);
 
     return result;
 }
@@ -1403,7 +1410,7 @@ NRI_INLINE Result DeviceVal::CreateBuffer(const BufferD3D12Desc& bufferD3D12Desc
 
     buffer = nullptr;
     if (result == Result::SUCCESS)
-        buffer = (Buffer*)Allocate<BufferVal>(GetAllocationCallbacks(), *this, bufferImpl, true);
+        buffer = (Buffer*)AllocateObject<BufferVal>(*this, bufferImpl, true);
 
     return result;
 }
@@ -1416,7 +1423,7 @@ NRI_INLINE Result DeviceVal::CreateTexture(const TextureD3D12Desc& textureD3D12D
 
     texture = nullptr;
     if (result == Result::SUCCESS)
-        texture = (Texture*)Allocate<TextureVal>(GetAllocationCallbacks(), *this, textureImpl, true);
+        texture = (Texture*)AllocateObject<TextureVal>(*this, textureImpl, true);
 
     return result;
 }
@@ -1431,7 +1438,7 @@ NRI_INLINE Result DeviceVal::CreateMemory(const MemoryD3D12Desc& memoryD3D12Desc
 
     memory = nullptr;
     if (result == Result::SUCCESS)
-        memory = (Memory*)Allocate<MemoryVal>(GetAllocationCallbacks(), *this, memoryImpl, size, MemoryLocation::MAX_NUM);
+        memory = (Memory*)AllocateObject<MemoryVal>(*this, memoryImpl, size, MemoryLocation::MAX_NUM);
 
     return result;
 }
@@ -1444,7 +1451,7 @@ NRI_INLINE Result DeviceVal::CreateFence(const FenceD3D12Desc& fenceD3D12Desc, F
 
     fence = nullptr;
     if (result == Result::SUCCESS)
-        fence = (Fence*)Allocate<FenceVal>(GetAllocationCallbacks(), *this, fenceImpl);
+        fence = (Fence*)AllocateObject<FenceVal>(*this, fenceImpl);
 
     return result;
 }
@@ -1457,7 +1464,7 @@ NRI_INLINE Result DeviceVal::CreateAccelerationStructure(const AccelerationStruc
 
     accelerationStructure = nullptr;
     if (result == Result::SUCCESS)
-        accelerationStructure = (AccelerationStructure*)Allocate<AccelerationStructureVal>(GetAllocationCallbacks(), *this, accelerationStructureImpl, true);
+        accelerationStructure = (AccelerationStructure*)AllocateObject<AccelerationStructureVal>(*this, accelerationStructureImpl, true);
 
     return result;
 }
@@ -1513,7 +1520,7 @@ NRI_INLINE Result DeviceVal::CreateMicromap(const MicromapDesc& micromapDesc, Mi
 
     micromap = nullptr;
     if (result == Result::SUCCESS)
-        micromap = (Micromap*)Allocate<MicromapVal>(GetAllocationCallbacks(), *this, micromapImpl, false);
+        micromap = (Micromap*)AllocateObject<MicromapVal>(*this, micromapImpl, false);
 
     return result;
 }
@@ -1564,7 +1571,7 @@ NRI_INLINE Result DeviceVal::CreateAccelerationStructure(const AccelerationStruc
 
     accelerationStructure = nullptr;
     if (result == Result::SUCCESS)
-        accelerationStructure = (AccelerationStructure*)Allocate<AccelerationStructureVal>(GetAllocationCallbacks(), *this, accelerationStructureImpl, false);
+        accelerationStructure = (AccelerationStructure*)AllocateObject<AccelerationStructureVal>(*this, accelerationStructureImpl, false);
 
     return result;
 }
@@ -1747,10 +1754,10 @@ NRI_INLINE Result DeviceVal::BindAccelerationStructureMemory(const BindAccelerat
 
 NRI_INLINE void DeviceVal::DestroyAccelerationStructure(AccelerationStructure* accelerationStructure) {
     m_iRayTracingImpl.DestroyAccelerationStructure(NRI_GET_IMPL(AccelerationStructure, accelerationStructure));
-    Destroy((AccelerationStructureVal*)accelerationStructure);
+    DestroyObject((AccelerationStructureVal*)accelerationStructure);
 }
 
 NRI_INLINE void DeviceVal::DestroyMicromap(Micromap* micromap) {
     m_iRayTracingImpl.DestroyMicromap(NRI_GET_IMPL(Micromap, micromap));
-    Destroy((MicromapVal*)micromap);
+    DestroyObject((MicromapVal*)micromap);
 }
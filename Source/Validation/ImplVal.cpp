@@ -51,7 +51,7 @@ using namespace nri;
 DeviceBase* CreateDeviceValidation(const DeviceCreationDesc& desc, DeviceBase& device) {
     DeviceVal* deviceVal = Allocate<DeviceVal>(desc.allocationCallbacks, desc.callbackInterface, desc.allocationCallbacks, device);
 
-    if (!deviceVal->Create()) {
+    if (!deviceVal->Create(desc)) {
         Destroy(desc.allocationCallbacks, deviceVal);
         return nullptr;
     }
@@ -380,6 +380,30 @@ static void NRI_CALL CmdSetDepthBias(CommandBuffer& commandBuffer, const DepthBi
     ((CommandBufferVal&)commandBuffer).SetDepthBias(depthBiasDesc);
 }
 
+static void NRI_CALL CmdSetTopology(CommandBuffer& commandBuffer, Topology topology, PrimitiveRestart primitiveRestart) {
+    ((CommandBufferVal&)commandBuffer).SetTopology(topology, primitiveRestart);
+}
+
+static void NRI_CALL CmdSetCullMode(CommandBuffer& commandBuffer, CullMode cullMode) {
+    ((CommandBufferVal&)commandBuffer).SetCullMode(cullMode);
+}
+
+static void NRI_CALL CmdSetFrontFace(CommandBuffer& commandBuffer, bool frontCounterClockwise) {
+    ((CommandBufferVal&)commandBuffer).SetFrontFace(frontCounterClockwise);
+}
+
+static void NRI_CALL CmdSetDepthState(CommandBuffer& commandBuffer, const DepthAttachmentDesc& depth) {
+    ((CommandBufferVal&)commandBuffer).SetDepthState(depth);
+}
+
+static void NRI_CALL CmdSetStencilState(CommandBuffer& commandBuffer, const StencilAttachmentDesc& stencil) {
+    ((CommandBufferVal&)commandBuffer).SetStencilState(stencil);
+}
+
+static void NRI_CALL CmdSetColorState(CommandBuffer& commandBuffer, uint32_t baseAttachment, const ColorAttachmentDesc* colors, uint32_t colorNum) {
+    ((CommandBufferVal&)commandBuffer).SetColorState(baseAttachment, colors, colorNum);
+}
+
 static void NRI_CALL CmdBeginRendering(CommandBuffer& commandBuffer, const RenderingDesc& renderingDesc) {
     ((CommandBufferVal&)commandBuffer).BeginRendering(renderingDesc);
 }
@@ -396,6 +420,14 @@ static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawInde
     ((CommandBufferVal&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    ((CommandBufferVal&)commandBuffer).DrawMulti(drawDescs, drawNum, stride);
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    ((CommandBufferVal&)commandBuffer).DrawIndexedMulti(drawIndexedDescs, drawNum, stride);
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ((CommandBufferVal&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
@@ -753,10 +785,18 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.CmdSetSampleLocations = ::CmdSetSampleLocations;
     table.CmdSetShadingRate = ::CmdSetShadingRate;
     table.CmdSetDepthBias = ::CmdSetDepthBias;
+    table.CmdSetTopology = ::CmdSetTopology;
+    table.CmdSetCullMode = ::CmdSetCullMode;
+    table.CmdSetFrontFace = ::CmdSetFrontFace;
+    table.CmdSetDepthState = ::CmdSetDepthState;
+    table.CmdSetStencilState = ::CmdSetStencilState;
+    table.CmdSetColorState = ::CmdSetColorState;
     table.CmdBeginRendering = ::CmdBeginRendering;
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
     table.CmdEndRendering = ::CmdEndRendering;
@@ -820,12 +860,24 @@ static bool ValidateTextureUploadDesc(DeviceVal& device, uint32_t i, const Textu
 
     NRI_RETURN_ON_FAILURE(&device, textureVal.IsBoundToMemory(), false, "'textureUploadDescs[%u].texture' is not bound to memory", i);
     NRI_RETURN_ON_FAILURE(&device, textureUploadDesc.after.layout < Layout::MAX_NUM, false, "'textureUploadDescs[%u].after.layout' is invalid", i);
+    NRI_RETURN_ON_FAILURE(&device, textureUploadDesc.dataFormat < Format::MAX_NUM, false, "'textureUploadDescs[%u].dataFormat' is invalid", i);
+
+    bool isConversionSupported = textureUploadDesc.dataFormat == Format::UNKNOWN || IsFormatConversionSupported(textureUploadDesc.dataFormat, textureDesc.format);
+    NRI_RETURN_ON_FAILURE(&device, isConversionSupported, false, "'textureUploadDescs[%u].dataFormat' can't be converted to the texture format", i);
+    NRI_RETURN_ON_FAILURE(&device, textureUploadDesc.mipGeneration < MipGeneration::MAX_NUM, false, "'textureUploadDescs[%u].mipGeneration' is invalid", i);
+
+    bool isMipGeneration = textureUploadDesc.mipGeneration != MipGeneration::NONE;
+    if (isMipGeneration) {
+        NRI_RETURN_ON_FAILURE(&device, !textureUploadDesc.file, false, "'textureUploadDescs[%u].file' is not supported with 'mipGeneration'", i);
+        NRI_RETURN_ON_FAILURE(&device, textureDesc.type != TextureType::TEXTURE_3D, false, "'textureUploadDescs[%u].mipGeneration' is not supported for 3D textures", i);
+        NRI_RETURN_ON_FAILURE(&device, IsMipGenerationSupported(textureDesc.format), false, "'textureUploadDescs[%u].mipGeneration' is not supported for the texture format", i);
+    }
 
-    uint32_t subresourceNum = (uint32_t)textureDesc.layerNum * (uint32_t)textureDesc.mipNum;
+    uint32_t subresourceNum = (uint32_t)textureDesc.layerNum * (isMipGeneration ? 1 : (uint32_t)textureDesc.mipNum);
     for (uint32_t j = 0; j < subresourceNum; j++) {
         const TextureSubresourceUploadDesc& subresource = textureUploadDesc.subresources[j];
 
-        NRI_RETURN_ON_FAILURE(&device, subresource.slices != nullptr, false, "'textureUploadDescs[%u].subresources[%u].slices' is NULL", i, j);
+        NRI_RETURN_ON_FAILURE(&device, textureUploadDesc.file || subresource.slices != nullptr, false, "'textureUploadDescs[%u].subresources[%u].slices' is NULL", i, j);
         NRI_RETURN_ON_FAILURE(&device, subresource.sliceNum != 0, false, "'textureUploadDescs[%u].subresources[%u].sliceNum' is 0", i, j);
         NRI_RETURN_ON_FAILURE(&device, subresource.rowPitch != 0, false, "'textureUploadDescs[%u].subresources[%u].rowPitch' is 0", i, j);
         NRI_RETURN_ON_FAILURE(&device, subresource.slicePitch != 0, false, "'textureUploadDescs[%u].subresources[%u].slicePitch' is 0", i, j);
@@ -835,7 +887,7 @@ static bool ValidateTextureUploadDesc(DeviceVal& device, uint32_t i, const Textu
 }
 
 static bool ValidateBufferUploadDesc(DeviceVal& device, uint32_t i, const BufferUploadDesc& bufferUploadDesc) {
-    if (!bufferUploadDesc.data)
+    if (!bufferUploadDesc.data && !bufferUploadDesc.file)
         return true;
 
     NRI_RETURN_ON_FAILURE(&device, bufferUploadDesc.buffer != nullptr, false, "'bufferUploadDescs[%u].buffer' is NULL", i);
@@ -917,11 +969,340 @@ static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation
     return deviceVal.GetHelperInterfaceImpl().QueryVideoMemoryInfo(deviceVal.GetImpl(), memoryLocation, videoMemoryInfo);
 }
 
+static Result NRI_CALL SetMemoryPriority(Memory& memory, float priority) {
+    MemoryVal& memoryVal = (MemoryVal&)memory;
+    DeviceVal& deviceVal = memoryVal.GetDevice();
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, priority >= -1.0f && priority <= 1.0f, Result::INVALID_ARGUMENT, "'priority' must be in [-1; 1]");
+
+    return deviceVal.GetHelperInterfaceImpl().SetMemoryPriority(*memoryVal.GetImpl(), priority);
+}
+
+static Result NRI_CALL CreateResidencyManager(Device& device, const ResidencyManagerDesc& residencyManagerDesc, ResidencyManager*& residencyManager) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, residencyManagerDesc.memoryLocation < MemoryLocation::MAX_NUM, Result::INVALID_ARGUMENT, "'memoryLocation' is invalid");
+    NRI_RETURN_ON_FAILURE(&deviceVal, residencyManagerDesc.demoteThreshold >= 0.0f && residencyManagerDesc.demoteThreshold <= 1.0f, Result::INVALID_ARGUMENT, "'demoteThreshold' must be in [0; 1]");
+    NRI_RETURN_ON_FAILURE(&deviceVal, residencyManagerDesc.promoteThreshold >= 0.0f && residencyManagerDesc.promoteThreshold <= 1.0f, Result::INVALID_ARGUMENT, "'promoteThreshold' must be in [0; 1]");
+
+    HelperResidencyManager* impl = Allocate<HelperResidencyManager>(deviceVal.GetAllocationCallbacks(), device);
+    Result result = impl->Create(residencyManagerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        residencyManager = nullptr;
+    } else
+        residencyManager = (ResidencyManager*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyResidencyManager(ResidencyManager* residencyManager) {
+    Destroy((HelperResidencyManager*)residencyManager);
+}
+
+static uint32_t NRI_CALL TrackMemory(ResidencyManager& residencyManager, Memory& memory, uint64_t size, float priority) {
+    return ((HelperResidencyManager&)residencyManager).TrackMemory(memory, size, priority);
+}
+
+static void NRI_CALL UntrackMemory(ResidencyManager& residencyManager, uint32_t memoryHandle) {
+    ((HelperResidencyManager&)residencyManager).UntrackMemory(memoryHandle);
+}
+
+static void NRI_CALL MarkMemoryUsed(ResidencyManager& residencyManager, const uint32_t* memoryHandles, uint32_t memoryHandleNum) {
+    ((HelperResidencyManager&)residencyManager).MarkMemoryUsed(memoryHandles, memoryHandleNum);
+}
+
+static Result NRI_CALL UpdateResidency(ResidencyManager& residencyManager, ResidencyStats* residencyStats) {
+    return ((HelperResidencyManager&)residencyManager).UpdateResidency(residencyStats);
+}
+
+static Result NRI_CALL CreateDefragmenter(Queue& queue, const DefragmenterDesc& defragmenterDesc, Defragmenter*& defragmenter) {
+    QueueVal& queueVal = (QueueVal&)queue;
+    DeviceVal& deviceVal = queueVal.GetDevice();
+    NRI_RETURN_ON_FAILURE(&deviceVal, defragmenterDesc.memoryLocation < MemoryLocation::MAX_NUM, Result::INVALID_ARGUMENT, "'memoryLocation' is invalid");
+    NRI_RETURN_ON_FAILURE(&deviceVal, defragmenterDesc.occupancyThreshold >= 0.0f && defragmenterDesc.occupancyThreshold <= 1.0f, Result::INVALID_ARGUMENT, "'occupancyThreshold' must be in [0; 1]");
+
+    HelperDefragmenter* impl = Allocate<HelperDefragmenter>(deviceVal.GetAllocationCallbacks(), deviceVal.GetCoreInterface(), (Device&)deviceVal, queue);
+    Result result = impl->Create(defragmenterDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        defragmenter = nullptr;
+    } else
+        defragmenter = (Defragmenter*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyDefragmenter(Defragmenter* defragmenter) {
+    Destroy((HelperDefragmenter*)defragmenter);
+}
+
+static uint32_t NRI_CALL PlanDefragmentation(Defragmenter& defragmenter, const DefragmentationDesc& defragmentationDesc) {
+    HelperDefragmenter& helperDefragmenter = (HelperDefragmenter&)defragmenter;
+    DeviceVal& deviceVal = (DeviceVal&)helperDefragmenter.GetDevice();
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, defragmentationDesc.memoryNum == 0 || defragmentationDesc.memories != nullptr, 0, "'memories' is NULL");
+    NRI_RETURN_ON_FAILURE(&deviceVal, defragmentationDesc.resourceNum == 0 || defragmentationDesc.resources != nullptr, 0, "'resources' is NULL");
+
+    for (uint32_t i = 0; i < defragmentationDesc.memoryNum; i++) {
+        NRI_RETURN_ON_FAILURE(&deviceVal, defragmentationDesc.memories[i].memory != nullptr, 0, "'memories[%u].memory' is NULL", i);
+    }
+
+    for (uint32_t i = 0; i < defragmentationDesc.resourceNum; i++) {
+        const DefragmentationResourceDesc& resource = defragmentationDesc.resources[i];
+
+        NRI_RETURN_ON_FAILURE(&deviceVal, (resource.buffer != nullptr) != (resource.texture != nullptr), 0, "'resources[%u]' must have either 'buffer' or 'texture'", i);
+        NRI_RETURN_ON_FAILURE(&deviceVal, resource.memoryIndex < defragmentationDesc.memoryNum, 0, "'resources[%u].memoryIndex' is out of bounds", i);
+    }
+
+    return helperDefragmenter.PlanDefragmentation(defragmentationDesc);
+}
+
+static Result NRI_CALL DefragmentStep(Defragmenter& defragmenter, DefragmentationResult& defragmentationResult) {
+    return ((HelperDefragmenter&)defragmenter).DefragmentStep(defragmentationResult);
+}
+
+static Result NRI_CALL MergePipelineCaches(PipelineCache& dstPipelineCache, const PipelineCache* const* srcPipelineCaches, uint32_t srcPipelineCacheNum) {
+    PipelineCacheVal& dstPipelineCacheVal = (PipelineCacheVal&)dstPipelineCache;
+    DeviceVal& deviceVal = dstPipelineCacheVal.GetDevice();
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, srcPipelineCacheNum == 0 || srcPipelineCaches != nullptr, Result::INVALID_ARGUMENT, "'srcPipelineCaches' is NULL");
+
+    Scratch<PipelineCache*> srcPipelineCachesImpl = NRI_ALLOCATE_SCRATCH(deviceVal, PipelineCache*, srcPipelineCacheNum);
+    for (uint32_t i = 0; i < srcPipelineCacheNum; i++) {
+        NRI_RETURN_ON_FAILURE(&deviceVal, srcPipelineCaches[i] != nullptr, Result::INVALID_ARGUMENT, "'srcPipelineCaches[%u]' is NULL", i);
+        NRI_RETURN_ON_FAILURE(&deviceVal, srcPipelineCaches[i] != &dstPipelineCache, Result::INVALID_ARGUMENT, "'srcPipelineCaches[%u]' is 'dstPipelineCache'", i);
+
+        srcPipelineCachesImpl[i] = NRI_GET_IMPL(PipelineCache, srcPipelineCaches[i]);
+    }
+
+    return deviceVal.GetHelperInterfaceImpl().MergePipelineCaches(*dstPipelineCacheVal.GetImpl(), srcPipelineCachesImpl, srcPipelineCacheNum);
+}
+
+static Result NRI_CALL CreatePipelineCacheStore(Device& device, const PipelineCacheStoreDesc& pipelineCacheStoreDesc, PipelineCacheStore*& pipelineCacheStore) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, pipelineCacheStoreDesc.fileName != nullptr, Result::INVALID_ARGUMENT, "'fileName' is NULL");
+
+    HelperPipelineCacheStore* impl = Allocate<HelperPipelineCacheStore>(deviceVal.GetAllocationCallbacks(), device);
+    Result result = impl->Create(pipelineCacheStoreDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        pipelineCacheStore = nullptr;
+    } else
+        pipelineCacheStore = (PipelineCacheStore*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyPipelineCacheStore(PipelineCacheStore* pipelineCacheStore) {
+    Destroy((HelperPipelineCacheStore*)pipelineCacheStore);
+}
+
+static PipelineCache* NRI_CALL GetPipelineCacheStoreCache(const PipelineCacheStore& pipelineCacheStore, uint32_t workerIndex) {
+    return ((HelperPipelineCacheStore&)pipelineCacheStore).GetPipelineCache(workerIndex);
+}
+
+static Result NRI_CALL SavePipelineCacheStore(PipelineCacheStore& pipelineCacheStore, bool async) {
+    return ((HelperPipelineCacheStore&)pipelineCacheStore).Save(async);
+}
+
+static void NRI_CALL GetPipelineCacheStoreStats(const PipelineCacheStore& pipelineCacheStore, PipelineCacheStoreStats& pipelineCacheStoreStats) {
+    ((HelperPipelineCacheStore&)pipelineCacheStore).GetStats(pipelineCacheStoreStats);
+}
+
+static void NRI_CALL GetPipelineLibraryStats(const Device& device, PipelineLibraryStats& pipelineLibraryStats) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+
+    deviceVal.GetHelperInterfaceImpl().GetPipelineLibraryStats(deviceVal.GetImpl(), pipelineLibraryStats);
+}
+
+static Result NRI_CALL CreatePipelineCompiler(Device& device, const PipelineCompilerDesc& pipelineCompilerDesc, PipelineCompiler*& pipelineCompiler) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+    HelperPipelineCompiler* impl = Allocate<HelperPipelineCompiler>(deviceVal.GetAllocationCallbacks(), device);
+    Result result = impl->Create(pipelineCompilerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        pipelineCompiler = nullptr;
+    } else
+        pipelineCompiler = (PipelineCompiler*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyPipelineCompiler(PipelineCompiler* pipelineCompiler) {
+    Destroy((HelperPipelineCompiler*)pipelineCompiler);
+}
+
+static uint32_t NRI_CALL CompileGraphicsPipelineAsync(PipelineCompiler& pipelineCompiler, const GraphicsPipelineDesc& graphicsPipelineDesc) {
+    HelperPipelineCompiler& helperPipelineCompiler = (HelperPipelineCompiler&)pipelineCompiler;
+    DeviceVal& deviceVal = (DeviceVal&)helperPipelineCompiler.GetDevice();
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, graphicsPipelineDesc.pipelineLayout != nullptr, 0, "'pipelineLayout' is NULL");
+    NRI_RETURN_ON_FAILURE(&deviceVal, graphicsPipelineDesc.shaders != nullptr, 0, "'shaders' is NULL");
+    NRI_RETURN_ON_FAILURE(&deviceVal, graphicsPipelineDesc.shaderNum > 0, 0, "'shaderNum' is 0");
+
+    return helperPipelineCompiler.Compile(graphicsPipelineDesc);
+}
+
+static uint32_t NRI_CALL CompileComputePipelineAsync(PipelineCompiler& pipelineCompiler, const ComputePipelineDesc& computePipelineDesc) {
+    HelperPipelineCompiler& helperPipelineCompiler = (HelperPipelineCompiler&)pipelineCompiler;
+    DeviceVal& deviceVal = (DeviceVal&)helperPipelineCompiler.GetDevice();
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, computePipelineDesc.pipelineLayout != nullptr, 0, "'pipelineLayout' is NULL");
+    NRI_RETURN_ON_FAILURE(&deviceVal, computePipelineDesc.shader.size != 0, 0, "'shader.size' is 0");
+
+    return helperPipelineCompiler.Compile(computePipelineDesc);
+}
+
+static bool NRI_CALL IsPipelineReady(const PipelineCompiler& pipelineCompiler, uint32_t pipelineHandle) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).IsReady(pipelineHandle);
+}
+
+static Pipeline* NRI_CALL AcquirePipeline(const PipelineCompiler& pipelineCompiler, uint32_t pipelineHandle, Pipeline* substitute) {
+    return ((HelperPipelineCompiler&)pipelineCompiler).Acquire(pipelineHandle, substitute);
+}
+
+static void NRI_CALL ReleasePipeline(PipelineCompiler& pipelineCompiler, uint32_t pipelineHandle) {
+    ((HelperPipelineCompiler&)pipelineCompiler).Release(pipelineHandle);
+}
+
+static Result NRI_CALL GetPipelineFeedback(const Pipeline& pipeline, PipelineFeedback& pipelineFeedback) {
+    const PipelineVal& pipelineVal = (const PipelineVal&)pipeline;
+    DeviceVal& deviceVal = pipelineVal.GetDevice();
+
+    return deviceVal.GetHelperInterfaceImpl().GetPipelineFeedback(*pipelineVal.GetImpl(), pipelineFeedback);
+}
+
+static void NRI_CALL GetPipelineFeedbackStats(const Device& device, PipelineFeedbackStats& pipelineFeedbackStats) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+
+    deviceVal.GetHelperInterfaceImpl().GetPipelineFeedbackStats(deviceVal.GetImpl(), pipelineFeedbackStats);
+}
+
+static Result NRI_CALL CreateBindlessAllocator(Device& device, const BindlessAllocatorDesc& bindlessAllocatorDesc, BindlessAllocator*& bindlessAllocator) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, bindlessAllocatorDesc.pipelineLayout != nullptr, Result::INVALID_ARGUMENT, "'pipelineLayout' is NULL");
+    NRI_RETURN_ON_FAILURE(&deviceVal, bindlessAllocatorDesc.classes != nullptr, Result::INVALID_ARGUMENT, "'classes' is NULL");
+    NRI_RETURN_ON_FAILURE(&deviceVal, bindlessAllocatorDesc.classNum != 0, Result::INVALID_ARGUMENT, "'classNum' is 0");
+
+    for (uint32_t i = 0; i < bindlessAllocatorDesc.classNum; i++) {
+        const BindlessClassDesc& bindlessClassDesc = bindlessAllocatorDesc.classes[i];
+        NRI_RETURN_ON_FAILURE(&deviceVal, bindlessClassDesc.descriptorType < DescriptorType::MAX_NUM, Result::INVALID_ARGUMENT, "'classes[%u].descriptorType' is invalid", i);
+        NRI_RETURN_ON_FAILURE(&deviceVal, bindlessClassDesc.descriptorNum != 0, Result::INVALID_ARGUMENT, "'classes[%u].descriptorNum' is 0", i);
+    }
+
+    HelperBindlessAllocator* impl = Allocate<HelperBindlessAllocator>(deviceVal.GetAllocationCallbacks(), device);
+    Result result = impl->Create(bindlessAllocatorDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        bindlessAllocator = nullptr;
+    } else
+        bindlessAllocator = (BindlessAllocator*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyBindlessAllocator(BindlessAllocator* bindlessAllocator) {
+    Destroy((HelperBindlessAllocator*)bindlessAllocator);
+}
+
+static DescriptorSet* NRI_CALL GetBindlessDescriptorSet(const BindlessAllocator& bindlessAllocator, uint32_t classIndex) {
+    return ((HelperBindlessAllocator&)bindlessAllocator).GetDescriptorSet(classIndex);
+}
+
+static Result NRI_CALL AllocateBindlessIndex(BindlessAllocator& bindlessAllocator, uint32_t classIndex, uint32_t& index) {
+    HelperBindlessAllocator& helperBindlessAllocator = (HelperBindlessAllocator&)bindlessAllocator;
+    DeviceVal& deviceVal = (DeviceVal&)helperBindlessAllocator.GetDevice();
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, classIndex < helperBindlessAllocator.GetClassNum(), Result::INVALID_ARGUMENT, "'classIndex' is out of bounds");
+
+    return helperBindlessAllocator.AllocateIndex(classIndex, index);
+}
+
+static void NRI_CALL ReleaseBindlessIndex(BindlessAllocator& bindlessAllocator, uint32_t classIndex, uint32_t index) {
+    HelperBindlessAllocator& helperBindlessAllocator = (HelperBindlessAllocator&)bindlessAllocator;
+    DeviceVal& deviceVal = (DeviceVal&)helperBindlessAllocator.GetDevice();
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, classIndex < helperBindlessAllocator.GetClassNum(), ReturnVoid(), "'classIndex' is out of bounds");
+    NRI_RETURN_ON_FAILURE(&deviceVal, index < helperBindlessAllocator.GetDescriptorNum(classIndex), ReturnVoid(), "'index' is out of bounds");
+
+    helperBindlessAllocator.ReleaseIndex(classIndex, index);
+}
+
+static void NRI_CALL SetBindlessDescriptor(BindlessAllocator& bindlessAllocator, uint32_t classIndex, uint32_t index, const Descriptor& descriptor) {
+    HelperBindlessAllocator& helperBindlessAllocator = (HelperBindlessAllocator&)bindlessAllocator;
+    DeviceVal& deviceVal = (DeviceVal&)helperBindlessAllocator.GetDevice();
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, classIndex < helperBindlessAllocator.GetClassNum(), ReturnVoid(), "'classIndex' is out of bounds");
+    NRI_RETURN_ON_FAILURE(&deviceVal, index < helperBindlessAllocator.GetDescriptorNum(classIndex), ReturnVoid(), "'index' is out of bounds");
+
+    helperBindlessAllocator.SetDescriptor(classIndex, index, descriptor);
+}
+
+static void NRI_CALL UpdateBindlessAllocator(BindlessAllocator& bindlessAllocator, uint64_t completedFrameNum) {
+    ((HelperBindlessAllocator&)bindlessAllocator).Update(completedFrameNum);
+}
+
+static void NRI_CALL GetRedundantCommandStats(const Device& device, RedundantCommandStats& redundantCommandStats) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+
+    deviceVal.GetHelperInterfaceImpl().GetRedundantCommandStats(deviceVal.GetImpl(), redundantCommandStats);
+}
+
+static void NRI_CALL InvalidateCommandBufferState(CommandBuffer& commandBuffer) {
+    CommandBufferVal& commandBufferVal = (CommandBufferVal&)commandBuffer;
+
+    commandBufferVal.GetHelperInterfaceImpl().InvalidateCommandBufferState(*commandBufferVal.GetImpl());
+}
+
 Result DeviceVal::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.SetMemoryPriority = ::SetMemoryPriority;
+    table.CreateResidencyManager = ::CreateResidencyManager;
+    table.DestroyResidencyManager = ::DestroyResidencyManager;
+    table.TrackMemory = ::TrackMemory;
+    table.UntrackMemory = ::UntrackMemory;
+    table.MarkMemoryUsed = ::MarkMemoryUsed;
+    table.UpdateResidency = ::UpdateResidency;
+    table.CreateDefragmenter = ::CreateDefragmenter;
+    table.DestroyDefragmenter = ::DestroyDefragmenter;
+    table.PlanDefragmentation = ::PlanDefragmentation;
+    table.DefragmentStep = ::DefragmentStep;
+    table.MergePipelineCaches = ::MergePipelineCaches;
+    table.CreatePipelineCacheStore = ::CreatePipelineCacheStore;
+    table.DestroyPipelineCacheStore = ::DestroyPipelineCacheStore;
+    table.GetPipelineCacheStoreCache = ::GetPipelineCacheStoreCache;
+    table.SavePipelineCacheStore = ::SavePipelineCacheStore;
+    table.GetPipelineCacheStoreStats = ::GetPipelineCacheStoreStats;
+    table.GetPipelineLibraryStats = ::GetPipelineLibraryStats;
+    table.CreatePipelineCompiler = ::CreatePipelineCompiler;
+    table.DestroyPipelineCompiler = ::DestroyPipelineCompiler;
+    table.CompileGraphicsPipelineAsync = ::CompileGraphicsPipelineAsync;
+    table.CompileComputePipelineAsync = ::CompileComputePipelineAsync;
+    table.IsPipelineReady = ::IsPipelineReady;
+    table.AcquirePipeline = ::AcquirePipeline;
+    table.ReleasePipeline = ::ReleasePipeline;
+    table.GetPipelineFeedback = ::GetPipelineFeedback;
+    table.GetPipelineFeedbackStats = ::GetPipelineFeedbackStats;
+    table.CreateBindlessAllocator = ::CreateBindlessAllocator;
+    table.DestroyBindlessAllocator = ::DestroyBindlessAllocator;
+    table.GetBindlessDescriptorSet = ::GetBindlessDescriptorSet;
+    table.AllocateBindlessIndex = ::AllocateBindlessIndex;
+    table.ReleaseBindlessIndex = ::ReleaseBindlessIndex;
+    table.SetBindlessDescriptor = ::SetBindlessDescriptor;
+    table.UpdateBindlessAllocator = ::UpdateBindlessAllocator;
+    table.GetRedundantCommandStats = ::GetRedundantCommandStats;
+    table.InvalidateCommandBufferState = ::InvalidateCommandBufferState;
 
     return Result::SUCCESS;
 }
@@ -1337,6 +1718,7 @@ static Result NRI_CALL CreateStreamer(Device& device, const StreamerDesc& stream
 
     isUpload = streamerDesc.dynamicBufferMemoryLocation == MemoryLocation::HOST_UPLOAD || streamerDesc.dynamicBufferMemoryLocation == MemoryLocation::DEVICE_UPLOAD;
     NRI_RETURN_ON_FAILURE(&deviceVal, isUpload, Result::INVALID_ARGUMENT, "'dynamicBufferMemoryLocation' must be an UPLOAD heap");
+    NRI_RETURN_ON_FAILURE(&deviceVal, streamerDesc.readbackBufferSize < (1ull << 32), Result::INVALID_ARGUMENT, "'readbackBufferSize' must be < 4 Gb");
 
     StreamerImpl* impl = Allocate<StreamerImpl>(deviceVal.GetAllocationCallbacks(), device, deviceVal.GetCoreInterface());
     Result result = impl->Create(streamerDesc);
@@ -1398,13 +1780,17 @@ static BufferOffset NRI_CALL StreamTextureData(Streamer& streamer, const StreamT
     NRI_RETURN_ON_FAILURE(&deviceVal, streamTextureDataDesc.dstTexture, {}, "'streamTextureDataDesc.dstTexture' is NULL");
     NRI_RETURN_ON_FAILURE(&deviceVal, streamTextureDataDesc.dataRowPitch, {}, "'streamTextureDataDesc.dataRowPitch' must be > 0");
     NRI_RETURN_ON_FAILURE(&deviceVal, streamTextureDataDesc.dataSlicePitch, {}, "'streamTextureDataDesc.dataSlicePitch' must be > 0");
-    NRI_RETURN_ON_FAILURE(&deviceVal, streamTextureDataDesc.data, {}, "'streamTextureDataDesc.data' is NULL");
+    NRI_RETURN_ON_FAILURE(&deviceVal, streamTextureDataDesc.data || streamTextureDataDesc.file, {}, "'streamTextureDataDesc.data' and 'streamTextureDataDesc.file' are NULL");
 
     if (streamTextureDataDesc.dstTexture) {
         constexpr TextureUsageBits attachmentBits = TextureUsageBits::COLOR_ATTACHMENT | TextureUsageBits::DEPTH_STENCIL_ATTACHMENT | TextureUsageBits::SHADING_RATE_ATTACHMENT;
         const TextureVal& textureVal = *(TextureVal*)streamTextureDataDesc.dstTexture;
         const TextureDesc& textureDesc = textureVal.GetDesc();
         NRI_RETURN_ON_FAILURE(&deviceVal, !(textureDesc.usage & attachmentBits), {}, "streaming data into potentially compressed attachments is unrecommended");
+        NRI_RETURN_ON_FAILURE(&deviceVal, streamTextureDataDesc.dataFormat < Format::MAX_NUM, {}, "'streamTextureDataDesc.dataFormat' is invalid");
+
+        bool isConversionSupported = streamTextureDataDesc.dataFormat == Format::UNKNOWN || IsFormatConversionSupported(streamTextureDataDesc.dataFormat, textureDesc.format);
+        NRI_RETURN_ON_FAILURE(&deviceVal, isConversionSupported, {}, "'streamTextureDataDesc.dataFormat' can't be converted to the texture format");
     }
 
     return streamerImpl->StreamTextureData(streamTextureDataDesc);
@@ -1424,6 +1810,37 @@ static void NRI_CALL CmdCopyStreamedData(CommandBuffer& commandBuffer, Streamer&
     streamerImpl->CmdCopyStreamedData(commandBuffer);
 }
 
+static uint64_t NRI_CALL CmdReadbackBuffer(CommandBuffer& commandBuffer, Streamer& streamer, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    DeviceVal& deviceVal = GetDeviceVal(streamer);
+    StreamerVal& streamerVal = (StreamerVal&)streamer;
+    StreamerImpl* streamerImpl = streamerVal.GetImpl();
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, streamerVal.m_Desc.readbackBufferSize, 0, "'readbackBufferSize' is 0");
+    NRI_RETURN_ON_FAILURE(&deviceVal, size, 0, "'size' is 0");
+
+    return streamerImpl->CmdReadbackBuffer(commandBuffer, srcBuffer, srcOffset, size);
+}
+
+static uint64_t NRI_CALL CmdReadbackTexture(CommandBuffer& commandBuffer, Streamer& streamer, const Texture& srcTexture, const TextureRegionDesc& srcRegion, TextureDataLayoutDesc& dataLayout) {
+    DeviceVal& deviceVal = GetDeviceVal(streamer);
+    StreamerVal& streamerVal = (StreamerVal&)streamer;
+    StreamerImpl* streamerImpl = streamerVal.GetImpl();
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, streamerVal.m_Desc.readbackBufferSize, 0, "'readbackBufferSize' is 0");
+
+    return streamerImpl->CmdReadbackTexture(commandBuffer, srcTexture, srcRegion, dataLayout);
+}
+
+static const void* NRI_CALL TryGetReadbackData(Streamer& streamer, uint64_t ticket) {
+    DeviceVal& deviceVal = GetDeviceVal(streamer);
+    StreamerVal& streamerVal = (StreamerVal&)streamer;
+    StreamerImpl* streamerImpl = streamerVal.GetImpl();
+
+    NRI_RETURN_ON_FAILURE(&deviceVal, ticket, nullptr, "'ticket' is 0");
+
+    return streamerImpl->TryGetReadbackData(ticket);
+}
+
 Result DeviceVal::FillFunctionTable(StreamerInterface& table) const {
     table.CreateStreamer = ::CreateStreamer;
     table.DestroyStreamer = ::DestroyStreamer;
@@ -1433,6 +1850,9 @@ Result DeviceVal::FillFunctionTable(StreamerInterface& table) const {
     table.StreamConstantData = ::StreamConstantData;
     table.EndStreamerFrame = ::EndStreamerFrame;
     table.CmdCopyStreamedData = ::CmdCopyStreamedData;
+    table.CmdReadbackBuffer = ::CmdReadbackBuffer;
+    table.CmdReadbackTexture = ::CmdReadbackTexture;
+    table.TryGetReadbackData = ::TryGetReadbackData;
 
     return Result::SUCCESS;
 }
@@ -1784,6 +2204,10 @@ static Result NRI_CALL CreateAccelerationStructureVK(Device& device, const Accel
     return ((DeviceVal&)device).CreateAccelerationStructure(accelerationStructureVKDesc, accelerationStructure);
 }
 
+static void NRI_CALL CmdExecuteCommandsVK(CommandBuffer& commandBuffer, const VKHandle* vkCommandBuffers, uint32_t vkCommandBufferNum) {
+    ((CommandBufferVal&)commandBuffer).ExecuteCommandsVK(vkCommandBuffers, vkCommandBufferNum);
+}
+
 static VKHandle NRI_CALL GetPhysicalDeviceVK(const Device& device) {
     return ((DeviceVal&)device).GetWrapperVKInterfaceImpl().GetPhysicalDeviceVK(((DeviceVal&)device).GetImpl());
 }
@@ -1822,6 +2246,7 @@ Result DeviceVal::FillFunctionTable(WrapperVKInterface& table) const {
     table.CreateQueryPoolVK = ::CreateQueryPoolVK;
     table.CreateFenceVK = ::CreateFenceVK;
     table.CreateAccelerationStructureVK = ::CreateAccelerationStructureVK;
+    table.CmdExecuteCommandsVK = ::CmdExecuteCommandsVK;
     table.GetPhysicalDeviceVK = ::GetPhysicalDeviceVK;
     table.GetQueueFamilyIndexVK = ::GetQueueFamilyIndexVK;
     table.GetInstanceVK = ::GetInstanceVK;
@@ -4,7 +4,7 @@ MicromapVal::~MicromapVal() {
     if (m_Memory)
         m_Memory->Unbind(*this);
 
-    Destroy(m_Buffer);
+    m_Device.DestroyObject(m_Buffer);
 }
 
 NRI_INLINE uint64_t MicromapVal::GetBuildScratchBufferSize() const {
@@ -22,7 +22,7 @@ NRI_INLINE Buffer* MicromapVal::GetBuffer() {
 
     if (!m_Buffer) {
         Buffer* buffer = GetRayTracingInterfaceImpl().GetMicromapBuffer(*GetImpl());
-        m_Buffer = Allocate<BufferVal>(m_Device.GetAllocationCallbacks(), m_Device, buffer, false);
+        m_Buffer = m_Device.AllocateObject<BufferVal>(m_Device, buffer, false);
     }
 
     return (Buffer*)m_Buffer;
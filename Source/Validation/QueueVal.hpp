@@ -24,25 +24,36 @@ NRI_INLINE Result QueueVal::Submit(const QueueSubmitDesc& queueSubmitDesc) {
 
     auto queueSubmitDescImpl = queueSubmitDesc;
 
-    Scratch<FenceSubmitDesc> waitFences = NRI_ALLOCATE_SCRATCH(m_Device, FenceSubmitDesc, queueSubmitDesc.waitFenceNum);
+    // Wait and signal fences share a single scratch allocation
+    uint32_t fenceNum = queueSubmitDesc.waitFenceNum + queueSubmitDesc.signalFenceNum;
+    Scratch<FenceSubmitDesc> fences = NRI_ALLOCATE_SCRATCH(m_Device, FenceSubmitDesc, fenceNum);
+    FenceSubmitDesc* waitFences = fences;
+    FenceSubmitDesc* signalFences = waitFences + queueSubmitDesc.waitFenceNum;
+
     for (uint32_t i = 0; i < queueSubmitDesc.waitFenceNum; i++) {
         waitFences[i] = queueSubmitDesc.waitFences[i];
         waitFences[i].fence = NRI_GET_IMPL(Fence, waitFences[i].fence);
     }
     queueSubmitDescImpl.waitFences = waitFences;
 
-    Scratch<CommandBuffer*> commandBuffers = NRI_ALLOCATE_SCRATCH(m_Device, CommandBuffer*, queueSubmitDesc.commandBufferNum);
-    for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++)
-        commandBuffers[i] = NRI_GET_IMPL(CommandBuffer, queueSubmitDesc.commandBuffers[i]);
-    queueSubmitDescImpl.commandBuffers = commandBuffers;
-
-    Scratch<FenceSubmitDesc> signalFences = NRI_ALLOCATE_SCRATCH(m_Device, FenceSubmitDesc, queueSubmitDesc.signalFenceNum);
     for (uint32_t i = 0; i < queueSubmitDesc.signalFenceNum; i++) {
         signalFences[i] = queueSubmitDesc.signalFences[i];
         signalFences[i].fence = NRI_GET_IMPL(Fence, signalFences[i].fence);
     }
     queueSubmitDescImpl.signalFences = signalFences;
 
+    bool validateLifetime = m_Device.IsValidationEnabled(ValidationBits::LIFETIME);
+    Scratch<CommandBuffer*> commandBuffers = NRI_ALLOCATE_SCRATCH(m_Device, CommandBuffer*, queueSubmitDesc.commandBufferNum);
+    for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++) {
+        const CommandBufferVal* commandBufferVal = (CommandBufferVal*)queueSubmitDesc.commandBuffers[i];
+        NRI_RETURN_ON_FAILURE(&m_Device, commandBufferVal, Result::INVALID_ARGUMENT, "'commandBuffers[%u]' is NULL", i);
+        if (validateLifetime)
+            NRI_RETURN_ON_FAILURE(&m_Device, commandBufferVal->IsSubmittable(), Result::INVALID_ARGUMENT, "'commandBuffers[%u]' is still in the recording state", i);
+
+        commandBuffers[i] = commandBufferVal->GetImpl();
+    }
+    queueSubmitDescImpl.commandBuffers = commandBuffers;
+
     queueSubmitDescImpl.swapChain = NRI_GET_IMPL(SwapChain, queueSubmitDesc.swapChain);
 
     return GetCoreInterfaceImpl().QueueSubmit(*GetImpl(), queueSubmitDescImpl);
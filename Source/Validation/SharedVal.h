@@ -54,7 +54,10 @@ struct ObjectVal : public DebugNameBaseVal {
     }
 
     inline const char* GetDebugName() const {
-        return m_Name ? m_Name : "unnamed";
+        if (m_Name)
+            return m_Name;
+
+        return m_NameStorage[0] ? m_NameStorage : "unnamed";
     }
 
     inline DeviceVal& GetDevice() const {
@@ -106,9 +109,15 @@ struct ObjectVal : public DebugNameBaseVal {
         if (m_Name)
             allocationCallbacks.Free(allocationCallbacks.userArg, m_Name);
 
+        // Short names are stored in place (no pointer to self, since some wrappers are copied into containers)
         size_t len = strlen(name);
-        m_Name = (char*)allocationCallbacks.Allocate(allocationCallbacks.userArg, len + 1, sizeof(size_t));
-        strcpy(m_Name, name);
+        if (len < NRI_VAL_INLINE_NAME_SIZE) {
+            m_Name = nullptr;
+            memcpy(m_NameStorage, name, len + 1);
+        } else {
+            m_Name = (char*)allocationCallbacks.Allocate(allocationCallbacks.userArg, len + 1, sizeof(size_t));
+            memcpy(m_Name, name, len + 1);
+        }
 
         m_Device.GetCoreInterfaceImpl().SetDebugName(m_Impl, name);
     }
@@ -117,9 +126,10 @@ protected:
 #ifndef NDEBUG
     uint64_t m_Signature = NRI_OBJECT_SIGNATURE; // .natvis
 #endif
-    char* m_Name = nullptr; // .natvis
+    char* m_Name = nullptr; // .natvis (long names only)
     Object* m_Impl = nullptr;
     DeviceVal& m_Device;
+    char m_NameStorage[NRI_VAL_INLINE_NAME_SIZE] = {}; // .natvis
 };
 
 template <typename T>
@@ -2,7 +2,7 @@
 
 SwapChainVal::~SwapChainVal() {
     for (size_t i = 0; i < m_Textures.size(); i++)
-        Destroy(m_Textures[i]);
+        m_Device.DestroyObject(m_Textures[i]);
 }
 
 NRI_INLINE Texture* const* SwapChainVal::GetTextures(uint32_t& textureNum) {
@@ -10,7 +10,7 @@ NRI_INLINE Texture* const* SwapChainVal::GetTextures(uint32_t& textureNum) {
 
     if (m_Textures.empty()) {
         for (uint32_t i = 0; i < textureNum; i++) {
-            TextureVal* textureVal = Allocate<TextureVal>(m_Device.GetAllocationCallbacks(), m_Device, textures[i], true);
+            TextureVal* textureVal = m_Device.AllocateObject<TextureVal>(m_Device, textures[i], true);
             m_Textures.push_back(textureVal);
         }
     }
@@ -29,7 +29,8 @@ NRI_INLINE Result SwapChainVal::WaitForPresent(uint64_t presentId) {
     NRI_RETURN_ON_FAILURE(&m_Device, m_SwapChainDesc.flags & SwapChainBits::WAITABLE, Result::FAILURE, "Swap chain has not been created with 'WAITABLE' flag");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
-    NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.features.waitableSwapChain, Result::FAILURE, "'features.waitableSwapChain' is false");
+    bool isVirtual = m_SwapChainDesc.flags & SwapChainBits::VIRTUAL;
+    NRI_RETURN_ON_FAILURE(&m_Device, isVirtual || deviceDesc.features.waitableSwapChain, Result::FAILURE, "'features.waitableSwapChain' is false");
 
     return GetSwapChainInterfaceImpl().WaitForPresent(*GetImpl(), presentId);
 }
@@ -48,7 +49,8 @@ NRI_INLINE Result SwapChainVal::SetLatencySleepMode(const LatencySleepMode& late
     NRI_RETURN_ON_FAILURE(&m_Device, m_SwapChainDesc.flags & SwapChainBits::ALLOW_LOW_LATENCY, Result::FAILURE, "Swap chain has not been created with 'ALLOW_LOW_LATENCY' flag");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
-    NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.features.lowLatency, Result::FAILURE, "'features.lowLatency' is false");
+    bool isVirtual = m_SwapChainDesc.flags & SwapChainBits::VIRTUAL;
+    NRI_RETURN_ON_FAILURE(&m_Device, isVirtual || deviceDesc.features.lowLatency, Result::FAILURE, "'features.lowLatency' is false");
 
     return GetLowLatencyInterfaceImpl().SetLatencySleepMode(*GetImpl(), latencySleepMode);
 }
@@ -58,7 +60,8 @@ NRI_INLINE Result SwapChainVal::SetLatencyMarker(uint64_t presentId, LatencyMark
     NRI_RETURN_ON_FAILURE(&m_Device, m_SwapChainDesc.flags & SwapChainBits::ALLOW_LOW_LATENCY, Result::FAILURE, "Swap chain has not been created with 'ALLOW_LOW_LATENCY' flag");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
-    NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.features.lowLatency, Result::FAILURE, "'features.lowLatency' is false");
+    bool isVirtual = m_SwapChainDesc.flags & SwapChainBits::VIRTUAL;
+    NRI_RETURN_ON_FAILURE(&m_Device, isVirtual || deviceDesc.features.lowLatency, Result::FAILURE, "'features.lowLatency' is false");
 
     return GetLowLatencyInterfaceImpl().SetLatencyMarker(*GetImpl(), presentId, latencyMarker);
 }
@@ -68,7 +71,8 @@ NRI_INLINE Result SwapChainVal::LatencySleep(uint64_t presentId) {
     NRI_RETURN_ON_FAILURE(&m_Device, m_SwapChainDesc.flags & SwapChainBits::ALLOW_LOW_LATENCY, Result::FAILURE, "Swap chain has not been created with 'ALLOW_LOW_LATENCY' flag");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
-    NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.features.lowLatency, Result::FAILURE, "'features.lowLatency' is false");
+    bool isVirtual = m_SwapChainDesc.flags & SwapChainBits::VIRTUAL;
+    NRI_RETURN_ON_FAILURE(&m_Device, isVirtual || deviceDesc.features.lowLatency, Result::FAILURE, "'features.lowLatency' is false");
 
     return GetLowLatencyInterfaceImpl().LatencySleep(*GetImpl(), presentId);
 }
@@ -77,7 +81,8 @@ NRI_INLINE Result SwapChainVal::GetLatencyReport(LatencyReport& latencyReport) {
     NRI_RETURN_ON_FAILURE(&m_Device, m_SwapChainDesc.flags & SwapChainBits::ALLOW_LOW_LATENCY, Result::FAILURE, "Swap chain has not been created with 'ALLOW_LOW_LATENCY' flag");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
-    NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.features.lowLatency, Result::FAILURE, "'features.lowLatency' is false");
+    bool isVirtual = m_SwapChainDesc.flags & SwapChainBits::VIRTUAL;
+    NRI_RETURN_ON_FAILURE(&m_Device, isVirtual || deviceDesc.features.lowLatency, Result::FAILURE, "'features.lowLatency' is false");
 
     return GetLowLatencyInterfaceImpl().GetLatencyReport(*GetImpl(), latencyReport);
 }
@@ -17,6 +17,16 @@ struct ClearPipelineWGPU {
     Sample_t sampleNum = 1;
 };
 
+// Emulated dynamic state: pipelines declaring "dynamicStates" are specialized on the fly (see "PipelineWGPU::GetRenderPipeline")
+struct DynamicStateWGPU {
+    std::array<ColorAttachmentDesc, COLOR_ATTACHMENT_MAX_NUM_WGPU> colors = {};
+    StencilAttachmentDesc stencil = {};
+    DepthAttachmentDesc depth = {};
+    Topology topology = Topology::TRIANGLE_LIST;
+    CullMode cullMode = CullMode::NONE;
+    bool frontCounterClockwise = false;
+};
+
 struct ClearStorageBufferPipelineWGPU {
     WGPUBindGroupLayout bindGroupLayout = nullptr;
     WGPUPipelineLayout pipelineLayout = nullptr;
@@ -96,11 +106,19 @@ struct CommandBufferWGPU final : public DebugNameBase {
     void SetIndexBuffer(const Buffer& buffer, uint64_t offset, IndexType indexType);
     void SetStencilReference(uint8_t frontRef, uint8_t backRef);
     void SetBlendConstants(const Color32f& color);
+    void SetTopology(Topology topology, PrimitiveRestart primitiveRestart);
+    void SetCullMode(CullMode cullMode);
+    void SetFrontFace(bool frontCounterClockwise);
+    void SetDepthState(const DepthAttachmentDesc& depth);
+    void SetStencilState(const StencilAttachmentDesc& stencil);
+    void SetColorState(uint32_t baseAttachment, const ColorAttachmentDesc* colors, uint32_t colorNum);
     void BeginRendering(const RenderingDesc& renderingDesc);
     void EndRendering();
     void ClearAttachments(const ClearAttachmentDesc* clearAttachmentDescs, uint32_t clearAttachmentDescNum, const Rect* rects, uint32_t rectNum);
     void Draw(const DrawDesc& drawDesc);
     void DrawIndexed(const DrawIndexedDesc& drawIndexedDesc);
+    void DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride);
+    void DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride);
     void DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void Dispatch(const DispatchDesc& dispatchDesc);
@@ -139,6 +157,7 @@ private:
     void MarkDescriptorSetsDirty(BindPoint bindPoint);
     void BindRootGroup(BindPoint bindPoint);
     void RestoreRootConstants(BindPoint bindPoint);
+    void FlushDynamicState();
     void ReleaseRenderPassTransientObjects();
     void PopPassAnnotations(AnnotationScopeWGPU scope);
     void FlushDeferredEncoderAnnotationPops();
@@ -165,6 +184,7 @@ private:
     Vector<AnnotationScopeWGPU> m_AnnotationScopes;
     Vector<WGPUBuffer> m_TemporaryBuffers;
     ClearStorageBufferPipelineWGPU m_ClearStorageBufferPipeline = {};
+    DynamicStateWGPU m_DynamicState = {};
     WGPUCommandEncoder m_CommandEncoder = nullptr;
     WGPUCommandBuffer m_CommandBuffer = nullptr;
     WGPURenderPassEncoder m_RenderPass = nullptr;
@@ -197,6 +217,7 @@ private:
     bool m_ComputeRootGroupDirty = true;
     bool m_HasViewport = false;
     bool m_HasScissor = false;
+    bool m_IsDynamicStateDirty = false;
 };
 
 } // namespace nri
@@ -682,6 +682,8 @@ Result CommandBufferWGPU::Begin(const DescriptorPool* descriptorPool) {
     m_HasViewport = false;
     m_HasScissor = false;
     m_StencilReference = 0;
+    m_DynamicState = {};
+    m_IsDynamicStateDirty = false;
 
     return m_CommandEncoder ? Result::SUCCESS : Result::FAILURE;
 }
@@ -785,7 +787,7 @@ void CommandBufferWGPU::SetPipelineLayout(BindPoint bindPoint, const PipelineLay
 
 void CommandBufferWGPU::SetPipeline(const Pipeline& pipeline) {
     const PipelineWGPU& pipelineWGPU = (PipelineWGPU&)pipeline;
-    WGPURenderPipeline renderPipeline = pipelineWGPU.GetRenderPipeline();
+    WGPURenderPipeline renderPipeline = pipelineWGPU.GetRenderPipeline(m_DynamicState);
 
     if (renderPipeline && m_GraphicsPipelineWGPU != &pipelineWGPU) {
         m_GraphicsPipelineWGPU = &pipelineWGPU;
@@ -795,6 +797,7 @@ void CommandBufferWGPU::SetPipeline(const Pipeline& pipeline) {
     if (m_RenderPass && renderPipeline && renderPipeline != m_RenderPipeline) {
         wgpuRenderPassEncoderSetPipeline(m_RenderPass, renderPipeline);
         m_RenderPipeline = renderPipeline;
+        m_IsDynamicStateDirty = false;
     }
 
     if (m_RenderPass && renderPipeline)
@@ -1141,6 +1144,69 @@ void CommandBufferWGPU::SetBlendConstants(const Color32f& color) {
     wgpuRenderPassEncoderSetBlendConstant(m_RenderPass, &wgpuColor);
 }
 
+void CommandBufferWGPU::SetTopology(Topology topology, PrimitiveRestart primitiveRestart) {
+    // Primitive restart is always enabled for strip topologies in WebGPU
+    MaybeUnused(primitiveRestart);
+
+    m_DynamicState.topology = topology;
+    m_IsDynamicStateDirty = true;
+}
+
+void CommandBufferWGPU::SetCullMode(CullMode cullMode) {
+    m_DynamicState.cullMode = cullMode;
+    m_IsDynamicStateDirty = true;
+}
+
+void CommandBufferWGPU::SetFrontFace(bool frontCounterClockwise) {
+    m_DynamicState.frontCounterClockwise = frontCounterClockwise;
+    m_IsDynamicStateDirty = true;
+}
+
+void CommandBufferWGPU::SetDepthState(const DepthAttachmentDesc& depth) {
+    m_DynamicState.depth = depth;
+    m_DynamicState.depth.boundsTest = false; // unsupported, must not affect pipeline variant selection
+    m_IsDynamicStateDirty = true;
+}
+
+void CommandBufferWGPU::SetStencilState(const StencilAttachmentDesc& stencil) {
+    m_DynamicState.stencil = stencil;
+    m_IsDynamicStateDirty = true;
+}
+
+void CommandBufferWGPU::SetColorState(uint32_t baseAttachment, const ColorAttachmentDesc* colors, uint32_t colorNum) {
+    for (uint32_t i = 0; i < colorNum && baseAttachment + i < COLOR_ATTACHMENT_MAX_NUM_WGPU; i++) {
+        ColorAttachmentDesc& color = m_DynamicState.colors[baseAttachment + i];
+        color = colors[i];
+        color.format = Format::UNKNOWN; // ignored, must not affect pipeline variant selection
+
+        // Blend factors and ops are ignored if blending is disabled
+        if (!color.blendEnabled) {
+            color.colorBlend = {};
+            color.alphaBlend = {};
+        }
+    }
+
+    m_IsDynamicStateDirty = true;
+}
+
+void CommandBufferWGPU::FlushDynamicState() {
+    if (!m_IsDynamicStateDirty || !m_RenderPipeline || !m_GraphicsPipelineWGPU)
+        return;
+
+    m_IsDynamicStateDirty = false;
+
+    if (!m_GraphicsPipelineWGPU->HasDynamicStates())
+        return;
+
+    WGPURenderPipeline renderPipeline = m_GraphicsPipelineWGPU->GetRenderPipeline(m_DynamicState);
+    if (renderPipeline && renderPipeline != m_RenderPipeline) {
+        wgpuRenderPassEncoderSetPipeline(m_RenderPass, renderPipeline);
+        m_RenderPipeline = renderPipeline;
+
+        RestoreRootConstants(BindPoint::GRAPHICS);
+    }
+}
+
 void CommandBufferWGPU::BeginRendering(const RenderingDesc& renderingDesc) {
     EndPass();
 
@@ -1365,6 +1431,7 @@ static WGPUExtent3D GetCopySize(const TextureDesc& textureDesc, const TextureReg
 
 void CommandBufferWGPU::Draw(const DrawDesc& drawDesc) {
     if (m_RenderPass) {
+        FlushDynamicState();
         BindRootGroup(BindPoint::GRAPHICS);
         BindDescriptorSets(BindPoint::GRAPHICS);
         wgpuRenderPassEncoderDraw(m_RenderPass, drawDesc.vertexNum, drawDesc.instanceNum, drawDesc.baseVertex, drawDesc.baseInstance);
@@ -1373,12 +1440,41 @@ void CommandBufferWGPU::Draw(const DrawDesc& drawDesc) {
 
 void CommandBufferWGPU::DrawIndexed(const DrawIndexedDesc& drawIndexedDesc) {
     if (m_RenderPass) {
+        FlushDynamicState();
         BindRootGroup(BindPoint::GRAPHICS);
         BindDescriptorSets(BindPoint::GRAPHICS);
         wgpuRenderPassEncoderDrawIndexed(m_RenderPass, drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
     }
 }
 
+void CommandBufferWGPU::DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum, uint32_t stride) {
+    if (m_RenderPass) {
+        FlushDynamicState();
+        BindRootGroup(BindPoint::GRAPHICS);
+        BindDescriptorSets(BindPoint::GRAPHICS);
+
+        const uint8_t* descs = (uint8_t*)drawDescs;
+        for (uint32_t i = 0; i < drawNum; i++) {
+            const DrawDesc& drawDesc = *(DrawDesc*)(descs + (size_t)i * stride);
+            wgpuRenderPassEncoderDraw(m_RenderPass, drawDesc.vertexNum, drawDesc.instanceNum, drawDesc.baseVertex, drawDesc.baseInstance);
+        }
+    }
+}
+
+void CommandBufferWGPU::DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum, uint32_t stride) {
+    if (m_RenderPass) {
+        FlushDynamicState();
+        BindRootGroup(BindPoint::GRAPHICS);
+        BindDescriptorSets(BindPoint::GRAPHICS);
+
+        const uint8_t* descs = (uint8_t*)drawIndexedDescs;
+        for (uint32_t i = 0; i < drawNum; i++) {
+            const DrawIndexedDesc& drawIndexedDesc = *(DrawIndexedDesc*)(descs + (size_t)i * stride);
+            wgpuRenderPassEncoderDrawIndexed(m_RenderPass, drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
+        }
+    }
+}
+
 void CommandBufferWGPU::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     // TODO: WGPU indirect-count draws are not advertised because native count APIs do not support NRI's stride.
     MaybeUnused(countBuffer, countBufferOffset);
@@ -1386,6 +1482,7 @@ void CommandBufferWGPU::DrawIndirect(const Buffer& buffer, uint64_t offset, uint
     if (!m_RenderPass)
         return;
 
+    FlushDynamicState();
     BindRootGroup(BindPoint::GRAPHICS);
     BindDescriptorSets(BindPoint::GRAPHICS);
 
@@ -1401,6 +1498,7 @@ void CommandBufferWGPU::DrawIndexedIndirect(const Buffer& buffer, uint64_t offse
     if (!m_RenderPass)
         return;
 
+    FlushDynamicState();
     BindRootGroup(BindPoint::GRAPHICS);
     BindDescriptorSets(BindPoint::GRAPHICS);
 
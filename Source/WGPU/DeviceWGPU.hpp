@@ -342,6 +342,7 @@ void DeviceWGPU::FillDesc(const AdapterDesc& adapterDesc) {
     m_Desc.other.cullDistanceMaxNum = 0;
     m_Desc.other.combinedClipAndCullDistanceMaxNum = m_Desc.other.clipDistanceMaxNum;
     m_Desc.other.viewMaxNum = 1;
+    m_Desc.other.dynamicStates = DynamicStateBits::TOPOLOGY | DynamicStateBits::CULL_MODE | DynamicStateBits::FRONT_FACE | DynamicStateBits::DEPTH | DynamicStateBits::STENCIL | DynamicStateBits::COLOR; // emulated via pipeline variants
 
     m_Desc.tiers.resourceBinding = 0;
     m_Desc.tiers.bindless = 0;
@@ -7,7 +7,14 @@ namespace nri {
 struct PipelineWGPU final : public DebugNameBase {
     inline PipelineWGPU(DeviceWGPU& device)
         : m_Device(device)
-        , m_SetMappings(device.GetStdAllocator()) {
+        , m_SetMappings(device.GetStdAllocator())
+        , m_Attributes(device.GetStdAllocator())
+        , m_Streams(device.GetStdAllocator())
+        , m_Blends(device.GetStdAllocator())
+        , m_ColorTargets(device.GetStdAllocator())
+        , m_VertexEntryPoint(device.GetStdAllocator())
+        , m_FragmentEntryPoint(device.GetStdAllocator())
+        , m_Variants(device.GetStdAllocator()) {
     }
 
     ~PipelineWGPU();
@@ -16,6 +23,10 @@ struct PipelineWGPU final : public DebugNameBase {
         return m_RenderPipeline;
     }
 
+    inline bool HasDynamicStates() const {
+        return m_DynamicStates != DynamicStateBits::NONE;
+    }
+
     inline WGPUComputePipeline GetComputePipeline() const {
         return m_ComputePipeline;
     }
@@ -30,6 +41,7 @@ struct PipelineWGPU final : public DebugNameBase {
 
     bool HasBindGroup(uint32_t bindGroupIndex) const;
     const DescriptorSetMappingWGPU* GetDescriptorSetMapping(uint32_t bindGroupIndex) const;
+    WGPURenderPipeline GetRenderPipeline(const DynamicStateWGPU& dynamicState) const;
 
     Result Create(const GraphicsPipelineDesc& graphicsPipelineDesc);
     Result Create(const ComputePipelineDesc& computePipelineDesc);
@@ -44,6 +56,7 @@ struct PipelineWGPU final : public DebugNameBase {
 
 private:
     WGPUShaderModule CreateShaderModule(const ShaderDesc& shaderDesc);
+    void SaveRenderPipelineDesc(const WGPURenderPipelineDescriptor& desc, const char* vertexEntryPoint, const char* fragmentEntryPoint);
 
 private:
     DeviceWGPU& m_Device;
@@ -52,6 +65,21 @@ private:
     WGPUComputePipeline m_ComputePipeline = nullptr;
     WGPUPipelineLayout m_PipelineLayout = nullptr;
     PipelineLayoutWGPU* m_PipelineLayoutWGPU = nullptr;
+
+    // A copy of the render pipeline descriptor, needed only if "dynamicStates" is not "NONE"
+    Vector<WGPUVertexAttribute> m_Attributes;
+    Vector<WGPUVertexBufferLayout> m_Streams;
+    Vector<WGPUBlendState> m_Blends;
+    Vector<WGPUColorTargetState> m_ColorTargets;
+    String m_VertexEntryPoint;
+    String m_FragmentEntryPoint;
+    WGPURenderPipelineDescriptor m_RenderPipelineDesc = WGPU_RENDER_PIPELINE_DESCRIPTOR_INIT;
+    WGPUFragmentState m_Fragment = WGPU_FRAGMENT_STATE_INIT;
+    WGPUDepthStencilState m_DepthStencil = WGPU_DEPTH_STENCIL_STATE_INIT;
+    DynamicStateBits m_DynamicStates = DynamicStateBits::NONE;
+
+    mutable UnorderedMap<uint64_t, WGPURenderPipeline> m_Variants; // guarded by "m_Lock"
+    mutable Lock m_Lock;
 };
 
 } // namespace nri
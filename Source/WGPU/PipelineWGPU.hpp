@@ -1,6 +1,14 @@
 // © 2026 NVIDIA Corporation
 
 PipelineWGPU::~PipelineWGPU() {
+    for (auto& variant : m_Variants)
+        wgpuRenderPipelineRelease(variant.second);
+
+    if (m_RenderPipelineDesc.vertex.module)
+        wgpuShaderModuleRelease(m_RenderPipelineDesc.vertex.module);
+    if (m_Fragment.module)
+        wgpuShaderModuleRelease(m_Fragment.module);
+
     if (m_RenderPipeline)
         wgpuRenderPipelineRelease(m_RenderPipeline);
     if (m_ComputePipeline)
@@ -327,13 +335,152 @@ Result PipelineWGPU::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
 
     m_RenderPipeline = wgpuDeviceCreateRenderPipeline(m_Device, &desc);
 
-    wgpuShaderModuleRelease(vertexShader);
-    if (fragmentShader)
-        wgpuShaderModuleRelease(fragmentShader);
+    // Pipelines with dynamic states keep the descriptor (and shader modules) to create specialized variants later
+    if (m_RenderPipeline && graphicsPipelineDesc.dynamicStates != DynamicStateBits::NONE) {
+        m_DynamicStates = graphicsPipelineDesc.dynamicStates;
+        SaveRenderPipelineDesc(desc, vertexEntryPoint, fragmentEntryPoint);
+    } else {
+        wgpuShaderModuleRelease(vertexShader);
+        if (fragmentShader)
+            wgpuShaderModuleRelease(fragmentShader);
+    }
 
     return m_RenderPipeline ? Result::SUCCESS : Result::FAILURE;
 }
 
+void PipelineWGPU::SaveRenderPipelineDesc(const WGPURenderPipelineDescriptor& desc, const char* vertexEntryPoint, const char* fragmentEntryPoint) {
+    m_RenderPipelineDesc = desc;
+    m_VertexEntryPoint = vertexEntryPoint;
+    m_FragmentEntryPoint = fragmentEntryPoint;
+
+    // Vertex input
+    m_Streams.assign(desc.vertex.buffers, desc.vertex.buffers + desc.vertex.bufferCount);
+    for (const WGPUVertexBufferLayout& stream : m_Streams)
+        m_Attributes.insert(m_Attributes.end(), stream.attributes, stream.attributes + stream.attributeCount);
+
+    size_t attributeOffset = 0;
+    for (WGPUVertexBufferLayout& stream : m_Streams) {
+        stream.attributes = m_Attributes.data() + attributeOffset;
+        attributeOffset += stream.attributeCount;
+    }
+
+    m_RenderPipelineDesc.vertex.buffers = m_Streams.data();
+
+    // Fragment (blend states are rebuilt per variant if "COLOR" is dynamic)
+    if (desc.fragment) {
+        m_Fragment = *desc.fragment;
+        m_ColorTargets.assign(desc.fragment->targets, desc.fragment->targets + desc.fragment->targetCount);
+        m_Blends.resize(m_ColorTargets.size());
+
+        for (size_t i = 0; i < m_ColorTargets.size(); i++) {
+            if (m_ColorTargets[i].blend) {
+                m_Blends[i] = *m_ColorTargets[i].blend;
+                m_ColorTargets[i].blend = &m_Blends[i];
+            }
+        }
+
+        m_Fragment.targets = m_ColorTargets.data();
+        m_RenderPipelineDesc.fragment = &m_Fragment;
+    }
+
+    // Depth-stencil
+    if (desc.depthStencil) {
+        m_DepthStencil = *desc.depthStencil;
+        m_RenderPipelineDesc.depthStencil = &m_DepthStencil;
+    }
+}
+
+WGPURenderPipeline PipelineWGPU::GetRenderPipeline(const DynamicStateWGPU& dynamicState) const {
+    if (m_DynamicStates == DynamicStateBits::NONE)
+        return m_RenderPipeline;
+
+    // Only the declared dynamic states contribute to the key
+    uint64_t key = HashBytes(&m_DynamicStates, sizeof(m_DynamicStates));
+    if (m_DynamicStates & DynamicStateBits::TOPOLOGY)
+        key = HashBytes(&dynamicState.topology, sizeof(dynamicState.topology), key);
+    if (m_DynamicStates & DynamicStateBits::CULL_MODE)
+        key = HashBytes(&dynamicState.cullMode, sizeof(dynamicState.cullMode), key);
+    if (m_DynamicStates & DynamicStateBits::FRONT_FACE)
+        key = HashBytes(&dynamicState.frontCounterClockwise, sizeof(dynamicState.frontCounterClockwise), key);
+    if (m_DynamicStates & DynamicStateBits::DEPTH)
+        key = HashBytes(&dynamicState.depth, sizeof(dynamicState.depth), key);
+    if (m_DynamicStates & DynamicStateBits::STENCIL)
+        key = HashBytes(&dynamicState.stencil, sizeof(dynamicState.stencil), key);
+    if (m_DynamicStates & DynamicStateBits::COLOR)
+        key = HashBytes(dynamicState.colors.data(), m_ColorTargets.size() * sizeof(ColorAttachmentDesc), key);
+
+    ExclusiveScope lock(m_Lock);
+
+    auto it = m_Variants.find(key);
+    if (it != m_Variants.end())
+        return it->second;
+
+    // Specialize the saved descriptor
+    WGPURenderPipelineDescriptor desc = m_RenderPipelineDesc;
+    WGPUFragmentState fragment = m_Fragment;
+    WGPUDepthStencilState depthStencil = m_DepthStencil;
+
+    Scratch<WGPUBlendState> blends = NRI_ALLOCATE_SCRATCH(m_Device, WGPUBlendState, m_ColorTargets.size());
+    Scratch<WGPUColorTargetState> colorTargets = NRI_ALLOCATE_SCRATCH(m_Device, WGPUColorTargetState, m_ColorTargets.size());
+
+    for (size_t i = 0; i < m_ColorTargets.size(); i++) {
+        WGPUColorTargetState& out = colorTargets[i];
+        out = m_ColorTargets[i];
+
+        if (m_DynamicStates & DynamicStateBits::COLOR) {
+            const ColorAttachmentDesc& in = dynamicState.colors[i];
+            out.writeMask = GetColorWriteMask(in.colorWriteMask);
+            out.blend = nullptr;
+
+            if (in.blendEnabled) {
+                WGPUBlendState& blend = blends[i];
+                blend = WGPU_BLEND_STATE_INIT;
+                blend.color.srcFactor = GetBlendFactor(in.colorBlend.srcFactor);
+                blend.color.dstFactor = GetBlendFactor(in.colorBlend.dstFactor);
+                blend.color.operation = GetBlendOperation(in.colorBlend.op);
+                blend.alpha.srcFactor = GetBlendFactor(in.alphaBlend.srcFactor);
+                blend.alpha.dstFactor = GetBlendFactor(in.alphaBlend.dstFactor);
+                blend.alpha.operation = GetBlendOperation(in.alphaBlend.op);
+                out.blend = &blend;
+            }
+        }
+    }
+
+    fragment.targets = colorTargets;
+    fragment.entryPoint = WGPUString(m_FragmentEntryPoint.c_str());
+    desc.vertex.entryPoint = WGPUString(m_VertexEntryPoint.c_str());
+    desc.fragment = fragment.module ? &fragment : nullptr;
+
+    if (m_DynamicStates & DynamicStateBits::TOPOLOGY)
+        desc.primitive.topology = GetPrimitiveTopology(dynamicState.topology);
+    if (m_DynamicStates & DynamicStateBits::CULL_MODE)
+        desc.primitive.cullMode = GetCullMode(dynamicState.cullMode);
+    if (m_DynamicStates & DynamicStateBits::FRONT_FACE)
+        desc.primitive.frontFace = GetFrontFace(dynamicState.frontCounterClockwise);
+
+    if (m_RenderPipelineDesc.depthStencil) {
+        if (m_DynamicStates & DynamicStateBits::DEPTH) {
+            depthStencil.depthWriteEnabled = dynamicState.depth.write ? WGPUOptionalBool_True : WGPUOptionalBool_False;
+            depthStencil.depthCompare = dynamicState.depth.compareOp == CompareOp::NONE ? WGPUCompareFunction_Always : GetCompareFunction(dynamicState.depth.compareOp);
+        }
+
+        if (m_DynamicStates & DynamicStateBits::STENCIL) {
+            depthStencil.stencilReadMask = dynamicState.stencil.front.compareMask;
+            depthStencil.stencilWriteMask = dynamicState.stencil.front.writeMask;
+            FillStencilFace(depthStencil.stencilFront, dynamicState.stencil.front);
+            FillStencilFace(depthStencil.stencilBack, dynamicState.stencil.back);
+        }
+
+        desc.depthStencil = &depthStencil;
+    }
+
+    WGPURenderPipeline renderPipeline = wgpuDeviceCreateRenderPipeline(m_Device, &desc);
+    if (renderPipeline)
+        m_Variants.emplace(key, renderPipeline);
+
+    return renderPipeline;
+}
+
 Result PipelineWGPU::Create(const ComputePipelineDesc& computePipelineDesc) {
     m_PipelineLayoutWGPU = (PipelineLayoutWGPU*)computePipelineDesc.pipelineLayout;
     Result result = m_PipelineLayoutWGPU->CreatePipelineLayout(&computePipelineDesc.shader, 1, WGPUShaderStage_Compute, m_SetMappings, m_PipelineLayout);
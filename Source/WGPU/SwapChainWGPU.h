@@ -19,9 +19,9 @@ struct SwapChainWGPU final : public DisplayDescHelper, public DebugNameBase {
     Result Create(const SwapChainDesc& swapChainDesc);
     Texture* const* GetTextures(uint32_t& textureNum) const;
     Result GetDisplayDesc(DisplayDesc& displayDesc);
-    Result AcquireNextTexture(uint32_t& textureIndex);
-    Result WaitForPresent();
-    Result Present();
+    Result AcquireNextTexture(Fence& acquireSemaphore, uint32_t& textureIndex);
+    Result WaitForPresent(uint64_t presentId);
+    Result Present(Fence& releaseSemaphore, uint64_t presentId);
 
     //================================================================================================================
     // DebugNameBase
@@ -39,6 +39,7 @@ private:
 private:
     DeviceWGPU& m_Device;
     Vector<TextureWGPU*> m_Textures;
+    SwapChainVirtual* m_Virtual = nullptr; // "SwapChainBits::VIRTUAL"
     WGPUSurface m_Surface = nullptr;
     void* m_Hwnd = nullptr;
     uint32_t m_TextureIndex = 0;
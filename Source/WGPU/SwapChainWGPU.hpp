@@ -1,6 +1,8 @@
 // © 2026 NVIDIA Corporation
 
 SwapChainWGPU::~SwapChainWGPU() {
+    Destroy(m_Virtual);
+
     for (TextureWGPU* texture : m_Textures)
         Destroy(m_Device.GetAllocationCallbacks(), texture);
 
@@ -49,6 +51,12 @@ WGPUCompositeAlphaMode SwapChainWGPU::GetAlphaMode(const WGPUSurfaceCapabilities
 }
 
 Result SwapChainWGPU::Create(const SwapChainDesc& swapChainDesc) {
+    if (swapChainDesc.flags & SwapChainBits::VIRTUAL) {
+        m_Virtual = Allocate<SwapChainVirtual>(m_Device.GetAllocationCallbacks(), m_Device);
+
+        return m_Virtual->Create(swapChainDesc);
+    }
+
     WGPUChainedStruct* surfaceSource = nullptr;
 
 #if defined(_WIN32)
@@ -137,17 +145,26 @@ Result SwapChainWGPU::Create(const SwapChainDesc& swapChainDesc) {
 }
 
 Texture* const* SwapChainWGPU::GetTextures(uint32_t& textureNum) const {
+    if (m_Virtual)
+        return m_Virtual->GetTextures(textureNum);
+
     textureNum = (uint32_t)m_Textures.size();
 
     return (Texture**)m_Textures.data();
 }
 
 Result SwapChainWGPU::GetDisplayDesc(DisplayDesc& displayDesc) {
+    if (m_Virtual)
+        return m_Virtual->GetDisplayDesc(displayDesc);
+
     // TODO: DisplayDescHelper is HWND-based. Add X11/Wayland/macOS display queries for non-Windows swapchains.
     return DisplayDescHelper::GetDisplayDesc(m_Hwnd, displayDesc);
 }
 
-Result SwapChainWGPU::AcquireNextTexture(uint32_t& textureIndex) {
+Result SwapChainWGPU::AcquireNextTexture(Fence& acquireSemaphore, uint32_t& textureIndex) {
+    if (m_Virtual)
+        return m_Virtual->AcquireNextTexture(acquireSemaphore, textureIndex);
+
     WGPUSurfaceTexture surfaceTexture = WGPU_SURFACE_TEXTURE_INIT;
     wgpuSurfaceGetCurrentTexture(m_Surface, &surfaceTexture);
 
@@ -165,12 +182,18 @@ Result SwapChainWGPU::AcquireNextTexture(uint32_t& textureIndex) {
     return Result::SUCCESS;
 }
 
-Result SwapChainWGPU::WaitForPresent() {
+Result SwapChainWGPU::WaitForPresent(uint64_t presentId) {
+    if (m_Virtual)
+        return m_Virtual->WaitForPresent(presentId);
+
     // TODO: WGPU has no waitable-swapchain equivalent. Keep "features.waitableSwapChain = false".
     return Result::UNSUPPORTED;
 }
 
-Result SwapChainWGPU::Present() {
+Result SwapChainWGPU::Present(Fence& releaseSemaphore, uint64_t presentId) {
+    if (m_Virtual)
+        return m_Virtual->Present(releaseSemaphore, presentId);
+
     WGPUStatus status = wgpuSurfacePresent(m_Surface);
     if (m_CurrentTextureIndex != uint32_t(-1)) {
         m_Textures[m_CurrentTextureIndex]->DetachSurfaceTexture();